@@ -0,0 +1,983 @@
+/*----------------------------------------------------------------------
+C-  File:       SyntheticWatershed.c
+C-
+C-  Purpose/    Concatenated group of functions that write a complete
+C-  Methods:    TREX input deck for a synthetic watershed of any size.
+C-
+C-              The watershed is a rectangular grid with one corner
+C-              outside the domain.  Ground elevation falls toward
+C-              the last row and column.  The channel network is a
+C-              main stem along the last column (outlet at the last
+C-              row) and ntribs tributaries along evenly spaced rows
+C-              that join it from the west.  Links are numbered so
+C-              that every upstream link has a lower number than its
+C-              downstream link (main stem segment, tributary, main
+C-              stem segment, ...) as required when TREX computes the
+C-              network topology (tplgyopt = 0).  Channels are cut
+C-              one bank height into the ground surface.
+C-
+C-              Rainfall is a single storm over the first third of
+C-              the simulation: uniform for one gage (rainopt = 0)
+C-              or interpolated between gages (rainopt = 1, IDW)
+C-              whose intensities increase across the domain.  Two
+C-              soil types (west and east halves) and two land uses
+C-              (north and south halves) are assigned.  For ksim > 1
+C-              the deck has two solids types and a three layer soil
+C-              and sediment stack; for ksim > 2 it has nchems
+C-              chemicals that partition and biodegrade.
+C-
+C-              Time series are reported every 1/20th and grids
+C-              every 1/2 of the simulation duration so that output
+C-              costs are included but do not dominate a benchmark.
+C-
+C-  Function
+C-   Listing:   WriteSyntheticDeck, InSyntheticDomain,
+C-              BuildSyntheticNetwork, OpenSyntheticFile,
+C-              WriteSyntheticGrid, WriteSyntheticChannels,
+C-              WriteSyntheticInput
+C-
+C-  Inputs:     SyntheticDeck controls
+C-
+C-  Outputs:    grid (*.asc), channel (*.dat), and input (bench.inp)
+C-              files; SyntheticDeck counts
+C-
+C-  Controls:   ksim, ntribs, ngages, nchems
+C-
+C-  Calls:      None
+C-
+C-  Called by:  trexbench (main)
+C-
+C-  Created:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revised:
+C-
+C-  Date:
+C-
+C-  Revisions:
+C-
+C----------------------------------------------------------------------*/
+
+#include <stdio.h>		//C library for standard input/output
+#include <stdlib.h>		//C library for general utilities
+#include <math.h>		//C library for math functions
+
+//synthetic watershed generator interface
+#include "synthetic_watershed.h"
+
+//grid kinds written by WriteSyntheticGrid
+#define GRIDMASK 1			//domain mask
+#define GRIDELEVATION 2		//ground elevation (m)
+#define GRIDSOIL 3			//soil type
+#define GRIDLAND 4			//land use class
+#define GRIDSTORAGE 5		//depression storage depth (m)
+#define GRIDZERO 6			//zero initial condition
+#define GRIDLINK 7			//channel link number
+#define GRIDNODE 8			//channel node number
+#define GRIDSTACK 9			//number of soil stack layers
+#define GRIDTHICK 10		//soil layer thickness (m)
+#define GRIDCHEM 11			//initial chemical concentration (g/m3)
+
+//nodata value of all grids
+#define SYNTHETICNODATA -9999
+
+static int
+	**linkgrid,		//channel link number of each cell (nodata if not a channel)
+	**nodegrid,		//channel node number of each cell (nodata if not a channel)
+	*linknodes,		//number of nodes of each link
+	*tribrow;		//row of each tributary (junction with the main stem)
+
+static int
+	tribcol0;		//first (upstream) column of the tributaries
+
+static float
+	elevbase;		//ground elevation at the first row and column (m)
+
+//C
+//C
+			/*******************************************/
+			/*        FUNCTION: InSyntheticDomain      */
+			/*******************************************/
+
+/* Returns 1 if a cell is in the domain (the first corner is cut off) */
+
+static int InSyntheticDomain(SyntheticDeck *deck, int row, int col)
+{
+	//local variable declarations
+	int
+		cut;		//size of the corner outside the domain (cells)
+
+	//the corner cut grows with the grid size
+	cut = ((deck->nrows < deck->ncols) ? deck->nrows : deck->ncols) / 8;
+
+	//return domain status
+	return (row + col > cut + 1) ? 1 : 0;
+
+//End of function: Return to calling module
+}
+
+//C
+//C
+			/*******************************************/
+			/*     FUNCTION: BuildSyntheticNetwork     */
+			/*******************************************/
+
+/* Assigns the link and node of each channel cell (main stem and tributaries) */
+
+static void BuildSyntheticNetwork(SyntheticDeck *deck)
+{
+	//local variable declarations
+	int
+		row,		//row index
+		col,		//column index
+		itrib,		//tributary index
+		link,		//link number
+		firstrow,	//first (upstream) row of a main stem segment
+		lastrow;	//last (downstream) row of a main stem segment
+
+	//Allocate memory for the link and node grids
+	linkgrid = (int **)malloc((deck->nrows+1) * sizeof(int *));
+	nodegrid = (int **)malloc((deck->nrows+1) * sizeof(int *));
+
+	//loop over rows
+	for(row=1; row<=deck->nrows; row++)
+	{
+		//Allocate remaining memory for the link and node grids
+		linkgrid[row] = (int *)malloc((deck->ncols+1) * sizeof(int));
+		nodegrid[row] = (int *)malloc((deck->ncols+1) * sizeof(int));
+
+		//loop over columns
+		for(col=1; col<=deck->ncols; col++)
+		{
+			//the cell is not a channel
+			linkgrid[row][col] = SYNTHETICNODATA;
+			nodegrid[row][col] = SYNTHETICNODATA;
+
+		}	//end loop over columns
+
+	}	//end loop over rows
+
+	//Allocate memory for the tributary rows (tribrow[0] = 1 is the head of the main stem)
+	tribrow = (int *)malloc((deck->ntribs+2) * sizeof(int));
+
+	//the main stem starts at the first row
+	tribrow[0] = 1;
+
+	//loop over tributaries
+	for(itrib=1; itrib<=deck->ntribs; itrib++)
+	{
+		//tributaries are evenly spaced over the rows
+		tribrow[itrib] = itrib * deck->nrows / (deck->ntribs + 1);
+
+	}	//end loop over tributaries
+
+	//the last main stem segment ends at the last row
+	tribrow[deck->ntribs+1] = deck->nrows + 1;
+
+	//tributaries start at the first column of the east three quarters of the grid
+	tribcol0 = deck->ncols / 4 + 1;
+
+	//set the number of links (a main stem segment below each junction plus the tributaries)
+	deck->nlinks = 2 * deck->ntribs + 1;
+
+	//Allocate memory for the number of nodes of each link
+	linknodes = (int *)malloc((deck->nlinks+1) * sizeof(int));
+
+	//loop over main stem segments (itrib = tributary at the head of the segment)
+	for(itrib=0; itrib<=deck->ntribs; itrib++)
+	{
+		//if the segment is below a tributary
+		if(itrib > 0)
+		{
+			//the tributary link precedes its downstream segment
+			link = 2 * itrib;
+
+			//set the number of nodes of the tributary
+			linknodes[link] = deck->ncols - tribcol0;
+
+			//loop over tributary columns (upstream to downstream)
+			for(col=tribcol0; col<deck->ncols; col++)
+			{
+				//assign the link and node
+				linkgrid[tribrow[itrib]][col] = link;
+				nodegrid[tribrow[itrib]][col] = col - tribcol0 + 1;
+
+			}	//end loop over tributary columns
+
+		}	//end if itrib > 0
+
+		//set the main stem segment link and its rows
+		link = 2 * itrib + 1;
+		firstrow = tribrow[itrib];
+		lastrow = tribrow[itrib+1] - 1;
+
+		//set the number of nodes of the segment
+		linknodes[link] = lastrow - firstrow + 1;
+
+		//loop over segment rows (upstream to downstream)
+		for(row=firstrow; row<=lastrow; row++)
+		{
+			//assign the link and node
+			linkgrid[row][deck->ncols] = link;
+			nodegrid[row][deck->ncols] = row - firstrow + 1;
+
+		}	//end loop over segment rows
+
+	}	//end loop over main stem segments
+
+	//count the channel nodes
+	deck->nchnodes = deck->nrows + deck->ntribs * (deck->ncols - tribcol0);
+
+//End of function: Return to WriteSyntheticDeck
+}
+
+//C
+//C
+			/*******************************************/
+			/*      FUNCTION: OpenSyntheticFile        */
+			/*******************************************/
+
+/* Opens a deck file for writing (aborts if the file cannot be opened) */
+
+static FILE *OpenSyntheticFile(char *name)
+{
+	//local variable declarations
+	FILE
+		*fp;		//file pointer
+
+	//open the file for writing
+	fp = fopen(name, "w");
+
+	//if the file cannot be opened
+	if(fp == NULL)
+	{
+		//write error message to screen
+		printf("Error! Can't create synthetic deck file: %s\n", name);
+		exit(EXIT_FAILURE);	//abort
+
+	}	//end if fp == NULL
+
+	//return the file pointer
+	return fp;
+
+//End of function: Return to calling module
+}
+
+//C
+//C
+			/*******************************************/
+			/*      FUNCTION: WriteSyntheticGrid       */
+			/*******************************************/
+
+/* Writes one grid (ASCII raster) of the synthetic watershed */
+
+static void WriteSyntheticGrid(SyntheticDeck *deck, char *name, int kind)
+{
+	//local variable declarations
+	FILE
+		*fp;		//grid file pointer
+
+	int
+		row,		//row index
+		col;		//column index
+
+	//open the grid file
+	fp = OpenSyntheticFile(name);
+
+	//write the grid header
+	fprintf(fp, "grid %s\n", name);
+	fprintf(fp, "ncols %d\n", deck->ncols);
+	fprintf(fp, "nrows %d\n", deck->nrows);
+	fprintf(fp, "xllcorner 0\n");
+	fprintf(fp, "yllcorner 0\n");
+	fprintf(fp, "cellsize %g\n", deck->dx);
+	fprintf(fp, "NODATA_value %d\n", SYNTHETICNODATA);
+
+	//loop over rows
+	for(row=1; row<=deck->nrows; row++)
+	{
+		//loop over columns
+		for(col=1; col<=deck->ncols; col++)
+		{
+			//write a separator between values
+			if(col > 1)
+			{
+				fputc(' ', fp);
+			}
+
+			//if the cell is outside the domain
+			if(InSyntheticDomain(deck, row, col) == 0)
+			{
+				//write the nodata value
+				fprintf(fp, "%d", SYNTHETICNODATA);
+			}
+			else if(kind == GRIDMASK)	//else if the grid is the domain mask
+			{
+				fprintf(fp, "1");
+			}
+			else if(kind == GRIDELEVATION)	//else if the grid is the ground elevation
+			{
+				//ground slopes are 1.0% across rows and 0.67% across columns
+				fprintf(fp, "%.3f", elevbase - 0.01 * deck->dx * row - 0.0067 * deck->dx * col
+					- ((linkgrid[row][col] > 0) ? 1.0 : 0.0));
+			}
+			else if(kind == GRIDSOIL)	//else if the grid is the soil type
+			{
+				fprintf(fp, "%d", (col <= deck->ncols / 2) ? 1 : 2);
+			}
+			else if(kind == GRIDLAND)	//else if the grid is the land use class
+			{
+				fprintf(fp, "%d", (row <= deck->nrows / 2) ? 1 : 2);
+			}
+			else if(kind == GRIDSTORAGE)	//else if the grid is the depression storage depth
+			{
+				fprintf(fp, "0.001");
+			}
+			else if(kind == GRIDZERO)	//else if the grid is a zero initial condition
+			{
+				fprintf(fp, "0.0");
+			}
+			else if(kind == GRIDLINK)	//else if the grid is the channel link
+			{
+				fprintf(fp, "%d", linkgrid[row][col]);
+			}
+			else if(kind == GRIDNODE)	//else if the grid is the channel node
+			{
+				fprintf(fp, "%d", nodegrid[row][col]);
+			}
+			else if(kind == GRIDSTACK)	//else if the grid is the number of stack layers
+			{
+				fprintf(fp, "3");
+			}
+			else if(kind == GRIDTHICK)	//else if the grid is a soil layer thickness
+			{
+				fprintf(fp, "0.1");
+			}
+			else	//else the grid is an initial chemical concentration
+			{
+				fprintf(fp, "10.0");
+
+			}	//end if InSyntheticDomain() == 0
+
+		}	//end loop over columns
+
+		//end the row
+		fputc('\n', fp);
+
+	}	//end loop over rows
+
+	//close the grid file
+	fclose(fp);
+
+//End of function: Return to WriteSyntheticDeck
+}
+
+//C
+//C
+			/*******************************************/
+			/*    FUNCTION: WriteSyntheticChannels     */
+			/*******************************************/
+
+/* Writes the channel property and channel initial condition files */
+
+static void WriteSyntheticChannels(SyntheticDeck *deck)
+{
+	//local variable declarations
+	FILE
+		*fp;		//file pointer
+
+	int
+		link,		//link number
+		inode,		//node index
+		layer,		//sediment layer index
+		ichem;		//chemical index
+
+	float
+		bwidth;		//channel bottom width (m)
+
+	//Channel properties file
+	fp = OpenSyntheticFile("chan.dat");
+	fprintf(fp, "channel\nNLINKS %d\n", deck->nlinks);
+
+	//loop over links
+	for(link=1; link<=deck->nlinks; link++)
+	{
+		//write the link and number of nodes
+		fprintf(fp, "%d %d\n", link, linknodes[link]);
+
+		//main stem segments (odd links) are wider than tributaries
+		bwidth = (link % 2 == 1) ? 3.0f + 6.0f * (float)link / (float)deck->nlinks : 3.0f;
+
+		//loop over nodes
+		for(inode=1; inode<=linknodes[link]; inode++)
+		{
+			//bottom width, side slope, bank height, Manning n, sinuosity, dead storage
+			fprintf(fp, "%.2f 1.0 1.0 0.035 1.0 0.0\n", bwidth);
+
+		}	//end loop over nodes
+
+	}	//end loop over links
+
+	fclose(fp);
+
+	//Channel initial water depth file
+	fp = OpenSyntheticFile("hch0.dat");
+	fprintf(fp, "hch\nNLINKS %d\n", deck->nlinks);
+
+	//loop over links
+	for(link=1; link<=deck->nlinks; link++)
+	{
+		//write the link and number of nodes
+		fprintf(fp, "%d %d\n", link, linknodes[link]);
+
+		//loop over nodes
+		for(inode=1; inode<=linknodes[link]; inode++)
+		{
+			//initial water depth (m)
+			fprintf(fp, "0.05\n");
+
+		}	//end loop over nodes
+
+	}	//end loop over links
+
+	fclose(fp);
+
+	//if solids are simulated
+	if(deck->ksim > 1)
+	{
+		//Sediment properties file (three layers of two solids types)
+		fp = OpenSyntheticFile("sedprop.dat");
+		fprintf(fp, "sedprop\nNLINKS %d NSOLIDS 2 ERSCHOPT 1 CTLOPT 0\n", deck->nlinks);
+
+		//loop over links
+		for(link=1; link<=deck->nlinks; link++)
+		{
+			//write the link and number of nodes
+			fprintf(fp, "LINK %d NNODES %d\n", link, linknodes[link]);
+
+			//loop over nodes
+			for(inode=1; inode<=linknodes[link]; inode++)
+			{
+				//write the node and number of layers
+				fprintf(fp, "NODE %d NSTACK 3\n", inode);
+
+				//loop over layers (top to bottom)
+				for(layer=3; layer>=1; layer--)
+				{
+					//layer properties and grain size distribution
+					fprintf(fp, "LAYER %d THICK 0.1 BWIDTH 3.0 POROSITY 0.4\nGSD 0.5 0.5\n", layer);
+
+				}	//end loop over layers
+
+			}	//end loop over nodes
+
+		}	//end loop over links
+
+		fclose(fp);
+
+		//Channel initial suspended solids file
+		fp = OpenSyntheticFile("ssch0.dat");
+		fprintf(fp, "ssch\nNLINKS %d NSOLIDS 2\n", deck->nlinks);
+
+		//loop over links
+		for(link=1; link<=deck->nlinks; link++)
+		{
+			//write the link and number of nodes
+			fprintf(fp, "LINK %d NNODES %d\n", link, linknodes[link]);
+
+			//loop over nodes
+			for(inode=1; inode<=linknodes[link]; inode++)
+			{
+				//initial concentrations (g/m3)
+				fprintf(fp, "NODE %d 0.0 0.0\n", inode);
+
+			}	//end loop over nodes
+
+		}	//end loop over links
+
+		fclose(fp);
+
+	}	//end if ksim > 1
+
+	//if chemicals are simulated
+	if(deck->ksim > 2)
+	{
+		//Sediment chemical initial condition file
+		fp = OpenSyntheticFile("sedchem.dat");
+		fprintf(fp, "sedchem\nNLINKS %d NCHEMS %d\n", deck->nlinks, deck->nchems);
+
+		//loop over links
+		for(link=1; link<=deck->nlinks; link++)
+		{
+			//write the link and number of nodes
+			fprintf(fp, "LINK %d NNODES %d\n", link, linknodes[link]);
+
+			//loop over nodes
+			for(inode=1; inode<=linknodes[link]; inode++)
+			{
+				//write the node and number of layers
+				fprintf(fp, "NODE %d NSTACK 3\n", inode);
+
+				//loop over layers (top to bottom)
+				for(layer=3; layer>=1; layer--)
+				{
+					//write the layer
+					fprintf(fp, "LAYER %d\n", layer);
+
+					//loop over chemicals
+					for(ichem=1; ichem<=deck->nchems; ichem++)
+					{
+						//initial concentration (mg/kg)
+						fprintf(fp, "C%d 10.0\n", ichem);
+
+					}	//end loop over chemicals
+
+				}	//end loop over layers
+
+			}	//end loop over nodes
+
+		}	//end loop over links
+
+		fclose(fp);
+
+		//Channel initial water column chemical file
+		fp = OpenSyntheticFile("chemch0.dat");
+		fprintf(fp, "chemch0\nNLINKS %d NCHEMS %d\n", deck->nlinks, deck->nchems);
+
+		//loop over links
+		for(link=1; link<=deck->nlinks; link++)
+		{
+			//write the link and number of nodes
+			fprintf(fp, "LINK %d NNODES %d\n", link, linknodes[link]);
+
+			//loop over nodes
+			for(inode=1; inode<=linknodes[link]; inode++)
+			{
+				//write the node
+				fprintf(fp, "NODE %d", inode);
+
+				//loop over chemicals
+				for(ichem=1; ichem<=deck->nchems; ichem++)
+				{
+					//initial concentration (g/m3)
+					fprintf(fp, " 0.0");
+
+				}	//end loop over chemicals
+
+				fputc('\n', fp);
+
+			}	//end loop over nodes
+
+		}	//end loop over links
+
+		fclose(fp);
+
+	}	//end if ksim > 2
+
+//End of function: Return to WriteSyntheticDeck
+}
+
+//C
+//C
+			/*******************************************/
+			/*      FUNCTION: WriteSyntheticInput      */
+			/*******************************************/
+
+/* Writes the input file (Data Groups A through F) */
+
+static void WriteSyntheticInput(SyntheticDeck *deck)
+{
+	//local variable declarations
+	FILE
+		*fp;		//input file pointer
+
+	int
+		igage,		//rain gage index
+		isolid,		//solids index
+		ichem,		//chemical index
+		layer;		//soil layer index
+
+	float
+		width,		//domain width (m)
+		height,		//domain height (m)
+		storm,		//end of the storm (hours)
+		intensity;	//rain gage intensity (mm/hr)
+
+	//set the domain size (m)
+	width = deck->ncols * deck->dx;
+	height = deck->nrows * deck->dx;
+
+	//the storm lasts for the first third of the simulation
+	storm = deck->hours / 3.0f;
+
+	//open the input file
+	fp = OpenSyntheticFile(SYNTHETICINPUTFILE);
+
+	/*******************************************/
+	/*  Data Group A: simulation controls      */
+	/*******************************************/
+
+	fprintf(fp, "TREX synthetic watershed (trexbench)\n");
+	fprintf(fp, "%d rows x %d columns, ksim = %d, tributaries = %d, gages = %d\n",
+		deck->nrows, deck->ncols, deck->ksim, deck->ntribs, deck->ngages);
+	fprintf(fp, "KSIM %d NROWS %d NCOLS %d DX %g DY %g TZERO 0 TSTART 0\n",
+		deck->ksim, deck->nrows, deck->ncols, deck->dx, deck->dx);
+	fprintf(fp, "DTOPT 0\nNDT 1\n%g %g\n", deck->dt, deck->hours);
+	fprintf(fp, "NPRINTOUT 1\n%g %g\n", deck->hours / 20.0f, deck->hours);
+	fprintf(fp, "NPRINTGRID 1 GRIDCOUNT 0\n%g %g\n", deck->hours / 2.0f, deck->hours);
+	fprintf(fp, "ECHOFILE echo.out\n");
+
+	/*******************************************/
+	/*  Data Group B: hydrology and hydraulics */
+	/*******************************************/
+
+	fprintf(fp, "Data Group B\n");
+	fprintf(fp, "MASKFILE mask.asc\nELEVATIONFILE elev.asc\nINFOPT 1\n");
+
+	//if only water is simulated (soils and land uses are in Data Group B)
+	if(deck->ksim == 1)
+	{
+		fprintf(fp, "NSOILS 2\n1.0e-6 0.11 0.3 Loam\n5.0e-7 0.2 0.25 Clay\n");
+		fprintf(fp, "SOILTYPEFILE soil.asc\n");
+		fprintf(fp, "NLANDS 2\n0.05 1.0 Grass\n0.08 2.0 Forest\n");
+		fprintf(fp, "LANDUSEFILE land.asc\n");
+
+	}	//end if ksim == 1
+
+	fprintf(fp, "STORAGEDEPTHFILE sdep.asc\n");
+	fprintf(fp, "CHNOPT 1\nTPLGYOPT 0 CTLOPT 0 FLDOPT 0 OUTOPT 0\n");
+	fprintf(fp, "LINKFILE link.asc\nNODEFILE node.asc\nCHANNELFILE chan.dat\n");
+	fprintf(fp, "WATEROVERLANDFILE hov0.asc\nINFILTRATIONFILE inf0.asc\nWATERCHANNELFILE hch0.dat\n");
+
+	//if there is one rain gage
+	if(deck->ngages == 1)
+	{
+		//rainfall is uniform in space
+		fprintf(fp, "RAINOPT 0\n");
+	}
+	else	//else rainfall is interpolated between gages
+	{
+		//the radius of influence covers the domain
+		fprintf(fp, "RAINOPT 1\nIDWRADIUS %g IDWEXPONENT 2.0\n",
+			sqrt(width * width + height * height));
+
+	}	//end if ngages == 1
+
+	fprintf(fp, "NRG %d\n", deck->ngages);
+	fprintf(fp, "CONVUNITS 0.001 CONVTIME 2.77777778e-4 SCALE 1.0\n");
+
+	//loop over rain gages
+	for(igage=1; igage<=deck->ngages; igage++)
+	{
+		//intensities increase from 40 to 80 mm/hr across the gages
+		intensity = 40.0f + 40.0f * (float)(igage - 1) / (float)((deck->ngages > 1) ? deck->ngages - 1 : 1);
+
+		//gages are spread across the domain (alternating north and south)
+		fprintf(fp, "RG %d %g %g 4\n", igage,
+			(igage - 0.5f) * width / deck->ngages,
+			((igage % 2 == 1) ? 0.75f : 0.25f) * height);
+
+		//storm hyetograph (intensity, time)
+		fprintf(fp, "%g 0.0\n%g %g\n0.0 %g\n0.0 %g\n", intensity, intensity, storm,
+			storm + 0.01f, deck->hours);
+
+	}	//end loop over rain gages
+
+	fprintf(fp, "SNOWOPT 0 MELTOPT 0\nNQWOV 0\nNQWCH 0\n");
+	fprintf(fp, "NOUTLETS 1\nOUTLET %d %d 0.01 0\n", deck->nrows, deck->ncols);
+	fprintf(fp, "NQREPORTS 1\n%d %d 0.36 1 OUTLET\n", deck->nrows, deck->ncols);
+
+	//if solids are simulated
+	if(deck->ksim > 1)
+	{
+		/*******************************************/
+		/*  Data Group C: solids transport         */
+		/*******************************************/
+
+		fprintf(fp, "Data Group C\nNSOLIDS 2 NSGROUPS 1\n");
+		fprintf(fp, "ADVOVOPT 1 S 1.0 DSPOVOPT 0 S 1.0 DEPOVOPT 1 S 1.0 ERSOVOPT 1 S 1.0 TNSOVOPT 0 S 1.0 ELEVOVOPT 0\n");
+		fprintf(fp, "ADVCHOPT 1 S 1.0 DSPCHOPT 0 S 1.0 DEPCHOPT 1 S 1.0 ERSCHOPT 1 S 1.0 TNSCHOPT 0 S 1.0 ELEVCHOPT 0\n");
+		fprintf(fp, "Groups\nGROUP Total\n");
+		fprintf(fp, "Particles\n0.0001 2.65 0.001 0.3 1 Sand\n0.00001 2.65 0.00001 0.1 1 Silt\n");
+		fprintf(fp, "Soils\nNSOILS 2\n0.3 0.1 0.4 1.0e-6 0.11 0.3 Loam\nGSD 0.5 0.5\n");
+		fprintf(fp, "0.2 0.2 0.4 5.0e-7 0.2 0.25 Clay\nGSD 0.3 0.7\n");
+		fprintf(fp, "Land use\nNLANDS 2\n0.05 1.0 0.1 1.0 Grass\n0.08 2.0 0.05 1.0 Forest\n");
+		fprintf(fp, "LANDUSEFILE land.asc\n");
+		fprintf(fp, "Soil stack\nMAXSTACKOV 3 MINVOLOV 0.5 MAXVOLOV 1.5 STKOVOPT 0\n");
+		fprintf(fp, "SOILSTACKFILE stack.asc\n");
+
+		//loop over soil layers (top to bottom)
+		for(layer=3; layer>=1; layer--)
+		{
+			fprintf(fp, "THICK%d thick%d.asc\nSOIL%d soil%d.asc\n", layer, layer, layer, layer);
+		}
+
+		fprintf(fp, "Initial solids overland\nSSOV1 ssov.asc\nSSOV2 ssov.asc\n");
+		fprintf(fp, "Sediment stack\nMAXSTACKCH 3 MINVOLCH 0.5 MAXVOLCH 1.5 STKCHOPT 0\n");
+		fprintf(fp, "SEDPROPFILE sedprop.dat\nSSCHFILE ssch0.dat\n");
+
+		//loads: point overland, distributed overland, channel (none)
+		for(isolid=1; isolid<=2; isolid++)
+		{
+			fprintf(fp, "NSWPOV%d 0\n", isolid);
+		}
+		for(isolid=1; isolid<=2; isolid++)
+		{
+			fprintf(fp, "NSWDOV%d 0\n", isolid);
+		}
+		for(isolid=1; isolid<=2; isolid++)
+		{
+			fprintf(fp, "NSWCH%d 0\n", isolid);
+		}
+
+		fprintf(fp, "Outlet 1\nNSEDREPORTS 1\n%d %d 0.36 1 OUTLET\n", deck->nrows, deck->ncols);
+
+	}	//end if ksim > 1
+
+	//if chemicals are simulated
+	if(deck->ksim > 2)
+	{
+		/*******************************************/
+		/*  Data Group D: chemical transport       */
+		/*******************************************/
+
+		fprintf(fp, "Data Group D\nNCHEMS %d NCGROUPS 1\nGroups\nGROUP Metals\nChemicals\n", deck->nchems);
+
+		//loop over chemicals
+		for(ichem=1; ichem<=deck->nchems; ichem++)
+		{
+			//partitioning and biodegradation (rates vary by chemical)
+			fprintf(fp, "CHEM %d NFIELDS 2 CGROUP 1 Chemical%d\n", ichem, ichem);
+			fprintf(fp, "2 Partitioning\nPARTOPT 100 1\nLOGKP 110 %.2f\n", 1.5 + 0.5 * (ichem - 1));
+			fprintf(fp, "2 Biodegradation\nBIOOPT 200 1\nKBIOWOV 210 %.2f\n", 0.5 / ichem);
+
+		}	//end loop over chemicals
+
+		fprintf(fp, "NCYIELDS 0\nSoil chemical initial conditions\n");
+
+		//loop over soil layers (top to bottom)
+		for(layer=3; layer>=1; layer--)
+		{
+			for(ichem=1; ichem<=deck->nchems; ichem++)
+			{
+				fprintf(fp, "CHEM%d soilchem.asc\n", layer);
+			}
+		}
+
+		fprintf(fp, "Overland water chemical initial conditions\n");
+		for(ichem=1; ichem<=deck->nchems; ichem++)
+		{
+			fprintf(fp, "CHEMOV%d soilchem.asc\n", ichem);
+		}
+		fprintf(fp, "Sediment chemicals\nSEDCHEM sedchem.dat\nCHEMCH chemch0.dat\n");
+
+		//loads: point overland, distributed overland, channel (none)
+		for(ichem=1; ichem<=deck->nchems; ichem++)
+		{
+			fprintf(fp, "NCWPOV%d 0\n", ichem);
+		}
+		for(ichem=1; ichem<=deck->nchems; ichem++)
+		{
+			fprintf(fp, "NCWDOV%d 0\n", ichem);
+		}
+		for(ichem=1; ichem<=deck->nchems; ichem++)
+		{
+			fprintf(fp, "NCWCH%d 0\n", ichem);
+		}
+
+		fprintf(fp, "Outlet 1\nNCHEMREPORTS 1\n%d %d 0.36 1 OUTLET\n", deck->nrows, deck->ncols);
+
+	}	//end if ksim > 2
+
+	/*******************************************/
+	/*  Data Group E: environmental conditions */
+	/*******************************************/
+
+	fprintf(fp, "Data Group E\nNPROPG 0\n");
+
+	//if chemicals are simulated
+	if(deck->ksim > 2)
+	{
+		fprintf(fp, "NPROPOV 0\nNPROPCH 0\nFPOCOVOPT 0\nFPOCCHOPT 0\n");
+	}
+
+	/*******************************************/
+	/*  Data Group F: output specification     */
+	/*******************************************/
+
+	fprintf(fp, "Data Group F\nExport files\nWATEREXPFILE water.exp\n");
+
+	//if solids are simulated
+	if(deck->ksim > 1)
+	{
+		fprintf(fp, "SEDEXPROOT sed\nSEDEXT .exp\n");
+	}
+
+	//if chemicals are simulated
+	if(deck->ksim > 2)
+	{
+		fprintf(fp, "CHEMEXPROOT chem\nCHEMEXT .exp\n");
+	}
+
+	fprintf(fp, "Grids\nRAINRATEGRID rainrate\nRAINDEPTHGRID raindepth\nINFRATEGRID infrate\n");
+	fprintf(fp, "INFDEPTHGRID infdepth\nQGRID q\nWATERDEPTHGRID hov\n");
+
+	//if solids are simulated
+	if(deck->ksim > 1)
+	{
+		fprintf(fp, "SSWATER ssw\nSSSURF sss\n");
+	}
+
+	//if chemicals are simulated
+	if(deck->ksim > 2)
+	{
+		fprintf(fp, "CTW ctw\nCDW cdw\nCBW cbw\nCPW cpw\nCSW csw\n");
+		fprintf(fp, "CTS cts\nCDS cds\nCBS cbs\nCPS cps\nCSS css\n");
+		fprintf(fp, "CTSUB ctsub\nCDSUB cdsub\nCBSUB cbsub\nCPSUB cpsub\nCSSUB cssub\n");
+		fprintf(fp, "HORIZON 0.05 SSROPT 1\n");
+		fprintf(fp, "FDW fdw\nFBW fbw\nFMW fmw\nFPW fpw\nFDS fds\nFBS fbs\nFMS fms\nFPS fps\n");
+		fprintf(fp, "INFCHEM infchem\n");
+	}
+
+	//if solids are simulated
+	if(deck->ksim > 1)
+	{
+		fprintf(fp, "Cumulative\nNETELEV netelev\nSOLIDSEROSION sero\nSOLIDSDEPOSITION sdep\nSOLIDSNETACCUM snet\n");
+	}
+
+	//if chemicals are simulated
+	if(deck->ksim > 2)
+	{
+		fprintf(fp, "CHEMEROSION cero\nCHEMDEPOSITION cdep\nCHEMNETACCUM cnet\n");
+	}
+
+	fprintf(fp, "Summary\nDMPFILE dump.out\nMSBFILE mass.out\nSTATSFILE stats.out\n");
+
+	//close the input file
+	fclose(fp);
+
+//End of function: Return to WriteSyntheticDeck
+}
+
+//C
+//C
+			/*******************************************/
+			/*       FUNCTION: WriteSyntheticDeck      */
+			/*******************************************/
+
+/* Writes all input files of the synthetic watershed (returns 0 or -1) */
+
+int WriteSyntheticDeck(SyntheticDeck *deck)
+{
+	//local variable declarations
+	int
+		row,		//row index
+		col;		//column index
+
+	//if the controls are not valid
+	if(deck->nrows < 8 || deck->ncols < 8 || deck->ksim < 1 || deck->ksim > 3
+		|| deck->ngages < 1 || deck->nchems < 1 || deck->dx <= 0.0f
+		|| deck->dt <= 0.0f || deck->hours <= 0.0f)
+	{
+		//write error message to screen
+		printf("Synthetic deck error: rows and columns must be >= 8, ksim = 1, 2, or 3,\n");
+		printf("  gages and chemicals >= 1, and cell size, dt, and duration > 0\n");
+		return -1;
+
+	}	//end if controls are not valid
+
+	//if the tributaries are not at least three rows apart
+	if(deck->ntribs < 0 || deck->nrows / (deck->ntribs + 1) < 3)
+	{
+		//write error message to screen
+		printf("Synthetic deck error: %d tributaries do not fit in %d rows (at most %d)\n",
+			deck->ntribs, deck->nrows, deck->nrows / 3 - 1);
+		return -1;
+
+	}	//end if ntribs is not valid
+
+	//count the cells in the domain
+	deck->ncells = 0;
+
+	//loop over rows
+	for(row=1; row<=deck->nrows; row++)
+	{
+		//loop over columns
+		for(col=1; col<=deck->ncols; col++)
+		{
+			//count the cell if it is in the domain
+			deck->ncells = deck->ncells + InSyntheticDomain(deck, row, col);
+
+		}	//end loop over columns
+
+	}	//end loop over rows
+
+	//set the ground elevation at the origin so that all elevations are > 10 m
+	elevbase = 10.0f + 0.01f * deck->dx * deck->nrows + 0.0067f * deck->dx * deck->ncols;
+
+	//Assign the channel network
+	BuildSyntheticNetwork(deck);
+
+	//Write the grids common to all simulation types
+	WriteSyntheticGrid(deck, "mask.asc", GRIDMASK);
+	WriteSyntheticGrid(deck, "elev.asc", GRIDELEVATION);
+	WriteSyntheticGrid(deck, "land.asc", GRIDLAND);
+	WriteSyntheticGrid(deck, "sdep.asc", GRIDSTORAGE);
+	WriteSyntheticGrid(deck, "hov0.asc", GRIDZERO);
+	WriteSyntheticGrid(deck, "inf0.asc", GRIDZERO);
+	WriteSyntheticGrid(deck, "link.asc", GRIDLINK);
+	WriteSyntheticGrid(deck, "node.asc", GRIDNODE);
+
+	//if only water is simulated
+	if(deck->ksim == 1)
+	{
+		//Write the soil type grid
+		WriteSyntheticGrid(deck, "soil.asc", GRIDSOIL);
+	}
+	else	//else solids are simulated (three layer soil stack)
+	{
+		//Write the soil stack grids
+		WriteSyntheticGrid(deck, "stack.asc", GRIDSTACK);
+		WriteSyntheticGrid(deck, "thick1.asc", GRIDTHICK);
+		WriteSyntheticGrid(deck, "thick2.asc", GRIDTHICK);
+		WriteSyntheticGrid(deck, "thick3.asc", GRIDTHICK);
+		WriteSyntheticGrid(deck, "soil1.asc", GRIDSOIL);
+		WriteSyntheticGrid(deck, "soil2.asc", GRIDSOIL);
+		WriteSyntheticGrid(deck, "soil3.asc", GRIDSOIL);
+		WriteSyntheticGrid(deck, "ssov.asc", GRIDZERO);
+
+		//if chemicals are simulated
+		if(deck->ksim > 2)
+		{
+			//Write the soil (and overland water) chemical grid
+			WriteSyntheticGrid(deck, "soilchem.asc", GRIDCHEM);
+		}
+
+	}	//end if ksim == 1
+
+	//Write the channel files
+	WriteSyntheticChannels(deck);
+
+	//Write the input file
+	WriteSyntheticInput(deck);
+
+	//loop over rows
+	for(row=1; row<=deck->nrows; row++)
+	{
+		//Free memory for the link and node grids
+		free(linkgrid[row]);
+		free(nodegrid[row]);
+	}
+
+	//Free memory for the network arrays
+	free(linkgrid);
+	free(nodegrid);
+	free(linknodes);
+	free(tribrow);
+
+	//return success
+	return 0;
+
+//End of function: Return to trexbench (main)
+}
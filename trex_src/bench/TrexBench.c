@@ -0,0 +1,484 @@
+/*----------------------------------------------------------------------
+C-  Function:   TrexBench.c (trexbench main module)
+C-
+C-  Purpose/    trexbench is the benchmark driver of the trex library.
+C-  Methods:    It writes a synthetic watershed deck (see
+C-              SyntheticWatershed.c) to a run directory, runs it
+C-              through the library calls (TrexInit, TrexStep,
+C-              TrexFinalize), and reports:
+C-
+C-                wall clock time of initialization, time stepping,
+C-                and end of run output (seconds)
+C-                throughput of time stepping (cells*steps/second)
+C-                time spent in each time step phase (TrexGetPhaseTimes)
+C-                peak resident set size of the process (KB)
+C-                heap allocated by each subsystem (TrexGetMemory)
+C-
+C-              With -csv the results are also appended to a comma
+C-              separated file (one row per run) so that results can
+C-              be compared across builds and releases.  With
+C-              -generate the deck is written but not run.  With
+C-              -threads the solids and chemical transport tasks run
+C-              on several threads (TrexSetThreads).
+C-
+C-  Inputs:     argv
+C-
+C-  Outputs:    benchmark report (screen and csv file)
+C-
+C-  Controls:   generate
+C-
+C-  Calls:      WriteSyntheticDeck, TrexSetThreads, TrexInit,
+C-              TrexStep, TrexGetPhaseTimes, TrexGetMemory,
+C-              TrexFinalize
+C-
+C-  Called by:  None (trex_bench target)
+C-
+C-  Created:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Added the -threads option (solids and chemical
+C-              transport tasks).
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Added the heap allocated by each subsystem
+C-              (TrexGetMemory) to the report.
+C-
+C-  Revised:
+C-
+C-  Date:
+C-
+C-  Revisions:
+C-
+C---------------------------------------------------------------------*/
+//trex library interface
+#include "trex_library.h"
+
+//synthetic watershed generator interface
+#include "synthetic_watershed.h"
+
+#include <stdio.h>		//C library for standard input/output
+#include <stdlib.h>		//C library for general utilities
+#include <string.h>		//C library for string functions
+#include <time.h>		//C library for date and time functions
+
+#ifdef WINDOWS
+#include <windows.h>	//Windows API
+#include <psapi.h>		//Windows process status API (peak working set)
+#include <direct.h>		//Windows directory functions
+#else
+#include <sys/resource.h>	//POSIX resource usage (peak resident set size)
+#include <sys/stat.h>		//POSIX file status (mkdir)
+#include <unistd.h>			//POSIX system calls (chdir)
+#endif
+
+//C
+//C
+			/*******************************************/
+			/*         FUNCTION: BenchClock            */
+			/*******************************************/
+
+/* Returns the wall clock time (seconds) */
+
+static double BenchClock(void)
+{
+	//local variable declarations/definitions
+	struct timespec now;	//current calendar time (seconds and nanoseconds)
+
+	//get the current time (C11, resolution of the system clock)
+	timespec_get(&now, TIME_UTC);
+
+	//return the time in seconds
+	return (double)now.tv_sec + 1.0e-9 * (double)now.tv_nsec;
+
+//end of function BenchClock
+}
+
+//C
+//C
+			/*******************************************/
+			/*         FUNCTION: BenchPeakMemory       */
+			/*******************************************/
+
+/* Returns the peak resident set size of the process (KB, 0 if unknown) */
+
+static long BenchPeakMemory(void)
+{
+#ifdef WINDOWS
+	//local variable declarations/definitions
+	PROCESS_MEMORY_COUNTERS counters;	//process memory counters
+
+	//if the process memory counters are available
+	if(GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+	{
+		//return the peak working set (bytes to KB)
+		return (long)(counters.PeakWorkingSetSize / 1024);
+	}
+
+	//peak memory is unknown
+	return 0;
+#else
+	//local variable declarations/definitions
+	struct rusage usage;	//process resource usage
+
+	//if the resource usage is not available
+	if(getrusage(RUSAGE_SELF, &usage) != 0)
+	{
+		//peak memory is unknown
+		return 0;
+	}
+
+#ifdef MACOSX
+	//return the maximum resident set size (bytes to KB)
+	return (long)(usage.ru_maxrss / 1024);
+#else
+	//return the maximum resident set size (KB)
+	return (long)usage.ru_maxrss;
+#endif
+#endif
+
+//end of function BenchPeakMemory
+}
+
+//C
+//C
+			/*******************************************/
+			/*         FUNCTION: BenchDirectory        */
+			/*******************************************/
+
+/* Creates (if needed) and changes to the run directory */
+
+static void BenchDirectory(char *name)
+{
+	//create the directory (an existing directory is reused)
+#ifdef WINDOWS
+	_mkdir(name);
+#else
+	mkdir(name, 0755);
+#endif
+
+	//if the directory cannot be entered
+#ifdef WINDOWS
+	if(_chdir(name) != 0)
+#else
+	if(chdir(name) != 0)
+#endif
+	{
+		//write error message to screen
+		printf("Error! Can't use benchmark run directory: %s\n", name);
+		exit(EXIT_FAILURE);	//abort
+
+	}	//end if chdir failed
+
+//end of function BenchDirectory
+}
+
+int main(int argc, char *argv[])
+{
+	//Local variable declarations/definitions
+	SyntheticDeck
+		deck;				//synthetic watershed controls and counts
+
+	FILE
+		*csv_fp;			//csv results file pointer
+
+	char
+		*label,				//configuration label (reported)
+		*dirname,			//run directory name (NULL = current directory)
+		*csvname;			//csv results file name (NULL = none)
+
+	int
+		iarg,				//loop index for initial arguments (argv)
+		generate,			//generate only option (1 = write the deck but do not run it)
+		nthreads,			//number of threads of the solids and chemical transport tasks
+		status,				//simulation status (TREXCONTINUE, TREXFINISHED)
+		iphase,				//loop index for time step phases
+		imem;				//loop index for memory footprint subsystems
+
+	long
+		steps,				//number of time steps taken
+		peakkb;				//peak resident set size (KB)
+
+	double
+		clock0,				//wall clock time at start of a stage (seconds)
+		inittime,			//initialization time (seconds)
+		steptime,			//time stepping time (seconds)
+		finaltime,			//end of run output time (seconds)
+		rate,				//throughput (cells*steps/second)
+		phase[TREXNPHASES],	//time spent in each time step phase (seconds)
+		memory[TREXNMEMORY];	//heap allocated by each subsystem (bytes)
+
+	static char *phasename[TREXNPHASES] =
+		{"forcing", "water", "solids", "chemical", "output", "newstate"};
+
+	static char *memoryname[TREXNMEMORY] =
+		{"general", "water", "solids", "chemical", "environ"};
+
+	//set the default controls (water only, 64 x 64 cells, two tributaries)
+	deck.nrows = 64;
+	deck.ncols = 64;
+	deck.ksim = 1;
+	deck.ntribs = 2;
+	deck.ngages = 1;
+	deck.nchems = 1;
+	deck.dx = 30.0f;
+	deck.dt = 1.0f;
+	deck.hours = 1.0f;
+	label = "bench";
+	dirname = NULL;
+	csvname = NULL;
+	generate = 0;
+	nthreads = 1;
+
+	//loop over initial arguments
+	for(iarg=1; iarg<argc; iarg++)
+	{
+		//if the deck is only generated (option without a value)
+		if(strcmp(argv[iarg], "-generate") == 0)
+		{
+			generate = 1;
+		}
+		else if(iarg+1 >= argc)	//else if the option has no value
+		{
+			break;
+		}
+		else if(strcmp(argv[iarg], "-n") == 0)	//else set the option value
+		{
+			deck.nrows = deck.ncols = atoi(argv[++iarg]);
+		}
+		else if(strcmp(argv[iarg], "-rows") == 0)
+		{
+			deck.nrows = atoi(argv[++iarg]);
+		}
+		else if(strcmp(argv[iarg], "-cols") == 0)
+		{
+			deck.ncols = atoi(argv[++iarg]);
+		}
+		else if(strcmp(argv[iarg], "-ksim") == 0)
+		{
+			deck.ksim = atoi(argv[++iarg]);
+		}
+		else if(strcmp(argv[iarg], "-tribs") == 0)
+		{
+			deck.ntribs = atoi(argv[++iarg]);
+		}
+		else if(strcmp(argv[iarg], "-gages") == 0)
+		{
+			deck.ngages = atoi(argv[++iarg]);
+		}
+		else if(strcmp(argv[iarg], "-chems") == 0)
+		{
+			deck.nchems = atoi(argv[++iarg]);
+		}
+		else if(strcmp(argv[iarg], "-dx") == 0)
+		{
+			deck.dx = (float)atof(argv[++iarg]);
+		}
+		else if(strcmp(argv[iarg], "-dt") == 0)
+		{
+			deck.dt = (float)atof(argv[++iarg]);
+		}
+		else if(strcmp(argv[iarg], "-hours") == 0)
+		{
+			deck.hours = (float)atof(argv[++iarg]);
+		}
+		else if(strcmp(argv[iarg], "-label") == 0)
+		{
+			label = argv[++iarg];
+		}
+		else if(strcmp(argv[iarg], "-dir") == 0)
+		{
+			dirname = argv[++iarg];
+		}
+		else if(strcmp(argv[iarg], "-csv") == 0)
+		{
+			csvname = argv[++iarg];
+		}
+		else if(strcmp(argv[iarg], "-threads") == 0)
+		{
+			nthreads = atoi(argv[++iarg]);
+		}
+		else	//else the option is not known
+		{
+			break;
+
+		}	//end if option is known
+
+	}	//end loop over initial arguments
+
+	//if an argument was not valid
+	if(iarg < argc)
+	{
+		//Write usage message to screen
+		printf("Usage: %s [-n cells | -rows n -cols n] [-ksim 1|2|3] [-tribs n] [-gages n]\n", argv[0]);
+		printf("       [-chems n] [-dx m] [-dt s] [-hours h] [-label name] [-dir path]\n");
+		printf("       [-csv file] [-threads n] [-generate]\n");
+		exit(EXIT_FAILURE);	//abort
+
+	}	//end if iarg < argc
+
+	//if a run directory is specified
+	if(dirname != NULL)
+	{
+		//Create and change to the run directory
+		BenchDirectory(dirname);
+	}
+
+	//Write the synthetic watershed deck
+	if(WriteSyntheticDeck(&deck) != 0)
+	{
+		exit(EXIT_FAILURE);	//abort
+	}
+
+	//write the deck description to screen
+	printf("\ntrexbench %s: %d x %d cells (%d in domain), ksim = %d, %d links, %d nodes, %d gages\n",
+		label, deck.nrows, deck.ncols, deck.ncells, deck.ksim, deck.nlinks, deck.nchnodes, deck.ngages);
+
+	//if the deck is only generated
+	if(generate == 1)
+	{
+		printf("  deck written: %s\n", SYNTHETICINPUTFILE);
+		return 0;
+	}
+
+	//set the number of threads of the transport tasks
+	if(TrexSetThreads(nthreads) != 0)
+	{
+		//Write error message to screen
+		printf("Error! Invalid -threads number (or built without OpenMP): %d\n", nthreads);
+		exit(EXIT_FAILURE);	//abort
+	}
+
+	//Initialize the simulation (no restart, no model image)
+	clock0 = BenchClock();
+	status = TrexInit(SYNTHETICINPUTFILE, -1, 0, NULL);
+	inittime = BenchClock() - clock0;
+
+	//get the heap allocated by each subsystem
+	TrexGetMemory(memory);
+
+	//Take time steps until the simulation is finished
+	steps = 0;
+	clock0 = BenchClock();
+
+	//while the simulation has time steps remaining
+	while(status == TREXCONTINUE)
+	{
+		//Advance one time step
+		status = TrexStep();
+		steps = steps + 1;
+	}
+
+	steptime = BenchClock() - clock0;
+
+	//get the time spent in each time step phase
+	TrexGetPhaseTimes(phase);
+
+	//Write end of run results
+	clock0 = BenchClock();
+	TrexFinalize();
+	finaltime = BenchClock() - clock0;
+
+	//get the peak memory use
+	peakkb = BenchPeakMemory();
+
+	//compute the throughput (cells*steps/second)
+	rate = (steptime > 0.0) ? (double)deck.ncells * (double)steps / steptime : 0.0;
+
+	//Write the report to screen
+	printf("\ntrexbench %s results\n", label);
+	printf("  cells = %d  steps = %ld\n", deck.ncells, steps);
+	printf("  init     = %10.3f s\n", inittime);
+	printf("  steps    = %10.3f s  (%.4g cells*steps/s)\n", steptime, rate);
+	printf("  finalize = %10.3f s\n", finaltime);
+
+	//loop over time step phases
+	for(iphase=0; iphase<TREXNPHASES; iphase++)
+	{
+		//write the phase time and fraction of the time stepping time
+		printf("    %-9s %10.3f s  (%5.1f%%)\n", phasename[iphase], phase[iphase],
+			(steptime > 0.0) ? 100.0 * phase[iphase] / steptime : 0.0);
+	}
+
+	printf("  peak rss = %ld KB\n", peakkb);
+	printf("  heap (inputs and initialization):\n");
+
+	//loop over memory footprint subsystems
+	for(imem=0; imem<TREXNMEMORY; imem++)
+	{
+		//write the heap allocated by the subsystem (MB)
+		printf("    %-9s %10.3f MB\n", memoryname[imem], memory[imem] / 1048576.0);
+	}
+
+	//if a csv results file is specified
+	if(csvname != NULL)
+	{
+		//if the file does not exist (is new), write the header
+		csv_fp = fopen(csvname, "r");
+
+		//if the file exists
+		if(csv_fp != NULL)
+		{
+			fclose(csv_fp);
+			csv_fp = fopen(csvname, "a");
+		}
+		else	//else the file is new
+		{
+			csv_fp = fopen(csvname, "w");
+
+			//if the file was created
+			if(csv_fp != NULL)
+			{
+				//write the header
+				fprintf(csv_fp, "label,rows,cols,ksim,cells,links,steps,init_s,steps_s,finalize_s,cells_steps_per_s");
+
+				//loop over time step phases
+				for(iphase=0; iphase<TREXNPHASES; iphase++)
+				{
+					fprintf(csv_fp, ",%s_s", phasename[iphase]);
+				}
+
+				fprintf(csv_fp, ",peak_rss_kb\n");
+
+			}	//end if csv_fp != NULL
+
+		}	//end if csv_fp != NULL
+
+		//if the file cannot be written
+		if(csv_fp == NULL)
+		{
+			//write error message to screen
+			printf("Error! Can't write benchmark results file: %s\n", csvname);
+			exit(EXIT_FAILURE);	//abort
+
+		}	//end if csv_fp == NULL
+
+		//write the results
+		fprintf(csv_fp, "%s,%d,%d,%d,%d,%d,%ld,%.6f,%.6f,%.6f,%.6g", label, deck.nrows, deck.ncols,
+			deck.ksim, deck.ncells, deck.nlinks, steps, inittime, steptime, finaltime, rate);
+
+		//loop over time step phases
+		for(iphase=0; iphase<TREXNPHASES; iphase++)
+		{
+			fprintf(csv_fp, ",%.6f", phase[iphase]);
+		}
+
+		fprintf(csv_fp, ",%ld\n", peakkb);
+
+		//close the csv file
+		fclose(csv_fp);
+
+	}	//end if csvname != NULL
+
+	//return success
+	return 0;
+
+//End of main function
+}
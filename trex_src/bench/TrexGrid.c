@@ -0,0 +1,445 @@
+/*----------------------------------------------------------------------
+C-  Function:   TrexGrid.c (trexgrid main module)
+C-
+C-  Purpose/    trexgrid reconstructs the full raster of a sparse
+C-  Methods:    grid frame.  A simulation started with -gridsparse
+C-              (or TrexSetGridSparse) writes its grid outputs as
+C-              sparse frames that list, by runs along a row, only
+C-              the cells of the output selection (see GridOutput).
+C-              trexgrid writes the ESRI ASCII grid of a frame in
+C-              the format of full grid output (Grid):
+C-
+C-                cells listed by the frame    the value text of the
+C-                                             frame
+C-                cells of the selection that  zero (frames of non-
+C-                are not listed               zero cells, read from
+C-                                             the selection file
+C-                                             named by the frame)
+C-                other cells                  NODATA_value
+C-
+C-              Without windows, the raster of a frame of non-zero
+C-              cells is identical to the full grid output.  The
+C-              raster is written to the output file (or the screen
+C-              when no output file is given).
+C-
+C-              The exit status is 0 when the raster was written and
+C-              1 when a frame could not be read.
+C-
+C-  Inputs:     argv, sparse grid frame, selection file
+C-
+C-  Outputs:    ESRI ASCII grid
+C-
+C-  Controls:   None
+C-
+C-  Calls:      ReadFrame, FillFrame
+C-
+C-  Called by:  None
+C-
+C-  Created:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revised:
+C-
+C-  Date:
+C-
+C-  Revisions:
+C-
+C---------------------------------------------------------------------*/
+#include <stdio.h>		//C library for standard input/output
+#include <stdlib.h>		//C library for general utilities
+#include <string.h>		//C library for string functions
+
+#define FRAMEMAGIC "TREXSPARSE"		//sparse frame file signature
+#define FRAMEVERSION 1				//sparse frame format version
+#define FRAMENAMESIZE 4096			//maximum length of a file name
+
+static const char zerovalue[] = "0.000000e+00";	//value text of a zero cell (as written by Grid)
+
+//sparse grid frame
+typedef struct
+{
+	char *text;			//frame file contents (tokens are terminated in place)
+	char *body;			//first run of the frame
+	char *ncols;		//header values (text)
+	char *nrows;
+	char *xllcorner;
+	char *yllcorner;
+	char *cellsize;
+	char *nodata;
+	char *filter;		//filter of the listed cells (nonzero or none)
+	char *selection;	//selection file name (NULL = none)
+} sparseframe;
+
+//C
+//C
+			/*******************************************/
+			/*           FUNCTION: NextToken           */
+			/*******************************************/
+
+/* Returns the next white space separated token of the text and ends it
+   in place (NULL at the end of the text) */
+
+static char *NextToken(char **position)
+{
+	//local variable declarations
+	char *token;	//start of the token
+
+	//skip white space
+	token = *position + strspn(*position, " \t\r\n");
+
+	//if the text ends
+	if(*token == '\0')
+	{
+		*position = token;
+		return NULL;
+	}
+
+	//find the end of the token
+	*position = token + strcspn(token, " \t\r\n");
+
+	//if the token is followed by white space
+	if(**position != '\0')
+	{
+		//end the token and move past it
+		**position = '\0';
+		*position = *position + 1;
+	}
+
+	//return the token
+	return token;
+
+//End of function: Return to caller
+}
+
+//C
+//C
+			/*******************************************/
+			/*           FUNCTION: ReadFrame           */
+			/*******************************************/
+
+/* Reads a sparse grid frame (returns 0, or -1 if the frame can't be read) */
+
+static int ReadFrame(char *name, sparseframe *frame)
+{
+	//local variable declarations
+	long size;			//size of the frame file (bytes)
+	char *position,		//position in the frame text
+		*key,			//header keyword
+		*value;			//header value
+	FILE *frame_fp;		//frame file pointer
+
+	//no frame is read
+	memset(frame, 0, sizeof(sparseframe));
+
+	//open the frame file
+	frame_fp = fopen(name, "rb");
+
+	//if the frame file can't be opened
+	if(frame_fp == NULL)
+	{
+		fprintf(stderr, "trexgrid: can't open frame %s\n", name);
+		return -1;
+	}
+
+	//get the size of the frame file
+	fseek(frame_fp, 0, SEEK_END);
+	size = ftell(frame_fp);
+	fseek(frame_fp, 0, SEEK_SET);
+
+	//read the frame file (null terminated)
+	frame->text = (char *)malloc(size + 1);
+	size = (long)fread(frame->text, 1, size, frame_fp);
+	frame->text[size] = '\0';
+
+	//close the frame file
+	fclose(frame_fp);
+
+	//read the signature and the format version
+	position = frame->text;
+	key = NextToken(&position);
+	value = NextToken(&position);
+
+	//if the file is not a sparse frame of this version
+	if(key == NULL || value == NULL || strcmp(key, FRAMEMAGIC) != 0 || atoi(value) != FRAMEVERSION)
+	{
+		fprintf(stderr, "trexgrid: %s is not a sparse grid frame (version %d)\n", name, FRAMEVERSION);
+		return -1;
+	}
+
+	//loop over header lines (keywords are not numbers)
+	while(*(position + strspn(position, " \t\r\n")) != '\0'
+		&& strchr("0123456789", *(position + strspn(position, " \t\r\n"))) == NULL)
+	{
+		//read the keyword and the value
+		key = NextToken(&position);
+		value = NextToken(&position);
+
+		//if the value is missing
+		if(value == NULL)
+		{
+			break;
+		}
+
+		//store the header value
+		if(strcmp(key, "ncols") == 0) frame->ncols = value;
+		else if(strcmp(key, "nrows") == 0) frame->nrows = value;
+		else if(strcmp(key, "xllcorner") == 0) frame->xllcorner = value;
+		else if(strcmp(key, "yllcorner") == 0) frame->yllcorner = value;
+		else if(strcmp(key, "cellsize") == 0) frame->cellsize = value;
+		else if(strcmp(key, "NODATA_value") == 0) frame->nodata = value;
+		else if(strcmp(key, "filter") == 0) frame->filter = value;
+		else if(strcmp(key, "selection") == 0) frame->selection = value;
+
+	}	//end loop over header lines
+
+	//the runs follow the header
+	frame->body = position;
+
+	//if a header value is missing
+	if(frame->ncols == NULL || frame->nrows == NULL || frame->xllcorner == NULL
+		|| frame->yllcorner == NULL || frame->cellsize == NULL || frame->nodata == NULL
+		|| frame->filter == NULL || atoi(frame->ncols) < 1 || atoi(frame->nrows) < 1)
+	{
+		fprintf(stderr, "trexgrid: incomplete header in frame %s\n", name);
+		return -1;
+	}
+
+	//return success
+	return 0;
+
+//End of function: Return to main
+}
+
+//C
+//C
+			/*******************************************/
+			/*           FUNCTION: FillFrame           */
+			/*******************************************/
+
+/* Sets the value text of the cells listed by a frame (zero for all
+   cells when zero is 1).  Returns 0, or -1 if a run is not valid */
+
+static int FillFrame(char *name, sparseframe *frame, char **cell, int nrows, int ncols, int zero)
+{
+	//local variable declarations
+	int row,			//row of the first cell of a run
+		col,			//column of the first cell of a run
+		step,			//column step of a run
+		count,			//number of cells of a run
+		icell;			//loop index for cells of a run
+	char *position,		//position in the frame text
+		*token[4],		//run fields (row, col, step, count)
+		*value;			//value text of a cell
+
+	//start at the first run
+	position = frame->body;
+
+	//loop over runs
+	while((token[0] = NextToken(&position)) != NULL)
+	{
+		//read the column, step, and count of the run
+		token[1] = NextToken(&position);
+		token[2] = NextToken(&position);
+		token[3] = NextToken(&position);
+
+		//if the run is incomplete
+		if(token[3] == NULL)
+		{
+			fprintf(stderr, "trexgrid: incomplete run in frame %s\n", name);
+			return -1;
+		}
+
+		//convert the run fields
+		row = atoi(token[0]);
+		col = atoi(token[1]);
+		step = atoi(token[2]);
+		count = atoi(token[3]);
+
+		//if the run is outside the grid
+		if(row < 1 || row > nrows || col < 1 || step < 1 || count < 1
+			|| col + (long)(count - 1) * step > ncols)
+		{
+			fprintf(stderr, "trexgrid: run %d %d %d %d outside the grid in frame %s\n",
+				row, col, step, count, name);
+			return -1;
+		}
+
+		//loop over the cells of the run
+		for(icell=0; icell<count; icell++)
+		{
+			//read the value text of the cell
+			value = NextToken(&position);
+
+			//if the value is missing
+			if(value == NULL)
+			{
+				fprintf(stderr, "trexgrid: missing values in frame %s\n", name);
+				return -1;
+			}
+
+			//set the value text (zero for the cells of a selection)
+			cell[(long)(row - 1) * ncols + col - 1 + (long)icell * step] = zero ? (char *)zerovalue : value;
+
+		}	//end loop over cells
+
+	}	//end loop over runs
+
+	//return success
+	return 0;
+
+//End of function: Return to main
+}
+
+//C
+//C
+			/*******************************************/
+			/*             FUNCTION: main              */
+			/*******************************************/
+
+int main(int argc, char *argv[])
+{
+	//Local variable declarations/definitions
+	int
+		nrows,				//number of grid rows
+		ncols,				//number of grid columns
+		row,				//loop index for rows
+		col;				//loop index for columns
+
+	char
+		**cell,				//value text of each cell (NULL = NODATA_value)
+		*slash,				//last directory separator of the frame name
+		selectionname[FRAMENAMESIZE];	//selection file name (in the directory of the frame)
+
+	sparseframe
+		frame,				//sparse grid frame
+		selection;			//selection of a frame of non-zero cells
+
+	FILE *raster_fp;		//output raster file pointer
+
+	//if the frame name is missing
+	if(argc < 2 || argc > 3)
+	{
+		//Write usage message to screen
+		printf("Usage: %s framefile [rasterfile]\n", argv[0]);
+		return 1;
+	}
+
+	//read the frame
+	if(ReadFrame(argv[1], &frame) != 0)
+	{
+		return 1;
+	}
+
+	//grid dimensions
+	nrows = atoi(frame.nrows);
+	ncols = atoi(frame.ncols);
+
+	//allocate the value text of the cells (all cells are NODATA_value)
+	cell = (char **)calloc((size_t)nrows * ncols, sizeof(char *));
+
+	//if the cells of the selection that are not listed are zero
+	if(strcmp(frame.filter, "nonzero") == 0)
+	{
+		//if the frame does not name its selection file
+		if(frame.selection == NULL)
+		{
+			fprintf(stderr, "trexgrid: frame %s of non-zero cells names no selection file\n", argv[1]);
+			return 1;
+		}
+
+		//the selection file is in the directory of the frame
+		strncpy(selectionname, argv[1], FRAMENAMESIZE-1);
+		selectionname[FRAMENAMESIZE-1] = '\0';
+		slash = strrchr(selectionname, '/');
+
+#ifdef _WIN32
+		//a Windows path may use back slashes
+		if(strrchr(selectionname, '\\') > slash)
+		{
+			slash = strrchr(selectionname, '\\');
+		}
+#endif
+
+		//if the frame name has a directory
+		if(slash != NULL)
+		{
+			//append the selection file name to the directory
+			slash[1] = '\0';
+			strncat(selectionname, frame.selection, FRAMENAMESIZE - strlen(selectionname) - 1);
+		}
+		else	//else the frame is in the current directory
+		{
+			strncpy(selectionname, frame.selection, FRAMENAMESIZE-1);
+
+		}	//end if slash != NULL
+
+		//read the selection and set its cells to zero
+		if(ReadFrame(selectionname, &selection) != 0
+			|| atoi(selection.nrows) != nrows || atoi(selection.ncols) != ncols
+			|| FillFrame(selectionname, &selection, cell, nrows, ncols, 1) != 0)
+		{
+			fprintf(stderr, "trexgrid: can't use selection %s of frame %s\n", selectionname, argv[1]);
+			return 1;
+		}
+
+	}	//end if filter is nonzero
+
+	//set the value text of the listed cells
+	if(FillFrame(argv[1], &frame, cell, nrows, ncols, 0) != 0)
+	{
+		return 1;
+	}
+
+	//if an output file is given
+	if(argc == 3)
+	{
+		//open the output raster file
+		raster_fp = fopen(argv[2], "w");
+
+		//if the output raster file can't be opened
+		if(raster_fp == NULL)
+		{
+			fprintf(stderr, "trexgrid: can't create raster %s\n", argv[2]);
+			return 1;
+		}
+	}
+	else	//else the raster is written to the screen
+	{
+		raster_fp = stdout;
+
+	}	//end if argc == 3
+
+	//write the ESRI ASCII grid header (as written by Grid)
+	fprintf(raster_fp, "ncols\t\t%s\n", frame.ncols);
+	fprintf(raster_fp, "nrows\t\t%s\n", frame.nrows);
+	fprintf(raster_fp, "xllcorner\t%s\n", frame.xllcorner);
+	fprintf(raster_fp, "yllcorner\t%s\n", frame.yllcorner);
+	fprintf(raster_fp, "cellsize\t%s\n", frame.cellsize);
+	fprintf(raster_fp, "NODATA_value\t%s\n", frame.nodata);
+
+	//Loop over number of rows
+	for(row=0; row<nrows; row++)
+	{
+		//Loop over number of columns
+		for(col=0; col<ncols; col++)
+		{
+			//write the value text of the cell (or the no data value)
+			fputs((cell[(long)row * ncols + col] != NULL) ? cell[(long)row * ncols + col] : frame.nodata, raster_fp);
+			fputc(' ', raster_fp);
+		}
+
+		//finish each line with a hard return
+		fputc('\n', raster_fp);
+
+	}	//end loop over rows
+
+	//close the output raster file
+	if(raster_fp != stdout)
+	{
+		fclose(raster_fp);
+	}
+
+	//End of Main Program
+	return 0;
+}
@@ -0,0 +1,158 @@
+/*----------------------------------------------------------------------
+C-  Function:   TrexKernel.c (trexkernel main module)
+C-
+C-  Purpose/    trexkernel is the kernel microbenchmark of the trex
+C-  Methods:    library.  It replays one kernel (OverlandWaterRoute,
+C-              ChannelWaterRoute, Infiltration, ...) from a snapshot
+C-              file written by the -snapshot option of trex (or by
+C-              TrexSetSnapshot) and reports:
+C-
+C-                time per kernel call (seconds)
+C-                time per cell (or channel node) per call (ns)
+C-                throughput (cells/second)
+C-                output check: outputs that differ (bit for bit)
+C-                from the outputs captured in the snapshot
+C-
+C-              The input deck of the snapshot is initialized first
+C-              (TrexInit): constants and parameters are taken from
+C-              the deck, the state from the snapshot.  Before each
+C-              repetition the kernel state is restored, so every call
+C-              starts from the captured state and only the kernel
+C-              call is timed.
+C-
+C-              The exit status is 0 when the outputs match and 1
+C-              when any output differs.
+C-
+C-              With -powmode the kernel is replayed with another
+C-              power law evaluation mode than the default (batch):
+C-              capture with -powmode libm and replay with libm (bit
+C-              for bit) or batch (time only, outputs may differ by
+C-              1 float ulp) to compare the two.
+C-
+C-  Inputs:     argv
+C-
+C-  Outputs:    kernel report (screen)
+C-
+C-  Controls:   repeats
+C-
+C-  Calls:      TrexSetPowMode, TrexInit, TrexReplayKernel,
+C-              TrexKernelName
+C-
+C-  Called by:  None
+C-
+C-  Created:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revised:
+C-
+C-  Date:
+C-
+C-  Revisions:
+C-
+C---------------------------------------------------------------------*/
+//trex library interface
+#include "trex_library.h"
+
+#include <stdio.h>		//C library for standard input/output
+#include <stdlib.h>		//C library for general utilities
+#include <string.h>		//C library for string functions
+
+int main(int argc, char *argv[])
+{
+	//Local variable declarations/definitions
+	int
+		iarg,				//loop index for initial arguments (argv)
+		repeats,			//number of kernel repetitions
+		kernel;				//kernel number of the snapshot (-1 = not valid)
+
+	long
+		cells,				//number of cells (or channel nodes) the kernel loops over
+		mismatches;			//number of output values that differ from the snapshot
+
+	double
+		snaptime,			//simulation time of the snapshot (hours)
+		seconds,			//total kernel time (seconds)
+		percall,			//time per kernel call (seconds)
+		percell;			//time per cell per kernel call (ns)
+
+	//set the default number of repetitions
+	repeats = 100;
+
+	//loop over initial arguments that follow the input and snapshot file names
+	for(iarg=3; iarg<argc; iarg++)
+	{
+		//if the argument is the number of repetitions
+		if(strcmp(argv[iarg], "-repeat") == 0 && iarg+1 < argc)
+		{
+			repeats = atoi(argv[++iarg]);
+		}
+		else if(strcmp(argv[iarg], "-powmode") == 0 && iarg+1 < argc)	//else if the power law mode is set
+		{
+			//if the mode is not valid
+			if(TrexSetPowMode(argv[++iarg]) != 0)
+			{
+				break;
+			}
+		}
+		else	//else the option is not known
+		{
+			break;
+
+		}	//end if option is known
+
+	}	//end loop over initial arguments
+
+	//if the file names are missing or an argument was not valid
+	if(argc < 3 || iarg < argc || repeats < 1)
+	{
+		//Write usage message to screen
+		printf("Usage: %s inputfile snapshotfile [-repeat n] [-powmode batch|libm|scalar|avx2|avx512]\n", argv[0]);
+		exit(EXIT_FAILURE);	//abort
+
+	}	//end if argc < 3...
+
+	//Initialize the simulation of the snapshot deck (no restart, no model image)
+	TrexInit(argv[1], -1, 0, NULL);
+
+	//Replay the kernel
+	kernel = TrexReplayKernel(argv[2], repeats, &snaptime, &seconds, &cells, &mismatches);
+
+	//if the snapshot could not be replayed
+	if(kernel < 0)
+	{
+		//Write error message to screen
+		printf("Error! Can't replay kernel snapshot: %s\n", argv[2]);
+		exit(EXIT_FAILURE);	//abort
+
+	}	//end if kernel < 0
+
+	//compute the time per call (seconds) and per cell (ns)
+	percall = seconds / (double)repeats;
+	percell = (cells > 0) ? 1.0e9 * percall / (double)cells : 0.0;
+
+	//Write the report to screen
+	printf("\ntrexkernel %s results\n", TrexKernelName(kernel));
+	printf("  snapshot = %s at time %f hours\n", argv[2], snaptime);
+	printf("  cells    = %ld  repeats = %d\n", cells, repeats);
+	printf("  total    = %12.6f s\n", seconds);
+	printf("  per call = %12.6f ms\n", 1.0e3 * percall);
+	printf("  per cell = %12.3f ns  (%.4g cells/s)\n", percell,
+		(seconds > 0.0) ? (double)cells * (double)repeats / seconds : 0.0);
+
+	//if the outputs match the captured outputs
+	if(mismatches == 0)
+	{
+		printf("  outputs  = match (bit for bit)\n");
+	}
+	else	//else outputs differ
+	{
+		printf("  outputs  = %ld values differ from the snapshot\n", mismatches);
+
+	}	//end if mismatches == 0
+
+	//return 0 if the outputs match, 1 otherwise
+	return (mismatches == 0) ? 0 : 1;
+
+//end of main
+}
@@ -0,0 +1,642 @@
+/*----------------------------------------------------------------------
+C-  Function:   TrexSeries.c (trexseries main module)
+C-
+C-  Purpose/    trexseries reads the series store of a time series
+C-  Methods:    export file.  A simulation started with -tsstore (or
+C-              TrexSetSeriesStore) writes the rows of each export
+C-              file in blocks, column by column, to a store file
+C-              (the export file name followed by .tss, see
+C-              SeriesStore).  trexseries lists the columns, rows,
+C-              and times of a store, or exports rows to comma-
+C-              delimited text:
+C-
+C-                trexseries storefile [-columns list] [-from hours]
+C-                           [-to hours] [-csv [csvfile]]
+C-
+C-              list selects columns by name (the header text before
+C-              the first blank, e.g. Qov1) or number (1 = first value
+C-              column), separated by commas.  -from and -to select
+C-              the rows of a time range: blocks outside the range
+C-              are skipped by the time index, and only the values of
+C-              the selected columns are read.  Without -columns,
+C-              -from, and -to, the exported text is identical to the
+C-              text export file.  The text is written to the csv
+C-              file (or the screen when no csv file is given).
+C-
+C-              The exit status is 0 when the store was read and 1
+C-              when it could not be read.
+C-
+C-  Inputs:     argv, series store file
+C-
+C-  Outputs:    store listing or comma-delimited text
+C-
+C-  Controls:   None
+C-
+C-  Calls:      ReadStore, ReadIndex, SelectColumns
+C-
+C-  Called by:  None
+C-
+C-  Created:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revised:
+C-
+C-  Date:
+C-
+C-  Revisions:
+C-
+C---------------------------------------------------------------------*/
+#include <stdio.h>		//C library for standard input/output
+#include <stdlib.h>		//C library for general utilities
+#include <string.h>		//C library for string functions
+
+#define SERIESID "TREXSERS"			//identifier at the start and end of a store file
+#define SERIESBLOCKID "SERBLOCK"	//identifier at the start of a block
+#define SERIESINDEXID "SERINDEX"	//identifier at the start of the time index
+#define SERIESVERSION 1				//store file format version
+#define IDSIZE 8					//length of an identifier
+
+//time index entry of a block (as written to the store file)
+typedef struct
+{
+	long long offset;	//offset of the block in the store file (bytes)
+	int nrows;			//number of rows of the block
+	int ncolumns;		//number of value columns of the block
+	double tfirst;		//time of the first row (hours)
+	double tlast;		//time of the last row (hours)
+} seriesblock;
+
+//series store
+typedef struct
+{
+	FILE *fp;				//store file pointer
+	char *header;			//header line of the export file
+	int ncolumns;			//number of value columns
+	int formatsize;			//length of a column format
+	char *formats;			//printf format of each column [ncolumns][formatsize]
+	char **names;			//header text of each column [ncolumns+1] (0 = time)
+	int nblocks;			//number of blocks
+	seriesblock *blocks;	//time index of the blocks
+	int indexed;			//the time index was read from the file (0 = blocks were walked)
+} seriesstore;
+
+//C
+//C
+			/*******************************************/
+			/*           FUNCTION: ReadIndex           */
+			/*******************************************/
+
+/* Reads the time index of a store (or walks its blocks when the store
+   has no index).  Returns 0 when the index was read. */
+
+static int ReadIndex(seriesstore *store, long long start)
+{
+	char id[IDSIZE+1];			//identifier read from the file
+
+	long long
+		indexoffset,			//offset of the time index
+		filesize,				//size of the store file
+		blocksize;				//size of a block
+
+	seriesblock block;			//block read from the file
+
+	id[IDSIZE] = '\0';
+
+	//read the offset of the time index and the identifier at the end of the file
+	fseek(store->fp, 0, SEEK_END);
+	filesize = ftell(store->fp);
+
+	//if the file ends with an index
+	if(filesize >= start + IDSIZE + (long long)sizeof(long long)
+		&& fseek(store->fp, -(long)(IDSIZE + sizeof(long long)), SEEK_END) == 0
+		&& fread(&indexoffset, sizeof(long long), 1, store->fp) == 1
+		&& fread(id, sizeof(char), IDSIZE, store->fp) == IDSIZE
+		&& strcmp(id, SERIESID) == 0
+		&& fseek(store->fp, (long)indexoffset, SEEK_SET) == 0
+		&& fread(id, sizeof(char), IDSIZE, store->fp) == IDSIZE
+		&& strcmp(id, SERIESINDEXID) == 0
+		&& fread(&store->nblocks, sizeof(int), 1, store->fp) == 1
+		&& store->nblocks >= 0)
+	{
+		//read the time index
+		store->blocks = (seriesblock *)malloc((store->nblocks+1) * sizeof(seriesblock));
+
+		//if the index is complete
+		if(fread(store->blocks, sizeof(seriesblock), store->nblocks, store->fp) == (size_t)store->nblocks)
+		{
+			//the index was read
+			store->indexed = 1;
+			return 0;
+		}
+
+		//the index is not complete: walk the blocks
+		free(store->blocks);
+
+	}	//end if the file ends with an index
+
+	//walk the blocks from the first block
+	store->nblocks = 0;
+	store->blocks = NULL;
+	store->indexed = 0;
+	block.offset = start;
+
+	//while a complete block follows
+	while(fseek(store->fp, (long)block.offset, SEEK_SET) == 0
+		&& fread(id, sizeof(char), IDSIZE, store->fp) == IDSIZE
+		&& strcmp(id, SERIESBLOCKID) == 0
+		&& fread(&block.nrows, sizeof(int), 1, store->fp) == 1
+		&& fread(&block.ncolumns, sizeof(int), 1, store->fp) == 1
+		&& fread(&block.tfirst, sizeof(double), 1, store->fp) == 1
+		&& fread(&block.tlast, sizeof(double), 1, store->fp) == 1
+		&& block.nrows > 0 && block.ncolumns == store->ncolumns)
+	{
+		//size of the block
+		blocksize = IDSIZE + 2 * sizeof(int) + (2 + (long long)block.nrows) * sizeof(double)
+			+ (long long)block.ncolumns * block.nrows * sizeof(float);
+
+		//if the block was not written completely
+		if(block.offset + blocksize > filesize)
+		{
+			break;
+		}
+
+		//add the block
+		store->blocks = (seriesblock *)realloc(store->blocks, (store->nblocks+1) * sizeof(seriesblock));
+		store->blocks[store->nblocks++] = block;
+
+		//next block
+		block.offset = block.offset + blocksize;
+
+	}	//end while a complete block follows
+
+	//the blocks were walked
+	return 1;
+
+//end of function ReadIndex
+}
+
+//C
+//C
+			/*******************************************/
+			/*           FUNCTION: ReadStore           */
+			/*******************************************/
+
+/* Reads the header and time index of a store.  Returns 0 on success. */
+
+static int ReadStore(char *name, seriesstore *store)
+{
+	char
+		id[IDSIZE+1],	//identifier read from the file
+		*text,			//copy of the header line (names are terminated in place)
+		*comma;			//next comma of the header line
+
+	int
+		fields[4],		//integer header fields
+		n;				//column index
+
+	memset(store, 0, sizeof(seriesstore));
+	id[IDSIZE] = '\0';
+
+	//open the store
+	store->fp = fopen(name, "rb");
+
+	//if the store can't be opened
+	if(store->fp == NULL)
+	{
+		fprintf(stderr, "trexseries: can't open series store %s\n", name);
+		return 1;
+	}
+
+	//read the identifier and the integer header fields
+	if(fread(id, sizeof(char), IDSIZE, store->fp) != IDSIZE
+		|| strcmp(id, SERIESID) != 0
+		|| fread(fields, sizeof(int), 4, store->fp) != 4
+		|| fields[0] != SERIESVERSION || fields[1] < 1 || fields[2] < 0 || fields[3] < 2)
+	{
+		fprintf(stderr, "trexseries: %s is not a series store (version %d)\n", name, SERIESVERSION);
+		return 1;
+	}
+
+	//set the dimensions of the store
+	store->ncolumns = fields[1];
+	store->formatsize = fields[3];
+
+	//read the header line and the column formats
+	store->header = (char *)malloc((fields[2]+1) * sizeof(char));
+	store->formats = (char *)malloc((size_t)store->ncolumns * store->formatsize * sizeof(char));
+
+	if(fread(store->header, sizeof(char), fields[2], store->fp) != (size_t)fields[2]
+		|| fread(store->formats, sizeof(char), (size_t)store->ncolumns * store->formatsize, store->fp)
+			!= (size_t)store->ncolumns * store->formatsize)
+	{
+		fprintf(stderr, "trexseries: header of series store %s is incomplete\n", name);
+		return 1;
+	}
+
+	//terminate the header line and the formats
+	store->header[fields[2]] = '\0';
+
+	for(n=0; n<store->ncolumns; n++)
+	{
+		store->formats[(size_t)(n+1)*store->formatsize-1] = '\0';
+
+		//if the format is not a format of an export value (",%f" or ",%e")
+		if(strcmp(&store->formats[(size_t)n*store->formatsize], ",%f") != 0
+			&& strcmp(&store->formats[(size_t)n*store->formatsize], ",%e") != 0)
+		{
+			fprintf(stderr, "trexseries: column %d of series store %s has no valid format\n", n+1, name);
+			return 1;
+		}
+	}
+
+	//split the header line at the commas into column names
+	store->names = (char **)calloc(store->ncolumns+1, sizeof(char *));
+	text = (char *)malloc((fields[2]+1) * sizeof(char));
+	strcpy(text, store->header);
+	text[strcspn(text, "\r\n")] = '\0';
+
+	//loop over the fields of the header line
+	for(n=0; n<=store->ncolumns && text != NULL; n++)
+	{
+		//set the name of the column and end it at the next comma
+		store->names[n] = text;
+		comma = strchr(text, ',');
+
+		//if another field follows
+		if(comma != NULL)
+		{
+			*comma = '\0';
+			text = comma + 1;
+		}
+		else	//else this is the last field
+		{
+			text = NULL;
+
+		}	//end if comma != NULL
+
+	}	//end loop over fields
+
+	//read the time index of the blocks
+	ReadIndex(store, IDSIZE + 4 * (long long)sizeof(int) + fields[2]
+		+ (long long)store->ncolumns * store->formatsize);
+
+	return 0;
+
+//end of function ReadStore
+}
+
+//C
+//C
+			/*******************************************/
+			/*         FUNCTION: SelectColumns         */
+			/*******************************************/
+
+/* Sets the columns of a comma-separated list of names or numbers
+   (NULL = all columns).  Returns the number of columns or -1 when a
+   column is not in the store. */
+
+static int SelectColumns(seriesstore *store, char *list, int *selected)
+{
+	char
+		*item,			//name or number of a listed column
+		*key;			//name of a column (header text before the first blank)
+
+	int
+		nselected,		//number of selected columns
+		n,				//column index
+		length;			//length of a column name
+
+	//if no list is given
+	if(list == NULL)
+	{
+		//select all columns
+		for(n=0; n<store->ncolumns; n++)
+		{
+			selected[n] = n;
+		}
+
+		return store->ncolumns;
+	}
+
+	nselected = 0;
+
+	//loop over the listed columns
+	for(item=strtok(list, ","); item!=NULL; item=strtok(NULL, ","))
+	{
+		//if the item is a column number
+		if(strspn(item, "0123456789") == strlen(item))
+		{
+			n = atoi(item) - 1;
+		}
+		else	//else the item is a column name
+		{
+			//loop over columns
+			for(n=0; n<store->ncolumns; n++)
+			{
+				//if the column has a name
+				if(store->names[n+1] != NULL)
+				{
+					//the name is the header text before the first blank
+					key = store->names[n+1] + strspn(store->names[n+1], " ");
+					length = (int)strcspn(key, " ");
+
+					//if the name matches the item
+					if((int)strlen(item) == length && strncmp(key, item, length) == 0)
+					{
+						break;
+					}
+
+				}	//end if names[] != NULL
+
+			}	//end loop over columns
+
+		}	//end if item is a number
+
+		//if the column is not in the store
+		if(n < 0 || n >= store->ncolumns)
+		{
+			fprintf(stderr, "trexseries: no column %s in the series store\n", item);
+			return -1;
+		}
+
+		//select the column
+		selected[nselected++] = n;
+
+	}	//end loop over listed columns
+
+	return nselected;
+
+//end of function SelectColumns
+}
+
+//C
+//C
+			/*******************************************/
+			/*             FUNCTION: main              */
+			/*******************************************/
+
+int main(int argc, char *argv[])
+{
+	//Local variable declarations/definitions
+	int
+		iarg,				//loop index for arguments
+		usage,				//the arguments are not valid (write the usage message)
+		csv,				//rows are exported to comma-delimited text (0 = listing)
+		all,				//all rows and columns are exported (the header line is copied)
+		nselected,			//number of selected columns
+		*selected,			//selected columns
+		iblock,				//loop index for blocks
+		irow,				//loop index for rows
+		n;					//loop index for selected columns
+
+	long long
+		nrows;				//number of rows of the store
+
+	char
+		*columns,			//list of selected columns (NULL = all)
+		*csvname;			//csv file name (NULL = screen)
+
+	double
+		from,				//first time of the exported rows (hours)
+		to,					//last time of the exported rows (hours)
+		*times;				//times of a block
+
+	float
+		*values;			//values of the selected columns of a block [nselected][nrows]
+
+	seriesblock *block;		//block of the store
+
+	seriesstore store;		//series store
+
+	FILE *csv_fp;			//csv file pointer
+
+	//default settings (all rows and columns, listing)
+	columns = NULL;
+	csvname = NULL;
+	csv = 0;
+	from = -1.0e30;
+	to = 1.0e30;
+	usage = (argc < 2);
+
+	//loop over the arguments after the store name
+	for(iarg=2; iarg<argc; iarg++)
+	{
+		//if the argument is the column list
+		if(strcmp(argv[iarg], "-columns") == 0 && iarg+1 < argc)
+		{
+			columns = argv[++iarg];
+		}
+		//if the argument is the first time
+		else if(strcmp(argv[iarg], "-from") == 0 && iarg+1 < argc)
+		{
+			from = atof(argv[++iarg]);
+		}
+		//if the argument is the last time
+		else if(strcmp(argv[iarg], "-to") == 0 && iarg+1 < argc)
+		{
+			to = atof(argv[++iarg]);
+		}
+		//if the argument is the csv export (followed by an optional file name)
+		else if(strcmp(argv[iarg], "-csv") == 0)
+		{
+			csv = 1;
+
+			//if a file name follows
+			if(iarg+1 < argc && argv[iarg+1][0] != '-')
+			{
+				csvname = argv[++iarg];
+			}
+		}
+		else	//else the argument is not valid
+		{
+			usage = 1;
+
+		}	//end if argument
+	}
+
+	//if the store name is missing or an argument is not valid
+	if(usage)
+	{
+		//Write usage message to screen
+		printf("Usage: %s storefile [-columns list] [-from hours] [-to hours] [-csv [csvfile]]\n", argv[0]);
+		return 1;
+	}
+
+	//read the store header and time index
+	if(ReadStore(argv[1], &store) != 0)
+	{
+		return 1;
+	}
+
+	//count the rows of the store
+	nrows = 0;
+
+	for(iblock=0; iblock<store.nblocks; iblock++)
+	{
+		nrows = nrows + store.blocks[iblock].nrows;
+	}
+
+	//select the columns
+	selected = (int *)malloc((store.ncolumns+1) * sizeof(int));
+	nselected = SelectColumns(&store, columns, selected);
+
+	if(nselected < 0)
+	{
+		return 1;
+	}
+
+	//if the store is listed
+	if(csv == 0)
+	{
+		printf("Series store:   %s\n", argv[1]);
+		printf("Columns:        %d\n", store.ncolumns);
+		printf("Rows:           %lld in %d blocks (%s)\n", nrows, store.nblocks,
+			store.indexed ? "time index" : "no time index: blocks walked");
+
+		//if there are rows
+		if(store.nblocks > 0)
+		{
+			printf("Time (hours):   %f to %f\n", store.blocks[0].tfirst,
+				store.blocks[store.nblocks-1].tlast);
+		}
+
+		//loop over the selected columns
+		for(n=0; n<nselected; n++)
+		{
+			printf("  %5d  %-24s %s\n", selected[n] + 1,
+				(store.names[selected[n]+1] != NULL) ? store.names[selected[n]+1] : "",
+				&store.formats[(size_t)selected[n]*store.formatsize]);
+		}
+
+		return 0;
+
+	}	//end if csv == 0
+
+	//if a csv file is given
+	if(csvname != NULL)
+	{
+		//create the csv file
+		csv_fp = fopen(csvname, "w");
+
+		if(csv_fp == NULL)
+		{
+			fprintf(stderr, "trexseries: can't create csv file %s\n", csvname);
+			return 1;
+		}
+	}
+	else	//else the text is written to the screen
+	{
+		csv_fp = stdout;
+
+	}	//end if csvname != NULL
+
+	//all rows and columns are exported when no selection is given
+	all = (columns == NULL && from <= -1.0e30 && to >= 1.0e30);
+
+	//if the whole store is exported and the store has the header line
+	if(all && store.header[0] != '\0')
+	{
+		//copy the header line of the export file
+		fputs(store.header, csv_fp);
+	}
+	else	//else write the names of the selected columns
+	{
+		fputs((store.names[0] != NULL) ? store.names[0] : "Time (hours)", csv_fp);
+
+		for(n=0; n<nselected; n++)
+		{
+			if(store.names[selected[n]+1] != NULL)
+			{
+				fprintf(csv_fp, ",%s", store.names[selected[n]+1]);
+			}
+			else
+			{
+				fprintf(csv_fp, ",C%d", selected[n]+1);
+			}
+		}
+
+		fputc('\n', csv_fp);
+
+	}	//end if all
+
+	//loop over blocks
+	for(iblock=0; iblock<store.nblocks; iblock++)
+	{
+		//set the block
+		block = &store.blocks[iblock];
+
+		//if the block is outside the time range
+		if(block->tlast < from || block->tfirst > to)
+		{
+			//skip the block
+			continue;
+		}
+
+		//allocate the times and values of the block
+		times = (double *)malloc(block->nrows * sizeof(double));
+		values = (float *)malloc(((size_t)nselected+1) * block->nrows * sizeof(float));
+
+		//read the times (after the block header)
+		fseek(store.fp, (long)(block->offset + IDSIZE + 2 * sizeof(int) + 2 * sizeof(double)), SEEK_SET);
+
+		if(fread(times, sizeof(double), block->nrows, store.fp) != (size_t)block->nrows)
+		{
+			fprintf(stderr, "trexseries: block %d of %s is incomplete\n", iblock+1, argv[1]);
+			return 1;
+		}
+
+		//loop over the selected columns
+		for(n=0; n<nselected; n++)
+		{
+			//read the values of the column
+			fseek(store.fp, (long)(block->offset + IDSIZE + 2 * sizeof(int)
+				+ (2 + (long long)block->nrows) * sizeof(double)
+				+ (long long)selected[n] * block->nrows * sizeof(float)), SEEK_SET);
+
+			if(fread(&values[(size_t)n*block->nrows], sizeof(float), block->nrows, store.fp)
+				!= (size_t)block->nrows)
+			{
+				fprintf(stderr, "trexseries: block %d of %s is incomplete\n", iblock+1, argv[1]);
+				return 1;
+			}
+
+		}	//end loop over selected columns
+
+		//loop over rows of the block
+		for(irow=0; irow<block->nrows; irow++)
+		{
+			//if the row is in the time range
+			if(times[irow] >= from && times[irow] <= to)
+			{
+				//write the row as the text export file does
+				fprintf(csv_fp, "%f", times[irow]);
+
+				for(n=0; n<nselected; n++)
+				{
+					fprintf(csv_fp, &store.formats[(size_t)selected[n]*store.formatsize],
+						values[(size_t)n*block->nrows + irow]);
+				}
+
+				fputc('\n', csv_fp);
+
+			}	//end if the row is in the time range
+
+		}	//end loop over rows
+
+		free(times);
+		free(values);
+
+	}	//end loop over blocks
+
+	//close the csv file
+	if(csv_fp != stdout)
+	{
+		fclose(csv_fp);
+	}
+
+	fclose(store.fp);
+
+	//End of Main Program
+	return 0;
+}
@@ -0,0 +1,415 @@
+/*----------------------------------------------------------------------
+C-  Function:   TrexStat.c (trexstat main module)
+C-
+C-  Purpose/    trexstat prints the live status of running trex
+C-  Methods:    simulations.  A simulation started with -telemetry 1
+C-              (or TrexSetTelemetry) publishes its status in a
+C-              POSIX shared memory segment (/trex.<pid>, see
+C-              TrexTelemetry in trex_library.h).  trexstat attaches
+C-              to the segment of a process id (or to the segments of
+C-              all simulations of the host with -all) and prints one
+C-              line per simulation:
+C-
+C-                state      start, run, finish, done, or dead (the
+C-                           process exited without removing its
+C-                           segment)
+C-                simtime    simulation time and end time (hours) and
+C-                           percent of the simulation completed
+C-                dt         current time step (seconds)
+C-                steps/s    accepted time steps per wall clock second
+C-                courant    maximum overland and channel courant
+C-                           numbers of the last time step
+C-                memory     resident memory (MB)
+C-                mb error   water mass balance error of the last
+C-                           print interval (percent)
+C-                idle       seconds since the last update (a stalled
+C-                           simulation has a growing idle time)
+C-
+C-              With -phases, the wall clock time of each time step
+C-              phase (seconds) is added.  With -interval, the status
+C-              is printed again every interval seconds (streamed)
+C-              until the simulations finish or -count lines are
+C-              printed.
+C-
+C-              The exit status is 0 when a segment was read and 1
+C-              when no segment was found.
+C-
+C-  Inputs:     argv, telemetry segments
+C-
+C-  Outputs:    run status (screen)
+C-
+C-  Controls:   interval, count, phases
+C-
+C-  Calls:      ReadTelemetry, PrintTelemetry
+C-
+C-  Called by:  None
+C-
+C-  Created:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revised:
+C-
+C-  Date:
+C-
+C-  Revisions:
+C-
+C---------------------------------------------------------------------*/
+//trex library interface (TrexTelemetry)
+#include "trex_library.h"
+
+#include <stdio.h>		//C library for standard input/output
+#include <stdlib.h>		//C library for general utilities
+#include <string.h>		//C library for string functions
+#include <time.h>		//C library for date and time functions
+#include <errno.h>		//C library for error numbers
+#include <signal.h>		//POSIX process signals (process check)
+#include <dirent.h>		//POSIX directory entries (segment list)
+#include <sys/mman.h>	//POSIX shared memory
+#include <fcntl.h>		//POSIX file control
+#include <unistd.h>		//POSIX file close
+
+#define MAXSEGMENTS 256		//maximum number of segments listed by -all
+
+static const char *statename[] = {"start", "run", "finish", "done"};	//names of the run states
+
+//C
+//C
+			/*******************************************/
+			/*         FUNCTION: ReadTelemetry         */
+			/*******************************************/
+
+/* Copies a consistent status from the telemetry segment name into */
+/* status (returns 0, or -1 if the segment can't be read)          */
+
+static int ReadTelemetry(char *name, TrexTelemetry *status)
+{
+	//local variable declarations/definitions
+	int fd,					//file descriptor of the shared memory segment
+		itry;				//loop index for copy attempts
+	unsigned int sequence;	//update count before the copy
+	TrexTelemetry *segment;	//mapped segment
+	void *base;				//start of the mapped segment
+	struct timespec pause;	//wait between copy attempts
+
+	//open the segment for reading
+	fd = shm_open(name, O_RDONLY, 0);
+
+	//if the segment does not exist
+	if(fd < 0)
+	{
+		return -1;
+	}
+
+	//map the segment
+	base = mmap(NULL, sizeof(TrexTelemetry), PROT_READ, MAP_SHARED, fd, 0);
+
+	//close the descriptor (the mapping remains)
+	close(fd);
+
+	//if the segment can't be mapped
+	if(base == MAP_FAILED)
+	{
+		return -1;
+	}
+
+	//set the segment pointer
+	segment = (TrexTelemetry *)base;
+
+	//wait 1 ms between copy attempts
+	pause.tv_sec = 0;
+	pause.tv_nsec = 1000000;
+
+	//loop over copy attempts (the writer updates the segment each time step)
+	for(itry=0; itry<1000; itry++)
+	{
+		//get the update count before the copy
+		sequence = segment->sequence;
+		__sync_synchronize();
+
+		//if no update is being written
+		if(sequence % 2 == 0)
+		{
+			//copy the status
+			memcpy(status, segment, sizeof(TrexTelemetry));
+			__sync_synchronize();
+
+			//if no update was written during the copy
+			if(segment->sequence == sequence)
+			{
+				break;
+			}
+		}
+
+		//wait for the writer
+		nanosleep(&pause, NULL);
+
+	}	//end loop over copy attempts
+
+	//unmap the segment
+	munmap(base, sizeof(TrexTelemetry));
+
+	//if no consistent copy was made or the layout is not known
+	if(itry >= 1000 || status->version != TREXTELEMETRYVERSION)
+	{
+		return -1;
+	}
+
+	//return success
+	return 0;
+
+//end of function ReadTelemetry
+}
+
+//C
+//C
+			/*******************************************/
+			/*         FUNCTION: PrintTelemetry        */
+			/*******************************************/
+
+/* Writes the status of a simulation as one line to the screen */
+
+static void PrintTelemetry(TrexTelemetry *status, int phases)
+{
+	//local variable declarations/definitions
+	int iphase;				//loop index for time step phases
+	const char *state;		//name of the run state
+	double now,				//current wall clock time (seconds since epoch)
+		done;				//percent of the simulation completed
+	struct timespec clock;	//current calendar time
+
+	//get the current time
+	timespec_get(&clock, TIME_UTC);
+	now = (double)clock.tv_sec + 1.0e-9 * (double)clock.tv_nsec;
+
+	//name the run state
+	state = (status->state >= 0 && status->state <= TREXTELEMETRYDONE) ? statename[status->state] : "?";
+
+	//if the process exited without removing its segment
+	if(kill((pid_t)status->pid, 0) != 0 && errno == ESRCH)
+	{
+		state = "dead";
+	}
+
+	//percent of the simulation completed
+	done = (status->tend > status->tstart)
+		? 100.0 * (status->simtime - status->tstart) / (status->tend - status->tstart) : 0.0;
+
+	//limit the percent completed (simtime exceeds tend after the last time step)
+	if(done > 100.0)
+	{
+		done = 100.0;
+	}
+
+	//write the status
+	printf("%8d %-6s %10.4f %10.4f %6.1f %9.3f %9.1f %7.3f %7.3f %9.1f %10.4f %7.1f",
+		status->pid, state, status->simtime, status->tend, done, status->dt,
+		status->stepspersecond, status->maxcourantov, status->maxcourantch,
+		status->memorykb / 1024.0, status->mberror, now - status->updated);
+
+	//if the phase times are printed
+	if(phases)
+	{
+		//loop over time step phases
+		for(iphase=0; iphase<TREXNPHASES; iphase++)
+		{
+			printf(" %9.2f", status->phaseseconds[iphase]);
+		}
+	}
+
+	//write the input file name
+	printf("  %s\n", status->inputfile);
+
+//end of function PrintTelemetry
+}
+
+int main(int argc, char *argv[])
+{
+	//Local variable declarations/definitions
+	int
+		iarg,				//loop index for initial arguments (argv)
+		all,				//all segments of the host are listed (1) or one process id (0)
+		phases,				//phase times are printed (1) or not (0)
+		count,				//number of status prints (0 = until the simulations finish)
+		iprint,				//loop index for status prints
+		nsegments,			//number of segment names
+		iseg,				//loop index for segments
+		nread,				//number of segments read in a status print
+		running;			//number of segments of running simulations in a status print
+
+	double
+		interval;			//seconds between status prints (0 = print once)
+
+	char
+		segmentname[MAXSEGMENTS][64];	//segment names
+
+	TrexTelemetry
+		status;				//status copied from a segment
+
+	DIR *shm_dir;				//shared memory directory (Linux)
+	struct dirent *entry;		//shared memory directory entry
+	struct timespec pause;		//wait between status prints
+
+	//set the defaults (one process id, print once)
+	all = 0;
+	phases = 0;
+	count = 0;
+	interval = 0.0;
+
+	//loop over initial arguments that follow the process id (or -all)
+	for(iarg=2; iarg<argc; iarg++)
+	{
+		//if the argument is the print interval
+		if(strcmp(argv[iarg], "-interval") == 0 && iarg+1 < argc)
+		{
+			interval = atof(argv[++iarg]);
+		}
+		else if(strcmp(argv[iarg], "-count") == 0 && iarg+1 < argc)	//else if the number of prints is set
+		{
+			count = atoi(argv[++iarg]);
+		}
+		else if(strcmp(argv[iarg], "-phases") == 0)	//else if the phase times are printed
+		{
+			phases = 1;
+		}
+		else	//else the option is not known
+		{
+			break;
+
+		}	//end if option is known
+
+	}	//end loop over initial arguments
+
+	//if the process id is missing or an argument was not valid
+	if(argc < 2 || iarg < argc || interval < 0.0 || count < 0
+		|| (strcmp(argv[1], "-all") != 0 && atol(argv[1]) <= 0))
+	{
+		//Write usage message to screen
+		printf("Usage: %s pid|-all [-interval seconds] [-count n] [-phases]\n", argv[0]);
+		exit(EXIT_FAILURE);	//abort
+
+	}	//end if argc < 2...
+
+	//if one process id is given
+	if(strcmp(argv[1], "-all") != 0)
+	{
+		//name its segment
+		sprintf(segmentname[0], "%s%ld", TREXTELEMETRYPREFIX, atol(argv[1]));
+		nsegments = 1;
+	}
+	else	//else all segments of the host are listed
+	{
+		all = 1;
+		nsegments = 0;
+	}
+
+	//if the status is printed once, print it once
+	if(interval <= 0.0)
+	{
+		count = 1;
+	}
+
+	//set the wait between status prints
+	pause.tv_sec = (time_t)interval;
+	pause.tv_nsec = (long)(1.0e9 * (interval - (double)pause.tv_sec));
+
+	//Write the column header to screen
+	printf("%8s %-6s %10s %10s %6s %9s %9s %7s %7s %9s %10s %7s",
+		"pid", "state", "simtime(h)", "tend(h)", "done%", "dt(s)",
+		"steps/s", "courov", "courch", "mem(MB)", "mberr(%)", "idle(s)");
+
+	//if the phase times are printed
+	if(phases)
+	{
+		printf(" %9s %9s %9s %9s %9s %9s", "forcing", "water", "solids",
+			"chemical", "output", "newstate");
+	}
+
+	printf("  input\n");
+
+	//loop over status prints
+	for(iprint=0; count == 0 || iprint < count; iprint++)
+	{
+		//if all segments are listed, list the segments of the host
+		if(all)
+		{
+			nsegments = 0;
+
+			//open the shared memory directory (POSIX shared memory on Linux)
+			shm_dir = opendir("/dev/shm");
+
+			//if the directory can be read
+			if(shm_dir != NULL)
+			{
+				//loop over directory entries
+				while((entry = readdir(shm_dir)) != NULL && nsegments < MAXSEGMENTS)
+				{
+					//if the entry is a telemetry segment (the name without the leading /)
+					if(strncmp(entry->d_name, TREXTELEMETRYPREFIX + 1, strlen(TREXTELEMETRYPREFIX) - 1) == 0
+						&& strlen(entry->d_name) < 62)
+					{
+						//add the segment name
+						sprintf(segmentname[nsegments], "/%s", entry->d_name);
+						nsegments++;
+					}
+
+				}	//end loop over directory entries
+
+				//close the directory
+				closedir(shm_dir);
+
+			}	//end if shm_dir != NULL
+
+		}	//end if all
+
+		//no segment has been read
+		nread = 0;
+		running = 0;
+
+		//loop over segments
+		for(iseg=0; iseg<nsegments; iseg++)
+		{
+			//if the status can be read
+			if(ReadTelemetry(segmentname[iseg], &status) == 0)
+			{
+				//Write the status to screen
+				PrintTelemetry(&status, phases);
+				nread++;
+
+				//if the simulation is running (and its process exists)
+				if(status.state < TREXTELEMETRYDONE && kill((pid_t)status.pid, 0) == 0)
+				{
+					running++;
+				}
+
+			}	//end if ReadTelemetry
+
+		}	//end loop over segments
+
+		//if no segment was read on the first print
+		if(nread == 0 && iprint == 0)
+		{
+			//Write error message to screen
+			printf("No running trex telemetry found (start trex with -telemetry 1)\n");
+			exit(EXIT_FAILURE);	//abort
+		}
+
+		//flush the output (streamed to a pipe or file)
+		fflush(stdout);
+
+		//if no simulation is running or the last print was made
+		if(running == 0 || (count > 0 && iprint+1 >= count))
+		{
+			break;
+		}
+
+		//wait for the next print
+		nanosleep(&pause, NULL);
+
+	}	//end loop over status prints
+
+	//return success
+	return 0;
+
+//end of function main
+}
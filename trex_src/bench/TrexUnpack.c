@@ -0,0 +1,455 @@
+/*----------------------------------------------------------------------
+C-  Function:   TrexUnpack.c (trexunpack main module)
+C-
+C-  Purpose/    trexunpack reads a packed grid container.  A
+C-  Methods:    simulation started with -gridpack (or TrexSetGridPack)
+C-              appends each grid output as a compressed frame to one
+C-              container per grid (name.gpk, see GridPack).
+C-              trexunpack lists the frames of a container or writes
+C-              the ESRI ASCII grid of a frame in the format of full
+C-              grid output (Grid):
+C-
+C-                trexunpack container               list the frames
+C-                trexunpack container gridcount [rasterfile]
+C-                                                   write a frame
+C-                trexunpack container -all          write every frame
+C-                                                   (name.gridcount)
+C-
+C-              A frame is found by the time index of the container
+C-              (or by walking the frames of a container without an
+C-              index, from a run that stopped) and decoded from the
+C-              key frame before it.  The raster of a frame is
+C-              identical to the raster written by Grid.  A raster is
+C-              written to the raster file (or the screen when no
+C-              raster file is given).
+C-
+C-              The exit status is 0 when the container was read and
+C-              1 when it could not be read.
+C-
+C-  Inputs:     argv, packed grid container
+C-
+C-  Outputs:    frame listing or ESRI ASCII grids
+C-
+C-  Controls:   None
+C-
+C-  Calls:      ReadContainer, DecodeFrame, WriteRaster,
+C-              TrexUnpackGridFrame
+C-
+C-  Called by:  None
+C-
+C-  Created:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revised:
+C-
+C-  Date:
+C-
+C-  Revisions:
+C-
+C---------------------------------------------------------------------*/
+#include "trex_library.h"
+
+#include <stdio.h>		//C library for standard input/output
+#include <stdlib.h>		//C library for general utilities
+#include <string.h>		//C library for string functions
+
+#define IDSIZE 8					//length of an identifier
+#define NAMESIZE 4096				//maximum length of a file name
+
+//packed grid container
+typedef struct
+{
+	FILE *fp;					//container file pointer
+	int fields[8];				//integer header fields (version, ncols, nrows, nodata, cells, chunk cells, key frames, 0)
+	double location[3];			//grid location (xllcorner, yllcorner, cellsize)
+	unsigned char *mask;		//domain mask (one bit per cell)
+	int nframes;				//number of frames
+	TrexGridPackFrame *frames;	//time index of the frames
+	int indexed;				//the time index was read from the file (0 = frames were walked)
+} container;
+
+//C
+//C
+			/*******************************************/
+			/*         FUNCTION: ReadContainer         */
+			/*******************************************/
+
+/* Reads the header and time index of a container (or walks its frames
+   when it has no index).  Returns 0 on success. */
+
+static int ReadContainer(char *name, container *pack)
+{
+	char id[IDSIZE+1];			//identifier read from the file
+
+	long long
+		start,					//offset of the first frame
+		indexoffset,			//offset of the time index
+		filesize;				//size of the container file
+
+	int nmask;					//size of the domain mask (bytes)
+
+	TrexGridPackFrame frame;	//frame read from the file
+
+	memset(pack, 0, sizeof(container));
+	id[IDSIZE] = '\0';
+
+	//open the container
+	pack->fp = fopen(name, "rb");
+
+	if(pack->fp == NULL)
+	{
+		fprintf(stderr, "trexunpack: can't open container %s\n", name);
+		return 1;
+	}
+
+	//read the identifier, the header fields, and the grid location
+	if(fread(id, sizeof(char), IDSIZE, pack->fp) != IDSIZE
+		|| strcmp(id, TREXGRIDPACKID) != 0
+		|| fread(pack->fields, sizeof(int), 8, pack->fp) != 8
+		|| pack->fields[0] != TREXGRIDPACKVERSION
+		|| pack->fields[1] < 1 || pack->fields[2] < 1 || pack->fields[4] < 0
+		|| (long long)pack->fields[1] * pack->fields[2] > 1000000000LL
+		|| fread(pack->location, sizeof(double), 3, pack->fp) != 3)
+	{
+		fprintf(stderr, "trexunpack: %s is not a packed grid container (version %d)\n",
+			name, TREXGRIDPACKVERSION);
+		return 1;
+	}
+
+	//read the domain mask
+	nmask = (pack->fields[1] * pack->fields[2] + 7) / 8;
+	pack->mask = (unsigned char *)malloc(nmask+1);
+
+	if(fread(pack->mask, sizeof(unsigned char), nmask, pack->fp) != (size_t)nmask)
+	{
+		fprintf(stderr, "trexunpack: header of container %s is incomplete\n", name);
+		return 1;
+	}
+
+	//offset of the first frame
+	start = IDSIZE + 8 * sizeof(int) + 3 * sizeof(double) + nmask;
+
+	//read the offset of the time index and the identifier at the end of the file
+	fseek(pack->fp, 0, SEEK_END);
+	filesize = ftell(pack->fp);
+
+	//if the file ends with an index
+	if(filesize >= start + IDSIZE + (long long)sizeof(long long)
+		&& fseek(pack->fp, -(long)(IDSIZE + sizeof(long long)), SEEK_END) == 0
+		&& fread(&indexoffset, sizeof(long long), 1, pack->fp) == 1
+		&& fread(id, sizeof(char), IDSIZE, pack->fp) == IDSIZE
+		&& strcmp(id, TREXGRIDPACKID) == 0
+		&& fseek(pack->fp, (long)indexoffset, SEEK_SET) == 0
+		&& fread(id, sizeof(char), IDSIZE, pack->fp) == IDSIZE
+		&& strcmp(id, TREXGRIDPACKINDEXID) == 0
+		&& fread(&pack->nframes, sizeof(int), 1, pack->fp) == 1
+		&& pack->nframes >= 0)
+	{
+		//read the time index
+		pack->frames = (TrexGridPackFrame *)malloc((pack->nframes+1) * sizeof(TrexGridPackFrame));
+
+		if(fread(pack->frames, sizeof(TrexGridPackFrame), pack->nframes, pack->fp) == (size_t)pack->nframes)
+		{
+			pack->indexed = 1;
+			return 0;
+		}
+
+		//the index is not complete: walk the frames
+		free(pack->frames);
+
+	}	//end if the file ends with an index
+
+	//walk the frames from the first frame
+	pack->nframes = 0;
+	pack->frames = NULL;
+	pack->indexed = 0;
+	frame.offset = start;
+
+	//while a complete frame follows
+	while(fseek(pack->fp, (long)frame.offset, SEEK_SET) == 0
+		&& fread(id, sizeof(char), IDSIZE, pack->fp) == IDSIZE
+		&& strcmp(id, TREXGRIDPACKFRAMEID) == 0
+		&& fread(&frame.gridcount, sizeof(int), 1, pack->fp) == 1
+		&& fread(&frame.keyframe, sizeof(int), 1, pack->fp) == 1
+		&& fread(&frame.size, sizeof(int), 1, pack->fp) == 1
+		&& fread(&frame.reserved, sizeof(int), 1, pack->fp) == 1
+		&& frame.size > 0
+		&& frame.offset + IDSIZE + 4 * (long long)sizeof(int) + frame.size <= filesize)
+	{
+		//add the frame
+		pack->frames = (TrexGridPackFrame *)realloc(pack->frames, (pack->nframes+1) * sizeof(TrexGridPackFrame));
+		pack->frames[pack->nframes++] = frame;
+
+		//next frame
+		frame.offset = frame.offset + IDSIZE + 4 * sizeof(int) + frame.size;
+
+	}	//end while a complete frame follows
+
+	return 0;
+
+//end of function ReadContainer
+}
+
+//C
+//C
+			/*******************************************/
+			/*          FUNCTION: DecodeFrame          */
+			/*******************************************/
+
+/* Decodes frame n of a container into bits (which must hold the bits
+   of frame n-1 unless frame n is a key frame).  Returns 0 on success. */
+
+static int DecodeFrame(container *pack, int n, unsigned int *bits)
+{
+	unsigned char *body;	//frame body
+
+	int status;				//decode status
+
+	//read the frame body (after the frame header)
+	body = (unsigned char *)malloc(pack->frames[n].size);
+
+	if(fseek(pack->fp, (long)(pack->frames[n].offset + IDSIZE + 4 * sizeof(int)), SEEK_SET) != 0
+		|| fread(body, sizeof(unsigned char), pack->frames[n].size, pack->fp) != (size_t)pack->frames[n].size)
+	{
+		free(body);
+		return -1;
+	}
+
+	//decode the value bits
+	status = TrexUnpackGridFrame(body, pack->frames[n].size, pack->fields[4],
+		pack->frames[n].keyframe, bits);
+
+	free(body);
+
+	return status;
+
+//end of function DecodeFrame
+}
+
+//C
+//C
+			/*******************************************/
+			/*          FUNCTION: WriteRaster          */
+			/*******************************************/
+
+/* Writes the ESRI ASCII grid of decoded value bits (as written by Grid) */
+
+static void WriteRaster(container *pack, unsigned int *bits, FILE *raster_fp)
+{
+	int
+		row,			//row index
+		col,			//column index
+		cell,			//cell index (row major)
+		value;			//domain value index
+
+	float number;		//value of a cell
+
+	//write the ESRI ASCII grid header (as written by Grid)
+	fprintf(raster_fp, "ncols\t\t%d\n", pack->fields[1]);
+	fprintf(raster_fp, "nrows\t\t%d\n", pack->fields[2]);
+	fprintf(raster_fp, "xllcorner\t%.2f\n", pack->location[0]);
+	fprintf(raster_fp, "yllcorner\t%.2f\n", pack->location[1]);
+	fprintf(raster_fp, "cellsize\t%.2f\n", pack->location[2]);
+	fprintf(raster_fp, "NODATA_value\t%d\n", pack->fields[3]);
+
+	value = 0;
+
+	//Loop over number of rows
+	for(row=0; row<pack->fields[2]; row++)
+	{
+		//Loop over number of columns
+		for(col=0; col<pack->fields[1]; col++)
+		{
+			cell = row * pack->fields[1] + col;
+
+			//if the cell is in the domain
+			if(pack->mask[cell/8] & (1 << (cell % 8)))
+			{
+				//write the value of the cell
+				memcpy(&number, &bits[value++], sizeof(float));
+				fprintf(raster_fp, "%e ", number);
+			}
+			else	//else the cell is not in the domain
+			{
+				//write nodata value
+				fprintf(raster_fp, "%d ", pack->fields[3]);
+			}
+		}
+
+		//finish each line with a hard return
+		fprintf(raster_fp, "\n");
+
+	}	//end loop over rows
+
+//end of function WriteRaster
+}
+
+//C
+//C
+			/*******************************************/
+			/*             FUNCTION: main              */
+			/*******************************************/
+
+int main(int argc, char *argv[])
+{
+	//Local variable declarations/definitions
+	int
+		n,					//frame index
+		first,				//key frame before the frame
+		target,				//frame to write (-1 = all frames)
+		ncells;				//number of domain cells
+
+	long long
+		packed;				//size of all frame bodies (bytes)
+
+	char
+		basename[NAMESIZE],	//container name without .gpk
+		rastername[NAMESIZE+16];	//raster file name
+
+	unsigned int
+		*bits;				//value bits of a frame
+
+	container pack;			//packed grid container
+
+	FILE *raster_fp;		//raster file pointer
+
+	//if the container name is missing
+	if(argc < 2 || argc > 4)
+	{
+		//Write usage message to screen
+		printf("Usage: %s container [gridcount [rasterfile] | -all]\n", argv[0]);
+		return 1;
+	}
+
+	//read the container header and time index
+	if(ReadContainer(argv[1], &pack) != 0)
+	{
+		return 1;
+	}
+
+	ncells = pack.fields[4];
+
+	//if the frames are listed
+	if(argc == 2)
+	{
+		packed = 0;
+
+		for(n=0; n<pack.nframes; n++)
+		{
+			packed = packed + pack.frames[n].size;
+		}
+
+		printf("Container:      %s\n", argv[1]);
+		printf("Grid:           %d x %d (%d domain cells)\n", pack.fields[2], pack.fields[1], ncells);
+		printf("Frames:         %d (%s), key frame every %d\n", pack.nframes,
+			pack.indexed ? "time index" : "no time index: frames walked", pack.fields[6]);
+		printf("Packed:         %lld bytes (%.1f%% of the float values)\n", packed,
+			(pack.nframes > 0 && ncells > 0) ? 100.0 * packed / (4.0 * ncells * pack.nframes) : 0.0);
+
+		for(n=0; n<pack.nframes; n++)
+		{
+			printf("  %8d  %s %10d bytes\n", pack.frames[n].gridcount,
+				pack.frames[n].keyframe ? "key" : "   ", pack.frames[n].size);
+		}
+
+		return 0;
+
+	}	//end if argc == 2
+
+	//if every frame is written
+	if(strcmp(argv[2], "-all") == 0)
+	{
+		target = -1;
+		first = 0;
+	}
+	else	//else one frame is written
+	{
+		//find the frame of the grid count
+		for(target=0; target<pack.nframes; target++)
+		{
+			if(pack.frames[target].gridcount == atoi(argv[2]))
+			{
+				break;
+			}
+		}
+
+		if(target == pack.nframes)
+		{
+			fprintf(stderr, "trexunpack: no frame %s in container %s\n", argv[2], argv[1]);
+			return 1;
+		}
+
+		//decode from the key frame before the frame
+		for(first=target; first>0 && !pack.frames[first].keyframe; first--)
+		{
+		}
+
+	}	//end if -all
+
+	//the name of the rasters of -all is the container name without .gpk
+	strncpy(basename, argv[1], NAMESIZE-1);
+	basename[NAMESIZE-1] = '\0';
+
+	if(strlen(basename) > 4 && strcmp(basename + strlen(basename) - 4, ".gpk") == 0)
+	{
+		basename[strlen(basename) - 4] = '\0';
+	}
+
+	//allocate the value bits
+	bits = (unsigned int *)calloc((size_t)ncells+1, sizeof(unsigned int));
+
+	//loop over frames from the key frame
+	for(n=first; n<pack.nframes && (target < 0 || n <= target); n++)
+	{
+		//decode the frame
+		if(DecodeFrame(&pack, n, bits) != 0)
+		{
+			fprintf(stderr, "trexunpack: frame %d of container %s is not valid\n",
+				pack.frames[n].gridcount, argv[1]);
+			return 1;
+		}
+
+		//if every frame is written
+		if(target < 0)
+		{
+			//write the raster of the frame (name.gridcount)
+			sprintf(rastername, "%s.%d", basename, pack.frames[n].gridcount);
+			raster_fp = fopen(rastername, "w");
+
+			if(raster_fp == NULL)
+			{
+				fprintf(stderr, "trexunpack: can't create raster %s\n", rastername);
+				return 1;
+			}
+
+			WriteRaster(&pack, bits, raster_fp);
+			fclose(raster_fp);
+		}
+		else if(n == target)	//else if this is the frame to write
+		{
+			//write the raster to the raster file or the screen
+			raster_fp = (argc == 4) ? fopen(argv[3], "w") : stdout;
+
+			if(raster_fp == NULL)
+			{
+				fprintf(stderr, "trexunpack: can't create raster %s\n", argv[3]);
+				return 1;
+			}
+
+			WriteRaster(&pack, bits, raster_fp);
+
+			if(raster_fp != stdout)
+			{
+				fclose(raster_fp);
+			}
+
+		}	//end if target < 0
+
+	}	//end loop over frames
+
+	fclose(pack.fp);
+
+	//End of Main Program
+	return 0;
+}
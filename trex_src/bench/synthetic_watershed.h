@@ -0,0 +1,55 @@
+/*----------------------------------------------------------------------
+C-  Header:     synthetic_watershed.h
+C-
+C-	Purpose/	Interface of the synthetic watershed generator used by
+C-	Methods:	the benchmark driver (trexbench).  The generator writes
+C-              a complete TREX input deck for a rectangular watershed
+C-              of any size: mask, elevation, soils, land use, a
+C-              channel network (main stem and tributary links), rain
+C-              gages, and (for ksim > 1) solids and chemicals.
+C-
+C-	Created:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revised:
+C-
+C-	Date:
+C-
+C-	Revisions:
+C-
+C---------------------------------------------------------------------*/
+
+#ifndef SYNTHETIC_WATERSHED_H
+#define SYNTHETIC_WATERSHED_H
+
+//name of the input file written by WriteSyntheticDeck
+#define SYNTHETICINPUTFILE "bench.inp"
+
+//synthetic watershed description (set the controls, the counts are computed)
+typedef struct
+{
+	//controls (set by the caller)
+	int nrows;			//number of grid rows
+	int ncols;			//number of grid columns
+	int ksim;			//simulation type (1 = water, 2 = solids, 3 = chemicals)
+	int ntribs;			//number of tributary links joining the main stem
+	int ngages;			//number of rain gages (1 = uniform rainfall, > 1 = IDW)
+	int nchems;			//number of chemicals (ksim = 3)
+	float dx;			//grid cell size (m)
+	float dt;			//time step (seconds)
+	float hours;		//simulation duration (hours)
+
+	//counts (computed by WriteSyntheticDeck)
+	int ncells;			//number of cells in the domain
+	int nlinks;			//number of channel links
+	int nchnodes;		//number of channel nodes
+
+} SyntheticDeck;
+
+//Write all input files of the synthetic watershed to the current directory.
+//Returns 0 on success or -1 if the controls are not valid (a message is
+//written to the screen).  File errors abort the program.
+extern int WriteSyntheticDeck(SyntheticDeck *deck);
+
+#endif	//SYNTHETIC_WATERSHED_H
@@ -0,0 +1,1032 @@
+/*----------------------------------------------------------------------
+C-  File:       BatchMath.c
+C-
+C-  Purpose/    Concatenated group of functions for batch evaluation
+C-  Methods:    of the power laws of the transport kernels: Manning
+C-              resistance in OverlandWaterRoute (depth^1.667 and
+C-              slope^0.5) and ChannelWaterRoute (radius^0.6667) and
+C-              the generalized transport capacity in
+C-              OverlandSolidsTransportCapacity ((q-qc)^betasov and
+C-              sf^gammasov).  The kernels gather the bases of up to
+C-              POWBATCHSIZE faces into a buffer and evaluate all of
+C-              the powers with one call.
+C-
+C-              A batch power is computed as exp(e * log(x)) in double
+C-              precision using the argument reductions and polynomials
+C-              of the fdlibm log and exp functions.  The same sequence
+C-              of operations is coded for AVX-512 (eight values at a
+C-              time), AVX2 (four values at a time), and scalar
+C-              instructions (other processors and the remainder of a
+C-              batch), so all instruction sets give the same results.
+C-              Bases that are not positive normal numbers and powers
+C-              that would overflow or underflow (|e * ln(x)| > 708)
+C-              are evaluated by libm pow.
+C-
+C-              Accuracy: the relative error of a batch power is less
+C-              than (2 + |e * ln(x)|) * 2^-53 (measured: 32 double
+C-              ulp at most for bases from 1e-7 to 100 and exponents
+C-              up to 2).  The kernels round their results to float
+C-              (2^-24), so a batch result differs from the libm result
+C-              only when the two fall on opposite sides of a float
+C-              rounding boundary (by 1 float ulp).  Multiplies and
+C-              adds are never fused, so the results do not depend on
+C-              the instruction set.
+C-
+C-              Exponents that are constant for the run are specialized
+C-              at initialization (a power plan): 0.5 is a square root
+C-              and 1.0 is a copy.  The land use exponents of transport
+C-              capacity share one plan when they are the same for all
+C-              land uses; otherwise each value carries its exponent.
+C-
+C-              With powmode = POWLIBM every power is evaluated by libm
+C-              pow, which reproduces the results of the scalar kernels
+C-              bit for bit (validation mode).
+C-
+C-              The SIMD code is compiled for gcc and clang on x86
+C-              processors (define NOSIMD to build the scalar code
+C-              only) and selected at run time from the processor
+C-              features.
+C-
+C-  Function
+C-   Listing:   InitializeBatchMath, PowModeId, PowModeName, BatchPow,
+C-              BatchPowArray, PowValue, BatchSqrt
+C-
+C-  Inputs:     powmode, betasov[], gammasov[] (Globals)
+C-
+C-  Outputs:    powisa, powplanovdepth, powplanovslope,
+C-              powplanchradius, powplanbetaov, powplangammaov
+C-
+C-  Controls:   powmode, ksim
+C-
+C-  Calls:      pow, sqrt
+C-
+C-  Called by:  Initialize, OverlandWaterRoute, ChannelWaterRoute,
+C-              OverlandSolidsTransportCapacity, Infiltration,
+C-              TrexSetPowMode
+C-
+C-  Created:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Added BatchSqrt (square roots of a batch with the
+C-              selected instruction set, identical to libm sqrt).
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Output files are opened by OpenOutputFile.
+C-
+C-  Revised:
+C-
+C-  Date:
+C-
+C-  Revisions:
+C-
+C----------------------------------------------------------------------*/
+
+//trex general variable declarations
+#include "trex_general_declarations.h"
+
+//trex global variable declarations for water transport
+#include "trex_water_declarations.h"
+
+//trex global variable declarations for sediment transport
+#include "trex_solids_declarations.h"
+
+//SIMD instruction sets (gcc and clang on x86 processors)
+#if !defined(NOSIMD) && (defined(__GNUC__) || defined(__clang__)) \
+	&& (defined(__x86_64__) || defined(__i386__)) \
+	&& !defined(__INTEL_COMPILER) && !defined(__PGI)
+#define BATCHSIMD
+#include <immintrin.h>	//x86 SIMD intrinsics
+#endif
+
+//Multiplies and adds are not contracted to fused multiply-adds, so all of the
+//instruction sets round the same operations (the same results)
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__) && !defined(__INTEL_COMPILER) && !defined(__PGI)
+#pragma GCC optimize ("fp-contract=off")
+#endif
+
+//Kinds of power plans
+#define POWGENERAL 0	//x^e = exp(e * log(x))
+#define POWSQRT 1		//x^0.5 = sqrt(x)
+#define POWONE 2		//x^1 = x
+
+//Maximum number of power plans
+#define POWMAXPLANS 8
+
+//Constants of the log and exp reductions and polynomials (fdlibm)
+#define POWLN2HI 6.93147180369123816490e-01		//high part of ln(2)
+#define POWLN2LO 1.90821492927058770002e-10		//low part of ln(2)
+#define POWINVLN2 1.44269504088896338700e+00	//1/ln(2)
+#define POWSQRT2 1.41421356237309514547e+00		//sqrt(2)
+#define POWLG1 6.666666666666735130e-01			//log polynomial coefficients
+#define POWLG2 3.999999999940941908e-01
+#define POWLG3 2.857142874366239149e-01
+#define POWLG4 2.222219843214978396e-01
+#define POWLG5 1.818357216161805012e-01
+#define POWLG6 1.531383769920937332e-01
+#define POWLG7 1.479819860511658591e-01
+#define POWP1 1.66666666666666019037e-01		//exp polynomial coefficients
+#define POWP2 -2.77777777770155933842e-03
+#define POWP3 6.61375632143793436117e-05
+#define POWP4 -1.65339022054652515390e-06
+#define POWP5 4.13813679705723846039e-08
+#define POWMAXY 708.0							//largest |e * ln(x)| of a batch power
+#define POWMAGIC 6755399441055744.0				//1.5 * 2^52 (rounds to an integer when added)
+#define POWMAGIC52 4503599627370496.0			//2^52 (integer bits of a double when or'ed)
+#define POWBIAS 4503599627371519.0				//2^52 + 1023 (exponent bias)
+#define POWMANTISSA 0x000fffffffffffffULL		//mantissa bits of a double
+#define POWONEBITS 0x3ff0000000000000ULL		//bits of 1.0
+
+static double
+	planexponent[POWMAXPLANS];	//exponent of each power plan
+
+static int
+	plankind[POWMAXPLANS],		//kind of each power plan (POWGENERAL, POWSQRT, POWONE)
+	nplans;						//number of power plans
+
+static char
+	*powmodename[5] =			//power law evaluation mode names (by mode number)
+	{
+		"batch",
+		"libm",
+		"scalar",
+		"avx2",
+		"avx512"
+	};
+
+//C
+//C
+			/*******************************************/
+			/*         FUNCTION: PowPlan               */
+			/*******************************************/
+
+/* Returns the power plan of a constant exponent (specialized by value) */
+
+static int PowPlan(double exponent)
+{
+	//local variable declarations
+	int
+		plan;	//power plan index
+
+	//loop over existing plans
+	for(plan=0; plan<nplans; plan++)
+	{
+		//if the plan has the same exponent
+		if(planexponent[plan] == exponent)
+		{
+			//return the existing plan
+			return plan;
+		}
+
+	}	//end loop over existing plans
+
+	//if the plan table is full
+	if(nplans >= POWMAXPLANS)
+	{
+		//Write error message to screen
+		printf("Error! Too many power plans (maximum = %d)\n", POWMAXPLANS);
+		exit(EXIT_FAILURE);	//abort
+	}
+
+	//store the exponent of the new plan
+	planexponent[nplans] = exponent;
+
+	//if the exponent is one half
+	if(exponent == 0.5)
+	{
+		//the power is a square root
+		plankind[nplans] = POWSQRT;
+	}
+	else if(exponent == 1.0)	//else if the exponent is one
+	{
+		//the power is a copy
+		plankind[nplans] = POWONE;
+	}
+	else	//else the exponent is general
+	{
+		//the power is exp(e * log(x))
+		plankind[nplans] = POWGENERAL;
+
+	}	//end if exponent == 0.5
+
+	//count the plan
+	nplans = nplans + 1;
+
+	//return the new plan
+	return nplans - 1;
+
+//end of function PowPlan
+}
+
+//C
+//C
+			/*******************************************/
+			/*         FUNCTION: PowScalar             */
+			/*******************************************/
+
+/* Returns x^e computed with scalar instructions (same operations as the SIMD code) */
+
+static double PowScalar(double x, double e)
+{
+	//local variable declarations
+	unsigned long long
+		bits,		//bits of a double
+		kbits;		//bits of the power of two of the result
+
+	double
+		m,			//mantissa of x (sqrt(2)/2 <= m < sqrt(2))
+		kd,			//exponent of x (x = m * 2^kd)
+		f,			//m - 1
+		s,			//f / (2 + f)
+		z,			//s^2
+		w4,			//s^4
+		r,			//log polynomial (or reduced exp argument)
+		hfsq,		//f^2 / 2
+		logx,		//ln(x)
+		y,			//e * ln(x)
+		kn,			//y / ln(2) rounded to an integer
+		hi,			//high part of the reduced exp argument
+		lo,			//low part of the reduced exp argument
+		t,			//r^2
+		c,			//exp polynomial
+		result;		//x^e
+
+	//if x is not a positive normal number
+	if(!(x >= DBL_MIN && x <= DBL_MAX))
+	{
+		//use libm
+		return pow(x, e);
+	}
+
+	//split x into exponent and mantissa (1 <= m < 2)
+	memcpy(&bits, &x, sizeof(double));
+	kbits = (bits >> 52) | 0x4330000000000000ULL;
+	memcpy(&kd, &kbits, sizeof(double));
+	kd = kd - POWBIAS;
+	bits = (bits & POWMANTISSA) | POWONEBITS;
+	memcpy(&m, &bits, sizeof(double));
+
+	//if the mantissa is above sqrt(2)
+	if(m > POWSQRT2)
+	{
+		//reduce the mantissa to sqrt(2)/2 <= m < 1
+		m = m * 0.5;
+		kd = kd + 1.0;
+	}
+
+	//log of x
+	f = m - 1.0;
+	s = f / (2.0 + f);
+	z = s * s;
+	w4 = z * z;
+	r = z * (POWLG1 + w4 * (POWLG3 + w4 * (POWLG5 + w4 * POWLG7)))
+		+ w4 * (POWLG2 + w4 * (POWLG4 + w4 * POWLG6));
+	hfsq = 0.5 * f * f;
+	logx = kd * POWLN2HI - ((hfsq - (s * (hfsq + r) + kd * POWLN2LO)) - f);
+
+	//exponent times log of x
+	y = e * logx;
+
+	//if the power would overflow or underflow
+	if(!(fabs(y) <= POWMAXY))
+	{
+		//use libm
+		return pow(x, e);
+	}
+
+	//exp of y = 2^kn * exp(r) (|r| <= ln(2)/2)
+	kn = y * POWINVLN2 + POWMAGIC;
+	memcpy(&kbits, &kn, sizeof(double));
+	kbits = kbits - 0x4338000000000000ULL;
+	kn = kn - POWMAGIC;
+	hi = y - kn * POWLN2HI;
+	lo = kn * POWLN2LO;
+	r = hi - lo;
+	t = r * r;
+	c = r - t * (POWP1 + t * (POWP2 + t * (POWP3 + t * (POWP4 + t * POWP5))));
+	result = 1.0 - ((lo - (r * c) / (2.0 - c)) - hi);
+
+	//scale by 2^kn
+	memcpy(&bits, &result, sizeof(double));
+	bits = bits + (kbits << 52);
+	memcpy(&result, &bits, sizeof(double));
+
+	//return x^e
+	return result;
+
+//end of function PowScalar
+}
+
+//C
+//C
+			/*******************************************/
+			/*         FUNCTION: SqrtScalar            */
+			/*******************************************/
+
+/* Returns x^0.5 computed with scalar instructions */
+
+static double SqrtScalar(double x)
+{
+	//if x is not a positive normal number
+	if(!(x >= DBL_MIN && x <= DBL_MAX))
+	{
+		//use libm
+		return pow(x, 0.5);
+	}
+
+	//return the square root
+	return sqrt(x);
+
+//end of function SqrtScalar
+}
+
+#ifdef BATCHSIMD
+//C
+//C
+			/*******************************************/
+			/*         FUNCTION: BatchPowAVX2          */
+			/*******************************************/
+
+/* Computes x[i]^e[i] (or x[i]^exponent if e = NULL) four values at a time (returns the count done) */
+
+__attribute__((target("avx2")))
+static int BatchPowAVX2(double *x, double *e, double exponent, int n, int kind)
+{
+	//local variable declarations
+	int
+		ibatch,		//index of the first value of four
+		lane,		//lane index
+		valid;		//mask of the lanes computed in SIMD
+
+	__m256d
+		vx, ve, m, kd, f, s, z, w4, r, hfsq, logx, y, kn, hi, lo, t, c, result, ok, big;
+
+	__m256i
+		bits, kbits;
+
+	//loop over groups of four values
+	for(ibatch=0; ibatch+4<=n; ibatch=ibatch+4)
+	{
+		//load the bases
+		vx = _mm256_loadu_pd(&x[ibatch]);
+
+		//lanes with a positive normal base
+		ok = _mm256_and_pd(_mm256_cmp_pd(vx, _mm256_set1_pd(DBL_MIN), _CMP_GE_OQ),
+			_mm256_cmp_pd(vx, _mm256_set1_pd(DBL_MAX), _CMP_LE_OQ));
+
+		//if the power is a square root
+		if(kind == POWSQRT)
+		{
+			//square root
+			result = _mm256_sqrt_pd(vx);
+		}
+		else	//else the power is general
+		{
+			//load the exponents
+			ve = (e != NULL) ? _mm256_loadu_pd(&e[ibatch]) : _mm256_set1_pd(exponent);
+
+			//replace bases that are not valid by 1.0 (recomputed below)
+			vx = _mm256_blendv_pd(_mm256_set1_pd(1.0), vx, ok);
+
+			//split x into exponent and mantissa (1 <= m < 2)
+			bits = _mm256_castpd_si256(vx);
+			kbits = _mm256_or_si256(_mm256_srli_epi64(bits, 52), _mm256_castpd_si256(_mm256_set1_pd(POWMAGIC52)));
+			kd = _mm256_sub_pd(_mm256_castsi256_pd(kbits), _mm256_set1_pd(POWBIAS));
+			bits = _mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi64x((long long)POWMANTISSA)),
+				_mm256_set1_epi64x((long long)POWONEBITS));
+			m = _mm256_castsi256_pd(bits);
+
+			//reduce mantissas above sqrt(2) to sqrt(2)/2 <= m < 1
+			big = _mm256_cmp_pd(m, _mm256_set1_pd(POWSQRT2), _CMP_GT_OQ);
+			m = _mm256_blendv_pd(m, _mm256_mul_pd(m, _mm256_set1_pd(0.5)), big);
+			kd = _mm256_add_pd(kd, _mm256_and_pd(big, _mm256_set1_pd(1.0)));
+
+			//log of x
+			f = _mm256_sub_pd(m, _mm256_set1_pd(1.0));
+			s = _mm256_div_pd(f, _mm256_add_pd(_mm256_set1_pd(2.0), f));
+			z = _mm256_mul_pd(s, s);
+			w4 = _mm256_mul_pd(z, z);
+			r = _mm256_add_pd(
+				_mm256_mul_pd(z, _mm256_add_pd(_mm256_set1_pd(POWLG1), _mm256_mul_pd(w4,
+					_mm256_add_pd(_mm256_set1_pd(POWLG3), _mm256_mul_pd(w4,
+					_mm256_add_pd(_mm256_set1_pd(POWLG5), _mm256_mul_pd(w4, _mm256_set1_pd(POWLG7)))))))),
+				_mm256_mul_pd(w4, _mm256_add_pd(_mm256_set1_pd(POWLG2), _mm256_mul_pd(w4,
+					_mm256_add_pd(_mm256_set1_pd(POWLG4), _mm256_mul_pd(w4, _mm256_set1_pd(POWLG6)))))));
+			hfsq = _mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(0.5), f), f);
+			logx = _mm256_sub_pd(_mm256_mul_pd(kd, _mm256_set1_pd(POWLN2HI)),
+				_mm256_sub_pd(_mm256_sub_pd(hfsq, _mm256_add_pd(_mm256_mul_pd(s, _mm256_add_pd(hfsq, r)),
+				_mm256_mul_pd(kd, _mm256_set1_pd(POWLN2LO)))), f));
+
+			//exponent times log of x
+			y = _mm256_mul_pd(ve, logx);
+
+			//lanes that would overflow or underflow are not valid
+			ok = _mm256_and_pd(ok, _mm256_cmp_pd(_mm256_andnot_pd(_mm256_set1_pd(-0.0), y),
+				_mm256_set1_pd(POWMAXY), _CMP_LE_OQ));
+
+			//exp of y = 2^kn * exp(r) (|r| <= ln(2)/2)
+			kn = _mm256_add_pd(_mm256_mul_pd(y, _mm256_set1_pd(POWINVLN2)), _mm256_set1_pd(POWMAGIC));
+			kbits = _mm256_sub_epi64(_mm256_castpd_si256(kn), _mm256_castpd_si256(_mm256_set1_pd(POWMAGIC)));
+			kn = _mm256_sub_pd(kn, _mm256_set1_pd(POWMAGIC));
+			hi = _mm256_sub_pd(y, _mm256_mul_pd(kn, _mm256_set1_pd(POWLN2HI)));
+			lo = _mm256_mul_pd(kn, _mm256_set1_pd(POWLN2LO));
+			r = _mm256_sub_pd(hi, lo);
+			t = _mm256_mul_pd(r, r);
+			c = _mm256_sub_pd(r, _mm256_mul_pd(t, _mm256_add_pd(_mm256_set1_pd(POWP1), _mm256_mul_pd(t,
+				_mm256_add_pd(_mm256_set1_pd(POWP2), _mm256_mul_pd(t,
+				_mm256_add_pd(_mm256_set1_pd(POWP3), _mm256_mul_pd(t,
+				_mm256_add_pd(_mm256_set1_pd(POWP4), _mm256_mul_pd(t, _mm256_set1_pd(POWP5)))))))))));
+			result = _mm256_sub_pd(_mm256_set1_pd(1.0), _mm256_sub_pd(_mm256_sub_pd(lo,
+				_mm256_div_pd(_mm256_mul_pd(r, c), _mm256_sub_pd(_mm256_set1_pd(2.0), c))), hi));
+
+			//scale by 2^kn
+			result = _mm256_castsi256_pd(_mm256_add_epi64(_mm256_castpd_si256(result), _mm256_slli_epi64(kbits, 52)));
+
+		}	//end if kind == POWSQRT
+
+		//mask of the valid lanes
+		valid = _mm256_movemask_pd(ok);
+
+		//if any lane is not valid
+		if(valid != 0xf)
+		{
+			//store the results
+			_mm256_storeu_pd(&x[ibatch], _mm256_blendv_pd(_mm256_loadu_pd(&x[ibatch]), result, ok));
+
+			//loop over lanes
+			for(lane=0; lane<4; lane++)
+			{
+				//if the lane is not valid
+				if(!(valid & (1 << lane)))
+				{
+					//use libm
+					x[ibatch+lane] = pow(x[ibatch+lane], (e != NULL) ? e[ibatch+lane] : exponent);
+				}
+
+			}	//end loop over lanes
+		}
+		else	//else all lanes are valid
+		{
+			//store the results
+			_mm256_storeu_pd(&x[ibatch], result);
+
+		}	//end if valid != 0xf
+
+	}	//end loop over groups of four values
+
+	//return the number of values computed
+	return ibatch;
+
+//end of function BatchPowAVX2
+}
+
+//C
+//C
+			/*******************************************/
+			/*         FUNCTION: BatchPowAVX512        */
+			/*******************************************/
+
+/* Computes x[i]^e[i] (or x[i]^exponent if e = NULL) eight values at a time (returns the count done) */
+
+__attribute__((target("avx512f")))
+static int BatchPowAVX512(double *x, double *e, double exponent, int n, int kind)
+{
+	//local variable declarations
+	int
+		ibatch,		//index of the first value of eight
+		lane;		//lane index
+
+	__mmask8
+		ok,			//mask of the lanes computed in SIMD
+		big;		//mask of the lanes with a mantissa above sqrt(2)
+
+	__m512d
+		vx, ve, m, kd, f, s, z, w4, r, hfsq, logx, y, kn, hi, lo, t, c, result;
+
+	__m512i
+		bits, kbits;
+
+	//loop over groups of eight values
+	for(ibatch=0; ibatch+8<=n; ibatch=ibatch+8)
+	{
+		//load the bases
+		vx = _mm512_loadu_pd(&x[ibatch]);
+
+		//lanes with a positive normal base
+		ok = _mm512_cmp_pd_mask(vx, _mm512_set1_pd(DBL_MIN), _CMP_GE_OQ)
+			& _mm512_cmp_pd_mask(vx, _mm512_set1_pd(DBL_MAX), _CMP_LE_OQ);
+
+		//if the power is a square root
+		if(kind == POWSQRT)
+		{
+			//square root
+			result = _mm512_sqrt_pd(vx);
+		}
+		else	//else the power is general
+		{
+			//load the exponents
+			ve = (e != NULL) ? _mm512_loadu_pd(&e[ibatch]) : _mm512_set1_pd(exponent);
+
+			//replace bases that are not valid by 1.0 (recomputed below)
+			vx = _mm512_mask_blend_pd(ok, _mm512_set1_pd(1.0), vx);
+
+			//split x into exponent and mantissa (1 <= m < 2)
+			bits = _mm512_castpd_si512(vx);
+			kbits = _mm512_or_si512(_mm512_srli_epi64(bits, 52), _mm512_castpd_si512(_mm512_set1_pd(POWMAGIC52)));
+			kd = _mm512_sub_pd(_mm512_castsi512_pd(kbits), _mm512_set1_pd(POWBIAS));
+			bits = _mm512_or_si512(_mm512_and_si512(bits, _mm512_set1_epi64((long long)POWMANTISSA)),
+				_mm512_set1_epi64((long long)POWONEBITS));
+			m = _mm512_castsi512_pd(bits);
+
+			//reduce mantissas above sqrt(2) to sqrt(2)/2 <= m < 1
+			big = _mm512_cmp_pd_mask(m, _mm512_set1_pd(POWSQRT2), _CMP_GT_OQ);
+			m = _mm512_mask_blend_pd(big, m, _mm512_mul_pd(m, _mm512_set1_pd(0.5)));
+			kd = _mm512_mask_blend_pd(big, kd, _mm512_add_pd(kd, _mm512_set1_pd(1.0)));
+
+			//log of x
+			f = _mm512_sub_pd(m, _mm512_set1_pd(1.0));
+			s = _mm512_div_pd(f, _mm512_add_pd(_mm512_set1_pd(2.0), f));
+			z = _mm512_mul_pd(s, s);
+			w4 = _mm512_mul_pd(z, z);
+			r = _mm512_add_pd(
+				_mm512_mul_pd(z, _mm512_add_pd(_mm512_set1_pd(POWLG1), _mm512_mul_pd(w4,
+					_mm512_add_pd(_mm512_set1_pd(POWLG3), _mm512_mul_pd(w4,
+					_mm512_add_pd(_mm512_set1_pd(POWLG5), _mm512_mul_pd(w4, _mm512_set1_pd(POWLG7)))))))),
+				_mm512_mul_pd(w4, _mm512_add_pd(_mm512_set1_pd(POWLG2), _mm512_mul_pd(w4,
+					_mm512_add_pd(_mm512_set1_pd(POWLG4), _mm512_mul_pd(w4, _mm512_set1_pd(POWLG6)))))));
+			hfsq = _mm512_mul_pd(_mm512_mul_pd(_mm512_set1_pd(0.5), f), f);
+			logx = _mm512_sub_pd(_mm512_mul_pd(kd, _mm512_set1_pd(POWLN2HI)),
+				_mm512_sub_pd(_mm512_sub_pd(hfsq, _mm512_add_pd(_mm512_mul_pd(s, _mm512_add_pd(hfsq, r)),
+				_mm512_mul_pd(kd, _mm512_set1_pd(POWLN2LO)))), f));
+
+			//exponent times log of x
+			y = _mm512_mul_pd(ve, logx);
+
+			//lanes that would overflow or underflow are not valid
+			ok = ok & _mm512_cmp_pd_mask(_mm512_abs_pd(y), _mm512_set1_pd(POWMAXY), _CMP_LE_OQ);
+
+			//exp of y = 2^kn * exp(r) (|r| <= ln(2)/2)
+			kn = _mm512_add_pd(_mm512_mul_pd(y, _mm512_set1_pd(POWINVLN2)), _mm512_set1_pd(POWMAGIC));
+			kbits = _mm512_sub_epi64(_mm512_castpd_si512(kn), _mm512_castpd_si512(_mm512_set1_pd(POWMAGIC)));
+			kn = _mm512_sub_pd(kn, _mm512_set1_pd(POWMAGIC));
+			hi = _mm512_sub_pd(y, _mm512_mul_pd(kn, _mm512_set1_pd(POWLN2HI)));
+			lo = _mm512_mul_pd(kn, _mm512_set1_pd(POWLN2LO));
+			r = _mm512_sub_pd(hi, lo);
+			t = _mm512_mul_pd(r, r);
+			c = _mm512_sub_pd(r, _mm512_mul_pd(t, _mm512_add_pd(_mm512_set1_pd(POWP1), _mm512_mul_pd(t,
+				_mm512_add_pd(_mm512_set1_pd(POWP2), _mm512_mul_pd(t,
+				_mm512_add_pd(_mm512_set1_pd(POWP3), _mm512_mul_pd(t,
+				_mm512_add_pd(_mm512_set1_pd(POWP4), _mm512_mul_pd(t, _mm512_set1_pd(POWP5)))))))))));
+			result = _mm512_sub_pd(_mm512_set1_pd(1.0), _mm512_sub_pd(_mm512_sub_pd(lo,
+				_mm512_div_pd(_mm512_mul_pd(r, c), _mm512_sub_pd(_mm512_set1_pd(2.0), c))), hi));
+
+			//scale by 2^kn
+			result = _mm512_castsi512_pd(_mm512_add_epi64(_mm512_castpd_si512(result), _mm512_slli_epi64(kbits, 52)));
+
+		}	//end if kind == POWSQRT
+
+		//store the results of the valid lanes
+		_mm512_mask_storeu_pd(&x[ibatch], ok, result);
+
+		//if any lane is not valid
+		if(ok != 0xff)
+		{
+			//loop over lanes
+			for(lane=0; lane<8; lane++)
+			{
+				//if the lane is not valid
+				if(!(ok & (1 << lane)))
+				{
+					//use libm
+					x[ibatch+lane] = pow(x[ibatch+lane], (e != NULL) ? e[ibatch+lane] : exponent);
+				}
+
+			}	//end loop over lanes
+
+		}	//end if ok != 0xff
+
+	}	//end loop over groups of eight values
+
+	//return the number of values computed
+	return ibatch;
+
+//end of function BatchPowAVX512
+}
+
+//C
+//C
+			/*******************************************/
+			/*         FUNCTION: BatchSqrtAVX2         */
+			/*******************************************/
+
+/* Computes sqrt(x[i]) four values at a time (returns the count done) */
+
+__attribute__((target("avx2")))
+static int BatchSqrtAVX2(double *x, int n)
+{
+	//local variable declarations
+	int
+		ibatch;		//index of the first value of four
+
+	//loop over groups of four values
+	for(ibatch=0; ibatch+4<=n; ibatch=ibatch+4)
+	{
+		//square root (correctly rounded, the same as libm sqrt)
+		_mm256_storeu_pd(&x[ibatch], _mm256_sqrt_pd(_mm256_loadu_pd(&x[ibatch])));
+
+	}	//end loop over groups of four values
+
+	//return the number of values computed
+	return ibatch;
+
+//end of function BatchSqrtAVX2
+}
+
+//C
+//C
+			/*******************************************/
+			/*         FUNCTION: BatchSqrtAVX512       */
+			/*******************************************/
+
+/* Computes sqrt(x[i]) eight values at a time (returns the count done) */
+
+__attribute__((target("avx512f")))
+static int BatchSqrtAVX512(double *x, int n)
+{
+	//local variable declarations
+	int
+		ibatch;		//index of the first value of eight
+
+	//loop over groups of eight values
+	for(ibatch=0; ibatch+8<=n; ibatch=ibatch+8)
+	{
+		//square root (correctly rounded, the same as libm sqrt)
+		_mm512_storeu_pd(&x[ibatch], _mm512_sqrt_pd(_mm512_loadu_pd(&x[ibatch])));
+
+	}	//end loop over groups of eight values
+
+	//return the number of values computed
+	return ibatch;
+
+//end of function BatchSqrtAVX512
+}
+#endif	//BATCHSIMD
+
+//C
+//C
+			/*******************************************/
+			/*         FUNCTION: BatchPowValues        */
+			/*******************************************/
+
+/* Computes x[i]^e[i] (or x[i]^exponent if e = NULL) in place with the selected instruction set */
+
+static void BatchPowValues(double *x, double *e, double exponent, int n, int kind)
+{
+	//local variable declarations
+	int
+		ivalue;		//value index
+
+	//if the power is a copy (x^1)
+	if(kind == POWONE)
+	{
+		//nothing to do
+		return;
+	}
+
+	//if libm is selected (validation mode)
+	if(powisa == POWLIBM)
+	{
+		//loop over values
+		for(ivalue=0; ivalue<n; ivalue++)
+		{
+			//libm power
+			x[ivalue] = pow(x[ivalue], (e != NULL) ? e[ivalue] : exponent);
+		}
+
+		//all values are computed
+		return;
+
+	}	//end if powisa == POWLIBM
+
+	//start with the first value
+	ivalue = 0;
+
+#ifdef BATCHSIMD
+	//if AVX-512 is selected
+	if(powisa == POWAVX512)
+	{
+		//compute groups of eight values
+		ivalue = BatchPowAVX512(x, e, exponent, n, kind);
+	}
+	else if(powisa == POWAVX2)	//else if AVX2 is selected
+	{
+		//compute groups of four values
+		ivalue = BatchPowAVX2(x, e, exponent, n, kind);
+
+	}	//end if powisa == POWAVX512
+#endif
+
+	//loop over the remaining values (scalar instructions)
+	for(; ivalue<n; ivalue++)
+	{
+		//if the power is a square root
+		if(kind == POWSQRT)
+		{
+			x[ivalue] = SqrtScalar(x[ivalue]);
+		}
+		else	//else the power is general
+		{
+			x[ivalue] = PowScalar(x[ivalue], (e != NULL) ? e[ivalue] : exponent);
+
+		}	//end if kind == POWSQRT
+
+	}	//end loop over remaining values
+
+//end of function BatchPowValues
+}
+
+//C
+//C
+			/*******************************************/
+			/*         FUNCTION: InitializeBatchMath   */
+			/*******************************************/
+
+/* Selects the instruction set and specializes the constant exponents (power plans) */
+
+void InitializeBatchMath()
+{
+	//local variable declarations
+	int
+		iland;	//loop index for land use classes
+
+	//select the instruction set for the requested mode
+	powisa = powmode;
+
+	//if the widest instruction set of the processor is requested
+	if(powisa == POWBATCH)
+	{
+		//start from scalar instructions
+		powisa = POWSCALAR;
+
+#ifdef BATCHSIMD
+		//detect the processor features
+		__builtin_cpu_init();
+
+		//if the processor has AVX-512
+		if(__builtin_cpu_supports("avx512f"))
+		{
+			powisa = POWAVX512;
+		}
+		else if(__builtin_cpu_supports("avx2"))	//else if the processor has AVX2
+		{
+			powisa = POWAVX2;
+
+		}	//end if the processor has AVX-512
+#endif
+	}
+	else if(powisa == POWAVX512 || powisa == POWAVX2)	//else if an instruction set is requested
+	{
+#ifdef BATCHSIMD
+		//detect the processor features
+		__builtin_cpu_init();
+
+		//if the processor does not have the requested instruction set
+		if((powisa == POWAVX512 && !__builtin_cpu_supports("avx512f"))
+			|| (powisa == POWAVX2 && !__builtin_cpu_supports("avx2")))
+#endif
+		{
+			//Write message to screen
+			printf("Warning! Power law mode %s is not available: scalar batch math is used\n",
+				powmodename[powisa]);
+
+			//use scalar instructions
+			powisa = POWSCALAR;
+		}
+
+	}	//end if powisa == POWBATCH
+
+	//clear the power plans
+	nplans = 0;
+
+	//Manning resistance exponents (OverlandWaterRoute, ChannelWaterRoute)
+	powplanovdepth = PowPlan(1.667);
+	powplanovslope = PowPlan(0.5);
+	powplanchradius = PowPlan(0.6667);
+
+	//initialize the transport capacity plans (-1 = exponent varies by land use)
+	powplanbetaov = -1;
+	powplangammaov = -1;
+
+	//if solids are simulated
+	if(ksim > 1)
+	{
+		//start with the exponents of the first land use
+		powplanbetaov = 1;
+		powplangammaov = 1;
+
+		//loop over land uses
+		for(iland=2; iland<=nlands; iland++)
+		{
+			//if the unit flow exponent differs from the first land use
+			if(betasov[iland] != betasov[1])
+			{
+				//exponents vary
+				powplanbetaov = -1;
+			}
+
+			//if the friction slope exponent differs from the first land use
+			if(gammasov[iland] != gammasov[1])
+			{
+				//exponents vary
+				powplangammaov = -1;
+			}
+
+		}	//end loop over land uses
+
+		//if the unit flow exponent is the same for all land uses
+		if(powplanbetaov > 0)
+		{
+			//specialize the exponent
+			powplanbetaov = PowPlan(betasov[1]);
+		}
+
+		//if the friction slope exponent is the same for all land uses
+		if(powplangammaov > 0)
+		{
+			//specialize the exponent
+			powplangammaov = PowPlan(gammasov[1]);
+		}
+
+	}	//end if ksim > 1
+
+	//Write the selected mode to the echo file
+	echofile_fp = OpenOutputFile(echofile, "a");
+
+	//if the echo file was opened
+	if(echofile_fp != NULL)
+	{
+		fprintf(echofile_fp, "\n\nPower law evaluation:  %s\n", powmodename[powisa]);
+		fclose(echofile_fp);
+	}
+
+//end of function InitializeBatchMath
+}
+
+//C
+//C
+			/*******************************************/
+			/*         FUNCTION: PowModeId             */
+			/*******************************************/
+
+/* Returns the power law evaluation mode of a name (-1 = not a mode) */
+
+int PowModeId(char *name)
+{
+	//local variable declarations
+	int
+		mode;	//mode number
+
+	//loop over modes
+	for(mode=POWBATCH; mode<=POWAVX512; mode++)
+	{
+		//if the name matches
+		if(strcmp(name, powmodename[mode]) == 0)
+		{
+			//return the mode number
+			return mode;
+		}
+
+	}	//end loop over modes
+
+	//the name is not a mode
+	return -1;
+
+//end of function PowModeId
+}
+
+//C
+//C
+			/*******************************************/
+			/*         FUNCTION: PowModeName           */
+			/*******************************************/
+
+/* Returns the name of a power law evaluation mode (empty string if not a mode) */
+
+char *PowModeName(int mode)
+{
+	//if the mode is not valid
+	if(mode < POWBATCH || mode > POWAVX512)
+	{
+		return "";
+	}
+
+	//return the mode name
+	return powmodename[mode];
+
+//end of function PowModeName
+}
+
+//C
+//C
+			/*******************************************/
+			/*         FUNCTION: BatchPow              */
+			/*******************************************/
+
+/* Computes x[i]^exponent of a power plan for n values (in place) */
+
+void BatchPow(double *x, int n, int plan)
+{
+	//compute the powers
+	BatchPowValues(x, NULL, planexponent[plan], n, plankind[plan]);
+
+//end of function BatchPow
+}
+
+//C
+//C
+			/*******************************************/
+			/*         FUNCTION: BatchPowArray         */
+			/*******************************************/
+
+/* Computes x[i]^e[i] for n values (in place) */
+
+void BatchPowArray(double *x, double *e, int n)
+{
+	//compute the powers
+	BatchPowValues(x, e, 0.0, n, POWGENERAL);
+
+//end of function BatchPowArray
+}
+
+//C
+//C
+			/*******************************************/
+			/*         FUNCTION: PowValue              */
+			/*******************************************/
+
+/* Returns x^exponent of a power plan for one value */
+
+double PowValue(double x, int plan)
+{
+	//compute the power
+	BatchPowValues(&x, NULL, planexponent[plan], 1, plankind[plan]);
+
+	//return the power
+	return x;
+
+//end of function PowValue
+}
+
+//C
+//C
+			/*******************************************/
+			/*         FUNCTION: BatchSqrt             */
+			/*******************************************/
+
+/* Computes sqrt(x[i]) for n values (in place) */
+
+void BatchSqrt(double *x, int n)
+{
+	//local variable declarations
+	int
+		ivalue;		//value index
+
+	//Note:  Square roots are correctly rounded by every instruction
+	//       set, so the results are the same as libm sqrt in all
+	//       modes (including POWLIBM).
+	//
+	//start with the first value
+	ivalue = 0;
+
+#ifdef BATCHSIMD
+	//if AVX-512 is selected
+	if(powisa == POWAVX512)
+	{
+		//compute groups of eight values
+		ivalue = BatchSqrtAVX512(x, n);
+	}
+	else if(powisa == POWAVX2)	//else if AVX2 is selected
+	{
+		//compute groups of four values
+		ivalue = BatchSqrtAVX2(x, n);
+
+	}	//end if powisa == POWAVX512
+#endif
+
+	//loop over the remaining values
+	for(; ivalue<n; ivalue++)
+	{
+		x[ivalue] = sqrt(x[ivalue]);
+	}
+
+//end of function BatchSqrt
+}
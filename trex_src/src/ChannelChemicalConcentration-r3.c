@@ -15,11 +15,11 @@ C-              infchemchinflux[][][][], infchemchoutflux[][][][],
 C-              reaction_fluxes[][][][], reaction_fluxes[][][][],
 C-              channel properties
 C-
-C-  Outputs:    cchemchnew[][][][], chemreportch[][]
+C-  Outputs:    cchemchnew[][][][], chemreportch[][], mbchemstep[][]
 C-
 C-  Controls:   None
 C-
-C-  Calls:      SimulationError
+C-  Calls:      RejectStep, SimulationError, ClearChemicalMassBalanceStep
 C-
 C-  Called by:  ChemicalBalance
 C-
@@ -50,6 +50,38 @@ C-              the bed.  Added loop to calculate derivatives and
 C-              update concentrations for all layers in the stack
 C-              (surface and subsurface).
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Mass accounting: cumulative budgets accumulated in
+C-              double (no float casts), dispersion budgets only
+C-              when dispersion is simulated, and external loads
+C-              added to per-step totals summed by MassAccounting.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Minimum and maximum water column concentrations
+C-              updated with new concentrations.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Time steps with a negative depth or concentration
+C-              are rejected (RejectStep) when step recovery is
+C-              enabled.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	The water column and bed masses and the process
+C-              masses of each step are added to the streamed
+C-              chemical mass balance (mbchemstep).
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -125,6 +157,9 @@ void ChannelChemicalConcentration()
 		chemflow,			//chemical discharge (kg/s)
 		sumfp;				//sum of all particulate chemical fractions (sumfp = 1 - fd - fb)
 
+	//clear the channel chemical mass balance terms of this attempt (see MassBalanceMonitor)
+	ClearChemicalMassBalanceStep(NMSOVTERMS+1, NMSTERMS);
+
     //loop over links
 	for(i=1; i<=nlinks; i++)
 	{
@@ -414,6 +449,28 @@ void ChannelChemicalConcentration()
 				udrchemchinmass[ichem][i][j][0] = udrchemchinmass[ichem][i][j][0]
 					+ udrchemchinflux[ichem][i][j][0] * dt[idt] / 1000.0;
 
+				//Add the water column transfers and transformations to the streamed balance (kg)
+				//
+				//erosion (in) and deposition (out)
+				mbchemstep[ichem][MSERSCH] = mbchemstep[ichem][MSERSCH]
+					+ erschemchinflux[ichem][i][j][0] * dt[idt] / 1000.0;
+				mbchemstep[ichem][MSDEPCH] = mbchemstep[ichem][MSDEPCH]
+					+ depchemchoutflux[ichem][i][j][0] * dt[idt] / 1000.0;
+
+				//porewater release (in) and infiltration (out)
+				mbchemstep[ichem][MSPWRCH] = mbchemstep[ichem][MSPWRCH]
+					+ pwrchemchinflux[ichem][i][j][0] * dt[idt] / 1000.0;
+				mbchemstep[ichem][MSINFCH] = mbchemstep[ichem][MSINFCH]
+					+ infchemchoutflux[ichem][i][j][0] * dt[idt] / 1000.0;
+
+				//transformations (gain and loss)
+				mbchemstep[ichem][MSTNSINCH] = mbchemstep[ichem][MSTNSINCH]
+					+ transformationin * dt[idt] / 1000.0;
+				mbchemstep[ichem][MSKININCH] = mbchemstep[ichem][MSKININCH]
+					+ transformationin * dt[idt] / 1000.0;
+				mbchemstep[ichem][MSKINOUTCH] = mbchemstep[ichem][MSKINOUTCH]
+					+ transformationout * dt[idt] / 1000.0;
+
 				//Compute masses for loads (source = 0)
 				//
 				//compute the cumulative inflowing chemical mass (kg)
@@ -424,8 +481,8 @@ void ChannelChemicalConcentration()
 				advchemchoutmass[ichem][i][j][0] = advchemchoutmass[ichem][i][j][0]
 					+ advchemchoutflux[ichem][i][j][0] * dt[idt] / 1000.0;
 
-				//Compute the cumulative (net) chemical mass entering the domain from a point source (kg)
-				totalcwch[ichem] = totalcwch[ichem]
+				//Compute the (net) chemical mass entering the domain from a point source in the current time step (kg)
+				pendingcwch[ichem] = pendingcwch[ichem]
 					+ (advchemchinflux[ichem][i][j][0]
 					- advchemchoutflux[ichem][i][j][0]) * dt[idt] / 1000.0;
 
@@ -440,13 +497,18 @@ void ChannelChemicalConcentration()
 					advchemchoutmass[ichem][i][j][k] = advchemchoutmass[ichem][i][j][k]
 						+ advchemchoutflux[ichem][i][j][k] * dt[idt] / 1000.0;
 
-					//compute the cumulative in-dispersing chemical mass (kg)
-					dspchemchinmass[ichem][i][j][k] = dspchemchinmass[ichem][i][j][k]
-						+ dspchemchinflux[ichem][i][j][k] * dt[idt] / 1000.0;
+					//if channel dispersion budgets are tracked (trackdspchmass > 0)
+					if(trackdspchmass > 0)
+					{
+						//compute the cumulative in-dispersing chemical mass (kg)
+						dspchemchinmass[ichem][i][j][k] = dspchemchinmass[ichem][i][j][k]
+							+ dspchemchinflux[ichem][i][j][k] * dt[idt] / 1000.0;
+
+						//compute the cumulative out-dispersing chemical mass (kg)
+						dspchemchoutmass[ichem][i][j][k] = dspchemchoutmass[ichem][i][j][k]
+								+ dspchemchoutflux[ichem][i][j][k] * dt[idt] / 1000.0;
 
-					//compute the cumulative out-dispersing chemical mass (kg)
-					dspchemchoutmass[ichem][i][j][k] = dspchemchoutmass[ichem][i][j][k]
-							+ dspchemchoutflux[ichem][i][j][k] * dt[idt] / 1000.0;
+					}	//end if trackdspchmass > 0
 
 				}	//end loop over sources
 
@@ -468,13 +530,18 @@ void ChannelChemicalConcentration()
 					advchemchoutmass[ichem][i][j][10] = advchemchoutmass[ichem][i][j][10]
 						+ advchemchoutflux[ichem][i][j][10] * dt[idt] / 1000.0;
 
-					//compute the cumulative in-dispersing chemical mass (kg)
-					dspchemchinmass[ichem][i][j][10] = dspchemchinmass[ichem][i][j][10]
-						+ dspchemchinflux[ichem][i][j][10] * dt[idt] / 1000.0;
+					//if channel dispersion budgets are tracked (trackdspchmass > 0)
+					if(trackdspchmass > 0)
+					{
+						//compute the cumulative in-dispersing chemical mass (kg)
+						dspchemchinmass[ichem][i][j][10] = dspchemchinmass[ichem][i][j][10]
+							+ dspchemchinflux[ichem][i][j][10] * dt[idt] / 1000.0;
+
+						//compute the cumulative out-dispersing chemical mass (kg)
+						dspchemchoutmass[ichem][i][j][10] = dspchemchoutmass[ichem][i][j][10]
+							+ dspchemchoutflux[ichem][i][j][10] * dt[idt] / 1000.0;
 
-					//compute the cumulative out-dispersing chemical mass (kg)
-					dspchemchoutmass[ichem][i][j][10] = dspchemchoutmass[ichem][i][j][10]
-						+ dspchemchoutflux[ichem][i][j][10] * dt[idt] / 1000.0;
+					}	//end if trackdspchmass > 0
 
 					//Compute the cumulative chemical mass exiting the domain at this outlet (kg)
 					totaladvchemoutch[ichem][qchoutlet[i]] = totaladvchemoutch[ichem][qchoutlet[i]]
@@ -484,13 +551,18 @@ void ChannelChemicalConcentration()
 					totaladvcheminch[ichem][qchoutlet[i]] = totaladvcheminch[ichem][qchoutlet[i]]
 						+ advchemchinflux[ichem][i][j][10] * dt[idt] / 1000.0;
 
-					//Compute the cumulative chemical mass exiting the domain at this outlet (kg)
-					totaldspchemoutch[ichem][qchoutlet[i]] = totaldspchemoutch[ichem][qchoutlet[i]]
-						+ dspchemchoutflux[ichem][i][j][10] * dt[idt] / 1000.0;
+					//if channel dispersion budgets are tracked (trackdspchmass > 0)
+					if(trackdspchmass > 0)
+					{
+						//Compute the cumulative chemical mass exiting the domain at this outlet (kg)
+						totaldspchemoutch[ichem][qchoutlet[i]] = totaldspchemoutch[ichem][qchoutlet[i]]
+							+ dspchemchoutflux[ichem][i][j][10] * dt[idt] / 1000.0;
 
-					//Compute the cumulative chemical mass entering the domain at this outlet (kg)
-					totaldspcheminch[ichem][qchoutlet[i]] = totaldspcheminch[ichem][qchoutlet[i]]
-						+ dspchemchinflux[ichem][i][j][10] * dt[idt] / 1000.0;
+						//Compute the cumulative chemical mass entering the domain at this outlet (kg)
+						totaldspcheminch[ichem][qchoutlet[i]] = totaldspcheminch[ichem][qchoutlet[i]]
+							+ dspchemchinflux[ichem][i][j][10] * dt[idt] / 1000.0;
+
+					}	//end if trackdspchmass > 0
 
 					//compute chemical discharge (kg/s) (advection plus dispersion)
 					chemflow = (float)((advchemchoutflux[ichem][i][j][10]
@@ -562,8 +634,13 @@ void ChannelChemicalConcentration()
 					{
 						//Warn user of possible numerical instability (do not abort)
 						//
-						//Report error type (negative concentration in channel) and location
-						SimulationError(7, i, j, ichem);
+						//if the time step cannot be rejected (step recovery is off or no retries remain)
+						if(RejectStep(7, i, j, ichem) == 0)
+						{
+							//Report error type (negative concentration in channel) and location
+							SimulationError(7, i, j, ichem);
+
+						}	//end if RejectStep() == 0
 
 						//Reset the new concentration to exactly zero anyway...
 						cchemchnew[ichem][i][j][0] = 0.0;
@@ -572,6 +649,14 @@ void ChannelChemicalConcentration()
 
 				}	//end if cchemchnew < 0.0
 
+				//add the new water column mass to the streamed storage (kg)
+				mbchemstep[ichem][MSWATERCH] = mbchemstep[ichem][MSWATERCH]
+					+ cchemchnew[ichem][i][j][0] * newwatervol / 1000.0;
+
+				//Determine the minimum and the maximum chemical concentrations in water (g/m3)
+				mincchemch0[ichem] = Min(mincchemch0[ichem],cchemchnew[ichem][i][j][0]);
+				maxcchemch0[ichem] = Max(maxcchemch0[ichem],cchemchnew[ichem][i][j][0]);
+
 				//Check if present link/node is a chemical reporting station...
 				//
 				//Loop over number of chemical reporting stations
@@ -695,6 +780,10 @@ void ChannelChemicalConcentration()
 
 						//Compute cumulative masses for all processes
 						//
+						//compute the cumulative chemical mass leaving sediment bed by infiltration (trans loss) (kg)
+						infchemchoutmass[ichem][i][j][ilayer] = infchemchoutmass[ichem][i][j][ilayer]
+							+ infchemchoutflux[ichem][i][j][ilayer] * dt[idt] / 1000.0;
+
 						//compute the cumulative chemical mass entering sediment bed by deposition (kg)
 						depchemchinmass[ichem][i][j][ilayer] = depchemchinmass[ichem][i][j][ilayer]
 							+ depchemchinflux[ichem][i][j][ilayer] * dt[idt] / 1000.0;
@@ -707,10 +796,6 @@ void ChannelChemicalConcentration()
 						pwrchemchoutmass[ichem][i][j][ilayer] = pwrchemchoutmass[ichem][i][j][ilayer]
 							+ pwrchemchoutflux[ichem][i][j][ilayer] * dt[idt] / 1000.0;
 
-						//compute the cumulative chemical mass leaving sediment bed by infiltration (trans loss) (kg)
-						infchemchoutmass[ichem][i][j][ilayer] = infchemchoutmass[ichem][i][j][ilayer]
-							+ infchemchoutflux[ichem][i][j][ilayer] * dt[idt] / 1000.0;
-
 						//compute the cumulative chemical mass entering sediment bed by infiltration (trans loss) (kg)
 						infchemchinmass[ichem][i][j][ilayer] = infchemchinmass[ichem][i][j][ilayer]
 							+ infchemchinflux[ichem][i][j][ilayer] * dt[idt] / 1000.0;
@@ -771,6 +856,30 @@ void ChannelChemicalConcentration()
 						udrchemchinmass[ichem][i][j][ilayer] = udrchemchinmass[ichem][i][j][ilayer]
 							+ udrchemchinflux[ichem][i][j][ilayer] * dt[idt] / 1000.0;
 
+						//add the sediment transformations (gain and loss) to the streamed balance (kg)
+						mbchemstep[ichem][MSKININCH] = mbchemstep[ichem][MSKININCH]
+							+ transformationin * dt[idt] / 1000.0;
+						mbchemstep[ichem][MSKINOUTCH] = mbchemstep[ichem][MSKINOUTCH]
+							+ transformationout * dt[idt] / 1000.0;
+
+						//if the layer is the surface layer
+						if(ilayer == nstackch[i][j])
+						{
+							//add the infiltration out of the surface layer to the streamed balance (kg)
+							mbchemstep[ichem][MSINFSURFCH] = mbchemstep[ichem][MSINFSURFCH]
+								+ infchemchoutflux[ichem][i][j][ilayer] * dt[idt] / 1000.0;
+
+						}	//end if ilayer == nstackch[i][j]
+
+						//if the layer is the bottom layer of the stack
+						if(ilayer == 1)
+						{
+							//add the infiltration out of the stack to the streamed balance (kg)
+							mbchemstep[ichem][MSINFSTACKCH] = mbchemstep[ichem][MSINFSTACKCH]
+								+ infchemchoutflux[ichem][i][j][ilayer] * dt[idt] / 1000.0;
+
+						}	//end if ilayer == 1
+
 						//compute total derivative for the sediment layer (g/s)
 						sedderivative = sedinflux - sedoutflux;
 
@@ -808,6 +917,11 @@ void ChannelChemicalConcentration()
 
 					}	//end of newsedvol >= TOLERANCE
 
+					//add the change of layer mass to the streamed sediment storage (kg)
+					mbchemstep[ichem][MSBEDCH] = mbchemstep[ichem][MSBEDCH]
+						+ (cchemchnew[ichem][i][j][ilayer] * newsedvol
+						- cchemch[ichem][i][j][ilayer] * sedvol) / 1000.0;
+
 				}	//end loop over chemicals
 
 			}	//end loop over layers
@@ -30,6 +30,15 @@ C-              Denver, CO 80225
 C-
 C-	Date:		29-DEC-2003
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	The kernel takes a range of chemical types
+C-              (ichemfirst to ichemlast) so that each chemical type
+C-              can be computed as a separate task (see
+C-              SpeciesTasks).
+C-
 C-	Revised:
 C-
 C-	Date:	
@@ -53,7 +62,7 @@ C----------------------------------------------------------------------*/
 //trex global variable declarations for environmental conditions
 #include "trex_environmental_declarations.h"
 
-void ChannelChemicalErosion()
+void ChannelChemicalErosion(int ichemfirst, int ichemlast)
 {
 	//local variable declarations/definitions
 	int
@@ -80,7 +89,7 @@ void ChannelChemicalErosion()
 			ilayer = nstackch[i][j];
 
 			//loop over number of chemical types
-			for(ichem=1; ichem<=nchems; ichem++)
+			for(ichem=ichemfirst; ichem<=ichemlast; ichem++)
 			{
 				//Compute Erosion Fluxes...
 				//
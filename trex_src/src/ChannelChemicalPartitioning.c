@@ -6,15 +6,19 @@ C-	Methods:	network.  Partitioning determines all chemical phases:
 C-              dissolved, bound, and particulate.
 C-
 C-
-C-  Inputs:	    advinflowch[][][], advoutflowch[][][]
+C-  Inputs:	    csedch[][][], cdocch[][][], fpocch[][][][],
+C-              fdocch[][][], kb[], kp[], koc[], sedmd[][],
+C-              porositych[][][], partstalech[][], partwfech[][],
+C-              partrefch[][][], parttol
 C-
 C-  Outputs:    fparticulatech[chem][solid][link][node][layer]
 C-              fboundch[chem][link][node][layer],
-C-              fdissolvedch[chem][link][node][layer]
+C-              fdissolvedch[chem][link][node][layer],
+C-              partstalech[][], partwfech[][], partrefch[][][]
 C-
 C-  Controls:	partopt[]
 C-
-C-  Calls:      None
+C-  Calls:      PartitionInputMoved
 C-
 C-  Called by:  ChemicalTransport
 C-
@@ -43,6 +47,15 @@ C-              to account for variable saturation of bed layers as
 C-              the transmission loss wetting front moves through the
 C-              bed.  Updated comments for water column calculations.
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Nodes are partitioned incrementally: the water
+C-              column, surface layer and buried layers are
+C-              recomputed only when their inputs changed or the
+C-              node was marked stale (see PartitionCache).
+C-
 C-	Revised:
 C-
 C-	Date:	
@@ -72,7 +85,9 @@ void ChannelChemicalPartitioning()
 	int
 		ichem,		//loop index for chemical type
 		isolid,		//loop index for solids (particle) typ
-		ilayer;		//loop index for layer in the sediment stack
+		ilayer,		//loop index for layer in the sediment stack
+		stale,		//partitioning of all layers of the node is stale (see PartitionCache)
+		*partlayer;	//layer is partitioned (1) or keeps its previous phase fractions (0) [ilayer]
 
 	float
 		pic0,		//solids independent partition coefficient (m3/g)
@@ -92,11 +107,16 @@ void ChannelChemicalPartitioning()
 		wcporosity,	//water column porosity (volume water / total volume) (no air space)
 		wfe,		//wetting front elevation (m)
 		fsaturated,	//fraction of bed pore space that is filled with water (volume water / total volume) (could be air space)
-		phi;		//bed layer water-filled porosity (volume water / total volume) (when fsaturated = 1, phi = porositych)
+		phi,		//bed layer water-filled porosity (volume water / total volume) (when fsaturated = 1, phi = porositych)
+		wfe0,		//wetting front elevation at the last partitioning of the node (m)
+		*philayer,	//water-filled porosity of the bed layers [ilayer]
+		*ref;		//reference porosities and solids of the last partitioning of the node
 
 	//Allocate memory for local arrays
 	pic = (float *)malloc((nsolids+1) * sizeof(float));		//partition coefficient (m3/g)
 	m = (float *)malloc((nsolids+1) * sizeof(float));		//solids partitioning basis (g/m3 = mg/L)
+	partlayer = (int *)malloc((maxstackch+1) * sizeof(int));	//layer partitioning flags
+	philayer = (float *)malloc((maxstackch+1) * sizeof(float));	//bed layer water-filled porosities
 
 	//Define local constants...
 	//
@@ -134,186 +154,208 @@ void ChannelChemicalPartitioning()
 			//compute water column porosity (volume water / total volume)
 			wcporosity = (float)(1.0 - fsolids);
 
-			//loop over number of chemical types
-			for(ichem=1; ichem<=nchems; ichem++)
-			{
-				//if the chemical partitions (partopt > 0)
-				if(partopt[ichem] > 0)
-				{
-					//Water Column...
-					//
-					//Particulate phases:
-					//
-					//initialize the sum of pic * m (used to compute fparticulate)
-					sumpicm = 0.0;
+			//Partitioning cache (see PartitionCache)...
+			//
+			//Note:  The phase fractions of a layer are only recomputed
+			//       when the inputs of the layer changed since the last
+			//       call.  Otherwise the layer keeps its fractions.
+			//
+			//set the stale flag and reference values of the node
+			stale = partstalech[i][j];
+			ref = partrefch[i][j];
 
-					//initialize the sum of all particulate fractions
-					sumfp = 0.0;
+			//partition the water column if the node is stale or the porosity moved
+			partlayer[0] = stale || PartitionInputMoved(wcporosity, ref[0]);
 
-					//loop over number of solids types
-					for(isolid=1; isolid<=nsolids; isolid++)
-					{
-						//Note:  Partitioning is generalized for organic or
-						//       inorganic chemicals.  Organics partition
-						//       on a cabon normalized basis.  Inorganics
-						//       partition on a solids basis.  This code
-						//       works for either case and also accounts
-						//       for particle dependent partitioning.
-						//
-						//if the chemical partitions to organic carbon
-						if(partopt[ichem]> 1)
-						{
-							//set the fraction (particulate) organic carbon
-							fpoc = fpocch[isolid][i][j][0];
+			//loop over solids
+			for(isolid=1; isolid<=nsolids; isolid++)
+			{
+				//partition the water column if the solids concentration moved
+				partlayer[0] = partlayer[0] || PartitionInputMoved(csedch[isolid][i][j][0], ref[isolid]);
 
-							//set the solids independent partition coefficient (m3/g)
-							pic0 = koc[ichem];
+			}	//end loop over solids
 
-							//set the particulate organic carbon (poc) concentration (g/m3 = mg/L))
-							m[isolid] = csedch[isolid][i][j][0] * fpoc;
-						}
-						else	//else the chemical partitions to solids
-						{
-							//Developer's Note:  The water column partition coefficient
-							//                   could be assigned as a separate variable
-							//                   to distinguish it from the sediment bed
-							//                   partition coefficient...
-							//
-							//                   Change from kp[] to kpw[] and kps[]...
-							//
-							//set the solids independent partition coefficient (m3/g)
-							pic0 = kp[ichem];
+			//if the water column is partitioned
+			if(partlayer[0])
+			{
+				//store the reference porosity and solids concentrations
+				ref[0] = wcporosity;
 
-							//set the solids concentration (g/m3 = mg/L)
-							m[isolid] =  csedch[isolid][i][j][0];
+				//loop over solids
+				for(isolid=1; isolid<=nsolids; isolid++)
+				{
+					ref[isolid] = csedch[isolid][i][j][0];
 
-						}	//end if partopt[]
+				}	//end loop over solids
 
-						//Adjust partition coefficient for porosity
-						//
-						//Note:  For the water column, the partition coefficient must
-						//       be adjusted by porosity because "m" is on a total
-						//       (bulk) volume basis (i.e. volume water plus volume
-						//       solids) and the partition coefficient is defined as
-						//       mass chemical / volume water.
-						//
-						//if the water column porosity > 0.0
-						if(wcporosity > 0.0)
-						{
-							//correct partition coeffificent for porosity
-							pic0 = pic0 / wcporosity;
-						}
-						else	//else wcporosity <= 0
-						{
-							//set the partition coefficient to effective infinity
-							pic0 = (float)(1.0e30);
+			}	//end if partlayer[0]
 
-						}	//end if wcporosity > 0.0
+			//set the wetting front elevation of the last partitioning (m)
+			wfe0 = partwfech[i][j];
 
-						//Note:  For the water column, the particle dependent
-						//       partition coefficient is used...
-						//
-						//Compute the particle dependent partition coefficient (m3/g)
-						pic[isolid] = (float)(pic0 / (1.0 + m[isolid] * pic0 /nux[ichem]));
+			//if transmission loss is simulated (ctlopt > 0)
+			if(ctlopt > 0)
+			{
+				//compute the wetting front elevation (m)
+				wfe = elevationch0[i][j] - translossdepth[i][j];
+			}
+			else	//else transmission loss is not simulated (ctlopt = 0)
+			{
+				//the wetting front is not used
+				wfe = wfe0;
 
-						//compute the sum of pic * m (used to compute fparticulate)
-						sumpicm = sumpicm + pic[isolid] * m[isolid];
+			}	//end if ctlopt > 0
 
-					}	//end loop over solids
+			//Sediment Column...
+			//
+			//loop over layers (in reverse order: top down)
+			for(ilayer=nstackch[i][j]; ilayer>=1; ilayer--)
+			{
+				//if the layer is the surface layer
+				if(ilayer == nstackch[i][j])
+				{
+					//the porosity of the surface layer is always computed (the
+					//inputs are checked against the reference values below)
+					partlayer[ilayer] = 1;
+				}
+				else	//else the layer is buried
+				{
+					//Note:  The inputs of a buried layer only change when
+					//       the stack or the doc changes (the node is then
+					//       marked stale) or when the wetting front moves
+					//       into, out of, or within the layer.  Otherwise
+					//       the front stays above or below the layer, the
+					//       water-filled porosity is unchanged, and the
+					//       layer keeps its phase fractions.
+					//
+					//partition the layer if the node is stale or the front moved across the layer
+					partlayer[ilayer] = stale || (ctlopt > 0
+						&& !((wfe0 >= elevlayerch[i][j][ilayer] && wfe >= elevlayerch[i][j][ilayer])
+						|| (wfe0 <= elevlayerch[i][j][ilayer-1] && wfe <= elevlayerch[i][j][ilayer-1])));
 
-					//Bound phase:
+				}	//end if ilayer == nstackch[i][j]
+
+				//if the layer is partitioned
+				if(partlayer[ilayer])
+				{
+					//Compute water-filled porosity of bed (volume water / total volume)
+					//
+					//       phi = fsaturated * porositych[][]
+					//
+					//Note:  The pore space of the sediment bed may not always
+					//       be 100% saturated with water (e.g. intermittant
+					//       streams where the bed may dry).  The bed porosity
+					//       may also include void space willed with air...
+					//
+					//       total volume = volume of air + water + solids
 					//
-					//if the chemical partitions to organic carbon
-					if(partopt[ichem]> 1)
+					//if transmission loss is simulated (ctlopt > 0)
+					if(ctlopt > 0)
 					{
-						//set the effective fraction of doc for binding
-						fdoc = fdocch[i][j][0];
-
-						//set the organic binding coefficient (m3/g)
-						pib = koc[ichem];
+						//Determine if the wetting front is within this bed layer
+						//
+						//Three cases exist:
+						//
+						//   (1) wetting front is above top of this layer, so the
+						//       water filled porosity equals the layer initial
+						//       value (fsaturated = 1 - sedmd)
+						//
+						//   (2) wetting front is below bottom of this layer, so
+						//       the water filled porosity equals the layer
+						//       porosity (fsaturated = 1) (100% saturated)
+						//
+						//   (3) wetting from is within this layer, so the water
+						//       filled porosity is computed as an average where
+						//       the distance above the front is saturated and
+						//       the distance below is the initial value
+						//
+						//Note:  elevlayerch[][][ilayer] = elevation at layer top
+						//       elevlayerch[][][ilayer-1] = elevation at layer bottom
+						//       elevlayerch[][][0] = elevation at bottom of stack
+						//
+						//if the wetting from elevation is above the layer upper boundary
+						if(wfe >= elevlayerch[i][j][ilayer])
+						{
+							//fraction saturated equals layer initial value
+							fsaturated = (float)(1.0 - sedmd[i][j]);
+						}
+						//else, if the wetting front is below the layer bottom boundary
+						else if(wfe <= elevlayerch[i][j][ilayer-1])
+						{
+							//fraction saturated equals 1.0 (100% saturated)
+							fsaturated = 1.0;
+						}
+						//else, the wetting front is within this layer
+						else
+						{
+							//calculate fraction saturation of the layer
+							fsaturated = (float)(((elevlayerch[i][j][ilayer] - wfe) * 1.0
+								+ (wfe - elevlayerch[i][j][ilayer-1]) * (1.0 - sedmd[i][j]))
+								/ (elevlayerch[i][j][ilayer] - elevlayerch[i][j][ilayer-1]));
 
-						//set the effective dissolved organic compound (doc) concentration (g/m3)
-						b = cdocch[i][j][0] * fdoc;
+						}	//end if/else if/else wfe >= elevlayerch[][][]...
 					}
-					else	//else the chemical partitions to solids
+					else	//transmission loss is not simulated (ctlopt = 0)
 					{
-						//set the organic binding coefficient (m3/g)
-						pib = kb[ichem];
+						//set fraction saturated equals to zero
+						fsaturated = 0.0;
 
-						//set the dissolved organic compound (doc) concentration (g/m3) (mass / total volume)
-						b =  cdocch[i][j][0];
+					}	//end if cltopt > 0
 
-					}	//end if partopt[] > 1
+					//calculate water filled porosity (volume water / total volume)
+					philayer[ilayer] = fsaturated * porositych[i][j][ilayer];
 
-					//Adjust binding coefficient for porosity
-					//
-					//Note:  For the water column, the binding coefficient must
-					//       be adjusted by porosity because "b" is on a total
-					//       (bulk) volume basis (i.e. volume water plus volume
-					//       solids) and the binding coefficient is defined as
-					//       mass chemical / volume water.
-					//
-					//if the water column porosity > 0.0
-					if(wcporosity > 0.0)
-					{
-						//correct binding coeffificent for porosity
-						pib = pib / wcporosity;
-					}
-					else	//else wcporosity <= 0
-					{
-						//set the binding coefficient to zero
-						pib = 0.0;
+				}	//end if partlayer[ilayer]
 
-					}	//end if wcporosity > 0.0
+				//if the layer is the surface layer
+				if(ilayer == nstackch[i][j])
+				{
+					//partition the surface layer if the node is stale or the porosity moved
+					partlayer[ilayer] = stale || PartitionInputMoved(philayer[ilayer], ref[nsolids+1]);
 
-					//loop over number of solids types
+					//loop over solids
 					for(isolid=1; isolid<=nsolids; isolid++)
 					{
-						//compute the fraction of the chemical sorbed to this solids type
-						fparticulatech[ichem][isolid][i][j][0] = (float)(pic[isolid] * m[isolid]
-							/ (1.0 + pib * b + sumpicm));
-
-						//compute sum of all particulate phases
-						sumfp = sumfp
-							+ fparticulatech[ichem][isolid][i][j][0];
+						//partition the surface layer if the solids concentration moved
+						partlayer[ilayer] = partlayer[ilayer]
+							|| PartitionInputMoved(csedch[isolid][i][j][ilayer], ref[nsolids+1+isolid]);
 
 					}	//end loop over solids
 
-					//Note:  Watch out for roundoff errors.  For large
-					//       Kp values, the sum of particulate fractions
-					//       can be > 1.0 (i.e. 1.0000001).  When this
-					//       occurs individual values need to be scaled
-					//       and the sum reset to exactly 1.0.
-					//
-					//if the sum of particulate fractions (sumfp) > 1.0
-					if(sumfp > 1.0)
+					//if the surface layer is partitioned
+					if(partlayer[ilayer])
 					{
-						//loop over number of solids types
+						//store the reference porosity and solids concentrations
+						ref[nsolids+1] = philayer[ilayer];
+
+						//loop over solids
 						for(isolid=1; isolid<=nsolids; isolid++)
 						{
-							//scale the fraction of the chemical sorbed to this solids type
-							fparticulatech[ichem][isolid][i][j][0] = (float)(1.0 / sumfp)
-								* fparticulatech[ichem][isolid][i][j][0];
+							ref[nsolids+1+isolid] = csedch[isolid][i][j][ilayer];
 
 						}	//end loop over solids
 
-						//reset sum of all particulate phases to exactly 1.0
-						sumfp = (float)(1.0);
+					}	//end if partlayer[ilayer]
 
-					}	//end if sumfp > 1.0
+				}	//end if ilayer == nstackch[i][j]
 
-					//compute the fraction of the chemical sorbed to doc
-					fboundch[ichem][i][j][0] = (float)(pib * b / (1.0 + pib * b + sumpicm));
+			}	//end loop over layers
 
-					//compute the dissolved fraction of the chemical
-					fdissolvedch[ichem][i][j][0] = (float)(1.0 - sumfp
-						- fboundch[ichem][i][j][0]);
+			//the cache of the node is current
+			partwfech[i][j] = wfe;
+			partstalech[i][j] = 0;
 
-					//Sediment Column...
-					//
-					//loop over layers (in reverse order: top down)
-					for(ilayer=nstackch[i][j]; ilayer>=1; ilayer--)
+			//loop over number of chemical types
+			for(ichem=1; ichem<=nchems; ichem++)
+			{
+				//if the chemical partitions (partopt > 0)
+				if(partopt[ichem] > 0)
+				{
+					//if the water column is partitioned
+					if(partlayer[0])
 					{
+						//Water Column...
+						//
 						//Particulate phases:
 						//
 						//initialize the sum of pic * m (used to compute fparticulate)
@@ -322,76 +364,6 @@ void ChannelChemicalPartitioning()
 						//initialize the sum of all particulate fractions
 						sumfp = 0.0;
 
-						//Compute water-filled porosity of bed (volume water / total volume)
-						//
-						//       phi = fsaturated * porositych[][]
-						//
-						//Note:  The pore space of the sediment bed may not always
-						//       be 100% saturated with water (e.g. intermittant
-						//       streams where the bed may dry).  The bed porosity
-						//       may also include void space willed with air...
-						//
-						//       total volume = volume of air + water + solids
-						//
-						//if transmission loss is simulated (ctlopt > 0)
-						if(ctlopt > 0)
-						{
-							//compute the wetting front elevation (m)
-							wfe = elevationch0[i][j] - translossdepth[i][j];
-
-							//Determine if the wetting front is within this bed layer
-							//
-							//Three cases exist:
-							//
-							//   (1) wetting front is above top of this layer, so the
-							//       water filled porosity equals the layer initial
-							//       value (fsaturated = 1 - sedmd)
-							//
-							//   (2) wetting front is below bottom of this layer, so
-							//       the water filled porosity equals the layer
-							//       porosity (fsaturated = 1) (100% saturated)
-							//
-							//   (3) wetting from is within this layer, so the water
-							//       filled porosity is computed as an average where
-							//       the distance above the front is saturated and
-							//       the distance below is the initial value
-							//
-							//Note:  elevlayerch[][][ilayer] = elevation at layer top
-							//       elevlayerch[][][ilayer-1] = elevation at layer bottom
-							//       elevlayerch[][][0] = elevation at bottom of stack
-							//
-							//if the wetting from elevation is above the layer upper boundary
-							if(wfe >= elevlayerch[i][j][ilayer])
-							{
-								//fraction saturated equals layer initial value
-								fsaturated = (float)(1.0 - sedmd[i][j]);
-							}
-							//else, if the wetting front is below the layer bottom boundary
-							else if(wfe <= elevlayerch[i][j][ilayer-1])
-							{
-								//fraction saturated equals 1.0 (100% saturated)
-								fsaturated = 1.0;
-							}
-							//else, the wetting front is within this layer
-							else
-							{
-								//calculate fraction saturation of the layer
-								fsaturated = (float)(((elevlayerch[i][j][ilayer] - wfe) * 1.0
-									+ (wfe - elevlayerch[i][j][ilayer-1]) * (1.0 - sedmd[i][j]))
-									/ (elevlayerch[i][j][ilayer] - elevlayerch[i][j][ilayer-1]));
-
-							}	//end if/else if/else wfe >= elevlayerch[][][]...
-						}
-						else	//transmission loss is not simulated (ctlopt = 0)
-						{
-							//set fraction saturated equals to zero
-							fsaturated = 0.0;
-
-						}	//end if cltopt > 0
-
-						//calculate water filled porosity (volume water / total volume)
-						phi = fsaturated * porositych[i][j][ilayer];
-
 						//loop over number of solids types
 						for(isolid=1; isolid<=nsolids; isolid++)
 						{
@@ -399,54 +371,64 @@ void ChannelChemicalPartitioning()
 							//       inorganic chemicals.  Organics partition
 							//       on a cabon normalized basis.  Inorganics
 							//       partition on a solids basis.  This code
-							//       works for either case.  Partitioning in
-							//       the sediments is always independent
-							//       of particle concentration (i.e. never use
-							//       DiToro particle interaction model).
+							//       works for either case and also accounts
+							//       for particle dependent partitioning.
 							//
 							//if the chemical partitions to organic carbon
 							if(partopt[ichem]> 1)
 							{
 								//set the fraction (particulate) organic carbon
-								fpoc = fpocch[isolid][i][j][ilayer];
+								fpoc = fpocch[isolid][i][j][0];
 
 								//set the solids independent partition coefficient (m3/g)
 								pic0 = koc[ichem];
 
 								//set the particulate organic carbon (poc) concentration (g/m3 = mg/L))
-								m[isolid] = csedch[isolid][i][j][ilayer] * fpoc;
+								m[isolid] = csedch[isolid][i][j][0] * fpoc;
 							}
 							else	//else the chemical partitions to solids
 							{
+								//Developer's Note:  The water column partition coefficient
+								//                   could be assigned as a separate variable
+								//                   to distinguish it from the sediment bed
+								//                   partition coefficient...
+								//
+								//                   Change from kp[] to kpw[] and kps[]...
+								//
 								//set the solids independent partition coefficient (m3/g)
 								pic0 = kp[ichem];
 
 								//set the solids concentration (g/m3 = mg/L)
-								m[isolid] =  csedch[isolid][i][j][ilayer];
+								m[isolid] =  csedch[isolid][i][j][0];
 
 							}	//end if partopt[]
 
-							//Adjust partition coefficient for water-filled porosity
+							//Adjust partition coefficient for porosity
 							//
-							//if the water-filled porosity (phi) > 0.0
-							if(phi > 0.0)
+							//Note:  For the water column, the partition coefficient must
+							//       be adjusted by porosity because "m" is on a total
+							//       (bulk) volume basis (i.e. volume water plus volume
+							//       solids) and the partition coefficient is defined as
+							//       mass chemical / volume water.
+							//
+							//if the water column porosity > 0.0
+							if(wcporosity > 0.0)
 							{
 								//correct partition coeffificent for porosity
-								pic0 = pic0 / phi;
+								pic0 = pic0 / wcporosity;
 							}
-							else	//else phi <= 0 (phi can never really be < 0...)
+							else	//else wcporosity <= 0
 							{
 								//set the partition coefficient to effective infinity
 								pic0 = (float)(1.0e30);
 
-							}	//end if phi > 0.0
+							}	//end if wcporosity > 0.0
 
-							//Note:  For the sediment column, the particle independent
-							//       partition coefficient is used (never use DiToro
-							//       particle interaction model)...
+							//Note:  For the water column, the particle dependent
+							//       partition coefficient is used...
 							//
-							//Compute the (particle independent) partition coefficient (m3/g)
-							pic[isolid] = pic0;
+							//Compute the particle dependent partition coefficient (m3/g)
+							pic[isolid] = (float)(pic0 / (1.0 + m[isolid] * pic0 /nux[ichem]));
 
 							//compute the sum of pic * m (used to compute fparticulate)
 							sumpicm = sumpicm + pic[isolid] * m[isolid];
@@ -459,55 +441,55 @@ void ChannelChemicalPartitioning()
 						if(partopt[ichem]> 1)
 						{
 							//set the effective fraction of doc for binding
-							fdoc = fdocch[i][j][ilayer];
+							fdoc = fdocch[i][j][0];
 
 							//set the organic binding coefficient (m3/g)
 							pib = koc[ichem];
 
-							//set the effective dissolved organic compound (doc) concentration (g/m3 = mg/L)
-							b = cdocch[i][j][ilayer] * fdoc;
+							//set the effective dissolved organic compound (doc) concentration (g/m3)
+							b = cdocch[i][j][0] * fdoc;
 						}
 						else	//else the chemical partitions to solids
 						{
 							//set the organic binding coefficient (m3/g)
 							pib = kb[ichem];
 
-							//set the dissolved organic compound (doc) concentration (g/m3 = mg/L)
-							b =  cdocch[i][j][ilayer];
+							//set the dissolved organic compound (doc) concentration (g/m3) (mass / total volume)
+							b =  cdocch[i][j][0];
 
 						}	//end if partopt[] > 1
 
-						//Adjust binding coefficient for water-filled porosity
+						//Adjust binding coefficient for porosity
 						//
-						//Note:  In sediments, DOC concentrations are reported
-						//       on a pore volume basis: mass DOC / volume water.
-						//       The binding coefficient must be adjusted for the
-						//       fraction of the pore space that is filled with
-						//       water because the bed may not be 100% saturated.
+						//Note:  For the water column, the binding coefficient must
+						//       be adjusted by porosity because "b" is on a total
+						//       (bulk) volume basis (i.e. volume water plus volume
+						//       solids) and the binding coefficient is defined as
+						//       mass chemical / volume water.
 						//
-						//if the water-filled porosity (phi) > 0.0
-						if(phi > 0.0)
+						//if the water column porosity > 0.0
+						if(wcporosity > 0.0)
 						{
-							//correct binding coeffificent for saturation
-							pib = pib / phi;
+							//correct binding coeffificent for porosity
+							pib = pib / wcporosity;
 						}
-						else	//else saturation <= 0
+						else	//else wcporosity <= 0
 						{
 							//set the binding coefficient to zero
 							pib = 0.0;
 
-						}	//end if phi > 0.0
+						}	//end if wcporosity > 0.0
 
 						//loop over number of solids types
 						for(isolid=1; isolid<=nsolids; isolid++)
 						{
 							//compute the fraction of the chemical sorbed to this solids type
-							fparticulatech[ichem][isolid][i][j][ilayer] = (float)(pic[isolid] * m[isolid]
-								/ (phi + pib * b + sumpicm));
+							fparticulatech[ichem][isolid][i][j][0] = (float)(pic[isolid] * m[isolid]
+								/ (1.0 + pib * b + sumpicm));
 
 							//compute sum of all particulate phases
 							sumfp = sumfp
-								+ fparticulatech[ichem][isolid][i][j][ilayer];
+								+ fparticulatech[ichem][isolid][i][j][0];
 
 						}	//end loop over solids
 
@@ -524,8 +506,8 @@ void ChannelChemicalPartitioning()
 							for(isolid=1; isolid<=nsolids; isolid++)
 							{
 								//scale the fraction of the chemical sorbed to this solids type
-								fparticulatech[ichem][isolid][i][j][ilayer] = (float)(1.0 / sumfp)
-									* fparticulatech[ichem][isolid][i][j][ilayer];
+								fparticulatech[ichem][isolid][i][j][0] = (float)(1.0 / sumfp)
+									* fparticulatech[ichem][isolid][i][j][0];
 
 							}	//end loop over solids
 
@@ -535,11 +517,183 @@ void ChannelChemicalPartitioning()
 						}	//end if sumfp > 1.0
 
 						//compute the fraction of the chemical sorbed to doc
-						fboundch[ichem][i][j][ilayer] = (float)(pib * b / (phi + pib * b + sumpicm));
+						fboundch[ichem][i][j][0] = (float)(pib * b / (1.0 + pib * b + sumpicm));
 
 						//compute the dissolved fraction of the chemical
-						fdissolvedch[ichem][i][j][ilayer] = (float)(1.0 - sumfp
-							- fboundch[ichem][i][j][ilayer]);
+						fdissolvedch[ichem][i][j][0] = (float)(1.0 - sumfp
+							- fboundch[ichem][i][j][0]);
+
+					}	//end if partlayer[0]
+
+					//Sediment Column...
+					//
+					//loop over layers (in reverse order: top down)
+					for(ilayer=nstackch[i][j]; ilayer>=1; ilayer--)
+					{
+						//if the layer is partitioned
+						if(partlayer[ilayer])
+						{
+							//Particulate phases:
+							//
+							//initialize the sum of pic * m (used to compute fparticulate)
+							sumpicm = 0.0;
+
+							//initialize the sum of all particulate fractions
+							sumfp = 0.0;
+
+							//set the water-filled porosity of the layer (volume water / total volume)
+							phi = philayer[ilayer];
+
+							//loop over number of solids types
+							for(isolid=1; isolid<=nsolids; isolid++)
+							{
+								//Note:  Partitioning is generalized for organic or
+								//       inorganic chemicals.  Organics partition
+								//       on a cabon normalized basis.  Inorganics
+								//       partition on a solids basis.  This code
+								//       works for either case.  Partitioning in
+								//       the sediments is always independent
+								//       of particle concentration (i.e. never use
+								//       DiToro particle interaction model).
+								//
+								//if the chemical partitions to organic carbon
+								if(partopt[ichem]> 1)
+								{
+									//set the fraction (particulate) organic carbon
+									fpoc = fpocch[isolid][i][j][ilayer];
+
+									//set the solids independent partition coefficient (m3/g)
+									pic0 = koc[ichem];
+
+									//set the particulate organic carbon (poc) concentration (g/m3 = mg/L))
+									m[isolid] = csedch[isolid][i][j][ilayer] * fpoc;
+								}
+								else	//else the chemical partitions to solids
+								{
+									//set the solids independent partition coefficient (m3/g)
+									pic0 = kp[ichem];
+
+									//set the solids concentration (g/m3 = mg/L)
+									m[isolid] =  csedch[isolid][i][j][ilayer];
+
+								}	//end if partopt[]
+
+								//Adjust partition coefficient for water-filled porosity
+								//
+								//if the water-filled porosity (phi) > 0.0
+								if(phi > 0.0)
+								{
+									//correct partition coeffificent for porosity
+									pic0 = pic0 / phi;
+								}
+								else	//else phi <= 0 (phi can never really be < 0...)
+								{
+									//set the partition coefficient to effective infinity
+									pic0 = (float)(1.0e30);
+
+								}	//end if phi > 0.0
+
+								//Note:  For the sediment column, the particle independent
+								//       partition coefficient is used (never use DiToro
+								//       particle interaction model)...
+								//
+								//Compute the (particle independent) partition coefficient (m3/g)
+								pic[isolid] = pic0;
+
+								//compute the sum of pic * m (used to compute fparticulate)
+								sumpicm = sumpicm + pic[isolid] * m[isolid];
+
+							}	//end loop over solids
+
+							//Bound phase:
+							//
+							//if the chemical partitions to organic carbon
+							if(partopt[ichem]> 1)
+							{
+								//set the effective fraction of doc for binding
+								fdoc = fdocch[i][j][ilayer];
+
+								//set the organic binding coefficient (m3/g)
+								pib = koc[ichem];
+
+								//set the effective dissolved organic compound (doc) concentration (g/m3 = mg/L)
+								b = cdocch[i][j][ilayer] * fdoc;
+							}
+							else	//else the chemical partitions to solids
+							{
+								//set the organic binding coefficient (m3/g)
+								pib = kb[ichem];
+
+								//set the dissolved organic compound (doc) concentration (g/m3 = mg/L)
+								b =  cdocch[i][j][ilayer];
+
+							}	//end if partopt[] > 1
+
+							//Adjust binding coefficient for water-filled porosity
+							//
+							//Note:  In sediments, DOC concentrations are reported
+							//       on a pore volume basis: mass DOC / volume water.
+							//       The binding coefficient must be adjusted for the
+							//       fraction of the pore space that is filled with
+							//       water because the bed may not be 100% saturated.
+							//
+							//if the water-filled porosity (phi) > 0.0
+							if(phi > 0.0)
+							{
+								//correct binding coeffificent for saturation
+								pib = pib / phi;
+							}
+							else	//else saturation <= 0
+							{
+								//set the binding coefficient to zero
+								pib = 0.0;
+
+							}	//end if phi > 0.0
+
+							//loop over number of solids types
+							for(isolid=1; isolid<=nsolids; isolid++)
+							{
+								//compute the fraction of the chemical sorbed to this solids type
+								fparticulatech[ichem][isolid][i][j][ilayer] = (float)(pic[isolid] * m[isolid]
+									/ (phi + pib * b + sumpicm));
+
+								//compute sum of all particulate phases
+								sumfp = sumfp
+									+ fparticulatech[ichem][isolid][i][j][ilayer];
+
+							}	//end loop over solids
+
+							//Note:  Watch out for roundoff errors.  For large
+							//       Kp values, the sum of particulate fractions
+							//       can be > 1.0 (i.e. 1.0000001).  When this
+							//       occurs individual values need to be scaled
+							//       and the sum reset to exactly 1.0.
+							//
+							//if the sum of particulate fractions (sumfp) > 1.0
+							if(sumfp > 1.0)
+							{
+								//loop over number of solids types
+								for(isolid=1; isolid<=nsolids; isolid++)
+								{
+									//scale the fraction of the chemical sorbed to this solids type
+									fparticulatech[ichem][isolid][i][j][ilayer] = (float)(1.0 / sumfp)
+										* fparticulatech[ichem][isolid][i][j][ilayer];
+
+								}	//end loop over solids
+
+								//reset sum of all particulate phases to exactly 1.0
+								sumfp = (float)(1.0);
+
+							}	//end if sumfp > 1.0
+
+							//compute the fraction of the chemical sorbed to doc
+							fboundch[ichem][i][j][ilayer] = (float)(pib * b / (phi + pib * b + sumpicm));
+
+							//compute the dissolved fraction of the chemical
+							fdissolvedch[ichem][i][j][ilayer] = (float)(1.0 - sumfp
+								- fboundch[ichem][i][j][ilayer]);
+
+						}	//end if partlayer[ilayer]
 
 					}	//end loop over layers
 
@@ -554,6 +708,8 @@ void ChannelChemicalPartitioning()
 	//Deallocate memory for local arrays
 	free(pic);
 	free(m);
+	free(partlayer);
+	free(philayer);
 
 //End of function: Return to ChemicalTransport
 }
@@ -45,6 +45,15 @@ C-	Revisions:  Added code to calculate fluxes as the tranmission loss
 C-              wetting front moves through bed layers and transports
 C-              chemicals between layers.
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	The kernel takes a range of chemical types
+C-              (ichemfirst to ichemlast) so that each chemical type
+C-              can be computed as a separate task (see
+C-              SpeciesTasks).
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -68,7 +77,7 @@ C----------------------------------------------------------------------*/
 //trex global variable declarations for environmental conditions
 #include "trex_environmental_declarations.h"
 
-void ChannelChemicalTransmissionLoss()
+void ChannelChemicalTransmissionLoss(int ichemfirst, int ichemlast)
 {
 	//local variable declarations/definitions
 	int
@@ -136,7 +145,7 @@ void ChannelChemicalTransmissionLoss()
 			abed = achbed[i][j][ilayer];
 
 			//loop over number of chemical types
-			for(ichem=1; ichem<=nchems; ichem++)
+			for(ichem=ichemfirst; ichem<=ichemlast; ichem++)
 			{
 				//compute mobile fraction (sum of dissolved and bound)
 				fmobile = fdissolvedch[ichem][i][j][0] + fboundch[ichem][i][j][0];
@@ -239,7 +248,7 @@ void ChannelChemicalTransmissionLoss()
 				}	//end if wfe >= elevlayerch[][][]...
 
 				//loop over number of chemical types
-				for(ichem=1; ichem<=nchems; ichem++)
+				for(ichem=ichemfirst; ichem<=ichemlast; ichem++)
 				{
 					//compute mobile fraction (sum of dissolved and bound)
 					fmobile = fdissolvedch[ichem][i][j][ilayer] + fboundch[ichem][i][j][ilayer];
@@ -13,11 +13,13 @@ C-              depsedchinflux[][][][], depsedchoutflux[][][][],
 C-              erssedchinflux[][][][], erssedchoutflux[][][][],
 C-              channel properties
 C-
-C-  Outputs:    csedchnew[][][][], sedreportch[][], popchflag, pushchflag
+C-  Outputs:    csedchnew[][][][], sedreportch[][], npopch,
+C-              popchlink[], popchnode[], npushch, pushchlink[],
+C-              pushchnode[], mbsolidsstep[][]
 C-
 C-  Controls:   None
 C-
-C-  Calls:      SimulationError
+C-  Calls:      RejectStep, SimulationError, ClearSolidsMassBalanceStep
 C-
 C-  Called by:  SolidsBalance
 C-
@@ -34,6 +36,38 @@ C-              Denver, CO 80225
 C-
 C-	Date:		29-DEC-2003
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Mass accounting: cumulative budgets accumulated in
+C-              double (no float casts), dispersion budgets only
+C-              when dispersion is simulated, and external loads
+C-              added to per-step totals summed by MassAccounting.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Replaced stack pop/push flags with work lists of
+C-              flagged cells and nodes.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Time steps with a negative depth or concentration
+C-              are rejected (RejectStep) when step recovery is
+C-              enabled.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	The water column and bed masses and the erosion and
+C-              deposition masses of each step are added to the
+C-              streamed solids mass balance (mbsolidsstep).
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -107,6 +141,9 @@ void ChannelSolidsConcentration()
 	//set density of water = 1000 kg/m3
 	densityw = (float)(1000.0);
 
+	//clear the channel solids mass balance terms of this attempt (see MassBalanceMonitor)
+	ClearSolidsMassBalanceStep(NMSOVTERMS+1, NMSTERMS);
+
     //loop over links
 	for(i=1; i<=nlinks; i++)
 	{
@@ -287,53 +324,64 @@ void ChannelSolidsConcentration()
 				//
 				//compute cumulative sediment mass leaving water column by deposition (kg)
 				depsedchoutmass[isolid][i][j][0] = depsedchoutmass[isolid][i][j][0]
-					+ (float)(depsedchoutflux[isolid][i][j][0] * dt[idt] / 1000.0);
+					+ depsedchoutflux[isolid][i][j][0] * dt[idt] / 1000.0;
 
 				//compute the cumulative sediment mass entering the sediment bed by deposition (kg)
 				depsedchinmass[isolid][i][j][ilayer] = depsedchinmass[isolid][i][j][ilayer]
-					+ (float)(depsedchinflux[isolid][i][j][ilayer] * dt[idt] / 1000.0);
+					+ depsedchinflux[isolid][i][j][ilayer] * dt[idt] / 1000.0;
 
 				//compute cumulative solids mass leaving the bed (kg)
 				erssedchoutmass[isolid][i][j][ilayer] = erssedchoutmass[isolid][i][j][ilayer]
-					+ (float)(erssedchoutflux[isolid][i][j][ilayer] * dt[idt] / 1000.0);
+					+ erssedchoutflux[isolid][i][j][ilayer] * dt[idt] / 1000.0;
 
 				//compute the cumulative solids mass entering the water column (kg)
 				erssedchinmass[isolid][i][j][0] = erssedchinmass[isolid][i][j][0]
-					+ (float)(erssedchinflux[isolid][i][j][0] * dt[idt] / 1000.0);
+					+ erssedchinflux[isolid][i][j][0] * dt[idt] / 1000.0;
+
+				//add the solids masses entering the water column by erosion and leaving it by deposition to the streamed balance (kg)
+				mbsolidsstep[isolid][MSERSCH] = mbsolidsstep[isolid][MSERSCH]
+					+ erssedchinflux[isolid][i][j][0] * dt[idt] / 1000.0;
+				mbsolidsstep[isolid][MSDEPCH] = mbsolidsstep[isolid][MSDEPCH]
+					+ depsedchoutflux[isolid][i][j][0] * dt[idt] / 1000.0;
 
 				//Compute masses for loads (source = 0)
 				//
 				//compute the cumulative inflowing sediment mass (kg)
 				advsedchinmass[isolid][i][j][0] = advsedchinmass[isolid][i][j][0]
-					+ (float)(advsedchinflux[isolid][i][j][0] * dt[idt] / 1000.0);
+					+ advsedchinflux[isolid][i][j][0] * dt[idt] / 1000.0;
 
 				//compute the cumulative outflowing sediment mass (kg)
 				advsedchoutmass[isolid][i][j][0] = advsedchoutmass[isolid][i][j][0]
-					+ (float)(advsedchoutflux[isolid][i][j][0] * dt[idt] / 1000.0);
+					+ advsedchoutflux[isolid][i][j][0] * dt[idt] / 1000.0;
 
-				//Compute the cumulative (net) solids mass entering the domain from a point source (kg)
-				totalswch[isolid] = totalswch[isolid]
-					+ (float)((advsedchinflux[isolid][i][j][0]
-					- advsedchoutflux[isolid][i][j][0]) * dt[idt] / 1000.0);
+				//Compute the (net) solids mass entering the domain from a point source in the current time step (kg)
+				pendingswch[isolid] = pendingswch[isolid]
+					+ (advsedchinflux[isolid][i][j][0]
+					- advsedchoutflux[isolid][i][j][0]) * dt[idt] / 1000.0;
 
 				//loop over sources (including floodplain, source 9)
 				for(k=1; k<=9; k++)
 				{
 					//compute the cumulative inflowing sediment mass (kg)
 					advsedchinmass[isolid][i][j][k] = advsedchinmass[isolid][i][j][k]
-						+ (float)(advsedchinflux[isolid][i][j][k] * dt[idt] / 1000.0);
+						+ advsedchinflux[isolid][i][j][k] * dt[idt] / 1000.0;
 
 					//compute the cumulative outflowing sediment mass (kg)
 					advsedchoutmass[isolid][i][j][k] = advsedchoutmass[isolid][i][j][k]
-						+ (float)(advsedchoutflux[isolid][i][j][k] * dt[idt] / 1000.0);
+						+ advsedchoutflux[isolid][i][j][k] * dt[idt] / 1000.0;
+
+					//if channel dispersion budgets are tracked (trackdspchmass > 0)
+					if(trackdspchmass > 0)
+					{
+						//compute the cumulative in-dispersing sediment mass (kg)
+						dspsedchinmass[isolid][i][j][k] = dspsedchinmass[isolid][i][j][k]
+							+ dspsedchinflux[isolid][i][j][k] * dt[idt] / 1000.0;
 
-					//compute the cumulative in-dispersing sediment mass (kg)
-					dspsedchinmass[isolid][i][j][k] = dspsedchinmass[isolid][i][j][k]
-						+ (float)(dspsedchinflux[isolid][i][j][k] * dt[idt] / 1000.0);
+						//compute the cumulative out-dispersing sediment mass (kg)
+						dspsedchoutmass[isolid][i][j][k] = dspsedchoutmass[isolid][i][j][k]
+								+ dspsedchoutflux[isolid][i][j][k] * dt[idt] / 1000.0;
 
-					//compute the cumulative out-dispersing sediment mass (kg)
-					dspsedchoutmass[isolid][i][j][k] = dspsedchoutmass[isolid][i][j][k]
-							+ (float)(dspsedchoutflux[isolid][i][j][k] * dt[idt] / 1000.0);
+					}	//end if trackdspchmass > 0
 
 				}	//end loop over sources
 
@@ -349,35 +397,45 @@ void ChannelSolidsConcentration()
 				{
 					//compute the cumulative inflowing sediment mass (kg)
 					advsedchinmass[isolid][i][j][10] = advsedchinmass[isolid][i][j][10]
-						+ (float)(advsedchinflux[isolid][i][j][10] * dt[idt] / 1000.0);
+						+ advsedchinflux[isolid][i][j][10] * dt[idt] / 1000.0;
 
 					//compute the cumulative outflowing sediment mass (kg)
 					advsedchoutmass[isolid][i][j][10] = advsedchoutmass[isolid][i][j][10]
-						+ (float)(advsedchoutflux[isolid][i][j][10] * dt[idt] / 1000.0);
+						+ advsedchoutflux[isolid][i][j][10] * dt[idt] / 1000.0;
 
-					//compute the cumulative in-dispersing sediment mass (kg)
-					dspsedchinmass[isolid][i][j][10] = dspsedchinmass[isolid][i][j][10]
-						+ (float)(dspsedchinflux[isolid][i][j][10] * dt[idt] / 1000.0);
+					//if channel dispersion budgets are tracked (trackdspchmass > 0)
+					if(trackdspchmass > 0)
+					{
+						//compute the cumulative in-dispersing sediment mass (kg)
+						dspsedchinmass[isolid][i][j][10] = dspsedchinmass[isolid][i][j][10]
+							+ dspsedchinflux[isolid][i][j][10] * dt[idt] / 1000.0;
+
+						//compute the cumulative out-dispersing sediment mass (kg)
+						dspsedchoutmass[isolid][i][j][10] = dspsedchoutmass[isolid][i][j][10]
+								+ dspsedchoutflux[isolid][i][j][10] * dt[idt] / 1000.0;
 
-					//compute the cumulative out-dispersing sediment mass (kg)
-					dspsedchoutmass[isolid][i][j][10] = dspsedchoutmass[isolid][i][j][10]
-							+ (float)(dspsedchoutflux[isolid][i][j][10] * dt[idt] / 1000.0);
+					}	//end if trackdspchmass > 0
 
 					//Compute the cumulative solids mass exiting the domain at this outlet (kg)
 					totaladvsedoutch[isolid][qchoutlet[i]] = totaladvsedoutch[isolid][qchoutlet[i]]
-						+ (float)(advsedchoutflux[isolid][i][j][10] * dt[idt] / 1000.0);
+						+ advsedchoutflux[isolid][i][j][10] * dt[idt] / 1000.0;
 
 					//Compute the cumulative solids mass entering the domain at this outlet (kg)
 					totaladvsedinch[isolid][qchoutlet[i]] = totaladvsedinch[isolid][qchoutlet[i]]
-						+ (float)(advsedchinflux[isolid][i][j][10] * dt[idt] / 1000.0);
+						+ advsedchinflux[isolid][i][j][10] * dt[idt] / 1000.0;
 
-					//Compute the cumulative solids mass exiting the domain at this outlet (kg)
-					totaldspsedoutch[isolid][qchoutlet[i]] = totaldspsedoutch[isolid][qchoutlet[i]]
-						+ (float)(dspsedchoutflux[isolid][i][j][10] * dt[idt] / 1000.0);
+					//if channel dispersion budgets are tracked (trackdspchmass > 0)
+					if(trackdspchmass > 0)
+					{
+						//Compute the cumulative solids mass exiting the domain at this outlet (kg)
+						totaldspsedoutch[isolid][qchoutlet[i]] = totaldspsedoutch[isolid][qchoutlet[i]]
+							+ dspsedchoutflux[isolid][i][j][10] * dt[idt] / 1000.0;
 
-					//Compute the cumulative solids mass entering the domain at this outlet (kg)
-					totaldspsedinch[isolid][qchoutlet[i]] = totaldspsedinch[isolid][qchoutlet[i]]
-						+ (float)(dspsedchinflux[isolid][i][j][10] * dt[idt] / 1000.0);
+						//Compute the cumulative solids mass entering the domain at this outlet (kg)
+						totaldspsedinch[isolid][qchoutlet[i]] = totaldspsedinch[isolid][qchoutlet[i]]
+							+ dspsedchinflux[isolid][i][j][10] * dt[idt] / 1000.0;
+
+					}	//end if trackdspchmass > 0
 
 					//compute sediment discharge (kg/s) (advection plus dispersion)
 					sedflow = (float)((advsedchoutflux[isolid][i][j][10]
@@ -453,8 +511,13 @@ void ChannelSolidsConcentration()
 					{
 						//Warn user of possible numerical instability (do not abort)
 						//
-						//Report error type (negative concentration in channel) and location
-						SimulationError(5, i, j, isolid);
+						//if the time step cannot be rejected (step recovery is off or no retries remain)
+						if(RejectStep(5, i, j, isolid) == 0)
+						{
+							//Report error type (negative concentration in channel) and location
+							SimulationError(5, i, j, isolid);
+
+						}	//end if RejectStep() == 0
 
 						//Reset the new concentration to exactly zero anyway...
 						csedchnew[isolid][i][j][0] = 0.0;
@@ -463,6 +526,10 @@ void ChannelSolidsConcentration()
 
 				}	//end if newmassch < 0.0
 
+				//add the new water column mass to the streamed storage (kg)
+				mbsolidsstep[isolid][MSWATERCH] = mbsolidsstep[isolid][MSWATERCH]
+					+ csedchnew[isolid][i][j][0] * newwatervol / 1000.0;
+
 				//Check if present link/node is a solids reporting station...
 				//
 				//Loop over number of flow reporting stations
@@ -645,6 +712,11 @@ void ChannelSolidsConcentration()
 
 				}	//end of newsedvol >= TOLERANCE
 
+				//add the change of surface layer mass to the streamed sediment storage (kg)
+				mbsolidsstep[isolid][MSBEDCH] = mbsolidsstep[isolid][MSBEDCH]
+					+ (csedchnew[isolid][i][j][ilayer] * newsedvol
+					- csedch[isolid][i][j][ilayer] * sedvol) / 1000.0;
+
 			}	//end loop over solids
 
 			//Assign global value of new surface sediment layer volume (m3)
@@ -654,8 +726,10 @@ void ChannelSolidsConcentration()
 			//  the maximum volume limit
 			if(newsedvol >= maxvlayerch[i][j][ilayer])
 			{
-				//raise the push flag for the channel network
-				pushchflag = 1;
+				//add the node to the push list for the channel network (processed by PushSedimentStack)
+				npushch = npushch + 1;
+				pushchlink[npushch] = i;
+				pushchnode[npushch] = j;
 
 			}	//end if newsedvol>= maxvlayerch[][][]
 
@@ -663,8 +737,10 @@ void ChannelSolidsConcentration()
 			//  volume limit and there are more layers in the stack
 			if(newsedvol <= minvlayerch[i][j][ilayer] && ilayer > 1)
 			{
-				//raise the pop flag for the channel network
-				popchflag = 1;
+				//add the node to the pop list for the channel network (processed by PopSedimentStack)
+				npopch = npopch + 1;
+				popchlink[npopch] = i;
+				popchnode[npopch] = j;
 
 			}	//end if newsedvol >= maxvlayerch[][][]
 
@@ -28,6 +28,15 @@ C-              Denver, CO 80225
 C-
 C-	Date:		29-DEC-2003
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	The kernel takes a range of solids types
+C-              (isolidfirst to isolidlast) so that each solids type
+C-              can be computed as a separate task (see
+C-              SpeciesTasks).
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -45,7 +54,7 @@ C----------------------------------------------------------------------*/
 //trex global variable declarations for sediment transport
 #include "trex_solids_declarations.h"
 
-void ChannelSolidsDeposition()
+void ChannelSolidsDeposition(int isolidfirst, int isolidlast)
 {
 	//local variable declarations/definitions
 	int
@@ -158,7 +167,7 @@ void ChannelSolidsDeposition()
 			ilayer = nstackch[i][j];
 
 			//loop over number of solids types
-			for(isolid=1; isolid<=nsolids; isolid++)
+			for(isolid=isolidfirst; isolid<=isolidlast; isolid++)
 			{
 				//Initialize gross deposition flow array for use this time step...
 				depflowch[isolid][i][j] = 0.0;
@@ -59,6 +59,15 @@ C-  Revisions:  Revised controls so that grain shear partitioning
 C-              occurs when erschopt > 1 (allows for originl TREX
 C-              behavior (where tau = tau total).
 C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Start the new maximum shear stress of each node from
+C-              its present shear stress history.  A maximum shear
+C-              stress below the critical shear stress no longer
+C-              gives a NaN erosion amount for cohesive solids.
+C-
 C-  Revised:
 C-
 C-  Date:
@@ -249,6 +258,15 @@ void ChannelSolidsErosion()
 			//compute present water column volume (m3) (at time t)
 			watervol = achcross * chanlength[i][j];
 
+			//if the channel erosion option > 2
+			if(erschopt > 2)
+			{
+				//start from the present shear stress history of the node
+				newtaumax = taumaxch[i][j];
+				newtautime = taumaxtimech[i][j];
+
+			}	//end if erschopt > 2
+
 			//loop over number of solids types
 			for(isolid=1; isolid<=nsolids; isolid++)
 			{
@@ -290,10 +308,15 @@ void ChannelSolidsErosion()
 						if(tau > tcech[isolid] && tau > taumaxch[i][j])
 						{
 							//compute the erosion amount (g/m2)
+							//
+							//  Note: a maximum shear stress below the critical
+							//        shear stress (no prior exposure) has not
+							//        eroded any sediment.
+							//
 							epsilon = (float)(aych[i][j] / zagech[isolid]
 								* pow((tau/tcech[isolid] - 1.0), mexpch[i][j])
 								- aych[i][j] / zagech[isolid]
-								* pow((taumaxch[i][j]/tcech[isolid] - 1.0), mexpch[i][j]));
+								* pow((Max(taumaxch[i][j], tcech[isolid])/tcech[isolid] - 1.0), mexpch[i][j]));
 
 							//store the maximum shear stress (N/m2)
 							newtaumax = tau;
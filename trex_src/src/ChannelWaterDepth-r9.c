@@ -12,11 +12,13 @@ C-              deadstoragedepth[][], chanlength[][], dt[], hov[][],
 C-              ichnrow[][], ichncol[][]  (Globals)
 C-
 C-	Outputs:	hchnew[][], hovnew[][] (values at time t+dt)(Globals)
-C-              vchintermediate[][]
+C-              vchintermediate[][], minhchdepth, maxhchdepth,
+C-              mbstep[]
 C-
 C-	Controls:   ksim
 C-
-C-	Calls:		SimulationError
+C-	Calls:		RejectStep, SimulationError, ClearMassBalanceStep,
+C-              ChannelWaterVolume
 C-
 C-	Called by:	WaterBalance
 C-
@@ -86,6 +88,35 @@ C-              to prevent taking the square root of a negative
 C               number when calculating the new water depth of
 C-              trapezoidal or triangular channels.
 C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Overland source/direction slots are addressed
+C-              through OVSLOT (compact overland slot storage).
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Minimum and maximum depths updated with new depths.
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Time steps with a negative depth or concentration
+C-              are rejected (RejectStep) when step recovery is
+C-              enabled.
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  The volumes of the time step are added to the
+C-              streamed water mass balance (mbstep, see
+C-              MassBalanceMonitor).
+C-
 C-  Revised:
 C-
 C-	Date:
@@ -136,6 +167,9 @@ void ChannelWaterDepth()
 	//                   balance as well.  However, this feature is not
 	//                   included in the present version...
 	//
+	//Clear the channel mass balance terms of this time step (see MassBalanceMonitor)
+	ClearMassBalanceStep(MBNETRAINCH, MBWATERCH);
+
 	//Loop over number of links
 	for(i=1; i<=nlinks; i++)
 	{
@@ -238,10 +272,15 @@ void ChannelWaterDepth()
 						//If the discriminant (b^2 - 4ac) is negative
 						if(sqrt(pow(bwch,2.0) - 4.0*sslope*(-achnew)) < 0.0)
 						{
-							//Report error type (negative water depth in channel) and location
-							SimulationError(3, i, j, 0);
+							//if the time step cannot be rejected (step recovery is off or no retries remain)
+							if(RejectStep(3, i, j, 0) == 0)
+							{
+								//Report error type (negative water depth in channel) and location
+								SimulationError(3, i, j, 0);
 
-							exit(EXIT_FAILURE);	//abort
+								exit(EXIT_FAILURE);	//abort
+
+							}	//end if RejectStep() == 0
 
 						}	//end the discriminant (b^2 - 4ac) < 0.0
 
@@ -297,10 +336,15 @@ void ChannelWaterDepth()
 				}	
 				else	//the error is numerical instability
 				{
-					//Report error type (negative water depth in channel) and location
-					SimulationError(3, i, j, 0);
+					//if the time step cannot be rejected (step recovery is off or no retries remain)
+					if(RejectStep(3, i, j, 0) == 0)
+					{
+						//Report error type (negative water depth in channel) and location
+						SimulationError(3, i, j, 0);
 
-					exit(EXIT_FAILURE);	//abort
+						exit(EXIT_FAILURE);	//abort
+
+					}	//end if RejectStep() == 0
 
 				}	//end check for round-off error
 
@@ -314,6 +358,13 @@ void ChannelWaterDepth()
 
 			}	//end if hchnew[i][j] < TOLERANCE
 
+			//Determine the minimum and the maximum water depths in channels
+			minhchdepth = Min(minhchdepth,hchnew[i][j]);
+			maxhchdepth = Max(maxhchdepth,hchnew[i][j]);
+
+			//Add the new water volume of the node to the channel storage (m3)
+			mbstep[MBWATERCH] = mbstep[MBWATERCH] + ChannelWaterVolume(i, j, hchnew[i][j]);
+
 			/****************************************************/
 			/*     Update Cumulative Mass Balance Variables     */
 			/****************************************************/
@@ -328,6 +379,10 @@ void ChannelWaterDepth()
 			netrainvol[row][col] = netrainvol[row][col]
 				+ grossrainrate[row][col] * achsurf * dt[idt];
 
+			//Add the rainfall volume onto the channel to the step mass balance (m3)
+			mbstep[MBNETRAINCH] = mbstep[MBNETRAINCH]
+				+ grossrainrate[row][col] * achsurf * dt[idt];
+
 			//if snowfall is simulated as falling snow
 			if(snowopt > 0 && snowopt <= 3)
 			{
@@ -335,6 +390,10 @@ void ChannelWaterDepth()
 				netswevol[row][col] = netswevol[row][col]
 					+ grossswerate[row][col] * achsurf * dt[idt];
 
+				//Add the snowfall volume onto the channel to the step mass balance (m3)
+				mbstep[MBNETSWECH] = mbstep[MBNETSWECH]
+					+ grossswerate[row][col] * achsurf * dt[idt];
+
 			}	//endif snowopt > 1 && snowopt <= 3
 
 			//Transmission Loss...
@@ -367,6 +426,10 @@ void ChannelWaterDepth()
 				translossvol[i][j] = translossvol[i][j]
 					+ translossrate[i][j] * abed * dt[idt];
 
+				//Add the transmission loss volume to the step mass balance (m3)
+				mbstep[MBTRANSLOSS] = mbstep[MBTRANSLOSS]
+					+ translossrate[i][j] * abed * dt[idt];
+
 			}	//end if ctlopt > 0
 
 			//Gross outflow and inflow volumes...
@@ -415,6 +478,10 @@ void ChannelWaterDepth()
 		//Compute cumulative flow volume enterng domain from this link (m3)
 		qinchvol[i] = qinchvol[i] + qinch[i] * dt[idt];
 
+		//Add the boundary flow volumes of this link to the step mass balance (m3)
+		mbstep[MBQOUTCH] = mbstep[MBQOUTCH] + qoutch[i] * dt[idt];
+		mbstep[MBQINCH] = mbstep[MBQINCH] + qinch[i] * dt[idt];
+
 		//set node number for last node of link
 		j = nnodes[i];
 
@@ -452,6 +519,9 @@ void ChannelWaterDepth()
 		//Compute sum of external flow volumes (m3)
 		qwchvol[i][j] = qwchvol[i][j] + qwchinterp[k] * dt[idt];
 
+		//Add the external flow volume to the step mass balance (m3)
+		mbstep[MBQWCH] = mbstep[MBQWCH] + qwchinterp[k] * dt[idt];
+
 	}	//end loop over number of external flow sources
 
 	//Cumulative mass balance for floodplain water transfers...
@@ -479,16 +549,16 @@ void ChannelWaterDepth()
 					+ dqchin[i][j][9] * dt[idt];
 
 				//increment cumulative cell outflow volume (m3)
-				dqovoutvol[row][col][9] = dqovoutvol[row][col][9]
-					+ dqovout[row][col][9] * dt[idt];
+				dqovoutvol[row][col][OVSLOT(9)] = dqovoutvol[row][col][OVSLOT(9)]
+					+ dqovout[row][col][OVSLOT(9)] * dt[idt];
 
 				//increment cumulative node outflow volume (m3)
 				dqchoutvol[i][j][9] = dqchoutvol[i][j][9]
 					+ dqchout[i][j][9] * dt[idt];
 
 				//increment cumulative overland cell inflow volume (m3)
-				dqovinvol[row][col][9] = dqovinvol[row][col][9]
-					+ dqovin[row][col][9] * dt[idt];
+				dqovinvol[row][col][OVSLOT(9)] = dqovinvol[row][col][OVSLOT(9)]
+					+ dqovin[row][col][OVSLOT(9)] * dt[idt];
 
 			}	//end loop over nodes
 
@@ -514,8 +584,8 @@ void ChannelWaterDepth()
 					+ dqchin[i][j][9] * dt[idt];
 
 				//increment cumulative cell outflow volume (m3)
-				dqovoutvol[row][col][9] = dqovoutvol[row][col][9]
-					+ dqovout[row][col][9] * dt[idt];
+				dqovoutvol[row][col][OVSLOT(9)] = dqovoutvol[row][col][OVSLOT(9)]
+					+ dqovout[row][col][OVSLOT(9)] * dt[idt];
 
 			}	//end loop over nodes
 
@@ -15,7 +15,7 @@ C-              dqchout[][][] (Global)
 C-
 C-	Controls:   None
 C-
-C-	Calls:      None
+C-	Calls:      BatchPow, PowValue
 C-
 C-	Called by:	WaterTransport.c
 C-
@@ -84,6 +84,15 @@ C-	Revisions:	Revised Courant number calculations to permit time
 C-              step option (dtopt) implementation.  Cumulative mass
 C-              balance calculations were moved to ChannelWaterDepth.
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Nodes are processed in batches of up to
+C-              POWBATCHSIZE. The Manning power law of a batch is
+C-              evaluated by BatchPow; the flows are applied in the
+C-              original node order. Junction flows use PowValue.
+C-
 C-	Revised:
 C-
 C-	Date:	
@@ -98,6 +107,17 @@ C---------------------------------------------------------------------*/
 //trex global variable declarations for water transport
 #include "trex_water_declarations.h"
 
+//Batch of channel nodes (gathered by ChannelWaterRoute)
+static int
+	nodeflow[POWBATCHSIZE];		//flow occurs at the node (0 = no, 1 = yes)
+
+static float
+	nodesign[POWBATCHSIZE],		//sign of the flow direction (a)
+	nodearea[POWBATCHSIZE];		//cross-sectional area of flow (m2)
+
+static double
+	noderadius[POWBATCHSIZE];	//hydraulic radius (then rh^0.6667)
+
 void ChannelWaterRoute()
 {
 	//Local variable declarations/definitions
@@ -113,7 +133,9 @@ void ChannelWaterRoute()
 
 		l,			//loop counter (for nested loop over branches)
 		kup,		//upstream direction from a downstream node (1-8)
-		kdown;		//downstream direction from the present node (1-8)
+		kdown,		//downstream direction from the present node (1-8)
+		jbatch,		//first node of a batch of nodes
+		nbatch;		//number of nodes in a batch
 
 	float
 		upbed,		//bed elevation of upstream node
@@ -253,180 +275,231 @@ void ChannelWaterRoute()
 		//junctions from the last node of the link to the first node
 		//of all downstream branches is performed in a seperate loop.
 		//
-		//Loop over nodes in curent link
-		for(j=1; j<=nnodes[i]-1; j++)
+		//Note:  The nodes of the link are processed in batches of up to
+		//       POWBATCHSIZE nodes.  The hydraulic radii of the nodes of a
+		//       batch are gathered first, the Manning power law of the
+		//       batch is evaluated by BatchPow, and the flows are then
+		//       computed and applied in node order...
+		//
+		//Loop over batches of nodes in current link
+		for(jbatch=1; jbatch<=nnodes[i]-1; jbatch=jbatch+POWBATCHSIZE)
 		{
-			//Compute channel bed slope, so
-			//
-			//Compute bed elevation at present (upstream) node
-			upbed = elevationch[i][j];
+			//set the number of nodes in the batch
+			nbatch = nnodes[i] - jbatch;
 
-			//Compute bed elevation of downstream node
-			downbed = elevationch[i][j+1];
+			//if the remaining nodes exceed the batch size
+			if(nbatch > POWBATCHSIZE)
+			{
+				//limit the batch to the batch size
+				nbatch = POWBATCHSIZE;
+			}
 
-			//Compute bed slope
-			so = (upbed - downbed) / chanlength[i][j];
+			//Loop over nodes in the batch (gather)
+			for(j=jbatch; j<jbatch+nbatch; j++)
+			{
+				//Compute channel bed slope, so
+				//
+				//Compute bed elevation at present (upstream) node
+				upbed = elevationch[i][j];
 
-			//Compute water surface slope, dh/dx
-			dhdx = (hch[i][j+1] - hch[i][j]) / chanlength[i][j];
+				//Compute bed elevation of downstream node
+				downbed = elevationch[i][j+1];
 
-			//Compute friction slope, sf
-			sf = so - dhdx;
+				//Compute bed slope
+				so = (upbed - downbed) / chanlength[i][j];
 
-			//Store friction slope for use in sediment transport computations
-			sfch[i][j] = sf;
+				//Compute water surface slope, dh/dx
+				dhdx = (hch[i][j+1] - hch[i][j]) / chanlength[i][j];
 
-			//Assign channel characteristics between nodes
-			bwch = bwidth[i][j];				//bottom width (m)
-			hbch = hbank[i][j];					//bank height (m)
-			sslope = sideslope[i][j];			//side slope (dimensionless)
-			nch = nmanningch[i][j];				//Manning n for channel (not dimensionless)
-			stordep = deadstoragedepth[i][j];	//dead storage depth (m)
-			twch = twidth[i][j];				//top width at top of bank (m)
+				//Compute friction slope, sf
+				sf = so - dhdx;
 
-			//if channel transmission loss is simulated (ctlopt > 0)
-			if(ctlopt > 0)
-			{
-				//set node transmission loss depth for current time step
-				tloss = translossrate[i][j] * dt[idt];
-			}
-			else	//transmission loss is not simulated
-			{
-				//set tloss to zero (no transmission loss)
-				tloss = 0.0;
+				//Store friction slope for use in sediment transport computations
+				sfch[i][j] = sf;
 
-			}	//end if ctlopt > 0 (transmission loss is simulated)
+				//Assign channel characteristics between nodes
+				bwch = bwidth[i][j];				//bottom width (m)
+				hbch = hbank[i][j];					//bank height (m)
+				sslope = sideslope[i][j];			//side slope (dimensionless)
+				nch = nmanningch[i][j];				//Manning n for channel (not dimensionless)
+				stordep = deadstoragedepth[i][j];	//dead storage depth (m)
+				twch = twidth[i][j];				//top width at top of bank (m)
 
-			//if the friction slope is positive (or zero) (flow is in downstream direction)
-			if(sf >= 0.0) 
-			{
-				//set the sign = +1 to send flow in downstream direction
-				a = 1.0;
+				//if channel transmission loss is simulated (ctlopt > 0)
+				if(ctlopt > 0)
+				{
+					//set node transmission loss depth for current time step
+					tloss = translossrate[i][j] * dt[idt];
+				}
+				else	//transmission loss is not simulated
+				{
+					//set tloss to zero (no transmission loss)
+					tloss = 0.0;
 
-				//Flow depth is water depth in channel of present (upstream) link/node
-				hchan = hch[i][j];			//water depth in channel (m)
-			}
-			else if(sf < 0.0)	//friction slope is negative (flow in upstream direction)
-			{
-				//set the sign = -1 to send flow in upstream direction
-				a = -1.0;
+				}	//end if ctlopt > 0 (transmission loss is simulated)
 
-				//Flow depth is water depth in channel of downstream link/node
-				hchan = hch[i][j+1];		//water depth in channel (m)
+				//if the friction slope is positive (or zero) (flow is in downstream direction)
+				if(sf >= 0.0) 
+				{
+					//set the sign = +1 to send flow in downstream direction
+					a = 1.0;
 
-			}	//end if sf >= 0 (or < 0)
+					//Flow depth is water depth in channel of present (upstream) link/node
+					hchan = hch[i][j];			//water depth in channel (m)
+				}
+				else if(sf < 0.0)	//friction slope is negative (flow in upstream direction)
+				{
+					//set the sign = -1 to send flow in upstream direction
+					a = -1.0;
 
-			//Channel flow will occur when the local water depth exceeds
-			//the dead storage depth and the equivalent depth of the
-			//transmission loss.  (This should prevent negative flows...)
-			//
-			//	if((hchan > (stordep + transloss)) && sf != 0.0)
-			//
-			//if the depth is sufficient for channel flow and sf not zero
-			if(hchan > (stordep + tloss) && sf != 0.0)
-			{
-				//if channel depth <= bank height
-				if(hchan <= hbch)	//Flow depth less than channel depth
+					//Flow depth is water depth in channel of downstream link/node
+					hchan = hch[i][j+1];		//water depth in channel (m)
+
+				}	//end if sf >= 0 (or < 0)
+
+				//Channel flow will occur when the local water depth exceeds
+				//the dead storage depth and the equivalent depth of the
+				//transmission loss.  (This should prevent negative flows...)
+				//
+				//	if((hchan > (stordep + transloss)) && sf != 0.0)
+				//
+				//if the depth is sufficient for channel flow and sf not zero
+				if(hchan > (stordep + tloss) && sf != 0.0)
 				{
-					//Cross-sectional area for trapezoidal, triangular, or rectangular channel
-					area = (bwch + sslope * (hchan - stordep)) * (hchan - stordep);
+					//if channel depth <= bank height
+					if(hchan <= hbch)	//Flow depth less than channel depth
+					{
+						//Cross-sectional area for trapezoidal, triangular, or rectangular channel
+						area = (bwch + sslope * (hchan - stordep)) * (hchan - stordep);
 
-					//Wetted perimeter for trapezoidal, triangular, or rectangular channel
-					wp = (float)(bwch + 2.0 * (hchan - stordep) * sqrt(1.0 + sslope * sslope));
+						//Wetted perimeter for trapezoidal, triangular, or rectangular channel
+						wp = (float)(bwch + 2.0 * (hchan - stordep) * sqrt(1.0 + sslope * sslope));
+					}
+					else	//Flow depth greater than channel depth
+					{
+						//Cross-sectional area for trapezoidal, triangular, or rectangular channel
+						//plus rectangular area above bank height
+						area = (bwch + sslope * (hchan - stordep)) * (hchan - stordep)
+							+ (hchan - hbch) * twch;
+
+						//Wetted perimeter for trapezoidal, triangular, or rectangular channel
+						//plus rectangular perimeter above bank height
+						wp = (float)(bwch + 2.0 * (hbch - stordep) * sqrt(1.0 + sslope * sslope)
+							+ 2.0 * (hchan - hbch));
+
+					}	//end if hchan <= bank height
+
+					//Compute hydraulic radius (m)
+					rh = area / wp;
+
+					//Gather the node for the batch (flow is computed below)
+					nodeflow[j-jbatch] = 1;
+					nodearea[j-jbatch] = area;
+					noderadius[j-jbatch] = rh;
 				}
-				else	//Flow depth greater than channel depth
+				else	//hchan not sufficient or sf = 0 (no flow occurs)
 				{
-					//Cross-sectional area for trapezoidal, triangular, or rectangular channel
-					//plus rectangular area above bank height
-					area = (bwch + sslope * (hchan - stordep)) * (hchan - stordep)
-						+ (hchan - hbch) * twch;
+					//no flow at this node (radius set to 1.0 for the batch)
+					nodeflow[j-jbatch] = 0;
+					noderadius[j-jbatch] = 1.0;
 
-					//Wetted perimeter for trapezoidal, triangular, or rectangular channel
-					//plus rectangular perimeter above bank height
-					wp = (float)(bwch + 2.0 * (hbch - stordep) * sqrt(1.0 + sslope * sslope)
-						+ 2.0 * (hchan - hbch));
+				}	//end if hchan > stordep and sf not zero
 
-				}	//end if hchan <= bank height
+				//store the flow direction
+				nodesign[j-jbatch] = a;
 
-				//Compute hydraulic radius (m)
-				rh = area / wp;
+			}	//end loop over nodes in the batch (gather)
 
-				//Determine flow velocity (m/s) using Manning equation
-				velocity = (float)(sqrt(fabs(sf))/nch * pow(rh,0.6667));
+			//Evaluate the Manning power law of the batch: rh^0.6667
+			BatchPow(noderadius, nbatch, powplanchradius);
 
-				//Determinine channel discharge (the direction of flow is set by "a")
-				dq = (float)(a * velocity * area);	//flow potential (m3/s)
-			}
-			else	//hchan not sufficient or sf = 0 (no flow occurs)
+			//Loop over nodes in the batch (apply)
+			for(j=jbatch; j<jbatch+nbatch; j++)
 			{
-				//Flow velocity is zero
-				velocity = 0.0;
+				//set the flow direction
+				a = nodesign[j-jbatch];
 
-				//Flow is zero
-				dq = 0.0;
+				//if flow occurs at this node
+				if(nodeflow[j-jbatch] == 1)
+				{
+					//Determine flow velocity (m/s) using Manning equation
+					velocity = (float)(sqrt(fabs(sfch[i][j]))/nmanningch[i][j] * noderadius[j-jbatch]);
 
-			}	//end if hchan > stordep and sf not zero
+					//Determinine channel discharge (the direction of flow is set by "a")
+					dq = (float)(a * velocity * nodearea[j-jbatch]);	//flow potential (m3/s)
+				}
+				else	//no flow occurs
+				{
+					//Flow velocity is zero
+					velocity = 0.0;
 
-			//Compute courant number for this node:
-			//
-			//  courant = velocity * dt / chanlength
-			//
-			//Compute channel Courant number
-			courant = velocity * dt[idt] / chanlength[i][j];
+					//Flow is zero
+					dq = 0.0;
 
-			//Determine maximum channel Courant number
-			maxcourantch = (float)Max(maxcourantch, courant);
+				}	//end if nodeflow == 1
 
-			//Transfer flow from present (upstream) cell
-			dqch[i][j] = dqch[i][j] - dq;
+				//Compute courant number for this node:
+				//
+				//  courant = velocity * dt / chanlength
+				//
+				//Compute channel Courant number
+				courant = velocity * dt[idt] / chanlength[i][j];
 
-			//Transfer flow to downstream cell
-			dqch[i][j+1] = dqch[i][j+1] + dq;
+				//Determine maximum channel Courant number
+				maxcourantch = (float)Max(maxcourantch, courant);
 
-			//store nodal flow for sediment and chemical transport computations...
-			//
-			//Interior node
-			//
-			//if the flow is in the downstream direction (a = 1.0)
-			if(a == 1.0)
-			{
-				//Gross outflow from present (upstream) node (m3/s)
-				dqchout[i][j][downdirection[i][j][0]] = dq;
+				//Transfer flow from present (upstream) cell
+				dqch[i][j] = dqch[i][j] - dq;
 
-				//Gross inflow to downstream node (m3/s)
-				dqchin[i][j+1][updirection[i][j+1][0]] = dq;
-			}
-			else	// flow is in the reverse direction (a = -1.0)
-			{
-				//Gross outflow from upgradient node (m3/s)
-				dqchout[i][j+1][updirection[i][j+1][0]] = (float)fabs(dq);
+				//Transfer flow to downstream cell
+				dqch[i][j+1] = dqch[i][j+1] + dq;
 
-				//Gross inflow to downgradient (present) node (m3/s)
-				dqchin[i][j][downdirection[i][j][0]] = (float)fabs(dq);
+				//store nodal flow for sediment and chemical transport computations...
+				//
+				//Interior node
+				//
+				//if the flow is in the downstream direction (a = 1.0)
+				if(a == 1.0)
+				{
+					//Gross outflow from present (upstream) node (m3/s)
+					dqchout[i][j][downdirection[i][j][0]] = dq;
 
-			}	//end if a = 1.0 (or -1.0)
+					//Gross inflow to downstream node (m3/s)
+					dqchin[i][j+1][updirection[i][j+1][0]] = dq;
+				}
+				else	// flow is in the reverse direction (a = -1.0)
+				{
+					//Gross outflow from upgradient node (m3/s)
+					dqchout[i][j+1][updirection[i][j+1][0]] = (float)fabs(dq);
 
-			//Check if present link/node is a flow reporting station...
-			//
-			//get row of present node
-			row = ichnrow[i][j];
+					//Gross inflow to downgradient (present) node (m3/s)
+					dqchin[i][j][downdirection[i][j][0]] = (float)fabs(dq);
 
-			//get column of present node
-			col = ichncol[i][j];
+				}	//end if a = 1.0 (or -1.0)
 
-			//Loop over number of flow reporting stations
-			for (k=1; k<=nqreports; k++)
-			{
-				//If current cell is a flow reporting station
-				if(row == qreprow[k] && col == qrepcol[k])
+				//Check if present link/node is a flow reporting station...
+				//
+				//get row of present node
+				row = ichnrow[i][j];
+
+				//get column of present node
+				col = ichncol[i][j];
+
+				//Loop over number of flow reporting stations
+				for (k=1; k<=nqreports; k++)
 				{
-					//store the flow for reporting (m3/s)
-					qreportch[k] = dq;
-				}
+					//If current cell is a flow reporting station
+					if(row == qreprow[k] && col == qrepcol[k])
+					{
+						//store the flow for reporting (m3/s)
+						qreportch[k] = dq;
+					}
+
+				}	//end loop over reporting stations
 
-			}	//end loop over reporting stations
+				}	//end loop over nodes in the batch (apply)
 
-		}	//end loop over nodes (excluding junctions)
+			}	//end loop over batches of nodes (excluding junctions)
 
 		//Compute flow at junctions...
 		//
@@ -661,7 +734,7 @@ void ChannelWaterRoute()
 				rh = area / wp;
 
 				//Determine flow velocity (m/s) using Manning equation (at [i][j])
-				velocity = (float)(sqrt(fabs(sf))/nch * pow(rh,0.6667));
+				velocity = (float)(sqrt(fabs(sf))/nch * PowValue(rh, powplanchradius));
 
 				//Compute channel Courant number
 				courant = velocity * dt[idt] / chanlength[i][j];
@@ -919,7 +992,7 @@ void ChannelWaterRoute()
 						rh = area / wp;
 
 						//Determine flow potential velocity (m/s) using Manning equation
-						velbranch[k] = (float)(sqrt(fabs(sf))/nch * pow(rh,0.6667));
+						velbranch[k] = (float)(sqrt(fabs(sf))/nch * PowValue(rh, powplanchradius));
 
 						//Compute channel Courant number
 						courant = velbranch[k] * dt[idt] / chanlength[i][j];
@@ -13,7 +13,9 @@ C-  Outputs:    None
 C-
 C-  Controls:	infopt, chnopt, ctlopt
 C-
-C-  Calls:      OverlandChemicalKinetics,
+C-  Calls:      OverlandChemicalKinetics, RunSpeciesTasks,
+C-              OverlandChemicalTransportTask,
+C-              ChannelChemicalTransportTask,
 C-              OverlandChemicalInfiltration,
 C-              OverlandChemicalDeposition,
 C-              OverlandChemicalAdvection,
@@ -41,6 +43,15 @@ C-              Denver, CO 80225
 C-
 C-	Date:		10-MAR-2004
 C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  The overland and channel transport kernels run as
+C-              one task per chemical type
+C-              (OverlandChemicalTransportTask,
+C-              ChannelChemicalTransportTask, RunSpeciesTasks).
+C-
 C-  Revised:
 C-
 C-  Date:
@@ -66,56 +77,94 @@ void ChemicalTransport()
     //Compute kinetic processes (degradation, reactions...) for overland plane
 	OverlandChemicalKinetics();
 
+	//Note:  The overland transport kernels of each chemical type only
+	//       write the fluxes of that type, so they run as one task per
+	//       chemical type (on ntaskthreads threads, see SpeciesTasks).
+	//       Kinetics stay serial because yields transfer mass between
+	//       chemical types.
+	//
+	//Compute overland transport (infiltration, deposition, advection, dispersion, erosion)
+	RunSpeciesTasks(OverlandChemicalTransportTask, nchems);
+
+	//if channels are simulated
+	if(chnopt > 0)
+	{
+		//Compute kinetic processes (degradation, reactions...) for channels
+		ChannelChemicalKinetics();
+
+		//Compute channel transport (transmission loss, deposition, advection, dispersion, erosion, floodplain transfer)
+		RunSpeciesTasks(ChannelChemicalTransportTask, nchems);
+
+	}	//end if channels are simulated
+
+//End of function: Return to trex
+}
+
+//C
+//C
+			/*********************************************/
+			/*  FUNCTION: OverlandChemicalTransportTask  */
+			/*********************************************/
+
+/* Computes overland transport of chemical types ichemfirst to ichemlast */
+
+void OverlandChemicalTransportTask(int ichemfirst, int ichemlast)
+{
 	//if infiltration is simulated (infopt > 0)
 	if(infopt > 0)
 	{
 		//Compute overland chemical infiltration
-		OverlandChemicalInfiltration();
+		OverlandChemicalInfiltration(ichemfirst, ichemlast);
 
 	}	//end if infopt > 0
 
     //Compute effective deposition for overland plane (quiescent velocity * Pdep)
-	OverlandChemicalDeposition();
+	OverlandChemicalDeposition(ichemfirst, ichemlast);
 
 	//Compute overland advection
-	OverlandChemicalAdvection();
+	OverlandChemicalAdvection(ichemfirst, ichemlast);
 
 	//Compute overland dispersion
-	OverlandChemicalDispersion();
+	OverlandChemicalDispersion(ichemfirst, ichemlast);
 
 	//Compute erosion for overland plane
-	OverlandChemicalErosion();
+	OverlandChemicalErosion(ichemfirst, ichemlast);
 
-	//if channels are simulated
-	if(chnopt > 0)
-	{
-		//Compute kinetic processes (degradation, reactions...) for channels
-		ChannelChemicalKinetics();
+//End of function: Return to RunSpeciesTasks
+}
 
-		//if channel transmission loss is simulated (ctlopt > 0)
-		if(ctlopt > 0)
-		{
-			//Compute channel chemical transmission loss
-			ChannelChemicalTransmissionLoss();
+//C
+//C
+			/********************************************/
+			/*  FUNCTION: ChannelChemicalTransportTask  */
+			/********************************************/
 
-		}	//end if ctlopt > 0
+/* Computes channel transport of chemical types ichemfirst to ichemlast */
 
-		//Compute deposition for channels
-		ChannelChemicalDeposition();
+void ChannelChemicalTransportTask(int ichemfirst, int ichemlast)
+{
+	//if channel transmission loss is simulated (ctlopt > 0)
+	if(ctlopt > 0)
+	{
+		//Compute channel chemical transmission loss
+		ChannelChemicalTransmissionLoss(ichemfirst, ichemlast);
 
-		//Compute channel advection
-		ChannelChemicalAdvection();
+	}	//end if ctlopt > 0
 
-		//Compute channel dispersion
-		ChannelChemicalDispersion();
+	//Compute deposition for channels
+	ChannelChemicalDeposition(ichemfirst, ichemlast);
 
-		//Compute erosion for channels
-		ChannelChemicalErosion();
+	//Compute channel advection
+	ChannelChemicalAdvection(ichemfirst, ichemlast);
 
-		//Compute chemical transfers between overland plane and channels
-		FloodplainChemicalTransfer();
+	//Compute channel dispersion
+	ChannelChemicalDispersion(ichemfirst, ichemlast);
 
-	}	//end if channels are simulated
+	//Compute erosion for channels
+	ChannelChemicalErosion(ichemfirst, ichemlast);
 
-//End of function: Return to trex
+	//Compute chemical transfers between overland plane and channels
+	FloodplainChemicalTransfer(ichemfirst, ichemlast);
+
+//End of function: Return to RunSpeciesTasks
 }
@@ -4,13 +4,14 @@ C-
 C-  Purpose/
 C-  Methods:    Computes the final state of chemical variables
 C-              at the end of the simulation.
-C-  Inputs:     
+C-  Inputs:     cchemov[][][][] (at tend), cchemch[][][][] (at tend),
+C-              mbchemtotal[][]
 C-
-C-  Outputs:    
+C-  Outputs:    finalchemov[][][][], finalchemch[][][][]
 C-
-C-  Controls:   ksim
+C-  Controls:   ksim, chnopt, msbfile
 C-
-C-  Calls:      None
+C-  Calls:      ChemicalMassBalanceTotals
 C-
 C-  Called by:  ComputeFinalState
 C-
@@ -32,6 +33,22 @@ C-	Revisions:  Added calculation of chemical mass leaving surface soil
 C-              and sediment by infiltration and transmission loss as
 C-              over duration of sumulation.
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Overland source/direction slots are addressed
+C-              through OVSLOT (compact overland slot storage).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Domain totals are set from the streamed chemical
+C-              mass balance (ChemicalMassBalanceTotals).  The final
+C-              masses of each cell and node are only computed when
+C-              the mass balance file is written.
+C-
 C-	Revised:
 C-
 C-	Date:	
@@ -61,8 +78,7 @@ void ComputeFinalStateChemical()
 	int
 		ichem,		//loop index for chemical type
 		chanlink,	//channel link number
-		channode,	//channel node number
-		ilayer;		//layer number in soil or sediment stack
+		channode;	//channel node number
 
 	float
 		hflow,		//flow depth of channel (m)
@@ -74,6 +90,84 @@ void ComputeFinalStateChemical()
 		achcross,	//cross section area of channel (m)
 		achsurf;	//surface area of channel (m)
 
+	//Set the final chemical masses in the water column and the cumulative
+	//process masses of the domain from the streamed chemical mass balance
+	//(see MassBalanceMonitor)
+	ChemicalMassBalanceTotals();
+
+	//Loop over number of outlets
+	for(i=1; i<=noutlets; i++)
+	{
+		//loop over chemicals
+		for(ichem=1; ichem<=nchems; ichem++)
+		{
+			//Compute the cumulative chemical mass exiting the domain at all outlets (advection out)
+			totaladvchemoutov[ichem][0] = totaladvchemoutov[ichem][0]
+				+ advchemovoutmass[ichem][iout[i]][jout[i]][OVSLOT(10)];
+
+			//Compute the cumulative chemical mass entering the domain at all outlets (advection in)
+			totaladvcheminov[ichem][0] = totaladvcheminov[ichem][0]
+				+ advchemovinmass[ichem][iout[i]][jout[i]][OVSLOT(10)];
+
+			//Compute the cumulative chemical mass exiting the domain at all outlets (dispersion out)
+			totaldspchemoutov[ichem][0] = totaldspchemoutov[ichem][0]
+				+ dspchemovoutmass[ichem][iout[i]][jout[i]][OVSLOT(10)];
+
+			//Compute the cumulative chemical mass entering the domain at all outlets (dispersion in)
+			totaldspcheminov[ichem][0] = totaldspcheminov[ichem][0]
+				+ dspchemovinmass[ichem][iout[i]][jout[i]][OVSLOT(10)];
+
+		}	//end loop over chemicals
+
+	}	//end loop over outlets
+
+	//if channels are simulated
+	if(chnopt == 1)
+	{
+		//Loop over links
+		for(i=1; i<=nlinks; i++)
+		{
+			//if the link is an outlet link (the last node of the link is an outlet)
+			if(qchoutlet[i] > 0)
+			{
+				//loop over chemicals
+				for(ichem=1; ichem<=nchems; ichem++)
+				{
+					//Compute the cumulative chemical mass exiting the domain for all outlets
+					totaladvchemoutch[ichem][0] = totaladvchemoutch[ichem][0]
+						+ advchemchoutmass[ichem][i][nnodes[i]][10];
+
+					//Compute the cumulative chemical mass entering the domain for all outlets
+					totaladvcheminch[ichem][0] = totaladvcheminch[ichem][0]
+						+ advchemchinmass[ichem][i][nnodes[i]][10];
+
+					//Compute the cumulative chemical mass exiting the domain for all outlets
+					totaldspchemoutch[ichem][0] = totaldspchemoutch[ichem][0]
+						+ dspchemchoutmass[ichem][i][nnodes[i]][10];
+
+					//Compute the cumulative chemical mass entering the domain for all outlets
+					totaldspcheminch[ichem][0] = totaldspcheminch[ichem][0]
+						+ dspchemchinmass[ichem][i][nnodes[i]][10];
+
+				}	//end loop over chemicals
+
+			}	//end if qchoutlet[i] > 0
+
+		}	//end loop over links
+
+	}	//end if chnopt == 1
+
+	//Note:  The final chemical masses of each overland cell and
+	//       channel node are only reported in the mass balance file...
+	//
+	//if the mass balance file name is blank
+	if(*msbfile == '\0')
+	{
+		//no cell masses are needed
+		return;
+
+	}	//end if msbfile is blank
+
 	//Loop over rows
 	for(i=1; i<=nrows; i++)
 	{
@@ -119,10 +213,6 @@ void ComputeFinalStateChemical()
 					finalchemov[ichem][i][j][0] = cchemov[ichem][i][j][0]
 						* hov[i][j] * (w * w - achsurf) / 1000.0;
 
-					//Compute cumulative chemical mass in the overland plane (kg)
-					finalchemmassov[ichem][0] = finalchemmassov[ichem][0]
-						+ finalchemov[ichem][i][j][0];
-
 					//Compute the chemical mass in the soil stack
 					//
 					//loop over number of layers
@@ -132,60 +222,8 @@ void ComputeFinalStateChemical()
 						finalchemov[ichem][i][j][k] = cchemov[ichem][i][j][k]
 							* vlayerov[i][j][k] / 1000.0;
 
-						//Compute cumulative chemical mass in the entire soil layer (kg)
-						finalchemmassov[ichem][k] = finalchemmassov[ichem][k]
-							+ finalchemov[ichem][i][j][k];
-
 					}	//end loop over layers
 
-					//compute the cumulative chemical mass leaving water column by deposition over domain (kg)
-					totaldepchemoutov[ichem] = totaldepchemoutov[ichem]
-						+ depchemovoutmass[ichem][i][j][0];
-
-					//compute the cumulative chemical mass leaving water column by infiltration over domain (kg)
-					totalinfchemoutov[ichem][0] = totalinfchemoutov[ichem][0]
-						+ infchemovoutmass[ichem][i][j][0];
-
-					//compute the cumulative chemical mass entering water column by erosion over domain (kg)
-					totalerscheminov[ichem] = totalerscheminov[ichem]
-						+ erschemovinmass[ichem][i][j][0];
-
-					//compute the cumulative chemical mass entering water column by porewater release over domain (kg)
-					totalpwrcheminov[ichem] = totalpwrcheminov[ichem]
-						+ pwrchemovinmass[ichem][i][j][0];
-
-					//compute the cumulative chemical mass entering water column by transformations over domain (kg)
-					totaltnscheminov[ichem] = totaltnscheminov[ichem]
-						+ biochemovinmass[ichem][i][j][0]
-						+ hydchemovinmass[ichem][i][j][0]
-						+ oxichemovinmass[ichem][i][j][0]
-						+ phtchemovinmass[ichem][i][j][0]
-						+ radchemovinmass[ichem][i][j][0]
-						+ vltchemovinmass[ichem][i][j][0]
-						+ udrchemovinmass[ichem][i][j][0];
-
-					//Note:  Because the number of layers in the soil stack can vary
-					//       over time, the layer at the surface of the stack at the
-					//       is not necessarily the layer through which any porewater
-					//       transport occured.  However, for simplicity, the surface
-					//       layer at the end of the simulation is used as the frame
-					//       of reference for reporting chemical mass transported out
-					//       of the surface layer by infiltrating porewater.
-					//
-					//Developer's Note:  A more consistent way of reporting this would
-					//                   be to calculate the elevation of the wetting
-					//                   relative to the initial land surface elevation
-					//                   and then use the chose the layer number that
-					//                   best matches the wetting front elevation for
-					//                   cases where nstackov > nstackov0...
-					//
-					//set the surface layer number
-					ilayer = nstackov[i][j];
-
-					//compute the cumulative chemical mass leaving top soil layer by infiltration over domain (kg)
-					totalinfchemoutov[ichem][1] = totalinfchemoutov[ichem][1]
-						+ infchemovoutmass[ichem][i][j][ilayer];
-
 				}	//end loop over chemicals
 
 			}	//end if imask[][] != nodatavalue
@@ -194,32 +232,6 @@ void ComputeFinalStateChemical()
 
 	}	//end loop over rows
 
-	//Loop over number of outlets
-	for(i=1; i<=noutlets; i++)
-	{
-		//loop over chemicals
-		for(ichem=1; ichem<=nchems; ichem++)
-		{
-			//Compute the cumulative chemical mass exiting the domain at all outlets (advection out)
-			totaladvchemoutov[ichem][0] = totaladvchemoutov[ichem][0]
-				+ advchemovoutmass[ichem][iout[i]][jout[i]][10];
-
-			//Compute the cumulative chemical mass entering the domain at all outlets (advection in)
-			totaladvcheminov[ichem][0] = totaladvcheminov[ichem][0]
-				+ advchemovinmass[ichem][iout[i]][jout[i]][10];
-
-			//Compute the cumulative chemical mass exiting the domain at all outlets (dispersion out)
-			totaldspchemoutov[ichem][0] = totaldspchemoutov[ichem][0]
-				+ dspchemovoutmass[ichem][iout[i]][jout[i]][10];
-
-			//Compute the cumulative chemical mass entering the domain at all outlets (dispersion in)
-			totaldspcheminov[ichem][0] = totaldspcheminov[ichem][0]
-				+ dspchemovinmass[ichem][iout[i]][jout[i]][10];
-
-		}	//end loop over chemicals
-
-	}	//end loop over outlets
-
 	//if channels are simulated
 	if(chnopt == 1)
 	{
@@ -265,10 +277,6 @@ void ComputeFinalStateChemical()
 					finalchemch[ichem][i][j][0] = cchemch[ichem][i][j][0]
 						* achcross * lch / 1000.0;
 
-					//Compute cumulative chemical mass in the channel network (kg) (water column)
-					finalchemmassch[ichem][0] = finalchemmassch[ichem][0]
-						+ finalchemch[ichem][i][j][0];
-
 					//Compute the bedded chemical in the sediment stack
 					//
 					//loop over number of layers
@@ -278,81 +286,8 @@ void ComputeFinalStateChemical()
 						finalchemch[ichem][i][j][k] = cchemch[ichem][i][j][k]
 							* vlayerch[i][j][k] / 1000.0;
 
-						//Compute cumulative bedded chemical mass in the entire sediment layer (kg)
-						finalchemmassch[ichem][k] = finalchemmassch[ichem][k]
-							+ finalchemch[ichem][i][j][k];
-
 					}	//end loop over layers
 
-					//compute the cumulative chemical mass leaving water column by deposition over domain (kg)
-					totaldepchemoutch[ichem] = totaldepchemoutch[ichem]
-						+ depchemchoutmass[ichem][i][j][0];
-
-					//compute the cumulative chemical mass leaving water column by infiltration over domain (kg)
-					totalinfchemoutch[ichem][0] = totalinfchemoutch[ichem][0]
-						+ infchemchoutmass[ichem][i][j][0];
-
-					//compute the cumulative chemical mass entering water column by erosion over domain (kg)
-					totalerscheminch[ichem] = totalerscheminch[ichem]
-						+ erschemchinmass[ichem][i][j][0];
-
-					//compute the cumulative chemical mass entering water column by powewater over domain (kg)
-					totalpwrcheminch[ichem] = totalpwrcheminch[ichem]
-						+ pwrchemchinmass[ichem][i][j][0];
-
-					//compute the cumulative chemical mass entering water column by transformations over domain (kg)
-					totaltnscheminch[ichem] = totaltnscheminch[ichem]
-						+ biochemchinmass[ichem][i][j][0]
-						+ hydchemchinmass[ichem][i][j][0]
-						+ oxichemchinmass[ichem][i][j][0]
-						+ phtchemchinmass[ichem][i][j][0]
-						+ radchemchinmass[ichem][i][j][0]
-						+ vltchemchinmass[ichem][i][j][0]
-						+ udrchemchinmass[ichem][i][j][0];
-
-					//Note:  Because the number of layers in the sediment bed can vary
-					//       over time, the layer at the surface of the stack at the
-					//       is not necessarily the layer through which any porewater
-					//       transport occured.  However, for simplicity, the surface
-					//       layer at the end of the simulation is used as the frame
-					//       of reference for reporting chemical mass transported out
-					//       of the surface layer by infiltrating porewater.
-					//
-					//Developer's Note:  A more consistent way of reporting this would
-					//                   be to calculate the elevation of the wetting
-					//                   relative to the initial bed surface elevation
-					//                   and then use the chose the layer number that
-					//                   best matches the wetting front elevation for
-					//                   cases where nstackch > nstackch0...
-					//
-					//set the surface layer number
-					ilayer = nstackch[i][j];
-
-					//compute the cumulative chemical mass leaving top sediment layer by infiltration over domain (kg)
-					totalinfchemoutch[ichem][1] = totalinfchemoutch[ichem][1]
-						+ infchemchoutmass[ichem][i][j][ilayer];
-
-					//if the link is an outlet link and it is the last node of the link
-					if(qchoutlet[i] > 0 && j == nnodes[i])
-					{
-						//Compute the cumulative chemical mass exiting the domain for all outlets
-						totaladvchemoutch[ichem][0] = totaladvchemoutch[ichem][0]
-							+ advchemchoutmass[ichem][i][j][10];
-
-						//Compute the cumulative chemical mass entering the domain for all outlets
-						totaladvcheminch[ichem][0] = totaladvcheminch[ichem][0]
-							+ advchemchinmass[ichem][i][j][10];
-
-						//Compute the cumulative chemical mass exiting the domain for all outlets
-						totaldspchemoutch[ichem][0] = totaldspchemoutch[ichem][0]
-							+ dspchemchoutmass[ichem][i][j][10];
-
-						//Compute the cumulative chemical mass entering the domain for all outlets
-						totaldspcheminch[ichem][0] = totaldspcheminch[ichem][0]
-							+ dspchemchinmass[ichem][i][j][10];
-
-					}	//end if qchoutlet[i] > 0 and j = nnodes[i]
-
 				}	//end loop over chemicals
 
 			}	//end loop over nodes
@@ -6,14 +6,15 @@ C-  Methods:    end of the simulation.
 C-
 C-
 C-  Inputs:     csedov[][][][] (at tend),
-C-              csedch[][][][] (at tend)
+C-              csedch[][][][] (at tend),
+C-              mbsolidstotal[][]
 C-
 C-  Outputs:    finalsolidsov[][][],
 C-              finalsolidsch[][][]
 C-
-C-  Controls:   imask, chnopt
+C-  Controls:   imask, chnopt, msbfile
 C-
-C-  Calls:      None
+C-  Calls:      SolidsMassBalanceTotals
 C-
 C-  Called by:  ComputeFinalState
 C-
@@ -30,6 +31,22 @@ C-              Denver, CO 80225
 C-
 C-	Date:		20-MAR-2004
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Overland source/direction slots are addressed
+C-              through OVSLOT (compact overland slot storage).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Domain totals are set from the streamed solids mass
+C-              balance (SolidsMassBalanceTotals).  The final masses
+C-              of each cell and node are only computed when the
+C-              mass balance file is written.
+C-
 C-	Revised:
 C-
 C-	Date:	
@@ -68,6 +85,149 @@ void ComputeFinalStateSolids()
 		achcross,	//cross section area of channel (m)
 		achsurf;	//surface area of channel (m)
 
+	//Set the final suspended solids masses and the cumulative erosion
+	//and deposition masses of the domain from the streamed solids mass
+	//balance (see MassBalanceMonitor)
+	SolidsMassBalanceTotals();
+
+	//Loop over number of outlets
+	for(i=1; i<=noutlets; i++)
+	{
+		//loop over solids
+		for(isolid=1; isolid<=nsolids; isolid++)
+		{
+			//Compute the cumulative total solids mass exiting the domain at this outlet
+			totaladvsedoutov[0][i] = totaladvsedoutov[0][i]
+				+ advsedovoutmass[isolid][iout[i]][jout[i]][OVSLOT(10)];
+
+			//Compute the cumulative total solids mass entering the domain at this outlet
+			totaladvsedinov[0][i] = totaladvsedinov[0][i]
+				+ advsedovinmass[isolid][iout[i]][jout[i]][OVSLOT(10)];
+
+			//Compute the cumulative solids mass exiting the domain at all outlets
+			totaladvsedoutov[isolid][0] = totaladvsedoutov[isolid][0]
+				+ advsedovoutmass[isolid][iout[i]][jout[i]][OVSLOT(10)];
+
+			//Compute the cumulative total solids mass exiting the domain at all outlets
+			totaladvsedoutov[0][0] = totaladvsedoutov[0][0]
+				+ advsedovoutmass[isolid][iout[i]][jout[i]][OVSLOT(10)];
+
+			//Compute the cumulative solids mass entering the domain at all outlets
+			totaladvsedinov[isolid][0] = totaladvsedinov[isolid][0]
+				+ advsedovinmass[isolid][iout[i]][jout[i]][OVSLOT(10)];
+
+			//Compute the cumulative total solids mass entering the domain at all outlets
+			totaladvsedinov[0][0] = totaladvsedinov[0][0]
+				+ advsedovinmass[isolid][iout[i]][jout[i]][OVSLOT(10)];
+
+			//Compute the cumulative total solids mass exiting the domain at this outlet
+			totaldspsedoutov[0][i] = totaldspsedoutov[0][i]
+				+ dspsedovoutmass[isolid][iout[i]][jout[i]][OVSLOT(10)];
+
+			//Compute the cumulative total solids mass entering the domain at this outlet
+			totaldspsedinov[0][i] = totaldspsedinov[0][i]
+				+ dspsedovinmass[isolid][iout[i]][jout[i]][OVSLOT(10)];
+
+			//Compute the cumulative solids mass exiting the domain at all outlets
+			totaldspsedoutov[isolid][0] = totaldspsedoutov[isolid][0]
+				+ dspsedovoutmass[isolid][iout[i]][jout[i]][OVSLOT(10)];
+
+			//Compute the cumulative total solids mass exiting the domain at all outlets
+			totaldspsedoutov[0][0] = totaldspsedoutov[0][0]
+				+ dspsedovoutmass[isolid][iout[i]][jout[i]][OVSLOT(10)];
+
+			//Compute the cumulative solids mass entering the domain at all outlets
+			totaldspsedinov[isolid][0] = totaldspsedinov[isolid][0]
+				+ dspsedovinmass[isolid][iout[i]][jout[i]][OVSLOT(10)];
+
+			//Compute the cumulative total solids mass entering the domain at all outlets
+			totaldspsedinov[0][0] = totaldspsedinov[0][0]
+				+ dspsedovinmass[isolid][iout[i]][jout[i]][OVSLOT(10)];
+
+		}	//end loop over solids
+
+	}	//end loop over outlets
+
+	//if channels are simulated
+	if(chnopt == 1)
+	{
+		//Loop over links
+		for(i=1; i<=nlinks; i++)
+		{
+			//if the link is an outlet link (the last node of the link is an outlet)
+			if(qchoutlet[i] > 0)
+			{
+				//loop over solids
+				for(isolid=1; isolid<=nsolids; isolid++)
+				{
+					//Compute the cumulative summed solids mass exiting the domain at this outlet (advection out)
+					totaladvsedoutch[0][qchoutlet[i]] = totaladvsedoutch[0][qchoutlet[i]]
+						+ advsedchoutmass[isolid][i][nnodes[i]][10];
+
+					//Compute the cumulative individual solids mass exiting the domain for all outlets (advection out)
+					totaladvsedoutch[isolid][0] = totaladvsedoutch[isolid][0]
+						+ advsedchoutmass[isolid][i][nnodes[i]][10];
+
+					//Compute the cumulative summed solids mass exiting the domain for all outlets (advection out)
+					totaladvsedoutch[0][0] = totaladvsedoutch[0][0]
+						+ advsedchoutmass[isolid][i][nnodes[i]][10];
+
+					//Compute the cumulative summed solids mass entering the domain at this outlet (advection in)
+					totaladvsedinch[0][qchoutlet[i]] = totaladvsedinch[0][qchoutlet[i]]
+						+ advsedchinmass[isolid][i][nnodes[i]][10];
+
+					//Compute the cumulative individual solids mass entering the domain for all outlets (advection in)
+					totaladvsedinch[isolid][0] = totaladvsedinch[isolid][0]
+						+ advsedchinmass[isolid][i][nnodes[i]][10];
+
+					//Compute the cumulative summed solids mass entering the domain for all outlets (advection in)
+					totaladvsedinch[0][0] = totaladvsedinch[0][0]
+						+ advsedchinmass[isolid][i][nnodes[i]][10];
+
+					//Compute the cumulative summed solids mass exiting the domain at this outlet (dispersion out)
+					totaldspsedoutch[0][qchoutlet[i]] = totaldspsedoutch[0][qchoutlet[i]]
+						+ dspsedchoutmass[isolid][i][nnodes[i]][10];
+
+					//Compute the cumulative individual solids mass exiting the domain for all outlets (dispersion out)
+					totaldspsedoutch[isolid][0] = totaldspsedoutch[isolid][0]
+						+ dspsedchoutmass[isolid][i][nnodes[i]][10];
+
+					//Compute the cumulative summed solids mass exiting the domain for all outlets (dispersion out)
+					totaldspsedoutch[0][0] = totaldspsedoutch[0][0]
+						+ dspsedchoutmass[isolid][i][nnodes[i]][10];
+
+					//Compute the cumulative summed solids mass entering the domain at this outlet (dispersion in)
+					totaldspsedinch[0][qchoutlet[i]] = totaldspsedinch[0][qchoutlet[i]]
+						+ dspsedchinmass[isolid][i][nnodes[i]][10];
+
+					//Compute the cumulative individual solids mass entering the domain for all outlets (dispersion in)
+					totaldspsedinch[isolid][0] = totaldspsedinch[isolid][0]
+						+ dspsedchinmass[isolid][i][nnodes[i]][10];
+
+					//Compute the cumulative summed solids mass entering the domain for all outlets (dispersion in)
+					totaldspsedinch[0][0] = totaldspsedinch[0][0]
+						+ dspsedchinmass[isolid][i][nnodes[i]][10];
+
+				}	//end loop over solids
+
+			}	//end if qchoutlet[i] > 0
+
+		}	//end loop over links
+
+	}	//end if chnopt == 1
+
+	//Note:  The final masses of each overland cell and channel node
+	//       and the process sums of all solids are only reported in
+	//       the mass balance file...
+	//
+	//if the mass balance file name is blank
+	if(*msbfile == '\0')
+	{
+		//no cell masses are needed
+		return;
+
+	}	//end if msbfile is blank
+
 	//Loop over rows
 	for(i=1; i<=nrows; i++)
 	{
@@ -118,14 +278,10 @@ void ComputeFinalStateSolids()
 						+ (float)(csedov[isolid][i][j][0]
 						* hov[i][j] * (w * w - achsurf) / 1000.0);
 
-					//Compute cumulative suspended solids mass in the overland plane (kg)
-					finalsolidsmassov[isolid][0] = finalsolidsmassov[isolid][0]
-						+ finalsolidsov[isolid][i][j][0];
-
 					//Compute total suspended solids sums for each transport process...
 					//
 					//loop over advective flow sources
-					for(k=0; k<=10; k++)
+					for(k=0; k<NOVSLOTS; k++)
 					{
 						//total solids overland advective inflow (kg)
 						advsedovinmass[0][i][j][k] = advsedovinmass[0][i][j][k]
@@ -138,7 +294,7 @@ void ComputeFinalStateSolids()
 					}	//end loop over advective flow sources
 
 					//loop over dispersive flow sources
-					for(k=1; k<=10; k++)
+					for(k=1; k<NOVSLOTS; k++)
 					{
 						//total solids overland dispersive inflow (kg)
 						dspsedovinmass[0][i][j][k] = dspsedovinmass[0][i][j][k]
@@ -180,28 +336,8 @@ void ComputeFinalStateSolids()
 							+ (float)(csedov[isolid][i][j][k]
 							* vlayerov[i][j][k] / 1000.0);
 
-						//Compute cumulative bedded solids mass in the overland plane (kg)
-						finalsolidsmassov[isolid][k] = finalsolidsmassov[isolid][k]
-							+ finalsolidsov[isolid][i][j][k];
-
 					}	//end loop over layers
 
-					//compute the cumulative solids mass leaving water column by deposition over domain (kg)
-					totaldepsedoutov[isolid] = totaldepsedoutov[isolid]
-						+ depsedovoutmass[isolid][i][j][0];
-
-					//compute the cumulative total solids mass leaving water column by deposition over domain (kg)
-					totaldepsedoutov[0] = totaldepsedoutov[0]
-						+ depsedovoutmass[isolid][i][j][0];
-
-					//compute the cumulative solids mass entering water column by erosion over domain (kg)
-					totalerssedinov[isolid] = totalerssedinov[isolid]
-						+ erssedovinmass[isolid][i][j][0];
-
-					//compute the cumulative total solids mass entering water column by erosion over domain (kg)
-					totalerssedinov[0] = totalerssedinov[0]
-						+ erssedovinmass[isolid][i][j][0];
-
 				}	//end loop over solids
 
 			}	//end if imask[][] != nodatavalue
@@ -210,64 +346,6 @@ void ComputeFinalStateSolids()
 
 	}	//end loop over rows
 
-	//Loop over number of outlets
-	for(i=1; i<=noutlets; i++)
-	{
-		//loop over solids
-		for(isolid=1; isolid<=nsolids; isolid++)
-		{
-			//Compute the cumulative total solids mass exiting the domain at this outlet
-			totaladvsedoutov[0][i] = totaladvsedoutov[0][i]
-				+ advsedovoutmass[isolid][iout[i]][jout[i]][10];
-
-			//Compute the cumulative total solids mass entering the domain at this outlet
-			totaladvsedinov[0][i] = totaladvsedinov[0][i]
-				+ advsedovinmass[isolid][iout[i]][jout[i]][10];
-
-			//Compute the cumulative solids mass exiting the domain at all outlets
-			totaladvsedoutov[isolid][0] = totaladvsedoutov[isolid][0]
-				+ advsedovoutmass[isolid][iout[i]][jout[i]][10];
-
-			//Compute the cumulative total solids mass exiting the domain at all outlets
-			totaladvsedoutov[0][0] = totaladvsedoutov[0][0]
-				+ advsedovoutmass[isolid][iout[i]][jout[i]][10];
-
-			//Compute the cumulative solids mass entering the domain at all outlets
-			totaladvsedinov[isolid][0] = totaladvsedinov[isolid][0]
-				+ advsedovinmass[isolid][iout[i]][jout[i]][10];
-
-			//Compute the cumulative total solids mass entering the domain at all outlets
-			totaladvsedinov[0][0] = totaladvsedinov[0][0]
-				+ advsedovinmass[isolid][iout[i]][jout[i]][10];
-
-			//Compute the cumulative total solids mass exiting the domain at this outlet
-			totaldspsedoutov[0][i] = totaldspsedoutov[0][i]
-				+ dspsedovoutmass[isolid][iout[i]][jout[i]][10];
-
-			//Compute the cumulative total solids mass entering the domain at this outlet
-			totaldspsedinov[0][i] = totaldspsedinov[0][i]
-				+ dspsedovinmass[isolid][iout[i]][jout[i]][10];
-
-			//Compute the cumulative solids mass exiting the domain at all outlets
-			totaldspsedoutov[isolid][0] = totaldspsedoutov[isolid][0]
-				+ dspsedovoutmass[isolid][iout[i]][jout[i]][10];
-
-			//Compute the cumulative total solids mass exiting the domain at all outlets
-			totaldspsedoutov[0][0] = totaldspsedoutov[0][0]
-				+ dspsedovoutmass[isolid][iout[i]][jout[i]][10];
-
-			//Compute the cumulative solids mass entering the domain at all outlets
-			totaldspsedinov[isolid][0] = totaldspsedinov[isolid][0]
-				+ dspsedovinmass[isolid][iout[i]][jout[i]][10];
-
-			//Compute the cumulative total solids mass entering the domain at all outlets
-			totaldspsedinov[0][0] = totaldspsedinov[0][0]
-				+ dspsedovinmass[isolid][iout[i]][jout[i]][10];
-
-		}	//end loop over solids
-
-	}	//end loop over outlets
-
 	//if channels are simulated
 	if(chnopt == 1)
 	{
@@ -318,10 +396,6 @@ void ComputeFinalStateSolids()
 						+ (float)(csedch[isolid][i][j][0]
 						* achcross * lch / 1000.0);
 
-					//Compute cumulative suspended solids mass in the channel network (kg)
-					finalsolidsmassch[isolid][0] = finalsolidsmassch[isolid][0]
-						+ finalsolidsch[isolid][i][j][0];
-
 					//Compute total suspended solids sums for each transport process...
 					//
 					//loop over advective flow sources
@@ -380,81 +454,8 @@ void ComputeFinalStateSolids()
 							+ (float)(csedch[isolid][i][j][k]
 							* vlayerch[i][j][k] / 1000.0);
 
-						//Compute cumulative bedded solids mass in the channel network (kg)
-						finalsolidsmassch[isolid][k] = finalsolidsmassch[isolid][k]
-							+ finalsolidsch[isolid][i][j][k];
-
 					}	//end loop over layers
 
-					//compute the cumulative solids mass leaving water column by deposition over domain (kg)
-					totaldepsedoutch[isolid] = totaldepsedoutch[isolid]
-						+ depsedchoutmass[isolid][i][j][0];
-
-					//compute the cumulative total solids mass leaving water column by deposition over domain (kg)
-					totaldepsedoutch[0] = totaldepsedoutch[0]
-						+ depsedchoutmass[isolid][i][j][0];
-
-					//compute the cumulative solids mass entering water column by erosion over domain (kg)
-					totalerssedinch[isolid] = totalerssedinch[isolid]
-						+ erssedchinmass[isolid][i][j][0];
-
-					//compute the cumulative total solids mass entering water column by erosion over domain (kg)
-					totalerssedinch[0] = totalerssedinch[0]
-						+ erssedchinmass[isolid][i][j][0];
-
-					//if the link is an outlet link and it is the last node of the link
-					if(qchoutlet[i] > 0 && j == nnodes[i])
-					{
-						//Compute the cumulative summed solids mass exiting the domain at this outlet (advection out)
-						totaladvsedoutch[0][qchoutlet[i]] = totaladvsedoutch[0][qchoutlet[i]]
-							+ advsedchoutmass[isolid][i][j][10];
-
-						//Compute the cumulative individual solids mass exiting the domain for all outlets (advection out)
-						totaladvsedoutch[isolid][0] = totaladvsedoutch[isolid][0]
-							+ advsedchoutmass[isolid][i][j][10];
-
-						//Compute the cumulative summed solids mass exiting the domain for all outlets (advection out)
-						totaladvsedoutch[0][0] = totaladvsedoutch[0][0]
-							+ advsedchoutmass[isolid][i][j][10];
-
-						//Compute the cumulative summed solids mass entering the domain at this outlet (advection in)
-						totaladvsedinch[0][qchoutlet[i]] = totaladvsedinch[0][qchoutlet[i]]
-							+ advsedchinmass[isolid][i][j][10];
-
-						//Compute the cumulative individual solids mass entering the domain for all outlets (advection in)
-						totaladvsedinch[isolid][0] = totaladvsedinch[isolid][0]
-							+ advsedchinmass[isolid][i][j][10];
-
-						//Compute the cumulative summed solids mass entering the domain for all outlets (advection in)
-						totaladvsedinch[0][0] = totaladvsedinch[0][0]
-							+ advsedchinmass[isolid][i][j][10];
-
-						//Compute the cumulative summed solids mass exiting the domain at this outlet (dispersion out)
-						totaldspsedoutch[0][qchoutlet[i]] = totaldspsedoutch[0][qchoutlet[i]]
-							+ dspsedchoutmass[isolid][i][j][10];
-
-						//Compute the cumulative individual solids mass exiting the domain for all outlets (dispersion out)
-						totaldspsedoutch[isolid][0] = totaldspsedoutch[isolid][0]
-							+ dspsedchoutmass[isolid][i][j][10];
-
-						//Compute the cumulative summed solids mass exiting the domain for all outlets (dispersion out)
-						totaldspsedoutch[0][0] = totaldspsedoutch[0][0]
-							+ dspsedchoutmass[isolid][i][j][10];
-
-						//Compute the cumulative summed solids mass entering the domain at this outlet (dispersion in)
-						totaldspsedinch[0][qchoutlet[i]] = totaldspsedinch[0][qchoutlet[i]]
-							+ dspsedchinmass[isolid][i][j][10];
-
-						//Compute the cumulative individual solids mass entering the domain for all outlets (dispersion in)
-						totaldspsedinch[isolid][0] = totaldspsedinch[isolid][0]
-							+ dspsedchinmass[isolid][i][j][10];
-
-						//Compute the cumulative summed solids mass entering the domain for all outlets (dispersion in)
-						totaldspsedinch[0][0] = totaldspsedinch[0][0]
-							+ dspsedchinmass[isolid][i][j][10];
-
-					}	//end if qchoutlet[i] > 0 and j = nnodes[i]
-
 				}	//end loop over solids
 
 			}	//end loop over nodes
@@ -11,17 +11,17 @@ C-              Based on equations presented by Liston and Elder (2006)
 C-              for MicroMet (Apr-2006) and Snowmodel (Dec-2006).
 C-
 C-
-C-	Inputs:		tzero, simtime, latitude, slope[][], azslope[][],
-C-              cloudcover[][]
+C-	Inputs:		tzero, simtime, latitude, slopecos[], slopesinx[],
+C-              slopesiny[], solarview[], cloudcover[][]
 C-
 C-	Outputs:	solarrad[][]
 C-
 C-	Controls:	chnopt, npropg, npropov, npropch, nsolids,
 C-              nenvgtf, nenvovtf, nenvchtf, nfpocovtf, nfpocchtf,
 C-              nenvgtfpairs, nenvovtfpairs, nenvchtfpairs,
-C-              nfpocovpairs, nfpocchpairs
+C-              nfpocovpairs, nfpocchpairs, ntaskthreads
 C-
-C-	Calls:		None
+C-	Calls:		SolarRadiationSweep
 C-
 C-	Called by:	UpdateEnvironment
 C-
@@ -32,6 +32,15 @@ C-				Mahwah, NJ 07430
 C-
 C-	Date:		20-JAN-2007
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Terrain terms are precomputed
+C-              (InitializeEnvironment). Cells are computed by
+C-              SolarRadiationSweep from the sun terms, in chunks on
+C-              ntaskthreads threads.
+C-
 C-	Revised:
 C-
 C-	Date:	
@@ -55,9 +64,15 @@ C---------------------------------------------------------------------*/
 //trex global variable declarations for environmental conditions
 #include "trex_environmental_declarations.h"
 
+#define SOLARCHUNKCELLS 16384		//number of cells of a chunk of the solar radiation sweep
+
 void ComputeSolarRadiation()
 {
 	//local variable declarations/definitions
+	int
+		nchunks,		//number of chunks of the solar radiation sweep
+		ichunk;			//index of a chunk
+
 	float
 		aisrad,			//average incident solar radiation intensity (top of atmosphere) (W/m2)
 		year,			//number of days in one year (averaging leap years)
@@ -69,15 +84,8 @@ void ComputeSolarRadiation()
 		cosz,			//cosine of solar zenith angle (Z) (radians)
 		sinz,			//sine of solar zenith angle (Z) (radians)
 		azsun,			//azimuth of sun (radians)
-		azslope,		//azimuth of land surface slope (radians)
-		cosi,			//cosine of solar radiation incidence angle (radians)
 		pi,				//pi = 3.1415926...
-		degtorad,		//conversion factor for degrees to radians
-		psidirect,		//atmospheric transmissivity for direct solar radiation
-		psidiffuse,		//atmospheric transmissivity for diffuse solar radiation
-		psicover,		//land cover transmissivity for direct/diffuse solar radiation
-		qsidirect,		//direct shortwave solar radiation (W/m2)
-		qsidiffuse;		//diffuse shortwave solar radiation (W/m2)
+		degtorad;		//conversion factor for degrees to radians
 
 	//Define required constants
 	aisrad = 1370.0;				//average incident solar radiation intensity (W/m2)
@@ -207,102 +215,68 @@ void ComputeSolarRadiation()
 
 	}	//endif hangle < 0.0
 
-	//Compute solar radiation for each cell in the domain
+	//Compute the sun terms of the solar incidence angle...
 	//
-	//Loop over rows
-	for(i=1; i<=nrows; i++)
-	{
-		//Loop over columns
-		for(j=1; j<=ncols; j++)
-		{
-			//if the cell is in the domain (is not null)
-			if(imask[i][j] != nodatavalue)
-			{
-				//Convert the slope aspect (where north is zero azimuth) to the
-				//slope azimuth (azslope) with south having zero azimuth...
-				//
-				//if the slope aspect is >= 180 degrees (a west aspect)
-				if(aspect[i][j] >= 180.0)
-				{
-					//subtract 180 degrees to convert aspect to azimuth (south zero azimuth) (degrees)
-					azslope = (float)(aspect[i][j] - 180.0);
-				}
-				else	//else slope aspect is < 180 (an east aspect)
-				{
-					//add 180 degrees to convert aspect to azimuth (south zero azimuth) (degrees)
-					azslope = (float)(aspect[i][j] + 180.0);
-
-				}	//endif aspect[][] >= 180
-
-				//Compute the angle between the normal to the slope and the angle
-				//  at which direct solar radiation impinges on sloping terrain (radians).
-				cosi = (float)(cos(slope[i][j] * degtorad) * cosz
-					+ sin(slope[i][j] * degtorad) * sinz * 
-					cos(azsun - azslope * degtorad));
-
-				//Adjust the topographic correction for local slope so that
-				//the correction is zero if the sun is below the local horizon 
-				//(i.e., the slope is in the shade) or if the sun is below the
-				//global horizon.
-				//
-				//if the sun is below the local horizon of the surface (the angle of incidence, cosi < 0)
-				if(cosi < 0.0) cosi = 0.0;
-
-				//if the sun is below the global horizon (the zenith angle, cosz <= 0)
-				if(cosz <= 0.0) cosi = 0.0;
+	//Note:  The terrain terms (slopecos, slopesinx, slopesiny) are
+	//       computed once by InitializeEnvironment.  The cosine of the
+	//       incidence angle of a cell is a linear combination of the
+	//       terrain terms and the sun terms (see SolarRadiationSweep).
+	//
+	//set the cosine of the zenith angle
+	suncosz = cosz;
 
-				//Compute atmospheric transmissivities for direct
-				//and diffuse radiation...
-				//
-				//Account for clouds, water vapor, pollution, etc.
-				//
-				//compute atmospheric transmissivity (psi) for direct and diffuse radiation
-				psidirect = (float)((0.6 + 0.2 * cosz) * (1.0 - cloudcover[i][j]));
-				psidiffuse = (float)((0.3 + 0.1 * cosz) * cloudcover[i][j]);
+	//if the sun is above the global horizon (the zenith angle, cosz > 0)
+	if(cosz > 0.0)
+	{
+		//set the sun terms for the slope azimuth terms
+		sunx = (float)(sinz * cos(azsun));
+		suny = (float)(sinz * sin(azsun));
+	}
+	else	//else the sun is below the global horizon
+	{
+		//the correction is zero (no direct radiation on any slope)
+		sunx = 0.0;
+		suny = 0.0;
 
-				//Compute land cover transmissivity.
-				//
-				//  As described by Liston and Elder (2006), 0.71 provided a
-				//  best-fit to the observations, when averaged over the two years
-				//  of hourly data.  For pine forest, psicover = exp(-0.71 * LAI).
-				//  LAI = leaf area index.
-				//
-				//  Account for any gaps in the forest canopy that will allow
-				//  direct incoming solar radiation to reach the snow surface.
-				//
-				//Developer's Note:  The land cover transmissivity could be input
-				//                   as a function of land use type and read in
-				//                   Data Group B.  However, the transmissivity
-				//                   would need to account for shade by buildings
-				//                   through which no light penetrates...
-				//
-				//                   For now, adjust the sky view factor to account
-				//                   for light penetration through forest canopy or
-				//                   other cover and set cover transmissivity to zero.
-				//
-				//compute land cover (canopy) transmissivity (set to zero for now...)
-				psicover = 0.0;
+	}	//end if cosz > 0.0
 
-				//Compute solar radiation transmitted through the atmosphere and
-				//  adjust for slope and terrain slope, aspect, and solar angle...
-				//
-				//compute direct short wave radiation (qsi) near the land surface (W/m2)
-				qsidirect = cosi * psidirect * aisrad;
+	//Compute atmospheric transmissivities for direct and diffuse
+	//radiation (without cloud cover) times the average incident
+	//solar radiation intensity...
+	//
+	//  psidirect = (0.6 + 0.2 * cosz) * (1.0 - cloudcover)
+	//  psidiffuse = (0.3 + 0.1 * cosz) * cloudcover
+	//
+	//compute direct radiation per unit incidence angle cosine (W/m2)
+	sundirect = (float)((0.6 + 0.2 * cosz) * aisrad);
 
-				//compute diffuse short wave radiation (qsi) near the land surface (W/m2)
-				qsidiffuse = cosz * psidiffuse * aisrad;
+	//compute diffuse radiation per unit cloud cover (W/m2)
+	sundiffuse = (float)(cosz * (0.3 + 0.1 * cosz) * aisrad);
 
-				//Adjust solar radiation for sky view (blocking by tree canopy, shading by buildings etc.)
-				//
-				//Combine direct and diffuse solar radiation (W/m2)
-				solarrad[i][j] = (float)(((1.0 - skyview[i][j]) * psicover
-					+ skyview[i][j]) * (qsidirect + qsidiffuse));
+	//Compute solar radiation for each cell in the domain
+	//
+	//number of chunks of the solar radiation sweep
+	nchunks = (nsolarcells + SOLARCHUNKCELLS - 1) / SOLARCHUNKCELLS;
 
-			}	//end if imask[][] != nodatavalue
+	//if the sweep runs on more than one thread
+	if(ntaskthreads > 1 && nchunks > 1)
+	{
+		//loop over chunks (one task per chunk of cells)
+		#pragma omp parallel for schedule(static) num_threads(ntaskthreads)
+		for(ichunk=0; ichunk<nchunks; ichunk++)
+		{
+			//compute solar radiation for the cells of the chunk
+			SolarRadiationSweep(ichunk * SOLARCHUNKCELLS + 1,
+				(int)(Min((ichunk + 1) * SOLARCHUNKCELLS, nsolarcells)));
 
-		}	//end loop over columns
+		}	//end loop over chunks
+	}
+	else	//else the sweep runs on one thread
+	{
+		//compute solar radiation for all cells
+		SolarRadiationSweep(1, nsolarcells);
 
-	}	//end loop over rows
+	}	//end if ntaskthreads > 1
 
 //End of function: Return to UpdateEnvironment
 }
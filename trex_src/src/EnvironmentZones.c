@@ -0,0 +1,887 @@
+/*----------------------------------------------------------------------
+C-  File:       EnvironmentZones.c
+C-
+C-  Purpose/    Concatenated group of functions for the zoned storage
+C-  Methods:    of general and overland environmental properties.
+C-
+C-              Property grids are usually uniform (one value and one
+C-              time function for the whole domain) or zoned (a few
+C-              distinct value/time function pairs, e.g. one per land
+C-              use or climate station).  After a property grid and
+C-              its time function pointer grid are read, the distinct
+C-              (value, tfid) pairs of the domain cells are collected
+C-              into a zone table:
+C-
+C-                (1) one zone: the property is uniform.  Only the
+C-                    zone table is kept;
+C-
+C-                (2) 2 to MAXENVZONES zones: the property is zoned.
+C-                    The zone table and a zone id grid (one byte per
+C-                    cell) are kept;
+C-
+C-                (3) more than MAXENVZONES zones: the property is
+C-                    genuinely distributed and the full value and time
+C-                    function id grids are kept.
+C-
+C-              For (1) and (2) the value and time function id grids
+C-              (envg, envgtfid, envov, envovtfid) are freed and set
+C-              to NULL.  Overland properties are zoned layer by layer
+C-              and are only zoned when every layer fits in the table.
+C-
+C-              Each time step UpdateEnvironment updates the zone
+C-              values (value * interpolated time function) once per
+C-              zone instead of once per cell, and only reassigns the
+C-              cell values of a zoned property when a zone value
+C-              changed.  Cell values are read through EnvGeneralValue
+C-              and EnvOverlandValue, which handle all three forms, so
+C-              the results are the same as for full grids.
+C-
+C-  Function
+C-   Listing:   EnvironmentZoneId, ZoneGeneralProperty,
+C-              ZoneOverlandProperty, UpdateGeneralZones,
+C-              UpdateOverlandZones, EnvGeneralValue, EnvGeneralTFId,
+C-              EnvOverlandValue, InvalidateEnvironmentZones,
+C-              FreeEnvironmentZones
+C-
+C-  Inputs:     envg, envgtfid, envov, envovtfid, envgtfinterp,
+C-              envovtfinterp, imask
+C-
+C-  Outputs:    nenvgzones, envgzone, envgzonevalue, envgzonetfid,
+C-              envgzonecurrent, envgzonestale, nenvovzones, envovzone,
+C-              envovzonevalue, envovzonetfid, envovzonecurrent,
+C-              envovzonestale
+C-
+C-  Controls:   npropg, npropov, maxstackov
+C-
+C-  Calls:      None
+C-
+C-  Called by:  ReadDataGroupE, UpdateEnvironment, RestoreResetState,
+C-              FreeMemoryEnvironment
+C-
+C-  Created:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Added InvalidateEnvironmentZones (cell values of all
+C-              zoned properties are reassigned after TrexReset).
+C-
+C-  Revised:
+C-
+C-  Date:
+C-
+C-  Revisions:
+C-
+C----------------------------------------------------------------------*/
+
+//trex general variable declarations
+#include "trex_general_declarations.h"
+
+//trex global variable declarations for water transport
+#include "trex_water_declarations.h"
+
+//trex global variable declarations for sediment transport
+#include "trex_solids_declarations.h"
+
+//trex global variable declarations for chemical transport
+#include "trex_chemical_declarations.h"
+
+//trex global variable declarations for environmental conditions
+#include "trex_environmental_declarations.h"
+
+//C
+//C
+			/*******************************************/
+			/*      FUNCTION: EnvironmentZoneId        */
+			/*******************************************/
+
+/* Returns the zone of a (value, tfid) pair, adding a zone when the pair */
+/* is new.  Returns 0 when the zone table is full.                       */
+
+int EnvironmentZoneId(float value, int tfid, float *zonevalue, int *zonetfid,
+					  int *nzones, int lastzone)
+{
+	//local variable declarations
+	int
+		izone;		//loop index for zones
+
+	//if the pair matches the zone of the last cell (neighboring cells usually share a zone)
+	if(lastzone > 0 && zonevalue[lastzone] == value && zonetfid[lastzone] == tfid)
+	{
+		//return the zone of the last cell
+		return lastzone;
+
+	}	//end if the pair matches the last zone
+
+	//loop over zones
+	for(izone=1; izone<=*nzones; izone++)
+	{
+		//if the pair matches this zone
+		if(zonevalue[izone] == value && zonetfid[izone] == tfid)
+		{
+			//return this zone
+			return izone;
+
+		}	//end if the pair matches this zone
+
+	}	//end loop over zones
+
+	//if the zone table is full
+	if(*nzones >= MAXENVZONES)
+	{
+		//the property has too many zones
+		return 0;
+
+	}	//end if *nzones >= MAXENVZONES
+
+	//add a zone for the pair
+	*nzones = *nzones + 1;
+	zonevalue[*nzones] = value;
+	zonetfid[*nzones] = tfid;
+
+	//return the new zone
+	return *nzones;
+}
+
+//C
+//C
+			/*******************************************/
+			/*     FUNCTION: ZoneGeneralProperty       */
+			/*******************************************/
+
+/* Converts the value and time function id grids of a general property */
+/* to zoned storage when the property has at most MAXENVZONES zones    */
+
+void ZoneGeneralProperty(int iprop)
+{
+	//local variable declarations
+	int
+		row,		//row index
+		col,		//column index
+		nzones,		//number of zones
+		izone;		//zone of the current cell
+
+	unsigned char
+		**zone;		//zone id grid
+
+	//Allocate memory for the zone table (MAXENVZONES+1)
+	envgzonevalue[iprop] = (float *)malloc((MAXENVZONES+1) * sizeof(float));
+	envgzonetfid[iprop] = (int *)malloc((MAXENVZONES+1) * sizeof(int));
+
+	//Allocate memory for the zone id grid (rows)
+	zone = (unsigned char **)malloc((nrows+1) * sizeof(unsigned char *));
+
+	//initialize the number of zones and the zone of the last cell
+	nzones = 0;
+	izone = 0;
+
+	//loop over rows
+	for(row=1; row<=nrows; row++)
+	{
+		//Allocate memory for the zone id grid (columns)
+		zone[row] = (unsigned char *)calloc((ncols+1), sizeof(unsigned char));
+
+		//loop over columns (while the zone table is not full)
+		for(col=1; col<=ncols && nzones >= 0; col++)
+		{
+			//if the cell is in the domain (is not null)
+			if(imask[row][col] != nodatavalue)
+			{
+				//get the zone of the cell
+				izone = EnvironmentZoneId(envg[iprop][row][col], envgtfid[iprop][row][col],
+					envgzonevalue[iprop], envgzonetfid[iprop], &nzones, izone);
+
+				//if the zone table is full, the property is distributed
+				if(izone == 0) nzones = -1;
+
+				//store the zone of the cell
+				zone[row][col] = (unsigned char)izone;
+
+			}	//end if imask[][] != nodatavalue
+
+		}	//end loop over columns
+
+	}	//end loop over rows
+
+	//if the property has too many zones (is distributed)
+	if(nzones < 0)
+	{
+		//keep the full grids
+		nenvgzones[iprop] = 0;
+
+		//loop over rows
+		for(row=1; row<=nrows; row++)
+		{
+			//Deallocate memory for the zone id grid (columns)
+			free(zone[row]);
+
+		}	//end loop over rows
+
+		//Deallocate memory for the zone id grid and zone table
+		free(zone);
+		free(envgzonevalue[iprop]);
+		free(envgzonetfid[iprop]);
+
+		//no zone storage
+		envgzone[iprop] = NULL;
+		envgzonevalue[iprop] = NULL;
+		envgzonetfid[iprop] = NULL;
+		envgzonecurrent[iprop] = NULL;
+
+		//Echo storage of the property to file
+		fprintf(echofile_fp, "\n  Property Storage: distributed (more than %d zones)\n",
+			MAXENVZONES);
+	}
+	else	//else the property is uniform or zoned
+	{
+		//if the domain has no cells, use one zone with a zero value
+		if(nzones == 0)
+		{
+			//set a zero zone
+			nzones = 1;
+			envgzonevalue[iprop][1] = 0.0;
+			envgzonetfid[iprop][1] = 0;
+
+		}	//end if nzones == 0
+
+		//store the number of zones
+		nenvgzones[iprop] = nzones;
+
+		//loop over rows
+		for(row=1; row<=nrows; row++)
+		{
+			//Deallocate memory for the value and time function id grids (columns)
+			free(envg[iprop][row]);
+			free(envgtfid[iprop][row]);
+
+			//if the property is uniform, the zone id grid is not needed
+			if(nzones == 1) free(zone[row]);
+
+		}	//end loop over rows
+
+		//Deallocate memory for the value and time function id grids (rows)
+		free(envg[iprop]);
+		free(envgtfid[iprop]);
+		envg[iprop] = NULL;
+		envgtfid[iprop] = NULL;
+
+		//if the property is uniform
+		if(nzones == 1)
+		{
+			//Deallocate memory for the zone id grid (rows)
+			free(zone);
+			zone = NULL;
+
+		}	//end if nzones == 1
+
+		//store the zone id grid
+		envgzone[iprop] = zone;
+
+		//Allocate memory for the current zone values
+		envgzonecurrent[iprop] = (float *)malloc((nzones+1) * sizeof(float));
+
+		//cell values are assigned at the first update
+		envgzonestale[iprop] = 1;
+
+		//Echo storage of the property to file
+		fprintf(echofile_fp, "\n  Property Storage: %s (%d zones)\n",
+			(nzones == 1) ? "uniform" : "zoned", nzones);
+
+	}	//end if nzones < 0
+}
+
+//C
+//C
+			/*******************************************/
+			/*     FUNCTION: ZoneOverlandProperty      */
+			/*******************************************/
+
+/* Converts the value and time function id grids of an overland property */
+/* to zoned storage when every layer has at most MAXENVZONES zones       */
+
+void ZoneOverlandProperty(int iprop)
+{
+	//local variable declarations
+	int
+		row,		//row index
+		col,		//column index
+		layer,		//layer index
+		distributed,	//flag: a layer has too many zones (1)
+		nzones,		//number of zones of a layer
+		izone;		//zone of the current cell
+
+	unsigned char
+		***zone;	//zone id grids [layer][row][col]
+
+	//Allocate memory for the zone tables (layers)
+	nenvovzones[iprop] = (int *)malloc((maxstackov+1) * sizeof(int));
+	envovzonevalue[iprop] = (float **)malloc((maxstackov+1) * sizeof(float *));
+	envovzonetfid[iprop] = (int **)malloc((maxstackov+1) * sizeof(int *));
+	envovzonecurrent[iprop] = (float **)malloc((maxstackov+1) * sizeof(float *));
+	zone = (unsigned char ***)malloc((maxstackov+1) * sizeof(unsigned char **));
+
+	//initialize the distributed flag
+	distributed = 0;
+
+	//loop over layers (include zero for water column)
+	for(layer=0; layer<=maxstackov; layer++)
+	{
+		//Allocate memory for the zone table of the layer (MAXENVZONES+1)
+		envovzonevalue[iprop][layer] = (float *)malloc((MAXENVZONES+1) * sizeof(float));
+		envovzonetfid[iprop][layer] = (int *)malloc((MAXENVZONES+1) * sizeof(int));
+
+		//Allocate memory for the zone id grid of the layer (rows)
+		zone[layer] = (unsigned char **)malloc((nrows+1) * sizeof(unsigned char *));
+
+		//initialize the number of zones and the zone of the last cell
+		nzones = 0;
+		izone = 0;
+
+		//loop over rows
+		for(row=1; row<=nrows; row++)
+		{
+			//Allocate memory for the zone id grid of the layer (columns)
+			zone[layer][row] = (unsigned char *)calloc((ncols+1), sizeof(unsigned char));
+
+			//loop over columns (while the zone table is not full)
+			for(col=1; col<=ncols && distributed == 0; col++)
+			{
+				//if the cell is in the domain (is not null)
+				if(imask[row][col] != nodatavalue)
+				{
+					//get the zone of the cell
+					izone = EnvironmentZoneId(envov[iprop][row][col][layer],
+						envovtfid[iprop][row][col][layer], envovzonevalue[iprop][layer],
+						envovzonetfid[iprop][layer], &nzones, izone);
+
+					//if the zone table is full, the property is distributed
+					if(izone == 0) distributed = 1;
+
+					//store the zone of the cell
+					zone[layer][row][col] = (unsigned char)izone;
+
+				}	//end if imask[][] != nodatavalue
+
+			}	//end loop over columns
+
+		}	//end loop over rows
+
+		//if the layer has no cells, use one zone with a zero value
+		if(nzones == 0)
+		{
+			//set a zero zone
+			nzones = 1;
+			envovzonevalue[iprop][layer][1] = 0.0;
+			envovzonetfid[iprop][layer][1] = 0;
+
+		}	//end if nzones == 0
+
+		//store the number of zones of the layer
+		nenvovzones[iprop][layer] = nzones;
+
+	}	//end loop over layers
+
+	//loop over layers (include zero for water column)
+	for(layer=0; layer<=maxstackov; layer++)
+	{
+		//loop over rows
+		for(row=1; row<=nrows; row++)
+		{
+			//if the property is distributed or the layer is uniform, the zone id grid is not needed
+			if(distributed > 0 || nenvovzones[iprop][layer] == 1) free(zone[layer][row]);
+
+		}	//end loop over rows
+
+		//if the property is distributed or the layer is uniform
+		if(distributed > 0 || nenvovzones[iprop][layer] == 1)
+		{
+			//Deallocate memory for the zone id grid of the layer (rows)
+			free(zone[layer]);
+			zone[layer] = NULL;
+
+		}	//end if distributed > 0 or nenvovzones[][] == 1
+
+		//if the property is distributed
+		if(distributed > 0)
+		{
+			//Deallocate memory for the zone table of the layer
+			free(envovzonevalue[iprop][layer]);
+			free(envovzonetfid[iprop][layer]);
+		}
+		else	//else the property is zoned
+		{
+			//Allocate memory for the current zone values of the layer
+			envovzonecurrent[iprop][layer] = (float *)malloc((nenvovzones[iprop][layer]+1) * sizeof(float));
+
+		}	//end if distributed > 0
+
+	}	//end loop over layers
+
+	//if the property is distributed
+	if(distributed > 0)
+	{
+		//Deallocate memory for the zone tables (layers)
+		free(nenvovzones[iprop]);
+		free(envovzonevalue[iprop]);
+		free(envovzonetfid[iprop]);
+		free(envovzonecurrent[iprop]);
+		free(zone);
+
+		//no zone storage (the full grids are kept)
+		nenvovzones[iprop] = NULL;
+		envovzonevalue[iprop] = NULL;
+		envovzonetfid[iprop] = NULL;
+		envovzonecurrent[iprop] = NULL;
+		envovzone[iprop] = NULL;
+
+		//Echo storage of the property to file
+		fprintf(echofile_fp, "\n  Property Storage: distributed (more than %d zones in a layer)\n",
+			MAXENVZONES);
+	}
+	else	//else the property is uniform or zoned in every layer
+	{
+		//loop over rows
+		for(row=1; row<=nrows; row++)
+		{
+			//loop over columns
+			for(col=1; col<=ncols; col++)
+			{
+				//Deallocate memory for the value and time function id grids (layers)
+				free(envov[iprop][row][col]);
+				free(envovtfid[iprop][row][col]);
+
+			}	//end loop over columns
+
+			//Deallocate memory for the value and time function id grids (columns)
+			free(envov[iprop][row]);
+			free(envovtfid[iprop][row]);
+
+		}	//end loop over rows
+
+		//Deallocate memory for the value and time function id grids (rows)
+		free(envov[iprop]);
+		free(envovtfid[iprop]);
+		envov[iprop] = NULL;
+		envovtfid[iprop] = NULL;
+
+		//store the zone id grids
+		envovzone[iprop] = zone;
+
+		//cell values are assigned at the first update
+		envovzonestale[iprop] = 1;
+
+		//Echo storage of the property to file
+		fprintf(echofile_fp, "\n  Property Storage: zoned by layer (zones per layer:");
+
+		//loop over layers (include zero for water column)
+		for(layer=0; layer<=maxstackov; layer++)
+		{
+			//Echo the number of zones of the layer to file
+			fprintf(echofile_fp, " %d", nenvovzones[iprop][layer]);
+
+		}	//end loop over layers
+
+		//Echo end of line to file
+		fprintf(echofile_fp, ")\n");
+
+	}	//end if distributed > 0
+}
+
+//C
+//C
+			/*******************************************/
+			/*      FUNCTION: UpdateGeneralZones       */
+			/*******************************************/
+
+/* Updates the current zone values of a general property.  Returns 1 */
+/* when the cell values must be reassigned and 0 when they are        */
+/* current (no zone value changed since the last update).             */
+
+int UpdateGeneralZones(int iprop)
+{
+	//local variable declarations
+	int
+		izone,		//loop index for zones
+		tfid,		//time function id of a zone
+		changed;	//flag: a zone value changed (1)
+
+	float
+		value;		//current zone value
+
+	//if the property is distributed, the cell values are always reassigned
+	if(envg[iprop] != NULL) return 1;
+
+	//cell values of a stale property are reassigned
+	changed = envgzonestale[iprop];
+	envgzonestale[iprop] = 0;
+
+	//loop over zones
+	for(izone=1; izone<=nenvgzones[iprop]; izone++)
+	{
+		//set the time function id for this zone
+		tfid = envgzonetfid[iprop][izone];
+
+		//if a time function exists for this zone (tfid > 0)
+		if(tfid > 0)
+		{
+			//set the zone value f(zone,t)
+			value = envgzonevalue[iprop][izone] * envgtfinterp[iprop][tfid];
+		}
+		else	//else, no time function exists
+		{
+			//set the zone value f(zone)
+			value = envgzonevalue[iprop][izone];
+
+		}	//end if tfid > 0
+
+		//if the zone value changed
+		if(changed > 0 || value != envgzonecurrent[iprop][izone])
+		{
+			//store the zone value
+			envgzonecurrent[iprop][izone] = value;
+
+			//cell values must be reassigned
+			changed = 1;
+
+		}	//end if the zone value changed
+
+	}	//end loop over zones
+
+	//return the changed flag
+	return changed;
+}
+
+//C
+//C
+			/*******************************************/
+			/*      FUNCTION: UpdateOverlandZones      */
+			/*******************************************/
+
+/* Updates the current zone values of an overland property.  Returns 1 */
+/* when the cell values must be reassigned and 0 when they are current. */
+
+int UpdateOverlandZones(int iprop)
+{
+	//local variable declarations
+	int
+		layer,		//loop index for layers
+		izone,		//loop index for zones
+		tfid,		//time function id of a zone
+		changed;	//flag: a zone value changed (1)
+
+	float
+		value;		//current zone value
+
+	//if the property is distributed, the cell values are always reassigned
+	if(envov[iprop] != NULL) return 1;
+
+	//cell values of a stale property are reassigned
+	changed = envovzonestale[iprop];
+	envovzonestale[iprop] = 0;
+
+	//loop over layers (include zero for water column)
+	for(layer=0; layer<=maxstackov; layer++)
+	{
+		//loop over zones
+		for(izone=1; izone<=nenvovzones[iprop][layer]; izone++)
+		{
+			//set the time function id for this zone
+			tfid = envovzonetfid[iprop][layer][izone];
+
+			//if a time function exists for this zone (tfid > 0)
+			if(tfid > 0)
+			{
+				//set the zone value f(zone,z,t)
+				value = envovzonevalue[iprop][layer][izone] * envovtfinterp[iprop][tfid];
+			}
+			else	//else, no time function exists
+			{
+				//set the zone value f(zone,z)
+				value = envovzonevalue[iprop][layer][izone];
+
+			}	//end if tfid > 0
+
+			//if the zone value changed
+			if(changed > 0 || value != envovzonecurrent[iprop][layer][izone])
+			{
+				//store the zone value
+				envovzonecurrent[iprop][layer][izone] = value;
+
+				//cell values must be reassigned
+				changed = 1;
+
+			}	//end if the zone value changed
+
+		}	//end loop over zones
+
+	}	//end loop over layers
+
+	//return the changed flag
+	return changed;
+}
+
+//C
+//C
+			/*******************************************/
+			/*       FUNCTION: EnvGeneralValue         */
+			/*******************************************/
+
+/* Returns the current value of a general property for a cell */
+
+float EnvGeneralValue(int iprop, int row, int col)
+{
+	//local variable declarations
+	int
+		tfid;		//time function id of the cell
+
+	//if the property is distributed
+	if(envg[iprop] != NULL)
+	{
+		//set the time function id for this cell
+		tfid = envgtfid[iprop][row][col];
+
+		//if a time function exists for this cell (tfid > 0)
+		if(tfid > 0)
+		{
+			//return the value f(x,y,t)
+			return envg[iprop][row][col] * envgtfinterp[iprop][tfid];
+		}
+		else	//else, no time function exists
+		{
+			//return the value f(x,y)
+			return envg[iprop][row][col];
+
+		}	//end if tfid > 0
+	}
+	//else if the property is zoned
+	else if(envgzone[iprop] != NULL)
+	{
+		//return the value of the zone of the cell
+		return envgzonecurrent[iprop][envgzone[iprop][row][col]];
+	}
+	else	//else the property is uniform
+	{
+		//return the value of the zone
+		return envgzonecurrent[iprop][1];
+
+	}	//end if envg[iprop] != NULL
+}
+
+//C
+//C
+			/*******************************************/
+			/*        FUNCTION: EnvGeneralTFId         */
+			/*******************************************/
+
+/* Returns the time function id of a general property for a cell */
+
+int EnvGeneralTFId(int iprop, int row, int col)
+{
+	//if the property is distributed
+	if(envg[iprop] != NULL)
+	{
+		//return the time function id of the cell
+		return envgtfid[iprop][row][col];
+	}
+	//else if the property is zoned
+	else if(envgzone[iprop] != NULL)
+	{
+		//return the time function id of the zone of the cell
+		return envgzonetfid[iprop][envgzone[iprop][row][col]];
+	}
+	else	//else the property is uniform
+	{
+		//return the time function id of the zone
+		return envgzonetfid[iprop][1];
+
+	}	//end if envg[iprop] != NULL
+}
+
+//C
+//C
+			/*******************************************/
+			/*       FUNCTION: EnvOverlandValue        */
+			/*******************************************/
+
+/* Returns the current value of an overland property for a cell and layer */
+
+float EnvOverlandValue(int iprop, int row, int col, int layer)
+{
+	//local variable declarations
+	int
+		tfid;		//time function id of the cell
+
+	//if the property is distributed
+	if(envov[iprop] != NULL)
+	{
+		//set the time function id for this cell
+		tfid = envovtfid[iprop][row][col][layer];
+
+		//if a time function exists for this cell (tfid > 0)
+		if(tfid > 0)
+		{
+			//return the value f(x,y,z,t)
+			return envov[iprop][row][col][layer] * envovtfinterp[iprop][tfid];
+		}
+		else	//else, no time function exists
+		{
+			//return the value f(x,y,z)
+			return envov[iprop][row][col][layer];
+
+		}	//end if tfid > 0
+	}
+	//else if the layer is zoned
+	else if(envovzone[iprop][layer] != NULL)
+	{
+		//return the value of the zone of the cell
+		return envovzonecurrent[iprop][layer][envovzone[iprop][layer][row][col]];
+	}
+	else	//else the layer is uniform
+	{
+		//return the value of the zone
+		return envovzonecurrent[iprop][layer][1];
+
+	}	//end if envov[iprop] != NULL
+}
+
+//C
+//C
+			/*******************************************/
+			/*   FUNCTION: InvalidateEnvironmentZones  */
+			/*******************************************/
+
+/* Marks all zoned properties stale (cell values are reassigned at the */
+/* next update, see RestoreResetState)                                 */
+
+void InvalidateEnvironmentZones()
+{
+	//local variable declarations
+	int
+		iprop;		//loop index for properties
+
+	//loop over general properties
+	for(iprop=1; iprop<=npropg; iprop++)
+	{
+		//cell values of the property are reassigned at the next update
+		envgzonestale[iprop] = 1;
+
+	}	//end loop over general properties
+
+	//loop over overland properties
+	for(iprop=1; iprop<=npropov; iprop++)
+	{
+		//cell values of the property are reassigned at the next update
+		envovzonestale[iprop] = 1;
+
+	}	//end loop over overland properties
+}
+
+//C
+//C
+			/*******************************************/
+			/*     FUNCTION: FreeEnvironmentZones      */
+			/*******************************************/
+
+/* Frees the zone tables and zone id grids of zoned properties */
+
+void FreeEnvironmentZones()
+{
+	//local variable declarations
+	int
+		iprop,		//loop index for properties
+		row,		//row index
+		layer;		//layer index
+
+	//loop over general properties
+	for(iprop=1; iprop<=npropg; iprop++)
+	{
+		//if the property is zoned or uniform
+		if(envg[iprop] == NULL)
+		{
+			//if the property has a zone id grid
+			if(envgzone[iprop] != NULL)
+			{
+				//loop over rows
+				for(row=1; row<=nrows; row++)
+				{
+					//Deallocate memory for the zone id grid (columns)
+					free(envgzone[iprop][row]);
+
+				}	//end loop over rows
+
+				//Deallocate memory for the zone id grid (rows)
+				free(envgzone[iprop]);
+
+			}	//end if envgzone[iprop] != NULL
+
+			//Deallocate memory for the zone table
+			free(envgzonevalue[iprop]);
+			free(envgzonetfid[iprop]);
+			free(envgzonecurrent[iprop]);
+
+		}	//end if envg[iprop] == NULL
+
+	}	//end loop over general properties
+
+	//Deallocate memory for the general property zone storage
+	free(nenvgzones);
+	free(envgzone);
+	free(envgzonevalue);
+	free(envgzonetfid);
+	free(envgzonecurrent);
+	free(envgzonestale);
+
+	//loop over overland properties
+	for(iprop=1; iprop<=npropov; iprop++)
+	{
+		//if the property is zoned or uniform
+		if(envov[iprop] == NULL)
+		{
+			//loop over layers (include zero for water column)
+			for(layer=0; layer<=maxstackov; layer++)
+			{
+				//if the layer has a zone id grid
+				if(envovzone[iprop][layer] != NULL)
+				{
+					//loop over rows
+					for(row=1; row<=nrows; row++)
+					{
+						//Deallocate memory for the zone id grid (columns)
+						free(envovzone[iprop][layer][row]);
+
+					}	//end loop over rows
+
+					//Deallocate memory for the zone id grid (rows)
+					free(envovzone[iprop][layer]);
+
+				}	//end if envovzone[iprop][layer] != NULL
+
+				//Deallocate memory for the zone table of the layer
+				free(envovzonevalue[iprop][layer]);
+				free(envovzonetfid[iprop][layer]);
+				free(envovzonecurrent[iprop][layer]);
+
+			}	//end loop over layers
+
+			//Deallocate memory for the zone tables (layers)
+			free(nenvovzones[iprop]);
+			free(envovzone[iprop]);
+			free(envovzonevalue[iprop]);
+			free(envovzonetfid[iprop]);
+			free(envovzonecurrent[iprop]);
+
+		}	//end if envov[iprop] == NULL
+
+	}	//end loop over overland properties
+
+	//Deallocate memory for the overland property zone storage
+	free(nenvovzones);
+	free(envovzone);
+	free(envovzonevalue);
+	free(envovzonetfid);
+	free(envovzonecurrent);
+	free(envovzonestale);
+}
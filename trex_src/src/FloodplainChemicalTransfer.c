@@ -33,6 +33,22 @@ C-              Denver, CO 80225
 C-
 C-	Date:		05-MAY-2005
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Overland source/direction slots are addressed
+C-              through OVSLOT (compact overland slot storage).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	The kernel takes a range of chemical types
+C-              (ichemfirst to ichemlast) so that each chemical type
+C-              can be computed as a separate task (see
+C-              SpeciesTasks).
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -56,7 +72,7 @@ C----------------------------------------------------------------------*/
 //trex global variable declarations for environmental conditions
 #include "trex_environmental_declarations.h"
 
-void FloodplainChemicalTransfer()
+void FloodplainChemicalTransfer(int ichemfirst, int ichemlast)
 {
 	//local variable declarations/definitions
 	int
@@ -143,14 +159,14 @@ void FloodplainChemicalTransfer()
 			//Set floodplain fluxes...
 			//
 			//loop over chemicals
-			for(ichem=1; ichem<=nchems; ichem++)
+			for(ichem=ichemfirst; ichem<=ichemlast; ichem++)
 			{
 				//compute the overland inflowing chemical flux (g/s)
-				advchemovinflux[ichem][row][col][9] = advinflowov[row][col][9]
+				advchemovinflux[ichem][row][col][OVSLOT(9)] = advinflowov[row][col][OVSLOT(9)]
 					* cchemch[ichem][i][j][0];
 
 				//compute the overland outflowing chemical flux (g/s)
-				advchemovoutflux[ichem][row][col][9] = advoutflowov[row][col][9]
+				advchemovoutflux[ichem][row][col][OVSLOT(9)] = advoutflowov[row][col][OVSLOT(9)]
 					* cchemov[ichem][row][col][0];
 
 				//compute the channel inflowing chemical flux (g/s)
@@ -166,7 +182,7 @@ void FloodplainChemicalTransfer()
 				//Overland chemical floodplain transfer potential...
 				//
 				//potential (g) for overland chemicals transfer
-				potential = advchemovoutflux[ichem][row][col][9] * dt[idt];
+				potential = advchemovoutflux[ichem][row][col][OVSLOT(9)] * dt[idt];
 
 				//if infiltration is simulated (infopt > 0)
 				if(infopt > 0)
@@ -182,12 +198,12 @@ void FloodplainChemicalTransfer()
 				}	//end if infopt > 0
 
 				//Compute overland outflux (Sources 0, 1, 3, 5, 7, and 10) (g/s)
-				outflux = advchemovoutflux[ichem][row][col][0]
-					+ advchemovoutflux[ichem][row][col][1]
-					+ advchemovoutflux[ichem][row][col][3]
-					+ advchemovoutflux[ichem][row][col][5]
-					+ advchemovoutflux[ichem][row][col][7]
-					+ advchemovoutflux[ichem][row][col][10];
+				outflux = advchemovoutflux[ichem][row][col][OVSLOT(0)]
+					+ advchemovoutflux[ichem][row][col][OVSLOT(1)]
+					+ advchemovoutflux[ichem][row][col][OVSLOT(3)]
+					+ advchemovoutflux[ichem][row][col][OVSLOT(5)]
+					+ advchemovoutflux[ichem][row][col][OVSLOT(7)]
+					+ advchemovoutflux[ichem][row][col][OVSLOT(10)];
 
 				//compute the overland mass available for transfer (g)
 				available = cchemov[ichem][row][col][0] * watervolov
@@ -220,8 +236,8 @@ void FloodplainChemicalTransfer()
 				if(potential > available)
 				{
 					//scale the chemical floodplain transfer flux (g/s) (source 9)
-					advchemovoutflux[ichem][row][col][9] = (float)(available / potential
-							* advchemovoutflux[ichem][row][col][9]);
+					advchemovoutflux[ichem][row][col][OVSLOT(9)] = (float)(available / potential
+							* advchemovoutflux[ichem][row][col][OVSLOT(9)]);
 
 				}	//end if potential > available
 
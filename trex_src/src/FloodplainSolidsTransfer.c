@@ -36,6 +36,13 @@ C-              Denver, CO 80225
 C-
 C-	Date:		05-MAY-2005
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Overland source/direction slots are addressed
+C-              through OVSLOT (compact overland slot storage).
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -145,10 +152,10 @@ void FloodplainSolidsTransfer()
 			//Set floodplain flows...
 			//
 			//multiply overland advective inflow by channel process scale factor
-			advinflowov[row][col][9] = dqovin[row][col][9] * advchscale;
+			advinflowov[row][col][OVSLOT(9)] = dqovin[row][col][OVSLOT(9)] * advchscale;
 
 			//multiply overland advective outflow by overland process scale factor
-			advoutflowov[row][col][9] = dqovout[row][col][9] * advovscale;
+			advoutflowov[row][col][OVSLOT(9)] = dqovout[row][col][OVSLOT(9)] * advovscale;
 
 			//multiply channel advective inflow by overland process scale factor
 			advinflowch[i][j][9] = dqchin[i][j][9] * advovscale;
@@ -162,11 +169,11 @@ void FloodplainSolidsTransfer()
 			for(isolid=1; isolid<=nsolids; isolid++)
 			{
 				//compute the overland inflowing sediment flux (g/s)
-				advsedovinflux[isolid][row][col][9] = advinflowov[row][col][9]
+				advsedovinflux[isolid][row][col][OVSLOT(9)] = advinflowov[row][col][OVSLOT(9)]
 					* csedch[isolid][i][j][0];
 
 				//compute the overland outflowing sediment flux (g/s)
-				advsedovoutflux[isolid][row][col][9] = advoutflowov[row][col][9]
+				advsedovoutflux[isolid][row][col][OVSLOT(9)] = advoutflowov[row][col][OVSLOT(9)]
 					* csedov[isolid][row][col][0];
 
 				//compute the channel inflowing sediment flux (g/s)
@@ -182,15 +189,15 @@ void FloodplainSolidsTransfer()
 				//Overland solids floodplain transfer potential...
 				//
 				//potential (g) for overland solids transfer
-				potential = advsedovoutflux[isolid][row][col][9] * dt[idt];
+				potential = advsedovoutflux[isolid][row][col][OVSLOT(9)] * dt[idt];
 
 				//Compute overland outflux (Sources 0, 1, 3, 5, 7, and 10)
-				outflux = advsedovoutflux[isolid][row][col][0]
-					+ advsedovoutflux[isolid][row][col][1]
-					+ advsedovoutflux[isolid][row][col][3]
-					+ advsedovoutflux[isolid][row][col][5]
-					+ advsedovoutflux[isolid][row][col][7]
-					+ advsedovoutflux[isolid][row][col][10];
+				outflux = advsedovoutflux[isolid][row][col][OVSLOT(0)]
+					+ advsedovoutflux[isolid][row][col][OVSLOT(1)]
+					+ advsedovoutflux[isolid][row][col][OVSLOT(3)]
+					+ advsedovoutflux[isolid][row][col][OVSLOT(5)]
+					+ advsedovoutflux[isolid][row][col][OVSLOT(7)]
+					+ advsedovoutflux[isolid][row][col][OVSLOT(10)];
 
 				//compute the overland mass available for transfer (g)
 				available = csedov[isolid][row][col][0] * watervolov
@@ -216,8 +223,8 @@ void FloodplainSolidsTransfer()
 				if(potential > available)
 				{
 					//scale the solids floodplain transfer flux (g/s) (source 9)
-					advsedovoutflux[isolid][row][col][9] = (float)(available / potential
-							* advsedovoutflux[isolid][row][col][9]);
+					advsedovoutflux[isolid][row][col][OVSLOT(9)] = (float)(available / potential
+							* advsedovoutflux[isolid][row][col][OVSLOT(9)]);
 
 				}	//end if potential > available
 
@@ -47,6 +47,13 @@ C-	Revisions:	Cumulative mass balance calculations moved to
 C-              ChannelWaterdepth for time step option (dtopt)
 C-              implementation.
 C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Overland source/direction slots are addressed
+C-              through OVSLOT (compact overland slot storage).
+C-
 C-  Revised:
 C-
 C-	Revisions:
@@ -162,8 +169,8 @@ void FloodplainWaterTransfer()
 				//       by the time step.
 				//
 				//Compute cell outflow depth (not available for transfer) (m)
-				qcell = ((dqovout[row][col][1] + dqovout[row][col][3]
-					+ dqovout[row][col][5] + dqovout[row][col][7])
+				qcell = ((dqovout[row][col][OVSLOT(1)] + dqovout[row][col][OVSLOT(3)]
+					+ dqovout[row][col][OVSLOT(5)] + dqovout[row][col][OVSLOT(7)])
 					/ (w * w - achsurf)) * dt[idt];
 
 				//Compute effective overland depth for floodplain transfer (m)
@@ -380,8 +387,8 @@ void FloodplainWaterTransfer()
 					dqch[i][j] = dqch[i][j] + vtransfer / dt[idt];
 
 					//store overland plane gross flows (m3/s)
-					dqovin[row][col][9] = 0.0;
-					dqovout[row][col][9] = vtransfer / dt[idt];
+					dqovin[row][col][OVSLOT(9)] = 0.0;
+					dqovout[row][col][OVSLOT(9)] = vtransfer / dt[idt];
 
 					//decrement overland net flow (m3/s)
 					dqov[row][col] = dqov[row][col] - vtransfer / dt[idt];
@@ -406,8 +413,8 @@ void FloodplainWaterTransfer()
 					dqch[i][j] = dqch[i][j] - vtransfer / dt[idt];
 
 					//store overland plane gross flows (m3/s)
-					dqovin[row][col][9] = vtransfer / dt[idt];
-					dqovout[row][col][9] = 0.0;
+					dqovin[row][col][OVSLOT(9)] = vtransfer / dt[idt];
+					dqovout[row][col][OVSLOT(9)] = 0.0;
 
 					//increment overland net flow (m3/s)
 					dqov[row][col] = dqov[row][col] + vtransfer / dt[idt];
@@ -430,8 +437,8 @@ void FloodplainWaterTransfer()
 					dqchout[i][j][9] = 0.0;
 
 					//store overland plane flows (m3/s)
-					dqovin[row][col][9] = 0.0;
-					dqovout[row][col][9] = 0.0;
+					dqovin[row][col][OVSLOT(9)] = 0.0;
+					dqovout[row][col][OVSLOT(9)] = 0.0;
 
 					//Note: For completeness, we could also show that zero
 					//      is added to the cumulative node and cell flow
@@ -502,8 +509,8 @@ void FloodplainWaterTransfer()
 				//       by the time step.
 				//
 				//Compute cell outflow depth (not available for transfer) (m)
-				qcell = ((dqovout[row][col][1] + dqovout[row][col][3]
-					+ dqovout[row][col][5] + dqovout[row][col][7])
+				qcell = ((dqovout[row][col][OVSLOT(1)] + dqovout[row][col][OVSLOT(3)]
+					+ dqovout[row][col][OVSLOT(5)] + dqovout[row][col][OVSLOT(7)])
 					/ (w * w - achsurf)) * dt[idt];
 
 				//Compute effective overland depth for floodplain transfer (m)
@@ -544,8 +551,8 @@ void FloodplainWaterTransfer()
 					dqch[i][j] = dqch[i][j] + vtransfer / dt[idt];
 
 					//store overland plane gross flows (m3/s)
-					dqovin[row][col][9] = 0.0;
-					dqovout[row][col][9] = vtransfer / dt[idt];
+					dqovin[row][col][OVSLOT(9)] = 0.0;
+					dqovout[row][col][OVSLOT(9)] = vtransfer / dt[idt];
 
 					//decrement overland net flow (m3/s)
 					dqov[row][col] = dqov[row][col] - vtransfer / dt[idt];
@@ -566,8 +573,8 @@ void FloodplainWaterTransfer()
 					dqchout[i][j][9] = 0.0;
 
 					//store overland plane flows (m3/s)
-					dqovin[row][col][9] = 0.0;
-					dqovout[row][col][9] = 0.0;
+					dqovin[row][col][OVSLOT(9)] = 0.0;
+					dqovout[row][col][OVSLOT(9)] = 0.0;
 
 					//Note: For completeness, we could also show that zero
 					//      is added to the cumulative node and cell flow
@@ -11,7 +11,11 @@ C-
 C-	Controls:   ksim
 C-
 C-	Calls:		FreeMemoryWater, FreeMemorySolids,
-C-              FreeMemoryChemical
+C-              FreeMemoryChemical, FreeMassAccounting,
+C-              FreeMassBalanceMonitor,
+C-              FreeStepRecovery, FreeResetState, FreeKernelSnapshot,
+C-              FreeSoilParameters, FreeGridOutput,
+C-              CloseSeriesStore, CloseGridPack
 C-
 C-	Called by:	trex, SimulationError
 C-
@@ -37,6 +41,56 @@ C-	Date:		20-MAR-2004
 C-
 C-	Revisions:	Complete Rewrite
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Frees the saved time step state (FreeStepRecovery).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Frees the saved kernel snapshot state (FreeKernelSnapshot).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Frees the surface soil parameters (FreeSoilParameters).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Frees the sparse grid output selection (FreeGridOutput).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Closes the time series stores (CloseSeriesStore).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Closes the packed grid containers (CloseGridPack).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Frees the solids and chemical mass balance terms
+C-              (FreeMassBalanceMonitor).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Frees the state saved after initialization
+C-              (FreeResetState).
+C-
 C-	Date:		
 C-
 C-	Revisions:	
@@ -60,9 +114,33 @@ C---------------------------------------------------------------------*/
 
 void FreeMemory()
 {
+	//Free memory for the saved time step state (step recovery)
+	FreeStepRecovery();
+
+	//Free memory for the state saved after initialization (TrexReset)
+	FreeResetState();
+
+	//Close any snapshot file and free memory for the saved kernel state
+	FreeKernelSnapshot();
+
+	//Free memory for the output selection of sparse grid frames
+	FreeGridOutput();
+
+	//Write the buffered rows of any series stores and free them
+	CloseSeriesStore();
+
+	//Write the time indexes of any packed grid containers and free them
+	CloseGridPack();
+
 	//if sediment transport is simulated
 	if(ksim > 1)
 	{
+		//Free memory for pending mass accounting totals
+		FreeMassAccounting();
+
+		//Free memory for the solids and chemical mass balance terms
+		FreeMassBalanceMonitor();
+
 		//if chemical transport is simulated
 		if(ksim > 2)
 		{
@@ -79,6 +157,9 @@ void FreeMemory()
 
 	}	//end if ksim > 1
 
+	//Free memory for the surface soil parameters
+	FreeSoilParameters();
+
 	//Free memory for water transport variables 
 	FreeMemoryWater();
 
@@ -10,7 +10,7 @@ C-	Outputs:	None
 C-
 C-	Controls:   None
 C-
-C-	Calls:		None
+C-	Calls:		FreePartitionCache
 C-
 C-	Called by:	FreeMemory
 C-
@@ -31,6 +31,20 @@ C-	Revisions:
 C-
 C-	Date:
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added freeing of the partitioning cache.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added freeing of the overland distributed load
+C-              cells and areas (ncwdovcells, cwdovrow, cwdovcol,
+C-              cwdovarea).
+C-
 C---------------------------------------------------------------------*/
 
 //trex global variable declarations
@@ -200,12 +214,19 @@ void FreeMemoryChemical()
 			for(j=1; j<=ncwdov[i]; j++)
 			{
 				//Deallocate memory for distributed chemical loads/forcing functions
+				free(cwdovrow[i][j]);	//deallocate memory
+				free(cwdovcol[i][j]);	//deallocate memory
+				free(cwdovarea[i][j]);	//deallocate memory
 				free(cwdov[i][j]);		//deallocate memory
 				free(cwdovtime[i][j]);	//deallocate memory
 
 			}	//end loop over number of overland distributed loads
 
 			//Deallocate memory for overland distributed chemical loads/forcing functions
+			free(ncwdovcells[i]);		//deallocate memory
+			free(cwdovrow[i]);			//deallocate memory
+			free(cwdovcol[i]);			//deallocate memory
+			free(cwdovarea[i]);			//deallocate memory
 			free(ncwdovpairs[i]);		//deallocate memory
 			free(cwdov[i]);				//deallocate memory
 			free(cwdovtime[i]);			//deallocate memory
@@ -225,6 +246,10 @@ void FreeMemoryChemical()
 
 	//Deallocate memory for overland distributed chemical loads/forcing functions (w)
 	free(ncwdov);			//deallocate memory
+	free(ncwdovcells);		//deallocate memory
+	free(cwdovrow);			//deallocate memory
+	free(cwdovcol);			//deallocate memory
+	free(cwdovarea);		//deallocate memory
 	free(ncwdovpairs);		//deallocate memory
 	free(cwdov);			//deallocate memory
 	free(cwdovtime);		//deallocate memory
@@ -415,14 +440,6 @@ void FreeMemoryChemical()
 				{
 					//Deallocate memory for overland transport parameters
 					free(cchemovnew[ichem][i][j]);		//new overland chemical concentration (for next time t+dt) (g/m3)
-					free(advchemovinflux[ichem][i][j]);	//gross chemical flux transported into a cell by advection (g/s)
-					free(advchemovinmass[ichem][i][j]);	//cumulative gross chemical mass transported into a cell by advection (kg)
-					free(advchemovoutflux[ichem][i][j]);	//gross chemical flux transported out of a cell by advection (g/s)
-					free(advchemovoutmass[ichem][i][j]);	//cumulative gross chemical mass transported out of a cell by advection (kg)
-					free(dspchemovinflux[ichem][i][j]);	//gross chemical flux transported into a cell by dispersion (g/s)
-					free(dspchemovinmass[ichem][i][j]);	//cumulative gross chemical mass transported into a cell by dispersion (kg)
-					free(dspchemovoutflux[ichem][i][j]);	//gross chemical flux transported out of a cell by dispersion (g/s)
-					free(dspchemovoutmass[ichem][i][j]);	//cumulative gross chemical mass transported out of a cell by dispersion (kg)
 					free(depchemovinflux[ichem][i][j]);	//gross chemical flux transported into a cell by deposition (g/s)
 					free(depchemovinmass[ichem][i][j]);	//cumulative gross chemical mass transported into a cell by deposition (kg)
 					free(depchemovoutflux[ichem][i][j]);	//gross chemical flux transported out of a cell by deposition (g/s)
@@ -473,6 +490,16 @@ void FreeMemoryChemical()
 
 			}	//end loop over columns
 
+			//Free compact source/direction slots (all slots of a row are stored in column zero)
+			free(advchemovinflux[ichem][i][0]);
+			free(advchemovinmass[ichem][i][0]);
+			free(advchemovoutflux[ichem][i][0]);
+			free(advchemovoutmass[ichem][i][0]);
+			free(dspchemovinflux[ichem][i][0]);
+			free(dspchemovinmass[ichem][i][0]);
+			free(dspchemovoutflux[ichem][i][0]);
+			free(dspchemovoutmass[ichem][i][0]);
+
 			//Deallocate memory for overland transport parameters
 			free(cchemovnew[ichem][i]);		//new overland chemical concentration (for next time t+dt) (g/m3)
 			free(advchemovinflux[ichem][i]);	//gross chemical flux transported into a cell by advection (g/s)
@@ -1379,5 +1406,12 @@ void FreeMemoryChemical()
 
 
 
+	/*************************************************/
+	/*        Free Partitioning Cache Variables      */
+	/*************************************************/
+
+	//Free memory for the partitioning cache
+	FreePartitionCache();
+
 //End of function: Return to FreeMemory
 }
@@ -8,9 +8,9 @@ C-	Inputs:		None
 C-
 C-	Outputs:	None
 C-
-C-	Controls:   npropg, npropov, npropch, chnopt
+C-	Controls:   npropg, npropov, npropch, chnopt, meltopt
 C-
-C-	Calls:		None
+C-	Calls:		FreeEnvironmentZones
 C-
 C-	Called by:	FreeMemory
 C-
@@ -27,6 +27,21 @@ C-              Denver, CO 80225
 C-
 C-	Date:		14-SEP-2004
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Zoned environmental properties are freed by
+C-              FreeEnvironmentZones.  Fixed the column loop index of
+C-              the overland property deallocation.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Frees the precomputed terrain terms of solar
+C-              radiation for snowmelt.
+C-
 C-	Revisions:
 C-
 C-	Date:
@@ -63,17 +78,25 @@ void FreeMemoryEnvironment()
 //mlv	//Deallocate memory for environmental property file names
 //mlv	free(envpropfile);	//deallocate memory
 
+	//Deallocate memory for zoned environmental properties
+	FreeEnvironmentZones();
+
 	//loop over number of general properties
 	for(iprop=1; iprop<=npropg; iprop++)
 	{
-		//loop over rows
-		for(i=1; i<=nrows; i++)
+		//if the property is distributed (zoned properties have no grids)
+		if(envg[iprop] != NULL)
 		{
-			//Deallocate memory (cols)
-			free(envg[iprop][i]);	//general property cell value
-			free(envgtfid[iprop][i]);	//general property time function id (pointer)
+			//loop over rows
+			for(i=1; i<=nrows; i++)
+			{
+				//Deallocate memory (cols)
+				free(envg[iprop][i]);	//general property cell value
+				free(envgtfid[iprop][i]);	//general property time function id (pointer)
 
-		}	//end loop over rows
+			}	//end loop over rows
+
+		}	//end if envg[iprop] != NULL
 
 		//if time functions are specified
 		if(nenvgtf[iprop] > 0)
@@ -114,23 +137,28 @@ void FreeMemoryEnvironment()
 	//loop over number of overland properties
 	for(iprop=1; iprop<=npropov; iprop++)
 	{
-		//loop over rows
-		for(i=1; i<=nrows; i++)
+		//if the property is distributed (zoned properties have no grids)
+		if(envov[iprop] != NULL)
 		{
-			//loop over columns
-			for(i=1; i<=ncols; i++)
+			//loop over rows
+			for(i=1; i<=nrows; i++)
 			{
-				//Deallocate memory (layers)
-				free(envov[iprop][i][j]);	//overland property cell value
-				free(envovtfid[iprop][i][j]);	//overland property time function id (pointer)
+				//loop over columns
+				for(j=1; j<=ncols; j++)
+				{
+					//Deallocate memory (layers)
+					free(envov[iprop][i][j]);	//overland property cell value
+					free(envovtfid[iprop][i][j]);	//overland property time function id (pointer)
 
-			}	//end loop over columns
+				}	//end loop over columns
 
-			//Deallocate memory (cols)
-			free(envov[iprop][i]);	//overland property cell value
-			free(envovtfid[iprop][i]);	//overland property time function id (pointer)
+				//Deallocate memory (cols)
+				free(envov[iprop][i]);	//overland property cell value
+				free(envovtfid[iprop][i]);	//overland property time function id (pointer)
 
-		}	//end loop over rows
+			}	//end loop over rows
+
+		}	//end if envov[iprop] != NULL
 
 		//Deallocate memory (rows)
 		free(envov[iprop]);		//overland property cell value
@@ -542,6 +570,20 @@ void FreeMemoryEnvironment()
 	free(airtemp);		//air temperature (C) [row][col]
 	free(solarrad);		//solar radiation (W/m2) [row][col]
 
+	//if snowmelt is simulated (meltopt > 0)
+	if(meltopt > 0)
+	{
+		//Deallocate memory for the terrain terms of solar radiation
+		free(solarcellrow);		//row of a solar radiation cell [cell]
+		free(solarcellcol);		//column of a solar radiation cell [cell]
+		free(slopecos);			//cosine of the terrain slope [cell]
+		free(slopesinx);		//sin(slope) * cos(slope azimuth) [cell]
+		free(slopesiny);		//sin(slope) * sin(slope azimuth) [cell]
+		free(solarview);		//sky view and land cover factor [cell]
+		free(solarcosi);		//cosine of the solar incidence angle [cell]
+
+	}	//end if meltopt > 0
+
 	/*************************************************************/
 	/*        Free Named Overland Environmental Properties       */
 	/*************************************************************/
@@ -10,7 +10,7 @@ C-	Outputs:	None
 C-
 C-	Controls:   None
 C-
-C-	Calls:		None
+C-	Calls:		FreeStackLists
 C-
 C-	Called by:	FreeMemory
 C-
@@ -27,9 +27,20 @@ C-              Fort Collins, CO  80523
 C-
 C-	Date:		19-MAR-2004
 C-
-C-	Revisions:
+C-	Revisions:	Free the powers of the solids diameters used by
+C-              transport capacity (dstarpowov).
 C-
-C-	Date:
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Free the load areas of the overland distributed
+C-              solids loads (swdovarea).
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Free the shear stress histories for erosion
+C-              options > 2.
+C-
+C-	Date:		18-OCT-2026
 C-
 C---------------------------------------------------------------------*/
 
@@ -438,6 +449,7 @@ void FreeMemorySolids()
 				//Free memory for overland distributed solids loads/forcing functions
 				free(swdovrow[i][j]);
 				free(swdovcol[i][j]);
+				free(swdovarea[i][j]);
 				free(swdov[i][j]);
 				free(swdovtime[i][j]);
 
@@ -448,6 +460,7 @@ void FreeMemorySolids()
 			free(nswdovpairs[i]);
 			free(swdovrow[i]);
 			free(swdovcol[i]);
+			free(swdovarea[i]);
 			free(swdov[i]);
 			free(swdovtime[i]);
 
@@ -469,6 +482,7 @@ void FreeMemorySolids()
 	free(nswdovcells);
 	free(swdovrow);
 	free(swdovcol);
+	free(swdovarea);
 	free(nswdovpairs);
 	free(swdov);
 	free(swdovtime);
@@ -663,14 +677,6 @@ void FreeMemorySolids()
 				{
 					//Free memory for overland transport parameters
 					free(csedovnew[isolid][i][j]);
-					free(advsedovinflux[isolid][i][j]);
-					free(advsedovinmass[isolid][i][j]);
-					free(advsedovoutflux[isolid][i][j]);
-					free(advsedovoutmass[isolid][i][j]);
-					free(dspsedovinflux[isolid][i][j]);
-					free(dspsedovinmass[isolid][i][j]);
-					free(dspsedovoutflux[isolid][i][j]);
-					free(dspsedovoutmass[isolid][i][j]);
 					free(depsedovinflux[isolid][i][j]);
 					free(depsedovinmass[isolid][i][j]);
 					free(depsedovoutflux[isolid][i][j]);
@@ -688,6 +694,16 @@ void FreeMemorySolids()
 
 			}	//end loop over columns
 
+			//Free compact source/direction slots (all slots of a row are stored in column zero)
+			free(advsedovinflux[isolid][i][0]);
+			free(advsedovinmass[isolid][i][0]);
+			free(advsedovoutflux[isolid][i][0]);
+			free(advsedovoutmass[isolid][i][0]);
+			free(dspsedovinflux[isolid][i][0]);
+			free(dspsedovinmass[isolid][i][0]);
+			free(dspsedovoutflux[isolid][i][0]);
+			free(dspsedovoutmass[isolid][i][0]);
+
 			//Free memory for overland transport parameters
 			free(csedovnew[isolid][i]);
 			free(advsedovinflux[isolid][i]);
@@ -784,15 +800,10 @@ void FreeMemorySolids()
 	//loop over rows
 	for(i=1; i<=nrows; i++)
 	{
-		//loop over columns
-		for(j=1; j<=ncols; j++)
-		{
-			//Free remaining memory for solids transport parameters indexed by row, column, and source/layer
-			free(advinflowov[i][j]);
-			free(advoutflowov[i][j]);
-			free(dspflowov[i][j]);
-
-		}	//end loop over columns
+		//Free compact source/direction slots (all slots of a row are stored in column zero)
+		free(advinflowov[i][0]);
+		free(advoutflowov[i][0]);
+		free(dspflowov[i][0]);
 
 		//Free memory for solids transport parameters indexed by row, column, and source/layer
 		free(advinflowov[i]);
@@ -806,6 +817,24 @@ void FreeMemorySolids()
 	free(advoutflowov);
 	free(dspflowov);
 
+	//if the overland erosion option > 2 (shear stress histories are used)
+	if(ersovopt > 2)
+	{
+		//loop over rows
+		for(i=1; i<=nrows; i++)
+		{
+			//Free memory for overland shear stress histories indexed by row and column
+			free(taumaxov[i]);
+			free(taumaxtimeov[i]);
+
+		}	//end loop over rows
+
+		//Free memory for overland shear stress histories
+		free(taumaxov);
+		free(taumaxtimeov);
+
+	}	//end if ersovopt > 2
+
 	/*****************************************************************/
 	/*        Free Global Channel Solids Transport Variables         */
 	/*****************************************************************/
@@ -962,6 +991,24 @@ void FreeMemorySolids()
 		free(advoutflowch);
 		free(dspflowch);
 
+		//if the channel erosion option > 2 (shear stress histories are used)
+		if(erschopt > 2)
+		{
+			//loop over links
+			for(i=1; i<=nlinks; i++)
+			{
+				//Free memory for channel shear stress histories indexed by link and node
+				free(taumaxch[i]);
+				free(taumaxtimech[i]);
+
+			}	//end loop over links
+
+			//Free memory for channel shear stress histories
+			free(taumaxch);
+			free(taumaxtimech);
+
+		}	//end if erschopt > 2
+
 	}	//end if chnopt = 1
 
 	/****************************************************************/
@@ -1304,5 +1351,19 @@ void FreeMemorySolids()
 
 	}	//end if chnopt > 0
 
+	//Free memory for the soil/sediment stack work lists and event log
+	FreeStackLists();
+
+	//loop over number of land use classes
+	for(i=1; i<=nlands; i++)
+	{
+		//Free memory for transport capacity grain size weights
+		free(dstarpowov[i]);
+
+	}	//end loop over land use classes
+
+	//Free memory for transport capacity grain size weights
+	free(dstarpowov);
+
 //End of function: Return to FreeMemory
 }
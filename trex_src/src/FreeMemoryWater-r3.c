@@ -37,6 +37,13 @@ C-	Date:       23-MAY-2004
 C-
 C-	Revisions:  Complete Rewrite
 C-
+C-	Revised:    TREX Development Team
+C-
+C-	Date:       18-OCT-2026
+C-
+C-	Revisions:  Free the snowfall function arrays for snow gages
+C-              (snowopt = 2).
+C-
 C-	Date:
 C-
 C-	Revisions:
@@ -429,19 +436,14 @@ void FreeMemoryWater()
 	//Loop over number of rows
 	for(i=1; i<=nrows; i++)
 	{
-		//jfe this crashed when looping over sources, and columns...
-		//need a fix for the third dimension when using a number (11) in malloc!!
+		//Free compact source/direction slots of gross overland flow parameters
+		//(all slots of a row are stored in one block held in column zero)
+		free(dqovin[i][0]);		//gross overland flow into a cell (m3/s)
+		free(dqovout[i][0]);	//gross overland flow out of a cell (m3/s)
+		free(dqovinvol[i][0]);	//cumulative gross overland flow volume into a cell (m3)
+		free(dqovoutvol[i][0]);	//cumulative gross overland flow volume out of a cell (m3)
+		free(sfov[i][0]);		//friction slope for overland flow from a cell
 
-		//Loop over number of columns
-/*      for(j=1; j<=ncols; j++)
-		{
-			free(dqovin[i][j]);		//gross overland flow into a cell (m3/s)
-			free(dqovout[i][j]);		//gross overland flow out of a cell (m3/s)
-			free(dqovinvol[i][j]);		//cumulative gross overland flow volume into a cell (m3)
-			free(dqovoutvol[i][j]);	//cumulative gross overland flow volume out of a cell (m3)
-
-		}	//end loop over columns
-*/		
 		free(hovnew[i]);      //new overland water depth (m)
 		free(dqov[i]);        //net overland flow (m3/s)
 		free(dqovin[i]);      //gross overland flow into a cell (m3/s)
@@ -556,6 +558,19 @@ void FreeMemoryWater()
 	free(rfpoint);	//pointer (to position in time series) for rainfall intensity
 	free(rfinterp);	//rainfall intensity interpolated in time for gage [i]
 
+	//if snowfall via gages is simulated (snowopt == 2)
+	if(snowopt == 2)
+	{
+		//Free memory for snowfall function arrays
+		free(nsft);		//next (upper) interval time for snowfall intensity time series
+		free(psft);		//prior (lower) interval time for snowfall intensity time series
+		free(bsf);		//intercept for snowfall intensity interpolation
+		free(msf);		//slope for snowfall intensity interpolation
+		free(sfpoint);	//pointer (to position in time series) for snowfall intensity
+		free(sfinterp);	//snowfall intensity interpolated in time for gage [i]
+
+	}	//end if snowopt == 2
+
 	//if user specifies external overland flows
 	if (nqwov > 0)
 	{
@@ -11,7 +11,7 @@ C-	Outputs:	grid file at time = timeprintgrid
 C-
 C-	Controls:   None
 C-
-C-	Calls:		None
+C-	Calls:		WriteSparseGrid
 C-
 C-	Called by:	WriteGrids
 C-
@@ -45,6 +45,26 @@ C-  Revisions:	Added code so that errors caused by bad file names
 C-              and paths are are reported to the simulation error
 C-              file in addition to the screen.
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Output files are opened by OpenOutputFile.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added sparse grid output frames (-gridsparse,
+C-              -gridwindows)
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added packed grid output containers (-gridpack, see
+C-              GridPack)
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -74,6 +94,28 @@ void Grid(char name[], float **gridvalue, float conversion, int gridcount)
 	//Declare local grid file pointer;
 	FILE *gridfile_fp;
 
+	//if grid output is written as compressed frames (see GridPack)
+	if(gridpackopt > 0)
+	{
+		//append the grid as a frame to its container
+		WritePackedGrid(name, gridvalue, conversion, gridcount);
+
+		//the raster is not written
+		return;
+
+	}	//end if gridpackopt > 0
+
+	//if grid output is written as sparse frames (see GridOutput)
+	if(gridsparseopt > 0)
+	{
+		//write the cells of the output selection as a sparse frame
+		WriteSparseGrid(name, gridvalue, conversion, gridcount);
+
+		//the full raster is not written
+		return;
+
+	}	//end if gridsparseopt > 0
+
 	//Allocate memory for simulation error file name
 	gridfile = (char *)malloc(MAXNAMESIZE * sizeof(char));
 
@@ -89,7 +131,7 @@ void Grid(char name[], float **gridvalue, float conversion, int gridcount)
 	gridfile_fp = NULL;
 
 	//open the grid file for writing
-	gridfile_fp = fopen(gridfile, "w");
+	gridfile_fp = OpenOutputFile(gridfile, "w");
 
 	//if the local grid file pointer is null, abort execution
 	if(gridfile_fp == NULL)
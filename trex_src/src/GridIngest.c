@@ -0,0 +1,839 @@
+/*----------------------------------------------------------------------
+C-  File:       GridIngest.c
+C-
+C-  Purpose/    Concatenated group of functions for the fast ingestion
+C-  Methods:    of ESRI ASCII grid values.
+C-
+C-              The grid file readers (mask, elevation, soils, land
+C-              use, soil stack, initial conditions, environmental
+C-              grids, etc.) read the header of a grid with fscanf and
+C-              then scan the values one at a time through ImageScanInt
+C-              and ImageScanFloat.  When the values are read from the
+C-              grid file (not from a model image), the first scan of a
+C-              grid maps the rest of the file into memory and parses
+C-              all of its values at once:
+C-
+C-                (1) the value text is split into chunks at white
+C-                    space, and the values of each chunk are counted
+C-                    (in parallel);
+C-
+C-                (2) the chunks are parsed into one value buffer (in
+C-                    parallel), each chunk at the offset given by the
+C-                    counts of the chunks before it.
+C-
+C-              Later scans of the grid return the buffered values in
+C-              order.  Chunks are parsed on the OpenMP threads (the
+C-              number of threads is set by OMP_NUM_THREADS).  Grids
+C-              smaller than INGESTCHUNKSIZE, and all grids without
+C-              OpenMP, are parsed as one chunk.
+C-
+C-              Values are parsed with a tokenizer instead of fscanf.
+C-              A decimal value whose digits and power of ten are
+C-              exact in double precision (at most 2^53 and 10^22) is
+C-              converted with one rounding in double precision and
+C-              rounded to float, unless it lies exactly half way
+C-              between two floats.  Other values (and the
+C-              half way cases) are converted by strtof.  The values
+C-              are therefore the same as those scanned by fscanf.
+C-              When any value is not a plain integer (integer grids)
+C-              or number (float grids), the grid is read with fscanf
+C-              as before.  Without mmap (Windows), grids are always
+C-              read with fscanf.
+C-
+C-  Function
+C-   Listing:   BeginIngestGrid, EndIngestGrid, IngestScanInt,
+C-              IngestScanFloat, IngestGrid, IngestCount,
+C-              IngestParseChunk, IngestParseInt, IngestParseFloat,
+C-              IngestConvertFloat
+C-
+C-  Inputs:     grid file values
+C-
+C-  Outputs:    grid values (to the grid file readers)
+C-
+C-  Controls:   None
+C-
+C-  Calls:      None
+C-
+C-  Called by:  BeginImageGrid, EndImageGrid, ImageScanInt,
+C-              ImageScanFloat
+C-
+C-  Created:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revised:
+C-
+C-  Date:
+C-
+C-  Revisions:
+C-
+C----------------------------------------------------------------------*/
+
+//trex general variable declarations
+#include "trex_general_declarations.h"
+
+#include <stdint.h>		//C library for fixed width integer types
+#include <limits.h>		//C library for integer limits
+
+#ifndef WINDOWS
+#include <sys/mman.h>	//POSIX memory mapped files
+#include <sys/stat.h>	//POSIX file status
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>		//OpenMP thread counts
+#endif
+
+#define INGESTCHUNKSIZE 262144	//minimum size of a parse chunk (bytes)
+#define INGESTTOKENSIZE 64		//maximum length of a value converted by strtof (characters)
+#define INGESTMAXCHUNKS 256		//maximum number of parse chunks
+
+//state of the grid being read
+#define INGESTIDLE 0			//values are not scanned yet
+#define INGESTBUFFERED 1		//values are returned from the value buffer
+#define INGESTSCANNED 2			//values are scanned by fscanf
+
+static int ingeststate = INGESTIDLE;	//state of the grid being read
+static void *ingestvalues = NULL;		//buffered values of the grid (int or float)
+static size_t ingestbytes = 0;			//size of the value buffer (bytes)
+static size_t ingestcount = 0;			//number of buffered values
+static size_t ingestnext = 0;			//index of the next value to return
+
+//white space separating grid values (as for fscanf in the C locale)
+#define INGESTSPACE(c) ((c) == ' ' || (c) == '\n' || (c) == '\r' || (c) == '\t' || (c) == '\v' || (c) == '\f')
+
+//C
+//C
+			/*****************************************/
+			/*       FUNCTION: BeginIngestGrid       */
+			/*****************************************/
+
+/* Starts the ingestion of a grid file (no values are parsed until the
+   first value is scanned) */
+
+void BeginIngestGrid()
+{
+	//release the values of a grid that was not ended
+	EndIngestGrid();
+
+//end of function BeginIngestGrid
+}
+
+//C
+//C
+			/*****************************************/
+			/*        FUNCTION: EndIngestGrid        */
+			/*****************************************/
+
+/* Releases the buffered values of the grid file just read */
+
+void EndIngestGrid()
+{
+	//if values are buffered
+	if(ingestvalues != NULL)
+	{
+#ifndef WINDOWS
+		//release the value buffer
+		munmap(ingestvalues, ingestbytes);
+#endif
+		ingestvalues = NULL;
+	}
+
+	//no grid is being read
+	ingeststate = INGESTIDLE;
+	ingestcount = 0;
+	ingestnext = 0;
+
+//end of function EndIngestGrid
+}
+
+//C
+//C
+			/*****************************************/
+			/*        FUNCTION: IngestCount          */
+			/*****************************************/
+
+/* Returns the number of values (white space separated tokens) between
+   start and end */
+
+static size_t IngestCount(const char *start, const char *end)
+{
+	//local variable declarations
+	size_t
+		count;		//number of values
+
+	const char
+		*c;			//position in text
+
+	//no values are counted
+	count = 0;
+
+	//loop over characters
+	for(c=start; c<end; c++)
+	{
+		//if a value starts here (not space, preceded by space or the start)
+		if(!INGESTSPACE(*c) && (c == start || INGESTSPACE(*(c-1))))
+		{
+			//count the value
+			count = count + 1;
+		}
+
+	}	//end loop over characters
+
+	//return the count
+	return count;
+
+//end of function IngestCount
+}
+
+//C
+//C
+			/*****************************************/
+			/*        FUNCTION: IngestParseInt       */
+			/*****************************************/
+
+/* Converts an integer value from start to end (returns 1, or 0 if the
+   value is not a plain integer in the range of int) */
+
+static int IngestParseInt(const char *start, const char *end, int *value)
+{
+	//local variable declarations
+	int
+		negative,	//value is negative (1) or not (0)
+		ndigits;	//number of significant digits
+
+	long long
+		number;		//value of the digits
+
+	const char
+		*c;			//position in text
+
+	//read the sign
+	c = start;
+	negative = 0;
+
+	if(*c == '-' || *c == '+')
+	{
+		negative = (*c == '-');
+		c++;
+	}
+
+	//if there are no digits
+	if(c == end)
+	{
+		return 0;
+	}
+
+	//no digits are read
+	number = 0;
+	ndigits = 0;
+
+	//loop over digits
+	for(; c<end; c++)
+	{
+		//if the character is not a digit
+		if(*c < '0' || *c > '9')
+		{
+			return 0;
+		}
+
+		//add the digit
+		number = 10 * number + (*c - '0');
+
+		//count significant digits (leading zeros do not count)
+		if(number > 0)
+		{
+			ndigits = ndigits + 1;
+		}
+
+		//if the value does not fit an int
+		if(ndigits > 10 || number > (long long)INT_MAX + negative)
+		{
+			return 0;
+		}
+
+	}	//end loop over digits
+
+	//set the value
+	*value = (int)(negative ? -number : number);
+
+	//the value is converted
+	return 1;
+
+//end of function IngestParseInt
+}
+
+//C
+//C
+			/*****************************************/
+			/*     FUNCTION: IngestConvertFloat      */
+			/*****************************************/
+
+/* Converts a value from start to end with strtof (returns 1, or 0 if
+   strtof does not convert the whole value) */
+
+static int IngestConvertFloat(const char *start, const char *end, float *value)
+{
+	//local variable declarations
+	char
+		token[INGESTTOKENSIZE],	//copy of the value text
+		*last;					//end of the converted text
+
+	//if the value is too long to copy
+	if(end - start >= INGESTTOKENSIZE)
+	{
+		return 0;
+	}
+
+	//copy the value text (the mapped file is not null terminated)
+	memcpy(token, start, end - start);
+	token[end - start] = '\0';
+
+	//convert the value
+	*value = strtof(token, &last);
+
+	//return whether the whole value was converted
+	return (last == token + (end - start));
+
+//end of function IngestConvertFloat
+}
+
+//C
+//C
+			/*****************************************/
+			/*       FUNCTION: IngestParseFloat      */
+			/*****************************************/
+
+/* Converts a float value from start to end (returns 1, or 0 if the
+   value can't be converted) */
+
+static int IngestParseFloat(const char *start, const char *end, float *value)
+{
+	//local variable declarations
+	int
+		negative,		//value is negative (1) or not (0)
+		ndigits,		//number of significant digits
+		nmantissa,		//number of digits of the mantissa (integer and fraction)
+		exponent,		//power of ten of the mantissa
+		expvalue,		//value of the exponent field
+		expnegative,	//exponent is negative (1) or not (0)
+		expdigits;		//number of digits of the exponent field
+
+	uint64_t
+		mantissa;		//significant digits as an integer
+
+	double
+		scaled,			//value in double precision
+		half;			//value half way between two floats
+
+	float
+		rounded,		//value rounded to float
+		neighbor;		//next float away from rounded toward scaled
+
+	const char
+		*c;				//position in text
+
+	//powers of ten that are exact in double precision
+	static const double power10[23] =
+		{1.0e0, 1.0e1, 1.0e2, 1.0e3, 1.0e4, 1.0e5, 1.0e6, 1.0e7, 1.0e8, 1.0e9, 1.0e10,
+		 1.0e11, 1.0e12, 1.0e13, 1.0e14, 1.0e15, 1.0e16, 1.0e17, 1.0e18, 1.0e19,
+		 1.0e20, 1.0e21, 1.0e22};
+
+	//read the sign
+	c = start;
+	negative = 0;
+
+	if(c < end && (*c == '-' || *c == '+'))
+	{
+		negative = (*c == '-');
+		c++;
+	}
+
+	//no digits are read
+	mantissa = 0;
+	ndigits = 0;
+	nmantissa = 0;
+	exponent = 0;
+
+	//loop over integer digits
+	for(; c<end && *c>='0' && *c<='9'; c++)
+	{
+		//add the digit
+		mantissa = 10 * mantissa + (uint64_t)(*c - '0');
+		nmantissa = nmantissa + 1;
+
+		//count significant digits (leading zeros do not count)
+		if(mantissa > 0)
+		{
+			ndigits = ndigits + 1;
+		}
+
+	}	//end loop over integer digits
+
+	//if there is a decimal point
+	if(c < end && *c == '.')
+	{
+		//loop over fraction digits
+		for(c++; c<end && *c>='0' && *c<='9'; c++)
+		{
+			//add the digit
+			mantissa = 10 * mantissa + (uint64_t)(*c - '0');
+			nmantissa = nmantissa + 1;
+			exponent = exponent - 1;
+
+			//count significant digits
+			if(mantissa > 0)
+			{
+				ndigits = ndigits + 1;
+			}
+
+		}	//end loop over fraction digits
+
+	}	//end if decimal point
+
+	//if there is an exponent
+	if(nmantissa > 0 && c < end && (*c == 'e' || *c == 'E'))
+	{
+		//read the exponent sign
+		c++;
+		expnegative = 0;
+
+		if(c < end && (*c == '-' || *c == '+'))
+		{
+			expnegative = (*c == '-');
+			c++;
+		}
+
+		//no exponent digits are read
+		expvalue = 0;
+		expdigits = 0;
+
+		//loop over exponent digits
+		for(; c<end && *c>='0' && *c<='9'; c++)
+		{
+			//add the digit (large exponents are left to strtof)
+			if(expvalue < 10000)
+			{
+				expvalue = 10 * expvalue + (*c - '0');
+			}
+
+			expdigits = expdigits + 1;
+
+		}	//end loop over exponent digits
+
+		//if the exponent has no digits
+		if(expdigits == 0)
+		{
+			//the value is not a plain number
+			return IngestConvertFloat(start, end, value);
+		}
+
+		//add the exponent
+		exponent = exponent + (expnegative ? -expvalue : expvalue);
+
+	}	//end if exponent
+
+	//if the value is not a plain decimal number or has too many digits
+	if(nmantissa == 0 || c != end || ndigits > 19)
+	{
+		//convert the value with strtof (inf, nan, hexadecimal, long values)
+		return IngestConvertFloat(start, end, value);
+	}
+
+	//if the value is zero
+	if(mantissa == 0)
+	{
+		//set a signed zero
+		*value = negative ? -0.0f : 0.0f;
+
+		return 1;
+	}
+
+	//if the mantissa or the power of ten is not exact in double precision
+	if(mantissa > ((uint64_t)1 << 53) || exponent < -22 || exponent > 22)
+	{
+		//convert the value with strtof
+		return IngestConvertFloat(start, end, value);
+	}
+
+	//the value in double precision (one correctly rounded operation)
+	if(exponent >= 0)
+	{
+		scaled = (double)mantissa * power10[exponent];
+	}
+	else
+	{
+		scaled = (double)mantissa / power10[-exponent];
+	}
+
+	//round to float
+	rounded = (float)scaled;
+
+	//if the double value is not a float
+	if((double)rounded != scaled)
+	{
+		//the next float on the other side of the double value
+		neighbor = nextafterf(rounded, (scaled > (double)rounded) ? HUGE_VALF : -HUGE_VALF);
+
+		//the value half way between the floats (exact in double precision)
+		half = 0.5 * ((double)rounded + (double)neighbor);
+
+		//if the double value is half way (its rounding may differ from the decimal value)
+		if(scaled == half)
+		{
+			//convert the value with strtof
+			return IngestConvertFloat(start, end, value);
+		}
+
+	}	//end if rounded != scaled
+
+	//set the value
+	*value = negative ? -rounded : rounded;
+
+	//the value is converted
+	return 1;
+
+//end of function IngestParseFloat
+}
+
+//C
+//C
+			/*****************************************/
+			/*      FUNCTION: IngestParseChunk       */
+			/*****************************************/
+
+/* Converts the values from start to end into the value buffer from
+   index ivalue (type 1 = int, 2 = float).  Returns the number of
+   values that can't be converted (parsing stops at the first) */
+
+static int IngestParseChunk(const char *start, const char *end, size_t ivalue, int type)
+{
+	//local variable declarations
+	int
+		failed;		//number of values that can't be converted
+
+	const char
+		*c,			//position in text
+		*token;		//start of a value
+
+	//all values are converted
+	failed = 0;
+	c = start;
+
+	//loop over the values of the chunk
+	while(c < end && failed == 0)
+	{
+		//skip white space
+		while(c < end && INGESTSPACE(*c))
+		{
+			c++;
+		}
+
+		//if the chunk ends
+		if(c == end)
+		{
+			break;
+		}
+
+		//find the end of the value
+		token = c;
+
+		while(c < end && !INGESTSPACE(*c))
+		{
+			c++;
+		}
+
+		//convert the value (int or float)
+		if(type == 1)
+		{
+			failed = !IngestParseInt(token, c, (int *)ingestvalues + ivalue);
+		}
+		else
+		{
+			failed = !IngestParseFloat(token, c, (float *)ingestvalues + ivalue);
+		}
+
+		//next value
+		ivalue = ivalue + 1;
+
+	}	//end loop over values
+
+	//return the number of values that can't be converted
+	return failed;
+
+//end of function IngestParseChunk
+}
+
+//C
+//C
+			/*****************************************/
+			/*          FUNCTION: IngestGrid         */
+			/*****************************************/
+
+/* Parses all remaining values of a grid file into the value buffer
+   (type 1 = int, 2 = float).  Returns 1 when the values are buffered
+   or 0 when the grid must be read with fscanf */
+
+static int IngestGrid(FILE *grid_fp, int type)
+{
+#ifndef WINDOWS
+	//local variable declarations
+	int
+		nchunks,		//number of parse chunks
+		ichunk,			//loop index for chunks
+		failed;			//a value could not be parsed (1) or not (0)
+
+	long
+		position;		//position of the first value in the file (bytes)
+
+	size_t
+		first[INGESTMAXCHUNKS+1];	//index of the first value of each chunk
+
+	struct stat
+		status;			//file status
+
+	char
+		*base,			//start of the mapped file
+		*text,			//start of the value text
+		*end,			//end of the value text
+		*bound[INGESTMAXCHUNKS+1];	//start of each chunk
+
+	//get the position of the first value (the header was read with fscanf)
+	position = ftell(grid_fp);
+
+	//if the position or size of the file is not known or there are no values
+	if(position < 0 || fstat(fileno(grid_fp), &status) != 0
+		|| (long)status.st_size <= position)
+	{
+		//read the grid with fscanf
+		return 0;
+	}
+
+	//map the file
+	base = (char *)mmap(NULL, (size_t)status.st_size, PROT_READ, MAP_PRIVATE, fileno(grid_fp), 0);
+
+	//if the file can't be mapped
+	if(base == MAP_FAILED)
+	{
+		//read the grid with fscanf
+		return 0;
+	}
+
+	//the value text follows the header
+	text = base + position;
+	end = base + status.st_size;
+
+	//the number of chunks (one per INGESTCHUNKSIZE bytes, at most four per thread)
+	nchunks = (int)((end - text) / INGESTCHUNKSIZE) + 1;
+
+#ifdef _OPENMP
+	if(nchunks > 1 && nchunks > 4 * omp_get_max_threads())
+	{
+		nchunks = 4 * omp_get_max_threads();
+	}
+
+	if(nchunks > INGESTMAXCHUNKS)
+	{
+		nchunks = INGESTMAXCHUNKS;
+	}
+#else
+	nchunks = 1;
+#endif
+
+	//loop over chunks
+	for(ichunk=0; ichunk<=nchunks; ichunk++)
+	{
+		//divide the text evenly
+		bound[ichunk] = text + (size_t)(end - text) / nchunks * ichunk;
+
+		//the last chunk ends at the end of the text
+		if(ichunk == nchunks)
+		{
+			bound[ichunk] = end;
+		}
+
+		//move the bound to white space (values are not split)
+		while(ichunk > 0 && bound[ichunk] < end && !INGESTSPACE(*bound[ichunk]))
+		{
+			bound[ichunk]++;
+		}
+
+		//bounds increase
+		if(ichunk > 0 && bound[ichunk] < bound[ichunk-1])
+		{
+			bound[ichunk] = bound[ichunk-1];
+		}
+
+	}	//end loop over chunks
+
+	//if the text is divided into chunks
+	if(nchunks > 1)
+	{
+		//count the values of each chunk (in parallel)
+		#pragma omp parallel for schedule(static)
+		for(ichunk=0; ichunk<nchunks; ichunk++)
+		{
+			first[ichunk+1] = IngestCount(bound[ichunk], bound[ichunk+1]);
+		}
+	}
+	else	//else the text is one chunk
+	{
+		//count the values
+		first[1] = IngestCount(bound[0], bound[1]);
+
+	}	//end if nchunks > 1
+
+	//offset of the values of each chunk
+	first[0] = 0;
+
+	for(ichunk=1; ichunk<=nchunks; ichunk++)
+	{
+		first[ichunk] = first[ichunk] + first[ichunk-1];
+	}
+
+	//map an anonymous value buffer (int and float are both 4 bytes)
+	//
+	//Note:  The buffer is not allocated with malloc, so that a large
+	//       buffer does not raise the mmap threshold of malloc and change
+	//       the heap layout (and accounting) of the grid arrays.  For the
+	//       same reason the chunk bounds and offsets are local arrays.
+	ingestcount = first[nchunks];
+	ingestbytes = (ingestcount+1) * 4;
+	ingestvalues = mmap(NULL, ingestbytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+	//if the buffer can't be mapped
+	if(ingestvalues == MAP_FAILED)
+	{
+		//unmap the file
+		munmap(base, (size_t)status.st_size);
+
+		//read the grid with fscanf
+		ingestvalues = NULL;
+		ingestcount = 0;
+
+		return 0;
+
+	}	//end if ingestvalues == MAP_FAILED
+
+	//if the text is divided into chunks
+	if(nchunks > 1)
+	{
+		//parse the values of each chunk (in parallel)
+		failed = 0;
+
+		#pragma omp parallel for schedule(static) reduction(+:failed)
+		for(ichunk=0; ichunk<nchunks; ichunk++)
+		{
+			failed += IngestParseChunk(bound[ichunk], bound[ichunk+1], first[ichunk], type);
+		}
+	}
+	else	//else the text is one chunk
+	{
+		//parse the values (no parallel region for small grids)
+		failed = IngestParseChunk(bound[0], bound[1], 0, type);
+
+	}	//end if nchunks > 1
+
+	//unmap the file
+	munmap(base, (size_t)status.st_size);
+
+	//if a value could not be parsed
+	if(failed > 0)
+	{
+		//release the value buffer
+		munmap(ingestvalues, ingestbytes);
+		ingestvalues = NULL;
+		ingestcount = 0;
+
+		//read the grid with fscanf
+		return 0;
+
+	}	//end if failed > 0
+
+	//the values are buffered
+	ingestnext = 0;
+
+	return 1;
+#else
+	//read the grid with fscanf (no memory mapped files)
+	return 0;
+#endif
+
+//end of function IngestGrid
+}
+
+//C
+//C
+			/*****************************************/
+			/*        FUNCTION: IngestScanInt        */
+			/*****************************************/
+
+/* Reads the next integer value of a grid file */
+
+void IngestScanInt(FILE *grid_fp, int *value)
+{
+	//if this is the first value of the grid
+	if(ingeststate == INGESTIDLE)
+	{
+		//parse all values of the grid (or read them with fscanf)
+		ingeststate = IngestGrid(grid_fp, 1) ? INGESTBUFFERED : INGESTSCANNED;
+	}
+
+	//if the values are buffered
+	if(ingeststate == INGESTBUFFERED)
+	{
+		//if values remain (at the end of the file the value is not changed, as for fscanf)
+		if(ingestnext < ingestcount)
+		{
+			//return the next value
+			*value = ((int *)ingestvalues)[ingestnext];
+			ingestnext = ingestnext + 1;
+		}
+	}
+	else	//else the values are scanned
+	{
+		//read value from grid file
+		fscanf(grid_fp, "%d", value);
+
+	}	//end if ingeststate == INGESTBUFFERED
+
+//end of function IngestScanInt
+}
+
+//C
+//C
+			/*****************************************/
+			/*       FUNCTION: IngestScanFloat       */
+			/*****************************************/
+
+/* Reads the next float value of a grid file */
+
+void IngestScanFloat(FILE *grid_fp, float *value)
+{
+	//if this is the first value of the grid
+	if(ingeststate == INGESTIDLE)
+	{
+		//parse all values of the grid (or read them with fscanf)
+		ingeststate = IngestGrid(grid_fp, 2) ? INGESTBUFFERED : INGESTSCANNED;
+	}
+
+	//if the values are buffered
+	if(ingeststate == INGESTBUFFERED)
+	{
+		//if values remain (at the end of the file the value is not changed, as for fscanf)
+		if(ingestnext < ingestcount)
+		{
+			//return the next value
+			*value = ((float *)ingestvalues)[ingestnext];
+			ingestnext = ingestnext + 1;
+		}
+	}
+	else	//else the values are scanned
+	{
+		//read value from grid file
+		fscanf(grid_fp, "%f", value);
+
+	}	//end if ingeststate == INGESTBUFFERED
+
+//end of function IngestScanFloat
+}
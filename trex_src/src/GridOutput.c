@@ -0,0 +1,905 @@
+/*----------------------------------------------------------------------
+C-  File:       GridOutput.c
+C-
+C-  Purpose/    Concatenated group of functions to write grid output
+C-  Methods:    as sparse frames.
+C-
+C-              By default, Grid writes every cell of the raster (with
+C-              NODATA_value padding) for each grid output at each
+C-              grid print time.  When sparse grid output is selected
+C-              (gridsparseopt > 0, see TrexSetGridSparse and the
+C-              -gridsparse option of trex), Grid writes a sparse
+C-              frame instead.  A frame lists only the cells of the
+C-              output selection:
+C-
+C-                gridsparseopt = 1   the cells with a value that is
+C-                                    not zero;
+C-
+C-                gridsparseopt = 2   every cell.
+C-
+C-              The output selection is the domain (imask != nodata),
+C-              optionally restricted to the windows and mask zones of
+C-              a grid windows file (see TrexSetGridWindows and the
+C-              -gridwindows option of trex).  Each line of the file
+C-              selects cells:
+C-
+C-                domain [step]
+C-                window row1 col1 row2 col2 [step]
+C-                mask gridfile value [step]
+C-
+C-              where step decimates the selection (every step-th row
+C-              and column from the first row and column of the
+C-              window, or from row 1 and column 1 for the domain and
+C-              mask zones).  Lines that start with # are comments.
+C-
+C-              The selection is stored as runs of cells along a row
+C-              with a constant column step.  A frame has the header
+C-              of an ESRI ASCII grid (after a TREXSPARSE line), the
+C-              number of selected cells, the filter (nonzero or
+C-              none), and one line per run of listed cells:
+C-
+C-                row col step count value1 ... valuecount
+C-
+C-              Values are written as by Grid.  In frames of non-zero
+C-              cells, the cells of the selection that are not listed
+C-              are zero.  The selection of these frames is written
+C-              once per grid output to name.cells (a frame of the
+C-              mask values of the selected cells), and named by each
+C-              frame.  Cells outside the selection are NODATA_value.
+C-              The trexgrid program reconstructs the full raster of
+C-              a frame.
+C-
+C-  Function
+C-   Listing:   SetGridWindows, InitializeGridOutput, WriteSparseGrid,
+C-              FreeGridOutput, ReadGridWindows, ReadGridWindowMask,
+C-              BuildGridRuns, WriteGridFrameHeader, WriteGridSelection,
+C-              GridCellListed
+C-
+C-  Inputs:     grid windows file, grid values (Grid)
+C-
+C-  Outputs:    sparse grid frames, selection files
+C-
+C-  Controls:   gridsparseopt
+C-
+C-  Calls:      OpenOutputFile, BeginIngestGrid, IngestScanInt,
+C-              EndIngestGrid
+C-
+C-  Called by:  Initialize, Grid, FreeMemory, TrexSetGridWindows
+C-
+C-  Created:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revised:
+C-
+C-  Date:
+C-
+C-  Revisions:
+C-
+C----------------------------------------------------------------------*/
+
+//trex general variable declarations
+#include "trex_general_declarations.h"
+
+//trex global variable declarations for water transport (mask and grid location)
+#include "trex_water_declarations.h"
+
+#define GRIDFRAMEMAGIC "TREXSPARSE"	//sparse frame file signature
+#define GRIDFRAMEVERSION 1			//sparse frame format version
+#define GRIDWINDOWLINE 1024			//maximum length of a grid windows file line
+
+//run of selected cells along a row
+typedef struct
+{
+	int row;		//row of the first cell
+	int col;		//column of the first cell
+	int step;		//column step between cells
+	int count;		//number of cells
+} gridrun;
+
+static char gridwindowfile[MAXNAMESIZE] = "";	//grid windows file name ("" = whole domain)
+static gridrun *gridruns = NULL;		//runs of the output selection
+static int ngridruns = 0;				//number of runs of the output selection
+static long ngridselected = 0;			//number of cells of the output selection
+static char **gridcellfiles = NULL;		//grid outputs whose selection file was written
+static int ngridcellfiles = 0;			//number of selection files written
+
+//C
+//C
+			/*****************************************/
+			/*        FUNCTION: SetGridWindows       */
+			/*****************************************/
+
+/* Sets the grid windows file of the output selection (NULL or "" =
+   whole domain) */
+
+void SetGridWindows(char *file)
+{
+	//if no file is given
+	if(file == NULL)
+	{
+		//the selection is the whole domain
+		gridwindowfile[0] = '\0';
+	}
+	else	//else a file is given
+	{
+		//store the file name (truncated to MAXNAMESIZE)
+		strncpy(gridwindowfile, file, MAXNAMESIZE-1);
+		gridwindowfile[MAXNAMESIZE-1] = '\0';
+
+	}	//end if file == NULL
+
+//end of function SetGridWindows
+}
+
+//C
+//C
+			/*****************************************/
+			/*     FUNCTION: ReadGridWindowMask      */
+			/*****************************************/
+
+/* Selects the cells of a mask grid file with a given value (every
+   step-th row and column) */
+
+static void ReadGridWindowMask(char *maskname, int value, int step, unsigned char **selected)
+{
+	//local variable declarations
+	int
+		gridrows,		//number of rows in grid
+		gridcols,		//number of columns in grid
+		gridnodata,		//no data value of grid
+		zone;			//mask value of a cell
+
+	float
+		gridx,			//x location of grid lower left corner (m)
+		gridy,			//y location of grid lower left corner (m)
+		cellsize;		//length of grid cell (m)
+
+	FILE
+		*mask_fp;		//mask grid file pointer
+
+	//Open the mask grid file for reading
+	mask_fp = fopen(maskname, "r");
+
+	//if the mask grid file pointer is null, abort execution
+	if(mask_fp == NULL)
+	{
+		//Write message to file
+		fprintf(echofile_fp, "Error! Can't open Grid Window Mask File : %s \n", maskname);
+
+		//Write message to screen
+		printf("Error! Can't open Grid Window Mask File : %s \n", maskname);
+		exit(EXIT_FAILURE);	//abort
+	}
+
+	//Record 1
+	fgets(header, MAXHEADERSIZE, mask_fp);	//read header
+
+	//Record 2
+	fscanf(mask_fp, "%s %d %s %d %s %f %s %f %s %f %s %d",	//read
+		varname,		//dummy
+		&gridcols,		//number of columns in grid
+		varname,		//dummy
+		&gridrows,		//number of rows in grid
+		varname,		//dummy
+		&gridx,			//x location of grid lower left corner (m) (GIS projection)
+		varname,		//dummy
+		&gridy,			//y location projection of grid lower left corner (m) (GIS projection)
+		varname,		//dummy
+		&cellsize,		//length of grid cell (m) (this means dx must equal dy)
+		varname,		//dummy
+		&gridnodata);	//no data value (null value)
+
+	//If number of grid rows, grid columns, or cell size do not equal global values, abort...
+	if(gridrows != nrows || gridcols != ncols || cellsize != dx)
+	{
+		//Write error message to file
+		fprintf(echofile_fp, "\n\n\nGrid Window Mask File Error: %s\n", maskname);
+		fprintf(echofile_fp,       "  nrows = %5d   grid rows = %5d\n", nrows, gridrows);
+		fprintf(echofile_fp,       "  ncols = %5d   grid cols = %5d\n", ncols, gridcols);
+		fprintf(echofile_fp,       "  dx = %12.4f   dy = %12.4f   cell size = %12.4f\n", dx, dy, cellsize);
+
+		//Write error message to screen
+		printf("Grid Window Mask File Error: %s\n", maskname);
+		printf("  nrows = %5d   grid rows = %5d\n", nrows, gridrows);
+		printf("  ncols = %5d   grid cols = %5d\n", ncols, gridcols);
+		printf("  dx = %12.4f   dy = %12.4f   cell size = %12.4f\n", dx, dy, cellsize);
+
+		exit(EXIT_FAILURE);					//abort
+
+	}	//end check of grid dimensions
+
+	//Start the ingestion of the mask values
+	BeginIngestGrid();
+
+	//Loop over number of rows
+	for(i=1; i<=nrows; i++)
+	{
+		//Loop over number of columns
+		for(j=1; j<=ncols; j++)
+		{
+			//read mask value
+			zone = gridnodata;
+			IngestScanInt(mask_fp, &zone);
+
+			//if the cell is in the zone and on the decimation lattice
+			if(zone == value && (i-1) % step == 0 && (j-1) % step == 0)
+			{
+				//select the cell
+				selected[i][j] = 1;
+			}
+
+		}	//end loop over columns
+
+	}	//end loop over rows
+
+	//Release the mask values
+	EndIngestGrid();
+
+	//Close the mask grid file
+	fclose(mask_fp);
+
+//end of function ReadGridWindowMask
+}
+
+//C
+//C
+			/*****************************************/
+			/*       FUNCTION: ReadGridWindows       */
+			/*****************************************/
+
+/* Selects the cells of the domain, windows, and mask zones of the grid
+   windows file */
+
+static void ReadGridWindows(unsigned char **selected)
+{
+	//local variable declarations
+	int
+		lineno,			//line number in windows file
+		nfields,		//number of fields read from a line
+		row1,			//first row of a window
+		col1,			//first column of a window
+		row2,			//last row of a window
+		col2,			//last column of a window
+		value,			//mask value of a zone
+		step;			//decimation step (rows and columns)
+
+	char
+		line[GRIDWINDOWLINE],		//line of windows file
+		keyword[GRIDWINDOWLINE],	//selection keyword (domain, window, mask)
+		maskname[GRIDWINDOWLINE];	//mask grid file name
+
+	FILE
+		*windows_fp;	//grid windows file pointer
+
+	//Open the grid windows file for reading
+	windows_fp = fopen(gridwindowfile, "r");
+
+	//if the grid windows file pointer is null, abort execution
+	if(windows_fp == NULL)
+	{
+		//Write message to file
+		fprintf(echofile_fp, "Error! Can't open Grid Windows File : %s \n", gridwindowfile);
+
+		//Write message to screen
+		printf("Error! Can't open Grid Windows File : %s \n", gridwindowfile);
+		exit(EXIT_FAILURE);	//abort
+	}
+
+	//Echo the grid windows file name to file
+	fprintf(echofile_fp, "\n  Grid Windows File: %s\n", gridwindowfile);
+
+	//no lines are read
+	lineno = 0;
+
+	//loop over lines of the windows file
+	while(fgets(line, GRIDWINDOWLINE, windows_fp) != NULL)
+	{
+		//count the line
+		lineno = lineno + 1;
+
+		//if the line is blank or a comment
+		if(sscanf(line, "%s", keyword) != 1 || keyword[0] == '#')
+		{
+			//skip the line
+			continue;
+		}
+
+		//the default step selects every cell
+		step = 1;
+
+		//if the line selects the domain
+		if(strcmp(keyword, "domain") == 0)
+		{
+			//read the step (optional)
+			nfields = sscanf(line, "%*s %d", &step);
+
+			//if the step is not valid
+			if(nfields == 0 || step < 1)
+			{
+				//the line is not valid
+				break;
+			}
+
+			//loop over rows and columns of the decimation lattice
+			for(i=1; i<=nrows; i=i+step)
+			{
+				for(j=1; j<=ncols; j=j+step)
+				{
+					//select the cell
+					selected[i][j] = 1;
+				}
+			}
+
+			//Echo the selection to file
+			fprintf(echofile_fp, "    domain  step = %d\n", step);
+		}
+		else if(strcmp(keyword, "window") == 0)	//else if the line selects a window
+		{
+			//read the window bounds and the step (optional)
+			nfields = sscanf(line, "%*s %d %d %d %d %d", &row1, &col1, &row2, &col2, &step);
+
+			//if the window is not valid
+			if(nfields < 4 || step < 1 || row1 < 1 || col1 < 1
+				|| row2 > nrows || col2 > ncols || row1 > row2 || col1 > col2)
+			{
+				//the line is not valid
+				break;
+			}
+
+			//loop over rows and columns of the decimation lattice
+			for(i=row1; i<=row2; i=i+step)
+			{
+				for(j=col1; j<=col2; j=j+step)
+				{
+					//select the cell
+					selected[i][j] = 1;
+				}
+			}
+
+			//Echo the selection to file
+			fprintf(echofile_fp, "    window  rows %d-%d  columns %d-%d  step = %d\n",
+				row1, row2, col1, col2, step);
+		}
+		else if(strcmp(keyword, "mask") == 0)	//else if the line selects a mask zone
+		{
+			//read the mask file, zone value, and step (optional)
+			nfields = sscanf(line, "%*s %s %d %d", maskname, &value, &step);
+
+			//if the zone is not valid
+			if(nfields < 2 || step < 1)
+			{
+				//the line is not valid
+				break;
+			}
+
+			//select the cells of the zone
+			ReadGridWindowMask(maskname, value, step, selected);
+
+			//Echo the selection to file
+			fprintf(echofile_fp, "    mask  %s  value = %d  step = %d\n", maskname, value, step);
+		}
+		else	//else the keyword is not known
+		{
+			//the line is not valid
+			break;
+
+		}	//end if keyword
+
+	}	//end loop over lines
+
+	//if the file was not read to the end
+	if(!feof(windows_fp))
+	{
+		//Write message to file
+		fprintf(echofile_fp, "\n\nError! Invalid line %d of Grid Windows File %s :\n  %s\n",
+			lineno, gridwindowfile, line);
+
+		//Write message to screen
+		printf("Error! Invalid line %d of Grid Windows File %s :\n  %s\n",
+			lineno, gridwindowfile, line);
+		exit(EXIT_FAILURE);	//abort
+
+	}	//end if !feof
+
+	//Close the grid windows file
+	fclose(windows_fp);
+
+//end of function ReadGridWindows
+}
+
+//C
+//C
+			/*****************************************/
+			/*        FUNCTION: BuildGridRuns        */
+			/*****************************************/
+
+/* Stores the selected cells of the domain as runs along each row */
+
+static void BuildGridRuns(unsigned char **selected)
+{
+	//local variable declarations
+	int
+		maxruns,		//allocated number of runs
+		last;			//column of the last cell of the current run
+
+	gridrun
+		*run;			//current run
+
+	//no runs are allocated
+	maxruns = 0;
+	ngridruns = 0;
+	ngridselected = 0;
+
+	//Loop over number of rows
+	for(i=1; i<=nrows; i++)
+	{
+		//no run is open on this row
+		run = NULL;
+		last = 0;
+
+		//Loop over number of columns
+		for(j=1; j<=ncols; j++)
+		{
+			//if the cell is not selected or not in the domain
+			if(selected[i][j] == 0 || imask[i][j] == nodatavalue)
+			{
+				//next cell
+				continue;
+			}
+
+			//count the cell
+			ngridselected = ngridselected + 1;
+
+			//if the run has one cell (the second cell sets the step)
+			if(run != NULL && run->count == 1)
+			{
+				//set the step of the run
+				run->step = j - last;
+			}
+
+			//if the cell continues the open run
+			if(run != NULL && j - last == run->step)
+			{
+				//extend the run
+				run->count = run->count + 1;
+			}
+			else	//else the cell starts a new run
+			{
+				//if the run array is full
+				if(ngridruns == maxruns)
+				{
+					//grow the run array
+					maxruns = 2 * maxruns + nrows;
+					gridruns = (gridrun *)realloc(gridruns, maxruns * sizeof(gridrun));
+				}
+
+				//start the run
+				run = &gridruns[ngridruns];
+				run->row = i;
+				run->col = j;
+				run->step = 1;
+				run->count = 1;
+
+				//count the run
+				ngridruns = ngridruns + 1;
+
+			}	//end if j - last == run->step
+
+			//the last cell of the run
+			last = j;
+
+		}	//end loop over columns
+
+	}	//end loop over rows
+
+//end of function BuildGridRuns
+}
+
+//C
+//C
+			/*****************************************/
+			/*     FUNCTION: InitializeGridOutput    */
+			/*****************************************/
+
+/* Builds the output selection of sparse grid frames */
+
+void InitializeGridOutput()
+{
+	//local variable declarations
+	unsigned char
+		**selected;		//selected cells (1 = selected, 0 = not selected)
+
+	//if grid output is written as full rasters
+	if(gridsparseopt == 0)
+	{
+		//no selection is needed
+		return;
+	}
+
+	//Open echo file in append mode
+	echofile_fp = OpenOutputFile(echofile, "a");
+
+	//Write label for sparse grid output to file
+	fprintf(echofile_fp, "\n\n\n  Sparse Grid Output  \n");
+	fprintf(echofile_fp,       "~~~~~~~~~~~~~~~~~~~~~~\n");
+
+	//Allocate memory for the selected cells
+	selected = (unsigned char **)malloc((nrows+1) * sizeof(unsigned char *));
+
+	//Loop over number of rows
+	for(i=1; i<=nrows; i++)
+	{
+		//Allocate remaining memory for the selected cells (no cells are selected)
+		selected[i] = (unsigned char *)calloc(ncols+1, sizeof(unsigned char));
+	}
+
+	//if a grid windows file is given
+	if(gridwindowfile[0] != '\0')
+	{
+		//select the cells of the windows file
+		ReadGridWindows(selected);
+	}
+	else	//else the whole domain is selected
+	{
+		//Loop over number of rows
+		for(i=1; i<=nrows; i++)
+		{
+			//Loop over number of columns
+			for(j=1; j<=ncols; j++)
+			{
+				//select the cell
+				selected[i][j] = 1;
+			}
+		}
+
+	}	//end if gridwindowfile is not blank
+
+	//Store the selected domain cells as runs
+	BuildGridRuns(selected);
+
+	//Loop over number of rows
+	for(i=1; i<=nrows; i++)
+	{
+		//deallocate memory
+		free(selected[i]);
+	}
+
+	//deallocate memory for the selected cells
+	free(selected);
+
+	//Echo the selection to file
+	fprintf(echofile_fp, "\n  Frames list %s cells of %ld selected cells (%d runs)\n",
+		(gridsparseopt == 1) ? "the non-zero" : "all", ngridselected, ngridruns);
+
+	//Close echo file
+	fclose(echofile_fp);
+
+//end of function InitializeGridOutput
+}
+
+//C
+//C
+			/*****************************************/
+			/*     FUNCTION: WriteGridFrameHeader    */
+			/*****************************************/
+
+/* Writes the header of a sparse grid frame */
+
+static void WriteGridFrameHeader(FILE *frame_fp, char *filter, char *selection)
+{
+	//signature and format version
+	fprintf(frame_fp, "%s\t%d\n", GRIDFRAMEMAGIC, GRIDFRAMEVERSION);
+
+	//ESRI ASCII grid header (as written by Grid)
+	fprintf(frame_fp, "ncols\t\t%d\n", ncols);
+	fprintf(frame_fp, "nrows\t\t%d\n", nrows);
+	fprintf(frame_fp, "xllcorner\t%.2f\n", xllcorner);
+	fprintf(frame_fp, "yllcorner\t%.2f\n", yllcorner);
+	fprintf(frame_fp, "cellsize\t%.2f\n", w);
+	fprintf(frame_fp, "NODATA_value\t%d\n", nodatavalue);
+
+	//number of cells of the output selection
+	fprintf(frame_fp, "cells\t\t%ld\n", ngridselected);
+
+	//filter of the listed cells (nonzero or none)
+	fprintf(frame_fp, "filter\t\t%s\n", filter);
+
+	//if the frame names a selection file (cells that are not listed are zero)
+	if(selection != NULL)
+	{
+		//selection file name (in the directory of the frame)
+		fprintf(frame_fp, "selection\t%s\n", selection);
+	}
+
+//end of function WriteGridFrameHeader
+}
+
+//C
+//C
+			/*****************************************/
+			/*      FUNCTION: WriteGridSelection     */
+			/*****************************************/
+
+/* Writes the selection file of a grid output (name.cells) once per
+   simulation and returns the file name without its directory */
+
+static char *WriteGridSelection(char *name)
+{
+	//local variable declarations
+	int
+		ifile,			//loop index for written selection files
+		irun,			//loop index for runs
+		icell;			//loop index for cells of a run
+
+	char
+		*cellfile,		//selection file name
+		*base;			//selection file name without its directory
+
+	FILE
+		*cellfile_fp;	//selection file pointer
+
+	//Allocate memory for the selection file name
+	cellfile = (char *)malloc(MAXNAMESIZE * sizeof(char));
+
+	//the selection file is of the form "name.cells"
+	snprintf(cellfile, MAXNAMESIZE, "%s.cells", name);
+
+	//the file name without its directory
+	base = strrchr(cellfile, '/');
+	base = (base == NULL) ? cellfile : base + 1;
+
+	//loop over written selection files
+	for(ifile=0; ifile<ngridcellfiles; ifile++)
+	{
+		//if the selection file was written
+		if(strcmp(gridcellfiles[ifile], cellfile) == 0)
+		{
+			//deallocate memory for the file name
+			free(cellfile);
+
+			//return the stored name without its directory
+			base = strrchr(gridcellfiles[ifile], '/');
+			return (base == NULL) ? gridcellfiles[ifile] : base + 1;
+		}
+
+	}	//end loop over written selection files
+
+	//open the selection file for writing
+	cellfile_fp = OpenOutputFile(cellfile, "w");
+
+	//if the selection file pointer is null, abort execution
+	if(cellfile_fp == NULL)
+	{
+		//Write message to file
+		fprintf(echofile_fp, "\n\nError!  Can't create Grid Selection File : %s \n", cellfile);
+
+		//Write message to screen
+		printf("Error! Can't create Grid Selection File : %s \n", cellfile);
+		exit(EXIT_FAILURE);	//abort
+	}
+
+	//write the frame header (all cells of the selection are listed)
+	WriteGridFrameHeader(cellfile_fp, "none", NULL);
+
+	//loop over runs
+	for(irun=0; irun<ngridruns; irun++)
+	{
+		//write the run
+		fprintf(cellfile_fp, "%d %d %d %d", gridruns[irun].row, gridruns[irun].col,
+			gridruns[irun].step, gridruns[irun].count);
+
+		//loop over the cells of the run
+		for(icell=0; icell<gridruns[irun].count; icell++)
+		{
+			//write the mask value of the cell
+			fprintf(cellfile_fp, " %d",
+				imask[gridruns[irun].row][gridruns[irun].col + icell * gridruns[irun].step]);
+		}
+
+		//finish each run with a hard return
+		fprintf(cellfile_fp, "\n");
+
+	}	//end loop over runs
+
+	//Close the selection file
+	fclose(cellfile_fp);
+
+	//store the selection file name (written once per simulation)
+	gridcellfiles = (char **)realloc(gridcellfiles, (ngridcellfiles+1) * sizeof(char *));
+	gridcellfiles[ngridcellfiles] = cellfile;
+	ngridcellfiles = ngridcellfiles + 1;
+
+	//return the name without its directory
+	return base;
+
+//end of function WriteGridSelection
+}
+
+//C
+//C
+			/*****************************************/
+			/*       FUNCTION: GridCellListed        */
+			/*****************************************/
+
+/* Returns 1 when a cell of a run is listed in a frame (all cells, or
+   cells with a non-zero value, negative zero included), 0 otherwise */
+
+static int GridCellListed(float **gridvalue, float conversion, gridrun *run, int icell)
+{
+	//local variable declarations
+	float
+		value;		//converted value of the cell
+
+	//if frames list all cells of the selection
+	if(gridsparseopt != 1)
+	{
+		//the cell is listed
+		return 1;
+	}
+
+	//convert the value (as for Grid)
+	value = gridvalue[run->row][run->col + icell * run->step] * conversion;
+
+	//the cell is listed when it is not zero (a negative zero is not written as 0)
+	return (value != 0.0 || signbit(value));
+
+//end of function GridCellListed
+}
+
+//C
+//C
+			/*****************************************/
+			/*       FUNCTION: WriteSparseGrid       */
+			/*****************************************/
+
+/* Writes the cells of the output selection of a grid as a sparse frame
+   (in an individual file indexed by gridcount) */
+
+void WriteSparseGrid(char name[], float **gridvalue, float conversion, int gridcount)
+{
+	//local variable declarations
+	int
+		irun,			//loop index for runs
+		icell,			//index of a cell of a run
+		first,			//index of the first listed cell of a run
+		count;			//loop index for listed cells of a run
+
+	char
+		*gridfile,		//frame file name
+		*selection;		//selection file name (frames of non-zero cells)
+
+	gridrun
+		*run;			//current run
+
+	FILE
+		*gridfile_fp;	//frame file pointer
+
+	//if frames list only the non-zero cells
+	if(gridsparseopt == 1)
+	{
+		//write the selection of the grid output (once)
+		selection = WriteGridSelection(name);
+	}
+	else	//else frames list all cells of the selection
+	{
+		//no selection file is needed
+		selection = NULL;
+	}
+
+	//Allocate memory for the frame file name
+	gridfile = (char *)malloc(MAXNAMESIZE * sizeof(char));
+
+	//the frame file is of the form "name.gridcount" (as for Grid)
+	snprintf(gridfile, MAXNAMESIZE, "%s.%d", name, gridcount);
+
+	//open the frame file for writing
+	gridfile_fp = OpenOutputFile(gridfile, "w");
+
+	//if the frame file pointer is null, abort execution
+	if(gridfile_fp == NULL)
+	{
+		//Write message to file
+		fprintf(echofile_fp, "\n\nError!  Can't create local Grid Output File : %s \n", gridfile);
+
+		//Write message to screen
+		printf("Error! Can't create local Grid Output File : %s \n", gridfile);
+		exit(EXIT_FAILURE);	//abort
+	}
+
+	//write the frame header
+	WriteGridFrameHeader(gridfile_fp, (gridsparseopt == 1) ? "nonzero" : "none", selection);
+
+	//loop over runs
+	for(irun=0; irun<ngridruns; irun++)
+	{
+		//the run
+		run = &gridruns[irun];
+
+		//start at the first cell of the run
+		icell = 0;
+
+		//loop over the listed cells of the run
+		while(icell < run->count)
+		{
+			//skip the cells that are not listed
+			while(icell < run->count && !GridCellListed(gridvalue, conversion, run, icell))
+			{
+				icell = icell + 1;
+			}
+
+			//if the run ends
+			if(icell == run->count)
+			{
+				break;
+			}
+
+			//find the end of the listed cells
+			first = icell;
+
+			while(icell < run->count && GridCellListed(gridvalue, conversion, run, icell))
+			{
+				icell = icell + 1;
+			}
+
+			//write the run of listed cells (row, column, step, and count)
+			fprintf(gridfile_fp, "%d %d %d %d", run->row, run->col + first * run->step,
+				run->step, icell - first);
+
+			//loop over the listed cells
+			for(count=first; count<icell; count++)
+			{
+				//write the value of the cell (as for Grid)
+				fprintf(gridfile_fp, " %e", gridvalue[run->row][run->col + count * run->step] * conversion);
+			}
+
+			//finish each run of listed cells with a hard return
+			fprintf(gridfile_fp, "\n");
+
+		}	//end loop over listed cells
+
+	}	//end loop over runs
+
+	//Close local file pointer
+	fclose(gridfile_fp);
+
+	//deallocate memory for local variables
+	free(gridfile);
+
+//end of function WriteSparseGrid
+}
+
+//C
+//C
+			/*****************************************/
+			/*        FUNCTION: FreeGridOutput       */
+			/*****************************************/
+
+/* Frees the output selection and the names of the selection files */
+
+void FreeGridOutput()
+{
+	//local variable declarations
+	int
+		ifile;		//loop index for written selection files
+
+	//free the runs of the output selection
+	free(gridruns);
+	gridruns = NULL;
+	ngridruns = 0;
+	ngridselected = 0;
+
+	//loop over written selection files
+	for(ifile=0; ifile<ngridcellfiles; ifile++)
+	{
+		//free the file name
+		free(gridcellfiles[ifile]);
+	}
+
+	//free the selection file names (written again by the next simulation)
+	free(gridcellfiles);
+	gridcellfiles = NULL;
+	ngridcellfiles = 0;
+
+//end of function FreeGridOutput
+}
@@ -0,0 +1,862 @@
+/*----------------------------------------------------------------------
+C-  File:       GridPack.c
+C-
+C-  Purpose/    Concatenated group of functions to write grid output
+C-  Methods:    as compressed frames of one container per grid.
+C-
+C-              By default, Grid writes one ESRI ASCII raster file per
+C-              grid output and grid print time (name.gridcount).
+C-              When packed grid output is selected (gridpackopt = 1,
+C-              see TrexSetGridPack and the -gridpack option of trex),
+C-              Grid appends a compressed frame to the container of
+C-              the grid output instead (name.gpk).  Packed output
+C-              takes precedence over sparse grid output (GridOutput).
+C-
+C-              A frame holds the value (gridvalue * conversion, as a
+C-              float) of each domain cell (imask != nodata) in row
+C-              major order.  The values are packed losslessly:
+C-
+C-                delta     the bits of each value are xored with the
+C-                          bits of the value of the previous frame
+C-                          (unchanged cells become zero), except in
+C-                          key frames (every GRIDPACKKEYFRAMES frames);
+C-
+C-                shuffle   the cells are split into chunks of
+C-                          GRIDPACKCHUNKCELLS cells, and the bytes of
+C-                          the values of a chunk are grouped by byte
+C-                          position (all low bytes, ..., all high
+C-                          bytes);
+C-
+C-                coder     each chunk is coded by a byte oriented LZ
+C-                          coder (literal runs and back references
+C-                          with a 16 bit offset).  A chunk that does
+C-                          not compress is stored as is.
+C-
+C-              Chunks are packed in parallel on the OpenMP threads.
+C-              Each frame is appended to its container when it is
+C-              written, and the time index of the frames is appended
+C-              at the end of the run (CloseGridPack).  The layout of a
+C-              container is described with TREXGRIDPACKID in
+C-              trex_library.h.  The trexunpack program lists the
+C-              frames of a container and writes the raster of any
+C-              frame, identical to the raster written by Grid.
+C-
+C-  Function
+C-   Listing:   WritePackedGrid, UnpackGridFrame, CloseGridPack,
+C-              FindGridPack, PackChunk, UnpackChunk, PackLength
+C-
+C-  Inputs:     grid values (Grid), imask
+C-
+C-  Outputs:    packed grid containers
+C-
+C-  Controls:   gridpackopt
+C-
+C-  Calls:      OpenOutputFile
+C-
+C-  Called by:  Grid, TrexUnpackGridFrame, TrexFinalize, FreeMemory
+C-
+C-  Created:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revised:
+C-
+C-  Date:
+C-
+C-  Revisions:
+C-
+C----------------------------------------------------------------------*/
+
+//trex general variable declarations
+#include "trex_general_declarations.h"
+
+//trex global variable declarations for water transport (mask and grid location)
+#include "trex_water_declarations.h"
+
+//trex library interface (packed grid container layout)
+#include "trex_library.h"
+
+#ifdef _OPENMP
+#include <omp.h>		//OpenMP thread counts
+#endif
+
+#define GRIDPACKCHUNKCELLS 16384	//cells of a chunk (chunks are packed independently)
+#define GRIDPACKKEYFRAMES 16		//frames from one key frame to the next
+#define GRIDPACKHASHBITS 12			//bits of the match table index of the coder
+#define GRIDPACKMINMATCH 4			//shortest back reference (bytes)
+#define GRIDPACKMAXOFFSET 65535		//farthest back reference (bytes)
+
+//worst case size of a packed chunk of n bytes (token, length, and chunk size bytes)
+#define GRIDPACKBOUND(n) ((n) + (n) / 255 + 16)
+
+//packed grid container of one grid output
+typedef struct
+{
+	char name[MAXNAMESIZE];		//grid output name
+	unsigned int *previous;		//value bits of the previous frame [ncells]
+	int nframes;				//number of frames written
+	long long size;				//size of the container file (bytes)
+	TrexGridPackFrame *frames;	//time index of the frames
+} gridpack;
+
+static gridpack *gridpacks = NULL;		//containers (one per grid output)
+static int ngridpacks = 0;				//number of containers
+static int gridpackcells = 0;			//number of domain cells (values of a frame)
+static unsigned int *gridpackbits = NULL;	//value bits (delta) of the frame being packed [ncells]
+static unsigned char *gridpackwork = NULL;	//shuffled bytes of the chunks [4*ncells]
+static unsigned char *gridpackout = NULL;	//packed chunks [nchunks][GRIDPACKBOUND(chunk bytes)]
+
+//C
+//C
+			/*****************************************/
+			/*          FUNCTION: PackLength         */
+			/*****************************************/
+
+/* Writes the extension bytes of a literal or match length (the token
+   holds the first 15) and returns the position after them */
+
+static int PackLength(unsigned char *out, int op, int length)
+{
+	//while the length needs another byte
+	while(length >= 255)
+	{
+		//write a full byte
+		out[op++] = 255;
+		length = length - 255;
+	}
+
+	//write the last byte
+	out[op++] = (unsigned char)length;
+
+	//return the position after the length
+	return op;
+
+//end of function PackLength
+}
+
+//C
+//C
+			/*****************************************/
+			/*          FUNCTION: PackChunk          */
+			/*****************************************/
+
+/* Shuffles and codes the value bits of a chunk.  Returns the size of
+   the packed chunk (negative when the chunk is stored as is). */
+
+static int PackChunk(unsigned int *bits, int ncells, unsigned char *work, unsigned char *out)
+{
+	//local variable declarations
+	int
+		table[1 << GRIDPACKHASHBITS],	//last position of each hashed 4 byte sequence
+		nbytes,			//number of bytes of the chunk
+		cell,			//cell index
+		ip,				//input position
+		anchor,			//first input byte not yet written (literal run start)
+		op,				//output position
+		candidate,		//position of an earlier occurrence of the sequence
+		literals,		//length of the literal run
+		length,			//length of the match
+		hash,			//hash of the sequence at ip
+		n;				//loop index
+
+	unsigned int
+		sequence;		//4 bytes at ip
+
+	//shuffle: group the bytes of the values by byte position
+	for(cell=0; cell<ncells; cell++)
+	{
+		work[cell] = (unsigned char)(bits[cell] & 0xff);
+		work[ncells+cell] = (unsigned char)((bits[cell] >> 8) & 0xff);
+		work[2*ncells+cell] = (unsigned char)((bits[cell] >> 16) & 0xff);
+		work[3*ncells+cell] = (unsigned char)(bits[cell] >> 24);
+	}
+
+	//number of bytes to code
+	nbytes = 4 * ncells;
+
+	//no sequence has been seen
+	for(n=0; n<(1 << GRIDPACKHASHBITS); n++)
+	{
+		table[n] = -1;
+	}
+
+	ip = 0;
+	anchor = 0;
+	op = 0;
+
+	//while a match can start at ip
+	while(ip + GRIDPACKMINMATCH <= nbytes)
+	{
+		//hash the 4 bytes at ip
+		sequence = (unsigned int)work[ip] | ((unsigned int)work[ip+1] << 8)
+			| ((unsigned int)work[ip+2] << 16) | ((unsigned int)work[ip+3] << 24);
+		hash = (int)((sequence * 2654435761u) >> (32 - GRIDPACKHASHBITS));
+
+		//look up and replace the last position of the sequence
+		candidate = table[hash];
+		table[hash] = ip;
+
+		//if the sequence occurred within reach
+		if(candidate >= 0 && ip - candidate <= GRIDPACKMAXOFFSET
+			&& memcmp(&work[candidate], &work[ip], GRIDPACKMINMATCH) == 0)
+		{
+			//extend the match
+			length = GRIDPACKMINMATCH;
+
+			while(ip + length < nbytes && work[candidate+length] == work[ip+length])
+			{
+				length++;
+			}
+
+			//write the token (literal and match length), the literals, and the offset
+			literals = ip - anchor;
+			out[op++] = (unsigned char)(((literals < 15) ? literals : 15) << 4
+				| ((length - GRIDPACKMINMATCH < 15) ? length - GRIDPACKMINMATCH : 15));
+
+			if(literals >= 15)
+			{
+				op = PackLength(out, op, literals - 15);
+			}
+
+			memcpy(&out[op], &work[anchor], literals);
+			op = op + literals;
+			out[op++] = (unsigned char)((ip - candidate) & 0xff);
+			out[op++] = (unsigned char)((ip - candidate) >> 8);
+
+			if(length - GRIDPACKMINMATCH >= 15)
+			{
+				op = PackLength(out, op, length - GRIDPACKMINMATCH - 15);
+			}
+
+			//continue after the match
+			ip = ip + length;
+			anchor = ip;
+		}
+		else	//else no match: skip faster through long literal runs
+		{
+			ip = ip + 1 + ((ip - anchor) >> 6);
+
+		}	//end if a match was found
+
+	}	//end while a match can start
+
+	//write the last literals (a token without a match ends the chunk)
+	literals = nbytes - anchor;
+	out[op++] = (unsigned char)(((literals < 15) ? literals : 15) << 4);
+
+	if(literals >= 15)
+	{
+		op = PackLength(out, op, literals - 15);
+	}
+
+	memcpy(&out[op], &work[anchor], literals);
+	op = op + literals;
+
+	//if the chunk did not compress
+	if(op >= nbytes)
+	{
+		//store the shuffled bytes as is
+		memcpy(out, work, nbytes);
+		return -nbytes;
+	}
+
+	//return the size of the packed chunk
+	return op;
+
+//end of function PackChunk
+}
+
+//C
+//C
+			/*****************************************/
+			/*         FUNCTION: UnpackChunk         */
+			/*****************************************/
+
+/* Decodes and unshuffles a packed chunk into value bits.  Returns 0
+   on success or -1 when the chunk is not valid. */
+
+static int UnpackChunk(unsigned char *in, int size, int ncells, unsigned char *work, unsigned int *bits)
+{
+	//local variable declarations
+	int
+		nbytes,			//number of bytes of the chunk
+		ip,				//input position
+		op,				//output position
+		literals,		//length of a literal run
+		length,			//length of a match
+		offset,			//offset of a match
+		extra,			//length extension byte
+		cell;			//cell index
+
+	//number of bytes of the chunk
+	nbytes = 4 * ncells;
+
+	//if the chunk is stored as is
+	if(size < 0)
+	{
+		//the size must be the size of the chunk
+		if(-size != nbytes)
+		{
+			return -1;
+		}
+
+		memcpy(work, in, nbytes);
+	}
+	else	//else the chunk is coded
+	{
+		ip = 0;
+		op = 0;
+
+		//loop over sequences
+		while(ip < size)
+		{
+			//read the literal length
+			literals = in[ip] >> 4;
+			length = (in[ip++] & 15) + GRIDPACKMINMATCH;
+
+			if(literals == 15)
+			{
+				do
+				{
+					if(ip >= size)
+					{
+						return -1;
+					}
+
+					extra = in[ip++];
+					literals = literals + extra;
+
+				} while(extra == 255);
+			}
+
+			//copy the literals
+			if(literals > size - ip || literals > nbytes - op)
+			{
+				return -1;
+			}
+
+			memcpy(&work[op], &in[ip], literals);
+			ip = ip + literals;
+			op = op + literals;
+
+			//if the chunk is complete (the last sequence has no match)
+			if(op == nbytes)
+			{
+				break;
+			}
+
+			//read the offset and the match length
+			if(ip + 2 > size)
+			{
+				return -1;
+			}
+
+			offset = in[ip] | (in[ip+1] << 8);
+			ip = ip + 2;
+
+			if(length == 15 + GRIDPACKMINMATCH)
+			{
+				do
+				{
+					if(ip >= size)
+					{
+						return -1;
+					}
+
+					extra = in[ip++];
+					length = length + extra;
+
+				} while(extra == 255);
+			}
+
+			//copy the match (byte by byte: the match may overlap itself)
+			if(offset == 0 || offset > op || length > nbytes - op)
+			{
+				return -1;
+			}
+
+			while(length-- > 0)
+			{
+				work[op] = work[op-offset];
+				op++;
+			}
+
+		}	//end loop over sequences
+
+		//the chunk must be complete and fully read
+		if(op != nbytes || ip != size)
+		{
+			return -1;
+		}
+
+	}	//end if size < 0
+
+	//unshuffle: collect the bytes of each value
+	for(cell=0; cell<ncells; cell++)
+	{
+		bits[cell] = (unsigned int)work[cell] | ((unsigned int)work[ncells+cell] << 8)
+			| ((unsigned int)work[2*ncells+cell] << 16) | ((unsigned int)work[3*ncells+cell] << 24);
+	}
+
+	return 0;
+
+//end of function UnpackChunk
+}
+
+//C
+//C
+			/*****************************************/
+			/*        FUNCTION: UnpackGridFrame      */
+			/*****************************************/
+
+/* Decodes the body of a frame (after its frame header) of ncells
+   values.  bits holds the value bits of the previous frame (not used
+   for key frames) and receives the value bits of the frame.  Returns 0
+   on success or -1 when the frame is not valid. */
+
+int UnpackGridFrame(unsigned char *body, int size, int ncells, int keyframe, unsigned int *bits)
+{
+	//local variable declarations
+	int
+		nchunks,		//number of chunks of the frame
+		chunkcells,		//cells of a chunk
+		ichunk,			//chunk index
+		first,			//first cell of a chunk
+		cells,			//cells of the chunk
+		chunksize,		//packed size of a chunk
+		position,		//position of a chunk in the body
+		cell,			//cell index
+		status;			//unpack status
+
+	unsigned int *delta;	//value bits (delta) of a chunk
+
+	unsigned char *work;	//unpacked bytes of a chunk
+
+	//read the number of chunks and the cells of a chunk
+	if(size < 2 * (int)sizeof(int))
+	{
+		return -1;
+	}
+
+	memcpy(&nchunks, body, sizeof(int));
+	memcpy(&chunkcells, body + sizeof(int), sizeof(int));
+
+	//the chunks must cover the cells
+	if(chunkcells < 1 || nchunks != (ncells + chunkcells - 1) / chunkcells
+		|| size < (2 + nchunks) * (int)sizeof(int))
+	{
+		return -1;
+	}
+
+	//allocate the chunk buffers
+	work = (unsigned char *)malloc(4 * (size_t)chunkcells);
+	delta = (unsigned int *)malloc((size_t)chunkcells * sizeof(unsigned int));
+
+	//chunks follow the table of chunk sizes
+	position = (2 + nchunks) * (int)sizeof(int);
+	status = 0;
+
+	//loop over chunks
+	for(ichunk=0; ichunk<nchunks && status == 0; ichunk++)
+	{
+		//cells of the chunk
+		first = ichunk * chunkcells;
+		cells = (ncells - first < chunkcells) ? ncells - first : chunkcells;
+
+		//read the packed size of the chunk
+		memcpy(&chunksize, body + (2 + ichunk) * sizeof(int), sizeof(int));
+
+		//if the chunk is not within the body
+		if(abs(chunksize) > size - position)
+		{
+			status = -1;
+			break;
+		}
+
+		//decode the chunk
+		status = UnpackChunk(body + position, chunksize, cells, work, delta);
+		position = position + abs(chunksize);
+
+		//loop over cells of the chunk
+		for(cell=0; cell<cells && status == 0; cell++)
+		{
+			//undo the delta of the previous frame (key frames are stored as is)
+			bits[first+cell] = keyframe ? delta[cell] : (bits[first+cell] ^ delta[cell]);
+		}
+
+	}	//end loop over chunks
+
+	//free the chunk buffers
+	free(work);
+	free(delta);
+
+	//the body must be fully read
+	if(status == 0 && position != size)
+	{
+		status = -1;
+	}
+
+	return status;
+
+//end of function UnpackGridFrame
+}
+
+//C
+//C
+			/*****************************************/
+			/*         FUNCTION: FindGridPack        */
+			/*****************************************/
+
+/* Returns the container of a grid output (a new container the first
+   time the grid output is written) */
+
+static gridpack *FindGridPack(char *name)
+{
+	//local variable declarations
+	int n;				//container index
+
+	gridpack *pack;		//container
+
+	//loop over containers
+	for(n=0; n<ngridpacks; n++)
+	{
+		//if the container belongs to the grid output
+		if(strcmp(gridpacks[n].name, name) == 0)
+		{
+			//return the container
+			return &gridpacks[n];
+		}
+
+	}	//end loop over containers
+
+	//add a container
+	gridpacks = (gridpack *)realloc(gridpacks, (ngridpacks+1) * sizeof(gridpack));
+	pack = &gridpacks[ngridpacks++];
+
+	//set the container (the file is created with the first frame)
+	memset(pack, 0, sizeof(gridpack));
+	strncpy(pack->name, name, MAXNAMESIZE-1);
+	pack->previous = (unsigned int *)calloc(gridpackcells+1, sizeof(unsigned int));
+
+	//return the new container
+	return pack;
+
+//end of function FindGridPack
+}
+
+//C
+//C
+			/*****************************************/
+			/*       FUNCTION: WritePackedGrid       */
+			/*****************************************/
+
+/* Appends the values of a grid output as a compressed frame to the
+   container of the grid output (name.gpk) */
+
+void WritePackedGrid(char name[], float **gridvalue, float conversion, int gridcount)
+{
+	//local variable declarations
+	FILE *pack_fp;		//container file pointer
+
+	char packfile[MAXNAMESIZE+8];	//container file name
+
+	int
+		row,			//row index
+		col,			//column index
+		cell,			//cell index
+		nchunks,		//number of chunks
+		ichunk,			//chunk index
+		*chunksize,		//packed size of each chunk
+		fields[8],		//integer header fields of the container
+		bodysize,		//size of the frame body (chunk table and chunks)
+		nmask;			//size of the domain mask (bytes)
+
+	unsigned int
+		bits;			//bits of a value
+
+	unsigned char
+		*mask;			//domain mask of the container header (one bit per cell)
+
+	float
+		value;			//value of a cell (as written by Grid)
+
+	double
+		location[3];	//grid location (xllcorner, yllcorner, cellsize)
+
+	size_t
+		bound;			//worst case size of a packed chunk
+
+	gridpack *pack;		//container of the grid output
+
+	TrexGridPackFrame frame;	//time index entry of the frame
+
+	//if the buffers are not allocated (first frame of the run)
+	if(gridpackbits == NULL)
+	{
+		//count the domain cells
+		gridpackcells = 0;
+
+		for(row=1; row<=nrows; row++)
+		{
+			for(col=1; col<=ncols; col++)
+			{
+				if(imask[row][col] != nodatavalue)
+				{
+					gridpackcells++;
+				}
+			}
+		}
+
+		//allocate the frame buffers
+		nchunks = (gridpackcells + GRIDPACKCHUNKCELLS - 1) / GRIDPACKCHUNKCELLS;
+		gridpackbits = (unsigned int *)malloc(((size_t)gridpackcells+1) * sizeof(unsigned int));
+		gridpackwork = (unsigned char *)malloc(4 * ((size_t)gridpackcells+1));
+		gridpackout = (unsigned char *)malloc((size_t)(nchunks+1) * GRIDPACKBOUND(4 * GRIDPACKCHUNKCELLS));
+
+	}	//end if gridpackbits == NULL
+
+	//set the container of the grid output
+	pack = FindGridPack(name);
+
+	//a key frame starts every GRIDPACKKEYFRAMES frames
+	frame.keyframe = (pack->nframes % GRIDPACKKEYFRAMES == 0);
+
+	//collect the value bits of the domain cells (delta to the previous frame)
+	cell = 0;
+
+	for(row=1; row<=nrows; row++)
+	{
+		for(col=1; col<=ncols; col++)
+		{
+			//if the cell is in the domain
+			if(imask[row][col] != nodatavalue)
+			{
+				//value written by Grid
+				value = gridvalue[row][col] * conversion;
+				memcpy(&bits, &value, sizeof(unsigned int));
+
+				//store the bits (key frame) or their change from the previous frame
+				gridpackbits[cell] = frame.keyframe ? bits : (bits ^ pack->previous[cell]);
+				pack->previous[cell] = bits;
+				cell++;
+
+			}	//end if imask[][] != nodata
+
+		}	//end loop over columns
+
+	}	//end loop over rows
+
+	//pack the chunks
+	nchunks = (gridpackcells + GRIDPACKCHUNKCELLS - 1) / GRIDPACKCHUNKCELLS;
+	bound = GRIDPACKBOUND(4 * GRIDPACKCHUNKCELLS);
+	chunksize = (int *)malloc((nchunks+2) * sizeof(int));
+
+	//if the frame has several chunks
+	if(nchunks > 1)
+	{
+		//pack the chunks on the OpenMP threads
+		#pragma omp parallel for schedule(dynamic)
+		for(ichunk=0; ichunk<nchunks; ichunk++)
+		{
+			chunksize[ichunk+2] = PackChunk(&gridpackbits[(size_t)ichunk*GRIDPACKCHUNKCELLS],
+				(gridpackcells - ichunk*GRIDPACKCHUNKCELLS < GRIDPACKCHUNKCELLS)
+					? gridpackcells - ichunk*GRIDPACKCHUNKCELLS : GRIDPACKCHUNKCELLS,
+				&gridpackwork[4*(size_t)ichunk*GRIDPACKCHUNKCELLS], &gridpackout[ichunk*bound]);
+		}
+	}
+	else if(nchunks == 1)	//else the frame is one chunk
+	{
+		//pack the chunk (no parallel region for small grids)
+		chunksize[2] = PackChunk(gridpackbits, gridpackcells, gridpackwork, gridpackout);
+
+	}	//end if nchunks > 1
+
+	//the chunk table starts with the number of chunks and the cells of a chunk
+	chunksize[0] = nchunks;
+	chunksize[1] = GRIDPACKCHUNKCELLS;
+
+	//size of the frame body
+	bodysize = (2 + nchunks) * (int)sizeof(int);
+
+	for(ichunk=0; ichunk<nchunks; ichunk++)
+	{
+		bodysize = bodysize + abs(chunksize[ichunk+2]);
+	}
+
+	//set the container file name
+	sprintf(packfile, "%s.gpk", name);
+
+	//create the container with the first frame, append later frames
+	pack_fp = OpenOutputFile(packfile, (pack->nframes == 0) ? "wb" : "ab");
+
+	//if the container file pointer is null, abort execution
+	if(pack_fp == NULL)
+	{
+		//Write message to file
+		fprintf(echofile_fp, "\n\nError!  Can't open Packed Grid Output File : %s \n", packfile);
+
+		//Write message to screen
+		printf("Error! Can't open Packed Grid Output File : %s \n", packfile);
+		exit(EXIT_FAILURE);	//abort
+	}
+
+	//if this is the first frame
+	if(pack->nframes == 0)
+	{
+		//set the integer header fields
+		fields[0] = TREXGRIDPACKVERSION;
+		fields[1] = ncols;
+		fields[2] = nrows;
+		fields[3] = nodatavalue;
+		fields[4] = gridpackcells;
+		fields[5] = GRIDPACKCHUNKCELLS;
+		fields[6] = GRIDPACKKEYFRAMES;
+		fields[7] = 0;
+
+		//set the grid location
+		location[0] = xllcorner;
+		location[1] = yllcorner;
+		location[2] = w;
+
+		//set the domain mask (row major, one bit per cell)
+		nmask = (nrows * ncols + 7) / 8;
+		mask = (unsigned char *)calloc(nmask+1, sizeof(unsigned char));
+
+		for(row=1; row<=nrows; row++)
+		{
+			for(col=1; col<=ncols; col++)
+			{
+				if(imask[row][col] != nodatavalue)
+				{
+					cell = (row-1) * ncols + col - 1;
+					mask[cell/8] = mask[cell/8] | (unsigned char)(1 << (cell % 8));
+				}
+			}
+		}
+
+		//write the container header
+		fwrite(TREXGRIDPACKID, sizeof(char), strlen(TREXGRIDPACKID), pack_fp);
+		fwrite(fields, sizeof(int), 8, pack_fp);
+		fwrite(location, sizeof(double), 3, pack_fp);
+		fwrite(mask, sizeof(unsigned char), nmask, pack_fp);
+
+		//free the domain mask
+		free(mask);
+
+		//set the file size
+		pack->size = strlen(TREXGRIDPACKID) + 8 * sizeof(int) + 3 * sizeof(double) + nmask;
+
+	}	//end if nframes == 0
+
+	//set the time index entry of the frame
+	frame.offset = pack->size;
+	frame.gridcount = gridcount;
+	frame.size = bodysize;
+	frame.reserved = 0;
+
+	//write the frame header (identifier, grid count, key frame, and body size)
+	fwrite(TREXGRIDPACKFRAMEID, sizeof(char), strlen(TREXGRIDPACKFRAMEID), pack_fp);
+	fwrite(&frame.gridcount, sizeof(int), 1, pack_fp);
+	fwrite(&frame.keyframe, sizeof(int), 1, pack_fp);
+	fwrite(&frame.size, sizeof(int), 1, pack_fp);
+	fwrite(&frame.reserved, sizeof(int), 1, pack_fp);
+
+	//write the frame body (chunk table and chunks)
+	fwrite(chunksize, sizeof(int), 2 + nchunks, pack_fp);
+
+	for(ichunk=0; ichunk<nchunks; ichunk++)
+	{
+		fwrite(&gridpackout[ichunk*bound], sizeof(unsigned char), abs(chunksize[ichunk+2]), pack_fp);
+	}
+
+	//Close container file
+	fclose(pack_fp);
+
+	//add the frame to the time index
+	pack->frames = (TrexGridPackFrame *)realloc(pack->frames,
+		(pack->nframes+1) * sizeof(TrexGridPackFrame));
+	pack->frames[pack->nframes++] = frame;
+
+	//add the frame to the file size
+	pack->size = pack->size + strlen(TREXGRIDPACKFRAMEID) + 4 * sizeof(int) + bodysize;
+
+	//free the chunk table
+	free(chunksize);
+
+//end of function WritePackedGrid
+}
+
+//C
+//C
+			/*****************************************/
+			/*        FUNCTION: CloseGridPack        */
+			/*****************************************/
+
+/* Writes the time index of each container and frees the containers
+   (called at the end of the run and by FreeMemory) */
+
+void CloseGridPack()
+{
+	//local variable declarations
+	FILE *pack_fp;		//container file pointer
+
+	char packfile[MAXNAMESIZE+8];	//container file name
+
+	int n;				//container index
+
+	gridpack *pack;		//container
+
+	//loop over containers
+	for(n=0; n<ngridpacks; n++)
+	{
+		//set the container
+		pack = &gridpacks[n];
+
+		//if frames were written
+		if(pack->nframes > 0)
+		{
+			//set the container file name
+			sprintf(packfile, "%s.gpk", pack->name);
+
+			//open the container file for appending
+			pack_fp = OpenOutputFile(packfile, "ab");
+
+			//if the container file was opened
+			if(pack_fp != NULL)
+			{
+				//write the time index and its offset
+				fwrite(TREXGRIDPACKINDEXID, sizeof(char), strlen(TREXGRIDPACKINDEXID), pack_fp);
+				fwrite(&pack->nframes, sizeof(int), 1, pack_fp);
+				fwrite(pack->frames, sizeof(TrexGridPackFrame), pack->nframes, pack_fp);
+				fwrite(&pack->size, sizeof(long long), 1, pack_fp);
+				fwrite(TREXGRIDPACKID, sizeof(char), strlen(TREXGRIDPACKID), pack_fp);
+
+				//Close container file
+				fclose(pack_fp);
+
+			}	//end if pack_fp != NULL
+
+		}	//end if nframes > 0
+
+		//free the container
+		free(pack->previous);
+		free(pack->frames);
+
+	}	//end loop over containers
+
+	//free the containers and the frame buffers
+	free(gridpacks);
+	free(gridpackbits);
+	free(gridpackwork);
+	free(gridpackout);
+
+	//there are no containers
+	gridpacks = NULL;
+	ngridpacks = 0;
+	gridpackbits = NULL;
+	gridpackwork = NULL;
+	gridpackout = NULL;
+	gridpackcells = 0;
+
+//end of function CloseGridPack
+}
@@ -10,7 +10,7 @@ C-
 C-
 C-  Inputs:     hov[][] (at time t),
 C-              infiltrationdepth[][] (at time t),
-C-              soiltype[][][]
+C-              khsoilov[][], capmdsoilov[][]
 C-
 C-  Outputs:    infiltrationrate[][] (at time t),
 C-              infiltrationdepth[][] (at time t+dt)
@@ -18,7 +18,7 @@ C-              infiltrationvol[][] (at time t+dt)
 C-
 C-  Controls:   hov[][] (at time t), soiltemp[][][]
 C-
-C-  Calls:      None
+C-  Calls:      BatchSqrt
 C-
 C-  Called by:  WaterTransport
 C-
@@ -57,6 +57,18 @@ C-	Revisions:	Cumulative mass balance calculations moved to
 C-              OverlandWaterdepth for time step option (dtopt)
 C-              implementation.
 C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Soil parameters are read from the surface soil
+C-              parameter grids (khsoilov, capmdsoilov) instead of
+C-              soiltype[][][] and the soil tables.  Green-Ampt rates
+C-              are computed for whole rows (vectorized loops, square
+C-              roots by BatchSqrt) and then stored for the cells in
+C-              the domain.  The unused channel surface area was
+C-              removed.
+C-
 C-  Revised:
 C-
 C-  Date:
@@ -74,27 +86,76 @@ C----------------------------------------------------------------------*/
 //trex global variable declarations for environmental conditions
 #include "trex_environmental_declarations.h"
 
+//C
+//C
+			/*******************************************/
+			/*         FUNCTION: Infiltration          */
+			/*******************************************/
+
+/* Computes the infiltration rates of the cells in the overland plane */
+
 void Infiltration()
 {
 	//local variable declarations/definitions
 	int
-		ilayer,		//index for layer in the soil stack (ksim > 1)
-		isoil,		//index for soil type [row][col][layer]
-		chanlink,	//channel link number
-		channode;	//channel node number
-
-	float
-		lch,		//channel length (m) (includes sinuosity)
-		twch,		//top width of channel at flow depth (m)
-		achsurf;	//surface area of channel (m2)
+		ilayer;		//index for layer in the soil stack (ksim > 1)
 
 	float
-		p1,	//first term in average infiltration rate equation
-		p2;	//second term in average infiltration rate equation
-
+		dtstep,		//time step (s)
+		p2,			//second term in average infiltration rate equation
+		*khrow,		//hydraulic conductivity of the surface soil layer of a row (m/s)
+		*capmdrow,	//capillary suction head * moisture deficit of a row (m)
+		*depthrow,	//cumulative infiltration depth of a row (m)
+		*p1row;		//first term in average infiltration rate equation of a row
+
+	double
+		*rootrow;	//square root argument (then infiltration rate) of a row
+
+	//Allocate memory for the row buffers
+	p1row = (float *)malloc((ncols+1) * sizeof(float));
+	rootrow = (double *)malloc((ncols+1) * sizeof(double));
+
+	//set the time step (s)
+	dtstep = dt[idt];
+
+	//Note:  The Green-Ampt rates are computed for all columns of a
+	//       row at once from contiguous rows of the surface soil
+	//       parameters (the loops are vectorized and the square
+	//       roots are computed by BatchSqrt).  The rates are then
+	//       stored for the cells in the domain.  Values computed for
+	//       cells outside the domain are not used.
+	//
 	//Loop over rows
 	for(i=1; i<=nrows; i++)
 	{
+		//set the rows of the soil parameters and infiltration depths
+		khrow = khsoilov[i];
+		capmdrow = capmdsoilov[i];
+		depthrow = infiltrationdepth[i];
+
+		//Loop over columns
+		for(j=1; j<=ncols; j++)
+		{
+			//set first and second terms for infiltration rate equation
+			p1row[j] = (float)(khrow[j]*dtstep - 2.0*depthrow[j]);
+			p2 = khrow[j]*(depthrow[j] + capmdrow[j]);
+
+			//square root argument: p1^2 + 8 p2 dt
+			rootrow[j] = (double)p1row[j]*p1row[j] + 8.0*p2*dtstep;
+
+		}	//end loop over columns
+
+		//compute the square roots of the row
+		BatchSqrt(&rootrow[1], ncols);
+
+		//Loop over columns
+		for(j=1; j<=ncols; j++)
+		{
+			//Compute infiltration rate (m/s)
+			rootrow[j] = (float)((p1row[j] + rootrow[j])/(2.0*dtstep));
+
+		}	//end loop over columns
+
 		//Loop over columns
 		for(j=1; j<=ncols; j++)
 		{
@@ -106,34 +167,6 @@ void Infiltration()
 				//set the soil layer number for this location
 				ilayer = nstackov[i][j];
 
-				//set the soil type for this location
-				isoil = soiltype[i][j][ilayer];
-
-				//Set the cell surface area
-				//
-				//if the cell is a channel cell
-				if(imask[i][j] > 1)
-				{
-					//Get channel link and node
-					chanlink = link[i][j];
-					channode = node[i][j];
-
-					//Compute area of channel within cell...
-					//
-					//Assign channel characteristics
-					lch = chanlength[chanlink][channode];		//channel length (m) (includes sinuosity)
-					twch = twidth[chanlink][channode];			//channel top width at bank height (m)
-
-					//Surface area of channel portion of cell (m2)
-					achsurf = twch * lch;
-				}
-				else	//cell is not a channel cell (overland only)
-				{
-					//no channel present, surface area is zero
-					achsurf = 0.0;
-
-				}	//end if imask > 1
-
 				//Infiltration occurs when the soil is not frozen
 				//
 				//Note: Only the soil surface layer is considered.
@@ -143,12 +176,8 @@ void Infiltration()
 				//if the soil temperature > zero
 				if(temperatureov[i][j][ilayer] > 0.0)
 				{
-					//set first and second terms for infiltration rate equation
-					p1 = (float)(khsoil[isoil]*dt[idt] - 2.0*infiltrationdepth[i][j]);
-					p2 = khsoil[isoil]*(infiltrationdepth[i][j] + capshsoil[isoil]*soilmd[isoil]);
-
-					//Compute infiltration rate (m/s)
-					infiltrationrate[i][j] = (float)((p1 + sqrt(pow(p1,2.0) + 8.0*p2*dt[idt]))/(2.0*dt[idt]));
+					//store the infiltration rate (m/s)
+					infiltrationrate[i][j] = (float)(rootrow[j]);
 
 					//check if the infiltration potential exceeds the available water
 					if(infiltrationrate[i][j]*dt[idt] > hov[i][j])
@@ -180,5 +209,9 @@ void Infiltration()
 
 	}	//end loop over rows
 
+	//Free memory for the row buffers
+	free(p1row);
+	free(rootrow);
+
 //End of function: Return to WaterTransport
 }
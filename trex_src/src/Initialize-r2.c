@@ -11,7 +11,10 @@ C-	Outputs:	ksim0
 C-
 C-	Controls:   ksim, dtopt
 C-
-C-	Calls:		InitializeWater, InitializeSolids, InitializeChemical
+C-	Calls:		InitializeWater, InitializeSolids, InitializeChemical,
+C-              InitializeMassAccounting, InitializeSoilParameters,
+C-              InitializeBatchMath, InitializeMassBalanceMonitor,
+C-              InitializeGridOutput, MemoryCheckpoint
 C-
 C-	Called by:	trex
 C-
@@ -39,6 +42,52 @@ C-  Revisions:	Added code so that errors caused by bad file names
 C-              and paths are are reported to the simulation error
 C-              file in addition to the screen.
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added InitializeMassAccounting.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added InitializeBatchMath (power law evaluation).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added InitializeSoilParameters (surface soil
+C-              parameters materialized per cell).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Output files are opened by OpenOutputFile.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added InitializeMassBalanceMonitor (streamed water
+C-              mass balance).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added memory checkpoints (MemoryCheckpoint) after
+C-              each initialization module.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added sparse grid output frames (-gridsparse,
+C-              -gridwindows)
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -81,7 +130,7 @@ void Initialize()
 	errorfile_fp = NULL;
 
 	//Open simulation error file and write header line
-	errorfile_fp = fopen(errorfile,"w");
+	errorfile_fp = OpenOutputFile(errorfile,"w");
 
 	//if the simulation error file pointer is null, abort execution
 	if(errorfile_fp==NULL)
@@ -98,7 +147,7 @@ void Initialize()
 	fclose(errorfile_fp);
 
 	//Open simulation echo file in append mode
-	echofile_fp = fopen(echofile,"a");
+	echofile_fp = OpenOutputFile(echofile,"a");
 
 	//Echo simulation error file name to echo file
 	fprintf(echofile_fp, "\n\nSimulation Error File:  %s\n", errorfile);
@@ -120,7 +169,7 @@ void Initialize()
 	statsfile_fp = NULL;
 
 	//open the summary statistics file
-	statsfile_fp = fopen(statsfile, "w");
+	statsfile_fp = OpenOutputFile(statsfile, "w");
 
 	//if file pointer is still null, then abort
 	if(statsfile_fp == NULL)
@@ -148,7 +197,7 @@ void Initialize()
 		msbfile_fp = NULL;
 
 		//open the mass balance file
-		msbfile_fp = fopen(msbfile, "w");
+		msbfile_fp = OpenOutputFile(msbfile, "w");
 
 		//if file pointer is still null, then abort
 		if(msbfile_fp == NULL)
@@ -166,28 +215,64 @@ void Initialize()
 
 	}	//end if msbfile is not blank
 
+	//Build the output selection of sparse grid frames (see GridOutput)
+	InitializeGridOutput();
+
+	//Charge the memory of the error and summary file checks to the general subsystem
+	MemoryCheckpoint(MEMGENERAL);
+
 	//Initialize water transport variables
 	InitializeWater();
 
+	//Clear the streamed water mass balance (see MassBalanceMonitor)
+	InitializeMassBalanceMonitor();
+
+	//Charge the memory of the water variables to the water subsystem
+	MemoryCheckpoint(MEMWATER);
+
 	//if sediment transport is simulated
 	if(ksim > 1)
 	{
 		//Initialize sediment transport variables
 		InitializeSolids();
 
+		//Charge the memory of the solids variables to the solids subsystem
+		MemoryCheckpoint(MEMSOLIDS);
+
 		//if chemical transport is simulated
 		if(ksim > 2)
 		{
 			//Initialize chemical transport variables
 			InitializeChemical();
 
+			//Charge the memory of the chemical variables to the chemical subsystem
+			MemoryCheckpoint(MEMCHEMICAL);
+
 		}	//end if ksim > 2
 
+		//Select tracked mass budgets and initialize pending totals
+		InitializeMassAccounting();
+
+		//Charge the memory of the mass accounting to the solids subsystem
+		MemoryCheckpoint(MEMSOLIDS);
+
 	}	//end if ksim > 1
 
+	//Materialize the surface soil parameters of each cell
+	InitializeSoilParameters();
+
+	//Charge the memory of the soil parameters to the water subsystem
+	MemoryCheckpoint(MEMWATER);
+
 	//Initialize environmental condition variables
 	InitializeEnvironment();
 
+	//Charge the memory of the environmental variables to the environment subsystem
+	MemoryCheckpoint(MEMENVIRONMENT);
+
+	//Select the power law evaluation and specialize constant exponents
+	InitializeBatchMath();
+
 	//Initializations for automated time step option
 	//
 	//if automated time stepping is selected (if dtopt = 1 or 2)
@@ -219,7 +304,7 @@ void Initialize()
 		dtbufferfile_fp = NULL;
 
 		//Open the time step buffer file for writing
-		dtbufferfile_fp=fopen(dtbufferfile,"w");
+		dtbufferfile_fp=OpenOutputFile(dtbufferfile,"w");
 
 		//if the time step buffer file pointer is null, abort execution
 		if(dtbufferfile_fp==NULL)
@@ -243,7 +328,7 @@ void Initialize()
 		dtoutputfile_fp = NULL;
 
 		//Open the time step output file for writing
-		dtoutputfile_fp=fopen(dtoutputfile,"w");
+		dtoutputfile_fp=OpenOutputFile(dtoutputfile,"w");
 
 		//if the time step output file pointer is null, abort execution
 		if(dtoutputfile_fp==NULL)
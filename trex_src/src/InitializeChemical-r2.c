@@ -11,7 +11,7 @@ C-	Outputs:	None
 C-
 C-	Controls:   chnopt
 C-
-C-	Calls:		None
+C-	Calls:		InitializePartitionCache
 C-
 C-	Called by:	Initialize
 C-
@@ -68,6 +68,33 @@ C-
 C-  Revisions:	Added initializations for subsurface soil/sediment
 C-              grid file names.
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Overland source/direction slots are allocated in
+C-              compact per-row blocks (AllocateOverlandSlots) and
+C-              addressed through OVSLOT.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	New (t + dt) chemical concentrations initialized for
+C-              all layers.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added initialization of the partitioning cache.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Output files are opened by OpenOutputFile.
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -463,6 +490,17 @@ void InitializeChemical()
 			udrchemovinmass[ichem][i] = (double **)malloc((ncols+1) * sizeof(double *));	//user-defined reaction inflowing mass of chemical in overland plane [ichem][row][col][layer]
 			udrchemovoutmass[ichem][i] = (double **)malloc((ncols+1) * sizeof(double *));	//user-defined reaction outflowing mass of chemical in overland plane [ichem][row][col][layer]
 
+			//Allocate compact source/direction slots of overland advection and dispersion
+			//parameters for all domain cells in the row (see OVSLOT)
+			AllocateOverlandSlots(advchemovinflux[ichem][i], i);
+			AllocateOverlandSlots(advchemovoutflux[ichem][i], i);
+			AllocateOverlandSlots(dspchemovinflux[ichem][i], i);
+			AllocateOverlandSlots(dspchemovoutflux[ichem][i], i);
+			AllocateOverlandSlotsDouble(advchemovinmass[ichem][i], i);
+			AllocateOverlandSlotsDouble(advchemovoutmass[ichem][i], i);
+			AllocateOverlandSlotsDouble(dspchemovinmass[ichem][i], i);
+			AllocateOverlandSlotsDouble(dspchemovoutmass[ichem][i], i);
+
 			//Loop over number of columns
 			for(j=1; j<=ncols; j++)
 			{
@@ -471,10 +509,6 @@ void InitializeChemical()
 				{
 					//Allocate additional memory for overland transport parameters
 					cchemovnew[ichem][i][j] = (float *)malloc((maxstackov+1) * sizeof(float));		//new overland chemical concentration (for next time t+dt) (g/m3)
-					advchemovinflux[ichem][i][j] = (float *)malloc((nsources+1) * sizeof(float));	//gross chemical flux transported into a cell by advection (g/s)
-					advchemovoutflux[ichem][i][j] = (float *)malloc((nsources+1) * sizeof(float));	//gross chemical flux transported out of a cell by advection (g/s)
-					dspchemovinflux[ichem][i][j] = (float *)malloc((nsources+1) * sizeof(float));	//gross chemical flux transported into a cell by dispersion (g/s)
-					dspchemovoutflux[ichem][i][j] = (float *)malloc((nsources+1) * sizeof(float));	//gross chemical flux transported out of a cell by dispersion (g/s)
 					depchemovinflux[ichem][i][j] = (float *)malloc((maxstackov+1) * sizeof(float));	//gross chemical flux transported into a cell by deposition (g/s)
 					depchemovoutflux[ichem][i][j] = (float *)malloc((maxstackov+1) * sizeof(float));	//gross chemical flux transported out of a cell by deposition (g/s)
 					erschemovinflux[ichem][i][j] = (float *)malloc((maxstackov+1) * sizeof(float));	//gross chemical flux transported into a cell by erosion (g/s)
@@ -499,10 +533,6 @@ void InitializeChemical()
 					udrchemovinflux[ichem][i][j] = (float *)malloc((maxstackov+1) * sizeof(float));	//user-defined reaction influx of chemical in overland plane [ichem][row][col][layer]
 					udrchemovoutflux[ichem][i][j] = (float *)malloc((maxstackov+1) * sizeof(float));	//user-defined reaction outflux of chemical in overland plane [ichem][row][col][layer]
 
-					advchemovinmass[ichem][i][j] = (double *)malloc((nsources+1) * sizeof(double));	//cumulative gross chemical mass transported into a cell by advection (kg)
-					advchemovoutmass[ichem][i][j] = (double *)malloc((nsources+1) * sizeof(double));	//cumulative gross chemical mass transported out of a cell by advection (kg)
-					dspchemovinmass[ichem][i][j] = (double *)malloc((nsources+1) * sizeof(double));	//cumulative gross chemical mass transported into a cell by dispersion (kg)
-					dspchemovoutmass[ichem][i][j] = (double *)malloc((nsources+1) * sizeof(double));	//cumulative gross chemical mass transported out of a cell by dispersion (kg)
 					depchemovinmass[ichem][i][j] = (double *)malloc((maxstackov+1) * sizeof(double));	//cumulative gross chemical mass transported into a cell by deposition (kg)
 					depchemovoutmass[ichem][i][j] = (double *)malloc((maxstackov+1) * sizeof(double));	//cumulative gross chemical mass transported out of a cell by deposition (kg)
 					erschemovinmass[ichem][i][j] = (double *)malloc((maxstackov+1) * sizeof(double));	//cumulative gross chemical mass transported into a cell by erosion (kg)
@@ -532,7 +562,7 @@ void InitializeChemical()
 					udrchemovoutmass[ichem][i][j] = (double *)malloc((maxstackov+1) * sizeof(double));	//transformation outflowing mass of chemical in overland plane [ichem][row][col][layer]
 
 					//loop over flow sources
-					for(k=0; k<=nsources; k++)
+					for(k=0; k<NOVSLOTS; k++)
 					{
 						//Initialize cumulative overland transport flux and mass variables
 						advchemovinflux[ichem][i][j][k] = 0.0;	//gross chemical flux transported into a cell by advection (g/s)
@@ -1234,9 +1264,9 @@ void InitializeChemical()
 	//       reporting group.  Sums of chemical types for each group
 	//       are computed in ComputeChemicalGroupConcSums.
 	//
-	//if nchemreports > 0 (if there are chemical reporting stations...)
-	if(nchemreports > 0)
-	{
+	//if nchemreports > 0 (if there are chemical reporting stations...)
+	if(nchemreports > 0)
+	{
 		//Allocate memory for chemical export file names
 		chemexpfile = (char **)malloc(MAXNAMESIZE * sizeof(char *));
 
@@ -1262,7 +1292,7 @@ void InitializeChemical()
 			chemexpfile_fp = NULL;
 
 			//Set chemical export file pointer
-			chemexpfile_fp = fopen(chemexpfile[i], "w");
+			chemexpfile_fp = OpenOutputFile(chemexpfile[i], "w");
 
 			//if the chemical export file pointer is null, abort execution
 			if(chemexpfile_fp == NULL)
@@ -1825,5 +1855,73 @@ void InitializeChemical()
 
 	}	//end if chnopt > 0
 
+	/******************************************************************/
+	/*        Initialize New (t + dt) Chemical Concentrations         */
+	/******************************************************************/
+
+	//Note:  The current and new concentration arrays are swapped at the
+	//       end of each time step (NewStateChemical).  Both arrays start
+	//       with the same values so that unoccupied layers are the same
+	//       in both arrays.
+	//
+	//Loop over number of rows
+	for(i=1; i<=nrows; i++)
+	{
+		//Loop over number of columns
+		for(j=1; j<=ncols; j++)
+		{
+			//if the cell is in the domain
+			if(imask[i][j] > 0)
+			{
+				//Loop over chemicals
+				for(ichem=1; ichem<=nchems; ichem++)
+				{
+					//Loop over the water column and soil layers
+					for(k=0; k<=maxstackov; k++)
+					{
+						//set the new concentration to the current concentration (g/m3)
+						cchemovnew[ichem][i][j][k] = cchemov[ichem][i][j][k];
+
+					}	//end loop over layers
+
+				}	//end loop over chemicals
+
+			}	//end if imask[][] > 0
+
+		}	//end loop over columns
+
+	}	//end loop over rows
+
+	//if channels are simulated
+	if(chnopt > 0)
+	{
+		//Loop over number of links
+		for(i=1; i<=nlinks; i++)
+		{
+			//Loop over number of nodes
+			for(j=1; j<=nnodes[i]; j++)
+			{
+				//Loop over chemicals
+				for(ichem=1; ichem<=nchems; ichem++)
+				{
+					//Loop over the water column and sediment layers
+					for(k=0; k<=maxstackch; k++)
+					{
+						//set the new concentration to the current concentration (g/m3)
+						cchemchnew[ichem][i][j][k] = cchemch[ichem][i][j][k];
+
+					}	//end loop over layers
+
+				}	//end loop over chemicals
+
+			}	//end loop over nodes
+
+		}	//end loop over links
+
+	}	//end if chnopt > 0
+
+	//Allocate the partitioning cache (all partitioning is stale)
+	InitializePartitionCache();
+
 //End of function: Return to Initialize
 }
@@ -9,7 +9,7 @@ C-	Inputs:		None
 C-
 C-	Outputs:	None
 C-
-C-	Controls:   chnopt, infopt
+C-	Controls:   chnopt, infopt, meltopt
 C-
 C-	Calls:		None
 C-
@@ -22,6 +22,13 @@ C-              Fort Collins, CO  80523
 C-				
 C-	Date:		07-SEP-2004
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Precomputed terrain terms of solar radiation for
+C-              snowmelt (compact list of domain cells).
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -49,7 +56,14 @@ void InitializeEnvironment()
 {
 	//Local variable declarations/definitions
 	int
-		iprop;		//index for number of properties specified
+		iprop,		//index for number of properties specified
+		cell;		//index of a solar radiation cell
+
+	float
+		pi,			//pi = 3.1415926...
+		degtorad,	//conversion factor for degrees to radians
+		azslope,	//azimuth of land surface slope (degrees) (south = 0)
+		psicover;	//land cover transmissivity for direct/diffuse solar radiation
 
 	/*****************************************************************************/
 	/*        Initialize Global General Environmental Property Variables         */
@@ -255,6 +269,134 @@ void InitializeEnvironment()
 
 	}	//end loop over rows
 
+	/*******************************************************************/
+	/*        Initialize Terrain Terms for Solar Radiation (Snowmelt)  */
+	/*******************************************************************/
+
+	//Note:  Terrain slope, aspect, and sky view do not change during a
+	//       simulation.  The terrain terms of the solar incidence angle
+	//       are computed once for a compact list of domain cells, so
+	//       each update of solar radiation (ComputeSolarRadiation) is a
+	//       linear combination of the terrain terms and the sun terms:
+	//
+	//         cos(i) = cos(slope) * cos(z)
+	//                + sin(slope) * cos(azslope) * sin(z) * cos(azsun)
+	//                + sin(slope) * sin(azslope) * sin(z) * sin(azsun)
+	//
+	//if snowmelt is simulated (meltopt > 0)
+	if(meltopt > 0)
+	{
+		//Define required constants
+		pi = (float)(2.0 * acos(0.0));	//pi
+		degtorad = (float)(pi / 180.0);	//conversion factor for degrees to radians
+
+		//Compute land cover transmissivity.
+		//
+		//  As described by Liston and Elder (2006), 0.71 provided a
+		//  best-fit to the observations, when averaged over the two years
+		//  of hourly data.  For pine forest, psicover = exp(-0.71 * LAI).
+		//  LAI = leaf area index.
+		//
+		//  Account for any gaps in the forest canopy that will allow
+		//  direct incoming solar radiation to reach the snow surface.
+		//
+		//Developer's Note:  The land cover transmissivity could be input
+		//                   as a function of land use type and read in
+		//                   Data Group B.  However, the transmissivity
+		//                   would need to account for shade by buildings
+		//                   through which no light penetrates...
+		//
+		//                   For now, adjust the sky view factor to account
+		//                   for light penetration through forest canopy or
+		//                   other cover and set cover transmissivity to zero.
+		//
+		//compute land cover (canopy) transmissivity (set to zero for now...)
+		psicover = 0.0;
+
+		//count the domain cells
+		nsolarcells = 0;
+
+		//Loop over rows
+		for(i=1; i<=nrows; i++)
+		{
+			//Loop over columns
+			for(j=1; j<=ncols; j++)
+			{
+				//if the cell is in the domain (is not null)
+				if(imask[i][j] != nodatavalue)
+				{
+					//increment the number of cells
+					nsolarcells = nsolarcells + 1;
+
+				}	//end if imask[][] != nodatavalue
+
+			}	//end loop over columns
+
+		}	//end loop over rows
+
+		//Allocate memory for the terrain terms (contiguous arrays)
+		solarcellrow = (int *)malloc((nsolarcells+1) * sizeof(int));		//row of a solar radiation cell [cell]
+		solarcellcol = (int *)malloc((nsolarcells+1) * sizeof(int));		//column of a solar radiation cell [cell]
+		slopecos = (float *)malloc((nsolarcells+1) * sizeof(float));		//cosine of the terrain slope [cell]
+		slopesinx = (float *)malloc((nsolarcells+1) * sizeof(float));		//sin(slope) * cos(slope azimuth) [cell]
+		slopesiny = (float *)malloc((nsolarcells+1) * sizeof(float));		//sin(slope) * sin(slope azimuth) [cell]
+		solarview = (float *)malloc((nsolarcells+1) * sizeof(float));		//sky view and land cover factor [cell]
+		solarcosi = (float *)malloc((nsolarcells+1) * sizeof(float));		//cosine of the solar incidence angle [cell]
+
+		//set the cell index
+		cell = 0;
+
+		//Loop over rows
+		for(i=1; i<=nrows; i++)
+		{
+			//Loop over columns
+			for(j=1; j<=ncols; j++)
+			{
+				//if the cell is in the domain (is not null)
+				if(imask[i][j] != nodatavalue)
+				{
+					//increment the cell index
+					cell = cell + 1;
+
+					//set the row and column of the cell
+					solarcellrow[cell] = i;
+					solarcellcol[cell] = j;
+
+					//Convert the slope aspect (where north is zero azimuth) to the
+					//slope azimuth (azslope) with south having zero azimuth...
+					//
+					//if the slope aspect is >= 180 degrees (a west aspect)
+					if(aspect[i][j] >= 180.0)
+					{
+						//subtract 180 degrees to convert aspect to azimuth (south zero azimuth) (degrees)
+						azslope = (float)(aspect[i][j] - 180.0);
+					}
+					else	//else slope aspect is < 180 (an east aspect)
+					{
+						//add 180 degrees to convert aspect to azimuth (south zero azimuth) (degrees)
+						azslope = (float)(aspect[i][j] + 180.0);
+
+					}	//endif aspect[][] >= 180
+
+					//compute the terrain terms of the solar incidence angle
+					slopecos[cell] = (float)(cos(slope[i][j] * degtorad));
+					slopesinx[cell] = (float)(sin(slope[i][j] * degtorad) * cos(azslope * degtorad));
+					slopesiny[cell] = (float)(sin(slope[i][j] * degtorad) * sin(azslope * degtorad));
+
+					//compute the sky view factor (blocking by tree canopy, shading by buildings etc.)
+					solarview[cell] = (float)((1.0 - skyview[i][j]) * psicover + skyview[i][j]);
+
+					//set the incidence angle to zero (no sun)
+					solarcosi[cell] = 0.0;
+
+				}	//end if imask[][] != nodatavalue
+
+			}	//end loop over columns
+
+		}	//end loop over rows
+
+	}	//end if meltopt > 0
+
 	/*******************************************************************/
 	/*        Initialize Named Overland Environmental Properties       */
 	/*******************************************************************/
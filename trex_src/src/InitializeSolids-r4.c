@@ -10,7 +10,7 @@ C-	Outputs:	None
 C-
 C-	Controls:   chnopt, infopt
 C-
-C-	Calls:		None
+C-	Calls:		AllocateStackLists
 C-
 C-	Called by:	Initialize
 C-
@@ -74,6 +74,41 @@ C-	Revisions:	Added initializations for generalized overland sediment
 C               transport capacity option to support default parameters
 C-              for Kilinc-Richardson Equation (when ersovopt = 1)
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Overland source/direction slots are allocated in
+C-              compact per-row blocks (AllocateOverlandSlots) and
+C-              addressed through OVSLOT.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Allocates the stack work lists (AllocateStackLists).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Computes the transport capacity grain size weights
+C-              dstar^tcwexpov (dstarpowov) once.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Output files are opened by OpenOutputFile.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Allocate and initialize the shear stress histories
+C-              (taumaxov, taumaxtimeov, taumaxch, taumaxtimech) for
+C-              erosion options > 2.
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -171,6 +206,29 @@ void InitializeSolids()
 
 	}	//end if ersovopt = 1
 
+	//Note:  dstar and tcwexpov are constant for the run, so the grain size
+	//       weights (dstar^tcwexpov) used to apportion overland transport
+	//       capacity by solids type are computed once here...
+	//
+	//Allocate memory for transport capacity grain size weights
+	dstarpowov = (double **)malloc((nlands+1) * sizeof(double *));
+
+	//loop over number of land use classes
+	for(iland=1; iland<=nlands; iland++)
+	{
+		//Allocate remaining memory for transport capacity grain size weights
+		dstarpowov[iland] = (double *)malloc((nsolids+1) * sizeof(double));
+
+		//loop over number of solids
+		for(isolid=1; isolid<=nsolids; isolid++)
+		{
+			//compute the grain size weight (dstar ^ tcwexpov)
+			dstarpowov[iland][isolid] = pow(dstar[isolid], tcwexpov[iland]);
+
+		}	//end loop over solids
+
+	}	//end loop over land use classes
+
 	/************************************************************************/
 	/*        Initialize Total Solids Concentrations for Water Column       */
 	/************************************************************************/
@@ -480,6 +538,17 @@ void InitializeSolids()
 			depflowov[isolid][i] = (float *)malloc((ncols+1) * sizeof(float));			//flow by deposition in the overland plane (m3/s) [isolid][row][col]
 			ersflowov[isolid][i] = (float *)malloc((ncols+1) * sizeof(float));			//flow by erosion in the overland plane (m3/s) [isolid][row][col]
 
+			//Allocate compact source/direction slots of overland advection and dispersion
+			//parameters for all domain cells in the row (see OVSLOT)
+			AllocateOverlandSlots(advsedovinflux[isolid][i], i);
+			AllocateOverlandSlots(advsedovoutflux[isolid][i], i);
+			AllocateOverlandSlots(dspsedovinflux[isolid][i], i);
+			AllocateOverlandSlots(dspsedovoutflux[isolid][i], i);
+			AllocateOverlandSlotsDouble(advsedovinmass[isolid][i], i);
+			AllocateOverlandSlotsDouble(advsedovoutmass[isolid][i], i);
+			AllocateOverlandSlotsDouble(dspsedovinmass[isolid][i], i);
+			AllocateOverlandSlotsDouble(dspsedovoutmass[isolid][i], i);
+
 			//Loop over number of columns
 			for(j=1; j<=ncols; j++)
 			{
@@ -494,19 +563,11 @@ void InitializeSolids()
 
 					//Allocate additional memory for overland transport parameters
 					csedovnew[isolid][i][j] = (float *)malloc((maxstackov+1) * sizeof(float));		//new overland solids concentration (for next time t+dt) (g/m3)
-					advsedovinflux[isolid][i][j] = (float *)malloc((nsources+1) * sizeof(float));	//gross solids flux transported into a cell by advection (g/s)
-					advsedovoutflux[isolid][i][j] = (float *)malloc((nsources+1) * sizeof(float));	//gross solids flux transported out of a cell by advection (g/s)
-					dspsedovinflux[isolid][i][j] = (float *)malloc((nsources+1) * sizeof(float));	//gross solids flux transported into a cell by dispersion (g/s)
-					dspsedovoutflux[isolid][i][j] = (float *)malloc((nsources+1) * sizeof(float));	//gross solids flux transported out of a cell by dispersion (g/s)
 					depsedovinflux[isolid][i][j] = (float *)malloc((maxstackov+1) * sizeof(float));	//gross solids flux transported into a cell by deposition (g/s)
 					depsedovoutflux[isolid][i][j] = (float *)malloc((maxstackov+1) * sizeof(float));	//gross solids flux transported out of a cell by deposition (g/s)
 					erssedovinflux[isolid][i][j] = (float *)malloc((maxstackov+1) * sizeof(float));	//gross solids flux transported into a cell by erosion (g/s)
 					erssedovoutflux[isolid][i][j] = (float *)malloc((maxstackov+1) * sizeof(float));	//gross solids flux transported out of a cell by erosion (g/s)
 
-					advsedovinmass[isolid][i][j] = (double *)malloc((nsources+1) * sizeof(double));	//cumulative gross solids mass transported into a cell by advection (kg)
-					advsedovoutmass[isolid][i][j] = (double *)malloc((nsources+1) * sizeof(double));	//cumulative gross solids mass transported out of a cell by advection (kg)
-					dspsedovinmass[isolid][i][j] = (double *)malloc((nsources+1) * sizeof(double));	//cumulative gross solids mass transported into a cell by dispersion (kg)
-					dspsedovoutmass[isolid][i][j] = (double *)malloc((nsources+1) * sizeof(double));	//cumulative gross solids mass transported out of a cell by dispersion (kg)
 					depsedovinmass[isolid][i][j] = (double *)malloc((maxstackov+1) * sizeof(double));	//cumulative gross solids mass transported into a cell by deposition (kg)
 					depsedovoutmass[isolid][i][j] = (double *)malloc((maxstackov+1) * sizeof(double));	//cumulative gross solids mass transported out of a cell by deposition (kg)
 					erssedovinmass[isolid][i][j] = (double *)malloc((maxstackov+1) * sizeof(double));	//cumulative gross solids mass transported into a cell by erosion (kg)
@@ -517,7 +578,7 @@ void InitializeSolids()
 					scrsedovoutmass[isolid][i][j] = (double *)malloc((maxstackov+1) * sizeof(double));	//cumulative gross solids mass transported out of a cell by scour (kg)
 
 					//loop over flow sources
-					for(k=0; k<=nsources; k++)
+					for(k=0; k<NOVSLOTS; k++)
 					{
 						//Initialize cumulative overland transport flux and mass variables
 						advsedovinflux[isolid][i][j][k] = 0.0;	//gross solids flux transported into a cell by advection (g/s)
@@ -571,28 +632,60 @@ void InitializeSolids()
 		advoutflowov[i] = (float **)malloc((ncols+1) * sizeof(float *));	//outflow by advection in the overland plane (m3/s) [row][col][direction]
 		dspflowov[i] = (float **)malloc((ncols+1) * sizeof(float *));		//flow by dispersion in the overland plane (m3/s) [row][col][direction]
 
+		//Allocate compact source/direction slots for all domain cells in the row (see OVSLOT)
+		AllocateOverlandSlots(advinflowov[i], i);		//inflow by advection in the overland plane (m3/s) [row][col][direction]
+		AllocateOverlandSlots(advoutflowov[i], i);		//outflow by advection in the overland plane (m3/s) [row][col][direction]
+		AllocateOverlandSlots(dspflowov[i], i);			//flow by dispersion in the overland plane (m3/s) [row][col][direction]
+
 		//loop over columns
 		for(j=1; j<=ncols; j++)
 		{
-			//Allocate remaining memory for solids transport parameters indexed by row, column, and source/layer
-			advinflowov[i][j] = (float *)malloc((nsources+1) * sizeof(float));	//inflow by advection in the overland plane (m3/s) [row][col][direction]
-			advoutflowov[i][j] = (float *)malloc((nsources+1) * sizeof(float));	//outflow by advection in the overland plane (m3/s) [row][col][direction]
-			dspflowov[i][j] = (float *)malloc((nsources+1) * sizeof(float));	//flow by dispersion in the overland plane (m3/s) [row][col][direction]
-
-			//loop over sources
-			for(k=0; k<=nsources; k++)
+			//if the cell is in the domain
+			if(imask[i][j] != nodatavalue)
 			{
-				//initialize values
-				advinflowov[i][j][k] = 0.0;		//inflow by advection in the overland plane (m3/s) [row][col][direction]
-				advoutflowov[i][j][k] = 0.0;	//outflow by advection in the overland plane (m3/s) [row][col][direction]
-				dspflowov[i][j][k] = 0.0;		//flow by dispersion in the overland plane (m3/s) [row][col][direction]
+				//loop over sources
+				for(k=0; k<NOVSLOTS; k++)
+				{
+					//initialize values
+					advinflowov[i][j][k] = 0.0;		//inflow by advection in the overland plane (m3/s) [row][col][direction]
+					advoutflowov[i][j][k] = 0.0;	//outflow by advection in the overland plane (m3/s) [row][col][direction]
+					dspflowov[i][j][k] = 0.0;		//flow by dispersion in the overland plane (m3/s) [row][col][direction]
+
+				}	//end loop over sources
 
-			}	//end loop over sources
+			}	//end if imask[][] != nodatavalue
 
 		}	//end loop over columns
 
 	}	//end loop over rows
 
+	//if the overland erosion option > 2 (shear stress histories are used)
+	if(ersovopt > 2)
+	{
+		//Allocate memory for overland shear stress histories indexed by row and column
+		taumaxov = (float **)malloc((nrows+1) * sizeof(float *));		//maximum shear stress overland (N/m2) [row][col]
+		taumaxtimeov = (float **)malloc((nrows+1) * sizeof(float *));	//time of maximum shear stress overland (hours) [row][col]
+
+		//loop over rows
+		for(i=1; i<=nrows; i++)
+		{
+			//Allocate remaining memory for overland shear stress histories
+			taumaxov[i] = (float *)malloc((ncols+1) * sizeof(float));		//maximum shear stress overland (N/m2) [row][col]
+			taumaxtimeov[i] = (float *)malloc((ncols+1) * sizeof(float));	//time of maximum shear stress overland (hours) [row][col]
+
+			//loop over columns
+			for(j=1; j<=ncols; j++)
+			{
+				//initialize values (no shear stress exposure yet)
+				taumaxov[i][j] = 0.0;		//maximum shear stress overland (N/m2) [row][col]
+				taumaxtimeov[i][j] = 0.0;	//time of maximum shear stress overland (hours) [row][col]
+
+			}	//end loop over columns
+
+		}	//end loop over rows
+
+	}	//end if ersovopt > 2
+
 	/***********************************************************************/
 	/*        Initialize Global Channel Solids Transport Variables         */
 	/***********************************************************************/
@@ -815,6 +908,33 @@ void InitializeSolids()
 
 		}	//end loop over links
 
+		//if the channel erosion option > 2 (shear stress histories are used)
+		if(erschopt > 2)
+		{
+			//Allocate memory for channel shear stress histories indexed by link and node
+			taumaxch = (float **)malloc((nlinks+1) * sizeof(float *));		//maximum shear stress in channels (N/m2) [link][node]
+			taumaxtimech = (float **)malloc((nlinks+1) * sizeof(float *));	//time of maximum shear stress in channels (hours) [link][node]
+
+			//loop over links
+			for(i=1; i<=nlinks; i++)
+			{
+				//Allocate remaining memory for channel shear stress histories
+				taumaxch[i] = (float *)malloc((nnodes[i]+1) * sizeof(float));		//maximum shear stress in channels (N/m2) [link][node]
+				taumaxtimech[i] = (float *)malloc((nnodes[i]+1) * sizeof(float));	//time of maximum shear stress in channels (hours) [link][node]
+
+				//loop over nodes
+				for(j=1; j<=nnodes[i]; j++)
+				{
+					//initialize values (no shear stress exposure yet)
+					taumaxch[i][j] = 0.0;		//maximum shear stress in channels (N/m2) [link][node]
+					taumaxtimech[i][j] = 0.0;	//time of maximum shear stress in channels (hours) [link][node]
+
+				}	//end loop over nodes
+
+			}	//end loop over links
+
+		}	//end if erschopt > 2
+
 	}	//end if chnopt = 1
 
 	/**********************************************************************/
@@ -1477,7 +1597,7 @@ void InitializeSolids()
 			sedexpfile_fp = NULL;
 
 			//Set sediment export file pointer
-			sedexpfile_fp = fopen(sedexpfile[i], "w");
+			sedexpfile_fp = OpenOutputFile(sedexpfile[i], "w");
 
 			//if the sediment export file pointer is null, abort execution
 			if(sedexpfile_fp == NULL)
@@ -1650,5 +1770,8 @@ void InitializeSolids()
 
 	}	//end if chnopt > 0
 
+	//Allocate memory for the soil/sediment stack work lists and event log
+	AllocateStackLists();
+
 //End of function: Return to Initialize
 }
@@ -89,6 +89,36 @@ C-  Revisions:	Added code so that errors caused by bad file names
 C-              and paths are are reported to the simulation error
 C-              file in addition to the screen.
 C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Initialize total rainfall, snowfall, interception,
+C-              and snowmelt volume sums so a simulation can be
+C-              initialized again in the same process (TrexReset).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Overland source/direction slots are allocated in
+C-              compact per-row blocks (AllocateOverlandSlots) and
+C-              addressed through OVSLOT.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Output files are opened by OpenOutputFile.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Allocate the snowfall function arrays (sfpoint,
+C-              sfinterp, nsft, psft, bsf, msf) for snow gages
+C-              (snowopt = 2).
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -354,13 +384,21 @@ void InitializeWater()
 
 	}  //end loop over rows
 
+	//Initialize total sums of rainfall, snowfall, interception, and snowmelt volumes
+	totalgrossrainvol = 0.0;	//cumulative gross rainfall volume (m3)
+	totalnetrainvol = 0.0;		//cumulative net rainfall volume (m3)
+	totalinterceptvol = 0.0;	//cumulative interception volume (m3)
+	totalgrossswevol = 0.0;		//cumulative gross snowfall volume (as swe) (m3)
+	totalnetswevol = 0.0;		//cumulative net snowfall volume (as swe) (m3)
+	totalswemeltvol = 0.0;		//cumulative snowmelt volume (as swe) (m3)
+
 	//Initialize and determine nearest radar gage in watershed grid pointer
 	//for radar rainfall option 3 using nearest neighbor interpolation
 	//
 	if(rainopt == 3)
 	{
 		//open the radarverify file in append mode (append to existing file)
-		radarverifyfile_fp = fopen(radarverifyfile, "a");
+		radarverifyfile_fp = OpenOutputFile(radarverifyfile, "a");
 
 		//Allocate memory for radar rainfall pointer
 		//Location (row, col) of nearest neighbor radar "gage" for each overland cell
@@ -506,10 +544,10 @@ void InitializeWater()
 	if(rainopt == 4)
 	{
 		//open the echo file in append mode (append to existing file)
-		echofile_fp = fopen(echofile, "a");
+		echofile_fp = OpenOutputFile(echofile, "a");
 
 		//open the DAD storm grid file (first and only time to write to file)
-		dadstormgridfile_fp = fopen(dadstormgridfile, "w");
+		dadstormgridfile_fp = OpenOutputFile(dadstormgridfile, "w");
 
 		//if the DAD storm grid file pointer is null, abort execution
 		if(dadstormgridfile_fp==NULL)
@@ -1000,6 +1038,14 @@ void InitializeWater()
 		qwovvol[i] = (float *)malloc((ncols+1) * sizeof(float));
 		sfov[i] = (float **)malloc((ncols+1) * sizeof(float *));
 
+		//Allocate compact source/direction slots of gross overland flow parameters
+		//for all domain cells in the row (see OVSLOT)
+		AllocateOverlandSlots(dqovin[i], i);
+		AllocateOverlandSlots(dqovout[i], i);
+		AllocateOverlandSlots(dqovinvol[i], i);
+		AllocateOverlandSlots(dqovoutvol[i], i);
+		AllocateOverlandSlots(sfov[i], i);
+
 		//if snowfall or snowmelt are simulated
 		if(snowopt > 0 || meltopt > 0)
 		{
@@ -1017,15 +1063,8 @@ void InitializeWater()
 				//Initialize cumulative external overland flow volume array
 				qwovvol[i][j] = 0.0;
 
-				//Allocate remaining memory for gross overland flow parameters
-				dqovin[i][j] = (float *)malloc(11 * sizeof(float));
-				dqovout[i][j] = (float *)malloc(11 * sizeof(float));
-				dqovinvol[i][j] = (float *)malloc(11 * sizeof(float));
-				dqovoutvol[i][j] = (float *)malloc(11 * sizeof(float));
-				sfov[i][j] = (float *)malloc(11 * sizeof(float));
-
 				//loop over flow sources
-				for(k=0; k<=10; k++)
+				for(k=0; k<NOVSLOTS; k++)
 				{
 					//Initialize cumulative overland flow volumes
 					dqovinvol[i][j][k] = 0.0;
@@ -1271,6 +1310,26 @@ void InitializeWater()
 	//pointer (to position in time series) for rainfall intensity
 	rfpoint = (int *)malloc((nrg+1) * sizeof(int));
 
+	//if snowfall via gages is simulated (snowopt == 2)
+	if(snowopt == 2)
+	{
+		//Allocate memory for snowfall function arrays
+
+		//next (upper) interval time for snowfall intensity time series
+		nsft = (float *)malloc((nsg+1) * sizeof(float));
+		//prior (lower) interval time for snowfall intensity time series
+		psft = (float *)malloc((nsg+1) * sizeof(float));
+		//intercept for snowfall intensity interpolation
+		bsf = (float *)malloc((nsg+1) * sizeof(float));
+		//slope for snowfall intensity interpolation
+		msf = (float *)malloc((nsg+1) * sizeof(float));
+		//pointer (to position in time series) for snowfall intensity
+		sfpoint = (int *)malloc((nsg+1) * sizeof(int));
+		//snowfall intensity interpolated in time for gage [i]
+		sfinterp = (float *)malloc((nsg+1) * sizeof(float));
+
+	}	//end if snowopt == 2
+
 	//Allocate memory for overland external flow (point source) function arrays
 
 	//next (upper) interval time for external overland flow time series
@@ -1332,7 +1391,7 @@ void InitializeWater()
 		waterexpfile_fp = NULL;
 
 		//Set water export file pointer
-		waterexpfile_fp = fopen(waterexpfile, "w");
+		waterexpfile_fp = OpenOutputFile(waterexpfile, "w");
 
 		//if the water export file pointer is null, abort execution
 		if(waterexpfile_fp == NULL)
@@ -0,0 +1,1614 @@
+/*----------------------------------------------------------------------
+C-  File:       KernelSnapshot.c
+C-
+C-  Purpose/    Concatenated group of functions to capture the state
+C-  Methods:    of one computational kernel (a transport or balance
+C-              module) to a snapshot file and to replay the kernel
+C-              in isolation from that file (kernel benchmarks).
+C-
+C-              Kernels that can be captured (see KERNEL* numbers):
+C-              OverlandWaterRoute, ChannelWaterRoute, Infiltration,
+C-              OverlandSolidsTransportCapacity,
+C-              OverlandChemicalPartitioning,
+C-              OverlandSolidsConcentration,
+C-              ChannelSolidsConcentration,
+C-              OverlandChemicalConcentration, and
+C-              ChannelChemicalConcentration.
+C-
+C-              Capture: when snapshotkernel is set (SetKernelSnapshot),
+C-              the module that calls the kernel calls CaptureKernel
+C-              before (stage 0) and after (stage 1) the kernel.  At
+C-              the first call at or after the snapshot time, stage 0
+C-              writes a header, the kernel inputs (values the kernel
+C-              reads), and the kernel outputs as they are before the
+C-              kernel (values the kernel writes, including cumulative
+C-              values it updates).  Stage 1 writes the outputs after
+C-              the kernel, closes the file, and ends the capture.
+C-
+C-              Replay: after the same input deck is initialized,
+C-              LoadKernelSnapshot reads the inputs and outputs before
+C-              the kernel into the model state and saves them to a
+C-              buffer.  RestoreKernelSnapshot restores the buffer
+C-              before each repetition of the kernel (RunKernel), and
+C-              CompareKernelSnapshot compares the outputs with the
+C-              outputs after the kernel in the file.
+C-
+C-              Values are written as double (float and integer values
+C-              are stored exactly) in native byte order, so snapshot
+C-              files are read on the machine type that wrote them.
+C-              Outputs are compared bit for bit (as their double
+C-              values).  Only domain cells (and channel nodes) are
+C-              walked.  Constant properties (grid geometry, land use
+C-              and soil parameters) are not written: they come from
+C-              the input deck.
+C-
+C-  Function
+C-   Listing:   KernelSnapshotId, KernelSnapshotName,
+C-              SetKernelSnapshot, CaptureKernel,
+C-              LoadKernelSnapshot, RestoreKernelSnapshot,
+C-              RunKernel, CompareKernelSnapshot, KernelCells,
+C-              FreeKernelSnapshot, SnapshotFields,
+C-              WalkKernelInputs, WalkKernelOutputs (and
+C-              value/array walkers)
+C-
+C-  Inputs:     snapshotkernel, simtime
+C-
+C-  Outputs:    snapshot file
+C-
+C-  Controls:   ksim, chnopt, infopt, ctlopt, trackdspovmass,
+C-              trackdspchmass
+C-
+C-  Calls:      OverlandWaterRoute, ChannelWaterRoute, Infiltration,
+C-              OverlandSolidsTransportCapacity,
+C-              OverlandChemicalPartitioning,
+C-              OverlandSolidsConcentration,
+C-              ChannelSolidsConcentration,
+C-              OverlandChemicalConcentration,
+C-              ChannelChemicalConcentration, UpdateSoilParameters
+C-
+C-  Called by:  WaterTransport, SolidsTransport,
+C-              OverlandChemicalKinetics, SolidsBalance,
+C-              ChemicalBalance, TrexSetSnapshot, TrexReplayKernel,
+C-              FreeMemory
+C-
+C-  Created:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Surface soil parameters are set after a snapshot is
+C-              loaded.
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Overland partitioning kernel captures the
+C-              partitioning cache state.
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Output files are opened by OpenOutputFile.
+C-
+C-  Revised:
+C-
+C-  Date:
+C-
+C-  Revisions:
+C-
+C----------------------------------------------------------------------*/
+
+//trex general variable declarations
+#include "trex_general_declarations.h"
+
+//trex global variable declarations for water transport
+#include "trex_water_declarations.h"
+
+//trex global variable declarations for sediment transport
+#include "trex_solids_declarations.h"
+
+//trex global variable declarations for chemical transport
+#include "trex_chemical_declarations.h"
+
+//trex global variable declarations for environmental conditions
+#include "trex_environmental_declarations.h"
+
+#define SNAPSHOTID "TREXSNAP"	//identifier at the start of a snapshot file
+#define SNAPSHOTVERSION 1		//snapshot file format version
+#define SNAPSHOTNFIELDS 11		//number of integer header fields
+
+static char
+	*kernelname[NKERNELS+1] =	//kernel names (by kernel number)
+	{
+		"",
+		"OverlandWaterRoute",
+		"ChannelWaterRoute",
+		"Infiltration",
+		"OverlandSolidsTransportCapacity",
+		"OverlandChemicalPartitioning",
+		"OverlandSolidsConcentration",
+		"ChannelSolidsConcentration",
+		"OverlandChemicalConcentration",
+		"ChannelChemicalConcentration"
+	},
+	*snapshotname = NULL;	//snapshot file name (capture)
+
+static FILE
+	*snapshot_fp = NULL;	//snapshot file pointer (capture or replay)
+
+static double
+	snapshottime,			//simulation time at or after which the kernel is captured (hours)
+	*snapshotstate = NULL;	//saved kernel inputs and outputs before the kernel (replay)
+
+static long
+	snapshotcursor,			//index of the next value walked
+	snapshotmismatches;		//number of output values that differ from the snapshot file
+
+static int
+	snapshotmode,			//walk mode (0 = count, 1 = write file, 2 = read file,
+							//  3 = save buffer, 4 = restore buffer, 5 = compare with file)
+	snapshotstage,			//capture stage (0 = waiting, 1 = inputs written, 2 = captured)
+	snapshotreplay;			//kernel number of the loaded snapshot (replay)
+
+//C
+//C
+			/*******************************************/
+			/*   FUNCTIONS: SnapValue, SnapFloat,      */
+			/*              SnapDouble, SnapInt        */
+			/*******************************************/
+
+/* Counts, writes, reads, saves, restores, or compares one value */
+/* (according to the walk mode)                                 */
+
+static void SnapValue(double *value)
+{
+	//local variable declarations
+	double stored;		//value read from the snapshot file
+
+	//if values are written to the snapshot file
+	if(snapshotmode == 1)
+	{
+		//write the value
+		fwrite(value, sizeof(double), 1, snapshot_fp);
+	}
+	else if(snapshotmode == 2 || snapshotmode == 5)	//else if values are read or compared
+	{
+		//read the value from the snapshot file
+		if(fread(&stored, sizeof(double), 1, snapshot_fp) != 1)
+		{
+			//Write error message to screen
+			printf("Error! Snapshot file is incomplete (value %ld)\n", snapshotcursor);
+			exit(EXIT_FAILURE);	//abort
+		}
+
+		//if values are read
+		if(snapshotmode == 2)
+		{
+			//read the value
+			*value = stored;
+		}
+		else if(memcmp(&stored, value, sizeof(double)) != 0)	//else if the value differs
+		{
+			//count the mismatch
+			snapshotmismatches = snapshotmismatches + 1;
+
+		}	//end if snapshotmode == 2
+	}
+	else if(snapshotmode == 3)	//else if values are saved
+	{
+		//save the value
+		snapshotstate[snapshotcursor] = *value;
+	}
+	else if(snapshotmode == 4)	//else if values are restored
+	{
+		//restore the value
+		*value = snapshotstate[snapshotcursor];
+
+	}	//end if snapshotmode == 1
+
+	//advance to the next value
+	snapshotcursor = snapshotcursor + 1;
+}
+
+static void SnapFloat(float *value)
+{
+	double x;	//value as double
+
+	//walk the value as double
+	x = *value;
+	SnapValue(&x);
+
+	//if the value is read or restored
+	if(snapshotmode == 2 || snapshotmode == 4)
+	{
+		//store the value
+		*value = (float)(x);
+	}
+}
+
+static void SnapDouble(double *value)
+{
+	//walk the value
+	SnapValue(value);
+}
+
+static void SnapInt(int *value)
+{
+	double x;	//value as double
+
+	//walk the value as double
+	x = *value;
+	SnapValue(&x);
+
+	//if the value is read or restored
+	if(snapshotmode == 2 || snapshotmode == 4)
+	{
+		//store the value
+		*value = (int)(x);
+	}
+}
+
+//C
+//C
+			/*******************************************/
+			/*   FUNCTIONS: SnapVectorFloat,           */
+			/*              SnapVectorDouble,          */
+			/*              SnapVectorInt              */
+			/*******************************************/
+
+/* Walks elements first to last of a vector */
+
+static void SnapVectorFloat(float *vector, int first, int last)
+{
+	int n;		//element index
+
+	//loop over elements
+	for(n=first; n<=last; n++)
+	{
+		//walk the element
+		SnapFloat(&vector[n]);
+	}
+}
+
+static void SnapVectorDouble(double *vector, int first, int last)
+{
+	int n;		//element index
+
+	//loop over elements
+	for(n=first; n<=last; n++)
+	{
+		//walk the element
+		SnapDouble(&vector[n]);
+	}
+}
+
+static void SnapVectorInt(int *vector, int first, int last)
+{
+	int n;		//element index
+
+	//loop over elements
+	for(n=first; n<=last; n++)
+	{
+		//walk the element
+		SnapInt(&vector[n]);
+	}
+}
+
+//C
+//C
+			/*******************************************/
+			/*   FUNCTIONS: SnapGridFloat,             */
+			/*              SnapGridInt,               */
+			/*              SnapCellsFloat,            */
+			/*              SnapCellsDouble,           */
+			/*              SnapCellsInt               */
+			/*******************************************/
+
+/* Walks an overland grid [row][col] or the first n values of each */
+/* cell of an overland array [row][col][n] (domain cells only)      */
+
+static void SnapGridFloat(float **grid)
+{
+	int row, col;	//row and column indices
+
+	//loop over rows
+	for(row=1; row<=nrows; row++)
+	{
+		//loop over columns
+		for(col=1; col<=ncols; col++)
+		{
+			//if the cell is in the domain
+			if(imask[row][col] != nodatavalue)
+			{
+				//walk the cell value
+				SnapFloat(&grid[row][col]);
+
+			}	//end if imask[][] != nodatavalue
+
+		}	//end loop over columns
+
+	}	//end loop over rows
+}
+
+static void SnapGridInt(int **grid)
+{
+	int row, col;	//row and column indices
+
+	//loop over rows
+	for(row=1; row<=nrows; row++)
+	{
+		//loop over columns
+		for(col=1; col<=ncols; col++)
+		{
+			//if the cell is in the domain
+			if(imask[row][col] != nodatavalue)
+			{
+				//walk the cell value
+				SnapInt(&grid[row][col]);
+
+			}	//end if imask[][] != nodatavalue
+
+		}	//end loop over columns
+
+	}	//end loop over rows
+}
+
+static void SnapCellsFloat(float ***array, int n)
+{
+	int row, col;	//row and column indices
+
+	//loop over rows
+	for(row=1; row<=nrows; row++)
+	{
+		//loop over columns
+		for(col=1; col<=ncols; col++)
+		{
+			//if the cell is in the domain
+			if(imask[row][col] != nodatavalue)
+			{
+				//walk the values of the cell
+				SnapVectorFloat(array[row][col], 0, n-1);
+
+			}	//end if imask[][] != nodatavalue
+
+		}	//end loop over columns
+
+	}	//end loop over rows
+}
+
+static void SnapCellsDouble(double ***array, int n)
+{
+	int row, col;	//row and column indices
+
+	//loop over rows
+	for(row=1; row<=nrows; row++)
+	{
+		//loop over columns
+		for(col=1; col<=ncols; col++)
+		{
+			//if the cell is in the domain
+			if(imask[row][col] != nodatavalue)
+			{
+				//walk the values of the cell
+				SnapVectorDouble(array[row][col], 0, n-1);
+
+			}	//end if imask[][] != nodatavalue
+
+		}	//end loop over columns
+
+	}	//end loop over rows
+}
+
+static void SnapCellsInt(int ***array, int n)
+{
+	int row, col;	//row and column indices
+
+	//loop over rows
+	for(row=1; row<=nrows; row++)
+	{
+		//loop over columns
+		for(col=1; col<=ncols; col++)
+		{
+			//if the cell is in the domain
+			if(imask[row][col] != nodatavalue)
+			{
+				//walk the values of the cell
+				SnapVectorInt(array[row][col], 0, n-1);
+
+			}	//end if imask[][] != nodatavalue
+
+		}	//end loop over columns
+
+	}	//end loop over rows
+}
+
+//C
+//C
+			/*******************************************/
+			/*   FUNCTIONS: SnapNodesFloat,            */
+			/*              SnapNodesInt,              */
+			/*              SnapNodeValuesFloat,       */
+			/*              SnapNodeValuesDouble       */
+			/*******************************************/
+
+/* Walks a channel array [link][node] or the first n values of each */
+/* node of a channel array [link][node][n]                          */
+
+static void SnapNodesFloat(float **array)
+{
+	int link;	//link index
+
+	//loop over links
+	for(link=1; link<=nlinks; link++)
+	{
+		//walk the nodes of the link
+		SnapVectorFloat(array[link], 1, nnodes[link]);
+	}
+}
+
+static void SnapNodesInt(int **array)
+{
+	int link;	//link index
+
+	//loop over links
+	for(link=1; link<=nlinks; link++)
+	{
+		//walk the nodes of the link
+		SnapVectorInt(array[link], 1, nnodes[link]);
+	}
+}
+
+static void SnapNodeValuesFloat(float ***array, int n)
+{
+	int link, node;	//link and node indices
+
+	//loop over links
+	for(link=1; link<=nlinks; link++)
+	{
+		//loop over nodes
+		for(node=1; node<=nnodes[link]; node++)
+		{
+			//walk the values of the node
+			SnapVectorFloat(array[link][node], 0, n-1);
+		}
+	}
+}
+
+static void SnapNodeValuesDouble(double ***array, int n)
+{
+	int link, node;	//link and node indices
+
+	//loop over links
+	for(link=1; link<=nlinks; link++)
+	{
+		//loop over nodes
+		for(node=1; node<=nnodes[link]; node++)
+		{
+			//walk the values of the node
+			SnapVectorDouble(array[link][node], 0, n-1);
+		}
+	}
+}
+
+//C
+//C
+			/*******************************************/
+			/*        FUNCTION: WalkKernelInputs       */
+			/*******************************************/
+
+/* Walks the values a kernel reads but does not write */
+
+static void WalkKernelInputs(int kernel)
+{
+	//local variable declarations
+	int
+		isolid,		//loop index for solids type
+		ichem;		//loop index for chemical type
+
+	//simulation time (hours) and time step (s) (all kernels)
+	SnapDouble(&simtime);
+	SnapFloat(&dt[idt]);
+
+	//if the kernel is OverlandWaterRoute
+	if(kernel == KERNELOVWATER)
+	{
+		//water depths (m) and ground elevations (m) (changed by erosion and deposition)
+		SnapGridFloat(hov);
+		SnapGridFloat(elevationov);
+
+		//if infiltration is simulated
+		if(infopt > 0)
+		{
+			//infiltration rates (m/s)
+			SnapGridFloat(infiltrationrate);
+
+		}	//end if infopt > 0
+
+		//external flows (m3/s) and boundary water depths (m)
+		SnapVectorFloat(qwovinterp, 1, nqwov);
+		SnapVectorFloat(hbcinterp, 1, noutlets);
+	}
+	else if(kernel == KERNELCHWATER)	//else if the kernel is ChannelWaterRoute
+	{
+		//water depths (m) and bed elevations (m)
+		SnapNodesFloat(hch);
+		SnapNodesFloat(elevationch);
+
+		//if channel transmission loss is simulated
+		if(ctlopt > 0)
+		{
+			//transmission loss rates (m/s)
+			SnapNodesFloat(translossrate);
+
+		}	//end if ctlopt > 0
+
+		//external flows (m3/s) and boundary water depths (m)
+		SnapVectorFloat(qwchinterp, 1, nqwch);
+		SnapVectorFloat(hbcinterp, 1, noutlets);
+	}
+	else if(kernel == KERNELINFILTRATION)	//else if the kernel is Infiltration
+	{
+		//water depths and cumulative infiltration depths (m)
+		SnapGridFloat(hov);
+		SnapGridFloat(infiltrationdepth);
+
+		//soil stack layers, soil types, and temperatures (C)
+		SnapGridInt(nstackov);
+		SnapCellsInt(soiltype, maxstackov+1);
+		SnapCellsFloat(temperatureov, maxstackov+1);
+	}
+	else if(kernel == KERNELOVTRANSCAP)	//else if the kernel is OverlandSolidsTransportCapacity
+	{
+		//water depths (m), friction slopes, and outflows (m3/s)
+		SnapGridFloat(hov);
+		SnapCellsFloat(sfov, NOVSLOTS);
+		SnapCellsFloat(dqovout, NOVSLOTS);
+
+		//soil stack layers and soil types
+		SnapGridInt(nstackov);
+		SnapCellsInt(soiltype, maxstackov+1);
+
+		//loop over solids (including total solids)
+		for(isolid=0; isolid<=nsolids; isolid++)
+		{
+			//solids concentrations (g/m3)
+			SnapCellsFloat(csedov[isolid], maxstackov+1);
+
+		}	//end loop over solids
+	}
+	else if(kernel == KERNELOVPARTITION)	//else if the kernel is OverlandChemicalPartitioning
+	{
+		//soil stack layers, soil types, and layer elevations (m)
+		SnapGridInt(nstackov);
+		SnapCellsInt(soiltype, maxstackov+1);
+		SnapCellsFloat(elevlayerov, maxstackov+1);
+
+		//if infiltration is simulated
+		if(infopt > 0)
+		{
+			//cumulative infiltration depths (m)
+			SnapGridFloat(infiltrationdepth);
+
+		}	//end if infopt > 0
+
+		//doc concentrations (g/m3) and fractions
+		SnapCellsFloat(cdocov, maxstackov+1);
+		SnapCellsFloat(fdocov, maxstackov+1);
+
+		//loop over solids
+		for(isolid=1; isolid<=nsolids; isolid++)
+		{
+			//solids concentrations (g/m3) and particle organic carbon fractions
+			SnapCellsFloat(csedov[isolid], maxstackov+1);
+			SnapCellsFloat(fpocov[isolid], maxstackov+1);
+
+		}	//end loop over solids
+
+		//partitioning cache: tolerance, stale flags, wetting fronts (m), and reference values
+		SnapFloat(&parttol);
+		SnapGridInt(partstaleov);
+		SnapGridFloat(partwfeov);
+		SnapCellsFloat(partrefov, 2*(nsolids+1));
+	}
+	else if(kernel == KERNELOVSOLIDS || kernel == KERNELOVCHEMICAL)	//else if an overland concentration kernel
+	{
+		//water depths (m) at the current and new time
+		SnapGridFloat(hov);
+		SnapGridFloat(hovnew);
+
+		//soil stack layers, soil types, and layer volumes (m3)
+		SnapGridInt(nstackov);
+		SnapCellsInt(soiltype, maxstackov+1);
+		SnapCellsDouble(vlayerov, maxstackov+1);
+
+		//if the kernel is OverlandSolidsConcentration
+		if(kernel == KERNELOVSOLIDS)
+		{
+			//layer volume limits for stack pushes and pops (m3)
+			SnapCellsFloat(maxvlayerov, maxstackov+1);
+			SnapCellsFloat(minvlayerov, maxstackov+1);
+
+			//loop over solids
+			for(isolid=1; isolid<=nsolids; isolid++)
+			{
+				//solids concentrations (g/m3)
+				SnapCellsFloat(csedov[isolid], maxstackov+1);
+
+				//solids fluxes (g/s)
+				SnapCellsFloat(advsedovinflux[isolid], NOVSLOTS);
+				SnapCellsFloat(advsedovoutflux[isolid], NOVSLOTS);
+				SnapCellsFloat(dspsedovinflux[isolid], NOVSLOTS);
+				SnapCellsFloat(dspsedovoutflux[isolid], NOVSLOTS);
+				SnapCellsFloat(depsedovinflux[isolid], maxstackov+1);
+				SnapCellsFloat(depsedovoutflux[isolid], maxstackov+1);
+				SnapCellsFloat(erssedovinflux[isolid], maxstackov+1);
+				SnapCellsFloat(erssedovoutflux[isolid], maxstackov+1);
+
+			}	//end loop over solids
+		}
+		else	//else the kernel is OverlandChemicalConcentration
+		{
+			//new layer volumes (m3) (computed by OverlandSolidsConcentration)
+			SnapCellsDouble(vlayerovnew, maxstackov+1);
+
+			//loop over chemicals
+			for(ichem=1; ichem<=nchems; ichem++)
+			{
+				//chemical concentrations (g/m3) and phase fractions
+				SnapCellsFloat(cchemov[ichem], maxstackov+1);
+				SnapCellsFloat(fdissolvedov[ichem], maxstackov+1);
+				SnapCellsFloat(fboundov[ichem], maxstackov+1);
+
+				//chemical fluxes (g/s)
+				SnapCellsFloat(advchemovinflux[ichem], NOVSLOTS);
+				SnapCellsFloat(advchemovoutflux[ichem], NOVSLOTS);
+				SnapCellsFloat(dspchemovinflux[ichem], NOVSLOTS);
+				SnapCellsFloat(dspchemovoutflux[ichem], NOVSLOTS);
+				SnapCellsFloat(depchemovinflux[ichem], maxstackov+1);
+				SnapCellsFloat(depchemovoutflux[ichem], maxstackov+1);
+				SnapCellsFloat(erschemovinflux[ichem], maxstackov+1);
+				SnapCellsFloat(erschemovoutflux[ichem], maxstackov+1);
+				SnapCellsFloat(pwrchemovinflux[ichem], maxstackov+1);
+				SnapCellsFloat(pwrchemovoutflux[ichem], maxstackov+1);
+				SnapCellsFloat(infchemovinflux[ichem], maxstackov+1);
+				SnapCellsFloat(infchemovoutflux[ichem], maxstackov+1);
+				SnapCellsFloat(biochemovinflux[ichem], maxstackov+1);
+				SnapCellsFloat(biochemovoutflux[ichem], maxstackov+1);
+				SnapCellsFloat(hydchemovinflux[ichem], maxstackov+1);
+				SnapCellsFloat(hydchemovoutflux[ichem], maxstackov+1);
+				SnapCellsFloat(oxichemovinflux[ichem], maxstackov+1);
+				SnapCellsFloat(oxichemovoutflux[ichem], maxstackov+1);
+				SnapCellsFloat(phtchemovinflux[ichem], maxstackov+1);
+				SnapCellsFloat(phtchemovoutflux[ichem], maxstackov+1);
+				SnapCellsFloat(radchemovinflux[ichem], maxstackov+1);
+				SnapCellsFloat(radchemovoutflux[ichem], maxstackov+1);
+				SnapCellsFloat(vltchemovinflux[ichem], maxstackov+1);
+				SnapCellsFloat(vltchemovoutflux[ichem], maxstackov+1);
+				SnapCellsFloat(udrchemovinflux[ichem], maxstackov+1);
+				SnapCellsFloat(udrchemovoutflux[ichem], maxstackov+1);
+
+			}	//end loop over chemicals
+
+		}	//end if kernel == KERNELOVSOLIDS
+	}
+	else if(kernel == KERNELCHSOLIDS || kernel == KERNELCHCHEMICAL)	//else if a channel concentration kernel
+	{
+		//water depths (m) at the current and new time
+		SnapNodesFloat(hch);
+		SnapNodesFloat(hchnew);
+
+		//sediment stack layers and layer volumes (m3)
+		SnapNodesInt(nstackch);
+		SnapNodeValuesDouble(vlayerch, maxstackch+1);
+
+		//if the kernel is ChannelSolidsConcentration
+		if(kernel == KERNELCHSOLIDS)
+		{
+			//layer porosities and volume limits for stack pushes and pops (m3)
+			SnapNodeValuesFloat(porositych, maxstackch+1);
+			SnapNodeValuesFloat(maxvlayerch, maxstackch+1);
+			SnapNodeValuesFloat(minvlayerch, maxstackch+1);
+
+			//loop over solids
+			for(isolid=1; isolid<=nsolids; isolid++)
+			{
+				//solids concentrations (g/m3)
+				SnapNodeValuesFloat(csedch[isolid], maxstackch+1);
+
+				//solids fluxes (g/s)
+				SnapNodeValuesFloat(advsedchinflux[isolid], 11);
+				SnapNodeValuesFloat(advsedchoutflux[isolid], 11);
+				SnapNodeValuesFloat(dspsedchinflux[isolid], 11);
+				SnapNodeValuesFloat(dspsedchoutflux[isolid], 11);
+				SnapNodeValuesFloat(depsedchinflux[isolid], maxstackch+1);
+				SnapNodeValuesFloat(depsedchoutflux[isolid], maxstackch+1);
+				SnapNodeValuesFloat(erssedchinflux[isolid], maxstackch+1);
+				SnapNodeValuesFloat(erssedchoutflux[isolid], maxstackch+1);
+
+			}	//end loop over solids
+		}
+		else	//else the kernel is ChannelChemicalConcentration
+		{
+			//new layer volumes (m3) (computed by ChannelSolidsConcentration)
+			SnapNodeValuesDouble(vlayerchnew, maxstackch+1);
+
+			//loop over chemicals
+			for(ichem=1; ichem<=nchems; ichem++)
+			{
+				//chemical concentrations (g/m3) and phase fractions
+				SnapNodeValuesFloat(cchemch[ichem], maxstackch+1);
+				SnapNodeValuesFloat(fdissolvedch[ichem], maxstackch+1);
+				SnapNodeValuesFloat(fboundch[ichem], maxstackch+1);
+
+				//chemical fluxes (g/s)
+				SnapNodeValuesFloat(advchemchinflux[ichem], 11);
+				SnapNodeValuesFloat(advchemchoutflux[ichem], 11);
+				SnapNodeValuesFloat(dspchemchinflux[ichem], 11);
+				SnapNodeValuesFloat(dspchemchoutflux[ichem], 11);
+				SnapNodeValuesFloat(depchemchinflux[ichem], maxstackch+1);
+				SnapNodeValuesFloat(depchemchoutflux[ichem], maxstackch+1);
+				SnapNodeValuesFloat(erschemchinflux[ichem], maxstackch+1);
+				SnapNodeValuesFloat(erschemchoutflux[ichem], maxstackch+1);
+				SnapNodeValuesFloat(pwrchemchinflux[ichem], maxstackch+1);
+				SnapNodeValuesFloat(pwrchemchoutflux[ichem], maxstackch+1);
+				SnapNodeValuesFloat(infchemchinflux[ichem], maxstackch+1);
+				SnapNodeValuesFloat(infchemchoutflux[ichem], maxstackch+1);
+				SnapNodeValuesFloat(biochemchinflux[ichem], maxstackch+1);
+				SnapNodeValuesFloat(biochemchoutflux[ichem], maxstackch+1);
+				SnapNodeValuesFloat(hydchemchinflux[ichem], maxstackch+1);
+				SnapNodeValuesFloat(hydchemchoutflux[ichem], maxstackch+1);
+				SnapNodeValuesFloat(oxichemchinflux[ichem], maxstackch+1);
+				SnapNodeValuesFloat(oxichemchoutflux[ichem], maxstackch+1);
+				SnapNodeValuesFloat(phtchemchinflux[ichem], maxstackch+1);
+				SnapNodeValuesFloat(phtchemchoutflux[ichem], maxstackch+1);
+				SnapNodeValuesFloat(radchemchinflux[ichem], maxstackch+1);
+				SnapNodeValuesFloat(radchemchoutflux[ichem], maxstackch+1);
+				SnapNodeValuesFloat(vltchemchinflux[ichem], maxstackch+1);
+				SnapNodeValuesFloat(vltchemchoutflux[ichem], maxstackch+1);
+				SnapNodeValuesFloat(udrchemchinflux[ichem], maxstackch+1);
+				SnapNodeValuesFloat(udrchemchoutflux[ichem], maxstackch+1);
+
+			}	//end loop over chemicals
+
+		}	//end if kernel == KERNELCHSOLIDS
+
+	}	//end if kernel == KERNELOVWATER
+
+//End of function: Return to CaptureKernel or LoadKernelSnapshot
+}
+
+//C
+//C
+			/*******************************************/
+			/*       FUNCTION: WalkKernelOutputs       */
+			/*******************************************/
+
+/* Walks the values a kernel writes (including cumulative values it */
+/* updates and values it writes for some cells or nodes only)       */
+
+static void WalkKernelOutputs(int kernel)
+{
+	//local variable declarations
+	int
+		isolid,		//loop index for solids type
+		ichem,		//loop index for chemical type
+		nbedov,		//number of overland layers walked for bed mass budgets
+		nbedch;		//number of channel layers walked for bed mass budgets
+
+	//set the number of bed layers walked (layer 0 is the water column)
+	nbedov = maxstackov + 1;
+	nbedch = maxstackch + 1;
+
+	//if the kernel is OverlandWaterRoute
+	if(kernel == KERNELOVWATER)
+	{
+		//flow direction index (alternates at each call)
+		SnapInt(&iteration);
+
+		//net flows, gross flows (m3/s), and friction slopes
+		SnapGridFloat(dqov);
+		SnapCellsFloat(dqovin, NOVSLOTS);
+		SnapCellsFloat(dqovout, NOVSLOTS);
+		SnapCellsFloat(sfov, NOVSLOTS);
+
+		//outlet flows (m3/s), peak flows and times, and reported flows
+		SnapVectorFloat(qoutov, 1, noutlets);
+		SnapVectorFloat(qinov, 1, noutlets);
+		SnapVectorFloat(qpeakov, 1, noutlets);
+		SnapVectorFloat(tpeakov, 1, noutlets);
+		SnapVectorFloat(qreportov, 1, nqreports);
+
+		//maximum courant number
+		SnapFloat(&maxcourantov);
+	}
+	else if(kernel == KERNELCHWATER)	//else if the kernel is ChannelWaterRoute
+	{
+		//net flows, gross flows (m3/s), and friction slopes
+		SnapNodesFloat(dqch);
+		SnapNodeValuesFloat(dqchin, 11);
+		SnapNodeValuesFloat(dqchout, 11);
+		SnapNodesFloat(sfch);
+
+		//link inflows and outflows (m3/s) and reported flows
+		SnapVectorFloat(qinch, 1, nlinks);
+		SnapVectorFloat(qoutch, 1, nlinks);
+		SnapVectorFloat(qreportch, 1, nqreports);
+
+		//maximum courant number
+		SnapFloat(&maxcourantch);
+	}
+	else if(kernel == KERNELINFILTRATION)	//else if the kernel is Infiltration
+	{
+		//infiltration rates (m/s)
+		SnapGridFloat(infiltrationrate);
+	}
+	else if(kernel == KERNELOVTRANSCAP)	//else if the kernel is OverlandSolidsTransportCapacity
+	{
+		//loop over solids (including total solids)
+		for(isolid=0; isolid<=nsolids; isolid++)
+		{
+			//transport capacities (g/s)
+			SnapGridFloat(transcapov[isolid]);
+
+		}	//end loop over solids
+	}
+	else if(kernel == KERNELOVPARTITION)	//else if the kernel is OverlandChemicalPartitioning
+	{
+		//loop over chemicals
+		for(ichem=1; ichem<=nchems; ichem++)
+		{
+			//dissolved and bound fractions
+			SnapCellsFloat(fdissolvedov[ichem], maxstackov+1);
+			SnapCellsFloat(fboundov[ichem], maxstackov+1);
+
+			//loop over solids
+			for(isolid=1; isolid<=nsolids; isolid++)
+			{
+				//particulate fractions
+				SnapCellsFloat(fparticulateov[ichem][isolid], maxstackov+1);
+
+			}	//end loop over solids
+
+		}	//end loop over chemicals
+	}
+	else if(kernel == KERNELOVSOLIDS)	//else if the kernel is OverlandSolidsConcentration
+	{
+		//new layer volumes (m3)
+		SnapCellsDouble(vlayerovnew, maxstackov+1);
+
+		//loop over solids
+		for(isolid=1; isolid<=nsolids; isolid++)
+		{
+			//new solids concentrations (g/m3)
+			SnapCellsFloat(csedovnew[isolid], maxstackov+1);
+
+			//advection mass budgets (kg)
+			SnapCellsDouble(advsedovinmass[isolid], NOVSLOTS);
+			SnapCellsDouble(advsedovoutmass[isolid], NOVSLOTS);
+
+			//if overland dispersion budgets are tracked
+			if(trackdspovmass > 0)
+			{
+				//dispersion mass budgets (kg)
+				SnapCellsDouble(dspsedovinmass[isolid], NOVSLOTS);
+				SnapCellsDouble(dspsedovoutmass[isolid], NOVSLOTS);
+
+			}	//end if trackdspovmass > 0
+
+			//deposition and erosion mass budgets (kg)
+			SnapCellsDouble(depsedovinmass[isolid], nbedov);
+			SnapCellsDouble(depsedovoutmass[isolid], nbedov);
+			SnapCellsDouble(erssedovinmass[isolid], nbedov);
+			SnapCellsDouble(erssedovoutmass[isolid], nbedov);
+
+			//outlet mass budgets (kg)
+			SnapVectorDouble(totaladvsedinov[isolid], 0, noutlets);
+			SnapVectorDouble(totaladvsedoutov[isolid], 0, noutlets);
+			SnapVectorDouble(totaldspsedinov[isolid], 0, noutlets);
+			SnapVectorDouble(totaldspsedoutov[isolid], 0, noutlets);
+
+			//reported concentrations (g/m3)
+			SnapVectorFloat(sedreportov[isolid], 1, nsedreports);
+
+		}	//end loop over solids
+
+		//loop over solids (including total solids)
+		for(isolid=0; isolid<=nsolids; isolid++)
+		{
+			//outlet peak solids flows (kg/s) and times (hours)
+			SnapVectorFloat(sedflowpeakov[isolid], 1, noutlets);
+			SnapVectorFloat(sedtimepeakov[isolid], 1, noutlets);
+
+		}	//end loop over solids
+
+		//pending (per-step) external solids loads (kg)
+		SnapVectorDouble(pendingswov, 1, nsolids);
+
+		//soil stack push and pop lists
+		SnapInt(&npushov);
+		SnapVectorInt(pushovrow, 1, npushov);
+		SnapVectorInt(pushovcol, 1, npushov);
+		SnapInt(&npopov);
+		SnapVectorInt(popovrow, 1, npopov);
+		SnapVectorInt(popovcol, 1, npopov);
+	}
+	else if(kernel == KERNELCHSOLIDS)	//else if the kernel is ChannelSolidsConcentration
+	{
+		//new layer volumes (m3)
+		SnapNodeValuesDouble(vlayerchnew, maxstackch+1);
+
+		//loop over solids
+		for(isolid=1; isolid<=nsolids; isolid++)
+		{
+			//new solids concentrations (g/m3)
+			SnapNodeValuesFloat(csedchnew[isolid], maxstackch+1);
+
+			//advection mass budgets (kg)
+			SnapNodeValuesDouble(advsedchinmass[isolid], 11);
+			SnapNodeValuesDouble(advsedchoutmass[isolid], 11);
+
+			//if channel dispersion budgets are tracked
+			if(trackdspchmass > 0)
+			{
+				//dispersion mass budgets (kg)
+				SnapNodeValuesDouble(dspsedchinmass[isolid], 11);
+				SnapNodeValuesDouble(dspsedchoutmass[isolid], 11);
+
+			}	//end if trackdspchmass > 0
+
+			//deposition and erosion mass budgets (kg)
+			SnapNodeValuesDouble(depsedchinmass[isolid], nbedch);
+			SnapNodeValuesDouble(depsedchoutmass[isolid], nbedch);
+			SnapNodeValuesDouble(erssedchinmass[isolid], nbedch);
+			SnapNodeValuesDouble(erssedchoutmass[isolid], nbedch);
+
+			//outlet mass budgets (kg)
+			SnapVectorDouble(totaladvsedinch[isolid], 0, noutlets);
+			SnapVectorDouble(totaladvsedoutch[isolid], 0, noutlets);
+			SnapVectorDouble(totaldspsedinch[isolid], 0, noutlets);
+			SnapVectorDouble(totaldspsedoutch[isolid], 0, noutlets);
+
+			//reported concentrations (g/m3)
+			SnapVectorFloat(sedreportch[isolid], 1, nsedreports);
+
+		}	//end loop over solids
+
+		//loop over solids (including total solids)
+		for(isolid=0; isolid<=nsolids; isolid++)
+		{
+			//outlet peak solids flows (kg/s) and times (hours)
+			SnapVectorFloat(sedflowpeakch[isolid], 1, noutlets);
+			SnapVectorFloat(sedtimepeakch[isolid], 1, noutlets);
+
+		}	//end loop over solids
+
+		//pending (per-step) external solids loads (kg)
+		SnapVectorDouble(pendingswch, 1, nsolids);
+
+		//sediment stack push and pop lists
+		SnapInt(&npushch);
+		SnapVectorInt(pushchlink, 1, npushch);
+		SnapVectorInt(pushchnode, 1, npushch);
+		SnapInt(&npopch);
+		SnapVectorInt(popchlink, 1, npopch);
+		SnapVectorInt(popchnode, 1, npopch);
+	}
+	else if(kernel == KERNELOVCHEMICAL)	//else if the kernel is OverlandChemicalConcentration
+	{
+		//loop over chemicals
+		for(ichem=1; ichem<=nchems; ichem++)
+		{
+			//new chemical concentrations (g/m3)
+			SnapCellsFloat(cchemovnew[ichem], maxstackov+1);
+
+			//advection mass budgets (kg)
+			SnapCellsDouble(advchemovinmass[ichem], NOVSLOTS);
+			SnapCellsDouble(advchemovoutmass[ichem], NOVSLOTS);
+
+			//if overland dispersion budgets are tracked
+			if(trackdspovmass > 0)
+			{
+				//dispersion mass budgets (kg)
+				SnapCellsDouble(dspchemovinmass[ichem], NOVSLOTS);
+				SnapCellsDouble(dspchemovoutmass[ichem], NOVSLOTS);
+
+			}	//end if trackdspovmass > 0
+
+			//bed exchange and transformation mass budgets (kg)
+			SnapCellsDouble(depchemovinmass[ichem], nbedov);
+			SnapCellsDouble(depchemovoutmass[ichem], nbedov);
+			SnapCellsDouble(erschemovinmass[ichem], nbedov);
+			SnapCellsDouble(erschemovoutmass[ichem], nbedov);
+			SnapCellsDouble(pwrchemovinmass[ichem], nbedov);
+			SnapCellsDouble(pwrchemovoutmass[ichem], nbedov);
+			SnapCellsDouble(infchemovinmass[ichem], nbedov);
+			SnapCellsDouble(infchemovoutmass[ichem], maxstackov+1);
+			SnapCellsDouble(biochemovinmass[ichem], nbedov);
+			SnapCellsDouble(biochemovoutmass[ichem], nbedov);
+			SnapCellsDouble(hydchemovinmass[ichem], nbedov);
+			SnapCellsDouble(hydchemovoutmass[ichem], nbedov);
+			SnapCellsDouble(oxichemovinmass[ichem], nbedov);
+			SnapCellsDouble(oxichemovoutmass[ichem], nbedov);
+			SnapCellsDouble(phtchemovinmass[ichem], nbedov);
+			SnapCellsDouble(phtchemovoutmass[ichem], nbedov);
+			SnapCellsDouble(radchemovinmass[ichem], nbedov);
+			SnapCellsDouble(radchemovoutmass[ichem], nbedov);
+			SnapCellsDouble(vltchemovinmass[ichem], nbedov);
+			SnapCellsDouble(vltchemovoutmass[ichem], nbedov);
+			SnapCellsDouble(udrchemovinmass[ichem], nbedov);
+			SnapCellsDouble(udrchemovoutmass[ichem], nbedov);
+
+			//outlet mass budgets (kg)
+			SnapVectorDouble(totaladvcheminov[ichem], 0, noutlets);
+			SnapVectorDouble(totaladvchemoutov[ichem], 0, noutlets);
+			SnapVectorDouble(totaldspcheminov[ichem], 0, noutlets);
+			SnapVectorDouble(totaldspchemoutov[ichem], 0, noutlets);
+
+			//outlet peak chemical flows (kg/s) and times (hours)
+			SnapVectorFloat(chemflowpeakov[ichem], 1, noutlets);
+			SnapVectorFloat(chemtimepeakov[ichem], 1, noutlets);
+
+			//reported concentrations (g/m3)
+			SnapVectorFloat(totchemreportov[ichem], 1, nchemreports);
+			SnapVectorFloat(dischemreportov[ichem], 1, nchemreports);
+			SnapVectorFloat(bndchemreportov[ichem], 1, nchemreports);
+			SnapVectorFloat(prtchemreportov[ichem], 1, nchemreports);
+
+		}	//end loop over chemicals
+
+		//pending (per-step) external chemical loads (kg)
+		SnapVectorDouble(pendingcwov, 1, nchems);
+
+		//running minima and maxima of water column concentrations (g/m3)
+		SnapVectorDouble(mincchemov0, 1, nchems);
+		SnapVectorDouble(maxcchemov0, 1, nchems);
+	}
+	else if(kernel == KERNELCHCHEMICAL)	//else if the kernel is ChannelChemicalConcentration
+	{
+		//loop over chemicals
+		for(ichem=1; ichem<=nchems; ichem++)
+		{
+			//new chemical concentrations (g/m3)
+			SnapNodeValuesFloat(cchemchnew[ichem], maxstackch+1);
+
+			//advection mass budgets (kg)
+			SnapNodeValuesDouble(advchemchinmass[ichem], 11);
+			SnapNodeValuesDouble(advchemchoutmass[ichem], 11);
+
+			//if channel dispersion budgets are tracked
+			if(trackdspchmass > 0)
+			{
+				//dispersion mass budgets (kg)
+				SnapNodeValuesDouble(dspchemchinmass[ichem], 11);
+				SnapNodeValuesDouble(dspchemchoutmass[ichem], 11);
+
+			}	//end if trackdspchmass > 0
+
+			//bed exchange and transformation mass budgets (kg)
+			SnapNodeValuesDouble(depchemchinmass[ichem], nbedch);
+			SnapNodeValuesDouble(depchemchoutmass[ichem], nbedch);
+			SnapNodeValuesDouble(erschemchinmass[ichem], nbedch);
+			SnapNodeValuesDouble(erschemchoutmass[ichem], nbedch);
+			SnapNodeValuesDouble(pwrchemchinmass[ichem], nbedch);
+			SnapNodeValuesDouble(pwrchemchoutmass[ichem], nbedch);
+			SnapNodeValuesDouble(infchemchinmass[ichem], nbedch);
+			SnapNodeValuesDouble(infchemchoutmass[ichem], maxstackch+1);
+			SnapNodeValuesDouble(biochemchinmass[ichem], nbedch);
+			SnapNodeValuesDouble(biochemchoutmass[ichem], nbedch);
+			SnapNodeValuesDouble(hydchemchinmass[ichem], nbedch);
+			SnapNodeValuesDouble(hydchemchoutmass[ichem], nbedch);
+			SnapNodeValuesDouble(oxichemchinmass[ichem], nbedch);
+			SnapNodeValuesDouble(oxichemchoutmass[ichem], nbedch);
+			SnapNodeValuesDouble(phtchemchinmass[ichem], nbedch);
+			SnapNodeValuesDouble(phtchemchoutmass[ichem], nbedch);
+			SnapNodeValuesDouble(radchemchinmass[ichem], nbedch);
+			SnapNodeValuesDouble(radchemchoutmass[ichem], nbedch);
+			SnapNodeValuesDouble(vltchemchinmass[ichem], nbedch);
+			SnapNodeValuesDouble(vltchemchoutmass[ichem], nbedch);
+			SnapNodeValuesDouble(udrchemchinmass[ichem], nbedch);
+			SnapNodeValuesDouble(udrchemchoutmass[ichem], nbedch);
+
+			//outlet mass budgets (kg)
+			SnapVectorDouble(totaladvcheminch[ichem], 0, noutlets);
+			SnapVectorDouble(totaladvchemoutch[ichem], 0, noutlets);
+			SnapVectorDouble(totaldspcheminch[ichem], 0, noutlets);
+			SnapVectorDouble(totaldspchemoutch[ichem], 0, noutlets);
+
+			//outlet peak chemical flows (kg/s) and times (hours)
+			SnapVectorFloat(chemflowpeakch[ichem], 1, noutlets);
+			SnapVectorFloat(chemtimepeakch[ichem], 1, noutlets);
+
+			//reported concentrations (g/m3)
+			SnapVectorFloat(totchemreportch[ichem], 1, nchemreports);
+			SnapVectorFloat(dischemreportch[ichem], 1, nchemreports);
+			SnapVectorFloat(bndchemreportch[ichem], 1, nchemreports);
+			SnapVectorFloat(prtchemreportch[ichem], 1, nchemreports);
+
+		}	//end loop over chemicals
+
+		//pending (per-step) external chemical loads (kg)
+		SnapVectorDouble(pendingcwch, 1, nchems);
+
+		//running minima and maxima of water column concentrations (g/m3)
+		SnapVectorDouble(mincchemch0, 1, nchems);
+		SnapVectorDouble(maxcchemch0, 1, nchems);
+
+	}	//end if kernel == KERNELOVWATER
+
+//End of function: Return to CaptureKernel, LoadKernelSnapshot, or CompareKernelSnapshot
+}
+
+//C
+//C
+			/*******************************************/
+			/*       FUNCTION: KernelSnapshotId        */
+			/*******************************************/
+
+/* Returns the kernel number of a kernel name (0 = not a kernel that */
+/* can be captured)                                                  */
+
+int KernelSnapshotId(char *name)
+{
+	int kernel;		//kernel number
+
+	//loop over kernels
+	for(kernel=1; kernel<=NKERNELS; kernel++)
+	{
+		//if the name is the kernel name (strcmp returns zero when the strings are identical)
+		if(strcmp(name, kernelname[kernel]) == 0)
+		{
+			//return the kernel number
+			return kernel;
+		}
+	}
+
+	//the name is not a kernel that can be captured
+	return 0;
+}
+
+//C
+//C
+			/*******************************************/
+			/*      FUNCTION: KernelSnapshotName       */
+			/*******************************************/
+
+/* Returns the name of a kernel number (empty if not a kernel) */
+
+char *KernelSnapshotName(int kernel)
+{
+	//if the kernel number is not valid
+	if(kernel < 1 || kernel > NKERNELS)
+	{
+		//return the empty name
+		return kernelname[0];
+	}
+
+	//return the kernel name
+	return kernelname[kernel];
+}
+
+//C
+//C
+			/*******************************************/
+			/*       FUNCTION: SetKernelSnapshot       */
+			/*******************************************/
+
+/* Selects the kernel, simulation time (hours), and file of a capture */
+
+void SetKernelSnapshot(int kernel, double time, char *filename)
+{
+	//free any file name of an earlier capture
+	free(snapshotname);
+
+	//store a copy of the snapshot file name
+	snapshotname = (char *)malloc((strlen(filename) + 1) * sizeof(char));
+	strcpy(snapshotname, filename);
+
+	//store the capture time and select the kernel
+	snapshottime = time;
+	snapshotkernel = kernel;
+
+	//the capture is waiting for the snapshot time
+	snapshotstage = 0;
+
+//End of function: Return to TrexSetSnapshot
+}
+
+//C
+//C
+			/*******************************************/
+			/*        FUNCTION: SnapshotFields         */
+			/*******************************************/
+
+/* Fills the integer fields of a snapshot header (file format version, */
+/* kernel, and the dimensions of the input deck)                       */
+
+static void SnapshotFields(int kernel, int *fields)
+{
+	//file format version and kernel number
+	fields[0] = SNAPSHOTVERSION;
+	fields[1] = kernel;
+
+	//simulation type and overland grid dimensions
+	fields[2] = ksim;
+	fields[3] = nrows;
+	fields[4] = ncols;
+
+	//channel network
+	fields[5] = chnopt;
+	fields[6] = nlinks;
+
+	//numbers of solids and chemicals
+	fields[7] = nsolids;
+	fields[8] = nchems;
+
+	//soil and sediment stack sizes
+	fields[9] = maxstackov;
+	fields[10] = maxstackch;
+}
+
+//C
+//C
+			/*******************************************/
+			/*         FUNCTION: CaptureKernel         */
+			/*******************************************/
+
+/* Writes the kernel inputs and outputs before the kernel (stage 0) */
+/* or the outputs after the kernel (stage 1) to the snapshot file   */
+
+void CaptureKernel(int stage)
+{
+	//local variable declarations
+	int
+		fields[SNAPSHOTNFIELDS];	//integer header fields
+
+	FILE *echo_fp;	//echo file pointer (opened to append an error message)
+
+	//if the inputs are captured (first call at or after the snapshot time)
+	if(stage == 0 && snapshotstage == 0 && simtime >= snapshottime)
+	{
+		//open the snapshot file
+		snapshot_fp = OpenOutputFile(snapshotname, "wb");
+
+		//if the snapshot file cannot be opened
+		if(snapshot_fp == NULL)
+		{
+			//append the error message to the echo file (closed during the simulation)
+			echo_fp = OpenOutputFile(echofile, "a");
+
+			//if the echo file was opened
+			if(echo_fp != NULL)
+			{
+				//Write error message to file
+				fprintf(echo_fp, "\n\n\nKernel Snapshot Error:\n");
+				fprintf(echo_fp, "  Snapshot file could not be opened: %s\n", snapshotname);
+				fclose(echo_fp);
+			}
+
+			//Write error message to screen
+			printf("\n\n\nKernel Snapshot Error:\n");
+			printf("  Snapshot file could not be opened: %s\n", snapshotname);
+
+			exit(EXIT_FAILURE);	//abort
+
+		}	//end if snapshot_fp == NULL
+
+		//write the header: identifier, integer fields, and simulation time (hours)
+		SnapshotFields(snapshotkernel, fields);
+		fwrite(SNAPSHOTID, sizeof(char), strlen(SNAPSHOTID), snapshot_fp);
+		fwrite(fields, sizeof(int), SNAPSHOTNFIELDS, snapshot_fp);
+		fwrite(&simtime, sizeof(double), 1, snapshot_fp);
+
+		//write the inputs and the outputs before the kernel
+		snapshotmode = 1;
+		snapshotcursor = 0;
+		WalkKernelInputs(snapshotkernel);
+		WalkKernelOutputs(snapshotkernel);
+
+		//the inputs are written
+		snapshotstage = 1;
+	}
+	else if(stage == 1 && snapshotstage == 1)	//else if the outputs are captured
+	{
+		//write the outputs after the kernel
+		snapshotmode = 1;
+		WalkKernelOutputs(snapshotkernel);
+
+		//close the snapshot file
+		fclose(snapshot_fp);
+		snapshot_fp = NULL;
+
+		//Write message to screen
+		printf("\n  Kernel snapshot: %s at time %f hours written to %s\n",
+			kernelname[snapshotkernel], simtime, snapshotname);
+
+		//the kernel is captured (no further calls)
+		snapshotstage = 2;
+		snapshotkernel = 0;
+
+	}	//end if stage == 0 and snapshotstage == 0...
+
+//End of function: Return to the module that calls the kernel
+}
+
+//C
+//C
+			/*******************************************/
+			/*       FUNCTION: LoadKernelSnapshot      */
+			/*******************************************/
+
+/* Reads the kernel inputs and outputs before the kernel of a snapshot */
+/* file into the model state and saves them (returns the kernel        */
+/* number).  The input deck of the snapshot must be initialized.       */
+
+int LoadKernelSnapshot(char *filename, double *time)
+{
+	//local variable declarations
+	int
+		n,									//loop index for header fields
+		fields[SNAPSHOTNFIELDS],			//integer header fields of the file
+		deckfields[SNAPSHOTNFIELDS];		//integer header fields of the initialized input deck
+
+	char
+		id[sizeof(SNAPSHOTID)];		//identifier read from the file
+
+	//close any snapshot file of an earlier replay
+	FreeKernelSnapshot();
+
+	//open the snapshot file
+	snapshot_fp = fopen(filename, "rb");
+
+	//if the snapshot file cannot be opened
+	if(snapshot_fp == NULL)
+	{
+		//Write error message to screen
+		printf("Error! Snapshot file could not be opened: %s\n", filename);
+		exit(EXIT_FAILURE);	//abort
+	}
+
+	//read the header: identifier, integer fields, and simulation time (hours)
+	memset(id, 0, sizeof(id));
+
+	//if the header cannot be read or is not a snapshot header
+	if(fread(id, sizeof(char), strlen(SNAPSHOTID), snapshot_fp) != strlen(SNAPSHOTID)
+		|| strcmp(id, SNAPSHOTID) != 0
+		|| fread(fields, sizeof(int), SNAPSHOTNFIELDS, snapshot_fp) != SNAPSHOTNFIELDS
+		|| fread(time, sizeof(double), 1, snapshot_fp) != 1
+		|| fields[0] != SNAPSHOTVERSION || fields[1] < 1 || fields[1] > NKERNELS)
+	{
+		//Write error message to screen
+		printf("Error! Not a kernel snapshot file (or other version): %s\n", filename);
+		exit(EXIT_FAILURE);	//abort
+	}
+
+	//get the header fields of the initialized input deck
+	SnapshotFields(fields[1], deckfields);
+
+	//loop over header fields (after the version and kernel)
+	for(n=2; n<SNAPSHOTNFIELDS; n++)
+	{
+		//if the field of the file differs from the input deck
+		if(fields[n] != deckfields[n])
+		{
+			//Write error message to screen
+			printf("Error! Snapshot file %s was not captured from this input deck\n", filename);
+			printf("  (header field %d: snapshot = %d, input deck = %d)\n",
+				n, fields[n], deckfields[n]);
+			exit(EXIT_FAILURE);	//abort
+
+		}	//end if fields[n] != deckfields[n]
+
+	}	//end loop over header fields
+
+	//store the kernel number
+	snapshotreplay = fields[1];
+
+	//read the inputs and the outputs before the kernel into the model state
+	snapshotmode = 2;
+	snapshotcursor = 0;
+	WalkKernelInputs(snapshotreplay);
+	WalkKernelOutputs(snapshotreplay);
+
+	//Set the surface soil parameters from the snapshot soil types and stacks
+	UpdateSoilParameters();
+
+	//Allocate memory for the saved values (at least one value)
+	snapshotstate = (double *)malloc((snapshotcursor + 1) * sizeof(double));
+
+	//save the values
+	snapshotmode = 3;
+	snapshotcursor = 0;
+	WalkKernelInputs(snapshotreplay);
+	WalkKernelOutputs(snapshotreplay);
+
+	//return the kernel number
+	return snapshotreplay;
+}
+
+//C
+//C
+			/*******************************************/
+			/*     FUNCTION: RestoreKernelSnapshot     */
+			/*******************************************/
+
+/* Restores the saved kernel inputs and outputs before the kernel */
+
+void RestoreKernelSnapshot()
+{
+	//restore the values
+	snapshotmode = 4;
+	snapshotcursor = 0;
+	WalkKernelInputs(snapshotreplay);
+	WalkKernelOutputs(snapshotreplay);
+
+//End of function: Return to TrexReplayKernel
+}
+
+//C
+//C
+			/*******************************************/
+			/*            FUNCTION: RunKernel          */
+			/*******************************************/
+
+/* Calls the kernel of a kernel number */
+
+void RunKernel(int kernel)
+{
+	//if the kernel is OverlandWaterRoute
+	if(kernel == KERNELOVWATER)
+	{
+		OverlandWaterRoute();
+	}
+	else if(kernel == KERNELCHWATER)	//else if the kernel is ChannelWaterRoute
+	{
+		ChannelWaterRoute();
+	}
+	else if(kernel == KERNELINFILTRATION)	//else if the kernel is Infiltration
+	{
+		Infiltration();
+	}
+	else if(kernel == KERNELOVTRANSCAP)	//else if the kernel is OverlandSolidsTransportCapacity
+	{
+		OverlandSolidsTransportCapacity();
+	}
+	else if(kernel == KERNELOVPARTITION)	//else if the kernel is OverlandChemicalPartitioning
+	{
+		OverlandChemicalPartitioning();
+	}
+	else if(kernel == KERNELOVSOLIDS)	//else if the kernel is OverlandSolidsConcentration
+	{
+		OverlandSolidsConcentration();
+	}
+	else if(kernel == KERNELCHSOLIDS)	//else if the kernel is ChannelSolidsConcentration
+	{
+		ChannelSolidsConcentration();
+	}
+	else if(kernel == KERNELOVCHEMICAL)	//else if the kernel is OverlandChemicalConcentration
+	{
+		OverlandChemicalConcentration();
+	}
+	else if(kernel == KERNELCHCHEMICAL)	//else if the kernel is ChannelChemicalConcentration
+	{
+		ChannelChemicalConcentration();
+
+	}	//end if kernel == KERNELOVWATER
+
+//End of function: Return to TrexReplayKernel
+}
+
+//C
+//C
+			/*******************************************/
+			/*     FUNCTION: CompareKernelSnapshot     */
+			/*******************************************/
+
+/* Compares the kernel outputs with the outputs after the kernel in */
+/* the snapshot file (returns the number of values that differ)     */
+
+long CompareKernelSnapshot()
+{
+	//compare the outputs
+	snapshotmode = 5;
+	snapshotcursor = 0;
+	snapshotmismatches = 0;
+	WalkKernelOutputs(snapshotreplay);
+
+	//close the snapshot file
+	fclose(snapshot_fp);
+	snapshot_fp = NULL;
+
+	//return the number of values that differ
+	return snapshotmismatches;
+}
+
+//C
+//C
+			/*******************************************/
+			/*          FUNCTION: KernelCells          */
+			/*******************************************/
+
+/* Returns the number of cells (overland kernels) or nodes (channel */
+/* kernels) a kernel loops over                                     */
+
+long KernelCells(int kernel)
+{
+	//local variable declarations
+	int
+		row,		//row index
+		col,		//column index
+		link;		//link index
+
+	long
+		ncells;		//number of cells or nodes
+
+	//start the count
+	ncells = 0;
+
+	//if the kernel is a channel kernel
+	if(kernel == KERNELCHWATER || kernel == KERNELCHSOLIDS || kernel == KERNELCHCHEMICAL)
+	{
+		//loop over links
+		for(link=1; link<=nlinks; link++)
+		{
+			//count the nodes of the link
+			ncells = ncells + nnodes[link];
+		}
+	}
+	else	//else the kernel is an overland kernel
+	{
+		//loop over rows
+		for(row=1; row<=nrows; row++)
+		{
+			//loop over columns
+			for(col=1; col<=ncols; col++)
+			{
+				//if the cell is in the domain
+				if(imask[row][col] != nodatavalue)
+				{
+					//count the cell
+					ncells = ncells + 1;
+
+				}	//end if imask[][] != nodatavalue
+
+			}	//end loop over columns
+
+		}	//end loop over rows
+
+	}	//end if kernel is a channel kernel
+
+	//return the number of cells or nodes
+	return ncells;
+}
+
+//C
+//C
+			/*******************************************/
+			/*       FUNCTION: FreeKernelSnapshot      */
+			/*******************************************/
+
+/* Closes the snapshot file and frees the saved kernel values */
+
+void FreeKernelSnapshot()
+{
+	//if a snapshot file is open
+	if(snapshot_fp != NULL)
+	{
+		//close the snapshot file
+		fclose(snapshot_fp);
+		snapshot_fp = NULL;
+
+	}	//end if snapshot_fp != NULL
+
+	//Free memory for the saved values
+	free(snapshotstate);
+
+	//the saved values are not allocated
+	snapshotstate = NULL;
+
+//End of function: Return to FreeMemory or LoadKernelSnapshot
+}
@@ -0,0 +1,249 @@
+/*----------------------------------------------------------------------
+C-  File:       MassAccounting.c
+C-
+C-  Purpose/    Concatenated group of functions for cumulative mass
+C-  Methods:    accounting of solids and chemicals.
+C-
+C-              InitializeMassAccounting selects the mass budgets
+C-              that are accumulated by the concentration modules.
+C-              Dispersion budgets are only accumulated when
+C-              dispersion is simulated (dspovopt, dspchopt).  All
+C-              other per-cell budgets (water column, bed layer, and
+C-              burial) are accumulated every time step in double
+C-              precision.
+C-
+C-              The domain totals of external loads (totalswov,
+C-              totalswch, totalcwov, totalcwch) are summed over all
+C-              cells at each time step.  The concentration modules
+C-              add the loads of each cell to a per-step sum and
+C-              AccumulateLoadTotals adds the per-step sums to the
+C-              totals as compensated (Kahan) sums at the end of each
+C-              time step.
+C-
+C-  Function
+C-   Listing:   InitializeMassAccounting, CompensatedSum,
+C-              AccumulateLoadTotals, FreeMassAccounting
+C-
+C-  Inputs:     dspovopt, dspchopt
+C-
+C-  Outputs:    trackdspovmass, trackdspchmass, totalswov,
+C-              totalswch, totalcwov, totalcwch
+C-
+C-  Controls:   ksim, chnopt
+C-
+C-  Calls:      None
+C-
+C-  Called by:  Initialize, TrexStep, FreeMemory
+C-
+C-  Created:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revised:
+C-
+C-  Date:
+C-
+C-  Revisions:
+C-
+C----------------------------------------------------------------------*/
+
+//trex general variable declarations
+#include "trex_general_declarations.h"
+
+//trex global variable declarations for water transport
+#include "trex_water_declarations.h"
+
+//trex global variable declarations for sediment transport
+#include "trex_solids_declarations.h"
+
+//trex global variable declarations for chemical transport
+#include "trex_chemical_declarations.h"
+
+//C
+//C
+			/*******************************************/
+			/*   FUNCTION: InitializeMassAccounting    */
+			/*******************************************/
+
+/* Selects tracked mass budgets and allocates per-step (pending) totals */
+
+void InitializeMassAccounting()
+{
+	//dispersion budgets are tracked only if dispersion is simulated
+	trackdspovmass = (dspovopt > 0) ? 1 : 0;
+	trackdspchmass = (chnopt > 0 && dspchopt > 0) ? 1 : 0;
+
+	//Allocate memory for pending solids loads and compensation terms
+	pendingswov = (double *)calloc(nsolids+1, sizeof(double));
+	carryswov = (double *)calloc(nsolids+1, sizeof(double));
+
+	//if channels are simulated
+	if(chnopt > 0)
+	{
+		//Allocate memory for pending channel solids loads and compensation terms
+		pendingswch = (double *)calloc(nsolids+1, sizeof(double));
+		carryswch = (double *)calloc(nsolids+1, sizeof(double));
+
+	}	//end if chnopt > 0
+
+	//if chemical transport is simulated
+	if(ksim > 2)
+	{
+		//Allocate memory for pending chemical loads and compensation terms
+		pendingcwov = (double *)calloc(nchems+1, sizeof(double));
+		carrycwov = (double *)calloc(nchems+1, sizeof(double));
+
+		//if channels are simulated
+		if(chnopt > 0)
+		{
+			//Allocate memory for pending channel chemical loads and compensation terms
+			pendingcwch = (double *)calloc(nchems+1, sizeof(double));
+			carrycwch = (double *)calloc(nchems+1, sizeof(double));
+
+		}	//end if chnopt > 0
+
+	}	//end if ksim > 2
+
+//End of function: Return to Initialize
+}
+
+//C
+//C
+			/*******************************************/
+			/*        FUNCTION: CompensatedSum         */
+			/*******************************************/
+
+/* Adds a value to a compensated (Kahan) sum */
+
+void CompensatedSum(double *sum, double *carry, double value)
+{
+	//local variable declarations
+	double
+		y,			//value corrected by the low order part lost so far
+		t;			//new sum
+
+	//correct the value by the compensation term
+	y = value - *carry;
+
+	//add the corrected value to the sum
+	t = *sum + y;
+
+	//compute the low order part of y lost in the sum
+	*carry = (t - *sum) - y;
+
+	//store the new sum
+	*sum = t;
+
+//End of function: Return to calling module
+}
+
+//C
+//C
+			/*******************************************/
+			/*     FUNCTION: AccumulateLoadTotals    */
+			/*******************************************/
+
+/* Adds the per-step (pending) totals to the cumulative totals */
+
+void AccumulateLoadTotals()
+{
+	//local variable declarations
+	int
+		isolid,		//loop index for solids type
+		ichem;		//loop index for chemical type
+
+	//loop over number of solids
+	for(isolid=1; isolid<=nsolids; isolid++)
+	{
+		//add the pending overland loads to the cumulative sum (kg)
+		CompensatedSum(&totalswov[isolid], &carryswov[isolid], pendingswov[isolid]);
+
+		//reset the pending overland loads
+		pendingswov[isolid] = 0.0;
+
+		//if channels are simulated
+		if(chnopt > 0)
+		{
+			//add the pending channel loads to the cumulative sum (kg)
+			CompensatedSum(&totalswch[isolid], &carryswch[isolid], pendingswch[isolid]);
+
+			//reset the pending channel loads
+			pendingswch[isolid] = 0.0;
+
+		}	//end if chnopt > 0
+
+	}	//end loop over solids
+
+	//if chemical transport is simulated
+	if(ksim > 2)
+	{
+		//loop over number of chemicals
+		for(ichem=1; ichem<=nchems; ichem++)
+		{
+			//add the pending overland loads to the cumulative sum (kg)
+			CompensatedSum(&totalcwov[ichem], &carrycwov[ichem], pendingcwov[ichem]);
+
+			//reset the pending overland loads
+			pendingcwov[ichem] = 0.0;
+
+			//if channels are simulated
+			if(chnopt > 0)
+			{
+				//add the pending channel loads to the cumulative sum (kg)
+				CompensatedSum(&totalcwch[ichem], &carrycwch[ichem], pendingcwch[ichem]);
+
+				//reset the pending channel loads
+				pendingcwch[ichem] = 0.0;
+
+			}	//end if chnopt > 0
+
+		}	//end loop over chemicals
+
+	}	//end if ksim > 2
+
+//End of function: Return to TrexStep
+}
+
+//C
+//C
+			/*******************************************/
+			/*      FUNCTION: FreeMassAccounting       */
+			/*******************************************/
+
+/* Frees memory for pending totals */
+
+void FreeMassAccounting()
+{
+	//Free memory for pending solids loads and compensation terms
+	free(pendingswov);
+	free(carryswov);
+
+	//if channels are simulated
+	if(chnopt > 0)
+	{
+		//Free memory for pending channel solids loads and compensation terms
+		free(pendingswch);
+		free(carryswch);
+
+	}	//end if chnopt > 0
+
+	//if chemical transport is simulated
+	if(ksim > 2)
+	{
+		//Free memory for pending chemical loads and compensation terms
+		free(pendingcwov);
+		free(carrycwov);
+
+		//if channels are simulated
+		if(chnopt > 0)
+		{
+			//Free memory for pending channel chemical loads and compensation terms
+			free(pendingcwch);
+			free(carrycwch);
+
+		}	//end if chnopt > 0
+
+	}	//end if ksim > 2
+
+//End of function: Return to FreeMemory
+}
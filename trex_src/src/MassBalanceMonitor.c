@@ -0,0 +1,1419 @@
+/*----------------------------------------------------------------------
+C-  File:       MassBalanceMonitor.c
+C-
+C-  Purpose/    Concatenated group of functions for the streaming
+C-  Methods:    water, solids, and chemical mass balances (mass
+C-              balance monitor).
+C-
+C-              The water depth modules (OverlandWaterDepth and
+C-              ChannelWaterDepth) reduce the volumes of each time
+C-              step over the domain while the cells are updated:
+C-              the inflows (rainfall, snowfall, snowmelt, external
+C-              flows, boundary inflows), the outflows (infiltration,
+C-              transmission loss, outlet flows), and the storage
+C-              (water and snowpack volumes at the new depths).  The
+C-              step values (mbstep, see MB* terms) are cleared at the
+C-              start of each attempt of a time step, so the values of
+C-              a rejected attempt (step recovery) are discarded.
+C-              StreamMassBalance adds the step values of an accepted
+C-              time step to the running totals (mbtotal) as
+C-              compensated (Kahan) sums.
+C-
+C-              At each print interval, ReportMassBalance writes the
+C-              running totals and the relative mass balance error
+C-              to the echo file.  The error is computed for liquid
+C-              water and the snowpack (as swe) together (snowmelt is
+C-              a transfer within the domain).  When a tolerance is set
+C-              (mbtolerance > 0) and the magnitude of the error
+C-              exceeds it, the simulation is stopped early (end of
+C-              run results are written for the time reached).
+C-
+C-              The domain totals used for end of run results
+C-              (totalnetrainvol, totalqoutov, finalwaterovvol, etc.)
+C-              are set from the running totals by MassBalanceTotals
+C-              (no grid pass over the cumulative cell volumes).
+C-
+C-              Solids (ksim > 1) and chemicals (ksim > 2) are
+C-              streamed the same way for each species (mbsolidsstep,
+C-              mbchemstep, see MS* terms).  The concentration modules
+C-              add the water column masses at the new concentrations,
+C-              the change of mass of each bed layer, and the erosion,
+C-              deposition, porewater, infiltration, and transformation
+C-              masses of the step.  The bed mass moved by the push and
+C-              pop of the soil and sediment stacks (NewStateStack) is
+C-              streamed by StreamStackMass (the mass of the listed
+C-              stacks before and after the update), so a loss of mass
+C-              when a stack is collapsed shows in the balance.  The
+C-              mass in the bed is a running total of its changes.
+C-              The error is computed for each species from the loads,
+C-              the outlet masses, the transformations, the mass lost
+C-              from the bottom of the stacks (infiltration), and the
+C-              water column and bed storage.
+C-
+C-  Function
+C-   Listing:   InitializeMassBalanceMonitor, StartMassBalanceMonitor,
+C-              ClearMassBalanceMonitor, ClearMassBalanceStep,
+C-              ClearSolidsMassBalanceStep,
+C-              ClearChemicalMassBalanceStep, StreamStackMass,
+C-              ChannelWaterVolume, StreamMassBalance,
+C-              WaterMassBalanceError,
+C-              SolidsMassBalanceError, ChemicalMassBalanceError,
+C-              ReportMassBalance, MassBalanceTotals,
+C-              SolidsMassBalanceTotals, ChemicalMassBalanceTotals,
+C-              FreeMassBalanceMonitor
+C-
+C-  Inputs:     mbstep, mbsolidsstep, mbchemstep, mbtolerance,
+C-              initialwaterovvol, initialwaterchvol, initialsweovvol,
+C-              initialsolidsmassov, initialsolidsmassch,
+C-              initialchemmassov, initialchemmassch
+C-
+C-  Outputs:    mbtotal, mbsolidstotal, mbchemtotal, mbreporterror,
+C-              mbreporttime, totalgrossrainvol, totalnetrainvol,
+C-              totalgrossswevol, totalnetswevol, totalinterceptvol,
+C-              totalswemeltvol, totalinfiltvol, totalqwov,
+C-              totalqoutov, totalqwch, totalqinch, totalqoutch,
+C-              totaltranslossvol, finalwaterovvol, finalsweovvol,
+C-              finalwaterchvol, finalsolidsmassov[][0],
+C-              finalsolidsmassch[][0], finalchemmassov[][0],
+C-              finalchemmassch[][0], totalerssedinov, totaldepsedoutov,
+C-              totalerssedinch, totaldepsedoutch, totalerscheminov,
+C-              totaldepchemoutov, totalpwrcheminov, totaltnscheminov,
+C-              totalinfchemoutov, (and channel equivalents)
+C-
+C-  Controls:   ksim, chnopt, snowopt, meltopt, infopt, ctlopt
+C-
+C-  Calls:      CompensatedSum, OpenOutputFile
+C-
+C-  Called by:  Initialize, TrexLibrary (TrexBeginPass, TrexStep),
+C-              OverlandWaterDepth, ChannelWaterDepth,
+C-              OverlandSolidsConcentration, ChannelSolidsConcentration,
+C-              OverlandChemicalConcentration,
+C-              ChannelChemicalConcentration, NewStateStack,
+C-              ComputeFinalStateWater, ComputeFinalStateSolids,
+C-              ComputeFinalStateChemical, RestoreResetState,
+C-              FreeMemory
+C-
+C-  Created:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  ReportMassBalance keeps the error and time of the
+C-              last report (mbreporterror, mbreporttime) for the
+C-              telemetry.
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Solids and chemical mass balances are streamed for
+C-              each species and checked against the tolerance
+C-              (mbtolerance).
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Added ClearMassBalanceMonitor (mass balances start
+C-              from zero after TrexReset).
+C-
+C-  Revised:
+C-
+C-  Date:
+C-
+C-  Revisions:
+C-
+C----------------------------------------------------------------------*/
+
+//trex general variable declarations
+#include "trex_general_declarations.h"
+
+//trex global variable declarations for water transport
+#include "trex_water_declarations.h"
+
+//trex global variable declarations for sediment transport
+#include "trex_solids_declarations.h"
+
+//trex global variable declarations for chemical transport
+#include "trex_chemical_declarations.h"
+
+static double
+	mbcarry[NMBTERMS+1],	//low order part lost in the running totals (Kahan compensation) [term]
+	**mbsolidscarry,		//low order part lost in the solids running totals (Kahan compensation) [solid][term]
+	**mbchemcarry;			//low order part lost in the chemical running totals (Kahan compensation) [chem][term]
+
+//C
+//C
+			/*******************************************/
+			/*      FUNCTION: AllocateSpeciesTerms     */
+			/*******************************************/
+
+/* Allocates cleared mass balance terms for species 0 to nspecies */
+
+static double **AllocateSpeciesTerms(int nspecies)
+{
+	//local variable declarations
+	int
+		ispecies;	//loop index for solids or chemical type
+
+	double
+		**terms;	//mass balance terms [species][term]
+
+	//Allocate memory for the species
+	terms = (double **)malloc((nspecies+1) * sizeof(double *));
+
+	//loop over species
+	for(ispecies=0; ispecies<=nspecies; ispecies++)
+	{
+		//Allocate memory for the (cleared) terms of this species
+		terms[ispecies] = (double *)calloc(NMSTERMS+1, sizeof(double));
+
+	}	//end loop over species
+
+	//return the terms
+	return terms;
+
+//End of function: Return to InitializeMassBalanceMonitor
+}
+
+//C
+//C
+			/*******************************************/
+			/*        FUNCTION: FreeSpeciesTerms       */
+			/*******************************************/
+
+/* Frees mass balance terms for species 0 to nspecies */
+
+static void FreeSpeciesTerms(double **terms, int nspecies)
+{
+	//local variable declarations
+	int
+		ispecies;	//loop index for solids or chemical type
+
+	//loop over species
+	for(ispecies=0; ispecies<=nspecies; ispecies++)
+	{
+		//Free memory for the terms of this species
+		free(terms[ispecies]);
+
+	}	//end loop over species
+
+	//Free memory for the species
+	free(terms);
+
+//End of function: Return to FreeMassBalanceMonitor
+}
+
+//C
+//C
+			/*******************************************/
+			/*       FUNCTION: ClearSpeciesTerms       */
+			/*******************************************/
+
+/* Clears mass balance terms for species 0 to nspecies */
+
+static void ClearSpeciesTerms(double **terms, int nspecies)
+{
+	//local variable declarations
+	int
+		ispecies,	//loop index for solids or chemical type
+		iterm;		//loop index for mass balance term
+
+	//loop over species
+	for(ispecies=0; ispecies<=nspecies; ispecies++)
+	{
+		//loop over mass balance terms
+		for(iterm=0; iterm<=NMSTERMS; iterm++)
+		{
+			//clear the term
+			terms[ispecies][iterm] = 0.0;
+
+		}	//end loop over mass balance terms
+
+	}	//end loop over species
+
+//End of function: Return to ClearMassBalanceMonitor
+}
+
+//C
+//C
+			/*******************************************/
+			/*        FUNCTION: InitialStackMass       */
+			/*******************************************/
+
+/* Returns the initial mass (kg) of all layers of a stack from the */
+/* initial masses by layer (massbylayer[1] to massbylayer[nlayers])  */
+
+static double InitialStackMass(double *massbylayer, int nlayers)
+{
+	//local variable declarations
+	int
+		ilayer;		//loop index for layer
+
+	double
+		mass;		//initial stack mass (kg)
+
+	//initialize the stack mass (kg)
+	mass = 0.0;
+
+	//loop over layers
+	for(ilayer=1; ilayer<=nlayers; ilayer++)
+	{
+		//add the initial mass of this layer (kg)
+		mass = mass + massbylayer[ilayer];
+
+	}	//end loop over layers
+
+	//return the stack mass (kg)
+	return mass;
+
+//End of function: Return to StartMassBalanceMonitor or SpeciesMassBalanceError
+}
+
+//C
+//C
+			/*******************************************/
+			/* FUNCTION: InitializeMassBalanceMonitor  */
+			/*******************************************/
+
+/* Clears the step values and running totals of the water mass balance */
+
+void InitializeMassBalanceMonitor()
+{
+	//local variable declarations
+	int
+		iterm;		//loop index for mass balance term
+
+	//loop over mass balance terms
+	for(iterm=1; iterm<=NMBTERMS; iterm++)
+	{
+		//clear the step value, the running total, and the compensation
+		mbstep[iterm] = 0.0;
+		mbtotal[iterm] = 0.0;
+		mbcarry[iterm] = 0.0;
+
+	}	//end loop over mass balance terms
+
+	//no mass balance has been reported
+	mbreporterror = 0.0;
+	mbreporttime = 0.0;
+
+	//if sediment transport is simulated
+	if(ksim > 1)
+	{
+		//Allocate memory for the (cleared) solids mass balance terms
+		mbsolidsstep = AllocateSpeciesTerms(nsolids);
+		mbsolidstotal = AllocateSpeciesTerms(nsolids);
+		mbsolidscarry = AllocateSpeciesTerms(nsolids);
+
+		//if chemical transport is simulated
+		if(ksim > 2)
+		{
+			//Allocate memory for the (cleared) chemical mass balance terms
+			mbchemstep = AllocateSpeciesTerms(nchems);
+			mbchemtotal = AllocateSpeciesTerms(nchems);
+			mbchemcarry = AllocateSpeciesTerms(nchems);
+
+		}	//end if ksim > 2
+
+	}	//end if ksim > 1
+
+//End of function: Return to Initialize
+}
+
+//C
+//C
+			/*******************************************/
+			/*    FUNCTION: ClearMassBalanceMonitor    */
+			/*******************************************/
+
+/* Clears the step values and running totals of the mass balances */
+/* (state after initialization, see RestoreResetState)            */
+
+void ClearMassBalanceMonitor()
+{
+	//local variable declarations
+	int
+		iterm;		//loop index for mass balance term
+
+	//loop over mass balance terms
+	for(iterm=1; iterm<=NMBTERMS; iterm++)
+	{
+		//clear the step value, the running total, and the compensation
+		mbstep[iterm] = 0.0;
+		mbtotal[iterm] = 0.0;
+		mbcarry[iterm] = 0.0;
+
+	}	//end loop over mass balance terms
+
+	//no mass balance has been reported
+	mbreporterror = 0.0;
+	mbreporttime = 0.0;
+
+	//if sediment transport is simulated
+	if(ksim > 1)
+	{
+		//clear the solids mass balance terms
+		ClearSpeciesTerms(mbsolidsstep, nsolids);
+		ClearSpeciesTerms(mbsolidstotal, nsolids);
+		ClearSpeciesTerms(mbsolidscarry, nsolids);
+
+		//if chemical transport is simulated
+		if(ksim > 2)
+		{
+			//clear the chemical mass balance terms
+			ClearSpeciesTerms(mbchemstep, nchems);
+			ClearSpeciesTerms(mbchemtotal, nchems);
+			ClearSpeciesTerms(mbchemcarry, nchems);
+
+		}	//end if ksim > 2
+
+	}	//end if ksim > 1
+
+//End of function: Return to RestoreResetState
+}
+
+//C
+//C
+			/*******************************************/
+			/*  FUNCTION: StartMassBalanceMonitor      */
+			/*******************************************/
+
+/* Sets the storage terms to the initial volumes and masses (start of a pass) */
+
+void StartMassBalanceMonitor()
+{
+	//local variable declarations
+	int
+		isolid,		//loop index for solids type
+		ichem;		//loop index for chemical type
+
+	//initial water and snowpack (as swe) volumes in the overland plane (m3)
+	mbtotal[MBWATEROV] = initialwaterovvol;
+	mbtotal[MBSWEOV] = initialsweovvol;
+
+	//initial water volume in the channel network (m3)
+	mbtotal[MBWATERCH] = (chnopt > 0) ? initialwaterchvol : 0.0;
+
+	//if sediment transport is simulated
+	if(ksim > 1)
+	{
+		//loop over solids
+		for(isolid=1; isolid<=nsolids; isolid++)
+		{
+			//initial solids masses in the overland water column and soil stack (kg)
+			mbsolidstotal[isolid][MSWATEROV] = initialsolidsmassov[isolid][0];
+			mbsolidstotal[isolid][MSBEDOV] = InitialStackMass(initialsolidsmassov[isolid], maxstackov);
+			mbsolidscarry[isolid][MSBEDOV] = 0.0;
+
+			//if channels are simulated
+			if(chnopt > 0)
+			{
+				//initial solids masses in the channel water column and sediment stack (kg)
+				mbsolidstotal[isolid][MSWATERCH] = initialsolidsmassch[isolid][0];
+				mbsolidstotal[isolid][MSBEDCH] = InitialStackMass(initialsolidsmassch[isolid], maxstackch);
+				mbsolidscarry[isolid][MSBEDCH] = 0.0;
+
+			}	//end if chnopt > 0
+
+		}	//end loop over solids
+
+		//if chemical transport is simulated
+		if(ksim > 2)
+		{
+			//loop over chemicals
+			for(ichem=1; ichem<=nchems; ichem++)
+			{
+				//initial chemical masses in the overland water column and soil stack (kg)
+				mbchemtotal[ichem][MSWATEROV] = initialchemmassov[ichem][0];
+				mbchemtotal[ichem][MSBEDOV] = InitialStackMass(initialchemmassov[ichem], maxstackov);
+				mbchemcarry[ichem][MSBEDOV] = 0.0;
+
+				//if channels are simulated
+				if(chnopt > 0)
+				{
+					//initial chemical masses in the channel water column and sediment stack (kg)
+					mbchemtotal[ichem][MSWATERCH] = initialchemmassch[ichem][0];
+					mbchemtotal[ichem][MSBEDCH] = InitialStackMass(initialchemmassch[ichem], maxstackch);
+					mbchemcarry[ichem][MSBEDCH] = 0.0;
+
+				}	//end if chnopt > 0
+
+			}	//end loop over chemicals
+
+		}	//end if ksim > 2
+
+	}	//end if ksim > 1
+
+//End of function: Return to TrexBeginPass
+}
+
+//C
+//C
+			/*******************************************/
+			/*    FUNCTION: ClearMassBalanceStep       */
+			/*******************************************/
+
+/* Clears the step values of mass balance terms first to last */
+
+void ClearMassBalanceStep(int first, int last)
+{
+	//local variable declarations
+	int
+		iterm;		//loop index for mass balance term
+
+	//loop over mass balance terms
+	for(iterm=first; iterm<=last; iterm++)
+	{
+		//clear the step value
+		mbstep[iterm] = 0.0;
+
+	}	//end loop over mass balance terms
+
+//End of function: Return to OverlandWaterDepth or ChannelWaterDepth
+}
+
+//C
+//C
+			/*******************************************/
+			/*   FUNCTION: ClearSolidsMassBalanceStep  */
+			/*******************************************/
+
+/* Clears the step values of solids mass balance terms first to last */
+
+void ClearSolidsMassBalanceStep(int first, int last)
+{
+	//local variable declarations
+	int
+		isolid,		//loop index for solids type
+		iterm;		//loop index for mass balance term
+
+	//loop over solids
+	for(isolid=1; isolid<=nsolids; isolid++)
+	{
+		//loop over mass balance terms
+		for(iterm=first; iterm<=last; iterm++)
+		{
+			//clear the step value
+			mbsolidsstep[isolid][iterm] = 0.0;
+
+		}	//end loop over mass balance terms
+
+	}	//end loop over solids
+
+//End of function: Return to OverlandSolidsConcentration or ChannelSolidsConcentration
+}
+
+//C
+//C
+			/*******************************************/
+			/*  FUNCTION: ClearChemicalMassBalanceStep */
+			/*******************************************/
+
+/* Clears the step values of chemical mass balance terms first to last */
+
+void ClearChemicalMassBalanceStep(int first, int last)
+{
+	//local variable declarations
+	int
+		ichem,		//loop index for chemical type
+		iterm;		//loop index for mass balance term
+
+	//loop over chemicals
+	for(ichem=1; ichem<=nchems; ichem++)
+	{
+		//loop over mass balance terms
+		for(iterm=first; iterm<=last; iterm++)
+		{
+			//clear the step value
+			mbchemstep[ichem][iterm] = 0.0;
+
+		}	//end loop over mass balance terms
+
+	}	//end loop over chemicals
+
+//End of function: Return to OverlandChemicalConcentration or ChannelChemicalConcentration
+}
+
+//C
+//C
+			/*******************************************/
+			/*        FUNCTION: StreamStackMass        */
+			/*******************************************/
+
+/* Adds the stack masses of listed overland cells (stack = 0) or     */
+/* channel nodes (stack = 1), times sign, to the running bed storage */
+
+void StreamStackMass(int stack, int *list1, int *list2, int nlisted, double sign)
+{
+	//local variable declarations
+	int
+		ilist,		//loop index for listed cell or node
+		irow,		//row (stack = 0) or link (stack = 1) of listed cell or node
+		icol,		//column (stack = 0) or node (stack = 1) of listed cell or node
+		ilayer,		//loop index for layer
+		isolid,		//loop index for solids type
+		ichem;		//loop index for chemical type
+
+	double
+		mass;		//mass in all layers of the stack (kg)
+
+	//Note:  The stack of a cell or node is pushed or popped by
+	//       NewStateStack after the time step is streamed.  The
+	//       masses of the listed stacks are removed (sign = -1)
+	//       before and added (sign = 1) after the stacks are
+	//       re-indexed, so any mass gained or lost when layers
+	//       are combined or re-indexed is seen by the balance.
+	//
+	//loop over listed cells or nodes
+	for(ilist=1; ilist<=nlisted; ilist++)
+	{
+		//get the row/link and column/node of the listed cell or node
+		irow = list1[ilist];
+		icol = list2[ilist];
+
+		//loop over solids
+		for(isolid=1; isolid<=nsolids; isolid++)
+		{
+			//initialize the stack mass (kg)
+			mass = 0.0;
+
+			//if the stack is an overland soil stack
+			if(stack == 0)
+			{
+				//loop over layers
+				for(ilayer=1; ilayer<=nstackov[irow][icol]; ilayer++)
+				{
+					//add the solids mass of this layer (kg)
+					mass = mass + csedov[isolid][irow][icol][ilayer]
+						* vlayerov[irow][icol][ilayer] / 1000.0;
+
+				}	//end loop over layers
+
+				//add the stack mass (times sign) to the running soil storage (kg)
+				CompensatedSum(&mbsolidstotal[isolid][MSBEDOV],
+					&mbsolidscarry[isolid][MSBEDOV], sign * mass);
+			}
+			else	//else the stack is a channel sediment stack
+			{
+				//loop over layers
+				for(ilayer=1; ilayer<=nstackch[irow][icol]; ilayer++)
+				{
+					//add the solids mass of this layer (kg)
+					mass = mass + csedch[isolid][irow][icol][ilayer]
+						* vlayerch[irow][icol][ilayer] / 1000.0;
+
+				}	//end loop over layers
+
+				//add the stack mass (times sign) to the running sediment storage (kg)
+				CompensatedSum(&mbsolidstotal[isolid][MSBEDCH],
+					&mbsolidscarry[isolid][MSBEDCH], sign * mass);
+
+			}	//end if stack == 0
+
+		}	//end loop over solids
+
+		//if chemical transport is simulated
+		if(ksim > 2)
+		{
+			//loop over chemicals
+			for(ichem=1; ichem<=nchems; ichem++)
+			{
+				//initialize the stack mass (kg)
+				mass = 0.0;
+
+				//if the stack is an overland soil stack
+				if(stack == 0)
+				{
+					//loop over layers
+					for(ilayer=1; ilayer<=nstackov[irow][icol]; ilayer++)
+					{
+						//add the chemical mass of this layer (kg)
+						mass = mass + cchemov[ichem][irow][icol][ilayer]
+							* vlayerov[irow][icol][ilayer] / 1000.0;
+
+					}	//end loop over layers
+
+					//add the stack mass (times sign) to the running soil storage (kg)
+					CompensatedSum(&mbchemtotal[ichem][MSBEDOV],
+						&mbchemcarry[ichem][MSBEDOV], sign * mass);
+				}
+				else	//else the stack is a channel sediment stack
+				{
+					//loop over layers
+					for(ilayer=1; ilayer<=nstackch[irow][icol]; ilayer++)
+					{
+						//add the chemical mass of this layer (kg)
+						mass = mass + cchemch[ichem][irow][icol][ilayer]
+							* vlayerch[irow][icol][ilayer] / 1000.0;
+
+					}	//end loop over layers
+
+					//add the stack mass (times sign) to the running sediment storage (kg)
+					CompensatedSum(&mbchemtotal[ichem][MSBEDCH],
+						&mbchemcarry[ichem][MSBEDCH], sign * mass);
+
+				}	//end if stack == 0
+
+			}	//end loop over chemicals
+
+		}	//end if ksim > 2
+
+	}	//end loop over listed cells or nodes
+
+//End of function: Return to NewStateStack
+}
+
+//C
+//C
+			/*******************************************/
+			/*     FUNCTION: ChannelWaterVolume        */
+			/*******************************************/
+
+/* Returns the water volume (m3) of a channel node at a flow depth */
+
+float ChannelWaterVolume(int chanlink, int channode, float hflow)
+{
+	//local variable declarations
+	float
+		bwch,		//bottom width of channel (m)
+		hbch,		//bank height of channel (m)
+		sslope,		//side slope of channel bank (dimensionless)
+		achcross;	//cross section area of channel at flow depth (m2)
+
+	//Assign channel characteristics
+	bwch = bwidth[chanlink][channode];			//channel bottom width (m)
+	hbch = hbank[chanlink][channode];			//channel bank height (m)
+	sslope = sideslope[chanlink][channode];		//channel side slope
+
+	//if flow depth <= bank height (cell is not flooded)
+	if(hflow <= hbch)
+	{
+		//channel cross-sectional area at flow depth (m2)
+		achcross = (bwch + sslope * hflow) * hflow;
+	}
+	else	//cell is flooded
+	{
+		//channel cross-sectional area at top of bank
+		//plus retangular area above the bank height (m2)
+		achcross = (bwch + sslope * hbch) * hbch
+			+ (hflow - hbch) * twidth[chanlink][channode];
+
+	}	//end if hflow <= hbch
+
+	//channel volume at flow depth (channel length includes sinuosity) (m3)
+	return achcross * chanlength[chanlink][channode];
+
+//End of function: Return to ChannelWaterDepth or ComputeFinalStateWater
+}
+
+//C
+//C
+			/*******************************************/
+			/*      FUNCTION: StreamMassBalance        */
+			/*******************************************/
+
+/* Adds the step values of species 1 to nspecies to the running totals */
+
+static void StreamSpeciesTerms(double **step, double **total, double **carry, int nspecies)
+{
+	//local variable declarations
+	int
+		ispecies,	//loop index for solids or chemical type
+		iterm;		//loop index for mass balance term
+
+	//loop over species
+	for(ispecies=1; ispecies<=nspecies; ispecies++)
+	{
+		//loop over mass balance terms
+		for(iterm=1; iterm<=NMSTERMS; iterm++)
+		{
+			//if the term is a water column storage (mass at the new concentrations)
+			if(iterm == MSWATEROV || iterm == MSWATERCH)
+			{
+				//the storage replaces the previous storage
+				total[ispecies][iterm] = step[ispecies][iterm];
+			}
+			else	//the term is a mass transported or a change of bed storage
+			{
+				//add the step mass to the running total
+				CompensatedSum(&total[ispecies][iterm], &carry[ispecies][iterm],
+					step[ispecies][iterm]);
+
+			}	//end if the term is a water column storage
+
+		}	//end loop over mass balance terms
+
+	}	//end loop over species
+
+//End of function: Return to StreamMassBalance
+}
+
+//C
+//C
+			/*******************************************/
+			/*      FUNCTION: StreamMassBalance        */
+			/*******************************************/
+
+/* Adds the step values of an accepted time step to the running totals */
+
+void StreamMassBalance()
+{
+	//local variable declarations
+	int
+		iterm;		//loop index for mass balance term
+
+	//loop over mass balance terms
+	for(iterm=1; iterm<=NMBTERMS; iterm++)
+	{
+		//if the term is a storage (volume at the new depths)
+		if(iterm == MBWATEROV || iterm == MBSWEOV || iterm == MBWATERCH)
+		{
+			//the storage replaces the previous storage
+			mbtotal[iterm] = mbstep[iterm];
+		}
+		else	//the term is a flow volume
+		{
+			//add the step volume to the running total
+			CompensatedSum(&mbtotal[iterm], &mbcarry[iterm], mbstep[iterm]);
+
+		}	//end if the term is a storage
+
+	}	//end loop over mass balance terms
+
+	//if sediment transport is simulated
+	if(ksim > 1)
+	{
+		//add the solids step masses to the running totals
+		StreamSpeciesTerms(mbsolidsstep, mbsolidstotal, mbsolidscarry, nsolids);
+
+		//if chemical transport is simulated
+		if(ksim > 2)
+		{
+			//add the chemical step masses to the running totals
+			StreamSpeciesTerms(mbchemstep, mbchemtotal, mbchemcarry, nchems);
+
+		}	//end if ksim > 2
+
+	}	//end if ksim > 1
+
+//End of function: Return to TrexStep
+}
+
+//C
+//C
+			/*******************************************/
+			/*    FUNCTION: WaterMassBalanceError      */
+			/*******************************************/
+
+/* Computes the water volumes entering, exiting, and stored in the   */
+/* domain from domain totals and returns the mass balance error (%)  */
+
+static double WaterMassBalanceError(double *values, double *volin,
+	double *volout, double *volstored)
+{
+	//local variable declarations
+	double
+		sourcevol;	//sum of all water sources (initial volume + inflows) (m3)
+
+	//Note:  The balance is computed for liquid water and the
+	//       snowpack (as swe) together, so snowmelt is a transfer
+	//       within the domain.  Without snow hydrology, the error
+	//       is the error of WriteSummaryWater.
+	//
+	//inflows: net rainfall, external flows, and boundary inflows (m3)
+	*volin = values[MBNETRAIN] + values[MBNETRAINCH] + values[MBQWOV]
+		+ values[MBQWCH] + values[MBQINCH];
+
+	//if snowfall is simulated
+	if(snowopt > 0)
+	{
+		//add net snowfall (swe) (m3)
+		*volin = *volin + values[MBNETSWE] + values[MBNETSWECH];
+
+	}	//end if snowopt > 0
+
+	//outflows: overland outlets (m3)
+	*volout = values[MBQOUTOV];
+
+	//if infiltration is simulated
+	if(infopt > 0)
+	{
+		//add infiltration (m3)
+		*volout = *volout + values[MBINFILT];
+
+	}	//end if infopt > 0
+
+	//water stored in the overland plane (m3)
+	*volstored = values[MBWATEROV];
+
+	//the initial volume is the overland volume at start (m3)
+	sourcevol = initialwaterovvol;
+
+	//if snowfall or snowmelt is simulated
+	if(snowopt > 0 || meltopt > 0)
+	{
+		//add the snowpack (swe) to the storage and initial volume (m3)
+		*volstored = *volstored + values[MBSWEOV];
+		sourcevol = sourcevol + initialsweovvol;
+
+	}	//end if snowopt > 0 or meltopt > 0
+
+	//if channels are simulated
+	if(chnopt > 0)
+	{
+		//add channel outlets and transmission loss (m3)
+		*volout = *volout + values[MBQOUTCH];
+
+		//if channel transmission loss is simulated
+		if(ctlopt > 0)
+		{
+			*volout = *volout + values[MBTRANSLOSS];
+
+		}	//end if ctlopt > 0
+
+		//add the channel volume to the storage and initial volume (m3)
+		*volstored = *volstored + values[MBWATERCH];
+		sourcevol = sourcevol + initialwaterchvol;
+
+	}	//end if chnopt > 0
+
+	//sum of all water sources (m3)
+	sourcevol = sourcevol + *volin;
+
+	//if the source water volume > zero
+	if(sourcevol > 0.0)
+	{
+		//return the mass balance error (percent)
+		return (sourcevol - (*volstored + *volout)) / sourcevol * 100.0;
+	}
+	else	//else sourcevol = 0 (it can't be < 0)
+	{
+		//the mass balance error is zero
+		return 0.0;
+
+	}	//end if sourcevol > 0.0
+
+//End of function: Return to ReportMassBalance
+}
+
+//C
+//C
+			/*******************************************/
+			/*          FUNCTION: OutletMass           */
+			/*******************************************/
+
+/* Returns the mass (kg) of a species summed over all outlets of the */
+/* overland plane and (when simulated) the channel network           */
+
+static double OutletMass(double **overland, double **channel, int ispecies)
+{
+	//local variable declarations
+	int
+		ioutlet;	//loop index for outlet
+
+	double
+		mass;		//mass summed over outlets (kg)
+
+	//initialize the mass (kg)
+	mass = 0.0;
+
+	//loop over outlets
+	for(ioutlet=1; ioutlet<=noutlets; ioutlet++)
+	{
+		//add the overland mass at this outlet (kg)
+		mass = mass + overland[ispecies][ioutlet];
+
+		//if channels are simulated
+		if(chnopt > 0)
+		{
+			//add the channel mass at this outlet (kg)
+			mass = mass + channel[ispecies][ioutlet];
+
+		}	//end if chnopt > 0
+
+	}	//end loop over outlets
+
+	//return the mass (kg)
+	return mass;
+
+//End of function: Return to SolidsMassBalanceError or ChemicalMassBalanceError
+}
+
+//C
+//C
+			/*******************************************/
+			/*      FUNCTION: MassBalanceError         */
+			/*******************************************/
+
+/* Returns the mass balance error (%) from the sum of all sources, */
+/* the storage, and the sum of all sinks                           */
+
+static double MassBalanceError(double source, double stored, double out)
+{
+	//if the source mass > zero
+	if(source > 0.0)
+	{
+		//return the mass balance error (percent)
+		return (source - (stored + out)) / source * 100.0;
+	}
+	else	//else source = 0
+	{
+		//the mass balance error is zero
+		return 0.0;
+
+	}	//end if source > 0.0
+
+//End of function: Return to SolidsMassBalanceError or ChemicalMassBalanceError
+}
+
+//C
+//C
+			/*******************************************/
+			/*    FUNCTION: SolidsMassBalanceError     */
+			/*******************************************/
+
+/* Computes the solids mass entering, exiting, and stored in the     */
+/* domain (water column and bed) and returns the mass balance error  */
+
+static double SolidsMassBalanceError(int isolid, double *massin,
+	double *massout, double *massstored)
+{
+	//local variable declarations
+	double
+		initialmass;	//initial solids mass in the domain (kg)
+
+	//Note:  Erosion and deposition are transfers between the
+	//       water column and the bed within the domain.  Mass
+	//       gained or lost when concentrations are truncated or
+	//       stack layers are combined is seen as an error.
+	//
+	//inflows: external loads (net) and outlet (boundary) inflows (kg)
+	*massin = totalswov[isolid]
+		+ OutletMass(totaladvsedinov, totaladvsedinch, isolid)
+		+ OutletMass(totaldspsedinov, totaldspsedinch, isolid);
+
+	//outflows: outlet (boundary) outflows (kg)
+	*massout = OutletMass(totaladvsedoutov, totaladvsedoutch, isolid)
+		+ OutletMass(totaldspsedoutov, totaldspsedoutch, isolid);
+
+	//solids stored in the overland water column and soil stack (kg)
+	*massstored = mbsolidstotal[isolid][MSWATEROV] + mbsolidstotal[isolid][MSBEDOV];
+
+	//initial solids mass in the overland plane (kg)
+	initialmass = initialsolidsmassov[isolid][0]
+		+ InitialStackMass(initialsolidsmassov[isolid], maxstackov);
+
+	//if channels are simulated
+	if(chnopt > 0)
+	{
+		//add channel loads (kg)
+		*massin = *massin + totalswch[isolid];
+
+		//add the channel water column and sediment stack storage (kg)
+		*massstored = *massstored + mbsolidstotal[isolid][MSWATERCH]
+			+ mbsolidstotal[isolid][MSBEDCH];
+
+		//add the initial solids mass in the channel network (kg)
+		initialmass = initialmass + initialsolidsmassch[isolid][0]
+			+ InitialStackMass(initialsolidsmassch[isolid], maxstackch);
+
+	}	//end if chnopt > 0
+
+	//return the mass balance error (percent)
+	return MassBalanceError(initialmass + *massin, *massstored, *massout);
+
+//End of function: Return to ReportMassBalance
+}
+
+//C
+//C
+			/*******************************************/
+			/*   FUNCTION: ChemicalMassBalanceError    */
+			/*******************************************/
+
+/* Computes the chemical mass entering, exiting, and stored in the   */
+/* domain (water column and bed) and returns the mass balance error  */
+
+static double ChemicalMassBalanceError(int ichem, double *massin,
+	double *massout, double *massstored)
+{
+	//local variable declarations
+	double
+		initialmass;	//initial chemical mass in the domain (kg)
+
+	//Note:  Transformations (including yields from other
+	//       chemicals and volatilization) and infiltration out of
+	//       the bottom of the stack are sources and sinks of the
+	//       domain.  Erosion, deposition, porewater release, and
+	//       infiltration between layers are transfers within it.
+	//
+	//inflows: external loads (net), outlet (boundary) inflows, and transformation gains (kg)
+	*massin = totalcwov[ichem] + mbchemtotal[ichem][MSKININOV]
+		+ OutletMass(totaladvcheminov, totaladvcheminch, ichem)
+		+ OutletMass(totaldspcheminov, totaldspcheminch, ichem);
+
+	//outflows: outlet (boundary) outflows, transformation losses, and infiltration out of the stack (kg)
+	*massout = mbchemtotal[ichem][MSKINOUTOV] + mbchemtotal[ichem][MSINFSTACKOV]
+		+ OutletMass(totaladvchemoutov, totaladvchemoutch, ichem)
+		+ OutletMass(totaldspchemoutov, totaldspchemoutch, ichem);
+
+	//chemical stored in the overland water column and soil stack (kg)
+	*massstored = mbchemtotal[ichem][MSWATEROV] + mbchemtotal[ichem][MSBEDOV];
+
+	//initial chemical mass in the overland plane (kg)
+	initialmass = initialchemmassov[ichem][0]
+		+ InitialStackMass(initialchemmassov[ichem], maxstackov);
+
+	//if channels are simulated
+	if(chnopt > 0)
+	{
+		//add channel loads and transformation gains (kg)
+		*massin = *massin + totalcwch[ichem] + mbchemtotal[ichem][MSKININCH];
+
+		//add channel transformation losses and transmission loss out of the stack (kg)
+		*massout = *massout + mbchemtotal[ichem][MSKINOUTCH] + mbchemtotal[ichem][MSINFSTACKCH];
+
+		//add the channel water column and sediment stack storage (kg)
+		*massstored = *massstored + mbchemtotal[ichem][MSWATERCH]
+			+ mbchemtotal[ichem][MSBEDCH];
+
+		//add the initial chemical mass in the channel network (kg)
+		initialmass = initialmass + initialchemmassch[ichem][0]
+			+ InitialStackMass(initialchemmassch[ichem], maxstackch);
+
+	}	//end if chnopt > 0
+
+	//return the mass balance error (percent)
+	return MassBalanceError(initialmass + *massin, *massstored, *massout);
+
+//End of function: Return to ReportMassBalance
+}
+
+//C
+//C
+			/*******************************************/
+			/*      FUNCTION: ReportMassBalance        */
+			/*******************************************/
+
+/* Writes the running water, solids, and chemical mass balances to  */
+/* the echo file (returns 1 if an error exceeds the tolerance and    */
+/* the run must stop, or 0)                                          */
+
+int ReportMassBalance()
+{
+	//local variable declarations
+	int
+		isolid,				//loop index for solids type
+		ichem;				//loop index for chemical type
+
+	double
+		volin,				//water volume entering the domain (m3)
+		volout,				//water volume exiting the domain (m3)
+		volstored,			//water volume stored in the domain (m3)
+		mberror,			//water mass balance error (%)
+		massin,				//solids or chemical mass entering the domain (kg)
+		massout,			//solids or chemical mass exiting the domain (kg)
+		massstored,			//solids or chemical mass stored in the domain (kg)
+		error,				//solids or chemical mass balance error (%)
+		maxerror;			//error (%) of largest magnitude of all balances
+
+	char
+		maxbalance[MAXNAMESIZE];	//name of the balance with the largest error
+
+	//compute the mass balance error (percent)
+	mberror = WaterMassBalanceError(mbtotal, &volin, &volout, &volstored);
+
+	//keep the error and time of the report (published by UpdateTelemetry)
+	mbreporterror = mberror;
+	mbreporttime = simtime;
+
+	//open the echo file in append mode (closed during the simulation)
+	echofile_fp = OpenOutputFile(echofile, "a");
+
+	//write the running mass balance
+	fprintf(echofile_fp, "Water Mass Balance:  time = %9.4f  in = %15.2f  out = %15.2f  stored = %15.2f  error = %10.4f %%\n",
+		simtime, volin, volout, volstored, mberror);
+
+	//the water balance has the largest error so far
+	maxerror = mberror;
+	strcpy(maxbalance, "Water");
+
+	//if sediment transport is simulated
+	if(ksim > 1)
+	{
+		//loop over solids
+		for(isolid=1; isolid<=nsolids; isolid++)
+		{
+			//compute the solids mass balance error (percent)
+			error = SolidsMassBalanceError(isolid, &massin, &massout, &massstored);
+
+			//write the running solids mass balance (kg)
+			fprintf(echofile_fp, "Solids Mass Balance:  time = %9.4f  solids = %3d  in = %15.6e  out = %15.6e  stored = %15.6e  error = %10.4f %%\n",
+				simtime, isolid, massin, massout, massstored, error);
+
+			//if this error is the largest so far (or is not a number)
+			if(fabs(error) > fabs(maxerror) || error != error)
+			{
+				//keep the error and the name of the balance
+				maxerror = error;
+				sprintf(maxbalance, "Solids type %d", isolid);
+
+			}	//end if fabs(error) > fabs(maxerror)
+
+		}	//end loop over solids
+
+		//if chemical transport is simulated
+		if(ksim > 2)
+		{
+			//loop over chemicals
+			for(ichem=1; ichem<=nchems; ichem++)
+			{
+				//compute the chemical mass balance error (percent)
+				error = ChemicalMassBalanceError(ichem, &massin, &massout, &massstored);
+
+				//write the running chemical mass balance (kg)
+				fprintf(echofile_fp, "Chemical Mass Balance:  time = %9.4f  chemical = %3d  in = %15.6e  out = %15.6e  stored = %15.6e  error = %10.4f %%\n",
+					simtime, ichem, massin, massout, massstored, error);
+
+				//if this error is the largest so far (or is not a number)
+				if(fabs(error) > fabs(maxerror) || error != error)
+				{
+					//keep the error and the name of the balance
+					maxerror = error;
+					sprintf(maxbalance, "Chemical type %d", ichem);
+
+				}	//end if fabs(error) > fabs(maxerror)
+
+			}	//end loop over chemicals
+
+		}	//end if ksim > 2
+
+	}	//end if ksim > 1
+
+	//Note:  A balance that is not a number (the masses have
+	//       diverged) always exceeds the tolerance.
+	//
+	//if a tolerance is set and the largest error exceeds it
+	if(mbtolerance > 0.0 && (fabs(maxerror) > mbtolerance || maxerror != maxerror))
+	{
+		//write the stop message to the echo file
+		fprintf(echofile_fp, "\n%s mass balance error %g %% exceeds tolerance %g %%: simulation stopped at time = %9.4f\n\n",
+			maxbalance, maxerror, mbtolerance, simtime);
+
+		//close the echo file
+		fclose(echofile_fp);
+
+		//write the stop message to the screen
+		printf("\n  %s mass balance error %g %% exceeds tolerance %g %%: simulation stopped at time = %9.4f\n",
+			maxbalance, maxerror, mbtolerance, simtime);
+
+		//the simulation must stop
+		return 1;
+
+	}	//end if mbtolerance > 0 and |maxerror| > mbtolerance
+
+	//close the echo file
+	fclose(echofile_fp);
+
+	//the simulation continues
+	return 0;
+
+//End of function: Return to TrexStep
+}
+
+//C
+//C
+			/*******************************************/
+			/*      FUNCTION: MassBalanceTotals        */
+			/*******************************************/
+
+/* Sets the domain totals of end of run results from the running totals */
+
+void MassBalanceTotals()
+{
+	//Cumulative rainfall, snowfall, interception, snowmelt, and infiltration volumes (m3)
+	totalgrossrainvol = (float)(mbtotal[MBGROSSRAIN]);
+	totalnetrainvol = (float)(mbtotal[MBNETRAIN] + mbtotal[MBNETRAINCH]);
+	totalgrossswevol = (float)(mbtotal[MBGROSSSWE]);
+	totalnetswevol = (float)(mbtotal[MBNETSWE] + mbtotal[MBNETSWECH]);
+	totalinterceptvol = (float)(mbtotal[MBINTERCEPT]);
+	totalswemeltvol = (float)(mbtotal[MBSWEMELT]);
+	totalinfiltvol = (float)(mbtotal[MBINFILT]);
+
+	//Cumulative external flow and outlet volumes of the overland plane (m3)
+	totalqwov = (float)(mbtotal[MBQWOV]);
+	totalqoutov = (float)(mbtotal[MBQOUTOV]);
+
+	//Final water and snowpack (as swe) volumes in the overland plane (m3)
+	finalwaterovvol = (float)(mbtotal[MBWATEROV]);
+	finalsweovvol = (float)(mbtotal[MBSWEOV]);
+
+	//if channels are simulated
+	if(chnopt > 0)
+	{
+		//Cumulative external flow, boundary, and transmission loss volumes of the channel network (m3)
+		totalqwch = (float)(mbtotal[MBQWCH]);
+		totalqinch = (float)(mbtotal[MBQINCH]);
+		totalqoutch = (float)(mbtotal[MBQOUTCH]);
+		totaltranslossvol = (float)(mbtotal[MBTRANSLOSS]);
+
+		//Final water volume in the channel network (m3)
+		finalwaterchvol = (float)(mbtotal[MBWATERCH]);
+
+	}	//end if chnopt > 0
+
+//End of function: Return to ComputeFinalStateWater
+}
+
+//C
+//C
+			/*******************************************/
+			/*    FUNCTION: SolidsMassBalanceTotals    */
+			/*******************************************/
+
+/* Sets the solids domain totals of end of run results from the */
+/* running totals                                               */
+
+void SolidsMassBalanceTotals()
+{
+	//local variable declarations
+	int
+		isolid;		//loop index for solids type
+
+	//initialize the total (sum of all solids) erosion and deposition masses (kg)
+	totalerssedinov[0] = 0.0;
+	totaldepsedoutov[0] = 0.0;
+
+	//loop over solids
+	for(isolid=1; isolid<=nsolids; isolid++)
+	{
+		//Final suspended solids mass in the overland plane (kg)
+		finalsolidsmassov[isolid][0] = mbsolidstotal[isolid][MSWATEROV];
+
+		//Cumulative solids mass entering the water column by erosion and leaving it by deposition over the overland plane (kg)
+		totalerssedinov[isolid] = mbsolidstotal[isolid][MSERSOV];
+		totaldepsedoutov[isolid] = mbsolidstotal[isolid][MSDEPOV];
+
+		//Cumulative total solids mass entering the water column by erosion and leaving it by deposition (kg)
+		totalerssedinov[0] = totalerssedinov[0] + totalerssedinov[isolid];
+		totaldepsedoutov[0] = totaldepsedoutov[0] + totaldepsedoutov[isolid];
+
+	}	//end loop over solids
+
+	//if channels are simulated
+	if(chnopt > 0)
+	{
+		//initialize the total (sum of all solids) erosion and deposition masses (kg)
+		totalerssedinch[0] = 0.0;
+		totaldepsedoutch[0] = 0.0;
+
+		//loop over solids
+		for(isolid=1; isolid<=nsolids; isolid++)
+		{
+			//Final suspended solids mass in the channel network (kg)
+			finalsolidsmassch[isolid][0] = mbsolidstotal[isolid][MSWATERCH];
+
+			//Cumulative solids mass entering the water column by erosion and leaving it by deposition in the channel network (kg)
+			totalerssedinch[isolid] = mbsolidstotal[isolid][MSERSCH];
+			totaldepsedoutch[isolid] = mbsolidstotal[isolid][MSDEPCH];
+
+			//Cumulative total solids mass entering the water column by erosion and leaving it by deposition (kg)
+			totalerssedinch[0] = totalerssedinch[0] + totalerssedinch[isolid];
+			totaldepsedoutch[0] = totaldepsedoutch[0] + totaldepsedoutch[isolid];
+
+		}	//end loop over solids
+
+	}	//end if chnopt > 0
+
+//End of function: Return to ComputeFinalStateSolids
+}
+
+//C
+//C
+			/*******************************************/
+			/*   FUNCTION: ChemicalMassBalanceTotals   */
+			/*******************************************/
+
+/* Sets the chemical domain totals of end of run results from the */
+/* running totals                                                 */
+
+void ChemicalMassBalanceTotals()
+{
+	//local variable declarations
+	int
+		ichem;		//loop index for chemical type
+
+	//loop over chemicals
+	for(ichem=1; ichem<=nchems; ichem++)
+	{
+		//Final chemical mass in the overland water column (kg)
+		finalchemmassov[ichem][0] = mbchemtotal[ichem][MSWATEROV];
+
+		//Cumulative chemical mass leaving the overland water column by deposition and infiltration (kg)
+		totaldepchemoutov[ichem] = mbchemtotal[ichem][MSDEPOV];
+		totalinfchemoutov[ichem][0] = mbchemtotal[ichem][MSINFOV];
+
+		//Cumulative chemical mass entering the overland water column by erosion, porewater release, and transformations (kg)
+		totalerscheminov[ichem] = mbchemtotal[ichem][MSERSOV];
+		totalpwrcheminov[ichem] = mbchemtotal[ichem][MSPWROV];
+		totaltnscheminov[ichem] = mbchemtotal[ichem][MSTNSINOV];
+
+		//Cumulative chemical mass leaving the surface soil layer (at the time of transport) by infiltration (kg)
+		totalinfchemoutov[ichem][1] = mbchemtotal[ichem][MSINFSURFOV];
+
+		//if channels are simulated
+		if(chnopt > 0)
+		{
+			//Final chemical mass in the channel water column (kg)
+			finalchemmassch[ichem][0] = mbchemtotal[ichem][MSWATERCH];
+
+			//Cumulative chemical mass leaving the channel water column by deposition and transmission loss (kg)
+			totaldepchemoutch[ichem] = mbchemtotal[ichem][MSDEPCH];
+			totalinfchemoutch[ichem][0] = mbchemtotal[ichem][MSINFCH];
+
+			//Cumulative chemical mass entering the channel water column by erosion, porewater release, and transformations (kg)
+			totalerscheminch[ichem] = mbchemtotal[ichem][MSERSCH];
+			totalpwrcheminch[ichem] = mbchemtotal[ichem][MSPWRCH];
+			totaltnscheminch[ichem] = mbchemtotal[ichem][MSTNSINCH];
+
+			//Cumulative chemical mass leaving the surface sediment layer (at the time of transport) by transmission loss (kg)
+			totalinfchemoutch[ichem][1] = mbchemtotal[ichem][MSINFSURFCH];
+
+		}	//end if chnopt > 0
+
+	}	//end loop over chemicals
+
+//End of function: Return to ComputeFinalStateChemical
+}
+
+//C
+//C
+			/*******************************************/
+			/*     FUNCTION: FreeMassBalanceMonitor    */
+			/*******************************************/
+
+/* Frees memory for the solids and chemical mass balance terms */
+
+void FreeMassBalanceMonitor()
+{
+	//Free memory for the solids mass balance terms
+	FreeSpeciesTerms(mbsolidsstep, nsolids);
+	FreeSpeciesTerms(mbsolidstotal, nsolids);
+	FreeSpeciesTerms(mbsolidscarry, nsolids);
+
+	//if chemical transport is simulated
+	if(ksim > 2)
+	{
+		//Free memory for the chemical mass balance terms
+		FreeSpeciesTerms(mbchemstep, nchems);
+		FreeSpeciesTerms(mbchemtotal, nchems);
+		FreeSpeciesTerms(mbchemcarry, nchems);
+
+	}	//end if ksim > 2
+
+//End of function: Return to FreeMemory
+}
@@ -0,0 +1,729 @@
+/*----------------------------------------------------------------------
+C-  File:       MemoryFootprint.c
+C-
+C-  Purpose/    Concatenated group of functions for the memory
+C-  Methods:    footprint of a simulation (heap accounting and dry
+C-              run sizing).
+C-
+C-              Memory is allocated piecemeal by the input readers
+C-              (Data Groups A-F) and the initialization modules.
+C-              Heap accounting charges the heap growth between
+C-              checkpoints to a subsystem (general, water, solids,
+C-              chemical, environment): ReadInputFile and Initialize
+C-              call MemoryCheckpoint after each data group and
+C-              initialization module.  The heap in use is taken from
+C-              the allocator (glibc mallinfo2, including allocator
+C-              overhead).  Where the allocator does not report its
+C-              heap, nothing is measured.  The measured footprint is
+C-              written to the echo file at the start of a simulation
+C-              (WriteMemoryReport) and is returned by TrexGetMemory.
+C-
+C-              For a dry run (dryrunopt = 1, see TrexSetDryRun and
+C-              the -dryrun option of trex), the input file is read
+C-              but the value grids (elevations, soils, land uses,
+C-              initial conditions, stack layers, loads, environmental
+C-              conditions) are not: only the mask, link, and node
+C-              grids and the tables are read.  EstimateMemory then
+C-              computes the bytes that the skipped grid readers and
+C-              the initialization modules will allocate by subsystem
+C-              and array family from the dimensions and options
+C-              (nrows, ncols, active cells, links, nodes, stack
+C-              layers, solids, chemicals) with the chunk sizes of the
+C-              allocator.  The heap measured while reading the dry
+C-              run inputs is added as the input family.  Arrays
+C-              that are allocated during time stepping (output
+C-              buffers) and small tables of the initialization
+C-              modules are not included.
+C-
+C-  Function
+C-   Listing:   StartMemoryAccount, MemoryCheckpoint, EstimateMemory,
+C-              WriteMemoryReport, HeapInUse, ChunkBytes,
+C-              GridBytes, CellBytes, NodeBytes, NodeLayerBytes
+C-
+C-  Inputs:     dryrunopt, nrows, ncols, imask, nlinks, nnodes,
+C-              maxstackov, maxstackch, nsolids, nchems, options
+C-
+C-  Outputs:    memmeasured, memestimate
+C-
+C-  Controls:   ksim, chnopt, dryrunopt
+C-
+C-  Calls:      None
+C-
+C-  Called by:  TrexLibrary (TrexLoad), ReadInputFile, Initialize
+C-
+C-  Created:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Added the precomputed terrain terms of solar
+C-              radiation for snowmelt.
+C-
+C-  Revised:
+C-
+C-  Date:
+C-
+C-  Revisions:
+C-
+C----------------------------------------------------------------------*/
+
+//trex general variable declarations
+#include "trex_general_declarations.h"
+
+//trex global variable declarations for water transport
+#include "trex_water_declarations.h"
+
+//trex global variable declarations for sediment transport
+#include "trex_solids_declarations.h"
+
+//trex global variable declarations for chemical transport
+#include "trex_chemical_declarations.h"
+
+//trex global variable declarations for environmental conditions
+#include "trex_environmental_declarations.h"
+
+#ifdef __GLIBC__
+#include <malloc.h>		//glibc allocator statistics (mallinfo2)
+#endif
+
+static double memlast;	//heap in use at the last checkpoint (bytes) (-1 = not measured)
+
+//C
+//C
+			/*******************************************/
+			/*          FUNCTION: HeapInUse            */
+			/*******************************************/
+
+/* Returns the heap in use (bytes), or -1 if the allocator does not report it */
+
+static double HeapInUse()
+{
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+	//local variable declarations
+	struct mallinfo2 info;	//allocator statistics
+
+	//get the allocator statistics
+	info = mallinfo2();
+
+	//return the bytes of chunks in use and of mapped chunks
+	return (double)info.uordblks + (double)info.hblkhd;
+#else
+	//the heap in use is not reported
+	return -1.0;
+#endif
+
+//End of function: Return to caller
+}
+
+//C
+//C
+			/*******************************************/
+			/*      FUNCTION: StartMemoryAccount       */
+			/*******************************************/
+
+/* Starts the heap accounting of a simulation (clears the subsystem totals) */
+
+void StartMemoryAccount()
+{
+	//local variable declarations
+	int
+		isub,		//loop index for subsystem
+		ifam;		//loop index for array family
+
+	//loop over subsystems
+	for(isub=0; isub<NMEMSUBSYSTEMS; isub++)
+	{
+		//no heap is charged to the subsystem
+		memmeasured[isub] = 0.0;
+
+		//loop over array families
+		for(ifam=0; ifam<NMEMFAMILIES; ifam++)
+		{
+			//nothing is estimated
+			memestimate[isub][ifam] = 0.0;
+
+		}	//end loop over array families
+
+	}	//end loop over subsystems
+
+	//heap in use at the start of the simulation
+	memlast = HeapInUse();
+
+//End of function: Return to TrexLoad
+}
+
+//C
+//C
+			/*******************************************/
+			/*        FUNCTION: MemoryCheckpoint       */
+			/*******************************************/
+
+/* Charges the heap growth since the last checkpoint to a subsystem */
+
+void MemoryCheckpoint(int subsystem)
+{
+	//local variable declarations
+	double
+		heap;		//heap in use (bytes)
+
+	//get the heap in use
+	heap = HeapInUse();
+
+	//if the heap is measured
+	if(heap >= 0.0 && memlast >= 0.0)
+	{
+		//charge the growth to the subsystem
+		memmeasured[subsystem] += heap - memlast;
+
+	}	//end if heap >= 0
+
+	//start the next interval
+	memlast = heap;
+
+//End of function: Return to caller
+}
+
+//C
+//C
+			/*******************************************/
+			/*           FUNCTION: ChunkBytes          */
+			/*******************************************/
+
+/* Returns the heap used by one allocation of size bytes (the request, */
+/* the chunk header, and the 16 byte alignment of a 64-bit allocator)  */
+
+static double ChunkBytes(double size)
+{
+	//local variable declarations
+	double
+		chunk;		//chunk size (bytes)
+
+	//round the request and header up to a multiple of 16 bytes
+	chunk = 16.0 * floor((size + 8.0 + 15.0) / 16.0);
+
+	//the smallest chunk is 32 bytes
+	if(chunk < 32.0)
+	{
+		chunk = 32.0;
+	}
+
+	//return the chunk size
+	return chunk;
+
+//End of function: Return to caller
+}
+
+//C
+//C
+			/*******************************************/
+			/*           FUNCTION: GridBytes           */
+			/*******************************************/
+
+/* Returns the bytes of a grid array [row][col] of elements of size bytes */
+
+static double GridBytes(int size)
+{
+	//row pointers and one row of ncols+1 elements for each row
+	return ChunkBytes((double)((nrows+1) * sizeof(void *)))
+		+ (double)nrows * ChunkBytes((double)((ncols+1) * size));
+
+//End of function: Return to EstimateMemory
+}
+
+//C
+//C
+			/*******************************************/
+			/*           FUNCTION: CellBytes           */
+			/*******************************************/
+
+/* Returns the bytes of a cell array [row][col][element] with an element */
+/* array of length elements of size bytes for ncells cells               */
+
+static double CellBytes(int length, int size, double ncells)
+{
+	//a grid of element pointers and the element arrays of the cells
+	return GridBytes(sizeof(void *)) + ncells * ChunkBytes((double)(length * size));
+
+//End of function: Return to EstimateMemory
+}
+
+//C
+//C
+			/*******************************************/
+			/*           FUNCTION: NodeBytes           */
+			/*******************************************/
+
+/* Returns the bytes of a channel array [link][node] of elements of size bytes */
+
+static double NodeBytes(int size)
+{
+	//local variable declarations
+	int
+		link;		//loop index for link
+
+	double
+		bytes;		//bytes of the array
+
+	//no channel arrays without a channel network
+	if(chnopt == 0)
+	{
+		return 0.0;
+	}
+
+	//link pointers
+	bytes = ChunkBytes((double)((nlinks+1) * sizeof(void *)));
+
+	//loop over links
+	for(link=1; link<=nlinks; link++)
+	{
+		//one row of nnodes+1 elements for each link
+		bytes += ChunkBytes((double)((nnodes[link]+1) * size));
+
+	}	//end loop over links
+
+	//return the bytes
+	return bytes;
+
+//End of function: Return to EstimateMemory
+}
+
+//C
+//C
+			/*******************************************/
+			/*         FUNCTION: NodeLayerBytes        */
+			/*******************************************/
+
+/* Returns the bytes of a channel array [link][node][element] with an */
+/* element array of length elements of size bytes for each node       */
+
+static double NodeLayerBytes(int length, int size)
+{
+	//local variable declarations
+	int
+		link;		//loop index for link
+
+	double
+		nodes;		//number of channel nodes
+
+	//no channel arrays without a channel network
+	if(chnopt == 0)
+	{
+		return 0.0;
+	}
+
+	//no nodes are counted
+	nodes = 0.0;
+
+	//loop over links
+	for(link=1; link<=nlinks; link++)
+	{
+		//count the nodes of the link
+		nodes += (double)nnodes[link];
+
+	}	//end loop over links
+
+	//a channel array of element pointers and the element arrays of the nodes
+	return NodeBytes(sizeof(void *)) + nodes * ChunkBytes((double)(length * size));
+
+//End of function: Return to EstimateMemory
+}
+
+//C
+//C
+			/*******************************************/
+			/*        FUNCTION: EstimateMemory         */
+			/*******************************************/
+
+/* Estimates the memory of a simulation from the inputs read by a dry run */
+
+void EstimateMemory()
+{
+	//local variable declarations
+	int
+		isub,		//loop index for subsystem
+		row,		//loop index for row
+		col,		//loop index for column
+		nsolidtypes,	//number of solids arrays of a solids family (nsolids+1, with total solids)
+		ngrids;		//number of grids of a family
+
+	double
+		ncells,		//number of domain cells
+		nrowcells,	//number of domain cells in a row
+		slotbytes,	//bytes of the compact source/direction slots of a float overland array
+		slotbytesd,	//bytes of the compact source/direction slots of a double overland array
+		bytes;		//bytes of a family
+
+	//loop over subsystems
+	for(isub=0; isub<NMEMSUBSYSTEMS; isub++)
+	{
+		//the heap measured while reading the dry run inputs
+		memestimate[isub][MEMFAMINPUT] = memmeasured[isub];
+
+	}	//end loop over subsystems
+
+	//count the domain cells and the slot bytes of an overland array (see AllocateOverlandSlots)
+	ncells = 0.0;
+	slotbytes = GridBytes(sizeof(void *));
+	slotbytesd = GridBytes(sizeof(void *));
+
+	//loop over rows
+	for(row=1; row<=nrows; row++)
+	{
+		//no domain cells are counted in the row
+		nrowcells = 0.0;
+
+		//loop over columns
+		for(col=1; col<=ncols; col++)
+		{
+			//if the cell is in the domain
+			if(imask[row][col] != nodatavalue)
+			{
+				//count the cell
+				nrowcells = nrowcells + 1.0;
+
+			}	//end if imask[][] != nodatavalue
+
+		}	//end loop over columns
+
+		//add the cells and the slot block of the row
+		ncells += nrowcells;
+		slotbytes += ChunkBytes((nrowcells + 1.0) * NOVSLOTS * sizeof(float));
+		slotbytesd += ChunkBytes((nrowcells + 1.0) * NOVSLOTS * sizeof(double));
+
+	}	//end loop over rows
+
+	/****************************************************/
+	/*        Water (Data Group B, InitializeWater,     */
+	/*           InitializeSoilParameters)              */
+	/****************************************************/
+
+	//grids not read by the dry run: elevation (2), storage depth, initial water depth
+	ngrids = 4;
+
+	//initial infiltration depth
+	if(infopt > 0)
+	{
+		ngrids = ngrids + 1;
+	}
+
+	//slope, aspect, and skyview (snowmelt)
+	if(meltopt > 0)
+	{
+		ngrids = ngrids + 3;
+	}
+
+	//initial snow depth (as swe)
+	if(snowopt > 0 || meltopt > 0)
+	{
+		ngrids = ngrids + 1;
+	}
+
+	//InitializeWater: water balance (2), rainfall (5), interception (2), hovnew, dqov, qwovvol
+	ngrids = ngrids + 12;
+
+	//snowfall (5), snowmelt (3), snow water balance (3)
+	if(snowopt > 0)
+	{
+		ngrids = ngrids + 5;
+	}
+
+	if(meltopt > 0)
+	{
+		ngrids = ngrids + 3;
+	}
+
+	if(snowopt > 0 || meltopt > 0)
+	{
+		ngrids = ngrids + 3;
+	}
+
+	//infiltration rate and volume, and soil parameters of the surface layer (InitializeSoilParameters)
+	if(infopt > 0)
+	{
+		ngrids = ngrids + 2 + 3;
+	}
+
+	//soil porosity, critical velocity, and USLE K of the surface layer (InitializeSoilParameters)
+	if(ksim > 1)
+	{
+		ngrids = ngrids + 1;
+
+		if(ersovopt <= 2)
+		{
+			ngrids = ngrids + 2;
+		}
+	}
+
+	//float grids
+	bytes = (double)ngrids * GridBytes(sizeof(float));
+
+	//integer grids: land use (ksim = 1), soil stack layer (ksim = 1), design rain, radar, and storm indexes
+	ngrids = 0;
+
+	if(ksim == 1)
+	{
+		ngrids = ngrids + 1;
+
+		if(infopt > 0)
+		{
+			ngrids = ngrids + 1;
+		}
+	}
+
+	if(rainopt >= 2 && rainopt <= 4)
+	{
+		ngrids = ngrids + 1;
+	}
+
+	//integer grids
+	bytes += (double)ngrids * GridBytes(sizeof(int));
+
+	memestimate[MEMWATER][MEMFAMGRID] = bytes;
+
+	//compact source/direction slots: dqovin, dqovout, dqovinvol, dqovoutvol, sfov
+	memestimate[MEMWATER][MEMFAMSTACKOV] = 5.0 * slotbytes;
+
+	//if channels are simulated
+	if(chnopt == 1)
+	{
+		//initial and final water, hchnew, dqch, qwchvol, sfch
+		bytes = 6.0 * NodeBytes(sizeof(float));
+
+		//bed elevations (2) (not computed by the dry run)
+		if(tplgyopt == 0)
+		{
+			bytes += 2.0 * NodeBytes(sizeof(float));
+		}
+
+		//transmission loss rate and volume, and sediment stack layer (ksim = 1)
+		if(ctlopt > 0)
+		{
+			bytes += 2.0 * NodeBytes(sizeof(float));
+
+			if(ksim == 1)
+			{
+				bytes += NodeBytes(sizeof(int));
+			}
+		}
+
+		memestimate[MEMWATER][MEMFAMNODE] = bytes;
+
+		//flow sources: dqchin, dqchout, dqchinvol, dqchoutvol (11 sources)
+		memestimate[MEMWATER][MEMFAMSTACKCH] = 4.0 * NodeLayerBytes(11, sizeof(float));
+
+	}	//end if chnopt == 1
+
+	//if solids are simulated
+	if(ksim > 1)
+	{
+		/****************************************************/
+		/*       Solids (Data Group C, InitializeSolids)    */
+		/****************************************************/
+
+		//solids arrays include total solids (isolid = 0)
+		nsolidtypes = nsolids + 1;
+
+		//float grids: 4 per solids type and 1 in all
+		ngrids = 4 * nsolidtypes + 1;
+
+		//float grids, and integer grids: land use and soil stack (not read by the dry run), and 1 in all
+		memestimate[MEMSOLIDS][MEMFAMGRID] = (double)ngrids * GridBytes(sizeof(float))
+			+ 3.0 * GridBytes(sizeof(int));
+
+		//cell stack arrays: 10 double and 5 float per solids type, 3 double (the
+		//number of stack layers of a cell is not read by the dry run: the stack
+		//is sized by maxstackov) and 4 float in all
+		bytes = (double)(10 * nsolidtypes + 3) * CellBytes(maxstackov+1, sizeof(double), ncells)
+			+ (double)(5 * nsolidtypes + 4) * CellBytes(maxstackov+1, sizeof(float), ncells);
+
+		//compact source/direction slots: 4 float and 4 double per solids type, 3 float in all
+		bytes += (double)(4 * nsolidtypes + 3) * slotbytes + (double)(4 * nsolidtypes) * slotbytesd;
+
+		memestimate[MEMSOLIDS][MEMFAMSTACKOV] = bytes;
+
+		//if channels are simulated
+		if(chnopt > 0)
+		{
+			//channel arrays: 4 float per solids type, 1 integer in all
+			memestimate[MEMSOLIDS][MEMFAMNODE] = (double)(4 * nsolidtypes) * NodeBytes(sizeof(float))
+				+ NodeBytes(sizeof(int));
+
+			//node stack arrays: 10 double and 5 float per solids type, 3 double and 7 float in all
+			bytes = (double)(10 * nsolidtypes + 3) * NodeLayerBytes(maxstackch+1, sizeof(double))
+				+ (double)(5 * nsolidtypes + 7) * NodeLayerBytes(maxstackch+1, sizeof(float));
+
+			//flow sources (nsources = 10): 4 float and 4 double per solids type, and 3 float in all
+			bytes += (double)(4 * nsolidtypes + 3) * NodeLayerBytes(11, sizeof(float))
+				+ (double)(4 * nsolidtypes) * NodeLayerBytes(11, sizeof(double));
+
+			memestimate[MEMSOLIDS][MEMFAMSTACKCH] = bytes;
+
+		}	//end if chnopt > 0
+
+		//if chemicals are simulated
+		if(ksim > 2)
+		{
+			/****************************************************/
+			/*   Chemicals (Data Group D, InitializeChemical)   */
+			/****************************************************/
+
+			//cell stack arrays: 28 double, 25 float, and 1 float per solids type per chemical
+			bytes = (double)(28 * nchems) * CellBytes(maxstackov+1, sizeof(double), ncells)
+				+ (double)((25 + nsolids) * nchems) * CellBytes(maxstackov+1, sizeof(float), ncells);
+
+			//compact source/direction slots: 4 float and 4 double per chemical
+			bytes += (double)(4 * nchems) * (slotbytes + slotbytesd);
+
+			memestimate[MEMCHEMICAL][MEMFAMSTACKOV] = bytes;
+
+			//if channels are simulated
+			if(chnopt > 0)
+			{
+				//node stack arrays: 28 double, 25 float, and 1 float per solids type per chemical
+				bytes = (double)(28 * nchems) * NodeLayerBytes(maxstackch+1, sizeof(double))
+					+ (double)((25 + nsolids) * nchems) * NodeLayerBytes(maxstackch+1, sizeof(float));
+
+				//flow sources (nsources = 10): 4 float and 4 double per chemical
+				bytes += (double)(4 * nchems) * (NodeLayerBytes(11, sizeof(float))
+					+ NodeLayerBytes(11, sizeof(double)));
+
+				memestimate[MEMCHEMICAL][MEMFAMSTACKCH] = bytes;
+
+			}	//end if chnopt > 0
+
+		}	//end if ksim > 2
+
+	}	//end if ksim > 1
+
+	/****************************************************/
+	/*      Environment (InitializeEnvironment)         */
+	/****************************************************/
+
+	//grids of general conditions (5)
+	memestimate[MEMENVIRONMENT][MEMFAMGRID] = 5.0 * GridBytes(sizeof(float));
+
+	//terrain terms of solar radiation (snowmelt): cell rows and columns (2), terrain and incidence terms (5)
+	if(meltopt > 0)
+	{
+		memestimate[MEMENVIRONMENT][MEMFAMGRID] += 2.0 * ChunkBytes((ncells + 1.0) * sizeof(int))
+			+ 5.0 * ChunkBytes((ncells + 1.0) * sizeof(float));
+	}
+
+	//cell stack arrays of overland conditions (9) (all cells of the grid)
+	memestimate[MEMENVIRONMENT][MEMFAMSTACKOV] = 9.0
+		* CellBytes(maxstackov+1, sizeof(float), (double)nrows * (double)ncols);
+
+	//node stack arrays of channel conditions (9)
+	memestimate[MEMENVIRONMENT][MEMFAMSTACKCH] = 9.0 * NodeLayerBytes(maxstackch+1, sizeof(float));
+
+//End of function: Return to TrexLoad
+}
+
+//C
+//C
+			/*******************************************/
+			/*       FUNCTION: WriteMemoryReport       */
+			/*******************************************/
+
+/* Writes the memory footprint by subsystem (and by array family for a dry run) */
+
+void WriteMemoryReport(FILE *report_fp)
+{
+	//local variable declarations
+	int
+		isub,		//loop index for subsystem
+		ifam;		//loop index for array family
+
+	double
+		subtotal,					//bytes of a subsystem
+		total,						//bytes of all subsystems
+		famtotal[NMEMFAMILIES];		//bytes of an array family
+
+	static const char *subname[NMEMSUBSYSTEMS] =
+		{"general", "water", "solids", "chemical", "environment"};	//subsystem names
+
+	//if a dry run estimated the memory
+	if(dryrunopt > 0)
+	{
+		//write the header
+		fprintf(report_fp, "\n\nMemory Footprint Estimate (MB) (dry run):\n\n");
+		fprintf(report_fp, "  %-12s %12s %12s %12s %12s %12s %12s\n", "subsystem",
+			"grids", "cell/stack", "channel", "node/stack", "input", "total");
+
+		//no bytes are summed
+		total = 0.0;
+
+		for(ifam=0; ifam<NMEMFAMILIES; ifam++)
+		{
+			famtotal[ifam] = 0.0;
+		}
+
+		//loop over subsystems
+		for(isub=0; isub<NMEMSUBSYSTEMS; isub++)
+		{
+			//write the subsystem name
+			fprintf(report_fp, "  %-12s", subname[isub]);
+
+			//no bytes are summed for the subsystem
+			subtotal = 0.0;
+
+			//loop over array families
+			for(ifam=0; ifam<NMEMFAMILIES; ifam++)
+			{
+				//write the bytes of the family (MB)
+				fprintf(report_fp, " %12.3f", memestimate[isub][ifam] / 1048576.0);
+
+				//sum the bytes
+				subtotal += memestimate[isub][ifam];
+				famtotal[ifam] += memestimate[isub][ifam];
+
+			}	//end loop over array families
+
+			//write the subsystem total
+			fprintf(report_fp, " %12.3f\n", subtotal / 1048576.0);
+
+			//sum the bytes of all subsystems
+			total += subtotal;
+
+		}	//end loop over subsystems
+
+		//write the family totals
+		fprintf(report_fp, "  %-12s", "total");
+
+		for(ifam=0; ifam<NMEMFAMILIES; ifam++)
+		{
+			fprintf(report_fp, " %12.3f", famtotal[ifam] / 1048576.0);
+		}
+
+		fprintf(report_fp, " %12.3f\n\n", total / 1048576.0);
+	}
+	else	//else the memory was measured
+	{
+		//write the header
+		fprintf(report_fp, "\n\nMemory Footprint (MB) (heap allocated by the inputs and initialization):\n\n");
+		fprintf(report_fp, "  %-12s %12s\n", "subsystem", "measured");
+
+		//no bytes are summed
+		total = 0.0;
+
+		//loop over subsystems
+		for(isub=0; isub<NMEMSUBSYSTEMS; isub++)
+		{
+			//write the bytes of the subsystem (MB)
+			fprintf(report_fp, "  %-12s %12.3f\n", subname[isub], memmeasured[isub] / 1048576.0);
+
+			//sum the bytes
+			total += memmeasured[isub];
+
+		}	//end loop over subsystems
+
+		//write the total
+		fprintf(report_fp, "  %-12s %12.3f\n\n", "total", total / 1048576.0);
+
+	}	//end if dryrunopt > 0
+
+//End of function: Return to TrexLoad
+}
@@ -0,0 +1,891 @@
+/*----------------------------------------------------------------------
+C-  File:       ModelImage.c
+C-
+C-  Purpose/    Concatenated group of functions to compile and load
+C-  Methods:    a binary model image.  A model image stores the values
+C-              of the gridded model inputs (mask, elevation, soils,
+C-              land use, soil stack, channel links/nodes, initial
+C-              conditions, environmental grids, etc.) in native binary
+C-              form so that later runs skip the ASCII parse and echo
+C-              of every grid value during startup.
+C-
+C-              Image layout (version 1):
+C-
+C-                header     magic, version, byte order check, ksim,
+C-                           nrows, ncols, checksum of the input file,
+C-                           number of grid records, directory offset
+C-                data       grid values (int or float) in the order
+C-                           they are scanned by each grid reader
+C-                directory  one record per grid file: file name,
+C-                           source checksum and size, value type,
+C-                           value count, data offset
+C-
+C-              When a run starts from an image, each source file is
+C-              checksummed again and the run aborts if any source no
+C-              longer matches the image (the image must be recompiled).
+C-              Images are mapped into memory with mmap where available
+C-              and read with fread otherwise.
+C-
+C-  Function
+C-   Listing:   OpenModelImage, CloseModelImage, BeginImageGrid,
+C-              EndImageGrid, ImageScanInt, ImageScanFloat,
+C-              ImageChecksum, OpenOutputFile, TruncateOutputFile
+C-
+C-  Inputs:     imagefile, inputfile
+C-
+C-  Outputs:    None
+C-
+C-  Controls:   imageopt, imagegrid
+C-
+C-  Calls:      BeginIngestGrid, EndIngestGrid, IngestScanInt,
+C-              IngestScanFloat
+C-
+C-  Called by:  trex, ReadInputFile, grid file readers, output
+C-              modules (OpenOutputFile), RestoreResetState
+C-              (TruncateOutputFile)
+C-
+C-  Created:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Output files are opened by OpenOutputFile.
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Grid file values are read through GridIngest (the
+C-              values of a grid are parsed into a buffer at the
+C-              first scan).
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  A model image compilation (-compile) does not open
+C-              (or truncate) the echo, export, mass balance, and
+C-              other output files (OpenOutputFile).
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Added TruncateOutputFile (output files are truncated
+C-              to their sizes after initialization when the model
+C-              is reset by RestoreResetState).
+C-
+C-  Revised:
+C-
+C-  Date:
+C-
+C-  Revisions:
+C-
+C----------------------------------------------------------------------*/
+
+//trex general variable declarations
+#include "trex_general_declarations.h"
+
+#include <stdint.h>		//C library for fixed width integer types
+
+#ifndef WINDOWS
+#include <sys/mman.h>	//POSIX memory mapped files
+#include <sys/stat.h>	//POSIX file status
+#include <fcntl.h>		//POSIX file control
+#include <unistd.h>		//POSIX file close
+#else
+#include <io.h>			//_open, _chsize, _close
+#include <fcntl.h>		//_O_WRONLY
+#endif
+
+#define IMAGEMAGIC "TREXIMG"	//model image file signature
+#define IMAGEVERSION 1			//model image format version (increment when layout changes)
+#define IMAGEBYTEORDER 0x01020304	//byte order check word
+#define IMAGECHUNKSIZE 65536	//read buffer size for source file checksums
+
+//null device for the output files of a model image compilation
+#ifdef WINDOWS
+#define NULLDEVICE "NUL"
+#else
+#define NULLDEVICE "/dev/null"
+#endif
+
+//model image header
+typedef struct
+{
+	char magic[8];				//file signature (IMAGEMAGIC)
+	int32_t version;			//image format version
+	int32_t byteorder;			//byte order check word
+	int32_t ksim;				//simulation type used to compile image
+	int32_t nrows;				//number of grid rows
+	int32_t ncols;				//number of grid columns
+	int32_t pad;				//padding (unused)
+	uint64_t inputchecksum;		//checksum of the model input file
+	uint64_t inputsize;			//size of the model input file (bytes)
+	uint64_t nrecords;			//number of grid records
+	uint64_t diroffset;			//offset of record directory (bytes)
+} imageheader;
+
+//model image grid record (directory entry)
+typedef struct
+{
+	char name[MAXNAMESIZE];		//grid file name (as given in input file)
+	uint64_t checksum;			//checksum of the source grid file
+	uint64_t filesize;			//size of the source grid file (bytes)
+	uint64_t count;				//number of values stored
+	uint64_t offset;			//offset of first value (bytes)
+	int32_t type;				//value type (0 = unset, 1 = int, 2 = float)
+	int32_t pad;				//padding (unused)
+} imagerecord;
+
+static FILE *image_fp = NULL;			//image file pointer (compile)
+static unsigned char *imagebase = NULL;	//start of image in memory (load)
+static size_t imagesize = 0;			//size of image in memory (bytes) (load)
+static imagerecord *records = NULL;		//grid record directory
+static uint64_t nrecords = 0;			//number of grid records
+static uint64_t maxrecords = 0;			//allocated number of grid records (compile)
+static uint64_t imageoffset = 0;		//running offset of image data (bytes) (compile)
+static imagerecord *current = NULL;		//grid record for the grid file being read
+static unsigned char *stream = NULL;	//position of next value in image (load)
+static uint64_t scanned = 0;			//number of values scanned for current grid (load)
+
+//C
+//C
+			/*****************************************/
+			/*       FUNCTION: ImageChecksum         */
+			/*****************************************/
+
+/* Computes a 64-bit FNV-1a checksum and size of a file */
+
+static int ImageChecksum(char *filename, uint64_t *checksum, uint64_t *filesize)
+{
+	//local variable declarations
+	unsigned char
+		*buffer;		//read buffer
+
+	size_t
+		nbytes,			//number of bytes read
+		ibyte;			//loop index for bytes
+
+	uint64_t
+		hash,			//running checksum
+		size;			//running file size
+
+	FILE *source_fp;	//source file pointer
+
+	//open the source file for binary reading
+	source_fp = fopen(filename, "rb");
+
+	//if the file can't be opened
+	if(source_fp == NULL)
+	{
+		//return failure
+		return 0;
+	}
+
+	//allocate memory for read buffer
+	buffer = (unsigned char *)malloc(IMAGECHUNKSIZE * sizeof(unsigned char));
+
+	//set FNV-1a offset basis
+	hash = 14695981039346656037ULL;
+
+	//initialize file size
+	size = 0;
+
+	//while bytes remain in file
+	while((nbytes = fread(buffer, 1, IMAGECHUNKSIZE, source_fp)) > 0)
+	{
+		//loop over bytes in buffer
+		for(ibyte=0; ibyte<nbytes; ibyte++)
+		{
+			//fold byte into checksum (FNV-1a: xor then multiply by FNV prime)
+			hash = (hash ^ buffer[ibyte]) * 1099511628211ULL;
+
+		}	//end loop over bytes
+
+		//increment file size
+		size = size + nbytes;
+
+	}	//end while bytes remain
+
+	//free read buffer
+	free(buffer);
+
+	//close source file
+	fclose(source_fp);
+
+	//assign results
+	*checksum = hash;
+	*filesize = size;
+
+	//return success
+	return 1;
+
+//end of function ImageChecksum
+}
+
+//C
+//C
+			/*****************************************/
+			/*       FUNCTION: ImageError            */
+			/*****************************************/
+
+/* Reports a model image error to file and screen and aborts */
+
+static void ImageError(char *message, char *name)
+{
+	//Write error message to file
+	fprintf(echofile_fp, "\n\n\nModel Image Error:\n");
+	fprintf(echofile_fp,       "  %s\n", message);
+	fprintf(echofile_fp,       "  Image file: %s\n", imagefile);
+	fprintf(echofile_fp,       "  Item: %s\n", name);
+	fprintf(echofile_fp,       "  Recompile the image with: trex %s -compile %s\n", inputfile, imagefile);
+
+	//Write error message to screen
+	printf("\n\n\nModel Image Error:\n");
+	printf(      "  %s\n", message);
+	printf(      "  Image file: %s\n", imagefile);
+	printf(      "  Item: %s\n", name);
+	printf(      "  Recompile the image with: trex %s -compile %s\n", inputfile, imagefile);
+
+	exit(EXIT_FAILURE);		//abort
+
+//end of function ImageError
+}
+
+//C
+//C
+			/*****************************************/
+			/*       FUNCTION: OpenModelImage        */
+			/*****************************************/
+
+/* Opens a model image for compilation (imageopt = 1) or loading (imageopt = 2) */
+
+void OpenModelImage()
+{
+	//local variable declarations
+	imageheader
+		head;				//image header
+
+	uint64_t
+		checksum,			//checksum of input file
+		filesize;			//size of input file (bytes)
+
+	//Open simulation echo file in append mode (closed at the end of Data Group A)
+	echofile_fp = OpenOutputFile(echofile,"a");
+
+	//compute checksum of the model input file
+	if(!ImageChecksum(inputfile, &checksum, &filesize))
+	{
+		//abort
+		ImageError("Can't open input file to compute checksum", inputfile);
+	}
+
+	//if a model image is compiled
+	if(imageopt == 1)
+	{
+		//write message to screen
+		printf("\n\n*********************************\n");
+		printf(	   "*                               *\n");
+		printf(	   "*   Compiling Model Image File  *\n");
+		printf(	   "*                               *\n");
+		printf(	   "*********************************\n\n\n");
+
+		//Set the image file pointer to null
+		image_fp = NULL;
+
+		//Open the image file for binary writing
+		//
+		//Note:  The image is the only file written by a compilation
+		//       (OpenOutputFile discards the other outputs), so it is
+		//       opened directly.
+		//
+		image_fp = fopen(imagefile, "wb");
+
+		//if the image file pointer is null, abort execution
+		if(image_fp == NULL)
+		{
+			//abort
+			ImageError("Can't create model image file", imagefile);
+		}
+
+		//write a blank header (completed when the image is closed)
+		memset(&head, 0, sizeof(imageheader));
+		fwrite(&head, sizeof(imageheader), 1, image_fp);
+
+		//set the data offset to the end of the header
+		imageoffset = sizeof(imageheader);
+
+		//initialize the record directory
+		nrecords = 0;
+		maxrecords = 64;
+		records = (imagerecord *)malloc(maxrecords * sizeof(imagerecord));
+	}
+	else if(imageopt == 2)	//else if the run starts from a model image
+	{
+		//write message to screen
+		printf("\n\n*******************************\n");
+		printf(	   "*                             *\n");
+		printf(	   "*   Loading Model Image File  *\n");
+		printf(	   "*                             *\n");
+		printf(	   "*******************************\n\n\n");
+
+#ifdef WINDOWS
+		{
+			//Set the image file pointer to null
+			image_fp = NULL;
+
+			//Open the image file for binary reading
+			image_fp = fopen(imagefile, "rb");
+
+			//if the image file pointer is null, abort execution
+			if(image_fp == NULL)
+			{
+				//abort
+				ImageError("Can't open model image file", imagefile);
+			}
+
+			//determine image size
+			fseek(image_fp, 0, SEEK_END);
+			imagesize = (size_t)ftell(image_fp);
+			fseek(image_fp, 0, SEEK_SET);
+
+			//allocate memory for image and read it
+			imagebase = (unsigned char *)malloc(imagesize);
+
+			if(imagebase == NULL || fread(imagebase, 1, imagesize, image_fp) != imagesize)
+			{
+				//abort
+				ImageError("Can't read model image file", imagefile);
+			}
+
+			//close the image file
+			fclose(image_fp);
+			image_fp = NULL;
+		}
+#else
+		{
+			int
+				fd;			//image file descriptor
+
+			struct stat
+				status;		//image file status
+
+			//Open the image file for reading
+			fd = open(imagefile, O_RDONLY);
+
+			//if the image file can't be opened, abort execution
+			if(fd < 0 || fstat(fd, &status) != 0)
+			{
+				//abort
+				ImageError("Can't open model image file", imagefile);
+			}
+
+			//set image size
+			imagesize = (size_t)status.st_size;
+
+			//map the image into memory (read only)
+			imagebase = (unsigned char *)mmap(NULL, imagesize, PROT_READ, MAP_PRIVATE, fd, 0);
+
+			//if the image could not be mapped
+			if(imagebase == (unsigned char *)MAP_FAILED)
+			{
+				//abort
+				ImageError("Can't map model image file into memory", imagefile);
+			}
+
+			//close the file descriptor (mapping remains valid)
+			close(fd);
+		}
+#endif
+
+		//if the image is too small to hold a header
+		if(imagesize < sizeof(imageheader))
+		{
+			//abort
+			ImageError("Model image file is truncated", imagefile);
+		}
+
+		//copy header from image
+		memcpy(&head, imagebase, sizeof(imageheader));
+
+		//Check image header against this build and input file...
+		//
+		//if the signature, version, or byte order do not match
+		if(strncmp(head.magic, IMAGEMAGIC, 8) != 0 || head.version != IMAGEVERSION
+			|| head.byteorder != IMAGEBYTEORDER)
+		{
+			//abort
+			ImageError("File is not a model image for this version of TREX", imagefile);
+		}
+
+		//if the input file has changed since the image was compiled
+		if(head.inputchecksum != checksum || head.inputsize != filesize)
+		{
+			//abort
+			ImageError("Input file has changed since the model image was compiled", inputfile);
+		}
+
+		//if the simulation type or grid dimensions do not match
+		if(head.ksim != ksim || head.nrows != nrows || head.ncols != ncols)
+		{
+			//abort
+			ImageError("Model image ksim, nrows, or ncols differ from input file", inputfile);
+		}
+
+		//if the directory lies outside the image
+		if(head.diroffset + head.nrecords * sizeof(imagerecord) > imagesize)
+		{
+			//abort
+			ImageError("Model image file is truncated", imagefile);
+		}
+
+		//set the record directory
+		nrecords = head.nrecords;
+		records = (imagerecord *)(imagebase + head.diroffset);
+
+		//Echo image characteristics to file
+		fprintf(echofile_fp, "\n\nModel Image File: %s\n", imagefile);
+		fprintf(echofile_fp,     "   Image Version = %d\n", (int)head.version);
+		fprintf(echofile_fp,     "   Grid Records = %d\n", (int)nrecords);
+		fprintf(echofile_fp,     "   Grid values read from image are not echoed.\n\n");
+
+	}	//end if imageopt == 1
+
+	//no grid is being read
+	current = NULL;
+	imagegrid = 0;
+
+	//Close echo file
+	fclose(echofile_fp);
+
+//end of function OpenModelImage
+}
+
+//C
+//C
+			/*****************************************/
+			/*       FUNCTION: CloseModelImage       */
+			/*****************************************/
+
+/* Completes (compile) or releases (load) a model image */
+
+void CloseModelImage()
+{
+	//local variable declarations
+	imageheader
+		head;			//image header
+
+	char
+		pad[8];			//padding bytes
+
+	uint64_t
+		npad;			//number of padding bytes
+
+	//Open simulation echo file in append mode
+	echofile_fp = OpenOutputFile(echofile,"a");
+
+	//if a model image is compiled
+	if(imageopt == 1)
+	{
+		//build the image header
+		memset(&head, 0, sizeof(imageheader));
+		memcpy(head.magic, IMAGEMAGIC, 8);
+		head.version = IMAGEVERSION;
+		head.byteorder = IMAGEBYTEORDER;
+		head.ksim = ksim;
+		head.nrows = nrows;
+		head.ncols = ncols;
+
+		//recompute the input file checksum
+		ImageChecksum(inputfile, &head.inputchecksum, &head.inputsize);
+
+		//align the directory on an 8-byte boundary
+		npad = (8 - imageoffset % 8) % 8;
+		memset(pad, 0, sizeof(pad));
+		fwrite(pad, 1, (size_t)npad, image_fp);
+		imageoffset = imageoffset + npad;
+
+		//set directory offset and number of records
+		head.diroffset = imageoffset;
+		head.nrecords = nrecords;
+
+		//write the record directory
+		fwrite(records, sizeof(imagerecord), (size_t)nrecords, image_fp);
+
+		//rewrite the completed header
+		fseek(image_fp, 0, SEEK_SET);
+		fwrite(&head, sizeof(imageheader), 1, image_fp);
+
+		//if a write error occurred
+		if(ferror(image_fp))
+		{
+			//abort
+			ImageError("Error writing model image file", imagefile);
+		}
+
+		//close the image file
+		fclose(image_fp);
+		image_fp = NULL;
+
+		//Echo image summary to file
+		fprintf(echofile_fp, "\n\nModel Image File: %s\n", imagefile);
+		fprintf(echofile_fp,     "   Image Version = %d\n", IMAGEVERSION);
+		fprintf(echofile_fp,     "   Grid Records = %d\n", (int)nrecords);
+		fprintf(echofile_fp,     "   Image Size = %.0f (bytes)\n\n", (double)(imageoffset + nrecords * sizeof(imagerecord)));
+
+		//Write image summary to screen
+		printf("Model image compiled: %s (%d grid records)\n", imagefile, (int)nrecords);
+
+		//free the record directory
+		free(records);
+	}
+	else if(imageopt == 2)	//else if the run started from a model image
+	{
+#ifdef WINDOWS
+		//free image memory
+		free(imagebase);
+#else
+		//unmap the image
+		munmap(imagebase, imagesize);
+#endif
+	}	//end if imageopt == 1
+
+	//reset image state
+	records = NULL;
+	nrecords = 0;
+	imagebase = NULL;
+	current = NULL;
+	imagegrid = 0;
+
+	//Close echo file
+	fclose(echofile_fp);
+
+//end of function CloseModelImage
+}
+
+//C
+//C
+			/*****************************************/
+			/*       FUNCTION: BeginImageGrid        */
+			/*****************************************/
+
+/* Starts a grid record for a grid file.  Returns 1 when the grid
+   values will be read from the model image, 0 when they are read
+   from the grid file itself */
+
+int BeginImageGrid(char *gridfile)
+{
+	//local variable declarations
+	uint64_t
+		irecord,		//loop index for grid records
+		checksum,		//checksum of grid file
+		filesize;		//size of grid file (bytes)
+
+	//no grid record is active
+	current = NULL;
+	imagegrid = 0;
+
+	//start the ingestion of grid file values
+	BeginIngestGrid();
+
+	//if no model image is used
+	if(imageopt == 0)
+	{
+		//values are read from the grid file
+		return 0;
+	}
+
+	//compute checksum of the grid (source) file
+	if(!ImageChecksum(gridfile, &checksum, &filesize))
+	{
+		//abort
+		ImageError("Can't open grid file to compute checksum", gridfile);
+	}
+
+	//search the directory for this grid file
+	for(irecord=0; irecord<nrecords; irecord++)
+	{
+		//if the record matches the grid file name
+		if(strncmp(records[irecord].name, gridfile, MAXNAMESIZE) == 0)
+		{
+			//this grid record exists
+			current = &records[irecord];
+
+			//break out of search
+			break;
+
+		}	//end if record matches
+
+	}	//end loop over records
+
+	//if a model image is compiled
+	if(imageopt == 1)
+	{
+		//if the grid file was already compiled (grids read more than once are stored once)
+		if(current != NULL)
+		{
+			//do not store values again
+			current = NULL;
+
+			//values are read from the grid file
+			return 0;
+
+		}	//end if current != NULL
+
+		//if more directory space is needed
+		if(nrecords == maxrecords)
+		{
+			//double the directory size
+			maxrecords = 2 * maxrecords;
+			records = (imagerecord *)realloc(records, maxrecords * sizeof(imagerecord));
+
+		}	//end if nrecords == maxrecords
+
+		//start a new grid record
+		current = &records[nrecords];
+		nrecords = nrecords + 1;
+
+		//set grid record values
+		memset(current, 0, sizeof(imagerecord));
+		strncpy(current->name, gridfile, MAXNAMESIZE-1);
+		current->checksum = checksum;
+		current->filesize = filesize;
+		current->offset = imageoffset;
+
+		//values are read from the grid file (and stored in the image)
+		return 0;
+	}
+	else	//else the run starts from a model image
+	{
+		//if the grid file is not in the image
+		if(current == NULL)
+		{
+			//abort
+			ImageError("Grid file is not stored in the model image", gridfile);
+		}
+
+		//if the grid file has changed since the image was compiled
+		if(current->checksum != checksum || current->filesize != filesize)
+		{
+			//abort
+			ImageError("Grid file has changed since the model image was compiled", gridfile);
+		}
+
+		//if the grid values lie outside the image
+		if(current->offset + current->count * 4 > imagesize)
+		{
+			//abort
+			ImageError("Model image file is truncated", gridfile);
+		}
+
+		//position the value stream at the start of this grid
+		stream = imagebase + current->offset;
+		scanned = 0;
+
+		//values are read from the image
+		imagegrid = 1;
+
+		return 1;
+
+	}	//end if imageopt == 1
+
+//end of function BeginImageGrid
+}
+
+//C
+//C
+			/*****************************************/
+			/*       FUNCTION: EndImageGrid          */
+			/*****************************************/
+
+/* Completes the grid record for the grid file just read */
+
+void EndImageGrid()
+{
+	//if values were read from the image
+	if(imagegrid == 1)
+	{
+		//if the reader did not consume every stored value
+		if(scanned != current->count)
+		{
+			//abort
+			ImageError("Grid value count in model image does not match reader", current->name);
+		}
+	}
+
+	//no grid record is active
+	current = NULL;
+	imagegrid = 0;
+
+	//release the ingested grid file values
+	EndIngestGrid();
+
+//end of function EndImageGrid
+}
+
+//C
+//C
+			/*****************************************/
+			/*       FUNCTION: ImageScanValue        */
+			/*****************************************/
+
+/* Common path for ImageScanInt and ImageScanFloat.  The value is
+   already read from the grid file when values are not read from
+   the image */
+
+static void ImageScanValue(void *value, int type)
+{
+	//if values are read from the image
+	if(imagegrid == 1)
+	{
+		//if the stored value type differs or all values were consumed
+		if(current->type != type || scanned >= current->count)
+		{
+			//abort
+			ImageError("Grid values in model image do not match reader", current->name);
+		}
+
+		//copy value from image (int and float are both 4 bytes)
+		memcpy(value, stream, 4);
+
+		//advance the value stream
+		stream = stream + 4;
+		scanned = scanned + 1;
+	}
+	else if(current != NULL)	//else if a model image is compiled for this grid
+	{
+		//if this is the first value of the grid
+		if(current->type == 0)
+		{
+			//set the record value type
+			current->type = type;
+		}
+		else if(current->type != type)	//else if the reader mixed value types
+		{
+			//abort
+			ImageError("Grid reader mixes integer and float values", current->name);
+		}
+
+		//store the value in the image
+		fwrite(value, 4, 1, image_fp);
+
+		//increment value count and data offset
+		current->count = current->count + 1;
+		imageoffset = imageoffset + 4;
+
+	}	//end if imagegrid == 1
+
+//end of function ImageScanValue
+}
+
+//C
+//C
+			/*****************************************/
+			/*       FUNCTION: ImageScanInt          */
+			/*****************************************/
+
+/* Reads the next integer grid value from the model image or grid file */
+
+void ImageScanInt(FILE *grid_fp, int *value)
+{
+	//if values are read from the grid file
+	if(imagegrid == 0)
+	{
+		//read value from grid file
+		IngestScanInt(grid_fp, value);
+	}
+
+	//read from (or store in) the model image
+	ImageScanValue(value, 1);
+
+//end of function ImageScanInt
+}
+
+//C
+//C
+			/*****************************************/
+			/*       FUNCTION: ImageScanFloat        */
+			/*****************************************/
+
+/* Reads the next float grid value from the model image or grid file */
+
+void ImageScanFloat(FILE *grid_fp, float *value)
+{
+	//if values are read from the grid file
+	if(imagegrid == 0)
+	{
+		//read value from grid file
+		IngestScanFloat(grid_fp, value);
+	}
+
+	//read from (or store in) the model image
+	ImageScanValue(value, 2);
+
+//end of function ImageScanFloat
+}
+
+//C
+//C
+			/*****************************************/
+			/*       FUNCTION: OpenOutputFile        */
+			/*****************************************/
+
+/* Opens an output file (a model image compilation writes to the null device) */
+
+FILE *OpenOutputFile(char *name, char *mode)
+{
+	//Note:  Compiling a model image (-compile) reads the inputs and
+	//       initializes the model, but no simulation is run.  The echo,
+	//       export, mass balance, and other output files of a previous
+	//       run in the same directory are not opened (or truncated).
+	//
+	//if a model image is compiled
+	if(imageopt == 1)
+	{
+		//output of the compilation is discarded
+		return fopen(NULLDEVICE, mode);
+	}
+
+	//open the output file
+	return fopen(name, mode);
+
+//End of function: Return to calling module
+}
+
+//C
+//C
+			/*****************************************/
+			/*     FUNCTION: TruncateOutputFile      */
+			/*****************************************/
+
+/* Sets the size of an output file (bytes) */
+
+void TruncateOutputFile(char *name, long size)
+{
+#ifdef WINDOWS
+	//local variable declarations
+	int
+		filehandle;	//file handle
+
+	//open the file
+	filehandle = _open(name, _O_WRONLY);
+
+	//if the file was opened
+	if(filehandle >= 0)
+	{
+		//set the size of the file and close it
+		_chsize(filehandle, size);
+		_close(filehandle);
+
+	}	//end if filehandle >= 0
+#else
+	//set the size of the file
+	truncate(name, (off_t)size);
+#endif
+
+//End of function: Return to calling module
+}
@@ -3,11 +3,14 @@ C-  Function:	NewStateChemical.c
 C-
 C-	Purpose/	NewStateChemical is called to store new chemical
 C-	Methods:	concentrations for use during the next (upcoming)
-C-				time step (t + dt).
+C-				time step (t + dt).  The current and new concentration
+C-				arrays are swapped (not copied).
 C-
 C-	Inputs:		None
 C-
-C-	Outputs:	None
+C-	Outputs:	cchemov[][][][], cchemovnew[][][][], cchemch[][][][],
+C-				cchemchnew[][][][], mincchemov1[], maxcchemov1[],
+C-				mincchemch1[], maxcchemch1[]
 C-
 C-	Controls:	chnopt
 C-
@@ -38,6 +41,12 @@ C-
 C-	Revisions:  Added a loop over subsurface layers to update chemical
 C-              concentrations for overland plane and channels.
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	State swapped with new state by pointer exchange.
+C-
 C-	Revised:
 C-
 C-	Date:	
@@ -66,7 +75,25 @@ void NewStateChemical()
 		ilayer;		//loop index for surface layer
 
 	float
-		cbed;		//concentration in surface soil or sediment in mg/kg
+		cbed,		//concentration in surface soil or sediment in mg/kg
+		****swap;	//pointer used to swap current and new concentration arrays
+
+	//Note:  OverlandChemicalConcentration and ChannelChemicalConcentration
+	//       compute new concentrations for the water column and every
+	//       occupied layer of every cell and node at each time step, so
+	//       the current (t) and new (t + dt) concentration arrays are
+	//       swapped instead of copied.  Unoccupied layers are the same
+	//       in both arrays (see InitializeChemical, PopSoilStack, and
+	//       PopSedimentStack).  The minimum and maximum water column
+	//       concentrations are updated when new concentrations are
+	//       computed.  The surface layer minimum and maximum (mg/kg)
+	//       depend on the new total solids concentrations and are
+	//       updated here.
+	//
+	//set overland chemical concentrations (g/m3) (for use at time t + dt)
+	swap = cchemov;
+	cchemov = cchemovnew;
+	cchemovnew = swap;
 
 	//Loop over rows
 	for(i=1; i<=nrows; i++)
@@ -83,16 +110,6 @@ void NewStateChemical()
 				//loop over chemicals
 				for(ichem=1; ichem<=nchems; ichem++)
 				{
-					//set overland chemical concentration in water column (g/m3) (for use at time t + dt)
-					cchemov[ichem][i][j][0] = cchemovnew[ichem][i][j][0];
-
-					//Determine the minimum and the maximum chemical concentrations in water (g/m3)
-					mincchemov0[ichem] = Min(mincchemov0[ichem],cchemov[ichem][i][j][0]);
-					maxcchemov0[ichem] = Max(maxcchemov0[ichem],cchemov[ichem][i][j][0]);
-
-					//set overland chemical concentration in surface sediment (g/m3) (for use at time t + dt)
-					cchemov[ichem][i][j][ilayer] = cchemovnew[ichem][i][j][ilayer];
-
 					//convert surface soil concentration from g/m3 to mg/kg
 					cbed = (float)(cchemov[ichem][i][j][ilayer] / csedov[0][i][j][ilayer] * 1.0e6);
 
@@ -102,19 +119,6 @@ void NewStateChemical()
 
 				}	//end loop over chemicals
 
-				//loop over subsurface layers (in reverse order: top down)
-				for(ilayer=nstackov[i][j]-1; ilayer>=1; ilayer--)
-				{
-					//loop over chemicals
-					for(ichem=1; ichem<=nchems; ichem++)
-					{
-						//set overland chemical concentration in subsurface sediment (g/m3) (for use at time t + dt)
-						cchemov[ichem][i][j][ilayer] = cchemovnew[ichem][i][j][ilayer];
-
-					}	//end loop over chemicals
-
-				}	//end loop over subsurface layers
-
 			}	//end if imask[][] != nodatavalue
 
 		}	//end loop over columns
@@ -124,6 +128,11 @@ void NewStateChemical()
 	//if channels are simulated
 	if(chnopt > 0)
 	{
+		//set channel chemical concentrations (g/m3) (for use at time t + dt)
+		swap = cchemch;
+		cchemch = cchemchnew;
+		cchemchnew = swap;
+
 		//Loop over links
 		for(i=1; i<=nlinks; i++)
 		{
@@ -136,16 +145,6 @@ void NewStateChemical()
 				//loop over chemicals
 				for(ichem=1; ichem<=nchems; ichem++)
 				{
-					//set channel chemical concentration in water column (g/m3) (for use at time t + dt)
-					cchemch[ichem][i][j][0] = cchemchnew[ichem][i][j][0];
-
-					//Determine the minimum and the maximum chemical concentrations in water (g/m3)
-					mincchemch0[ichem] = Min(mincchemch0[ichem],cchemch[ichem][i][j][0]);
-					maxcchemch0[ichem] = Max(maxcchemch0[ichem],cchemch[ichem][i][j][0]);
-
-					//set channel chemical concentration in surface sediment (g/m3) (for use at time t + dt)
-					cchemch[ichem][i][j][ilayer] = cchemchnew[ichem][i][j][ilayer];
-
 					//convert surface sediment concentration from g/m3 to mg/kg
 					cbed = (float)(cchemch[ichem][i][j][ilayer] / csedch[0][i][j][ilayer] * 1.0e6);
 
@@ -155,19 +154,6 @@ void NewStateChemical()
 
 				}	//end loop over chemicals
 
-				//loop over subsurface layers (in reverse order: top down)
-				for(ilayer=nstackch[i][j]-1; ilayer>=1; ilayer--)
-				{
-					//loop over chemicals
-					for(ichem=1; ichem<=nchems; ichem++)
-					{
-						//set channel chemical concentration in subsurface sediment (g/m3) (for use at time t + dt)
-						cchemch[ichem][i][j][ilayer] = cchemchnew[ichem][i][j][ilayer];
-
-					}	//end loop over chemicals
-
-				}	//end loop over subsurface layers
-
 			}	//end loop over nodes
 
 		}	//end loop over links
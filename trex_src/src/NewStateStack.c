@@ -9,10 +9,12 @@ C-	Inputs:		None
 C-
 C-	Outputs:	None
 C-
-C-	Controls:	ksim, popovflag, pushovflag, chnopt, popchflag, pushchflag
+C-	Controls:	ksim, npopov, npushov, chnopt, npopch, npushch,
+C-				nstackevents
 C-
 C-	Calls:		PopSoilStack, PushSoilStack,
-C-              PopSedimentStack, PushSedimentStack
+C-              PopSedimentStack, PushSedimentStack, WriteStackEvents,
+C-              StreamStackMass
 C-
 C-	Called by:	NewState
 C-
@@ -29,6 +31,21 @@ C-              Denver, CO 80225
 C-
 C-	Date:		20-MAR-2004
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Replaced stack pop/push flags with work lists of
+C-              flagged cells and nodes.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	The bed mass moved by the push and pop of the stacks
+C-              is streamed to the mass balance monitor
+C-              (StreamStackMass).
+C-
 C-	Revised:
 C-
 C-	Date:	
@@ -78,29 +95,41 @@ void NewStateStack()
 
 	}	//end loop over rows
 
-	//check the pop and push flags for the overland soil stack
+	//check the pop and push lists for the overland soil stack
 	//
-	//if the soil stack pop (upward re-indexing) flag is raised
-	if(popovflag == 1)
+	//if any cells are listed for soil stack pop (upward re-indexing)
+	if(npopov > 0)
 	{
-		//Pop the soil stack
+		//remove the stack masses of the listed cells from the running soil storage
+		StreamStackMass(0, popovrow, popovcol, npopov, -1.0);
+
+		//Pop the soil stack (listed cells only)
 		PopSoilStack();
 
-		//Reset (lower) the soil pop flag
-		popovflag = 0;
+		//add the popped stack masses of the listed cells to the running soil storage
+		StreamStackMass(0, popovrow, popovcol, npopov, 1.0);
 
-	}	//end if popovflag == 1
+		//Clear the soil pop list
+		npopov = 0;
 
-	//if the soil stack push (downward re-indexing) flag is raised
-	if(pushovflag == 1)
+	}	//end if npopov > 0
+
+	//if any cells are listed for soil stack push (downward re-indexing)
+	if(npushov > 0)
 	{
-		//Push the soil stack
+		//remove the stack masses of the listed cells from the running soil storage
+		StreamStackMass(0, pushovrow, pushovcol, npushov, -1.0);
+
+		//Push the soil stack (listed cells only)
 		PushSoilStack();
 
-		//Reset (lower) the soil push flag
-		pushovflag = 0;
+		//add the pushed stack masses of the listed cells to the running soil storage
+		StreamStackMass(0, pushovrow, pushovcol, npushov, 1.0);
 
-	}	//end if pushovflag == 1
+		//Clear the soil push list
+		npushov = 0;
+
+	}	//end if npushov > 0
 
 	//if channels are simulated
 	if(chnopt > 0)
@@ -121,31 +150,51 @@ void NewStateStack()
 
 		}	//end loop over links
 
-		//check the pop and push flags for the channel sediment stack
+		//check the pop and push lists for the channel sediment stack
 		//
-		//if the sediment stack pop (upward re-indexing) flag is raised
-		if(popchflag == 1)
+		//if any nodes are listed for sediment stack pop (upward re-indexing)
+		if(npopch > 0)
 		{
-			//Pop the sediment stack
+			//remove the stack masses of the listed nodes from the running sediment storage
+			StreamStackMass(1, popchlink, popchnode, npopch, -1.0);
+
+			//Pop the sediment stack (listed nodes only)
 			PopSedimentStack();
 
-			//Reset (lower) the sediment pop flag
-			popchflag = 0;
+			//add the popped stack masses of the listed nodes to the running sediment storage
+			StreamStackMass(1, popchlink, popchnode, npopch, 1.0);
 
-		}	//end if popchflag == 1
+			//Clear the sediment pop list
+			npopch = 0;
 
-		//if the sediment stack push (downward re-indexing) flag is raised
-		if(pushchflag == 1)
+		}	//end if npopch > 0
+
+		//if any nodes are listed for sediment stack push (downward re-indexing)
+		if(npushch > 0)
 		{
-			//Push the sediment stack
+			//remove the stack masses of the listed nodes from the running sediment storage
+			StreamStackMass(1, pushchlink, pushchnode, npushch, -1.0);
+
+			//Push the sediment stack (listed nodes only)
 			PushSedimentStack();
 
-			//Reset (lower) the sediment push flag
-			pushchflag = 0;
+			//add the pushed stack masses of the listed nodes to the running sediment storage
+			StreamStackMass(1, pushchlink, pushchnode, npushch, 1.0);
 
-		}	//end if pushchflag == 1
+			//Clear the sediment push list
+			npushch = 0;
+
+		}	//end if npushch > 0
 
 	}	//end if chnopt > 0
 
+	//if any stack events were logged during this time step
+	if(nstackevents > 0)
+	{
+		//Write (and clear) the stack event log
+		WriteStackEvents();
+
+	}	//end if nstackevents > 0
+
 //End of function: Return to NewState
 }
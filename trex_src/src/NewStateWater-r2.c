@@ -3,13 +3,15 @@ C-  Function:	NewStateWater.c
 C-
 C-	Purpose/	
 C-	Methods:	NewState is called to store new water depths for use
-C-              during the next (upcoming) time step (t + dt).
+C-              during the next (upcoming) time step (t + dt).  The
+C-              current and new depth grids are swapped (not copied).
 C-
 C-	Inputs:		None
 C-
-C-	Outputs:	None
+C-	Outputs:	hov[][], hovnew[][], sweov[][], sweovnew[][],
+C-              hch[][], hchnew[][]
 C-
-C-	Controls:	ksim, chnopt
+C-	Controls:	snowopt, meltopt, chnopt
 C-
 C-	Calls:		None
 C-
@@ -37,6 +39,12 @@ C-	Date:		18-DEC-2006
 C-
 C-	Revisions:	Added code for snow hydrology.
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	State swapped with new state by pointer exchange.
+C-
 C-	Revised:
 C-
 C-	Date:	
@@ -53,65 +61,46 @@ C---------------------------------------------------------------------*/
 
 void NewStateWater()
 {
+	//local variable declarations/definitions
+	float
+		**swap;		//pointer used to swap current and new depth grids
+
 	//Set overland depth conditions...
 	//
-	//Loop over rows
-	for(i=1; i<=nrows; i++)
-	{
-		//Loop over columns
-		for(j=1; j<=ncols; j++)
-		{
-			//if the cell is in the domain (is not null)
-			if(imask[i][j] != nodatavalue)
-			{
-				//set overland depths (m) (for use at time t + dt)
-				hov[i][j] = hovnew[i][j];
-
-				//Determine the minimum and the maximum water depths
-				minhovdepth = Min(minhovdepth,hov[i][j]);
-				maxhovdepth = Max(maxhovdepth,hov[i][j]);
-
-				//Set snow pack (swe) depth conditions...
-				//
-				//if snow hydrology is simulated (snowfall or snowmelt)
-				if(snowopt > 0 || meltopt > 0)
-				{
-					//set swe depths (m) (for use at time t + dt)
-					sweov[i][j] = sweovnew[i][j];
-
-					//Determine the minimum and the maximum snowpack (swe) depths
-					minsweovdepth = Min(minsweovdepth,sweov[i][j]);
-					maxsweovdepth = Max(maxsweovdepth,sweov[i][j]);
-
-				}	//end if snowopt > 0 or meltopt > 0
-
-			}	//end if imask[][] != nodatavalue
+	//Note:  OverlandWaterDepth and ChannelWaterDepth compute new
+	//       depths for every cell and node at each time step, so the
+	//       current (t) and new (t + dt) depth grids are swapped
+	//       instead of copied.  After the swap, the new grid holds
+	//       the old depths until they are overwritten.  The minimum
+	//       and maximum depths are updated when new depths are
+	//       computed (in OverlandWaterDepth and ChannelWaterDepth).
+	//
+	//set overland depths (m) (for use at time t + dt)
+	swap = hov;
+	hov = hovnew;
+	hovnew = swap;
 
-		}	//end loop over columns
+	//Set snow pack (swe) depth conditions...
+	//
+	//if snow hydrology is simulated (snowfall or snowmelt)
+	if(snowopt > 0 || meltopt > 0)
+	{
+		//set swe depths (m) (for use at time t + dt)
+		swap = sweov;
+		sweov = sweovnew;
+		sweovnew = swap;
 
-	}	//end loop over rows
+	}	//end if snowopt > 0 or meltopt > 0
 
 	//if channels are simulated
 	if(chnopt > 0)
 	{
 		//Set channel depth conditions...
 		//
-		//Loop over links
-		for(i=1; i<=nlinks; i++)
-		{
-			//Loop over nodes
-			for(j=1; j<=nnodes[i]; j++)
-			{
-				//set channel depths (m) (for use at time t + dt)
-				hch[i][j] = hchnew[i][j];
-
-				//Determine the minimum and the maximum water depths in channels
-				minhchdepth = Min(minhchdepth,hch[i][j]);
-				maxhchdepth = Max(maxhchdepth,hch[i][j]);
-
-			}	//end loop over nodes
-
-		}	//end loop over links
+		//set channel depths (m) (for use at time t + dt)
+		swap = hch;
+		hch = hchnew;
+		hchnew = swap;
 
 	}	//end if chnopt > 0
 
@@ -42,6 +42,30 @@ C-              loop over loads and reporting stations and make direct
 C-              assignment of values.  Also added overland distributed
 C-              chemical loads.
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Overland source/direction slots are addressed
+C-              through OVSLOT (compact overland slot storage).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	The kernel takes a range of chemical types
+C-              (ichemfirst to ichemlast) so that each chemical type
+C-              can be computed as a separate task (see
+C-              SpeciesTasks).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Load areas are stored for the load cells only
+C-              (cwdovarea[ichem][iload][icell]) instead of a full
+C-              grid for each load.
+C-
 C-	Revised:
 C-
 C-	Date:	
@@ -65,7 +89,7 @@ C----------------------------------------------------------------------*/
 //trex global variable declarations for environmental conditions
 #include "trex_environmental_declarations.h"
 
-void OverlandChemicalAdvection()
+void OverlandChemicalAdvection(int ichemfirst, int ichemlast)
 {
 	//local variable declarations/definitions
 	int
@@ -97,7 +121,7 @@ void OverlandChemicalAdvection()
 	//Assignments for point source and distributed chemical loads
 	//
 	//loop over number of chemical types
-	for(ichem=1; ichem<=nchems; ichem++)
+	for(ichem=ichemfirst; ichem<=ichemlast; ichem++)
 	{
 		//Note:  The advective influx and outflux terms for each
 		//       chemical type must be initialized in order to sum
@@ -114,10 +138,10 @@ void OverlandChemicalAdvection()
 				if(imask[i][j] != nodatavalue)
 				{
 					//Initialize gross advection influx array for source zero
-					advchemovinflux[ichem][i][j][0] = 0.0;
+					advchemovinflux[ichem][i][j][OVSLOT(0)] = 0.0;
 
 					//Initialize gross advection outflow array for source zero
-					advchemovoutflux[ichem][i][j][0] = 0.0;
+					advchemovoutflux[ichem][i][j][OVSLOT(0)] = 0.0;
 
 				}	//end if imask[][] != nodatavalue
 
@@ -152,7 +176,7 @@ void OverlandChemicalAdvection()
 				//Compute load from flow and concentration...
 				//
 				//if the point source flow is greater >= zero (a source)
-				if(dqovin[i][j][0] >= 0.0)
+				if(dqovin[i][j][OVSLOT(0)] >= 0.0)
 				{
 					//set the inflowing chemical concentration
 					cin[0] = cwpovinterp[ichem][k];
@@ -165,7 +189,7 @@ void OverlandChemicalAdvection()
 				}	//end if dqovin >= 0.0
 
 				//compute the load value (g/s)  (could be a source or a sink)
-				load = dqovin[i][j][0] * cin[0]
+				load = dqovin[i][j][OVSLOT(0)] * cin[0]
 					* (float)(1000.0 / 86400.0);
 
 			}	//end if cwpovopt = 0
@@ -174,13 +198,13 @@ void OverlandChemicalAdvection()
 			if(load >= 0.0)
 			{
 				//compute the inflowing chemical flux (g/s)
-				advchemovinflux[ichem][i][j][0] = advchemovinflux[ichem][i][j][0]
+				advchemovinflux[ichem][i][j][OVSLOT(0)] = advchemovinflux[ichem][i][j][OVSLOT(0)]
 					+ load;
 			}
 			else	//else the load is negative (a sink)
 			{
 				//compute the outflowing chemical flux (g/s)
-				advchemovoutflux[ichem][i][j][0] = advchemovoutflux[ichem][i][j][0]
+				advchemovoutflux[ichem][i][j][OVSLOT(0)] = advchemovoutflux[ichem][i][j][OVSLOT(0)]
 					+ load;
 
 			}	//end if load >= 0.0
@@ -213,20 +237,20 @@ void OverlandChemicalAdvection()
 				//       use of the net rainfall.
 				//
 				//compute the load value (g/s) (could be a source or a sink)
-				load = cwdovinterp[ichem][k] * cwdovarea[ichem][k][i][j]
+				load = cwdovinterp[ichem][k] * cwdovarea[ichem][k][icell]
 					* netrainrate[i][j] * (float)(1000.0);
 
 				//if the load is positive (a source)
 				if(load >= 0.0)
 				{
 					//compute the inflowing chemical flux (g/s)
-					advchemovinflux[ichem][i][j][0] = advchemovinflux[ichem][i][j][0]
+					advchemovinflux[ichem][i][j][OVSLOT(0)] = advchemovinflux[ichem][i][j][OVSLOT(0)]
 						+ load;
 				}
 				else	//else the load is negative (a sink)
 				{
 					//compute the outflowing chemical flux (g/s)
-					advchemovoutflux[ichem][i][j][0] = advchemovoutflux[ichem][i][j][0]
+					advchemovoutflux[ichem][i][j][OVSLOT(0)] = advchemovoutflux[ichem][i][j][OVSLOT(0)]
 						+ load;
 
 				}	//end if load >= 0.0
@@ -288,7 +312,7 @@ void OverlandChemicalAdvection()
 				watervol = hov[i][j] * aovsurf;
 
 				//loop over number of chemical types
-				for(ichem=1; ichem<=nchems; ichem++)
+				for(ichem=ichemfirst; ichem<=ichemlast; ichem++)
 				{
 					//Note:  Overland flow is limited to the four
 					//       cardinal directions: N, E, S, and W,
@@ -394,10 +418,10 @@ void OverlandChemicalAdvection()
 					for(k=1; k<=7; k=k+2)
 					{
 						//compute the inflowing chemical flux (g/s)
-						advchemovinflux[ichem][i][j][k] = advinflowov[i][j][k] * cin[k];
+						advchemovinflux[ichem][i][j][OVSLOT(k)] = advinflowov[i][j][OVSLOT(k)] * cin[k];
 
 						//compute the outflowing chemical flux (g/s)
-						advchemovoutflux[ichem][i][j][k] = advoutflowov[i][j][k]
+						advchemovoutflux[ichem][i][j][OVSLOT(k)] = advoutflowov[i][j][OVSLOT(k)]
 							* cchemov[ichem][i][j][0];
 
 					}	//end loop over overland sources
@@ -416,14 +440,14 @@ void OverlandChemicalAdvection()
 					//
 					//compute the chemical outflow potential (g) (source 0)
 					potential = potential
-						+ advchemovoutflux[ichem][i][j][0] * dt[idt];
+						+ advchemovoutflux[ichem][i][j][OVSLOT(0)] * dt[idt];
 
 					//loop over sources
 					for(k=1; k<=7; k=k+2)
 					{
 						//compute the chemical outflow potential (g)
 						potential = potential
-							+ advchemovoutflux[ichem][i][j][k] * dt[idt];
+							+ advchemovoutflux[ichem][i][j][OVSLOT(k)] * dt[idt];
 
 					}	//end loop over sources
 
@@ -458,15 +482,15 @@ void OverlandChemicalAdvection()
 					if(potential > available)
 					{
 						//scale the chemical advection outflux (g/s) (source 0)
-						advchemovoutflux[ichem][i][j][0] = (float)(available / potential
-								* advchemovoutflux[ichem][i][j][0]);
+						advchemovoutflux[ichem][i][j][OVSLOT(0)] = (float)(available / potential
+								* advchemovoutflux[ichem][i][j][OVSLOT(0)]);
 
 						//loop over sources 1,3,5,7
 						for(k=1; k<=7; k=k+2)
 						{
 							//scale the chemical advection outflux (g/s)
-							advchemovoutflux[ichem][i][j][k] = (float)(available / potential
-									* advchemovoutflux[ichem][i][j][k]);
+							advchemovoutflux[ichem][i][j][OVSLOT(k)] = (float)(available / potential
+									* advchemovoutflux[ichem][i][j][OVSLOT(k)]);
 
 						}	//end loop over sources
 
@@ -520,7 +544,7 @@ void OverlandChemicalAdvection()
 		watervol = hov[iout[i]][jout[i]] * aovsurf;
 
 		//loop over number of chemical types
-		for(ichem=1; ichem<=nchems; ichem++)
+		for(ichem=ichemfirst; ichem<=ichemlast; ichem++)
 		{
 			//if the cell is not a channel OR the outlet option = 1
 			if((imask[iout[i]][jout[i]] < 2) || (outopt == 1))
@@ -576,12 +600,12 @@ void OverlandChemicalAdvection()
 			//Source 10: domain boundary
 			//
 			//compute the inflowing chemical flux (g/s)
-			advchemovinflux[ichem][iout[i]][jout[i]][10] =
-				advinflowov[iout[i]][jout[i]][10] * cin[10];
+			advchemovinflux[ichem][iout[i]][jout[i]][OVSLOT(10)] =
+				advinflowov[iout[i]][jout[i]][OVSLOT(10)] * cin[10];
 
 			//compute the outflowing chemical flux (g/s)
-			advchemovoutflux[ichem][iout[i]][jout[i]][10] =
-				advoutflowov[iout[i]][jout[i]][10]
+			advchemovoutflux[ichem][iout[i]][jout[i]][OVSLOT(10)] =
+				advoutflowov[iout[i]][jout[i]][OVSLOT(10)]
 				* cchemov[ichem][iout[i]][jout[i]][0];
 
 			//Determine if outflow potential exceeds available mass...
@@ -594,14 +618,14 @@ void OverlandChemicalAdvection()
 			//       channel portion (subgrid scale transfer).
 			//
 			//potential (g) for domain outflow (source 10)
-			potential = advchemovoutflux[ichem][iout[i]][jout[i]][10] * dt[idt];
+			potential = advchemovoutflux[ichem][iout[i]][jout[i]][OVSLOT(10)] * dt[idt];
 
 			//Compute overland outflux (Sources 0, 1, 3, 5, and 7)
-			outflux = advchemovoutflux[ichem][iout[i]][jout[i]][0]
-				+ advchemovoutflux[ichem][iout[i]][jout[i]][1]
-				+ advchemovoutflux[ichem][iout[i]][jout[i]][3]
-				+ advchemovoutflux[ichem][iout[i]][jout[i]][5]
-				+ advchemovoutflux[ichem][iout[i]][jout[i]][7];
+			outflux = advchemovoutflux[ichem][iout[i]][jout[i]][OVSLOT(0)]
+				+ advchemovoutflux[ichem][iout[i]][jout[i]][OVSLOT(1)]
+				+ advchemovoutflux[ichem][iout[i]][jout[i]][OVSLOT(3)]
+				+ advchemovoutflux[ichem][iout[i]][jout[i]][OVSLOT(5)]
+				+ advchemovoutflux[ichem][iout[i]][jout[i]][OVSLOT(7)];
 
 			//compute the mass available for advection (g)
 			available = cchemov[ichem][iout[i]][jout[i]][0] * watervol
@@ -639,8 +663,8 @@ void OverlandChemicalAdvection()
 				//       flux in index [10] will be zero...
 				//
 				//scale the chemical advection outflux (g/s)
-				advchemovoutflux[ichem][iout[i]][jout[i]][10] = (float)(available / potential
-					* advchemovoutflux[ichem][iout[i]][jout[i]][10]);
+				advchemovoutflux[ichem][iout[i]][jout[i]][OVSLOT(10)] = (float)(available / potential
+					* advchemovoutflux[ichem][iout[i]][jout[i]][OVSLOT(10)]);
 
 			}	//end if potential > available
 
@@ -16,11 +16,11 @@ C-              infchemovinflux[][][][], infchemovoutflux[][][][],
 C-              reaction_fluxes[][][][], reaction_fluxes[][][][],
 C-              channel properties, cell properties
 C-
-C-  Outputs:    cchemovnew[][][][], chemreportov[][]
+C-  Outputs:    cchemovnew[][][][], chemreportov[][], mbchemstep[][]
 C-
 C-  Controls:   imask[][]
 C-
-C-  Calls:      SimulationError
+C-  Calls:      RejectStep, SimulationError, ClearChemicalMassBalanceStep
 C-
 C-  Called by:  ChemicalBalance
 C-
@@ -61,6 +61,45 @@ C-              soil.  Added loop to calculate derivatives and
 C-              update concentrations for all layers in the stack
 C-              (surface and subsurface).
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Overland source/direction slots are addressed
+C-              through OVSLOT (compact overland slot storage).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Mass accounting: cumulative budgets accumulated in
+C-              double (no float casts), dispersion budgets only
+C-              when dispersion is simulated, and external loads
+C-              added to per-step totals summed by MassAccounting.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Minimum and maximum water column concentrations
+C-              updated with new concentrations.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Time steps with a negative depth or concentration
+C-              are rejected (RejectStep) when step recovery is
+C-              enabled.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	The water column and bed masses and the process
+C-              masses of each step are added to the streamed
+C-              chemical mass balance (mbchemstep).
+C-
 C-	Revised:
 C-
 C-	Date:	
@@ -136,6 +175,9 @@ void OverlandChemicalConcentration()
 		chemflow,			//chemical discharge (kg/s)
 		sumfp;				//sum of all particulate chemical fractions (sumfp = 1 - fd - fb)
 
+	//clear the overland chemical mass balance terms of this attempt (see MassBalanceMonitor)
+	ClearChemicalMassBalanceStep(1, NMSOVTERMS);
+
 	//Loop over rows
 	for(i=1; i<=nrows; i++)
 	{
@@ -229,30 +271,30 @@ void OverlandChemicalConcentration()
 					//
 					//compute advection influx term (g/s)
 					advectionin = advectionin
-						+ advchemovinflux[ichem][i][j][0];
+						+ advchemovinflux[ichem][i][j][OVSLOT(0)];
 
 					//compute advection outflux term (g/s)
 					advectionout = advectionout
-						+ advchemovoutflux[ichem][i][j][0];
+						+ advchemovoutflux[ichem][i][j][OVSLOT(0)];
 
 					//loop over sources (1,3,5,7)
 					for(k=1; k<=7; k=k+2)
 					{
 						//compute advection influx term (g/s)
 						advectionin = advectionin
-							+ advchemovinflux[ichem][i][j][k];
+							+ advchemovinflux[ichem][i][j][OVSLOT(k)];
 
 						//compute advection outflux term (g/s)
 						advectionout = advectionout
-							+ advchemovoutflux[ichem][i][j][k];
+							+ advchemovoutflux[ichem][i][j][OVSLOT(k)];
 
 						//compute dispersion influx term (g/s)
 						dispersionin = dispersionin
-							+ dspchemovinflux[ichem][i][j][k];
+							+ dspchemovinflux[ichem][i][j][OVSLOT(k)];
 
 						//compute dispersion outflux term (g/s)
 						dispersionout = dispersionout
-							+ dspchemovoutflux[ichem][i][j][k];
+							+ dspchemovoutflux[ichem][i][j][OVSLOT(k)];
 
 					}	//end loop over sources
 
@@ -266,19 +308,19 @@ void OverlandChemicalConcentration()
 					{
 						//compute advection influx term (g/s)
 						advectionin = advectionin
-							+ advchemovinflux[ichem][i][j][9];
+							+ advchemovinflux[ichem][i][j][OVSLOT(9)];
 
 						//compute advection outflux term (g/s)
 						advectionout = advectionout
-							+ advchemovoutflux[ichem][i][j][9];
+							+ advchemovoutflux[ichem][i][j][OVSLOT(9)];
 
 						//compute dispersion influx term (g/s)
 						dispersionin = dispersionin
-							+ dspchemovinflux[ichem][i][j][9];
+							+ dspchemovinflux[ichem][i][j][OVSLOT(9)];
 
 						//compute dispersion outflux term (g/s)
 						dispersionout = dispersionout
-							+ dspchemovoutflux[ichem][i][j][9];
+							+ dspchemovoutflux[ichem][i][j][OVSLOT(9)];
 
 					}	//end if imask[][] > 1
 
@@ -289,19 +331,19 @@ void OverlandChemicalConcentration()
 					//
 					//compute advection influx term (g/s)
 					advectionin = advectionin
-						+ advchemovinflux[ichem][i][j][10];
+						+ advchemovinflux[ichem][i][j][OVSLOT(10)];
 
 					//compute advection outflux term (g/s)
 					advectionout = advectionout
-						+ advchemovoutflux[ichem][i][j][10];
+						+ advchemovoutflux[ichem][i][j][OVSLOT(10)];
 
 					//compute dispersion influx term (g/s)
 					dispersionin = dispersionin
-						+ dspchemovinflux[ichem][i][j][10];
+						+ dspchemovinflux[ichem][i][j][OVSLOT(10)];
 
 					//compute dispersion outflux term (g/s)
 					dispersionout = dispersionout
-						+ dspchemovoutflux[ichem][i][j][10];
+						+ dspchemovoutflux[ichem][i][j][OVSLOT(10)];
 
 					//Remaining sources...
 					//
@@ -442,39 +484,66 @@ void OverlandChemicalConcentration()
 					udrchemovinmass[ichem][i][j][0] = udrchemovinmass[ichem][i][j][0]
 						+ udrchemovinflux[ichem][i][j][0] * dt[idt] / 1000.0;
 
+					//Add the water column transfers and transformations to the streamed balance (kg)
+					//
+					//erosion (in) and deposition (out)
+					mbchemstep[ichem][MSERSOV] = mbchemstep[ichem][MSERSOV]
+						+ erschemovinflux[ichem][i][j][0] * dt[idt] / 1000.0;
+					mbchemstep[ichem][MSDEPOV] = mbchemstep[ichem][MSDEPOV]
+						+ depchemovoutflux[ichem][i][j][0] * dt[idt] / 1000.0;
+
+					//porewater release (in) and infiltration (out)
+					mbchemstep[ichem][MSPWROV] = mbchemstep[ichem][MSPWROV]
+						+ pwrchemovinflux[ichem][i][j][0] * dt[idt] / 1000.0;
+					mbchemstep[ichem][MSINFOV] = mbchemstep[ichem][MSINFOV]
+						+ infchemovoutflux[ichem][i][j][0] * dt[idt] / 1000.0;
+
+					//transformations (gain and loss)
+					mbchemstep[ichem][MSTNSINOV] = mbchemstep[ichem][MSTNSINOV]
+						+ transformationin * dt[idt] / 1000.0;
+					mbchemstep[ichem][MSKININOV] = mbchemstep[ichem][MSKININOV]
+						+ transformationin * dt[idt] / 1000.0;
+					mbchemstep[ichem][MSKINOUTOV] = mbchemstep[ichem][MSKINOUTOV]
+						+ transformationout * dt[idt] / 1000.0;
+
 					//Compute masses for loads (source = 0)
 					//
 					//compute the cumulative inflowing chemical mass (kg)
-					advchemovinmass[ichem][i][j][0] = advchemovinmass[ichem][i][j][0]
-						+ advchemovinflux[ichem][i][j][0] * dt[idt] / 1000.0;
+					advchemovinmass[ichem][i][j][OVSLOT(0)] = advchemovinmass[ichem][i][j][OVSLOT(0)]
+						+ advchemovinflux[ichem][i][j][OVSLOT(0)] * dt[idt] / 1000.0;
 
 					//compute the cumulative outflowing chemical mass (kg)
-					advchemovoutmass[ichem][i][j][0] = advchemovoutmass[ichem][i][j][0]
-						+ advchemovoutflux[ichem][i][j][0] * dt[idt] / 1000.0;
+					advchemovoutmass[ichem][i][j][OVSLOT(0)] = advchemovoutmass[ichem][i][j][OVSLOT(0)]
+						+ advchemovoutflux[ichem][i][j][OVSLOT(0)] * dt[idt] / 1000.0;
 
-					//Compute the cumulative (net) chemical mass entering the domain from a point source (kg)
-					totalcwov[ichem] = totalcwov[ichem]
-						+ (advchemovinflux[ichem][i][j][0]
-						- advchemovoutflux[ichem][i][j][0]) * dt[idt] / 1000.0;
+					//Compute the (net) chemical mass entering the domain from a point source in the current time step (kg)
+					pendingcwov[ichem] = pendingcwov[ichem]
+						+ (advchemovinflux[ichem][i][j][OVSLOT(0)]
+						- advchemovoutflux[ichem][i][j][OVSLOT(0)]) * dt[idt] / 1000.0;
 
 					//loop over overland sources (1,3,5,7)
 					for(k=1; k<=7; k=k+2)
 					{
 						//compute the cumulative inflowing chemical mass (kg)
-						advchemovinmass[ichem][i][j][k] = advchemovinmass[ichem][i][j][k]
-							+ advchemovinflux[ichem][i][j][k] * dt[idt] / 1000.0;
+						advchemovinmass[ichem][i][j][OVSLOT(k)] = advchemovinmass[ichem][i][j][OVSLOT(k)]
+							+ advchemovinflux[ichem][i][j][OVSLOT(k)] * dt[idt] / 1000.0;
 
 						//compute the cumulative outflowing chemical mass (kg)
-						advchemovoutmass[ichem][i][j][k] = advchemovoutmass[ichem][i][j][k]
-							+ advchemovoutflux[ichem][i][j][k] * dt[idt] / 1000.0;
+						advchemovoutmass[ichem][i][j][OVSLOT(k)] = advchemovoutmass[ichem][i][j][OVSLOT(k)]
+							+ advchemovoutflux[ichem][i][j][OVSLOT(k)] * dt[idt] / 1000.0;
 
-						//compute the cumulative in-dispersing chemical mass (kg)
-						dspchemovinmass[ichem][i][j][k] = dspchemovinmass[ichem][i][j][k]
-							+ dspchemovinflux[ichem][i][j][k] * dt[idt] / 1000.0;
+						//if overland dispersion budgets are tracked (trackdspovmass > 0)
+						if(trackdspovmass > 0)
+						{
+							//compute the cumulative in-dispersing chemical mass (kg)
+							dspchemovinmass[ichem][i][j][OVSLOT(k)] = dspchemovinmass[ichem][i][j][OVSLOT(k)]
+								+ dspchemovinflux[ichem][i][j][OVSLOT(k)] * dt[idt] / 1000.0;
 
-						//compute the cumulative out-dispersing chemical mass (kg)
-						dspchemovoutmass[ichem][i][j][k] = dspchemovoutmass[ichem][i][j][k]
-							+ dspchemovoutflux[ichem][i][j][k] * dt[idt] / 1000.0;
+							//compute the cumulative out-dispersing chemical mass (kg)
+							dspchemovoutmass[ichem][i][j][OVSLOT(k)] = dspchemovoutmass[ichem][i][j][OVSLOT(k)]
+								+ dspchemovoutflux[ichem][i][j][OVSLOT(k)] * dt[idt] / 1000.0;
+
+						}	//end if trackdspovmass > 0
 
 					}	//end loop over sources
 
@@ -487,20 +556,25 @@ void OverlandChemicalConcentration()
 					if(imask[i][j] > 1)
 					{
 						//compute the cumulative inflowing chemical mass (kg)
-						advchemovinmass[ichem][i][j][9] = advchemovinmass[ichem][i][j][9]
-							+ advchemovinflux[ichem][i][j][9] * dt[idt] / 1000.0;
+						advchemovinmass[ichem][i][j][OVSLOT(9)] = advchemovinmass[ichem][i][j][OVSLOT(9)]
+							+ advchemovinflux[ichem][i][j][OVSLOT(9)] * dt[idt] / 1000.0;
 
 						//compute the cumulative outflowing chemical mass (kg)
-						advchemovoutmass[ichem][i][j][9] = advchemovoutmass[ichem][i][j][9]
-							+ advchemovoutflux[ichem][i][j][9] * dt[idt] / 1000.0;
+						advchemovoutmass[ichem][i][j][OVSLOT(9)] = advchemovoutmass[ichem][i][j][OVSLOT(9)]
+							+ advchemovoutflux[ichem][i][j][OVSLOT(9)] * dt[idt] / 1000.0;
 
-						//compute the cumulative in-dispersing chemical mass (kg)
-						dspchemovinmass[ichem][i][j][9] = dspchemovinmass[ichem][i][j][9]
-							+ dspchemovinflux[ichem][i][j][9] * dt[idt] / 1000.0;
+						//if overland dispersion budgets are tracked (trackdspovmass > 0)
+						if(trackdspovmass > 0)
+						{
+							//compute the cumulative in-dispersing chemical mass (kg)
+							dspchemovinmass[ichem][i][j][OVSLOT(9)] = dspchemovinmass[ichem][i][j][OVSLOT(9)]
+								+ dspchemovinflux[ichem][i][j][OVSLOT(9)] * dt[idt] / 1000.0;
 
-						//compute the cumulative out-dispersing chemical mass (kg)
-						dspchemovoutmass[ichem][i][j][9] = dspchemovoutmass[ichem][i][j][9]
-							+ dspchemovoutflux[ichem][i][j][9] * dt[idt] / 1000.0;
+							//compute the cumulative out-dispersing chemical mass (kg)
+							dspchemovoutmass[ichem][i][j][OVSLOT(9)] = dspchemovoutmass[ichem][i][j][OVSLOT(9)]
+								+ dspchemovoutflux[ichem][i][j][OVSLOT(9)] * dt[idt] / 1000.0;
+
+						}	//end if trackdspovmass > 0
 
 					}	//end if imask[][] > 1
 
@@ -510,20 +584,25 @@ void OverlandChemicalConcentration()
 					//       an outlet cell...
 					//
 					//compute the cumulative inflowing chemical mass (kg)
-					advchemovinmass[ichem][i][j][10] = advchemovinmass[ichem][i][j][10]
-						+ advchemovinflux[ichem][i][j][10] * dt[idt] / 1000.0;
+					advchemovinmass[ichem][i][j][OVSLOT(10)] = advchemovinmass[ichem][i][j][OVSLOT(10)]
+						+ advchemovinflux[ichem][i][j][OVSLOT(10)] * dt[idt] / 1000.0;
 
 					//compute the cumulative outflowing chemical mass (kg)
-					advchemovoutmass[ichem][i][j][10] = advchemovoutmass[ichem][i][j][10]
-						+ advchemovoutflux[ichem][i][j][10] * dt[idt] / 1000.0;
+					advchemovoutmass[ichem][i][j][OVSLOT(10)] = advchemovoutmass[ichem][i][j][OVSLOT(10)]
+						+ advchemovoutflux[ichem][i][j][OVSLOT(10)] * dt[idt] / 1000.0;
+
+					//if overland dispersion budgets are tracked (trackdspovmass > 0)
+					if(trackdspovmass > 0)
+					{
+						//compute the cumulative in-dispersing chemical mass (kg)
+						dspchemovinmass[ichem][i][j][OVSLOT(10)] = dspchemovinmass[ichem][i][j][OVSLOT(10)]
+							+ dspchemovinflux[ichem][i][j][OVSLOT(10)] * dt[idt] / 1000.0;
 
-					//compute the cumulative in-dispersing chemical mass (kg)
-					dspchemovinmass[ichem][i][j][10] = dspchemovinmass[ichem][i][j][10]
-						+ dspchemovinflux[ichem][i][j][10] * dt[idt] / 1000.0;
+						//compute the cumulative out-dispersing chemical mass (kg)
+						dspchemovoutmass[ichem][i][j][OVSLOT(10)] = dspchemovoutmass[ichem][i][j][OVSLOT(10)]
+							+ dspchemovoutflux[ichem][i][j][OVSLOT(10)] * dt[idt] / 1000.0;
 
-					//compute the cumulative out-dispersing chemical mass (kg)
-					dspchemovoutmass[ichem][i][j][10] = dspchemovoutmass[ichem][i][j][10]
-						+ dspchemovoutflux[ichem][i][j][10] * dt[idt] / 1000.0;
+					}	//end if trackdspovmass > 0
 
 					//compute total derivative for the water column (g/s)
 					derivative = influx - outflux;
@@ -573,8 +652,13 @@ void OverlandChemicalConcentration()
 						{
 							//Warn user of possible numerical instability (do not abort)
 							//
-							//Report error type (negative concentration overland) and location
-							SimulationError(6, i, j, ichem);
+							//if the time step cannot be rejected (step recovery is off or no retries remain)
+							if(RejectStep(6, i, j, ichem) == 0)
+							{
+								//Report error type (negative concentration overland) and location
+								SimulationError(6, i, j, ichem);
+
+							}	//end if RejectStep() == 0
 
 							//Reset the new concentration to exactly zero anyway...
 							cchemovnew[ichem][i][j][0] = 0.0;
@@ -583,6 +667,14 @@ void OverlandChemicalConcentration()
 
 					}	//end if newmass < 0.0
 
+					//add the new water column mass to the streamed storage (kg)
+					mbchemstep[ichem][MSWATEROV] = mbchemstep[ichem][MSWATEROV]
+						+ cchemovnew[ichem][i][j][0] * newwatervol / 1000.0;
+
+					//Determine the minimum and the maximum chemical concentrations in water (g/m3)
+					mincchemov0[ichem] = Min(mincchemov0[ichem],cchemovnew[ichem][i][j][0]);
+					maxcchemov0[ichem] = Max(maxcchemov0[ichem],cchemovnew[ichem][i][j][0]);
+
 				}	//end loop over chemicals
 
 				//Compute derivative for soil layers
@@ -679,6 +771,10 @@ void OverlandChemicalConcentration()
 
 							//Compute cumulative masses for all processes
 							//
+							//compute the cumulative chemical mass leaving soil by infiltration (kg)
+							infchemovoutmass[ichem][i][j][ilayer] = infchemovoutmass[ichem][i][j][ilayer]
+								+ infchemovoutflux[ichem][i][j][ilayer] * dt[idt] / 1000.0;
+
 							//compute the cumulative chemical mass entering soil by deposition (kg)
 							depchemovinmass[ichem][i][j][ilayer] = depchemovinmass[ichem][i][j][ilayer]
 								+ depchemovinflux[ichem][i][j][ilayer] * dt[idt] / 1000.0;
@@ -691,10 +787,6 @@ void OverlandChemicalConcentration()
 							pwrchemovoutmass[ichem][i][j][ilayer] = pwrchemovoutmass[ichem][i][j][ilayer]
 								+ pwrchemovoutflux[ichem][i][j][ilayer] * dt[idt] / 1000.0;
 
-							//compute the cumulative chemical mass leaving soil by infiltration (kg)
-							infchemovoutmass[ichem][i][j][ilayer] = infchemovoutmass[ichem][i][j][ilayer]
-								+ infchemovoutflux[ichem][i][j][ilayer] * dt[idt] / 1000.0;
-
 							//compute the cumulative chemical mass entering soil by infiltration (kg)
 							infchemovinmass[ichem][i][j][ilayer] = infchemovinmass[ichem][i][j][ilayer]
 								+ infchemovinflux[ichem][i][j][ilayer] * dt[idt] / 1000.0;
@@ -755,6 +847,30 @@ void OverlandChemicalConcentration()
 							udrchemovinmass[ichem][i][j][ilayer] = udrchemovinmass[ichem][i][j][ilayer]
 								+ udrchemovinflux[ichem][i][j][ilayer] * dt[idt] / 1000.0;
 
+							//add the soil transformations (gain and loss) to the streamed balance (kg)
+							mbchemstep[ichem][MSKININOV] = mbchemstep[ichem][MSKININOV]
+								+ transformationin * dt[idt] / 1000.0;
+							mbchemstep[ichem][MSKINOUTOV] = mbchemstep[ichem][MSKINOUTOV]
+								+ transformationout * dt[idt] / 1000.0;
+
+							//if the layer is the surface layer
+							if(ilayer == nstackov[i][j])
+							{
+								//add the infiltration out of the surface layer to the streamed balance (kg)
+								mbchemstep[ichem][MSINFSURFOV] = mbchemstep[ichem][MSINFSURFOV]
+									+ infchemovoutflux[ichem][i][j][ilayer] * dt[idt] / 1000.0;
+
+							}	//end if ilayer == nstackov[i][j]
+
+							//if the layer is the bottom layer of the stack
+							if(ilayer == 1)
+							{
+								//add the infiltration out of the stack to the streamed balance (kg)
+								mbchemstep[ichem][MSINFSTACKOV] = mbchemstep[ichem][MSINFSTACKOV]
+									+ infchemovoutflux[ichem][i][j][ilayer] * dt[idt] / 1000.0;
+
+							}	//end if ilayer == 1
+
 							//compute total derivative for the soil layer (g/s)
 							soilderivative = soilinflux - soiloutflux;
 
@@ -792,6 +908,11 @@ void OverlandChemicalConcentration()
 
 						}	//end if newsoilvol >= TOLERANCE
 
+						//add the change of layer mass to the streamed soil storage (kg)
+						mbchemstep[ichem][MSBEDOV] = mbchemstep[ichem][MSBEDOV]
+							+ (cchemovnew[ichem][i][j][ilayer] * newsoilvol
+							- cchemov[ichem][i][j][ilayer] * soilvol) / 1000.0;
+
 					}	//end loop over chemicals
 
 				}	//end if imask[][] != nodatavalue
@@ -818,29 +939,34 @@ void OverlandChemicalConcentration()
 			//
 			//Compute the cumulative chemical mass exiting the domain at this outlet (kg)
 			totaladvchemoutov[ichem][i] = totaladvchemoutov[ichem][i]
-				+ advchemovoutflux[ichem][iout[i]][jout[i]][10]
+				+ advchemovoutflux[ichem][iout[i]][jout[i]][OVSLOT(10)]
 				* dt[idt] / 1000.0;
 
 			//Compute the cumulative chemical mass entering the domain at this outlet (kg)
 			totaladvcheminov[ichem][i] = totaladvcheminov[ichem][i]
-				+ advchemovinflux[ichem][iout[i]][jout[i]][10]
+				+ advchemovinflux[ichem][iout[i]][jout[i]][OVSLOT(10)]
 				* dt[idt] / 1000.0;
 
 			//Dispersion...
 			//
-			//Compute the cumulative chemical mass exiting the domain at this outlet (kg)
-			totaldspchemoutov[ichem][i] = totaldspchemoutov[ichem][i]
-				+ dspchemovoutflux[ichem][iout[i]][jout[i]][10]
-				* dt[idt] / 1000.0;
+			//if overland dispersion budgets are tracked (trackdspovmass > 0)
+			if(trackdspovmass > 0)
+			{
+				//Compute the cumulative chemical mass exiting the domain at this outlet (kg)
+				totaldspchemoutov[ichem][i] = totaldspchemoutov[ichem][i]
+					+ dspchemovoutflux[ichem][iout[i]][jout[i]][OVSLOT(10)]
+					* dt[idt] / 1000.0;
 
-			//Compute the cumulative chemical mass entering the domain at this outlet (kg)
-			totaldspcheminov[ichem][i] = totaldspcheminov[ichem][i]
-				+ dspchemovinflux[ichem][iout[i]][jout[i]][10]
-				* dt[idt] / 1000.0;
+				//Compute the cumulative chemical mass entering the domain at this outlet (kg)
+				totaldspcheminov[ichem][i] = totaldspcheminov[ichem][i]
+					+ dspchemovinflux[ichem][iout[i]][jout[i]][OVSLOT(10)]
+					* dt[idt] / 1000.0;
+
+			}	//end if trackdspovmass > 0
 
 			//compute chemical discharge (kg/s) (advection plus dispersion)
-			chemflow = (float)((advchemovoutflux[ichem][iout[i]][jout[i]][10]
-				+ dspchemovoutflux[ichem][iout[i]][jout[i]][10]) / 1000.0);
+			chemflow = (float)((advchemovoutflux[ichem][iout[i]][jout[i]][OVSLOT(10)]
+				+ dspchemovoutflux[ichem][iout[i]][jout[i]][OVSLOT(10)]) / 1000.0);
 
 			//Search for peak chemical discharge at this outlet...
 			//
@@ -28,6 +28,15 @@ C-              Denver, CO 80225
 C-
 C-	Date:		29-DEC-2003
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	The kernel takes a range of chemical types
+C-              (ichemfirst to ichemlast) so that each chemical type
+C-              can be computed as a separate task (see
+C-              SpeciesTasks).
+C-
 C-	Revised:
 C-
 C-	Date:	
@@ -51,7 +60,7 @@ C----------------------------------------------------------------------*/
 //trex global variable declarations for environmental conditions
 #include "trex_environmental_declarations.h"
 
-void OverlandChemicalDeposition()
+void OverlandChemicalDeposition(int ichemfirst, int ichemlast)
 {
 	//local variable declarations/definitions
 	int
@@ -127,7 +136,7 @@ void OverlandChemicalDeposition()
 				ilayer = nstackov[i][j];
 
 				//loop over number of chemicals
-				for(ichem=1; ichem<=nchems; ichem++)
+				for(ichem=ichemfirst; ichem<=ichemlast; ichem++)
 				{
 					//Initialize gross deposition outflux array (from water column)
 					depchemovoutflux[ichem][i][j][0] = 0.0;
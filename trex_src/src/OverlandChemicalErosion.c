@@ -28,6 +28,15 @@ C-              Denver, CO 80225
 C-
 C-	Date:		12-JUL-2004
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	The kernel takes a range of chemical types
+C-              (ichemfirst to ichemlast) so that each chemical type
+C-              can be computed as a separate task (see
+C-              SpeciesTasks).
+C-
 C-	Revised:
 C-
 C-	Date:	
@@ -51,7 +60,7 @@ C----------------------------------------------------------------------*/
 //trex global variable declarations for environmental conditions
 #include "trex_environmental_declarations.h"
 
-void OverlandChemicalErosion()
+void OverlandChemicalErosion(int ichemfirst, int ichemlast)
 {
 	//local variable declarations/definitions
 	int
@@ -87,7 +96,7 @@ void OverlandChemicalErosion()
 				ilayer = nstackov[i][j];
 
 				//loop over number of chemical types
-				for(ichem=1; ichem<=nchems; ichem++)
+				for(ichem=ichemfirst; ichem<=ichemlast; ichem++)
 				{
 					//Initialize gross erosion outflux array (from sediment bed)
 					erschemovoutflux[ichem][i][j][ilayer] = 0.0;
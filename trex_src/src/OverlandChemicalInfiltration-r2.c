@@ -34,6 +34,15 @@ C-              Denver, CO 80225
 C-
 C-	Date:		26-DEC-2004
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	The kernel takes a range of chemical types
+C-              (ichemfirst to ichemlast) so that each chemical type
+C-              can be computed as a separate task (see
+C-              SpeciesTasks).
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -57,7 +66,7 @@ C----------------------------------------------------------------------*/
 //trex global variable declarations for environmental conditions
 #include "trex_environmental_declarations.h"
 
-void OverlandChemicalInfiltration()
+void OverlandChemicalInfiltration(int ichemfirst, int ichemlast)
 {
 	//local variable declarations/definitions
 	int
@@ -129,7 +138,7 @@ void OverlandChemicalInfiltration()
 				ilayer = nstackov[i][j];
 
 				//loop over number of chemical types
-				for(ichem=1; ichem<=nchems; ichem++)
+				for(ichem=ichemfirst; ichem<=ichemlast; ichem++)
 				{
 					//compute mobile fraction (sum of dissolved and bound)
 					fmobile = fdissolvedov[ichem][i][j][0] + fboundov[ichem][i][j][0];
@@ -221,7 +230,7 @@ void OverlandChemicalInfiltration()
 					}	//end if wfe >= elevlayerov[][][]...
 
 					//loop over number of chemical types
-					for(ichem=1; ichem<=nchems; ichem++)
+					for(ichem=ichemfirst; ichem<=ichemlast; ichem++)
 					{
 						//compute mobile fraction (sum of dissolved and bound)
 						fmobile = fdissolvedov[ichem][i][j][ilayer] + fboundov[ichem][i][j][ilayer];
@@ -29,6 +29,13 @@ C-              Denver, CO 80225
 C-
 C-	Date:		29-DEC-2003
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Kernel snapshot hooks (CaptureKernel) around
+C-              OverlandChemicalPartitioning.
+C-
 C-	Revised:
 C-
 C-	Date:	
@@ -57,9 +64,22 @@ void OverlandChemicalKinetics()
 	//if any chemical partitions (if partopt[0] > 0)
 	if(partopt[0] > 0)
 	{
+		//if the kernel is captured to a snapshot file (see KernelSnapshot)
+		if(snapshotkernel == KERNELOVPARTITION)
+		{
+			//write the kernel state before the kernel
+			CaptureKernel(0);
+		}
+
 		//Compute overland chemical partitioning
 		OverlandChemicalPartitioning();
 
+		//if the kernel is captured, write the kernel outputs after the kernel
+		if(snapshotkernel == KERNELOVPARTITION)
+		{
+			CaptureKernel(1);
+		}
+
 	}	//end if partopt[0] > 0
 
 	//if any chemical biodegrades (if bioopt[0] > 0)
@@ -7,15 +7,18 @@ C-              dissolved, bound, and particulate.
 C-
 C-
 C-  Inputs:	    csedov[][][], cdocov[][][], fpocov[][][][],
-C-              fdocov[][][], kb[], kp[], koc[]
+C-              fdocov[][][], kb[], kp[], koc[], soilmdov[][],
+C-              porositysoilov[][], partstaleov[][], partwfeov[][],
+C-              partrefov[][][], parttol
 C-
 C-  Outputs:    fparticulateov[chem][solid][link][node][layer]
 C-              fboundov[chem][link][node][layer],
-C-              fdissolvedov[chem][link][node][layer]
+C-              fdissolvedov[chem][link][node][layer],
+C-              partstaleov[][], partwfeov[][], partrefov[][][]
 C-
 C-  Controls:	partopt[]
 C-
-C-  Calls:      None
+C-  Calls:      PartitionInputMoved
 C-
 C-  Called by:  ChemicalTransport
 C-
@@ -44,6 +47,24 @@ C-              to account for variable saturation of soil layers as
 C-              the infiltration wetting front moves through the soil
 C-              stack.  Updated comments for water column calculations.
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	The moisture deficit and porosity of the surface
+C-              soil layer are read from the surface soil parameter
+C-              grids (soilmdov, porositysoilov); buried layers
+C-              still use their soil types.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Layers are partitioned incrementally: the water
+C-              column, surface layer and buried layers are
+C-              recomputed only when their inputs changed or the
+C-              cell was marked stale (see PartitionCache).
+C-
 C-	Revised:
 C-
 C-	Date:	
@@ -74,7 +95,9 @@ void OverlandChemicalPartitioning()
 		ichem,		//loop index for chemical type
 		isolid,		//loop index for solids (particle) type
 		ilayer,		//loop index for layer in the soil stack
-		isoil;		//index for soil type [i][j][ilayer]
+		isoil,		//index for soil type [i][j][ilayer]
+		stale,		//partitioning of all layers of the cell is stale (see PartitionCache)
+		*partlayer;	//layer is partitioned (1) or keeps its previous phase fractions (0) [ilayer]
 
 	float
 		pic0,		//solids independent partition coefficient (m3/g)
@@ -94,11 +117,18 @@ void OverlandChemicalPartitioning()
 		wcporosity,	//water column porosity (volume water / total volume) (no air space)
 		wfe,		//wetting front elevation (m)
 		fsaturated,	//fraction of soil pore space that is filled with water (volume water / total volume) (could be air space)
-		phi;		//soil layer water-filled porosity (volume water / total volume) (when fsaturated = 1, phi = porosityov)
+		phi,		//soil layer water-filled porosity (volume water / total volume) (when fsaturated = 1, phi = porosityov)
+		mdlayer,	//soil moisture deficit of the soil layer (dimensionless)
+		porositylayer,	//porosity of the soil layer (dimensionless)
+		wfe0,		//wetting front elevation at the last partitioning of the cell (m)
+		*philayer,	//water-filled porosity of the soil layers [ilayer]
+		*ref;		//reference porosities and solids of the last partitioning of the cell
 
 	//Allocate memory for local arrays
 	pic = (float *)malloc((nsolids+1) * sizeof(float));		//partition coefficient (m3/g)
 	m = (float *)malloc((nsolids+1) * sizeof(float));		//solids partitioning basis (g/m3 = mg/L)
+	partlayer = (int *)malloc((maxstackov+1) * sizeof(int));	//layer partitioning flags
+	philayer = (float *)malloc((maxstackov+1) * sizeof(float));	//soil layer water-filled porosities
 
 	//Define local constants...
 	//
@@ -139,190 +169,218 @@ void OverlandChemicalPartitioning()
 				//compute water column porosity (volume water / total volume) (dimensionless)
 				wcporosity = (float)(1.0 - fsolids);
 
-				//loop over number of chemical types
-				for(ichem=1; ichem<=nchems; ichem++)
+				//Partitioning cache (see PartitionCache)...
+				//
+				//Note:  The phase fractions of a layer are only recomputed
+				//       when the inputs of the layer changed since the last
+				//       call.  Otherwise the layer keeps its fractions.
+				//
+				//set the stale flag and reference values of the cell
+				stale = partstaleov[i][j];
+				ref = partrefov[i][j];
+
+				//partition the water column if the cell is stale or the porosity moved
+				partlayer[0] = stale || PartitionInputMoved(wcporosity, ref[0]);
+
+				//loop over solids
+				for(isolid=1; isolid<=nsolids; isolid++)
 				{
-					//if the chemical partitions (partopt > 0)
-					if(partopt[ichem] > 0)
-					{
-						//Water Column...
-						//
-						//Particulate phases:
-						//
-						//initialize the sum of pic * m (used to compute fparticulate)
-						sumpicm = 0.0;
+					//partition the water column if the solids concentration moved
+					partlayer[0] = partlayer[0] || PartitionInputMoved(csedov[isolid][i][j][0], ref[isolid]);
 
-						//initialize the sum of all particulate fractions
-						sumfp = 0.0;
+				}	//end loop over solids
 
-						//loop over number of solids types
-						for(isolid=1; isolid<=nsolids; isolid++)
-						{
-							//Note:  Partitioning is generalized for organic or
-							//       inorganic chemicals.  Organics partition
-							//       on a cabon normalized basis.  Inorganics
-							//       partition on a solids basis.  This code
-							//       works for either case and also accounts
-							//       for particle dependent partitioning.
-							//
-							//if the chemical partitions to organic carbon
-							if(partopt[ichem]> 1)
-							{
-								//set the fraction (particulate) organic carbon
-								fpoc = fpocov[isolid][i][j][0];
+				//if the water column is partitioned
+				if(partlayer[0])
+				{
+					//store the reference porosity and solids concentrations
+					ref[0] = wcporosity;
 
-								//set the solids independent partition coefficient (m3/g)
-								pic0 = koc[ichem];
+					//loop over solids
+					for(isolid=1; isolid<=nsolids; isolid++)
+					{
+						ref[isolid] = csedov[isolid][i][j][0];
 
-								//set the particulate organic carbon (poc) concentration (g/m3 = mg/L))
-								m[isolid] = csedov[isolid][i][j][0] * fpoc;
-							}
-							else	//else the chemical partitions to solids
-							{
-								//Developer's Note:  The water column partition coefficient
-								//                   could be assigned as a separate variable
-								//                   to distinguish it from the sediment bed
-								//                   partition coefficient...
-								//
-								//                   Change from kp[] to kpw[] and kps[]...
-								//
-								//set the solids independent partition coefficient (m3/g)
-								pic0 = kp[ichem];
+					}	//end loop over solids
 
-								//set the solids concentration (g/m3 = mg/L)
-								m[isolid] =  csedov[isolid][i][j][0];
+				}	//end if partlayer[0]
 
-							}	//end if partopt[]
+				//set the wetting front elevation of the last partitioning (m)
+				wfe0 = partwfeov[i][j];
 
-							//Adjust partition coefficient for porosity
-							//
-							//Note:  For the water column, the partition coefficient must
-							//       be adjusted by porosity because "m" is on a total
-							//       (bulk) volume basis (i.e. volume water plus volume
-							//       solids) and the partition coefficient is defined as
-							//       mass chemical / volume water.
-							//
-							//if the water column porosity > 0.0
-							if(wcporosity > 0.0)
-							{
-								//correct partition coeffificent for porosity
-								pic0 = pic0 / wcporosity;
-							}
-							else	//else wcporosity <= 0
-							{
-								//set the partition coefficient to effective infinity
-								pic0 = (float)(1.0e30);
+				//if infiltration is simulated (infopt > 0)
+				if(infopt > 0)
+				{
+					//compute the wetting front elevation (m)
+					wfe = elevationov0[i][j] - infiltrationdepth[i][j];
+				}
+				else	//else infiltration is not simulated (infopt = 0)
+				{
+					//the wetting front is not used
+					wfe = wfe0;
 
-							}	//end if wcporosity > 0.0
+				}	//end if infopt > 0
 
-							//Note:  For the water column, the particle dependent
-							//       partition coefficient is used...
-							//
-							//Compute the particle dependent partition coefficient (m3/g)
-							pic[isolid] = (float)(pic0 / (1.0 + m[isolid] * pic0 /nux[ichem]));
+				//Soil Column...
+				//
+				//loop over layers (in reverse order: top down)
+				for(ilayer=nstackov[i][j]; ilayer>=1; ilayer--)
+				{
+					//if the layer is the surface layer
+					if(ilayer == nstackov[i][j])
+					{
+						//the porosity of the surface layer is always computed (the
+						//inputs are checked against the reference values below)
+						partlayer[ilayer] = 1;
+
+						//assign the parameters of the surface soil layer of this cell
+						mdlayer = (infopt > 0) ? soilmdov[i][j] : (float)(0.0);
+						porositylayer = porositysoilov[i][j];
+					}
+					else	//else the layer is buried
+					{
+						//Note:  The inputs of a buried layer only change when
+						//       the stack or the doc changes (the cell is then
+						//       marked stale) or when the wetting front moves
+						//       into, out of, or within the layer.  Otherwise
+						//       the front stays above or below the layer, the
+						//       water-filled porosity is unchanged, and the
+						//       layer keeps its phase fractions.
+						//
+						//partition the layer if the cell is stale or the front moved across the layer
+						partlayer[ilayer] = stale || (infopt > 0
+							&& !((wfe0 >= elevlayerov[i][j][ilayer] && wfe >= elevlayerov[i][j][ilayer])
+							|| (wfe0 <= elevlayerov[i][j][ilayer-1] && wfe <= elevlayerov[i][j][ilayer-1])));
 
-							//compute the sum of pic * m (used to compute fparticulate)
-							sumpicm = sumpicm + pic[isolid] * m[isolid];
+						//assign soil type of this layer
+						isoil = soiltype[i][j][ilayer];
 
-						}	//end loop over solids
+						//assign the parameters of the soil type
+						mdlayer = (infopt > 0) ? soilmd[isoil] : (float)(0.0);
+						porositylayer = porosityov[isoil];
+
+					}	//end if ilayer == nstackov[i][j]
 
-						//Bound phase:
+					//if the layer is partitioned
+					if(partlayer[ilayer])
+					{
+						//Compute water-filled porosity of bed (volume water / total volume)
+						//
+						//       phi = fsaturated * porositych[][]
+						//
+						//Note:  The pore space of the soil stack may not always
+						//       be 100% saturated with water and may also include
+						//       void space willed with air...
 						//
-						//if the chemical partitions to organic carbon
-						if(partopt[ichem]> 1)
+						//       total volume = volume of air + water + solids
+						//
+						//if infiltration is simulated (infopt > 0)
+						if(infopt > 0)
 						{
-							//set the effective fraction of doc for binding
-							fdoc = fdocov[i][j][0];
-
-							//set the organic binding coefficient (m3/g)
-							pib = koc[ichem];
-
-							//set the dissolved organic compound (doc) concentration (g/m3 = mg/L)
-							b = cdocov[i][j][0] * fdoc;
+							//Determine if the wetting front is within this soil layer
+							//
+							//Three cases exist:
+							//
+							//   (1) wetting front is above top of this layer, so the
+							//       water filled porosity equals the layer initial
+							//       value (fsaturated = 1 - sedmd)
+							//
+							//   (2) wetting front is below bottom of this layer, so
+							//       the water filled porosity equals the layer
+							//       porosity (fsaturated = 1) (100% saturated)
+							//
+							//   (3) wetting from is within this layer, so the water
+							//       filled porosity is computed as an average where
+							//       the distance above the front is saturated and
+							//       the distance below is the initial value
+							//
+							//Note:  elevlayerov[][][ilayer] = elevation at layer top
+							//       elevlayerov[][][ilayer-1] = elevation at layer bottom
+							//       elevlayerov[][][0] = elevation at bottom of stack
+							//
+							//if the wetting from elevation is above the layer upper boundary
+							if(wfe >= elevlayerov[i][j][ilayer])
+							{
+								//fraction saturated equals layer initial value
+								fsaturated = (float)(1.0 - mdlayer);
+							}
+							//else, if the wetting front is below the layer bottom boundary
+							else if(wfe <= elevlayerov[i][j][ilayer-1])
+							{
+								//fraction saturated equals 1.0 (100% saturated)
+								fsaturated = 1.0;
+							}
+							//else, the wetting front is within this layer
+							else
+							{
+								//calculate fraction saturation of the layer
+								fsaturated = (float)(((elevlayerov[i][j][ilayer]- wfe) * 1.0
+									+ (wfe - elevlayerov[i][j][ilayer-1]) * (1.0 - mdlayer))
+									/ (elevlayerov[i][j][ilayer] - elevlayerov[i][j][ilayer-1]));
 
+							}	//end if/else if/else wfe >= elevlayerov[][][]...
 						}
-						else	//else the chemical partitions to solids
+						else	//infiltration is not simulated (infopt = 0)
 						{
-							//set the organic binding coefficient (m3/g)
-							pib = kb[ichem];
+							//set fraction saturated equals to zero
+							fsaturated = 0.0;
 
-							//set the dissolved organic compound (doc) concentration (g/m3 = mg/L)
-							b =  cdocov[i][j][0];
+						}	//end if infopt > 0
 
-						}	//end if partopt[] > 1
+						//calculate water filled porosity (volume water / total volume)
+						philayer[ilayer] = fsaturated * porositylayer;
 
-						//Adjust binding coefficient for porosity
-						//
-						//if the water column porosity > 0.0
-						if(wcporosity > 0.0)
-						{
-							//Note:  For the water column, the binding coefficient must
-							//       be adjusted by porosity because "b" is on a total
-							//       (bulk) volume basis (i.e. volume water plus volume
-							//       solids) and the binding coefficient is defined as
-							//       mass chemical / volume water.
-							//   
-							//correct binding coeffificent for porosity
-							pib = pib / wcporosity;
-						}
-						else	//else wcporosity <= 0
-						{
-							//set the binding coefficient to zero
-							pib = 0.0;
+					}	//end if partlayer[ilayer]
 
-						}	//end if wcporosity > 0.0
+					//if the layer is the surface layer
+					if(ilayer == nstackov[i][j])
+					{
+						//partition the surface layer if the cell is stale or the porosity moved
+						partlayer[ilayer] = stale || PartitionInputMoved(philayer[ilayer], ref[nsolids+1]);
 
-						//loop over number of solids types
+						//loop over solids
 						for(isolid=1; isolid<=nsolids; isolid++)
 						{
-							//compute the fraction of the chemical sorbed to this solids type
-							fparticulateov[ichem][isolid][i][j][0] = (float)(pic[isolid] * m[isolid]
-								/ (1.0 + pib * b + sumpicm));
-
-							//compute sum of all particulate phases
-							sumfp = sumfp
-								+ fparticulateov[ichem][isolid][i][j][0];
+							//partition the surface layer if the solids concentration moved
+							partlayer[ilayer] = partlayer[ilayer]
+								|| PartitionInputMoved(csedov[isolid][i][j][ilayer], ref[nsolids+1+isolid]);
 
 						}	//end loop over solids
 
-						//Note:  Watch out for roundoff errors.  For large
-						//       Kp values, the sum of particulate fractions
-						//       can be > 1.0 (i.e. 1.0000001).  When this
-						//       occurs individual values need to be scaled
-						//       and the sum reset to exactly 1.0.
-						//
-						//if the sum of particulate fractions (sumfp) > 1.0
-						if(sumfp > 1.0)
+						//if the surface layer is partitioned
+						if(partlayer[ilayer])
 						{
-							//loop over number of solids types
+							//store the reference porosity and solids concentrations
+							ref[nsolids+1] = philayer[ilayer];
+
+							//loop over solids
 							for(isolid=1; isolid<=nsolids; isolid++)
 							{
-								//scale the fraction of the chemical sorbed to this solids type
-								fparticulateov[ichem][isolid][i][j][0] = (float)(1.0 / sumfp)
-									* fparticulateov[ichem][isolid][i][j][0];
+								ref[nsolids+1+isolid] = csedov[isolid][i][j][ilayer];
 
 							}	//end loop over solids
 
-							//reset sum of all particulate phases to exactly 1.0
-							sumfp = (float)(1.0);
+						}	//end if partlayer[ilayer]
 
-						}	//end if sumfp > 1.0
+					}	//end if ilayer == nstackov[i][j]
 
-						//compute the fraction of the chemical sorbed to doc
-						fboundov[ichem][i][j][0] = (float)(pib * b / (1.0 + pib * b + sumpicm));
+				}	//end loop over layers
 
-						//compute the dissolved fraction of the chemical
-						fdissolvedov[ichem][i][j][0] = (float)(1.0 - sumfp
-							- fboundov[ichem][i][j][0]);
+				//the cache of the cell is current
+				partwfeov[i][j] = wfe;
+				partstaleov[i][j] = 0;
 
-						//Soil Column...
-						//
-						//loop over layers (in reverse order: top down)
-						for(ilayer=nstackov[i][j]; ilayer>=1; ilayer--)
+				//loop over number of chemical types
+				for(ichem=1; ichem<=nchems; ichem++)
+				{
+					//if the chemical partitions (partopt > 0)
+					if(partopt[ichem] > 0)
+					{
+						//if the water column is partitioned
+						if(partlayer[0])
 						{
-							//assign soil type of this cell
-							isoil = soiltype[i][j][ilayer];
-
+							//Water Column...
+							//
 							//Particulate phases:
 							//
 							//initialize the sum of pic * m (used to compute fparticulate)
@@ -331,75 +389,6 @@ void OverlandChemicalPartitioning()
 							//initialize the sum of all particulate fractions
 							sumfp = 0.0;
 
-							//Compute water-filled porosity of bed (volume water / total volume)
-							//
-							//       phi = fsaturated * porositych[][]
-							//
-							//Note:  The pore space of the soil stack may not always
-							//       be 100% saturated with water and may also include
-							//       void space willed with air...
-							//
-							//       total volume = volume of air + water + solids
-							//
-							//if infiltration is simulated (infopt > 0)
-							if(infopt > 0)
-							{
-								//compute the wetting front elevation (m)
-								wfe = elevationov0[i][j] - infiltrationdepth[i][j];
-
-								//Determine if the wetting front is within this soil layer
-								//
-								//Three cases exist:
-								//
-								//   (1) wetting front is above top of this layer, so the
-								//       water filled porosity equals the layer initial
-								//       value (fsaturated = 1 - sedmd)
-								//
-								//   (2) wetting front is below bottom of this layer, so
-								//       the water filled porosity equals the layer
-								//       porosity (fsaturated = 1) (100% saturated)
-								//
-								//   (3) wetting from is within this layer, so the water
-								//       filled porosity is computed as an average where
-								//       the distance above the front is saturated and
-								//       the distance below is the initial value
-								//
-								//Note:  elevlayerov[][][ilayer] = elevation at layer top
-								//       elevlayerov[][][ilayer-1] = elevation at layer bottom
-								//       elevlayerov[][][0] = elevation at bottom of stack
-								//
-								//if the wetting from elevation is above the layer upper boundary
-								if(wfe >= elevlayerov[i][j][ilayer])
-								{
-									//fraction saturated equals layer initial value
-									fsaturated = (float)(1.0 - soilmd[isoil]);
-								}
-								//else, if the wetting front is below the layer bottom boundary
-								else if(wfe <= elevlayerov[i][j][ilayer-1])
-								{
-									//fraction saturated equals 1.0 (100% saturated)
-									fsaturated = 1.0;
-								}
-								//else, the wetting front is within this layer
-								else
-								{
-									//calculate fraction saturation of the layer
-									fsaturated = (float)(((elevlayerov[i][j][ilayer]- wfe) * 1.0
-										+ (wfe - elevlayerov[i][j][ilayer-1]) * (1.0 - soilmd[isoil]))
-										/ (elevlayerov[i][j][ilayer] - elevlayerov[i][j][ilayer-1]));
-
-								}	//end if/else if/else wfe >= elevlayerov[][][]...
-							}
-							else	//infiltration is not simulated (infopt = 0)
-							{
-								//set fraction saturated equals to zero
-								fsaturated = 0.0;
-
-							}	//end if infopt > 0
-
-							//calculate water filled porosity (volume water / total volume)
-							phi = fsaturated * porosityov[isoil];
-
 							//loop over number of solids types
 							for(isolid=1; isolid<=nsolids; isolid++)
 							{
@@ -407,54 +396,64 @@ void OverlandChemicalPartitioning()
 								//       inorganic chemicals.  Organics partition
 								//       on a cabon normalized basis.  Inorganics
 								//       partition on a solids basis.  This code
-								//       works for either case.  Partitioning in
-								//       the sediments is always independent
-								//       of particle concentration (i.e. never use
-								//       DiToro particle interaction model).
+								//       works for either case and also accounts
+								//       for particle dependent partitioning.
 								//
 								//if the chemical partitions to organic carbon
 								if(partopt[ichem]> 1)
 								{
 									//set the fraction (particulate) organic carbon
-									fpoc = fpocov[isolid][i][j][ilayer];
+									fpoc = fpocov[isolid][i][j][0];
 
 									//set the solids independent partition coefficient (m3/g)
 									pic0 = koc[ichem];
 
 									//set the particulate organic carbon (poc) concentration (g/m3 = mg/L))
-									m[isolid] = csedov[isolid][i][j][ilayer] * fpoc;
+									m[isolid] = csedov[isolid][i][j][0] * fpoc;
 								}
 								else	//else the chemical partitions to solids
 								{
+									//Developer's Note:  The water column partition coefficient
+									//                   could be assigned as a separate variable
+									//                   to distinguish it from the sediment bed
+									//                   partition coefficient...
+									//
+									//                   Change from kp[] to kpw[] and kps[]...
+									//
 									//set the solids independent partition coefficient (m3/g)
 									pic0 = kp[ichem];
 
 									//set the solids concentration (g/m3 = mg/L)
-									m[isolid] =  csedov[isolid][i][j][ilayer];
+									m[isolid] =  csedov[isolid][i][j][0];
 
 								}	//end if partopt[]
 
 								//Adjust partition coefficient for porosity
 								//
-								//if the soil layer porosity > 0.0
-								if(phi > 0.0)
+								//Note:  For the water column, the partition coefficient must
+								//       be adjusted by porosity because "m" is on a total
+								//       (bulk) volume basis (i.e. volume water plus volume
+								//       solids) and the partition coefficient is defined as
+								//       mass chemical / volume water.
+								//
+								//if the water column porosity > 0.0
+								if(wcporosity > 0.0)
 								{
 									//correct partition coeffificent for porosity
-									pic0 = pic0 / phi;
+									pic0 = pic0 / wcporosity;
 								}
-								else	//else phi <= 0 (phi can never really be < 0...)
+								else	//else wcporosity <= 0
 								{
 									//set the partition coefficient to effective infinity
 									pic0 = (float)(1.0e30);
 
-								}	//end if porosityov[isoil] > 0.0
+								}	//end if wcporosity > 0.0
 
-								//Note:  For the sediment column, the particle independent
-								//       partition coefficient is used (never use DiToro
-								//       particle interaction model)...
+								//Note:  For the water column, the particle dependent
+								//       partition coefficient is used...
 								//
-								//Compute the (particle independent) partition coefficient (m3/g)
-								pic[isolid] = pic0;
+								//Compute the particle dependent partition coefficient (m3/g)
+								pic[isolid] = (float)(pic0 / (1.0 + m[isolid] * pic0 /nux[ichem]));
 
 								//compute the sum of pic * m (used to compute fparticulate)
 								sumpicm = sumpicm + pic[isolid] * m[isolid];
@@ -467,13 +466,14 @@ void OverlandChemicalPartitioning()
 							if(partopt[ichem]> 1)
 							{
 								//set the effective fraction of doc for binding
-								fdoc = fdocov[i][j][ilayer];
+								fdoc = fdocov[i][j][0];
 
 								//set the organic binding coefficient (m3/g)
 								pib = koc[ichem];
 
-								//set the effective dissolved organic compound (doc) concentration (g/m3 = mg/L)
-								b = cdocov[i][j][ilayer] * fdoc;
+								//set the dissolved organic compound (doc) concentration (g/m3 = mg/L)
+								b = cdocov[i][j][0] * fdoc;
+
 							}
 							else	//else the chemical partitions to solids
 							{
@@ -481,41 +481,41 @@ void OverlandChemicalPartitioning()
 								pib = kb[ichem];
 
 								//set the dissolved organic compound (doc) concentration (g/m3 = mg/L)
-								b =  cdocov[i][j][ilayer];
+								b =  cdocov[i][j][0];
 
 							}	//end if partopt[] > 1
 
-							//Adjust binding coefficient for water-filled porosity
-							//
-							//Note:  In soilss, DOC concentrations are reported on
-							//       a pore volume basis: mass DOC / volume water.
-							//       The binding coefficient must be adjusted for the
-							//       fraction of the pore space that is filled with
-							//       water because the soil may not be 100% saturated.
+							//Adjust binding coefficient for porosity
 							//
-							//if the water-filled porosity (phi) > 0.0
-							if(phi > 0.0)
+							//if the water column porosity > 0.0
+							if(wcporosity > 0.0)
 							{
-								//correct binding coeffificent for saturation
-								pib = pib / phi;
+								//Note:  For the water column, the binding coefficient must
+								//       be adjusted by porosity because "b" is on a total
+								//       (bulk) volume basis (i.e. volume water plus volume
+								//       solids) and the binding coefficient is defined as
+								//       mass chemical / volume water.
+								//   
+								//correct binding coeffificent for porosity
+								pib = pib / wcporosity;
 							}
-							else	//else saturation <= 0
+							else	//else wcporosity <= 0
 							{
 								//set the binding coefficient to zero
 								pib = 0.0;
 
-							}	//end if phi > 0.0
+							}	//end if wcporosity > 0.0
 
 							//loop over number of solids types
 							for(isolid=1; isolid<=nsolids; isolid++)
 							{
 								//compute the fraction of the chemical sorbed to this solids type
-								fparticulateov[ichem][isolid][i][j][ilayer] = (float)(pic[isolid] * m[isolid]
-									/ (phi + pib * b + sumpicm));
+								fparticulateov[ichem][isolid][i][j][0] = (float)(pic[isolid] * m[isolid]
+									/ (1.0 + pib * b + sumpicm));
 
 								//compute sum of all particulate phases
 								sumfp = sumfp
-									+ fparticulateov[ichem][isolid][i][j][ilayer];
+									+ fparticulateov[ichem][isolid][i][j][0];
 
 							}	//end loop over solids
 
@@ -532,8 +532,8 @@ void OverlandChemicalPartitioning()
 								for(isolid=1; isolid<=nsolids; isolid++)
 								{
 									//scale the fraction of the chemical sorbed to this solids type
-									fparticulateov[ichem][isolid][i][j][ilayer] = (float)(1.0 / sumfp)
-										* fparticulateov[ichem][isolid][i][j][ilayer];
+									fparticulateov[ichem][isolid][i][j][0] = (float)(1.0 / sumfp)
+										* fparticulateov[ichem][isolid][i][j][0];
 
 								}	//end loop over solids
 
@@ -543,11 +543,183 @@ void OverlandChemicalPartitioning()
 							}	//end if sumfp > 1.0
 
 							//compute the fraction of the chemical sorbed to doc
-							fboundov[ichem][i][j][ilayer] = (float)(pib * b / (phi + pib * b + sumpicm));
+							fboundov[ichem][i][j][0] = (float)(pib * b / (1.0 + pib * b + sumpicm));
 
 							//compute the dissolved fraction of the chemical
-							fdissolvedov[ichem][i][j][ilayer] = (float)(1.0 - sumfp
-								- fboundov[ichem][i][j][ilayer]);
+							fdissolvedov[ichem][i][j][0] = (float)(1.0 - sumfp
+								- fboundov[ichem][i][j][0]);
+
+						}	//end if partlayer[0]
+
+						//Soil Column...
+						//
+						//loop over layers (in reverse order: top down)
+						for(ilayer=nstackov[i][j]; ilayer>=1; ilayer--)
+						{
+							//if the layer is partitioned
+							if(partlayer[ilayer])
+							{
+								//Particulate phases:
+								//
+								//initialize the sum of pic * m (used to compute fparticulate)
+								sumpicm = 0.0;
+
+								//initialize the sum of all particulate fractions
+								sumfp = 0.0;
+
+								//set the water-filled porosity of the layer (volume water / total volume)
+								phi = philayer[ilayer];
+
+								//loop over number of solids types
+								for(isolid=1; isolid<=nsolids; isolid++)
+								{
+									//Note:  Partitioning is generalized for organic or
+									//       inorganic chemicals.  Organics partition
+									//       on a cabon normalized basis.  Inorganics
+									//       partition on a solids basis.  This code
+									//       works for either case.  Partitioning in
+									//       the sediments is always independent
+									//       of particle concentration (i.e. never use
+									//       DiToro particle interaction model).
+									//
+									//if the chemical partitions to organic carbon
+									if(partopt[ichem]> 1)
+									{
+										//set the fraction (particulate) organic carbon
+										fpoc = fpocov[isolid][i][j][ilayer];
+
+										//set the solids independent partition coefficient (m3/g)
+										pic0 = koc[ichem];
+
+										//set the particulate organic carbon (poc) concentration (g/m3 = mg/L))
+										m[isolid] = csedov[isolid][i][j][ilayer] * fpoc;
+									}
+									else	//else the chemical partitions to solids
+									{
+										//set the solids independent partition coefficient (m3/g)
+										pic0 = kp[ichem];
+
+										//set the solids concentration (g/m3 = mg/L)
+										m[isolid] =  csedov[isolid][i][j][ilayer];
+
+									}	//end if partopt[]
+
+									//Adjust partition coefficient for porosity
+									//
+									//if the soil layer porosity > 0.0
+									if(phi > 0.0)
+									{
+										//correct partition coeffificent for porosity
+										pic0 = pic0 / phi;
+									}
+									else	//else phi <= 0 (phi can never really be < 0...)
+									{
+										//set the partition coefficient to effective infinity
+										pic0 = (float)(1.0e30);
+
+									}	//end if porosityov[isoil] > 0.0
+
+									//Note:  For the sediment column, the particle independent
+									//       partition coefficient is used (never use DiToro
+									//       particle interaction model)...
+									//
+									//Compute the (particle independent) partition coefficient (m3/g)
+									pic[isolid] = pic0;
+
+									//compute the sum of pic * m (used to compute fparticulate)
+									sumpicm = sumpicm + pic[isolid] * m[isolid];
+
+								}	//end loop over solids
+
+								//Bound phase:
+								//
+								//if the chemical partitions to organic carbon
+								if(partopt[ichem]> 1)
+								{
+									//set the effective fraction of doc for binding
+									fdoc = fdocov[i][j][ilayer];
+
+									//set the organic binding coefficient (m3/g)
+									pib = koc[ichem];
+
+									//set the effective dissolved organic compound (doc) concentration (g/m3 = mg/L)
+									b = cdocov[i][j][ilayer] * fdoc;
+								}
+								else	//else the chemical partitions to solids
+								{
+									//set the organic binding coefficient (m3/g)
+									pib = kb[ichem];
+
+									//set the dissolved organic compound (doc) concentration (g/m3 = mg/L)
+									b =  cdocov[i][j][ilayer];
+
+								}	//end if partopt[] > 1
+
+								//Adjust binding coefficient for water-filled porosity
+								//
+								//Note:  In soilss, DOC concentrations are reported on
+								//       a pore volume basis: mass DOC / volume water.
+								//       The binding coefficient must be adjusted for the
+								//       fraction of the pore space that is filled with
+								//       water because the soil may not be 100% saturated.
+								//
+								//if the water-filled porosity (phi) > 0.0
+								if(phi > 0.0)
+								{
+									//correct binding coeffificent for saturation
+									pib = pib / phi;
+								}
+								else	//else saturation <= 0
+								{
+									//set the binding coefficient to zero
+									pib = 0.0;
+
+								}	//end if phi > 0.0
+
+								//loop over number of solids types
+								for(isolid=1; isolid<=nsolids; isolid++)
+								{
+									//compute the fraction of the chemical sorbed to this solids type
+									fparticulateov[ichem][isolid][i][j][ilayer] = (float)(pic[isolid] * m[isolid]
+										/ (phi + pib * b + sumpicm));
+
+									//compute sum of all particulate phases
+									sumfp = sumfp
+										+ fparticulateov[ichem][isolid][i][j][ilayer];
+
+								}	//end loop over solids
+
+								//Note:  Watch out for roundoff errors.  For large
+								//       Kp values, the sum of particulate fractions
+								//       can be > 1.0 (i.e. 1.0000001).  When this
+								//       occurs individual values need to be scaled
+								//       and the sum reset to exactly 1.0.
+								//
+								//if the sum of particulate fractions (sumfp) > 1.0
+								if(sumfp > 1.0)
+								{
+									//loop over number of solids types
+									for(isolid=1; isolid<=nsolids; isolid++)
+									{
+										//scale the fraction of the chemical sorbed to this solids type
+										fparticulateov[ichem][isolid][i][j][ilayer] = (float)(1.0 / sumfp)
+											* fparticulateov[ichem][isolid][i][j][ilayer];
+
+									}	//end loop over solids
+
+									//reset sum of all particulate phases to exactly 1.0
+									sumfp = (float)(1.0);
+
+								}	//end if sumfp > 1.0
+
+								//compute the fraction of the chemical sorbed to doc
+								fboundov[ichem][i][j][ilayer] = (float)(pib * b / (phi + pib * b + sumpicm));
+
+								//compute the dissolved fraction of the chemical
+								fdissolvedov[ichem][i][j][ilayer] = (float)(1.0 - sumfp
+									- fboundov[ichem][i][j][ilayer]);
+
+							}	//end if partlayer[ilayer]
 
 						}	//end loop over layers
 
@@ -564,6 +736,8 @@ void OverlandChemicalPartitioning()
 	//Deallocate memory for local arrays
 	free(pic);
 	free(m);
+	free(partlayer);
+	free(philayer);
 
 //End of function: Return to ChemicalTransport
 }
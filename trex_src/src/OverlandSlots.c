@@ -0,0 +1,179 @@
+/*----------------------------------------------------------------------
+C-  File:       OverlandSlots.c
+C-
+C-  Purpose/    Concatenated group of functions to allocate the
+C-  Methods:    source/direction slots of overland flux arrays (dqovin,
+C-              dqovout, dqovinvol, dqovoutvol, sfov, advinflowov,
+C-              advoutflowov, dspflowov and the solids and chemical
+C-              advection and dispersion fluxes and masses).
+C-
+C-              Overland transport only uses Sources 0 (point sources),
+C-              1, 3, 5, 7 (N, E, S, W), 9 (floodplain) and 10 (outlet)
+C-              so each cell stores NOVSLOTS compact slots addressed
+C-              through OVSLOT(source) instead of 11 slots.  The slots
+C-              of all domain cells in a row are stored in one block:
+C-              array[row][col] points into the block and array[row][0]
+C-              holds the block itself (free(array[row][0]) releases all
+C-              slots of the row).  Cells outside the domain get NULL.
+C-
+C-              Channel flux arrays keep their 11 slots (channel nodes
+C-              use Sources 0-10).
+C-
+C-  Function
+C-   Listing:   AllocateOverlandSlots, AllocateOverlandSlotsDouble
+C-
+C-  Inputs:     imask
+C-
+C-  Outputs:    None
+C-
+C-  Controls:   None
+C-
+C-  Calls:      None
+C-
+C-  Called by:  InitializeWater, InitializeSolids, InitializeChemical
+C-
+C-  Created:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revised:
+C-
+C-  Date:
+C-
+C-  Revisions:
+C-
+C----------------------------------------------------------------------*/
+
+//trex general variable declarations
+#include "trex_general_declarations.h"
+
+//trex global variable declarations for water transport
+#include "trex_water_declarations.h"
+
+//C
+//C
+			/*******************************************/
+			/*   FUNCTION: AllocateOverlandSlots       */
+			/*******************************************/
+
+/* Allocates zeroed slots (float) for all domain cells of one grid row */
+
+void AllocateOverlandSlots(float **slots, int row)
+{
+	//local variable declarations
+	int
+		col,		//column index
+		ncells;		//number of domain cells in the row
+
+	float
+		*block;		//slot storage for the row
+
+	//count the domain cells in the row
+	ncells = 0;
+
+	//loop over columns
+	for(col=1; col<=ncols; col++)
+	{
+		//if the cell is in the domain
+		if(imask[row][col] != nodatavalue)
+		{
+			//count the cell
+			ncells = ncells + 1;
+
+		}	//end if imask[][] != nodatavalue
+
+	}	//end loop over columns
+
+	//allocate the slots of all domain cells (at least one cell so the block is never NULL)
+	block = (float *)calloc((ncells + 1) * NOVSLOTS, sizeof(float));
+
+	//store the block in column zero (unused by the grid)
+	slots[0] = block;
+
+	//loop over columns
+	for(col=1; col<=ncols; col++)
+	{
+		//if the cell is in the domain
+		if(imask[row][col] != nodatavalue)
+		{
+			//point the cell to its slots
+			slots[col] = block;
+
+			//advance to the slots of the next domain cell
+			block = block + NOVSLOTS;
+		}
+		else	//else the cell is not in the domain
+		{
+			//the cell has no slots
+			slots[col] = NULL;
+
+		}	//end if imask[][] != nodatavalue
+
+	}	//end loop over columns
+
+//End of function: Return to calling module
+}
+
+//C
+//C
+			/*******************************************/
+			/*   FUNCTION: AllocateOverlandSlotsDouble */
+			/*******************************************/
+
+/* Allocates zeroed slots (double) for all domain cells of one grid row */
+
+void AllocateOverlandSlotsDouble(double **slots, int row)
+{
+	//local variable declarations
+	int
+		col,		//column index
+		ncells;		//number of domain cells in the row
+
+	double
+		*block;		//slot storage for the row
+
+	//count the domain cells in the row
+	ncells = 0;
+
+	//loop over columns
+	for(col=1; col<=ncols; col++)
+	{
+		//if the cell is in the domain
+		if(imask[row][col] != nodatavalue)
+		{
+			//count the cell
+			ncells = ncells + 1;
+
+		}	//end if imask[][] != nodatavalue
+
+	}	//end loop over columns
+
+	//allocate the slots of all domain cells (at least one cell so the block is never NULL)
+	block = (double *)calloc((ncells + 1) * NOVSLOTS, sizeof(double));
+
+	//store the block in column zero (unused by the grid)
+	slots[0] = block;
+
+	//loop over columns
+	for(col=1; col<=ncols; col++)
+	{
+		//if the cell is in the domain
+		if(imask[row][col] != nodatavalue)
+		{
+			//point the cell to its slots
+			slots[col] = block;
+
+			//advance to the slots of the next domain cell
+			block = block + NOVSLOTS;
+		}
+		else	//else the cell is not in the domain
+		{
+			//the cell has no slots
+			slots[col] = NULL;
+
+		}	//end if imask[][] != nodatavalue
+
+	}	//end loop over columns
+
+//End of function: Return to calling module
+}
@@ -42,6 +42,21 @@ C-              loop over loads and reporting stations and make direct
 C-              assignment of values.  Also added overland distributed
 C-              solids loads.
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Overland source/direction slots are addressed
+C-              through OVSLOT (compact overland slot storage).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Load areas are stored for the load cells only
+C-              (swdovarea[isolid][iload][icell]) instead of a full
+C-              grid for each load.
+C-
 C-	Revised:
 C-
 C-	Date:	
@@ -113,10 +128,10 @@ void OverlandSolidsAdvection()
 				if(imask[i][j] != nodatavalue)
 				{
 					//Initialize gross advection influx array for source zero
-					advsedovinflux[isolid][i][j][0] = 0.0;
+					advsedovinflux[isolid][i][j][OVSLOT(0)] = 0.0;
 
 					//Initialize gross advection outflow array for source zero
-					advsedovoutflux[isolid][i][j][0] = 0.0;
+					advsedovoutflux[isolid][i][j][OVSLOT(0)] = 0.0;
 
 				}	//end if imask[][] != nodatavalue
 
@@ -151,7 +166,7 @@ void OverlandSolidsAdvection()
 				//Compute load from flow and concentration...
 				//
 				//if the point source flow is greater >= zero (a source)
-				if(dqovin[i][j][0] >= 0.0)
+				if(dqovin[i][j][OVSLOT(0)] >= 0.0)
 				{
 					//set the inflowing sediment concentration
 					cin[0] = swpovinterp[isolid][k];
@@ -164,7 +179,7 @@ void OverlandSolidsAdvection()
 				}	//end if dqovin >= 0.0
 
 				//compute the load value (g/s)  (could be a source or a sink)
-				load = dqovin[i][j][0] * cin[0]
+				load = dqovin[i][j][OVSLOT(0)] * cin[0]
 					* (float)(1000.0 / 86400.0);
 
 			}	//end if swpovopt = 0
@@ -173,13 +188,13 @@ void OverlandSolidsAdvection()
 			if(load >= 0.0)
 			{
 				//compute the inflowing sediment flux (g/s)
-				advsedovinflux[isolid][i][j][0] = advsedovinflux[isolid][i][j][0]
+				advsedovinflux[isolid][i][j][OVSLOT(0)] = advsedovinflux[isolid][i][j][OVSLOT(0)]
 					+ load;
 			}
 			else	//else the load is negative (a sink)
 			{
 				//compute the outflowing sediment flux (g/s)
-				advsedovoutflux[isolid][i][j][0] = advsedovoutflux[isolid][i][j][0]
+				advsedovoutflux[isolid][i][j][OVSLOT(0)] = advsedovoutflux[isolid][i][j][OVSLOT(0)]
 					+ load;
 
 			}	//end if load >= 0.0
@@ -212,20 +227,20 @@ void OverlandSolidsAdvection()
 				//       use of the net rainfall.
 				//
 				//compute the load value (g/s) (could be a source or a sink)
-				load = swdovinterp[isolid][k] * swdovarea[isolid][k][i][j]
+				load = swdovinterp[isolid][k] * swdovarea[isolid][k][icell]
 					* netrainrate[i][j] * (float)(1000.0);
 
 				//if the load is positive (a source)
 				if(load >= 0.0)
 				{
 					//compute the inflowing sediment flux (g/s)
-					advsedovinflux[isolid][i][j][0] = advsedovinflux[isolid][i][j][0]
+					advsedovinflux[isolid][i][j][OVSLOT(0)] = advsedovinflux[isolid][i][j][OVSLOT(0)]
 						+ load;
 				}
 				else	//else the load is negative (a sink)
 				{
 					//compute the outflowing sediment flux (g/s)
-					advsedovoutflux[isolid][i][j][0] = advsedovoutflux[isolid][i][j][0]
+					advsedovoutflux[isolid][i][j][OVSLOT(0)] = advsedovoutflux[isolid][i][j][OVSLOT(0)]
 						+ load;
 
 				}	//end if load >= 0.0
@@ -251,10 +266,10 @@ void OverlandSolidsAdvection()
 				for(k=1; k<=7; k=k+2)
 				{
 					//Initialize gross advection inflow array
-					advinflowov[i][j][k] = 0.0;
+					advinflowov[i][j][OVSLOT(k)] = 0.0;
 
 					//Initialize gross advection outflow array
-					advoutflowov[i][j][k] = 0.0;
+					advoutflowov[i][j][OVSLOT(k)] = 0.0;
 
 					//initialize inflowing concentration array
 					cin[k] = 0.0;
@@ -305,10 +320,10 @@ void OverlandSolidsAdvection()
 				for(k=1; k<=7; k=k+2)
 				{
 					//multiply advective inflow by the process scale factor
-					advinflowov[i][j][k] = dqovin[i][j][k] * advovscale;
+					advinflowov[i][j][OVSLOT(k)] = dqovin[i][j][OVSLOT(k)] * advovscale;
 
 					//multiply advective outflow by the process scale factor
-					advoutflowov[i][j][k] = dqovout[i][j][k] * advovscale;
+					advoutflowov[i][j][OVSLOT(k)] = dqovout[i][j][OVSLOT(k)] * advovscale;
 
 				}	//end loop over overland sources
 
@@ -406,10 +421,10 @@ void OverlandSolidsAdvection()
 					for(k=1; k<=7; k=k+2)
 					{
 						//compute the inflowing sediment flux (g/s)
-						advsedovinflux[isolid][i][j][k] = advinflowov[i][j][k] * cin[k];
+						advsedovinflux[isolid][i][j][OVSLOT(k)] = advinflowov[i][j][OVSLOT(k)] * cin[k];
 
 						//compute the outflowing sediment flux (g/s)
-						advsedovoutflux[isolid][i][j][k] = advoutflowov[i][j][k]
+						advsedovoutflux[isolid][i][j][OVSLOT(k)] = advoutflowov[i][j][OVSLOT(k)]
 							* csedov[isolid][i][j][0];
 
 					}	//end loop over overland sources
@@ -428,14 +443,14 @@ void OverlandSolidsAdvection()
 					//
 					//compute the solids outflow potential (g) (source 0)
 					potential = potential
-						+ advsedovoutflux[isolid][i][j][0] * dt[idt];
+						+ advsedovoutflux[isolid][i][j][OVSLOT(0)] * dt[idt];
 
 					//loop over sources (sources 1, 3, 5, and 7)
 					for(k=1; k<=7; k=k+2)
 					{
 						//compute the solids outflow potential (g)
 						potential = potential
-							+ advsedovoutflux[isolid][i][j][k] * dt[idt];
+							+ advsedovoutflux[isolid][i][j][OVSLOT(k)] * dt[idt];
 
 					}	//end loop over sources 1,3,5,7
 
@@ -462,15 +477,15 @@ void OverlandSolidsAdvection()
 					if(potential > available)
 					{
 						//scale the solids advection outflux (g/s) (source 0)
-						advsedovoutflux[isolid][i][j][0] = (float)(available / potential
-								* advsedovoutflux[isolid][i][j][0]);
+						advsedovoutflux[isolid][i][j][OVSLOT(0)] = (float)(available / potential
+								* advsedovoutflux[isolid][i][j][OVSLOT(0)]);
 
 						//loop over sources (1,3,5,7)
 						for(k=1; k<=7; k=k+2)
 						{
 							//scale the chemical advection outflux (g/s)
-							advsedovoutflux[isolid][i][j][k] = (float)(available / potential
-									* advsedovoutflux[isolid][i][j][k]);
+							advsedovoutflux[isolid][i][j][OVSLOT(k)] = (float)(available / potential
+									* advsedovoutflux[isolid][i][j][OVSLOT(k)]);
 
 						}	//end loop over sources
 
@@ -526,11 +541,11 @@ void OverlandSolidsAdvection()
 		//Scale advective flows...
 		//
 		//multiply advective inflow by the process scale factor
-		advinflowov[iout[i]][jout[i]][10] = dqovin[iout[i]][jout[i]][10]
+		advinflowov[iout[i]][jout[i]][OVSLOT(10)] = dqovin[iout[i]][jout[i]][OVSLOT(10)]
 			* advovscale;
 
 		//multiply advective outflow by the process scale factor
-		advoutflowov[iout[i]][jout[i]][10] = dqovout[iout[i]][jout[i]][10]
+		advoutflowov[iout[i]][jout[i]][OVSLOT(10)] = dqovout[iout[i]][jout[i]][OVSLOT(10)]
 			* advovscale;
 
 		//loop over number of solids types
@@ -590,12 +605,12 @@ void OverlandSolidsAdvection()
 			//Source 10: domain boundary
 			//
 			//compute the inflowing sediment flux (g/s)
-			advsedovinflux[isolid][iout[i]][jout[i]][10] =
-				advinflowov[iout[i]][jout[i]][10] * cin[10];
+			advsedovinflux[isolid][iout[i]][jout[i]][OVSLOT(10)] =
+				advinflowov[iout[i]][jout[i]][OVSLOT(10)] * cin[10];
 
 			//compute the outflowing sediment flux (g/s)
-			advsedovoutflux[isolid][iout[i]][jout[i]][10] =
-				advoutflowov[iout[i]][jout[i]][10]
+			advsedovoutflux[isolid][iout[i]][jout[i]][OVSLOT(10)] =
+				advoutflowov[iout[i]][jout[i]][OVSLOT(10)]
 				* csedov[isolid][iout[i]][jout[i]][0];
 
 			//Determine if outflow potential exceeds available mass...
@@ -603,14 +618,14 @@ void OverlandSolidsAdvection()
 			//Compute the solids advective outflow potential...
 			//
 			//potential (g) for domain outflow (source 10)
-			potential = advsedovoutflux[isolid][iout[i]][jout[i]][10] * dt[idt];
+			potential = advsedovoutflux[isolid][iout[i]][jout[i]][OVSLOT(10)] * dt[idt];
 
 			//Compute overland outflux (Sources 0, 1, 3, 5, and 7)
-			outflux = advsedovoutflux[isolid][iout[i]][jout[i]][0]
-				+ advsedovoutflux[isolid][iout[i]][jout[i]][1]
-				+ advsedovoutflux[isolid][iout[i]][jout[i]][3]
-				+ advsedovoutflux[isolid][iout[i]][jout[i]][5]
-				+ advsedovoutflux[isolid][iout[i]][jout[i]][7];
+			outflux = advsedovoutflux[isolid][iout[i]][jout[i]][OVSLOT(0)]
+				+ advsedovoutflux[isolid][iout[i]][jout[i]][OVSLOT(1)]
+				+ advsedovoutflux[isolid][iout[i]][jout[i]][OVSLOT(3)]
+				+ advsedovoutflux[isolid][iout[i]][jout[i]][OVSLOT(5)]
+				+ advsedovoutflux[isolid][iout[i]][jout[i]][OVSLOT(7)];
 
 			//compute the mass available for advection (g)
 			available = csedov[isolid][iout[i]][jout[i]][0] * watervol
@@ -638,8 +653,8 @@ void OverlandSolidsAdvection()
 				//scale the domain boundary...
 				//
 				//scale the chemical advection outflux (g/s)
-				advsedovoutflux[isolid][iout[i]][jout[i]][10] = (float)(available / potential
-					* advsedovoutflux[isolid][iout[i]][jout[i]][10]);
+				advsedovoutflux[isolid][iout[i]][jout[i]][OVSLOT(10)] = (float)(available / potential
+					* advsedovoutflux[isolid][iout[i]][jout[i]][OVSLOT(10)]);
 
 			}	//end if potential > available
 
@@ -13,12 +13,13 @@ C-              depsedovinflux[][][][], depsedovoutflux[][][][],
 C-              erssedovinflux[][][][], erssedovoutflux[][][][],
 C-              channel properties, cell properties
 C-
-C-  Outputs:    csedovnew[][][][], sedreportov[][], popovflag,
-C-              pushovflag
+C-  Outputs:    csedovnew[][][][], sedreportov[][], npopov, popovrow[],
+C-              popovcol[], npushov, pushovrow[], pushovcol[],
+C-              mbsolidsstep[][]
 C-
 C-  Controls:   imask[][]
 C-
-C-  Calls:      SimulationError
+C-  Calls:      RejectStep, SimulationError, ClearSolidsMassBalanceStep
 C-
 C-  Called by:  SolidsBalance
 C-
@@ -45,6 +46,45 @@ C-
 C-	Revisions:	Reorganized code to store concentrations at reporting
 C-              stations.  Moved loop over stations to end of module.
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Overland source/direction slots are addressed
+C-              through OVSLOT (compact overland slot storage).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Mass accounting: cumulative budgets accumulated in
+C-              double (no float casts), dispersion budgets only
+C-              when dispersion is simulated, and external loads
+C-              added to per-step totals summed by MassAccounting.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Replaced stack pop/push flags with work lists of
+C-              flagged cells and nodes.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Time steps with a negative depth or concentration
+C-              are rejected (RejectStep) when step recovery is
+C-              enabled.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	The water column and bed masses and the erosion and
+C-              deposition masses of each step are added to the
+C-              streamed solids mass balance (mbsolidsstep).
+C-
 C-	Revised:
 C-
 C-	Date:	
@@ -118,6 +158,9 @@ void OverlandSolidsConcentration()
 	//set density of water = 1000 kg/m3
 	densityw = (float)(1000.0);
 
+	//clear the overland solids mass balance terms of this attempt (see MassBalanceMonitor)
+	ClearSolidsMassBalanceStep(1, NMSOVTERMS);
+
 	//Loop over rows
 	for(i=1; i<=nrows; i++)
 	{
@@ -204,30 +247,30 @@ void OverlandSolidsConcentration()
 					//
 					//compute advection influx term (g/s)
 					advectionin = advectionin
-						+ advsedovinflux[isolid][i][j][0];
+						+ advsedovinflux[isolid][i][j][OVSLOT(0)];
 
 					//compute advection outflux term (g/s)
 					advectionout = advectionout
-						+ advsedovoutflux[isolid][i][j][0];
+						+ advsedovoutflux[isolid][i][j][OVSLOT(0)];
 
 					//loop over sources (1,3,5,7)
 					for(k=1; k<=7; k=k+2)
 					{
 						//compute advection influx term (g/s)
 						advectionin = advectionin
-							+ advsedovinflux[isolid][i][j][k];
+							+ advsedovinflux[isolid][i][j][OVSLOT(k)];
 
 						//compute advection outflux term (g/s)
 						advectionout = advectionout
-							+ advsedovoutflux[isolid][i][j][k];
+							+ advsedovoutflux[isolid][i][j][OVSLOT(k)];
 
 						//compute dispersion influx term (g/s)
 						dispersionin = dispersionin
-							+ dspsedovinflux[isolid][i][j][k];
+							+ dspsedovinflux[isolid][i][j][OVSLOT(k)];
 
 						//compute dispersion outflux term (g/s)
 						dispersionout = dispersionout
-							+ dspsedovoutflux[isolid][i][j][k];
+							+ dspsedovoutflux[isolid][i][j][OVSLOT(k)];
 
 					}	//end loop over sources
 
@@ -241,19 +284,19 @@ void OverlandSolidsConcentration()
 					{
 						//compute advection influx term (g/s)
 						advectionin = advectionin
-							+ advsedovinflux[isolid][i][j][9];
+							+ advsedovinflux[isolid][i][j][OVSLOT(9)];
 
 						//compute advection outflux term (g/s)
 						advectionout = advectionout
-							+ advsedovoutflux[isolid][i][j][9];
+							+ advsedovoutflux[isolid][i][j][OVSLOT(9)];
 
 						//compute dispersion influx term (g/s)
 						dispersionin = dispersionin
-							+ dspsedovinflux[isolid][i][j][9];
+							+ dspsedovinflux[isolid][i][j][OVSLOT(9)];
 
 						//compute dispersion outflux term (g/s)
 						dispersionout = dispersionout
-							+ dspsedovoutflux[isolid][i][j][9];
+							+ dspsedovoutflux[isolid][i][j][OVSLOT(9)];
 
 					}	//end if imask[][] > 1
 
@@ -264,19 +307,19 @@ void OverlandSolidsConcentration()
 					//
 					//compute advection influx term (g/s)
 					advectionin = advectionin
-						+ advsedovinflux[isolid][i][j][10];
+						+ advsedovinflux[isolid][i][j][OVSLOT(10)];
 
 					//compute advection outflux term (g/s)
 					advectionout = advectionout
-						+ advsedovoutflux[isolid][i][j][10];
+						+ advsedovoutflux[isolid][i][j][OVSLOT(10)];
 
 					//compute dispersion influx term (g/s)
 					dispersionin = dispersionin
-						+ dspsedovinflux[isolid][i][j][10];
+						+ dspsedovinflux[isolid][i][j][OVSLOT(10)];
 
 					//compute dispersion outflux term (g/s)
 					dispersionout = dispersionout
-						+ dspsedovoutflux[isolid][i][j][10];
+						+ dspsedovoutflux[isolid][i][j][OVSLOT(10)];
 
 					//Remaining sources...
 					//
@@ -331,53 +374,64 @@ void OverlandSolidsConcentration()
 					//
 					//compute cumulative sediment mass leaving water column by deposition (kg)
 					depsedovoutmass[isolid][i][j][0] = depsedovoutmass[isolid][i][j][0]
-						+ (float)(depsedovoutflux[isolid][i][j][0] * dt[idt] / 1000.0);
+						+ depsedovoutflux[isolid][i][j][0] * dt[idt] / 1000.0;
 
 					//compute the cumulative sediment mass entering the sediment bed by deposition (kg)
 					depsedovinmass[isolid][i][j][ilayer] = depsedovinmass[isolid][i][j][ilayer]
-						+ (float)(depsedovinflux[isolid][i][j][ilayer] * dt[idt] / 1000.0);
+						+ depsedovinflux[isolid][i][j][ilayer] * dt[idt] / 1000.0;
 
 					//compute cumulative solids mass leaving the bed (kg)
 					erssedovoutmass[isolid][i][j][ilayer] = erssedovoutmass[isolid][i][j][ilayer]
-						+ (float)(erssedovoutflux[isolid][i][j][ilayer] * dt[idt] / 1000.0);
+						+ erssedovoutflux[isolid][i][j][ilayer] * dt[idt] / 1000.0;
 
 					//compute the cumulative solids mass entering the water column (kg)
 					erssedovinmass[isolid][i][j][0] = erssedovinmass[isolid][i][j][0]
-						+ (float)(erssedovinflux[isolid][i][j][0] * dt[idt] / 1000.0);
+						+ erssedovinflux[isolid][i][j][0] * dt[idt] / 1000.0;
+
+					//add the solids masses entering the water column by erosion and leaving it by deposition to the streamed balance (kg)
+					mbsolidsstep[isolid][MSERSOV] = mbsolidsstep[isolid][MSERSOV]
+						+ erssedovinflux[isolid][i][j][0] * dt[idt] / 1000.0;
+					mbsolidsstep[isolid][MSDEPOV] = mbsolidsstep[isolid][MSDEPOV]
+						+ depsedovoutflux[isolid][i][j][0] * dt[idt] / 1000.0;
 
 					//Compute masses for loads (source = 0)
 					//
 					//compute the cumulative inflowing solids mass (kg)
-					advsedovinmass[isolid][i][j][0] = advsedovinmass[isolid][i][j][0]
-						+ (float)(advsedovinflux[isolid][i][j][0] * dt[idt] / 1000.0);
+					advsedovinmass[isolid][i][j][OVSLOT(0)] = advsedovinmass[isolid][i][j][OVSLOT(0)]
+						+ advsedovinflux[isolid][i][j][OVSLOT(0)] * dt[idt] / 1000.0;
 
 					//compute the cumulative outflowing solids mass (kg)
-					advsedovoutmass[isolid][i][j][0] = advsedovoutmass[isolid][i][j][0]
-						+ (float)(advsedovoutflux[isolid][i][j][0] * dt[idt] / 1000.0);
+					advsedovoutmass[isolid][i][j][OVSLOT(0)] = advsedovoutmass[isolid][i][j][OVSLOT(0)]
+						+ advsedovoutflux[isolid][i][j][OVSLOT(0)] * dt[idt] / 1000.0;
 
-					//Compute the cumulative (net) solids mass entering the domain from a point source (kg)
-					totalswov[isolid] = totalswov[isolid]
-						+ (float)((advsedovinflux[isolid][i][j][0]
-						- advsedovoutflux[isolid][i][j][0]) * dt[idt] / 1000.0);
+					//Compute the (net) solids mass entering the domain from a point source in the current time step (kg)
+					pendingswov[isolid] = pendingswov[isolid]
+						+ (advsedovinflux[isolid][i][j][OVSLOT(0)]
+						- advsedovoutflux[isolid][i][j][OVSLOT(0)]) * dt[idt] / 1000.0;
 
 					//loop over overland sources (1,3,5,7)
 					for(k=1; k<=7; k=k+2)
 					{
 						//compute the cumulative inflowing solids mass (kg)
-						advsedovinmass[isolid][i][j][k] = advsedovinmass[isolid][i][j][k]
-							+ (float)(advsedovinflux[isolid][i][j][k] * dt[idt] / 1000.0);
+						advsedovinmass[isolid][i][j][OVSLOT(k)] = advsedovinmass[isolid][i][j][OVSLOT(k)]
+							+ advsedovinflux[isolid][i][j][OVSLOT(k)] * dt[idt] / 1000.0;
 
 						//compute the cumulative outflowing solids mass (kg)
-						advsedovoutmass[isolid][i][j][k] = advsedovoutmass[isolid][i][j][k]
-							+ (float)(advsedovoutflux[isolid][i][j][k] * dt[idt] / 1000.0);
+						advsedovoutmass[isolid][i][j][OVSLOT(k)] = advsedovoutmass[isolid][i][j][OVSLOT(k)]
+							+ advsedovoutflux[isolid][i][j][OVSLOT(k)] * dt[idt] / 1000.0;
 
-						//compute the cumulative in-dispersing solids mass (kg)
-						dspsedovinmass[isolid][i][j][k] = dspsedovinmass[isolid][i][j][k]
-							+ (float)(dspsedovinflux[isolid][i][j][k] * dt[idt] / 1000.0);
+						//if overland dispersion budgets are tracked (trackdspovmass > 0)
+						if(trackdspovmass > 0)
+						{
+							//compute the cumulative in-dispersing solids mass (kg)
+							dspsedovinmass[isolid][i][j][OVSLOT(k)] = dspsedovinmass[isolid][i][j][OVSLOT(k)]
+								+ dspsedovinflux[isolid][i][j][OVSLOT(k)] * dt[idt] / 1000.0;
 
-						//compute the cumulative out-dispersing solids mass (kg)
-						dspsedovoutmass[isolid][i][j][k] = dspsedovoutmass[isolid][i][j][k]
-							+ (float)(dspsedovoutflux[isolid][i][j][k] * dt[idt] / 1000.0);
+							//compute the cumulative out-dispersing solids mass (kg)
+							dspsedovoutmass[isolid][i][j][OVSLOT(k)] = dspsedovoutmass[isolid][i][j][OVSLOT(k)]
+								+ dspsedovoutflux[isolid][i][j][OVSLOT(k)] * dt[idt] / 1000.0;
+
+						}	//end if trackdspovmass > 0
 
 					}	//end loop over sources
 
@@ -390,20 +444,25 @@ void OverlandSolidsConcentration()
 					if(imask[i][j] > 1)
 					{
 						//compute the cumulative inflowing solids mass (kg)
-						advsedovinmass[isolid][i][j][9] = advsedovinmass[isolid][i][j][9]
-							+ (float)(advsedovinflux[isolid][i][j][9] * dt[idt] / 1000.0);
+						advsedovinmass[isolid][i][j][OVSLOT(9)] = advsedovinmass[isolid][i][j][OVSLOT(9)]
+							+ advsedovinflux[isolid][i][j][OVSLOT(9)] * dt[idt] / 1000.0;
 
 						//compute the cumulative outflowing solids mass (kg)
-						advsedovoutmass[isolid][i][j][9] = advsedovoutmass[isolid][i][j][9]
-							+ (float)(advsedovoutflux[isolid][i][j][9] * dt[idt] / 1000.0);
+						advsedovoutmass[isolid][i][j][OVSLOT(9)] = advsedovoutmass[isolid][i][j][OVSLOT(9)]
+							+ advsedovoutflux[isolid][i][j][OVSLOT(9)] * dt[idt] / 1000.0;
 
-						//compute the cumulative in-dispersing solids mass (kg)
-						dspsedovinmass[isolid][i][j][9] = dspsedovinmass[isolid][i][j][9]
-							+ (float)(dspsedovinflux[isolid][i][j][9] * dt[idt] / 1000.0);
+						//if overland dispersion budgets are tracked (trackdspovmass > 0)
+						if(trackdspovmass > 0)
+						{
+							//compute the cumulative in-dispersing solids mass (kg)
+							dspsedovinmass[isolid][i][j][OVSLOT(9)] = dspsedovinmass[isolid][i][j][OVSLOT(9)]
+								+ dspsedovinflux[isolid][i][j][OVSLOT(9)] * dt[idt] / 1000.0;
 
-						//compute the cumulative out-dispersing solids mass (kg)
-						dspsedovoutmass[isolid][i][j][9] = dspsedovoutmass[isolid][i][j][9]
-							+ (float)(dspsedovoutflux[isolid][i][j][9] * dt[idt] / 1000.0);
+							//compute the cumulative out-dispersing solids mass (kg)
+							dspsedovoutmass[isolid][i][j][OVSLOT(9)] = dspsedovoutmass[isolid][i][j][OVSLOT(9)]
+								+ dspsedovoutflux[isolid][i][j][OVSLOT(9)] * dt[idt] / 1000.0;
+
+						}	//end if trackdspovmass > 0
 
 					}	//end if imask[][] > 1
 
@@ -413,20 +472,25 @@ void OverlandSolidsConcentration()
 					//       an outlet cell...
 					//
 					//compute the cumulative inflowing solids mass (kg)
-					advsedovinmass[isolid][i][j][10] = advsedovinmass[isolid][i][j][10]
-						+ (float)(advsedovinflux[isolid][i][j][10] * dt[idt] / 1000.0);
+					advsedovinmass[isolid][i][j][OVSLOT(10)] = advsedovinmass[isolid][i][j][OVSLOT(10)]
+						+ advsedovinflux[isolid][i][j][OVSLOT(10)] * dt[idt] / 1000.0;
 
 					//compute the cumulative outflowing solids mass (kg)
-					advsedovoutmass[isolid][i][j][10] = advsedovoutmass[isolid][i][j][10]
-						+ (float)(advsedovoutflux[isolid][i][j][10] * dt[idt] / 1000.0);
+					advsedovoutmass[isolid][i][j][OVSLOT(10)] = advsedovoutmass[isolid][i][j][OVSLOT(10)]
+						+ advsedovoutflux[isolid][i][j][OVSLOT(10)] * dt[idt] / 1000.0;
+
+					//if overland dispersion budgets are tracked (trackdspovmass > 0)
+					if(trackdspovmass > 0)
+					{
+						//compute the cumulative in-dispersing solids mass (kg)
+						dspsedovinmass[isolid][i][j][OVSLOT(10)] = dspsedovinmass[isolid][i][j][OVSLOT(10)]
+							+ dspsedovinflux[isolid][i][j][OVSLOT(10)] * dt[idt] / 1000.0;
 
-					//compute the cumulative in-dispersing solids mass (kg)
-					dspsedovinmass[isolid][i][j][10] = dspsedovinmass[isolid][i][j][10]
-						+ (float)(dspsedovinflux[isolid][i][j][10] * dt[idt] / 1000.0);
+						//compute the cumulative out-dispersing solids mass (kg)
+						dspsedovoutmass[isolid][i][j][OVSLOT(10)] = dspsedovoutmass[isolid][i][j][OVSLOT(10)]
+							+ dspsedovoutflux[isolid][i][j][OVSLOT(10)] * dt[idt] / 1000.0;
 
-					//compute the cumulative out-dispersing solids mass (kg)
-					dspsedovoutmass[isolid][i][j][10] = dspsedovoutmass[isolid][i][j][10]
-						+ (float)(dspsedovoutflux[isolid][i][j][10] * dt[idt] / 1000.0);
+					}	//end if trackdspovmass > 0
 
 					//compute total derivative for the water column (g/s)
 					derivative = influx - outflux;
@@ -476,8 +540,13 @@ void OverlandSolidsConcentration()
 						{
 							//Warn user of possible numerical instability (do not abort)
 							//
-							//Report error type (negative concentration overland) and location
-							SimulationError(4, i, j, isolid);
+							//if the time step cannot be rejected (step recovery is off or no retries remain)
+							if(RejectStep(4, i, j, isolid) == 0)
+							{
+								//Report error type (negative concentration overland) and location
+								SimulationError(4, i, j, isolid);
+
+							}	//end if RejectStep() == 0
 
 							//Reset the concentration to exactly zero anyway...
 							csedovnew[isolid][i][j][0] = 0.0;
@@ -486,6 +555,10 @@ void OverlandSolidsConcentration()
 
 					}	//end if newmass < 0.0
 
+					//add the new water column mass to the streamed storage (kg)
+					mbsolidsstep[isolid][MSWATEROV] = mbsolidsstep[isolid][MSWATEROV]
+						+ csedovnew[isolid][i][j][0] * newwatervol / 1000.0;
+
 				}	//end loop over solids
 
 				//Compute new (ending) volume of surface soil layer...
@@ -614,6 +687,11 @@ void OverlandSolidsConcentration()
 
 					}	//end if newsoilvol >= TOLERANCE
 
+					//add the change of surface layer mass to the streamed soil storage (kg)
+					mbsolidsstep[isolid][MSBEDOV] = mbsolidsstep[isolid][MSBEDOV]
+						+ (csedovnew[isolid][i][j][ilayer] * newsoilvol
+						- csedov[isolid][i][j][ilayer] * soilvol) / 1000.0;
+
 				}	//end loop over solids
 
 				//Assign global value of new surface soil layer volume (m3)
@@ -623,8 +701,10 @@ void OverlandSolidsConcentration()
 				//  the maximum volume limit
 				if(newsoilvol >= maxvlayerov[i][j][ilayer])
 				{
-					//raise the push flag for the overland plane
-					pushovflag = 1;
+					//add the cell to the push list for the overland plane (processed by PushSoilStack)
+					npushov = npushov + 1;
+					pushovrow[npushov] = i;
+					pushovcol[npushov] = j;
 
 				}	//end if newsoilvol>= maxvlayerov[][][]
 
@@ -632,8 +712,10 @@ void OverlandSolidsConcentration()
 				//  volume limit and there are more layers in the stack
 				if(newsoilvol <= minvlayerov[i][j][ilayer] && ilayer > 1)
 				{
-					//raise the pop flag for the overland plane
-					popovflag = 1;
+					//add the cell to the pop list for the overland plane (processed by PopSoilStack)
+					npopov = npopov + 1;
+					popovrow[npopov] = i;
+					popovcol[npopov] = j;
 
 				}	//end if newsoilvol >= maxvlayerov[][][]
 
@@ -668,29 +750,34 @@ void OverlandSolidsConcentration()
 			//
 			//Compute the cumulative solids mass exiting the domain at this outlet (kg)
 			totaladvsedoutov[isolid][i] = totaladvsedoutov[isolid][i]
-				+ (float)(advsedovoutflux[isolid][iout[i]][jout[i]][10]
-				* dt[idt] / 1000.0);
+				+ advsedovoutflux[isolid][iout[i]][jout[i]][OVSLOT(10)]
+				* dt[idt] / 1000.0;
 
 			//Compute the cumulative solids mass entering the domain at this outlet (kg)
 			totaladvsedinov[isolid][i] = totaladvsedinov[isolid][i]
-				+ (float)(advsedovinflux[isolid][iout[i]][jout[i]][10]
-				* dt[idt] / 1000.0);
+				+ advsedovinflux[isolid][iout[i]][jout[i]][OVSLOT(10)]
+				* dt[idt] / 1000.0;
 
 			//Dispersion...
 			//
-			//Compute the cumulative solids mass exiting the domain at this outlet (kg)
-			totaldspsedoutov[isolid][i] = totaldspsedoutov[isolid][i]
-				+ (float)(dspsedovoutflux[isolid][iout[i]][jout[i]][10]
-				* dt[idt] / 1000.0);
+			//if overland dispersion budgets are tracked (trackdspovmass > 0)
+			if(trackdspovmass > 0)
+			{
+				//Compute the cumulative solids mass exiting the domain at this outlet (kg)
+				totaldspsedoutov[isolid][i] = totaldspsedoutov[isolid][i]
+					+ dspsedovoutflux[isolid][iout[i]][jout[i]][OVSLOT(10)]
+					* dt[idt] / 1000.0;
 
-			//Compute the cumulative solids mass entering the domain at this outlet (kg)
-			totaldspsedinov[isolid][i] = totaldspsedinov[isolid][i]
-				+ (float)(dspsedovinflux[isolid][iout[i]][jout[i]][10]
-				* dt[idt] / 1000.0);
+				//Compute the cumulative solids mass entering the domain at this outlet (kg)
+				totaldspsedinov[isolid][i] = totaldspsedinov[isolid][i]
+					+ dspsedovinflux[isolid][iout[i]][jout[i]][OVSLOT(10)]
+					* dt[idt] / 1000.0;
+
+			}	//end if trackdspovmass > 0
 
 			//compute sediment discharge (kg/s) (advection plus dispersion)
-			sedflow = (float)((advsedovoutflux[isolid][iout[i]][jout[i]][10]
-				+ dspsedovoutflux[isolid][iout[i]][jout[i]][10]) / 1000.0);
+			sedflow = (float)((advsedovoutflux[isolid][iout[i]][jout[i]][OVSLOT(10)]
+				+ dspsedovoutflux[isolid][iout[i]][jout[i]][OVSLOT(10)]) / 1000.0);
 
 			//Search for peak sediment discharge at this outlet...
 			//
@@ -28,6 +28,22 @@ C-              Denver, CO 80225
 C-
 C-	Date:		29-DEC-2003
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Overland source/direction slots are addressed
+C-              through OVSLOT (compact overland slot storage).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	The kernel takes a range of solids types
+C-              (isolidfirst to isolidlast) so that each solids type
+C-              can be computed as a separate task (see
+C-              SpeciesTasks).
+C-
 C-	Revised:
 C-
 C-	Date:	
@@ -45,7 +61,7 @@ C----------------------------------------------------------------------*/
 //trex global variable declarations for sediment transport
 #include "trex_solids_declarations.h"
 
-void OverlandSolidsDeposition()
+void OverlandSolidsDeposition(int isolidfirst, int isolidlast)
 {
 	//local variable declarations/definitions
 	int
@@ -149,10 +165,10 @@ void OverlandSolidsDeposition()
 				//       at any time: N-W or N-E or S-W or S-E.
 				//
 				//set friction slope (dimensionless)
-				sf = (float)sqrt((pow(sfov[i][j][1], 2.0)	//North component
-					+ pow(sfov[i][j][3], 2.0)				//East component
-					+ pow(sfov[i][j][5], 2.0)				//South component
-					+ pow(sfov[i][j][7], 2.0)));			//West component
+				sf = (float)sqrt((pow(sfov[i][j][OVSLOT(1)], 2.0)	//North component
+					+ pow(sfov[i][j][OVSLOT(3)], 2.0)				//East component
+					+ pow(sfov[i][j][OVSLOT(5)], 2.0)				//South component
+					+ pow(sfov[i][j][OVSLOT(7)], 2.0)));			//West component
 
 				//Compute shear stress...
 				//
@@ -168,7 +184,7 @@ void OverlandSolidsDeposition()
 				ilayer = nstackov[i][j];
 
 				//loop over number of solids types
-				for(isolid=1; isolid<=nsolids; isolid++)
+				for(isolid=isolidfirst; isolid<=isolidlast; isolid++)
 				{
 					//Initialize gross deposition flow array for use this time step
 					depflowov[isolid][i][j] = 0.0;
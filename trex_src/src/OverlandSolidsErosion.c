@@ -48,6 +48,22 @@ C-
 C-  Revisions:  Shear stress partitioning (tau_total to tau_grain)
 C-              using relationship of Al-Hamdan et al. (2012).
 C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Overland source/direction slots are addressed
+C-              through OVSLOT (compact overland slot storage).
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Start the new maximum shear stress of each cell from
+C-              its present shear stress history.  A maximum shear
+C-              stress below the critical shear stress no longer
+C-              gives a NaN erosion amount for cohesive solids.
+C-
 C-  Revised:
 C-
 C-  Date:
@@ -181,10 +197,10 @@ void OverlandSolidsErosion()
 					//       at any time: N-W or N-E or S-W or S-E.
 					//
 					//set friction slope (dimensionless)
-					sf = (float)sqrt((pow(sfov[i][j][1], 2.0)	//North component
-						+ pow(sfov[i][j][3], 2.0)				//East component
-						+ pow(sfov[i][j][5], 2.0)				//South component
-						+ pow(sfov[i][j][7], 2.0)));			//West component
+					sf = (float)sqrt((pow(sfov[i][j][OVSLOT(1)], 2.0)	//North component
+						+ pow(sfov[i][j][OVSLOT(3)], 2.0)				//East component
+						+ pow(sfov[i][j][OVSLOT(5)], 2.0)				//South component
+						+ pow(sfov[i][j][OVSLOT(7)], 2.0)));			//West component
 
 					//Compute total hydrodynamic shear stress...
 					//
@@ -207,6 +223,15 @@ void OverlandSolidsErosion()
 
 				}	//end if ersovopt > 1
 
+				//if the overland erosion option > 2
+				if(ersovopt > 2)
+				{
+					//start from the present shear stress history of the cell
+					newtaumax = taumaxov[i][j];
+					newtautime = taumaxtimeov[i][j];
+
+				}	//end if ersovopt > 2
+
 				//loop over number of solids types
 				for(isolid=1; isolid<=nsolids; isolid++)
 				{
@@ -248,10 +273,15 @@ void OverlandSolidsErosion()
 							if(tau > tceov[isolid] && tau > taumaxov[i][j])
 							{
 								//compute the erosion amount (g/m2)
+								//
+								//  Note: a maximum shear stress below the critical
+								//        shear stress (no prior exposure) has not
+								//        eroded any sediment.
+								//
 								epsilon = (float)(ayov[iland] / zageov[isolid]
 									* pow((tau/tceov[isolid] - 1.0), mexpov[isoil])
 									- ayov[iland] / zageov[isolid]
-									* pow((taumaxov[i][j]/tceov[isolid] - 1.0), mexpov[isoil]));
+									* pow((Max(taumaxov[i][j], tceov[isolid])/tceov[isolid] - 1.0), mexpov[isoil]));
 
 								//store the maximum shear stress (N/m2)
 								newtaumax = tau;
@@ -312,7 +342,7 @@ void OverlandSolidsErosion()
 						//       a loop over Sources 0-8 and 10 if the cell is an outlet.
 						//
 						//loop over sources
-						for(k=0; k<=10; k++)
+						for(k=0; k<NOVSLOTS; k++)
 						{
 							//compute the gross outflux (g/s)
 							outflux = outflux
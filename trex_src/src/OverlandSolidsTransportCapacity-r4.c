@@ -5,13 +5,14 @@ C-  Purpose/    Determines the equilibrium sediment tranport capacity
 C-  Methods:    for each cell in the overland plane
 C-
 C-
-C-  Inputs:     spgravity[], dqovout[][][], hov[][], sfov[][][], ds[]
+C-  Inputs:     spgravity[], dqovout[][][], hov[][], sfov[][][], ds[],
+C-              vcsoilov[][], kuslesoilov[][]
 C-
 C-  Outputs:    transcapov[][][]
 C-
 C-  Controls:   None
 C-
-C-  Calls:      None
+C-  Calls:      BatchPow, BatchPowArray
 C-
 C-  Called by:  SolidsTransport
 C-
@@ -40,6 +41,34 @@ C-              overland transport capcity: qs = k (q-qc) ^ beta * sf ^ gamma.
 C-              Added weighting exponent on dstar to apportion total transport
 C-              capacity into fraction for each solids class simulated.
 C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Loop over cardinal directions only (flow is never
+C-              routed to other directions) and address slots
+C-              through OVSLOT.
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Directions with flow above the critical threshold are
+C-              gathered into batches of up to POWBATCHSIZE.  The power
+C-              laws of a batch are evaluated by BatchPow (or
+C-              BatchPowArray when the exponents vary by land use) and
+C-              the capacities are summed in the original order
+C-              (OverlandCapacityFlows).  The grain size weights
+C-              (dstar^tcwexpov) are computed once by InitializeSolids.
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  The critical velocity and USLE K factor of the
+C-              surface soil layer are read from the surface soil
+C-              parameter grids (vcsoilov, kuslesoilov).
+C-
 C-  Revised:
 C-
 C-  Date:
@@ -57,20 +86,103 @@ C----------------------------------------------------------------------*/
 //trex global variable declarations for sediment transport
 #include "trex_solids_declarations.h"
 
+//Batch of cell directions with flow above the critical threshold
+static int
+	caprow[POWBATCHSIZE],		//row of the cell
+	capcol[POWBATCHSIZE];		//column of the cell
+
+static float
+	capcoef[POWBATCHSIZE];		//total transport capacity coefficient (ktotal)
+
+static double
+	capflow[POWBATCHSIZE],		//q - qc (then (q-qc)^betasov)
+	capslope[POWBATCHSIZE],		//sf (then sf^gammasov)
+	capflowexp[POWBATCHSIZE],	//unit flow exponent (betasov) of the land use
+	capslopeexp[POWBATCHSIZE];	//friction slope exponent (gammasov) of the land use
+
+//C
+//C
+			/*******************************************/
+			/*     FUNCTION: OverlandCapacityFlows     */
+			/*******************************************/
+
+/* Evaluates the transport capacity power laws of a batch and sums the capacities (in batch order) */
+
+static void OverlandCapacityFlows(int ncaps)
+{
+	//local variable declarations/definitions
+	int
+		icap,			//loop index for batch entries
+		row,			//row of the cell
+		col;			//column of the cell
+
+	float
+		qs;				//total (all solids) overland transport capacity (kg/m/s)
+
+	//if the unit flow exponent is the same for all land uses
+	if(powplanbetaov >= 0)
+	{
+		//(q-qc)^betasov with the specialized exponent
+		BatchPow(capflow, ncaps, powplanbetaov);
+	}
+	else	//else the exponent varies by land use
+	{
+		//(q-qc)^betasov with the exponent of each entry
+		BatchPowArray(capflow, capflowexp, ncaps);
+
+	}	//end if powplanbetaov >= 0
+
+	//if the friction slope exponent is the same for all land uses
+	if(powplangammaov >= 0)
+	{
+		//sf^gammasov with the specialized exponent
+		BatchPow(capslope, ncaps, powplangammaov);
+	}
+	else	//else the exponent varies by land use
+	{
+		//sf^gammasov with the exponent of each entry
+		BatchPowArray(capslope, capslopeexp, ncaps);
+
+	}	//end if powplangammaov >= 0
+
+	//Loop over batch entries
+	for(icap=0; icap<ncaps; icap++)
+	{
+		//set the cell of the entry
+		row = caprow[icap];
+		col = capcol[icap];
+
+		//total (all solids) overland transport capacity (kg/m/s)
+		qs = (float)(capcoef[icap] * capflow[icap] * capslope[icap]);
+
+		//total transport capacity (summed over all directions) (g/s)
+		transcapov[0][row][col] = transcapov[0][row][col]
+			+ (float)(qs * w * 1000.0);
+
+	}	//end loop over batch entries
+
+//End of function: OverlandCapacityFlows
+}
+
+//C
+//C
+			/*******************************************/
+			/*  FUNCTION: OverlandSolidsTransportCapacity  */
+			/*******************************************/
+
 void OverlandSolidsTransportCapacity()
 {
 	//local variable declarations/definitions
 	int
-		isoil,			//local index for soil type
 		iland,			//local index for land use classification
 		isolid,			//local index for solids type
-		ilayer;			//index for surface layer in the sediment stack
+		ilayer,			//index for surface layer in the sediment stack
+		ncaps;			//number of cell directions gathered for the next batch
 
 	float
 		sf,				//friction slope (dimensionless)
 		q,				//unit discharge (m2/s)
 		qc,				//critical erosion threshold (unit discharge) (m2/s)
-		qs,				//total (all solids) overland transport capacity (kg/m/s)
 		ktotal,			//overall overland transport capacity coefficient (effectively kg/m/s)
 		fsolids,		//fraction of a solids type in the soil bed (dimensionless)
 		sumcapacity,	//sum of solids transport capacity fractions (dimensionless)
@@ -79,6 +191,16 @@ void OverlandSolidsTransportCapacity()
 	//allocate memory for local arrays
 	fcapacity = (float *)malloc((nsolids+1) * sizeof(float));	//fraction of solids transport capacity (dimensionless)
 
+	//Note:  Cell directions with flow above the critical threshold are
+	//       gathered into a batch.  When the batch is full (and after
+	//       the last cell), the power laws of the batch are evaluated
+	//       and the capacities are summed by OverlandCapacityFlows.
+	//       The total capacity is then apportioned by solids type in
+	//       a second loop over cells...
+	//
+	//no cell directions are gathered yet
+	ncaps = 0;
+
 	//Loop over rows
 	for(i=1; i<=nrows; i++)
 	{
@@ -88,19 +210,13 @@ void OverlandSolidsTransportCapacity()
 			//if the cell is in the domain (is not null)
 			if(imask[i][j] != nodatavalue)
 			{
-				//set the surface soil layer number
-				ilayer = nstackov[i][j];
-
-				//assign soil type for this cell
-				isoil = soiltype[i][j][ilayer];
-
 				//assign land use type for this cell
 				iland = landuse[i][j];
 
 				//See note regarding K-R equation (below)...
 				//
-				//assign critical erosion threshold for this cell
-				qc = vcov[isoil] * hov[i][j];
+				//assign critical erosion threshold for this cell (surface soil layer)
+				qc = vcsoilov[i][j] * hov[i][j];
 
 				//loop over solids (include zero for total solids)
 				for(isolid=0; isolid<=nsolids; isolid++)
@@ -110,14 +226,14 @@ void OverlandSolidsTransportCapacity()
 
 				}	//end loop over solids
 
-				//loop over directions
-				for(k=1; k<=8; k++)
+				//loop over directions (flow is only routed in cardinal directions)
+				for(k=1; k<=7; k=k+2)
 				{
 					//set friction slope (dimensionless)
-					sf = (float)(fabs(sfov[i][j][k]));
+					sf = (float)(fabs(sfov[i][j][OVSLOT(k)]));
 
 					//set unit discharge (m2/s)
-					q = dqovout[i][j][k] / w;
+					q = dqovout[i][j][OVSLOT(k)] / w;
 
 					//Note:  The modified Kilinc-Richardson (K-R)
 					//       transport capacity is used...
@@ -165,28 +281,69 @@ void OverlandSolidsTransportCapacity()
 						//qs = (float)(ktotal * pow((q-qc), 2.035)* pow(sf, 1.66);
 
 						//set total transport capcity coefficient for this soil and land use
-						ktotal = ktranscapov[iland] * kusle[isoil]
+						ktotal = ktranscapov[iland] * kuslesoilov[i][j]
 							* cusle[iland] * pusle[iland];
 
-						//total (all solids) overland transport capacity (kg/m/s)
-						qs = (float)(ktotal * pow((q-qc), betasov[iland])
-							* pow(sf, gammasov[iland]));
-					}
-					else	//else q <= qc
-					{
-						//set the total overland transport capacity to zero
-						qs = 0.0;
+						//Gather the direction for the batch:
+						//
+						//  qs = ktotal * (q-qc)^betasov * sf^gammasov
+						//
+						//(summed into transcapov[0] by OverlandCapacityFlows)
+						caprow[ncaps] = i;
+						capcol[ncaps] = j;
+						capcoef[ncaps] = ktotal;
+						capflow[ncaps] = q - qc;
+						capslope[ncaps] = sf;
+						capflowexp[ncaps] = betasov[iland];
+						capslopeexp[ncaps] = gammasov[iland];
 
-					}	//end if q > qc
+						//count the entry
+						ncaps = ncaps + 1;
 
-					//Compute the sum over all directions to get a total...
-					//
-					//total transport capacity (summed over all directions) (g/s)
-					transcapov[0][i][j] = transcapov[0][i][j]
-						+ (float)(qs * w * 1000.0);
+						//if the batch is full
+						if(ncaps == POWBATCHSIZE)
+						{
+							//Compute and sum the capacities of the batch
+							OverlandCapacityFlows(ncaps);
+
+							//start a new batch
+							ncaps = 0;
+
+						}	//end if ncaps == POWBATCHSIZE
+
+					}	//end if q > qc (for q <= qc the capacity is zero)
 
 				}	//end loop over directions
 
+			}	//end if imask[][] != nodatavalue
+
+		}	//end loop over columns
+
+	}	//end loop over rows
+
+	//if entries remain in the last batch
+	if(ncaps > 0)
+	{
+		//Compute and sum the capacities of the last batch
+		OverlandCapacityFlows(ncaps);
+
+	}	//end if ncaps > 0
+
+	//Loop over rows
+	for(i=1; i<=nrows; i++)
+	{
+		//Loop over columns
+		for(j=1; j<=ncols; j++)
+		{
+			//if the cell is in the domain (is not null)
+			if(imask[i][j] != nodatavalue)
+			{
+				//set the surface soil layer number
+				ilayer = nstackov[i][j];
+
+				//assign land use type for this cell
+				iland = landuse[i][j];
+
 				//Apportion the total solids transport capacity by
 				//solids type in the surface sediment layer
 				//
@@ -224,7 +381,8 @@ void OverlandSolidsTransportCapacity()
 					//Note:  dstar[] is always greater than zero...
 					//
 					//compute the transport capacity fraction for this solids type (numerator)
-					fcapacity[isolid] = (float)(fsolids / pow(dstar[isolid], tcwexpov[iland]));
+					//(dstarpowov = dstar ^ tcwexpov, computed at initialization)
+					fcapacity[isolid] = (float)(fsolids / dstarpowov[iland][isolid]);
 
 					//compute the sum of transport fractions (denominator)
 					sumcapacity = sumcapacity + fcapacity[isolid];
@@ -11,11 +11,12 @@ C-              (values at time t)
 C-
 C-	Outputs:	hovnew[][] (values at time t+dt)
 C-              vovintermediate[][]
-C-              sweovnew[][]
+C-              sweovnew[][], minhovdepth, maxhovdepth,
+C-              minsweovdepth, maxsweovdepth, mbstep[]
 C-
 C-	Controls:   ksim
 C-
-C-	Calls:		SimulationError
+C-	Calls:		RejectStep, SimulationError, ClearMassBalanceStep
 C-
 C-	Called by:	WaterBalance
 C-
@@ -64,6 +65,35 @@ C-	Revisions:	Cumulative mass balance calculations were moved to
 C-              OverlandWaterDepth to implement time step option
 C-              (dtopt).
 C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Overland source/direction slots are addressed
+C-              through OVSLOT (compact overland slot storage).
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Minimum and maximum depths updated with new depths.
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Time steps with a negative depth or concentration
+C-              are rejected (RejectStep) when step recovery is
+C-              enabled.
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  The volumes of the time step are added to the
+C-              streamed water mass balance (mbstep, see
+C-              MassBalanceMonitor).
+C-
 C-  Revised:
 C-
 C-  Date:
@@ -108,6 +138,9 @@ void OverlandWaterDepth( )
 	//the water balance as well.  However, this feature not included in
 	//present version...
 	//
+	//Clear the overland and outlet mass balance terms of this time step (see MassBalanceMonitor)
+	ClearMassBalanceStep(1, MBQOUTOV);
+
 	//Loop over rows
 	for(i=1; i<=nrows; i++)
 	{
@@ -204,10 +237,15 @@ void OverlandWaterDepth( )
 					{
 						//simulation error number;	simerrorno = 1;
 						//
-						//Report error type (negative water depth in overland cell) and location
-						SimulationError(1, i, j, 0);
+						//if the time step cannot be rejected (step recovery is off or no retries remain)
+						if(RejectStep(1, i, j, 0) == 0)
+						{
+							//Report error type (negative water depth in overland cell) and location
+							SimulationError(1, i, j, 0);
 
-						exit(EXIT_FAILURE);	//abort
+							exit(EXIT_FAILURE);	//abort
+
+						}	//end if RejectStep() == 0
 
 					}	//end check for round-off error
 
@@ -221,6 +259,10 @@ void OverlandWaterDepth( )
 
 				}	//end if hovnew[i][j] < TOLERANCE
 
+				//Determine the minimum and the maximum water depths
+				minhovdepth = Min(minhovdepth,hovnew[i][j]);
+				maxhovdepth = Max(maxhovdepth,hovnew[i][j]);
+
 				//if snow hydrology (snowfall or snowmelt) is simulated
 				if(snowopt > 0 || meltopt > 0)
 				{
@@ -265,10 +307,15 @@ void OverlandWaterDepth( )
 						{
 							//simulation error number;	simerrorno = 2;
 							//
-							//Report error type (negative swe depth in overland cell) and location
-							SimulationError(2, i, j, 0);
+							//if the time step cannot be rejected (step recovery is off or no retries remain)
+							if(RejectStep(2, i, j, 0) == 0)
+							{
+								//Report error type (negative swe depth in overland cell) and location
+								SimulationError(2, i, j, 0);
 
-							exit(EXIT_FAILURE);	//abort
+								exit(EXIT_FAILURE);	//abort
+
+							}	//end if RejectStep() == 0
 
 						}	//end check for round-off error
 
@@ -282,6 +329,13 @@ void OverlandWaterDepth( )
 
 					}	//end if sweovnew[i][j] < TOLERANCE
 
+					//Determine the minimum and the maximum snowpack (swe) depths
+					minsweovdepth = Min(minsweovdepth,sweovnew[i][j]);
+					maxsweovdepth = Max(maxsweovdepth,sweovnew[i][j]);
+
+					//Add the new snowpack volume (as swe) of the cell to the overland storage (m3)
+					mbstep[MBSWEOV] = mbstep[MBSWEOV] + sweovnew[i][j] * aovsurf;
+
 				}	//endif snowopt > 0 or meltopt > 0
 
 				/****************************************************/
@@ -298,6 +352,10 @@ void OverlandWaterDepth( )
 				grossrainvol[i][j] = grossrainvol[i][j]
 					+ grossrainrate[i][j] * w * w * dt[idt];
 
+				//Add the gross rainfall volume to the step mass balance (m3)
+				mbstep[MBGROSSRAIN] = mbstep[MBGROSSRAIN]
+					+ grossrainrate[i][j] * w * w * dt[idt];
+
 				//Minimum and Maximun Rainfall Intensity...
 				//
 				//Note: If snowopt = 1 and the air temperature is below freezing,
@@ -322,6 +380,10 @@ void OverlandWaterDepth( )
 					grossswevol[i][j] = grossswevol[i][j]
 						+ grossswerate[i][j] * w * w * dt[idt];
 
+					//Add the gross snowfall volume to the step mass balance (m3)
+					mbstep[MBGROSSSWE] = mbstep[MBGROSSSWE]
+						+ grossswerate[i][j] * w * w * dt[idt];
+
 					//Save the minimum snowfall (swe) intensity value (m/s)
 					minsweintensity = Min(minsweintensity,grossswerate[i][j]);
 
@@ -342,6 +404,10 @@ void OverlandWaterDepth( )
 						interceptionvol[i][j] = interceptionvol[i][j]
 							+ interceptiondepth[i][j] * aovsurf;
 
+						//Add volume to the step mass balance (m3)
+						mbstep[MBINTERCEPT] = mbstep[MBINTERCEPT]
+							+ interceptiondepth[i][j] * aovsurf;
+
 						//set the remaining (unsatisfied) interception depth to zero
 						interceptiondepth[i][j] = 0.0;
 					}
@@ -355,6 +421,10 @@ void OverlandWaterDepth( )
 						interceptionvol[i][j] = interceptionvol[i][j]
 							+ grossrainrate[i][j] * dt[idt] * aovsurf;
 
+						//Add volume to the step mass balance (m3)
+						mbstep[MBINTERCEPT] = mbstep[MBINTERCEPT]
+							+ grossrainrate[i][j] * dt[idt] * aovsurf;
+
 					}	//end if gross rain > interception
 
 				}	//end if remaining interception depth > 0
@@ -370,6 +440,10 @@ void OverlandWaterDepth( )
 				netrainvol[i][j] = netrainvol[i][j]
 					+ netrainrate[i][j] * aovsurf * dt[idt];
 
+				//Add the net rainfall volume to the step mass balance (m3)
+				mbstep[MBNETRAIN] = mbstep[MBNETRAIN]
+					+ netrainrate[i][j] * aovsurf * dt[idt];
+
 				//if snowfall is simulated as falling snow
 				if(snowopt > 0 && snowopt <= 3)
 				{
@@ -383,6 +457,10 @@ void OverlandWaterDepth( )
 							interceptionvol[i][j] = interceptionvol[i][j]
 								+ interceptiondepth[i][j] * aovsurf;
 
+							//Add volume to the step mass balance (m3)
+							mbstep[MBINTERCEPT] = mbstep[MBINTERCEPT]
+								+ interceptiondepth[i][j] * aovsurf;
+
 							//set the remaining (unsatisfied) interception depth to zero
 							interceptiondepth[i][j] = 0.0;
 						}
@@ -396,6 +474,10 @@ void OverlandWaterDepth( )
 							interceptionvol[i][j] = interceptionvol[i][j]
 								+ grossswerate[i][j] * dt[idt] * aovsurf;
 
+							//Add volume to the step mass balance (m3)
+							mbstep[MBINTERCEPT] = mbstep[MBINTERCEPT]
+								+ grossswerate[i][j] * dt[idt] * aovsurf;
+
 						}	//end if gross snow > interception
 
 					}	//end if remaining interception depth > 0
@@ -404,6 +486,10 @@ void OverlandWaterDepth( )
 					netswevol[i][j] = netswevol[i][j]
 						+ netswerate[i][j] * aovsurf * dt[idt];
 
+					//Add the net snowfall volume to the step mass balance (m3)
+					mbstep[MBNETSWE] = mbstep[MBNETSWE]
+						+ netswerate[i][j] * aovsurf * dt[idt];
+
 				}	//endif snowopt > 1 && snowopt <= 3
 
 				//Snowmelt (Snow Pack Water Loss)...
@@ -419,6 +505,10 @@ void OverlandWaterDepth( )
 					swemeltvol[i][j] = swemeltvol[i][j]
 						+ swemeltrate[i][j] * dt[idt] * aovsurf;
 
+					//Add the snowmelt volume to the step mass balance (m3)
+					mbstep[MBSWEMELT] = mbstep[MBSWEMELT]
+						+ swemeltrate[i][j] * dt[idt] * aovsurf;
+
 					//Compute minimum snowmelt depth (as swe) (cumulative) for cell (m)
 					minswemeltdepth = Min(swemeltdepth[i][j],minswemeltdepth);
 
@@ -443,6 +533,13 @@ void OverlandWaterDepth( )
 				infiltrationvol[i][j] = infiltrationvol[i][j]
 					+ infiltrationrate[i][j] * dt[idt] * aovsurf;
 
+				//Add the infiltration volume to the step mass balance (m3)
+				mbstep[MBINFILT] = mbstep[MBINFILT]
+					+ infiltrationrate[i][j] * dt[idt] * aovsurf;
+
+				//Add the new water volume of the cell to the overland storage (m3)
+				mbstep[MBWATEROV] = mbstep[MBWATEROV] + hovnew[i][j] * aovsurf;
+
 				//Overland Flow (excluding point sources and floodplain transfers)...
 				//
 				//Note:  Cumulative mass balance calculations for floodplain
@@ -452,12 +549,12 @@ void OverlandWaterDepth( )
 				for(k=1; k<=7; k=k+2)
 				{
 					//increment cumulative cell outflow volume (m3)
-					dqovoutvol[i][j][k] = dqovoutvol[i][j][k]
-						+ dqovout[i][j][k] * dt[idt];
+					dqovoutvol[i][j][OVSLOT(k)] = dqovoutvol[i][j][OVSLOT(k)]
+						+ dqovout[i][j][OVSLOT(k)] * dt[idt];
 
 					//increment cumulative cell inflow volume (m3)
-					dqovinvol[i][j][k] = dqovinvol[i][j][k]
-						+ dqovinvol[i][j][k] * dt[idt];
+					dqovinvol[i][j][OVSLOT(k)] = dqovinvol[i][j][OVSLOT(k)]
+						+ dqovinvol[i][j][OVSLOT(k)] * dt[idt];
 
 				}	//end loop over directions 1, 3, 5, and 7
 
@@ -479,12 +576,15 @@ void OverlandWaterDepth( )
 		j = qwovcol[k];
 
 		//Increment cumulative cell flow volume
-		dqovinvol[i][j][0] = dqovinvol[i][j][0]
+		dqovinvol[i][j][OVSLOT(0)] = dqovinvol[i][j][OVSLOT(0)]
 			+ qwovinterp[k] * dt[idt];
 
 		//Compute cumulative sum of external flow volumes (m3)
 		qwovvol[i][j] = qwovvol[i][j] + qwovinterp[k] * dt[idt];
 
+		//Add the external flow volume to the step mass balance (m3)
+		mbstep[MBQWOV] = mbstep[MBQWOV] + qwovinterp[k] * dt[idt];
+
 	}	//end loop over number of external flow sources
 
 	//Comulative mass balance for overland flow leaving outlets...
@@ -493,16 +593,19 @@ void OverlandWaterDepth( )
 	for(i=1; i<=noutlets; i++)
 	{
 		//increment cumulative cell outflow volume
-		dqovoutvol[iout[i]][jout[i]][10] = dqovoutvol[iout[i]][jout[i]][10]
+		dqovoutvol[iout[i]][jout[i]][OVSLOT(10)] = dqovoutvol[iout[i]][jout[i]][OVSLOT(10)]
 			+ qoutov[i] * dt[idt];
 
 		//increment cumulative cell inflow volume
-		dqovinvol[iout[i]][jout[i]][10] = dqovinvol[iout[i]][jout[i]][10]
+		dqovinvol[iout[i]][jout[i]][OVSLOT(10)] = dqovinvol[iout[i]][jout[i]][OVSLOT(10)]
 			+ qinov[i] * dt[idt];
 
 		//Compute cumulative flow volume exiting domain at this outlet (m3)
 		qoutovvol[i] = qoutovvol[i] + qoutov[i] * dt[idt];
 
+		//Add the outlet flow volume to the step mass balance (m3)
+		mbstep[MBQOUTOV] = mbstep[MBQOUTOV] + qoutov[i] * dt[idt];
+
 	}	//end loop over outlets
 
 //End of function: Return to WaterBalance
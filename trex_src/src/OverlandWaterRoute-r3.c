@@ -14,7 +14,7 @@ C-				dqovout[][][] (Global)
 C-
 C-	Controls:   imask[][], infopt, outopt, dbcopt
 C-
-C-	Calls:      None
+C-	Calls:      BatchPow, PowValue
 C-
 C-	Called by:	WaterTransport.c
 C-
@@ -73,6 +73,22 @@ C-	Revisions:	Revised Courant number calculations to permit time
 C-              step option (dtopt) implementation.  Cumulative mass
 C-              balance calculations were moved to OverlandWaterDepth.
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Overland source/direction slots are addressed
+C-              through OVSLOT (compact overland slot storage).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Faces with flow are gathered into batches of up to
+C-              POWBATCHSIZE faces.  The Manning power laws of a batch
+C-              are evaluated by BatchPow and the flows are applied in
+C-              the original face order (OverlandFaceFlows).
+C-
 C-	Revised:
 C-
 C-	Date:	
@@ -87,6 +103,152 @@ C---------------------------------------------------------------------*/
 //trex global variable declarations for water transport
 #include "trex_water_declarations.h"
 
+//Batch of overland faces with flow (gathered by OverlandWaterRoute)
+static int
+	facerow[POWBATCHSIZE],		//row of the cell of the face
+	facecol[POWBATCHSIZE],		//column of the cell of the face
+	faceadjrow[POWBATCHSIZE],	//row of the adjacent cell of the face
+	faceadjcol[POWBATCHSIZE];	//column of the adjacent cell of the face
+
+static float
+	facesign[POWBATCHSIZE],		//sign of the flow direction (a)
+	facen[POWBATCHSIZE];		//Manning n value of the upgradient cell
+
+static double
+	faceslope[POWBATCHSIZE],	//|sf| (then |sf|^0.5)
+	facedepth[POWBATCHSIZE];	//depth above storage and infiltration (then depth^1.667)
+
+//C
+//C
+			/*******************************************/
+			/*       FUNCTION: OverlandFaceFlows       */
+			/*******************************************/
+
+/* Evaluates the Manning power laws of a batch of faces and applies the flows (in face order) */
+
+static void OverlandFaceFlows(int nfaces)
+{
+	//local variable declarations/definitions
+	int
+		iface,		//loop index for faces
+		row,		//row of the cell of the face
+		col,		//column of the cell of the face
+		adjrow,		//row of the adjacent cell of the face
+		adjcol;		//column of the adjacent cell of the face
+
+	float
+		a,			//sign to set flow direction
+		alpha,		//scalar coefficient in manning resistance equation
+		dq;			//overland flow between cells (m3/s)
+
+	//Evaluate the Manning power laws of the batch: |sf|^0.5 and depth^1.667
+	BatchPow(faceslope, nfaces, powplanovslope);
+	BatchPow(facedepth, nfaces, powplanovdepth);
+
+	//Loop over faces
+	for(iface=0; iface<nfaces; iface++)
+	{
+		//set the cells and flow direction of the face
+		row = facerow[iface];
+		col = facecol[iface];
+		adjrow = faceadjrow[iface];
+		adjcol = faceadjcol[iface];
+		a = facesign[iface];
+
+		//Compute overland flow using Manning's resistance equation:
+		//
+		//  q = alpha * (h)^beta
+		//
+		//  alpha = (sf^0.5) / n  (n is Manning n)
+		//
+		//  beta = 5/3 = 1.667  (constant)
+		//
+		//Compute alpha
+		alpha = (float)(faceslope[iface] / facen[iface]);
+
+		//compute flow rate (m3/s) (unit flow * w = Q)
+		dq = (float)(a * w * (alpha * facedepth[iface]));
+
+		//subtract flow from upgradient cell (opposite direction for a = -1.0)
+		dqov[row][col] = dqov[row][col] - dq;
+
+		//add flow to downgradient cell (opposite direction for a = -1.0)
+		dqov[adjrow][adjcol] = dqov[adjrow][adjcol] + dq;
+
+		//store cell flow for sediment and chemical transport computations...
+		//
+		//if transfer is in the E-W direction (row = adjrow, same row...)
+		if(row == adjrow)
+		{
+			//if flow is positive (transfer from east to west) (from col to adjcol)
+			if(a == 1.0)
+			{
+				//store cell outflow to east (direction = 3)
+				dqovout[row][col][OVSLOT(3)] = (float)fabs(dq);
+
+				//store cell inflow from west (direction = 7)
+				dqovin[adjrow][adjcol][OVSLOT(7)] = (float)fabs(dq);
+			}
+			//else if flow is negative (transfer from west to east) (from adjcol to col)
+			else if(a == -1.0)
+			{
+				//store cell outflow to west (direction = 7)
+				dqovout[adjrow][adjcol][OVSLOT(7)] = (float)fabs(dq);
+
+				//store cell inflow from east (direction = 3)
+				dqovin[row][col][OVSLOT(3)] = (float)fabs(dq);
+
+			}	//end if a = 1.0
+		}
+		//else if transfer is in the N-S direction (col = adjcol, same column...)
+		else if(col == adjcol)
+		{
+			//if flow is positive (transfer from north to south) (from row to adjrow)
+			if(a == 1.0)
+			{
+				//store cell outflow to south (direction = 5)
+				dqovout[row][col][OVSLOT(5)] = (float)fabs(dq);
+
+				//store cell inflow from north (direction = 1)
+				dqovin[adjrow][adjcol][OVSLOT(1)] = (float)fabs(dq);
+			}
+			//else if flow is negative (transfer from south to north) (from adjrow to row)
+			else if(a == -1.0)
+			{
+				//store cell outflow to north (direction = 1)
+				dqovout[adjrow][adjcol][OVSLOT(1)] = (float)fabs(dq);
+
+				//store cell inflow from south (direction = 5)
+				dqovin[row][col][OVSLOT(5)] = (float)fabs(dq);
+
+			}	//end if a = 1.0
+		}
+		//This condition should never occur...
+		//
+		//else flow is neither E-W or N-S
+		else
+		{
+			//warn user of error
+			printf("\n\nWhoa!  Flow is on a diagonal??");
+			printf("\n  Time = %10.5f",simtime);
+			printf("\n     i = %d",row);
+			printf("\n     j = %d",col);
+			printf("\n    ii = %d",adjrow);
+			printf("\n    jj = %d\n\n",adjcol);
+
+		}	//end if flow is in E-W or N-S directions
+
+	}	//end loop over faces
+
+//End of function: OverlandFaceFlows
+}
+
+//C
+//C
+			/*******************************************/
+			/*       FUNCTION: OverlandWaterRoute      */
+			/*******************************************/
+
 void OverlandWaterRoute()
 {
 	//local variable declarations/definitions
@@ -94,7 +256,8 @@ void OverlandWaterRoute()
 		ii,			//adjacent cell row
 		jj,			//adjacent cell column
 		outlink,	//link number of channel in boundary cell
-		outnode;	//node number of channel in boundary cell
+		outnode,	//node number of channel in boundary cell
+		nfaces;		//number of faces with flow gathered for the next batch
 
 	float
 		a,			//sign to set flow direction
@@ -126,7 +289,7 @@ void OverlandWaterRoute()
 				dqov[i][j] = 0.0;
 
 				//Loop over directions/sources
-				for(k=0; k<=10; k++)
+				for(k=0; k<NOVSLOTS; k++)
 				{
 					//Initialize gross inflow array
 					dqovin[i][j][k] = 0.0;
@@ -173,12 +336,21 @@ void OverlandWaterRoute()
 		//possible external flow source...
 		//
 		//Add gross inflow to cell from external source
-		dqovin[i][j][0] = dqovin[i][j][0] + qwovinterp[k];
+		dqovin[i][j][OVSLOT(0)] = dqovin[i][j][OVSLOT(0)] + qwovinterp[k];
 
 	}	//end loop over number of external flow sources
 
-	//Compute overland flows in the domain
+	//Compute overland flows in the domain...
+	//
+	//Note:  Faces with flow are gathered into a batch.  When the batch
+	//       is full (and after the last cell), the Manning power laws
+	//       of the batch are evaluated and the flows are applied in
+	//       face order by OverlandFaceFlows.  Faces without flow do
+	//       not change the flow arrays (initialized to zero above).
 	//
+	//no faces are gathered yet
+	nfaces = 0;
+
 	//Loop over rows
 	for(i=1; i<=nrows; i++)
 	{
@@ -263,13 +435,13 @@ void OverlandWaterRoute()
 							if(sf >= 0.0)
 							{
 								//store friction slope to east (direction = 3)
-								sfov[i][j][3] = sf;
+								sfov[i][j][OVSLOT(3)] = sf;
 							}
 							//else if sf is negative (transfer from west to east) (from jj to j)
 							else if(sf < 0.0)
 							{
 								//store friction slope to west (direction = 7)
-								sfov[ii][jj][7] = (float)fabs(sf);
+								sfov[ii][jj][OVSLOT(7)] = (float)fabs(sf);
 
 							}	//end if sf >= 0.0
 						}
@@ -280,13 +452,13 @@ void OverlandWaterRoute()
 							if(sf >= 0.0)
 							{
 								//store friction slope to south (direction = 5)
-								sfov[i][j][5] = sf;
+								sfov[i][j][OVSLOT(5)] = sf;
 							}
 							//else if flow is negative (transfer from south to north) (from ii to i)
 							else if(sf < 0.0)
 							{
 								//store friction slope to north (direction = 1)
-								sfov[ii][jj][1] = (float)fabs(sf);
+								sfov[ii][jj][OVSLOT(1)] = (float)fabs(sf);
 
 							}	//end if sf >= 0.0
 
@@ -397,96 +569,31 @@ void OverlandWaterRoute()
 						//if cell depth is sufficient for overland flow and sf not zero
 						if((hcell > (scell + infcell)) && sf != 0.0)
 						{
-							//Compute overland flow using Manning's resistance equation:
-							//
-							//  q = alpha * (h)^beta
-							//
-							//  alpha = (sf^0.5) / n  (n is Manning n)
-							//
-							//  beta = 5/3 = 1.667  (constant)
-							//
-							//Compute alpha
-							alpha = (float)(pow(fabs(sf),0.5) / ncell);
-
-							//compute flow rate (m3/s) (unit flow * w = Q)
-							dq = (float)(a * w * (alpha
-								* pow((hcell - (scell + infcell)),1.667)));
-						}
-						else	//else hcell < (scell + infcell) or sf = 0
-						{
-							//Flow is zero
-							dq = 0.0;
-
-						}	//end if hcell > (scell + infcell) and sf not zero...
-
-						//subtract flow from upgradient cell (opposite direction for a = -1.0)
-						dqov[i][j] = dqov[i][j] - dq;
-
-						//add flow to downgradient cell (opposite direction for a = -1.0)
-						dqov[ii][jj] = dqov[ii][jj] + dq;
-
-						//store cell flow for sediment and chemical transport computations...
-						//
-						//if transfer is in the E-W direction (i = ii, same row...)
-						if(i == ii)
-						{
-							//if flow is positive (transfer from east to west) (from j to jj)
-							if(a == 1.0)
-							{
-								//store cell outflow to east (direction = 3)
-								dqovout[i][j][3] = (float)fabs(dq);
-
-								//store cell inflow from west (direction = 7)
-								dqovin[ii][jj][7] = (float)fabs(dq);
-							}
-							//else if flow is negative (transfer from west to east) (from jj to j)
-							else if(a == -1.0)
+							//Gather the face for the batch (flow is computed by OverlandFaceFlows)
+							facerow[nfaces] = i;
+							facecol[nfaces] = j;
+							faceadjrow[nfaces] = ii;
+							faceadjcol[nfaces] = jj;
+							facesign[nfaces] = a;
+							facen[nfaces] = ncell;
+							faceslope[nfaces] = fabs(sf);
+							facedepth[nfaces] = hcell - (scell + infcell);
+
+							//count the face
+							nfaces = nfaces + 1;
+
+							//if the batch is full
+							if(nfaces == POWBATCHSIZE)
 							{
-								//store cell outflow to west (direction = 7)
-								dqovout[ii][jj][7] = (float)fabs(dq);
+								//Compute and apply the flows of the batch
+								OverlandFaceFlows(nfaces);
 
-								//store cell inflow from east (direction = 3)
-								dqovin[i][j][3] = (float)fabs(dq);
+								//start a new batch
+								nfaces = 0;
 
-							}	//end if a = 1.0
-						}
-						//else if transfer is in the N-S direction (j = jj, same column...)
-						else if(j == jj)
-						{
-							//if flow is positive (transfer from north to south) (from i to ii)
-							if(a == 1.0)
-							{
-								//store cell outflow to south (direction = 5)
-								dqovout[i][j][5] = (float)fabs(dq);
+							}	//end if nfaces == POWBATCHSIZE
 
-								//store cell inflow from north (direction = 1)
-								dqovin[ii][jj][1] = (float)fabs(dq);
-							}
-							//else if flow is negative (transfer from south to north) (from ii to i)
-							else if(a == -1.0)
-							{
-								//store cell outflow to north (direction = 1)
-								dqovout[ii][jj][1] = (float)fabs(dq);
-
-								//store cell inflow from south (direction = 5)
-								dqovin[i][j][5] = (float)fabs(dq);
-
-							}	//end if a = 1.0
-						}
-						//This condition should never occur...
-						//
-						//else flow is neither E-W or N-S
-						else
-						{
-							//warn user of error
-							printf("\n\nWhoa!  Flow is on a diagonal??");
-							printf("\n  Time = %10.5f",simtime);
-							printf("\n     i = %d",i);
-							printf("\n     j = %d",j);
-							printf("\n    ii = %d",ii);
-							printf("\n    jj = %d\n\n",jj);
-
-						}	//end if flow is in E-W or N-S directions
+						}	//end if hcell > (scell + infcell) and sf not zero...
 
 					}	//end if the adjacent cell is in the domain
 
@@ -498,6 +605,14 @@ void OverlandWaterRoute()
 
 	}	//end loop over rows
 
+	//if faces remain in the last batch
+	if(nfaces > 0)
+	{
+		//Compute and apply the flows of the last batch
+		OverlandFaceFlows(nfaces);
+
+	}	//end if nfaces > 0
+
 	//Compute overland flow leaving outlets
 	//
 	//Loop over number of outlets
@@ -637,14 +752,14 @@ void OverlandWaterRoute()
 			//      (sf = so).
 			//
 			//Compute alpha
-			alpha = (float)(pow(fabs(sf),0.5) / ncell);
+			alpha = (float)(PowValue(fabs(sf), powplanovslope) / ncell);
 
 			//if cell depth is sufficient for overland flow
 			if(hcell > (scell + infcell))
 			{
 				//compute overland flow (m3/s) from/to the outlet cell
 				dq = (float)(a * w * alpha
-					* pow((hcell - (scell + infcell)),1.667));
+					* PowValue((hcell - (scell + infcell)), powplanovdepth));
 			}
 			else	//cell depth is not sufficent for overland flow
 			{
@@ -670,7 +785,7 @@ void OverlandWaterRoute()
 			dqov[iout[i]][jout[i]] = dqov[iout[i]][jout[i]] - qoutov[i];
 
 			//store gross outflow to boundary (m3/s) (direction = 10)
-			dqovout[iout[i]][jout[i]][10] = qoutov[i];
+			dqovout[iout[i]][jout[i]][OVSLOT(10)] = qoutov[i];
 		}
 		else if(a == -1.0)	//else if flow direction is negative (dq < 0)
 		{
@@ -681,7 +796,7 @@ void OverlandWaterRoute()
 			dqov[iout[i]][jout[i]] = dqov[iout[i]][jout[i]] + qinov[i];
 
 			//store gross inflow from boundary (m3/s) (direction = 10)
-			dqovin[iout[i]][jout[i]][10] = qinov[i];
+			dqovin[iout[i]][jout[i]][OVSLOT(10)] = qinov[i];
 
 		}	//end if a = 1.0
 
@@ -810,8 +925,8 @@ void OverlandWaterRoute()
 //mlv							+ dqovout[i][j][7] + dqovout[i][j][10]) / (hov[i][j] - (scell + infcell));
 
 						//calculate outflow velocity (m/s)
-						velocity = (dqovout[i][j][1] + dqovout[i][j][3] + dqovout[i][j][5]
-							+ dqovout[i][j][7] + dqovout[i][j][10]) / hov[i][j];
+						velocity = (dqovout[i][j][OVSLOT(1)] + dqovout[i][j][OVSLOT(3)] + dqovout[i][j][OVSLOT(5)]
+							+ dqovout[i][j][OVSLOT(7)] + dqovout[i][j][OVSLOT(10)]) / hov[i][j];
 					}
 					else	//else hov[][] = 0.0 (it can't be negative)
 					{
@@ -0,0 +1,315 @@
+/*----------------------------------------------------------------------
+C-  File:       PartitionCache.c
+C-
+C-  Purpose/    Concatenated group of functions for the partitioning
+C-  Methods:    cache used by OverlandChemicalPartitioning and
+C-              ChannelChemicalPartitioning.
+C-
+C-              The phase fractions (fparticulate, fbound, fdissolved)
+C-              of a layer only change when the inputs of the layer
+C-              change.  The partitioning modules keep the fractions of
+C-              the previous call and recompute a layer only when:
+C-
+C-                (1) the cell (or node) is marked stale (partstaleov,
+C-                    partstalech): all layers are recomputed.  Cells
+C-                    are marked by the stack modules (PushSoilStack,
+C-                    PopSoilStack, PushSedimentStack, PopSedimentStack),
+C-                    by UpdateEnvironment when a doc concentration or
+C-                    fraction changes, and all cells are marked by
+C-                    InvalidatePartitioning;
+C-
+C-                (2) the layer is buried and the wetting front moved
+C-                    into, out of, or within it since the last call
+C-                    (partwfeov, partwfech);
+C-
+C-                (3) the layer is the water column or surface layer
+C-                    and its porosity or a solids concentration moved
+C-                    by more than the relative tolerance parttol from
+C-                    the values used for the last computation
+C-                    (partrefov, partrefch).
+C-
+C-              With the default tolerance (parttol = 0) a layer is
+C-              recomputed whenever any input changed, so the results
+C-              are the same as a full computation.
+C-
+C-              Reference values are stored per cell (or node) as:
+C-
+C-                [0]                      water column porosity
+C-                [1..nsolids]             water column solids (g/m3)
+C-                [nsolids+1]              surface layer porosity
+C-                [nsolids+1+isolid]       surface layer solids (g/m3)
+C-
+C-  Function
+C-   Listing:   InitializePartitionCache, InvalidatePartitioning,
+C-              PartitionInputMoved, FreePartitionCache
+C-
+C-  Inputs:     parttol, imask, nnodes
+C-
+C-  Outputs:    partstaleov, partwfeov, partrefov, partstalech,
+C-              partwfech, partrefch
+C-
+C-  Controls:   chnopt
+C-
+C-  Calls:      None
+C-
+C-  Called by:  InitializeChemical, TrexSetParameter,
+C-              OverlandChemicalPartitioning,
+C-              ChannelChemicalPartitioning, FreeMemoryChemical
+C-
+C-  Created:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revised:
+C-
+C-  Date:
+C-
+C-  Revisions:
+C-
+C----------------------------------------------------------------------*/
+
+//trex general variable declarations
+#include "trex_general_declarations.h"
+
+//trex global variable declarations for water transport
+#include "trex_water_declarations.h"
+
+//trex global variable declarations for sediment transport
+#include "trex_solids_declarations.h"
+
+//trex global variable declarations for chemical transport
+#include "trex_chemical_declarations.h"
+
+//C
+//C
+			/*******************************************/
+			/*   FUNCTION: InitializePartitionCache    */
+			/*******************************************/
+
+/* Allocates the partitioning cache and marks all partitioning stale */
+
+void InitializePartitionCache()
+{
+	//local variable declarations
+	int
+		nref,		//number of reference values per cell or node
+		row,		//row index
+		col,		//column index
+		link,		//link index
+		node;		//node index
+
+	//set the number of reference values (water column and surface layer)
+	nref = 2 * (nsolids + 1);
+
+	//Allocate memory for the overland cache (rows)
+	partstaleov = (int **)malloc((nrows+1) * sizeof(int *));
+	partwfeov = (float **)malloc((nrows+1) * sizeof(float *));
+	partrefov = (float ***)malloc((nrows+1) * sizeof(float **));
+
+	//loop over rows
+	for(row=1; row<=nrows; row++)
+	{
+		//Allocate memory for the overland cache (columns)
+		partstaleov[row] = (int *)calloc((ncols+1), sizeof(int));
+		partwfeov[row] = (float *)calloc((ncols+1), sizeof(float));
+		partrefov[row] = (float **)malloc((ncols+1) * sizeof(float *));
+
+		//loop over columns
+		for(col=1; col<=ncols; col++)
+		{
+			//if the cell is in the domain (is not null)
+			if(imask[row][col] != nodatavalue)
+			{
+				//Allocate memory for the reference values of the cell
+				partrefov[row][col] = (float *)calloc(nref, sizeof(float));
+			}
+			else	//else the cell is not in the domain
+			{
+				//no reference values
+				partrefov[row][col] = NULL;
+
+			}	//end if imask[][] != nodatavalue
+
+		}	//end loop over columns
+
+	}	//end loop over rows
+
+	//if channels are simulated
+	if(chnopt > 0)
+	{
+		//Allocate memory for the channel cache (links)
+		partstalech = (int **)malloc((nlinks+1) * sizeof(int *));
+		partwfech = (float **)malloc((nlinks+1) * sizeof(float *));
+		partrefch = (float ***)malloc((nlinks+1) * sizeof(float **));
+
+		//loop over links
+		for(link=1; link<=nlinks; link++)
+		{
+			//Allocate memory for the channel cache (nodes)
+			partstalech[link] = (int *)calloc((nnodes[link]+1), sizeof(int));
+			partwfech[link] = (float *)calloc((nnodes[link]+1), sizeof(float));
+			partrefch[link] = (float **)malloc((nnodes[link]+1) * sizeof(float *));
+
+			//loop over nodes
+			for(node=1; node<=nnodes[link]; node++)
+			{
+				//Allocate memory for the reference values of the node
+				partrefch[link][node] = (float *)calloc(nref, sizeof(float));
+
+			}	//end loop over nodes
+
+		}	//end loop over links
+
+	}	//end if chnopt > 0
+
+	//Mark the partitioning of all cells and nodes stale
+	InvalidatePartitioning();
+
+//End of function: Return to InitializeChemical
+}
+
+//C
+//C
+			/*******************************************/
+			/*    FUNCTION: InvalidatePartitioning     */
+			/*******************************************/
+
+/* Marks the partitioning of all cells and nodes stale */
+
+void InvalidatePartitioning()
+{
+	//local variable declarations
+	int
+		row,		//row index
+		col,		//column index
+		link,		//link index
+		node;		//node index
+
+	//loop over rows
+	for(row=1; row<=nrows; row++)
+	{
+		//loop over columns
+		for(col=1; col<=ncols; col++)
+		{
+			//mark the cell stale
+			partstaleov[row][col] = 1;
+
+		}	//end loop over columns
+
+	}	//end loop over rows
+
+	//if channels are simulated
+	if(chnopt > 0)
+	{
+		//loop over links
+		for(link=1; link<=nlinks; link++)
+		{
+			//loop over nodes
+			for(node=1; node<=nnodes[link]; node++)
+			{
+				//mark the node stale
+				partstalech[link][node] = 1;
+
+			}	//end loop over nodes
+
+		}	//end loop over links
+
+	}	//end if chnopt > 0
+
+//End of function: Return to calling module
+}
+
+//C
+//C
+			/*******************************************/
+			/*      FUNCTION: PartitionInputMoved      */
+			/*******************************************/
+
+/* Returns 1 if a partitioning input moved beyond the relative */
+/* tolerance (parttol) from its reference value, 0 otherwise   */
+
+int PartitionInputMoved(float value, float reference)
+{
+	//if the change exceeds the tolerance (any change when parttol = 0)
+	if(fabs(value - reference) > parttol * fabs(reference))
+	{
+		//the input moved
+		return 1;
+	}
+
+	//the input did not move
+	return 0;
+
+//End of function: Return to calling module
+}
+
+//C
+//C
+			/*******************************************/
+			/*      FUNCTION: FreePartitionCache       */
+			/*******************************************/
+
+/* Frees memory for the partitioning cache */
+
+void FreePartitionCache()
+{
+	//local variable declarations
+	int
+		row,		//row index
+		col,		//column index
+		link,		//link index
+		node;		//node index
+
+	//loop over rows
+	for(row=1; row<=nrows; row++)
+	{
+		//loop over columns
+		for(col=1; col<=ncols; col++)
+		{
+			//Free memory for the reference values of the cell (NULL outside the domain)
+			free(partrefov[row][col]);
+
+		}	//end loop over columns
+
+		//Free memory for the overland cache (columns)
+		free(partstaleov[row]);
+		free(partwfeov[row]);
+		free(partrefov[row]);
+
+	}	//end loop over rows
+
+	//Free memory for the overland cache (rows)
+	free(partstaleov);
+	free(partwfeov);
+	free(partrefov);
+
+	//if channels are simulated
+	if(chnopt > 0)
+	{
+		//loop over links
+		for(link=1; link<=nlinks; link++)
+		{
+			//loop over nodes
+			for(node=1; node<=nnodes[link]; node++)
+			{
+				//Free memory for the reference values of the node
+				free(partrefch[link][node]);
+
+			}	//end loop over nodes
+
+			//Free memory for the channel cache (nodes)
+			free(partstalech[link]);
+			free(partwfech[link]);
+			free(partrefch[link]);
+
+		}	//end loop over links
+
+		//Free memory for the channel cache (links)
+		free(partstalech);
+		free(partwfech);
+		free(partrefch);
+
+	}	//end if chnopt > 0
+
+//End of function: Return to FreeMemoryChemical
+}
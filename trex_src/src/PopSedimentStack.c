@@ -25,7 +25,8 @@ C-  Outputs:    bursedchinmass[][][][], bursedchoutmass[][][][],
 C-              burchemchinmass[][][][], burchemchoutmass[][][][],
 C-              nstackch[][]
 C-
-C-  Controls:   minvlayerch[][][], ksim
+C-  Controls:   minvlayerch[][][], ksim, npopch, popchlink[],
+C-              popchnode[]
 C-
 C-  Calls:      None
 C-
@@ -44,6 +45,35 @@ C-              Denver, CO 80225
 C-
 C-	Date:		29-DEC-2003
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Burial budgets accumulated in double (no float
+C-              casts).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Processes only the nodes listed by
+C-              ChannelSolidsConcentration.  Popped nodes
+C-              over the maximum volume are added to the push list
+C-              when the push pass runs.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Vacated layer zeroed in new chemical concentrations.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	The partitioning of the node is marked stale when
+C-              the stack changes (ksim > 2).
+C-
 C-	Revised:
 C-
 C-	Date:	
@@ -68,6 +98,8 @@ void PopSedimentStack()
 {
 	//local variable declarations/definitions
 	int
+		ientry,		//loop index for list entries
+		nlisted,	//number of nodes listed for push by ChannelSolidsConcentration
 		isolid,		//loop index for solids (particle) type
 		ilayer,		//index for surface layer in the sediment stack
 		ichem,		//loop index for chemical
@@ -80,47 +112,113 @@ void PopSedimentStack()
 		totalmass,		//total solids mass in the new (popped) surface layer (g)
 		totalvolume;	//total volume of the new (popped) surface layer (m3)
 
-	//loop over links
-	for(i=1; i<=nlinks; i++)
+	//save the number of nodes listed for push before any pops
+	nlisted = npushch;
+
+	//loop over the nodes in the channel sediment stack pop list (flagged by ChannelSolidsConcentration)
+	for(ientry=1; ientry<=npopch; ientry++)
 	{
-		//loop over nodes
-		for(j=1; j<=nnodes[i]; j++)
-		{
-			//set the surface layer number
-			ilayer = nstackch[i][j];
+		//get the link and node of the list entry
+		i = popchlink[ientry];
+		j = popchnode[ientry];
+
+		//set the surface layer number
+		ilayer = nstackch[i][j];
 
-			//if the surface sediment layer volume <= the minimum volume
-			//trigger AND the present number of stack elements > 1
-			if(vlayerch[i][j][ilayer] <= minvlayerch[i][j][ilayer] && ilayer > 1)
+		//if the surface sediment layer volume <= the minimum volume
+		//trigger AND the present number of stack elements > 1
+		if(vlayerch[i][j][ilayer] <= minvlayerch[i][j][ilayer] && ilayer > 1)
+		{
+			//Pop the stack...
+			//
+			//Add the incoming layer to the residual mass/volume of
+			//the surface layer...
+			//
+			//compute the total (residual + incoming) volume of the new surface layer (m3)
+			totalvolume = vlayerch[i][j][ilayer] + vlayerch[i][j][ilayer-1];
+
+			//loop over solids
+			for(isolid=0; isolid<=nsolids; isolid++)
 			{
-				//Pop the stack...
+				//compute residual solids mass (g)
+				residualmass = csedch[isolid][i][j][ilayer]
+					* vlayerch[i][j][ilayer];
+
+				//compute incoming solids mass (g)
+				incomingmass = csedch[isolid][i][j][ilayer-1]
+					* vlayerch[i][j][ilayer-1];
+
+				//compute total solids mass (g)
+				totalmass = residualmass + incomingmass;
+
+				//compute solids concentration in the new surface layer (g/m3)
+				csedch[isolid][i][j][ilayer-1] = (float)(totalmass
+					/ totalvolume);
+
+				//Update mass balance terms...
+				//
+				//Note:  For the purpose of mass balance accounting,
+				//       residual mass from an eroded surface layer
+				//       is treated as a mass loss (burial out) from
+				//       the eroded layer and a gain (burial in) to
+				//       the incoming (new) surface layer.  This is
+				//       done for consistency with mass accounting
+				//       convention and the frame of reference for
+				//       the stack even though mass is being scoured
+				//       from the surface rather than being buried
+				//       to the subsurface (i.e. we have to account
+				//       for mass movement even though a layer is
+				//       being lost from the stack).
 				//
-				//Add the incoming layer to the residual mass/volume of
-				//the surface layer...
+				//Developer's Note:  We could account for the transfer
+				//                   of residual mass as a scour.  The
+				//                   variables needed for this type of
+				//                   calculation exist: scrchemchinmass
+				//                   and scrchemchoutmass.  However, the
+				//                   convention for tracking this mass
+				//                   transfer needs further development.
+				//
+				//compute the buried mass leaving the eroded surface layer (kg)
+				bursedchoutmass[isolid][i][j][ilayer] =
+					bursedchoutmass[isolid][i][j][ilayer] + residualmass / 1000.0;
+
+				//compute the buried mass entering the new surface layer (kg)
+				bursedchinmass[isolid][i][j][ilayer-1] =
+					bursedchinmass[isolid][i][j][ilayer-1] + residualmass / 1000.0;
+
+				//Note:  The layer that used to be at the surface is now
+				//       eliminated.  The erosion and deposition flux for
+				//       the former surface layer must be set to zero.
 				//
-				//compute the total (residual + incoming) volume of the new surface layer (m3)
-				totalvolume = vlayerch[i][j][ilayer] + vlayerch[i][j][ilayer-1];
+				//set the erosion outflux for the former surface layer to zero (g/s)
+				erssedchoutflux[isolid][i][j][ilayer] = 0.0;
+
+				//set the deposition influx for the former surface layer to zero (g/s)
+				depsedchinflux[isolid][i][j][ilayer] = 0.0;
+
+			}	//end loop over solids
 
-				//loop over solids
-				for(isolid=0; isolid<=nsolids; isolid++)
+			//if chemical transport is simulated (ksim > 2)
+			if(ksim > 2)
+			{
+				//loop over chemicals
+				for(ichem=1; ichem<=nchems; ichem++)
 				{
-					//compute residual solids mass (g)
-					residualmass = csedch[isolid][i][j][ilayer]
+					//compute residual chemical mass (g)
+					residualmass = cchemch[ichem][i][j][ilayer]
 						* vlayerch[i][j][ilayer];
 
-					//compute incoming solids mass (g)
-					incomingmass = csedch[isolid][i][j][ilayer-1]
+					//compute incoming chemical mass (g)
+					incomingmass = cchemch[ichem][i][j][ilayer-1]
 						* vlayerch[i][j][ilayer-1];
 
-					//compute total solids mass (g)
+					//compute total chemical mass (g)
 					totalmass = residualmass + incomingmass;
 
-					//compute solids concentration in the new surface layer (g/m3)
-					csedch[isolid][i][j][ilayer-1] = (float)(totalmass
+					//compute chemical concentration in the new surface layer (g/m3)
+					cchemch[ichem][i][j][ilayer-1] = (float)(totalmass
 						/ totalvolume);
 
-					//Update mass balance terms...
-					//
 					//Note:  For the purpose of mass balance accounting,
 					//       residual mass from an eroded surface layer
 					//       is treated as a mass loss (burial out) from
@@ -143,178 +241,135 @@ void PopSedimentStack()
 					//                   transfer needs further development.
 					//
 					//compute the buried mass leaving the eroded surface layer (kg)
-					bursedchoutmass[isolid][i][j][ilayer] =
-						bursedchoutmass[isolid][i][j][ilayer] + (float)(residualmass / 1000.0);
+					burchemchoutmass[ichem][i][j][ilayer] =
+						burchemchoutmass[ichem][i][j][ilayer] + residualmass / 1000.0;
 
 					//compute the buried mass entering the new surface layer (kg)
-					bursedchinmass[isolid][i][j][ilayer-1] =
-						bursedchinmass[isolid][i][j][ilayer-1] + (float)(residualmass / 1000.0);
+					burchemchinmass[ichem][i][j][ilayer-1] =
+						burchemchinmass[ichem][i][j][ilayer-1] + residualmass / 1000.0;
 
 					//Note:  The layer that used to be at the surface is now
 					//       eliminated.  The erosion and deposition flux for
 					//       the former surface layer must be set to zero.
 					//
 					//set the erosion outflux for the former surface layer to zero (g/s)
-					erssedchoutflux[isolid][i][j][ilayer] = 0.0;
+					erschemchoutflux[ichem][i][j][ilayer] = 0.0;
 
 					//set the deposition influx for the former surface layer to zero (g/s)
-					depsedchinflux[isolid][i][j][ilayer] = 0.0;
+					depchemchinflux[ichem][i][j][ilayer] = 0.0;
+
+				}	//end loop over chemicals
+
+			}	//end if ksim > 2
+
+			//Assign new surface layer volume (and new volume)...
+			//
+			//Note:  The new volume of the new surface
+			//       layer does not need to be reset
+			//       because it will be calculated in
+			//       ChannelSolidsConcentration...
+			//
+			//Assign total volume for new surface layer (m3)
+			vlayerch[i][j][ilayer-1] = totalvolume;
+
+			//Compute thickness of new surface layer (m)
+			hlayerch[i][j][ilayer-1] = (float)(vlayerch[i][j][ilayer-1]
+				/ achbed[i][j][ilayer-1]);
+
+			//Wipe the old surface layer from the stack
+			//
+			//set the old layer thickness to zero
+			hlayerch[i][j][ilayer] = 0.0;
+
+			//set the old layer width to zero
+			bwlayerch[i][j][ilayer] = 0.0;
+
+			//set the old bed area to zero
+			achbed[i][j][ilayer] = 0.0;
+
+			//set the old layer volume to zero
+			vlayerch[i][j][ilayer] = 0.0;
+
+			//Note:  The "old layer new volume" is the
+			//       value of vlayerchnew of the layer
+			//       that is being removed from the
+			//       stack...
+			//
+			//set the old layer new volume to zero
+			vlayerchnew[i][j][ilayer] = 0.0;
+
+			//loop over solids
+			for(isolid=0; isolid<=nsolids; isolid++)
+			{
+				//set the solids concentration to zero
+				csedch[isolid][i][j][ilayer] = 0.0;
 
-				}	//end loop over solids
+			}	//end loop over solids
 
-				//if chemical transport is simulated (ksim > 2)
-				if(ksim > 2)
+			//if chemical transport is simulated (ksim > 2)
+			if(ksim > 2)
+			{
+				//loop over chemicals
+				for(ichem=1; ichem<=nchems; ichem++)
 				{
-					//loop over chemicals
-					for(ichem=1; ichem<=nchems; ichem++)
-					{
-						//compute residual chemical mass (g)
-						residualmass = cchemch[ichem][i][j][ilayer]
-							* vlayerch[i][j][ilayer];
-
-						//compute incoming chemical mass (g)
-						incomingmass = cchemch[ichem][i][j][ilayer-1]
-							* vlayerch[i][j][ilayer-1];
-
-						//compute total chemical mass (g)
-						totalmass = residualmass + incomingmass;
-
-						//compute chemical concentration in the new surface layer (g/m3)
-						cchemch[ichem][i][j][ilayer-1] = (float)(totalmass
-							/ totalvolume);
-
-						//Note:  For the purpose of mass balance accounting,
-						//       residual mass from an eroded surface layer
-						//       is treated as a mass loss (burial out) from
-						//       the eroded layer and a gain (burial in) to
-						//       the incoming (new) surface layer.  This is
-						//       done for consistency with mass accounting
-						//       convention and the frame of reference for
-						//       the stack even though mass is being scoured
-						//       from the surface rather than being buried
-						//       to the subsurface (i.e. we have to account
-						//       for mass movement even though a layer is
-						//       being lost from the stack).
-						//
-						//Developer's Note:  We could account for the transfer
-						//                   of residual mass as a scour.  The
-						//                   variables needed for this type of
-						//                   calculation exist: scrchemchinmass
-						//                   and scrchemchoutmass.  However, the
-						//                   convention for tracking this mass
-						//                   transfer needs further development.
-						//
-						//compute the buried mass leaving the eroded surface layer (kg)
-						burchemchoutmass[ichem][i][j][ilayer] =
-							burchemchoutmass[ichem][i][j][ilayer] + (float)(residualmass / 1000.0);
-
-						//compute the buried mass entering the new surface layer (kg)
-						burchemchinmass[ichem][i][j][ilayer-1] =
-							burchemchinmass[ichem][i][j][ilayer-1] + (float)(residualmass / 1000.0);
-
-						//Note:  The layer that used to be at the surface is now
-						//       eliminated.  The erosion and deposition flux for
-						//       the former surface layer must be set to zero.
-						//
-						//set the erosion outflux for the former surface layer to zero (g/s)
-						erschemchoutflux[ichem][i][j][ilayer] = 0.0;
-
-						//set the deposition influx for the former surface layer to zero (g/s)
-						depchemchinflux[ichem][i][j][ilayer] = 0.0;
-
-					}	//end loop over chemicals
-
-				}	//end if ksim > 2
-
-				//Assign new surface layer volume (and new volume)...
-				//
-				//Note:  The new volume of the new surface
-				//       layer does not need to be reset
-				//       because it will be calculated in
-				//       ChannelSolidsConcentration...
-				//
-				//Assign total volume for new surface layer (m3)
-				vlayerch[i][j][ilayer-1] = totalvolume;
-
-				//Compute thickness of new surface layer (m)
-				hlayerch[i][j][ilayer-1] = (float)(vlayerch[i][j][ilayer-1]
-					/ achbed[i][j][ilayer-1]);
-
-				//Wipe the old surface layer from the stack
-				//
-				//set the old layer thickness to zero
-				hlayerch[i][j][ilayer] = 0.0;
+					//set the chemical concentration to zero
+					cchemch[ichem][i][j][ilayer] = 0.0;
 
-				//set the old layer width to zero
-				bwlayerch[i][j][ilayer] = 0.0;
+					//set the new chemical concentration to zero (the layer is
+					//  unoccupied in both the current and new arrays)
+					cchemchnew[ichem][i][j][ilayer] = 0.0;
 
-				//set the old bed area to zero
-				achbed[i][j][ilayer] = 0.0;
+				}	//end loop over chemicals
 
-				//set the old layer volume to zero
-				vlayerch[i][j][ilayer] = 0.0;
+			}	//end if ksim > 2
 
-				//Note:  The "old layer new volume" is the
-				//       value of vlayerchnew of the layer
-				//       that is being removed from the
-				//       stack...
-				//
-				//set the old layer new volume to zero
-				vlayerchnew[i][j][ilayer] = 0.0;
-
-				//loop over solids
-				for(isolid=0; isolid<=nsolids; isolid++)
-				{
-					//set the solids concentration to zero
-					csedch[isolid][i][j][ilayer] = 0.0;
-
-				}	//end loop over solids
-
-				//if chemical transport is simulated (ksim > 2)
-				if(ksim > 2)
-				{
-					//loop over chemicals
-					for(ichem=1; ichem<=nchems; ichem++)
-					{
-						//set the chemical concentration to zero
-						cchemch[ichem][i][j][ilayer] = 0.0;
+			//if the channel elevation option > 0
+			if(elevchopt > 0)
+			{
+				//Assign channel elevation (m)
+				elevationch[i][j] = elevlayerch[i][j][ilayer-1];
 
-					}	//end loop over chemicals
+			}	//end if elevchopt > 0
 
-				}	//end if ksim > 2
+			//Compute new channel geometry...
+			//
+			//Assign channel bottom width (m)
+			bwidth[i][j] = bwlayerch[i][j][ilayer-1];
 
-				//if the channel elevation option > 0
-				if(elevchopt > 0)
-				{
-					//Assign channel elevation (m)
-					elevationch[i][j] = elevlayerch[i][j][ilayer-1];
+			//get row and column of node
+			row = ichnrow[i][j];
+			col = ichncol[i][j];
 
-				}	//end if elevchopt > 0
+			//Compute new channel bank height (m)
+			hbank[i][j] = elevationov[row][col] - elevationch[i][j];
 
-				//Compute new channel geometry...
-				//
-				//Assign channel bottom width (m)
-				bwidth[i][j] = bwlayerch[i][j][ilayer-1];
+			//compute new channel side slope (run per unit rise)
+			sideslope[i][j] = (float)(0.5 * (twidth[i][j] - bwidth[i][j])
+				/ hbank[i][j]);
 
-				//get row and column of node
-				row = ichnrow[i][j];
-				col = ichncol[i][j];
+			//Decrement the number of layers in the stack
+			nstackch[i][j] = nstackch[i][j] - 1;
 
-				//Compute new channel bank height (m)
-				hbank[i][j] = elevationov[row][col] - elevationch[i][j];
+			//if chemicals are simulated, the partitioning of all layers of the node is stale
+			if(ksim > 2) partstalech[i][j] = 1;
 
-				//compute new channel side slope (run per unit rise)
-				sideslope[i][j] = (float)(0.5 * (twidth[i][j] - bwidth[i][j])
-					/ hbank[i][j]);
-
-				//Decrement the number of layers in the stack
-				nstackch[i][j] = nstackch[i][j] - 1;
+			//if the push pass runs this time step (nodes are listed for
+			//  push) and the new surface layer volume has reached the
+			//  maximum volume limit, add the node to the push list (the
+			//  node was not listed by ChannelSolidsConcentration
+			//  because its old surface layer was below the minimum)
+			if(nlisted > 0 && vlayerch[i][j][nstackch[i][j]] >= maxvlayerch[i][j][nstackch[i][j]])
+			{
+				//add the node to the push list (processed after the pop)
+				npushch = npushch + 1;
+				pushchlink[npushch] = i;
+				pushchnode[npushch] = j;
 
-			}	//end if volume <= minvol AND nstackch[][] > 1
+			}	//end if nlisted > 0 && vlayerch[][][] >= maxvlayerch[][][]
 
-		}	//end loop over nodes
+		}	//end if volume <= minvol AND nstackch[][] > 1
 
-	}	//end loop over links
+	}	//end loop over list entries
 
 //End of function: Return to NewStateStack
 }
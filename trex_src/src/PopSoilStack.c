@@ -25,9 +25,10 @@ C-  Outputs:    bursedovinmass[][][][], bursedovoutmass[][][][],
 C-              burchemovinmass[][][][], burchemovoutmass[][][][],
 C-              nstackov[][]
 C-
-C-  Controls:   minvlayerov[][][], ksim, chnopt
+C-  Controls:   minvlayerov[][][], ksim, chnopt, npopov,
+C-              popovrow[], popovcol[]
 C-
-C-  Calls:      None
+C-  Calls:      UpdateSoilCell
 C-
 C-  Called by:  NewStateStack
 C-
@@ -44,6 +45,42 @@ C-              Denver, CO 80225
 C-
 C-	Date:		29-DEC-2003
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Burial budgets accumulated in double (no float
+C-              casts).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Processes only the cells listed by
+C-              OverlandSolidsConcentration.  Popped
+C-              cells over the maximum volume are added to the push
+C-              list when the push pass runs.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Vacated layer zeroed in new chemical concentrations.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Surface soil parameters of the new surface layer are
+C-              set (UpdateSoilCell).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	The partitioning of the cell is marked stale when
+C-              the stack changes (ksim > 2).
+C-
 C-	Revised:
 C-
 C-	Date:	
@@ -68,6 +105,8 @@ void PopSoilStack()
 {
 	//local variable declarations/definitions
 	int
+		ientry,		//loop index for list entries
+		nlisted,	//number of cells listed for push by OverlandSolidsConcentration
 		isolid,		//loop index for solids (particle) type
 		ilayer,		//index for surface layer in the sediment stack
 		ichem,		//loop index for chemical
@@ -80,254 +119,275 @@ void PopSoilStack()
 		totalmass,		//total solids mass in the new (popped) surface layer (g)
 		totalvolume;	//total volume of the new (popped) surface layer (m3)
 
-	//Loop over rows
-	for(i=1; i<=nrows; i++)
+	//save the number of cells listed for push before any pops
+	nlisted = npushov;
+
+	//loop over the cells in the overland soil stack pop list (flagged by OverlandSolidsConcentration)
+	for(ientry=1; ientry<=npopov; ientry++)
 	{
-		//Loop over columns
-		for(j=1; j<=ncols; j++)
+		//get the row and column of the list entry
+		i = popovrow[ientry];
+		j = popovcol[ientry];
+
+		//set the surface layer number
+		ilayer = nstackov[i][j];
+
+		//if the surface soil layer volume <= the minimum volume
+		//trigger AND the number of stack elements > 1
+		if(vlayerov[i][j][ilayer] <= minvlayerov[i][j][ilayer] && ilayer > 1)
 		{
-			//if the cell is in the domain (is not null)
-			if(imask[i][j] != nodatavalue)
+			//Pop the stack...
+			//
+			//Add the incoming layer to the residual mass/volume of
+			//the surface layer...
+			//
+			//compute the total (residual + incoming) volume of the new surface layer (m3)
+			totalvolume = vlayerov[i][j][ilayer] + vlayerov[i][j][ilayer-1];
+
+			//loop over solids
+			for(isolid=0; isolid<=nsolids; isolid++)
 			{
-				//set the surface layer number
-				ilayer = nstackov[i][j];
-
-				//if the surface soil layer volume <= the minimum volume
-				//trigger AND the number of stack elements > 1
-				if(vlayerov[i][j][ilayer] <= minvlayerov[i][j][ilayer] && ilayer > 1)
+				//compute residual solids mass (g)
+				residualmass = csedov[isolid][i][j][ilayer]
+					* vlayerov[i][j][ilayer];
+
+				//compute incoming solids mass (g)
+				incomingmass = csedov[isolid][i][j][ilayer-1]
+					* vlayerov[i][j][ilayer-1];
+
+				//compute total solids mass (g)
+				totalmass = residualmass + incomingmass;
+
+				//compute solids concentration in the new surface layer (g/m3)
+				csedov[isolid][i][j][ilayer-1] = (float)(totalmass
+					/ totalvolume);
+
+				//Update mass balance terms...
+				//
+				//Note:  For the purpose of mass balance accounting,
+				//       residual mass from an eroded surface layer
+				//       is treated as a mass loss (burial out) from
+				//       the eroded layer and a gain (burial in) to
+				//       the incoming (new) surface layer.  This is
+				//       done for consistency with mass accounting
+				//       convention and the frame of reference for
+				//       the stack even though mass is being scoured
+				//       from the surface rather than being buried
+				//       to the subsurface (i.e. we have to account
+				//       for mass movement even though a layer is
+				//       being lost from the stack).
+				//
+				//Developer's Note:  We could account for the transfer
+				//                   of residual mass as a scour.  The
+				//                   variables needed for this type of
+				//                   calculation exist: scrchemchinmass
+				//                   and scrchemchoutmass.  However, the
+				//                   convention for tracking this mass
+				//                   transfer needs further development.
+				//
+				//compute the buried mass leaving the eroded surface layer (kg)
+				bursedovoutmass[isolid][i][j][ilayer] =
+					bursedovoutmass[isolid][i][j][ilayer] + residualmass / 1000.0;
+
+				//compute the buried mass entering the new surface layer (kg)
+				bursedovinmass[isolid][i][j][ilayer-1] =
+					bursedovinmass[isolid][i][j][ilayer-1] + residualmass / 1000.0;
+
+				//Note:  The layer that used to be at the surface is now
+				//       eliminated.  The erosion and deposition flux for
+				//       the former surface layer must be set to zero.
+				//
+				//set the erosion outflux for the former surface layer to zero (g/s)
+				erssedovoutflux[isolid][i][j][ilayer] = 0.0;
+
+				//set the deposition influx for the former surface layer to zero (g/s)
+				depsedovinflux[isolid][i][j][ilayer] = 0.0;
+
+			}	//end loop over solids
+
+			//if chemical transport is simulated (ksim > 2)
+			if(ksim > 2)
+			{
+				//loop over chemicals
+				for(ichem=1; ichem<=nchems; ichem++)
 				{
-					//Pop the stack...
+					//compute residual chemical mass (g)
+					residualmass = cchemov[ichem][i][j][ilayer]
+						* vlayerov[i][j][ilayer];
+
+					//compute incoming chemical mass (g)
+					incomingmass = cchemov[ichem][i][j][ilayer-1]
+						* vlayerov[i][j][ilayer-1];
+
+					//compute total chemical mass (g)
+					totalmass = residualmass + incomingmass;
+
+					//compute chemical concentration in the new surface layer (g/m3)
+					cchemov[ichem][i][j][ilayer-1] = (float)(totalmass
+						/ totalvolume);
+
+					//Note:  For the purpose of mass balance accounting,
+					//       residual mass from an eroded surface layer
+					//       is treated as a mass loss (burial out) from
+					//       the eroded layer and a gain (burial in) to
+					//       the incoming (new) surface layer.  This is
+					//       done for consistency with mass accounting
+					//       convention and the frame of reference for
+					//       the stack even though mass is being scoured
+					//       from the surface rather than being buried
+					//       to the subsurface (i.e. we have to account
+					//       for mass movement even though a layer is
+					//       being lost from the stack).
 					//
-					//Add the incoming layer to the residual mass/volume of
-					//the surface layer...
+					//Developer's Note:  We could account for the transfer
+					//                   of residual mass as a scour.  The
+					//                   variables needed for this type of
+					//                   calculation exist: scrchemovinmass
+					//                   and scrchemovoutmass.  However, the
+					//                   convention for tracking this mass
+					//                   transfer needs further development.
 					//
-					//compute the total (residual + incoming) volume of the new surface layer (m3)
-					totalvolume = vlayerov[i][j][ilayer] + vlayerov[i][j][ilayer-1];
-
-					//loop over solids
-					for(isolid=0; isolid<=nsolids; isolid++)
-					{
-						//compute residual solids mass (g)
-						residualmass = csedov[isolid][i][j][ilayer]
-							* vlayerov[i][j][ilayer];
-
-						//compute incoming solids mass (g)
-						incomingmass = csedov[isolid][i][j][ilayer-1]
-							* vlayerov[i][j][ilayer-1];
-
-						//compute total solids mass (g)
-						totalmass = residualmass + incomingmass;
-
-						//compute solids concentration in the new surface layer (g/m3)
-						csedov[isolid][i][j][ilayer-1] = (float)(totalmass
-							/ totalvolume);
-
-						//Update mass balance terms...
-						//
-						//Note:  For the purpose of mass balance accounting,
-						//       residual mass from an eroded surface layer
-						//       is treated as a mass loss (burial out) from
-						//       the eroded layer and a gain (burial in) to
-						//       the incoming (new) surface layer.  This is
-						//       done for consistency with mass accounting
-						//       convention and the frame of reference for
-						//       the stack even though mass is being scoured
-						//       from the surface rather than being buried
-						//       to the subsurface (i.e. we have to account
-						//       for mass movement even though a layer is
-						//       being lost from the stack).
-						//
-						//Developer's Note:  We could account for the transfer
-						//                   of residual mass as a scour.  The
-						//                   variables needed for this type of
-						//                   calculation exist: scrchemchinmass
-						//                   and scrchemchoutmass.  However, the
-						//                   convention for tracking this mass
-						//                   transfer needs further development.
-						//
-						//compute the buried mass leaving the eroded surface layer (kg)
-						bursedovoutmass[isolid][i][j][ilayer] =
-							bursedovoutmass[isolid][i][j][ilayer] + (float)(residualmass / 1000.0);
-
-						//compute the buried mass entering the new surface layer (kg)
-						bursedovinmass[isolid][i][j][ilayer-1] =
-							bursedovinmass[isolid][i][j][ilayer-1] + (float)(residualmass / 1000.0);
-
-						//Note:  The layer that used to be at the surface is now
-						//       eliminated.  The erosion and deposition flux for
-						//       the former surface layer must be set to zero.
-						//
-						//set the erosion outflux for the former surface layer to zero (g/s)
-						erssedovoutflux[isolid][i][j][ilayer] = 0.0;
-
-						//set the deposition influx for the former surface layer to zero (g/s)
-						depsedovinflux[isolid][i][j][ilayer] = 0.0;
-
-					}	//end loop over solids
-
-					//if chemical transport is simulated (ksim > 2)
-					if(ksim > 2)
-					{
-						//loop over chemicals
-						for(ichem=1; ichem<=nchems; ichem++)
-						{
-							//compute residual chemical mass (g)
-							residualmass = cchemov[ichem][i][j][ilayer]
-								* vlayerov[i][j][ilayer];
-
-							//compute incoming chemical mass (g)
-							incomingmass = cchemov[ichem][i][j][ilayer-1]
-								* vlayerov[i][j][ilayer-1];
-
-							//compute total chemical mass (g)
-							totalmass = residualmass + incomingmass;
-
-							//compute chemical concentration in the new surface layer (g/m3)
-							cchemov[ichem][i][j][ilayer-1] = (float)(totalmass
-								/ totalvolume);
-
-							//Note:  For the purpose of mass balance accounting,
-							//       residual mass from an eroded surface layer
-							//       is treated as a mass loss (burial out) from
-							//       the eroded layer and a gain (burial in) to
-							//       the incoming (new) surface layer.  This is
-							//       done for consistency with mass accounting
-							//       convention and the frame of reference for
-							//       the stack even though mass is being scoured
-							//       from the surface rather than being buried
-							//       to the subsurface (i.e. we have to account
-							//       for mass movement even though a layer is
-							//       being lost from the stack).
-							//
-							//Developer's Note:  We could account for the transfer
-							//                   of residual mass as a scour.  The
-							//                   variables needed for this type of
-							//                   calculation exist: scrchemovinmass
-							//                   and scrchemovoutmass.  However, the
-							//                   convention for tracking this mass
-							//                   transfer needs further development.
-							//
-							//compute the buried mass leaving the eroded surface layer (kg)
-							burchemovoutmass[ichem][i][j][ilayer] =
-								burchemovoutmass[ichem][i][j][ilayer] + (float)(residualmass / 1000.0);
-
-							//compute the buried mass entering the new surface layer (kg)
-							burchemovinmass[ichem][i][j][ilayer-1] =
-								burchemovinmass[ichem][i][j][ilayer-1] + (float)(residualmass / 1000.0);
-
-							//Note:  The layer that used to be at the surface is now
-							//       eliminated.  The erosion and deposition flux for
-							//       the former surface layer must be set to zero.
-							//
-							//set the erosion outflux for the former surface layer to zero (g/s)
-							erschemovoutflux[ichem][i][j][ilayer] = 0.0;
-
-							//set the deposition influx for the former surface layer to zero (g/s)
-							depchemovinflux[ichem][i][j][ilayer] = 0.0;
-
-						}	//end loop over chemicals
-
-					}	//end if ksim > 2
-
-					//Assign new surface layer volume (and new volume)...
-					//
-					//Note:  The new volume of the new surface
-					//       layer does not need to be reset
-					//       because it will be calculated in
-					//       OverlandSolidsConcentration...
-					//
-					//Assign total volume for new surface layer (m3)
-					vlayerov[i][j][ilayer-1] = totalvolume;
+					//compute the buried mass leaving the eroded surface layer (kg)
+					burchemovoutmass[ichem][i][j][ilayer] =
+						burchemovoutmass[ichem][i][j][ilayer] + residualmass / 1000.0;
 
-					//Compute thickness of new surface layer (m)
-					hlayerov[i][j][ilayer-1] = (float)(totalvolume
-						/ aovground[i][j]);
+					//compute the buried mass entering the new surface layer (kg)
+					burchemovinmass[ichem][i][j][ilayer-1] =
+						burchemovinmass[ichem][i][j][ilayer-1] + residualmass / 1000.0;
 
-					//Wipe the old surface layer from the stack
+					//Note:  The layer that used to be at the surface is now
+					//       eliminated.  The erosion and deposition flux for
+					//       the former surface layer must be set to zero.
 					//
-					//set the old layer thickness to zero
-					hlayerov[i][j][ilayer] = 0.0;
+					//set the erosion outflux for the former surface layer to zero (g/s)
+					erschemovoutflux[ichem][i][j][ilayer] = 0.0;
+
+					//set the deposition influx for the former surface layer to zero (g/s)
+					depchemovinflux[ichem][i][j][ilayer] = 0.0;
+
+				}	//end loop over chemicals
+
+			}	//end if ksim > 2
+
+			//Assign new surface layer volume (and new volume)...
+			//
+			//Note:  The new volume of the new surface
+			//       layer does not need to be reset
+			//       because it will be calculated in
+			//       OverlandSolidsConcentration...
+			//
+			//Assign total volume for new surface layer (m3)
+			vlayerov[i][j][ilayer-1] = totalvolume;
+
+			//Compute thickness of new surface layer (m)
+			hlayerov[i][j][ilayer-1] = (float)(totalvolume
+				/ aovground[i][j]);
+
+			//Wipe the old surface layer from the stack
+			//
+			//set the old layer thickness to zero
+			hlayerov[i][j][ilayer] = 0.0;
+
+			//set the old layer volume to zero
+			vlayerov[i][j][ilayer] = 0.0;
+
+			//Note:  The "old layer new volume" is the
+			//       value of vlayerovnew of the layer
+			//       that is being removed from the
+			//       stack...
+			//
+			//set the old layer new volume to zero
+			vlayerovnew[i][j][ilayer] = 0.0;
+
+			//loop over solids
+			for(isolid=0; isolid<=nsolids; isolid++)
+			{
+				//set the solids concentration to zero
+				csedov[isolid][i][j][ilayer] = 0.0;
 
-					//set the old layer volume to zero
-					vlayerov[i][j][ilayer] = 0.0;
+			}	//end loop over solids
 
-					//Note:  The "old layer new volume" is the
-					//       value of vlayerovnew of the layer
-					//       that is being removed from the
-					//       stack...
-					//
-					//set the old layer new volume to zero
-					vlayerovnew[i][j][ilayer] = 0.0;
+			//if chemical transport is simulated (ksim > 2)
+			if(ksim > 2)
+			{
+				//loop over chemicals
+				for(ichem=1; ichem<=nchems; ichem++)
+				{
+					//set the chemical concentration to zero
+					cchemov[ichem][i][j][ilayer] = 0.0;
 
-					//loop over solids
-					for(isolid=0; isolid<=nsolids; isolid++)
-					{
-						//set the solids concentration to zero
-						csedov[isolid][i][j][ilayer] = 0.0;
+					//set the new chemical concentration to zero (the layer is
+					//  unoccupied in both the current and new arrays)
+					cchemovnew[ichem][i][j][ilayer] = 0.0;
 
-					}	//end loop over solids
+				}	//end loop over chemicals
 
-					//if chemical transport is simulated (ksim > 2)
-					if(ksim > 2)
-					{
-						//loop over chemicals
-						for(ichem=1; ichem<=nchems; ichem++)
-						{
-							//set the chemical concentration to zero
-							cchemov[ichem][i][j][ilayer] = 0.0;
+			}	//end if ksim > 2
 
-						}	//end loop over chemicals
+			//Compute new soil layer geometry...
+			//
+			//if the overland elevation option > 0
+			if(elevovopt > 0)
+			{
+				//Assign new ground elevation (m)
+				elevationov[i][j] = elevlayerov[i][j][ilayer-1];
 
-					}	//end if ksim > 2
+			}	//end if elevovopt > 0
 
-					//Compute new soil layer geometry...
-					//
-					//if the overland elevation option > 0
-					if(elevovopt > 0)
-					{
-						//Assign new ground elevation (m)
-						elevationov[i][j] = elevlayerov[i][j][ilayer-1];
+			//if the cell is a channel cell (imask[][] > 1)
+			if(imask[i][j] > 1)
+			{
+				//get link and node of cell
+				chanlink = link[i][j];
+				channode = node[i][j];
 
-					}	//end if elevovopt > 0
+				//Compute new channel bank height (m)
+				hbank[chanlink][channode] = elevationov[i][j]
+					- elevationch[chanlink][channode];
 
-					//if the cell is a channel cell (imask[][] > 1)
-					if(imask[i][j] > 1)
-					{
-						//get link and node of cell
-						chanlink = link[i][j];
-						channode = node[i][j];
+				//if the bank height goes to zero (or less)
+				if(hbank[chanlink][channode] <= 0.0)
+				{
+					//Report error type (bank height <= zero) and abort
+					SimulationError(8, i, j, nstackov[i][j]+1);
 
-						//Compute new channel bank height (m)
-						hbank[chanlink][channode] = elevationov[i][j]
-							- elevationch[chanlink][channode];
+					exit(EXIT_FAILURE);					//abort
 
-						//if the bank height goes to zero (or less)
-						if(hbank[chanlink][channode] <= 0.0)
-						{
-							//Report error type (bank height <= zero) and abort
-							SimulationError(8, i, j, nstackov[i][j]+1);
+				}	//end if hbank[][] <= 0.0
 
-							exit(EXIT_FAILURE);					//abort
+				//compute new channel side slope (run per unit rise)
+				sideslope[chanlink][channode] = (float)(0.5
+					* (twidth[chanlink][channode] - bwidth[chanlink][channode])
+					/ hbank[chanlink][channode]);
 
-						}	//end if hbank[][] <= 0.0
+			}	//end if imask > 1
 
-						//compute new channel side slope (run per unit rise)
-						sideslope[chanlink][channode] = (float)(0.5
-							* (twidth[chanlink][channode] - bwidth[chanlink][channode])
-							/ hbank[chanlink][channode]);
+			//Decrement the number of layers in the stack
+			nstackov[i][j] = nstackov[i][j] - 1;
 
-					}	//end if imask > 1
+			//Set the surface soil parameters of the new surface layer
+			UpdateSoilCell(i, j);
 
-					//Decrement the number of layers in the stack
-					nstackov[i][j] = nstackov[i][j] - 1;
+			//if chemicals are simulated, the partitioning of all layers of the cell is stale
+			if(ksim > 2) partstaleov[i][j] = 1;
 
-				}	//end if volume <= minvol AND nstackov[][] > 1
+			//if the push pass runs this time step (cells are listed for
+			//  push) and the new surface layer volume has reached the
+			//  maximum volume limit, add the cell to the push list (the
+			//  cell was not listed by OverlandSolidsConcentration
+			//  because its old surface layer was below the minimum)
+			if(nlisted > 0 && vlayerov[i][j][nstackov[i][j]] >= maxvlayerov[i][j][nstackov[i][j]])
+			{
+				//add the cell to the push list (processed after the pop)
+				npushov = npushov + 1;
+				pushovrow[npushov] = i;
+				pushovcol[npushov] = j;
 
-			}	//end if imask[][] != nodatavalue
+			}	//end if nlisted > 0 && vlayerov[][][] >= maxvlayerov[][][]
 
-		}	//end loop over columns
+		}	//end if volume <= minvol AND nstackov[][] > 1
 
-	}	//end loop over rows
+	}	//end loop over list entries
 
 //End of function: Return to NewStateStack
 }
@@ -11,7 +11,7 @@ C-  Outputs:    aspect[][]
 C-
 C-  Controls:   None
 C-
-C-  Calls:      None
+C-  Calls:      BeginImageGrid, ImageScanFloat, EndImageGrid
 C-
 C-  Called by:  ReadDataGroupB
 C-
@@ -66,6 +66,9 @@ void ReadAspectFile()
 		exit(EXIT_FAILURE);	//abort
 	}
 
+	//Start reading grid values through the model image (if any)
+	BeginImageGrid(aspectfile);
+
 	//Write label for aspect file to file
 	fprintf(echofile_fp, "\n\n\n  DEM Grid Cell Aspects (North = 0 Azimuth) (in Degrees)  \n");
 	fprintf(echofile_fp,       "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
@@ -129,18 +132,29 @@ void ReadAspectFile()
 		for(j=1; j<=gridcols; j++)
 		{
 			//Record 3
-			fscanf(aspectfile_fp, "%f", &aspect[i][j]);	//read aspect value
+			ImageScanFloat(aspectfile_fp, &aspect[i][j]);	//read aspect value
 
-			//Echo aspect in overland cell to file
-			fprintf(echofile_fp, "  %10.4f", aspect[i][j]);
+			//if grid values are not read from the model image
+			if(imagegrid == 0)
+			{
+				//Echo aspect in overland cell to file
+				fprintf(echofile_fp, "  %10.4f", aspect[i][j]);
+			}
 
 		}	//end loop over grid columns
 
-		//Start a new line for the next row of data in the echo file 
-		fprintf(echofile_fp, "\n");
+		//if grid values are not read from the model image
+		if(imagegrid == 0)
+		{
+			//Start a new line for the next row of data in the echo file 
+			fprintf(echofile_fp, "\n");
+		}
 
 	}	//end loop over grid rows
 
+	//Finish reading grid values through the model image
+	EndImageGrid();
+
 	//Close the aspect file
 	fclose(aspectfile_fp);
 
@@ -10,11 +10,11 @@ C-
 C-  Outputs:    ncwdovcells[ichem][iload],
 C-              cdwovrow[ichem][iloads][icell],
 C-              cdwovcol[ichem][iloads][icell],
-C-              cwdovarea[ichem][iload][row][col]
+C-              cwdovarea[ichem][iload][icell]
 C-
 C-  Controls:   imask[][]
 C-
-C-  Calls:      None
+C-  Calls:      BeginImageGrid, ImageScanFloat, EndImageGrid
 C-
 C-  Called by:  ReadDataGroupD
 C-
@@ -36,6 +36,14 @@ C-  Revisions:	Added code so that errors caused by bad file names
 C-              and paths are are reported to the simulation error
 C-              file in addition to the screen.
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Load areas are stored for the load cells only
+C-              (cwdovarea[ichem][iload][icell]) instead of a full
+C-              grid for each load.
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -70,7 +78,8 @@ void ReadCWDovAreaFile(int ichem, int iload)
 	float
 		cellsize,	//length of grid cell (m) (this means dx must equal dy)
 		atemp,		//local variable to store area (m2)
-		sumarea;	//local variable to compute the overall sum of surface areas (m2)
+		sumarea,	//local variable to compute the overall sum of surface areas (m2)
+		*area;		//local array for the surface area of each load cell (m2)
 
 	//write message to screen
 	printf("\n\n**************************************************\n");
@@ -99,6 +108,9 @@ void ReadCWDovAreaFile(int ichem, int iload)
 		exit(EXIT_FAILURE);	//abort
 	}
 
+	//Start reading grid values through the model image (if any)
+	BeginImageGrid(cwdovareafile);
+
 	//Write label for overland distributed chemical load area file to file
 	fprintf(echofile_fp, "\n\n\n  Overland Distributed Chemical Load Area File  \n");
 	fprintf(echofile_fp,       "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
@@ -154,18 +166,13 @@ void ReadCWDovAreaFile(int ichem, int iload)
 	fprintf(echofile_fp, "   Cell size = %10.2f (m)\n", cellsize);
 	fprintf(echofile_fp, "   No Data Value = %6d\n", nodatavalue);
 
-	//Note:  Memory for [ichem] and [iload] dimensions of the cwdovarea
-	//       array was allocated in ReadDataGroupD.
-	//
-	//Allocate memory for distributed load surface areas
-	cwdovarea[ichem][iload] = (float **)malloc((nrows+1) * sizeof(float **));		//allocate memory
-
 	//compute the maximum number of cells in the domain
 	maxcells = gridrows * gridcols;
 
 	//Allocate memory for local grid cell references
 	row = (int *)malloc((maxcells+1) * sizeof(int));		//allocate memory
 	col = (int *)malloc((maxcells+1) * sizeof(int));		//allocate memory
+	area = (float *)malloc((maxcells+1) * sizeof(float));	//allocate memory
 
 	//initialize number of overland distributed chemical source cells to zero
 	ncwdovcells[ichem][iload] = 0;
@@ -176,17 +183,18 @@ void ReadCWDovAreaFile(int ichem, int iload)
 	//Loop over number of rows
 	for(i=1; i<=gridrows; i++)
 	{
-		//Allocate memory for distributed load surface areas
-		cwdovarea[ichem][iload][i] = (float *)malloc((ncols+1) * sizeof(float));	//allocate memory
-
 		//Loop over number of columns
 		for(j=1; j<=gridcols; j++)
 		{
 			//Record 3
-			fscanf(cwdovareafile_fp, "%f", &atemp);	//read surface area for load (m2)
+			ImageScanFloat(cwdovareafile_fp, &atemp);	//read surface area for load (m2)
 
-			//Echo surface area for load in overland cell to file
-			fprintf(echofile_fp, "  %10.4f", atemp);
+			//if grid values are not read from the model image
+			if(imagegrid == 0)
+			{
+				//Echo surface area for load in overland cell to file
+				fprintf(echofile_fp, "  %10.4f", atemp);
+			}
 
 			//if the cell is in the domain and the area is greater than zero
 			if(imask[i][j] > 0 && atemp > 0.0)
@@ -198,8 +206,8 @@ void ReadCWDovAreaFile(int ichem, int iload)
 				row[ncwdovcells[ichem][iload]] = i;
 				col[ncwdovcells[ichem][iload]] = j;
 
-				//assign area to global variable
-				cwdovarea[ichem][iload][i][j] = atemp;
+				//store the surface area of this cell (local)
+				area[ncwdovcells[ichem][iload]] = atemp;
 
 				//compute sum of surface area (m2)
 				sumarea = sumarea + atemp;
@@ -208,8 +216,12 @@ void ReadCWDovAreaFile(int ichem, int iload)
 
 		}	//end loop over grid columns
 
-		//Start a new line for the next row of data in the echo file
-		fprintf(echofile_fp, "\n");
+		//if grid values are not read from the model image
+		if(imagegrid == 0)
+		{
+			//Start a new line for the next row of data in the echo file
+			fprintf(echofile_fp, "\n");
+		}
 
 	}	//end loop over grid rows
 
@@ -231,6 +243,7 @@ void ReadCWDovAreaFile(int ichem, int iload)
 	//Allocate remaining memory for global distributed load cell references
 	cwdovrow[ichem][iload] = (int *)malloc((ncwdovcells[ichem][iload]+1) * sizeof(int));		//allocate memory
 	cwdovcol[ichem][iload] = (int *)malloc((ncwdovcells[ichem][iload]+1) * sizeof(int));		//allocate memory
+	cwdovarea[ichem][iload] = (float *)malloc((ncwdovcells[ichem][iload]+1) * sizeof(float));	//allocate memory
 
 	//Transfer data from local to global cell references arrays...
 	//
@@ -241,11 +254,18 @@ void ReadCWDovAreaFile(int ichem, int iload)
 		cwdovrow[ichem][iload][icell] = row[icell];
 		cwdovcol[ichem][iload][icell] = col[icell];
 
+		//store the surface area of the cell (m2)
+		cwdovarea[ichem][iload][icell] = area[icell];
+
 	}	//end loop over active cells
 
 	//deallocate memory for local variables 
 	free(row);
 	free(col);
+	free(area);
+
+	//Finish reading grid values through the model image
+	EndImageGrid();
 
 	//Close overland distributed chemical load area file
 	fclose(cwdovareafile_fp);
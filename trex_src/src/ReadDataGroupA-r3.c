@@ -62,6 +62,12 @@ C-
 C-  Revisions:  Added input data fields and controls for time step
 C-              option (dtopt) implementation
 C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Output files are opened by OpenOutputFile.
+C-
 C-  Revised:
 C-
 C-  Date:
@@ -279,7 +285,7 @@ void ReadDataGroupA()
 	echofile_fp = NULL;
 
 	//open the echo file
-	echofile_fp = fopen(echofile, "w");
+	echofile_fp = OpenOutputFile(echofile, "w");
 
 	//if file pointer is still null, then abort
 	if(echofile_fp == NULL)
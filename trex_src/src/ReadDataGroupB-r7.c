@@ -98,6 +98,19 @@ C-  Revisions:	Added code so that errors caused by bad file names
 C-              and paths are are reported to the simulation error
 C-              file in addition to the screen.
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Output files are opened by OpenOutputFile.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	The value grids are not read by a dry run (dryrunopt
+C-              = 1).
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -121,7 +134,7 @@ void ReadDataGroupB()
 		scale;		//scale factor
 
 	//open the echo file in append mode (append to existing file)
-	echofile_fp = fopen(echofile, "a");
+	echofile_fp = OpenOutputFile(echofile, "a");
 
 	//write message to screen
 	printf("\n\n***************************\n");
@@ -169,8 +182,12 @@ void ReadDataGroupB()
 	//Echo elevation file name to file
 	fprintf(echofile_fp, "\nElevation File: %s\n\n", elevationfile);
 
-	//Read Elevation File
-	ReadElevationFile();
+	//Read Elevation File (not read by a dry run)
+	if(dryrunopt == 0)
+	{
+		ReadElevationFile();
+
+	}	//end if dryrunopt == 0
 
 	//Record 4
 	fscanf(inputfile_fp, "%s %d",  //read
@@ -275,8 +292,12 @@ void ReadDataGroupB()
 
 			}  //end loop over rows
 
-			//Read Soil Type Classification File (for ksim = 1, soil layer = 1)
-			ReadSoilTypeFile(1);
+			//Read Soil Type Classification File (for ksim = 1, soil layer = 1) (not read by a dry run)
+			if(dryrunopt == 0)
+			{
+				ReadSoilTypeFile(1);
+
+			}	//end if dryrunopt == 0
 
 		}  //End check of infopt
 
@@ -340,8 +361,12 @@ void ReadDataGroupB()
 		//Echo land use classification file name to file
 		fprintf(echofile_fp, "\n\nLand Use Classification File %s\n\n", landusefile);
 
-		//Read Land Use Classification File
-		ReadLandUseFile();
+		//Read Land Use Classification File (not read by a dry run)
+		if(dryrunopt == 0)
+		{
+			ReadLandUseFile();
+
+		}	//end if dryrunopt == 0
 
 	}  //End check of ksim = 1
 
@@ -361,8 +386,12 @@ void ReadDataGroupB()
 	fprintf(echofile_fp, "\n\nStorage Depth File: %s\n",
 		storagedepthfile);
 
-	//Read Storage Depth File (storage depth for each grid cell in overland plane)
-	ReadStorageDepthFile();
+	//Read Storage Depth File (storage depth for each grid cell in overland plane) (not read by a dry run)
+	if(dryrunopt == 0)
+	{
+		ReadStorageDepthFile();
+
+	}	//end if dryrunopt == 0
 
 	//Record 12
 	fscanf(inputfile_fp, "%s %d",  //read
@@ -550,8 +579,12 @@ void ReadDataGroupB()
 
 			}	//end loop over number of links
 
-			//Compute initial bed elevation of each channel element (link/node)
-			ComputeChannelElevation();
+			//Compute initial bed elevation of each channel element (link/node) (not computed by a dry run)
+			if(dryrunopt == 0)
+			{
+				ComputeChannelElevation();
+
+			}	//end if dryrunopt == 0
 		}
 		else	//trex reads channel network topology directly from file
 		{
@@ -626,8 +659,12 @@ void ReadDataGroupB()
 	//Echo Initial Water Overland to file
 	fprintf(echofile_fp, "\n\nInitial Water Depth Overland: %s\n", wateroverlandfile);
 
-	//Read initial water in storage overland file
-	ReadInitialWaterOverlandFile();
+	//Read initial water in storage overland file (not read by a dry run)
+	if(dryrunopt == 0)
+	{
+		ReadInitialWaterOverlandFile();
+
+	}	//end if dryrunopt == 0
 
 	//if infopt > 0, read initial soil moisture and infiltration (wetting front) depths
 	if(infopt > 0)
@@ -668,8 +705,12 @@ void ReadDataGroupB()
 		//Echo initial infiltration depth (depth to wetting front) file name to file
 		fprintf(echofile_fp, "\n\nInitial Infiltration Depth: %s\n", infiltrationfile);
 
-		//Read initial infiltration depth file
-		ReadInitialInfiltrationFile();
+		//Read initial infiltration depth file (not read by a dry run)
+		if(dryrunopt == 0)
+		{
+			ReadInitialInfiltrationFile();
+
+		}	//end if dryrunopt == 0
 
 	}  //end if infopt > 0
 
@@ -943,8 +984,12 @@ void ReadDataGroupB()
 			//Echo design rain grid file name to file
 			fprintf(echofile_fp, "\n\nDesign Rain Grid: %s\n", designraingridfile);
 
-			//Read design rain grid file
-			ReadDesignRainGrid();
+			//Read design rain grid file (not read by a dry run)
+			if(dryrunopt == 0)
+			{
+				ReadDesignRainGrid();
+
+			}	//end if dryrunopt == 0
 
 		}  //end if rainopt = 2
 	}
@@ -1003,7 +1048,7 @@ void ReadDataGroupB()
 		fprintf(echofile_fp, "\nRadar Data are Echoed in Radar Rain Verification File\n");
 
 		//Open radar rain verification file and write header line
-		radarverifyfile_fp = fopen(radarverifyfile,"w");
+		radarverifyfile_fp = OpenOutputFile(radarverifyfile,"w");
 
 		//if the radar rain verification file pointer is null, abort execution
 		if(radarverifyfile_fp==NULL)
@@ -1414,8 +1459,12 @@ void ReadDataGroupB()
 		//echo DEM slope file name
 		fprintf(echofile_fp, "\n\nDEM Slope Grid File:  %s\n", slopefile);
 
-		//Read DEM slope file
-		ReadSlopeFile();
+		//Read DEM slope file (not read by a dry run)
+		if(dryrunopt == 0)
+		{
+			ReadSlopeFile();
+
+		}	//end if dryrunopt == 0
 
 		//Record 48 (Part 1)
 		fscanf(inputfile_fp, "%s",	//read
@@ -1433,8 +1482,12 @@ void ReadDataGroupB()
 		//echo DEM aspect file name
 		fprintf(echofile_fp, "\n\nDEM Aspect Grid File:  %s\n", aspectfile);
 
-		//Read DEM slope file
-		ReadAspectFile();
+		//Read DEM slope file (not read by a dry run)
+		if(dryrunopt == 0)
+		{
+			ReadAspectFile();
+
+		}	//end if dryrunopt == 0
 
 		//Record 49 (Part 1)
 		fscanf(inputfile_fp, "%s",	//read
@@ -1452,8 +1505,12 @@ void ReadDataGroupB()
 		//echo land use skyview file name
 		fprintf(echofile_fp, "\n\nLand Use Skyview Grid File:  %s\n", skyviewfile);
 
-		//Read landuse skyview file
-		ReadSkyviewFile();
+		//Read landuse skyview file (not read by a dry run)
+		if(dryrunopt == 0)
+		{
+			ReadSkyviewFile();
+
+		}	//end if dryrunopt == 0
 
 	}  //end if meltopt > 0
 
@@ -1476,8 +1533,12 @@ void ReadDataGroupB()
 		//echo initial snow file name
 		fprintf(echofile_fp, "\n\nInitial Snow (SWE) Depth File:  %s\n", snowfile);
 
-		//Read initial snow depth (as swe) file
-		ReadInitialSnowFile();
+		//Read initial snow depth (as swe) file (not read by a dry run)
+		if(dryrunopt == 0)
+		{
+			ReadInitialSnowFile();
+
+		}	//end if dryrunopt == 0
 
 	}	//end if snowopt > 0 or meltopt > 0
 
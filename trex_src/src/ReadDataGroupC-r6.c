@@ -50,6 +50,34 @@ C-
 C-  Revisions:  Added user-defined inputs for overland soil transport
 C-              capacity calculations: ktcov, betatcov, gammatcov,
 C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Output files are opened by OpenOutputFile.
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Load areas are stored for the load cells only
+C-              (swdovarea[isolid][iload][icell]) instead of a full
+C-              grid for each load.
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  The value grids are not read by a dry run (dryrunopt
+C-              = 1).
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Record 8d reads the critical shear stress for
+C-              overland erosion into tceov (was read into tcdov).
+C-
 C-  Revised:    
 C-
 C-  Date:       
@@ -92,7 +120,7 @@ void ReadDataGroupC()
 		sname[MAXNAMESIZE];			//name of chemical property/constant
 
 	//open the echo file in append mode (append to existing file)
-	echofile_fp = fopen(echofile, "a");
+	echofile_fp = OpenOutputFile(echofile, "a");
 
 	//write message to screen
 	printf("\n\n***************************\n");
@@ -582,7 +610,7 @@ void ReadDataGroupC()
 			{
 				//Record 8d
 				fscanf(inputfile_fp, "%f %f",	//read
-					&tcdov[i],				//particle critical shear stress for erosion overland (N/m2)
+					&tceov[i],				//particle critical shear stress for erosion overland (N/m2)
 					&zageov[i]);			//particle aging factor overland (dimensionless)
 
 				//Echo particle characteristics to file
@@ -1350,8 +1378,12 @@ void ReadDataGroupC()
 	//Echo land use classification file name to file
 	fprintf(echofile_fp, "\n\nLand Use Classification File: %s\n\n", landusefile);
 
-	//Read Land Use Classification File
-	ReadLandUseFile();
+	//Read Land Use Classification File (not read by a dry run)
+	if(dryrunopt == 0)
+	{
+		ReadLandUseFile();
+
+	}	//end if dryrunopt == 0
 
 	//Write label for soil stack characteristics to file
 	fprintf(echofile_fp, "\n\nSoil Stack Characteristics");
@@ -1423,8 +1455,12 @@ void ReadDataGroupC()
 	fprintf(echofile_fp, "\n\nSoil Stack File: %s\n",
 		soilstackfile);
 
-	//Read soil stack file
-	ReadSoilStackFile();
+	//Read soil stack file (not read by a dry run)
+	if(dryrunopt == 0)
+	{
+		ReadSoilStackFile();
+
+	}	//end if dryrunopt == 0
 
 	//Read soil element properties (thickness, soil type)
 	//
@@ -1479,8 +1515,12 @@ void ReadDataGroupC()
 		fprintf(echofile_fp, "\n\nSoil Thickness File For Layer %d: %s\n",
 			ilayer, soillayerthicknessfile);
 
-		//Read Soil Layer Thickness file
-		ReadSoilLayerThicknessFile(ilayer);
+		//Read Soil Layer Thickness file (not read by a dry run)
+		if(dryrunopt == 0)
+		{
+			ReadSoilLayerThicknessFile(ilayer);
+
+		}	//end if dryrunopt == 0
 
 		//Record 31 (Part 1)
 		fscanf(inputfile_fp, "%s",	//read
@@ -1496,8 +1536,12 @@ void ReadDataGroupC()
 		fprintf(echofile_fp, "\n\nSoil Type Classification File For Layer %d: %s\n",
 			ilayer, soiltypefile);
 
-		//Read soil type classification file (for this layer)
-		ReadSoilTypeFile(ilayer);
+		//Read soil type classification file (for this layer) (not read by a dry run)
+		if(dryrunopt == 0)
+		{
+			ReadSoilTypeFile(ilayer);
+
+		}	//end if dryrunopt == 0
 
 	}	//end loop over layers
 
@@ -1566,8 +1610,12 @@ void ReadDataGroupC()
 			"\n  Solids Type: %d  Overland Solids Initial Condition File: %s\n",
 			isolid, initialssovfile);
 
-		//Read Overland Initial Suspended Solids File
-		ReadInitialSolidsOverlandFile(isolid);
+		//Read Overland Initial Suspended Solids File (not read by a dry run)
+		if(dryrunopt == 0)
+		{
+			ReadInitialSolidsOverlandFile(isolid);
+
+		}	//end if dryrunopt == 0
 
 	}	//end loop over solids
 
@@ -1819,7 +1867,7 @@ void ReadDataGroupC()
 
 	//Allocate memory for overland distributed solids loads/forcing functions (wdov)
 	nswdov = (int *)malloc((nsolids+1) * sizeof(int));					//allocate memory
-	swdovarea = (float ****)malloc((nsolids+1) * sizeof(float ***));	//allocate memory
+	swdovarea = (float ***)malloc((nsolids+1) * sizeof(float **));	//allocate memory
 	nswdovcells = (int **)malloc((nsolids+1) * sizeof(int *));			//allocate memory
 	swdovrow = (int ***)malloc((nsolids+1) * sizeof(int **));			//allocate memory
 	swdovcol = (int ***)malloc((nsolids+1) * sizeof(int **));			//allocate memory
@@ -1849,7 +1897,7 @@ void ReadDataGroupC()
 			"Solids Type: ", isolid, "Number of Loads: ", nswdov[isolid], "Description: ", loadname);
 
 		//Allocate additional memory for overland distributed solids loads/forcing functions
-		swdovarea[isolid] = (float ***)malloc((nswdov[isolid]+1) * sizeof(float **));	//allocate memory
+		swdovarea[isolid] = (float **)malloc((nswdov[isolid]+1) * sizeof(float *));	//allocate memory
 		nswdovcells[isolid] = (int *)malloc((nswdov[isolid]+1) * sizeof(int));		//allocate memory
 		swdovrow[isolid] = (int **)malloc((nswdov[isolid]+1) * sizeof(int *));		//allocate memory
 		swdovcol[isolid] = (int **)malloc((nswdov[isolid]+1) * sizeof(int *));		//allocate memory
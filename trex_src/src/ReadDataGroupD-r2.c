@@ -35,6 +35,27 @@ C-  Date:       29-APR-2008
 C-
 C-  Revisions:  Added overland distributed loads
 C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Output files are opened by OpenOutputFile.
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Load areas are stored for the load cells only
+C-              (cwdovarea[ichem][iload][icell]) instead of a full
+C-              grid for each load.
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  The value grids are not read by a dry run (dryrunopt
+C-              = 1).
+C-
 C-  Revised:    
 C-
 C-  Date:       
@@ -82,7 +103,7 @@ void ReadDataGroupD()
 		cname[MAXNAMESIZE];			//name of chemical property/constant
 
 	//open the echo file in append mode (append to existing file)
-	echofile_fp = fopen(echofile, "a");
+	echofile_fp = OpenOutputFile(echofile, "a");
 
 	//write message to screen
 	printf("\n\n***************************\n");
@@ -859,8 +880,12 @@ void ReadDataGroupD()
 			fprintf(echofile_fp, "\nSoil Initial Condition File: %s\n",
 				soilchemicfile);
 
-			//Read chemical initial condition file for this layer
-			ReadSoilLayerChemicalFile(ilayer, ichem);
+			//Read chemical initial condition file for this layer (not read by a dry run)
+			if(dryrunopt == 0)
+			{
+				ReadSoilLayerChemicalFile(ilayer, ichem);
+
+			}	//end if dryrunopt == 0
 
 		}	//end loop over chemicals
 
@@ -892,8 +917,12 @@ void ReadDataGroupD()
 		fprintf(echofile_fp, "\n\nChemical: %5d  Overland Initial Condition File: %s\n",
 			ichem, initialchemovfile);
 
-		//Read initial chemical overland file
-		ReadInitialChemicalOverlandFile(ichem);
+		//Read initial chemical overland file (not read by a dry run)
+		if(dryrunopt == 0)
+		{
+			ReadInitialChemicalOverlandFile(ichem);
+
+		}	//end if dryrunopt == 0
 
 	}	//end loop over chemicals
 
@@ -1117,7 +1146,7 @@ void ReadDataGroupD()
 
 	//Allocate memory for overland distributed chemical loads/forcing functions (wdov)
 	ncwdov = (int *)malloc((nchems+1) * sizeof(int));				//allocate memory
-	cwdovarea = (float ****)malloc((nchems+1) * sizeof(float ***));	//allocate memory
+	cwdovarea = (float ***)malloc((nchems+1) * sizeof(float **));	//allocate memory
 	ncwdovcells = (int **)malloc((nchems+1) * sizeof(int *));		//allocate memory
 	cwdovrow = (int ***)malloc((nchems+1) * sizeof(int **));		//allocate memory
 	cwdovcol = (int ***)malloc((nchems+1) * sizeof(int **));		//allocate memory
@@ -1147,7 +1176,7 @@ void ReadDataGroupD()
 			"Chemical Type: ", ichem, "Number of Loads: ", ncwdov[ichem], "Description: ", loadname);
 
 		//Allocate additional memory for overland distributed chemical loads/forcing functions
-		cwdovarea[ichem] = (float ***)malloc((ncwdov[ichem]+1) * sizeof(float **));	//allocate memory
+		cwdovarea[ichem] = (float **)malloc((ncwdov[ichem]+1) * sizeof(float *));	//allocate memory
 		ncwdovcells[ichem] = (int *)malloc((ncwdov[ichem]+1) * sizeof(int));		//allocate memory
 		cwdovrow[ichem] = (int **)malloc((ncwdov[ichem]+1) * sizeof(int *));		//allocate memory
 		cwdovcol[ichem] = (int **)malloc((ncwdov[ichem]+1) * sizeof(int *));		//allocate memory
@@ -12,7 +12,7 @@ C-  Outputs:    None
 C-
 C-  Controls:   ksim, chnopt, fpocovopt, fpocchopt
 C-
-C-  Calls:      None
+C-  Calls:      ZoneGeneralProperty, ZoneOverlandProperty
 C-
 C-  Called by:  ReadInputFile
 C-
@@ -21,6 +21,20 @@ C-              John England
 C-
 C-  Date:       09-JUL-2004
 C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Output files are opened by OpenOutputFile.
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  General and overland property grids are converted to
+C-              zoned storage after they are read.  Fixed the column
+C-              loop index of the overland property allocation.
+C-
 C-  Revised:
 C-
 C----------------------------------------------------------------------*/
@@ -60,7 +74,7 @@ void ReadDataGroupE()
 		scale;			//scale factor
 
 	//open the echo file in append mode (append to existing file)
-	echofile_fp = fopen(echofile, "a");
+	echofile_fp = OpenOutputFile(echofile, "a");
 
 	//write message to screen
 	printf("\n\n***************************\n");
@@ -133,6 +147,12 @@ void ReadDataGroupE()
 	nenvgtfpairs = (int **)malloc((npropg+1) * sizeof(int *));		//number of general time functions pairs
 	envgtf = (float ***)malloc((npropg+1) * sizeof(float *));		//general time function value
 	envgtftime = (float ***)malloc((npropg+1) * sizeof(float *));	//general time function time break
+	nenvgzones = (int *)malloc((npropg+1) * sizeof(int));				//number of general property zones
+	envgzone = (unsigned char ***)malloc((npropg+1) * sizeof(unsigned char **));	//general property zone id grid
+	envgzonevalue = (float **)malloc((npropg+1) * sizeof(float *));		//general property zone value
+	envgzonetfid = (int **)malloc((npropg+1) * sizeof(int *));			//general property zone time function id
+	envgzonecurrent = (float **)malloc((npropg+1) * sizeof(float *));	//current general property zone value
+	envgzonestale = (int *)malloc((npropg+1) * sizeof(int));			//general property zone update flag
 
 	//Allocate memory for environmental property file names
 	envpropfile = (char *)malloc(MAXNAMESIZE * sizeof(char));	//allocate memory
@@ -359,6 +379,9 @@ void ReadDataGroupE()
 
 		}	//end if nenvgtf[iprop] > 0
 
+		//Store the property as a zone table when it is uniform or zoned
+		ZoneGeneralProperty(iprop);
+
 	}	//end loop over general properties
 
 	//if chemical transport is simulated
@@ -402,6 +425,12 @@ void ReadDataGroupE()
 		nenvovtfpairs = (int **)malloc((npropov+1) * sizeof(int *));		//number of overland time functions pairs
 		envovtf = (float ***)malloc((npropov+1) * sizeof(float *));			//overland time function value
 		envovtftime = (float ***)malloc((npropov+1) * sizeof(float *));		//overland time function time break
+		nenvovzones = (int **)malloc((npropov+1) * sizeof(int *));			//number of overland property zones
+		envovzone = (unsigned char ****)malloc((npropov+1) * sizeof(unsigned char ***));	//overland property zone id grid
+		envovzonevalue = (float ***)malloc((npropov+1) * sizeof(float **));	//overland property zone value
+		envovzonetfid = (int ***)malloc((npropov+1) * sizeof(int **));		//overland property zone time function id
+		envovzonecurrent = (float ***)malloc((npropov+1) * sizeof(float **));	//current overland property zone value
+		envovzonestale = (int *)malloc((npropov+1) * sizeof(int));			//overland property zone update flag
 
 		//loop over number of overland properties
 		for(iprop=1; iprop<=npropov; iprop++)
@@ -446,7 +475,7 @@ void ReadDataGroupE()
 				envovtfid[iprop][i] = (int **)malloc((ncols+1) * sizeof(int *));	//overland property time function id (pointer)
 
 				//loop over columns
-				for(i=1; i<=ncols; i++)
+				for(j=1; j<=ncols; j++)
 				{
 					//the number of layers is the maximum number of layers
 					nlayers = maxstackov;
@@ -659,6 +688,9 @@ void ReadDataGroupE()
 
 			}	//end if nenvovtf[iprop] > 0
 
+			//Store the property as zone tables when every layer is uniform or zoned
+			ZoneOverlandProperty(iprop);
+
 		}	//end loop over overland properties
 
 		//Read channel properties...
@@ -39,6 +39,12 @@ C-  Revisions:  Implemented subsurface reporting.  Added records to
 C-              report chemical concentrations in subsurface soil
 C-              and sediment stack layers.
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Output files are opened by OpenOutputFile.
+C-
 C-	Revised:
 C-
 C-	Date:	
@@ -69,7 +75,7 @@ void ReadDataGroupF()
 	ssrflag = 0;
 
 	//open the echo file in append mode (append to existing file)
-	echofile_fp = fopen(echofile, "a");
+	echofile_fp = OpenOutputFile(echofile, "a");
 
 	//write message to screen
 	printf("\n\n***************************\n");
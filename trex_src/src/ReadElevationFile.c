@@ -13,7 +13,7 @@ C-  Outputs:    None
 C-
 C-  Controls:   None
 C-
-C-  Calls:      None
+C-  Calls:      BeginImageGrid, ImageScanFloat, EndImageGrid
 C-
 C-  Called by:  ReadDataGroupB
 C-
@@ -95,6 +95,9 @@ void ReadElevationFile()
 		exit(EXIT_FAILURE);	//abort
 	}
 
+	//Start reading grid values through the model image (if any)
+	BeginImageGrid(elevationfile);
+
 	//Write label for elevation file to file
 	fprintf(echofile_fp, "\n\n\n  Elevation File: Initial Overland Elevations  \n");
 	fprintf(echofile_fp,       "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
@@ -160,10 +163,14 @@ void ReadElevationFile()
 		for(j=1; j<=gridcols; j++)
 		{
 			//Record 3
-			fscanf(elevationfile_fp, "%f", &elevationov0[i][j]);	//read initial elevation value
+			ImageScanFloat(elevationfile_fp, &elevationov0[i][j]);	//read initial elevation value
 
-			//Echo elevation to file
-			fprintf(echofile_fp, "  %8.2f", elevationov0[i][j]);
+			//if grid values are not read from the model image
+			if(imagegrid == 0)
+			{
+				//Echo elevation to file
+				fprintf(echofile_fp, "  %8.2f", elevationov0[i][j]);
+			}
 
 			//set present overland elevation to initial elevation (m)
 			elevationov[i][j] = elevationov0[i][j];
@@ -195,11 +202,18 @@ void ReadElevationFile()
 
 		}	//end loop over grid columns
 
-		//Start a new line for the next row of data in the echo file 
-		fprintf(echofile_fp, "\n");
+		//if grid values are not read from the model image
+		if(imagegrid == 0)
+		{
+			//Start a new line for the next row of data in the echo file 
+			fprintf(echofile_fp, "\n");
+		}
 
 	}	//end loop over grid rows
 
+	//Finish reading grid values through the model image
+	EndImageGrid();
+
 	//Close Elevation File
 	fclose(elevationfile_fp);
 
@@ -12,7 +12,7 @@ C-  Outputs:    envg[][][]
 C-
 C-  Controls:   imask[][]
 C-
-C-  Calls:      None
+C-  Calls:      BeginImageGrid, ImageScanFloat, EndImageGrid
 C-
 C-  Called by:  ReadDataGroupE
 C-
@@ -94,6 +94,9 @@ void ReadGeneralEnvironmentFile(int pid, float conv, float scale)
 		exit(EXIT_FAILURE);	//abort
 	}
 
+	//Start reading grid values through the model image (if any)
+	BeginImageGrid(envpropfile);
+
 	//Write label for environmental property file to file
 	fprintf(echofile_fp, "\n\n\n  Environmental Property File: pid = %d  \n", pid);
 	fprintf(echofile_fp,       "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
@@ -151,10 +154,14 @@ void ReadGeneralEnvironmentFile(int pid, float conv, float scale)
 		for(j=1; j<=gridcols; j++)
 		{
 			//Record 3
-			fscanf(envpropfile_fp, "%f", &envvalue);	//read property value
+			ImageScanFloat(envpropfile_fp, &envvalue);	//read property value
 
-			//Echo property value to file
-			fprintf(echofile_fp, "  %8.2f", envvalue);
+			//if grid values are not read from the model image
+			if(imagegrid == 0)
+			{
+				//Echo property value to file
+				fprintf(echofile_fp, "  %8.2f", envvalue);
+			}
 
 			//if the cell is in the domain
 			if(imask[i][j] > 0)
@@ -166,11 +173,18 @@ void ReadGeneralEnvironmentFile(int pid, float conv, float scale)
 
 		}	//end loop over grid columns
 
-		//Start a new line for the next row of data in the echo file 
-		fprintf(echofile_fp, "\n");
+		//if grid values are not read from the model image
+		if(imagegrid == 0)
+		{
+			//Start a new line for the next row of data in the echo file 
+			fprintf(echofile_fp, "\n");
+		}
 
 	}	//end loop over grid rows
 
+	//Finish reading grid values through the model image
+	EndImageGrid();
+
 	//Close Environmental Property File
 	fclose(envpropfile_fp);
 
@@ -13,7 +13,7 @@ C-  Outputs:    envg[][][]
 C-
 C-  Controls:   imask[][]
 C-
-C-  Calls:      None
+C-  Calls:      BeginImageGrid, ImageScanInt, EndImageGrid
 C-
 C-  Called by:  ReadDataGroupE
 C-
@@ -95,6 +95,9 @@ void ReadGeneralTFPointerFile(int pid)
 		exit(EXIT_FAILURE);	//abort
 	}
 
+	//Start reading grid values through the model image (if any)
+	BeginImageGrid(envtfpointerfile);
+
 	//Write label for environmental time function pointer file to file
 	fprintf(echofile_fp, "\n\n\n  Environmental Time Function Pointer File: pid = %d  \n", pid);
 	fprintf(echofile_fp,       "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
@@ -152,10 +155,14 @@ void ReadGeneralTFPointerFile(int pid)
 		for(j=1; j<=gridcols; j++)
 		{
 			//Record 3
-			fscanf(envtfpointerfile_fp, "%d", &tfid);	//read property value
+			ImageScanInt(envtfpointerfile_fp, &tfid);	//read property value
 
-			//Echo property value to file
-			fprintf(echofile_fp, "  %5d", tfid);
+			//if grid values are not read from the model image
+			if(imagegrid == 0)
+			{
+				//Echo property value to file
+				fprintf(echofile_fp, "  %5d", tfid);
+			}
 
 			//if the cell is in the domain
 			if(imask[i][j] > 0)
@@ -167,11 +174,18 @@ void ReadGeneralTFPointerFile(int pid)
 
 		}	//end loop over grid columns
 
-		//Start a new line for the next row of data in the echo file 
-		fprintf(echofile_fp, "\n");
+		//if grid values are not read from the model image
+		if(imagegrid == 0)
+		{
+			//Start a new line for the next row of data in the echo file 
+			fprintf(echofile_fp, "\n");
+		}
 
 	}	//end loop over grid rows
 
+	//Finish reading grid values through the model image
+	EndImageGrid();
+
 	//Close Environmental Time Function Pointer File
 	fclose(envtfpointerfile_fp);
 
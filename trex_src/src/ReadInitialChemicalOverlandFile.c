@@ -11,7 +11,7 @@ C-  Outputs:    cchemov[ichem[row][col][0] (at time zero)
 C-
 C-  Controls:   imask[][], hov[][]
 C-
-C-  Calls:      None
+C-  Calls:      BeginImageGrid, ImageScanFloat, EndImageGrid
 C-
 C-  Called by:  ReadDataGroupD
 C-
@@ -89,6 +89,9 @@ void ReadInitialChemicalOverlandFile(int ichem)
 		exit(EXIT_FAILURE);	//abort
 	}
 
+	//Start reading grid values through the model image (if any)
+	BeginImageGrid(initialchemovfile);
+
 	//Write label for initial chemical overland overland file to file
 	fprintf(echofile_fp,
 		"\n\n\n  Initial Chemical Overland File: Grid Cell Concentrations  \n");
@@ -150,10 +153,14 @@ void ReadInitialChemicalOverlandFile(int ichem)
 		for(j=1; j<=gridcols; j++)
 		{
 			//Record 3
-			fscanf(initialchemovfile_fp, "%f", &cchemtemp);	//read initial chemical concentration value
+			ImageScanFloat(initialchemovfile_fp, &cchemtemp);	//read initial chemical concentration value
 
-			//Echo initial chemical in overland cell to file
-			fprintf(echofile_fp, "  %10.4f", cchemtemp);
+			//if grid values are not read from the model image
+			if(imagegrid == 0)
+			{
+				//Echo initial chemical in overland cell to file
+				fprintf(echofile_fp, "  %10.4f", cchemtemp);
+			}
 
 			//if the cell is in the domain
 			if(imask[i][j] > 0)
@@ -175,11 +182,18 @@ void ReadInitialChemicalOverlandFile(int ichem)
 
 		}	//end loop over grid columns
 
-		//Start a new line for the next row of data in the echo file 
-		fprintf(echofile_fp, "\n");
+		//if grid values are not read from the model image
+		if(imagegrid == 0)
+		{
+			//Start a new line for the next row of data in the echo file 
+			fprintf(echofile_fp, "\n");
+		}
 
 	}	//end loop over grid rows
 
+	//Finish reading grid values through the model image
+	EndImageGrid();
+
 	//Close Initial Chemical Overland File
 	fclose(initialchemovfile_fp);
 
@@ -13,7 +13,7 @@ C-  Outputs:    infiltrationdepth[][]
 C-
 C-  Controls:   imask
 C-
-C-  Calls:      None
+C-  Calls:      BeginImageGrid, ImageScanFloat, EndImageGrid
 C-
 C-  Called by:  ReadDataGroupB
 C-
@@ -72,6 +72,9 @@ void ReadInitialInfiltrationFile()
 		exit(EXIT_FAILURE);	//abort
 	}
 
+	//Start reading grid values through the model image (if any)
+	BeginImageGrid(infiltrationfile);
+
 	//Write label for initial infiltration depth file to file
 	fprintf(echofile_fp, "\n\n\n  Initial Infiltration Depth File: Grid Cell Infiltration Depths  \n");
 	fprintf(echofile_fp,       "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
@@ -135,18 +138,29 @@ void ReadInitialInfiltrationFile()
 		for(j=1; j<=gridcols; j++)
 		{
 			//Record 3
-			fscanf(infiltrationfile_fp, "%f", &infiltrationdepth[i][j]);	//read initial infiltration depth value
+			ImageScanFloat(infiltrationfile_fp, &infiltrationdepth[i][j]);	//read initial infiltration depth value
 
-			//Echo initial infiltration depth to file
-			fprintf(echofile_fp, "  %10.4f", infiltrationdepth[i][j]);
+			//if grid values are not read from the model image
+			if(imagegrid == 0)
+			{
+				//Echo initial infiltration depth to file
+				fprintf(echofile_fp, "  %10.4f", infiltrationdepth[i][j]);
+			}
 
 		}	//end loop over grid columns
 
-		//Start a new line for the next row of data in the echo file 
-		fprintf(echofile_fp, "\n");
+		//if grid values are not read from the model image
+		if(imagegrid == 0)
+		{
+			//Start a new line for the next row of data in the echo file 
+			fprintf(echofile_fp, "\n");
+		}
 
 	}	//end loop over grid rows
 
+	//Finish reading grid values through the model image
+	EndImageGrid();
+
 	//Close Initial Infiltration Depth File
 	fclose(infiltrationfile_fp);
 
@@ -14,7 +14,7 @@ C-  Outputs:	sweov[][]
 C-
 C-  Controls:	None
 C-
-C-  Calls:		None
+C-  Calls:		BeginImageGrid, ImageScanFloat, EndImageGrid
 C-
 C-  Called by:  ReadDataGroupB
 C-
@@ -84,6 +84,9 @@ void ReadInitialSnowFile()
 		exit(EXIT_FAILURE);	//abort
 	}
 
+	//Start reading grid values through the model image (if any)
+	BeginImageGrid(snowfile);
+
 	//Write label for initial snow depth (swe) file to file
 	fprintf(echofile_fp, "\n\n\n  Initial Snow Depth File: Grid Cell Snow Depth as SWE  \n");
 	fprintf(echofile_fp,       "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
@@ -147,18 +150,29 @@ void ReadInitialSnowFile()
 		for(j=1; j<=gridcols; j++)
 		{
 			//Record 3
-			fscanf(snowfile_fp, "%f", &sweov[i][j]);	//read snow depth (swe) value
+			ImageScanFloat(snowfile_fp, &sweov[i][j]);	//read snow depth (swe) value
 
-			//Echo snow depth (swe) to file
-			fprintf(echofile_fp, "  %8.2f", sweov[i][j]);
+			//if grid values are not read from the model image
+			if(imagegrid == 0)
+			{
+				//Echo snow depth (swe) to file
+				fprintf(echofile_fp, "  %8.2f", sweov[i][j]);
+			}
 
 		}	//end loop over grid columns
 
-		//Start a new line for the next row of data in the echo file
-		fprintf(echofile_fp, "\n");
+		//if grid values are not read from the model image
+		if(imagegrid == 0)
+		{
+			//Start a new line for the next row of data in the echo file
+			fprintf(echofile_fp, "\n");
+		}
 
 	}	//end loop over grid rows
 
+	//Finish reading grid values through the model image
+	EndImageGrid();
+
 	//Close Initial Snow Depth File
 	fclose(snowfile_fp);
 
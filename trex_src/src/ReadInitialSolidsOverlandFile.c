@@ -11,7 +11,7 @@ C-  Outputs:    csedov[][][][0] (at time zero)
 C-
 C-  Controls:   imask[][], hov[][]
 C-
-C-  Calls:      None
+C-  Calls:      BeginImageGrid, ImageScanFloat, EndImageGrid
 C-
 C-  Called by:  ReadDataGroupB
 C-
@@ -83,6 +83,9 @@ void ReadInitialSolidsOverlandFile(int isolid)
 		exit(EXIT_FAILURE);	//abort
 	}
 
+	//Start reading grid values through the model image (if any)
+	BeginImageGrid(initialssovfile);
+
 	//Write label for initial (suspended) solids overland overland file to file
 	fprintf(echofile_fp, "\n\n\n  Initial Solids Overland File: Grid Cell Concentrations  \n");
 	fprintf(echofile_fp,       "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
@@ -142,10 +145,14 @@ void ReadInitialSolidsOverlandFile(int isolid)
 		for(j=1; j<=gridcols; j++)
 		{
 			//Record 3
-			fscanf(initialssovfile_fp, "%f", &csedtemp);	//read initial solids concentration value
+			ImageScanFloat(initialssovfile_fp, &csedtemp);	//read initial solids concentration value
 
-			//Echo initial solids in overland cell to file
-			fprintf(echofile_fp, "  %10.4f", csedtemp);
+			//if grid values are not read from the model image
+			if(imagegrid == 0)
+			{
+				//Echo initial solids in overland cell to file
+				fprintf(echofile_fp, "  %10.4f", csedtemp);
+			}
 
 			//if the cell is in the domain
 			if(imask[i][j] > 0)
@@ -167,11 +174,18 @@ void ReadInitialSolidsOverlandFile(int isolid)
 
 		}	//end loop over grid columns
 
-		//Start a new line for the next row of data in the echo file 
-		fprintf(echofile_fp, "\n");
+		//if grid values are not read from the model image
+		if(imagegrid == 0)
+		{
+			//Start a new line for the next row of data in the echo file 
+			fprintf(echofile_fp, "\n");
+		}
 
 	}	//end loop over grid rows
 
+	//Finish reading grid values through the model image
+	EndImageGrid();
+
 	//Close Initial Solids Overland File
 	fclose(initialssovfile_fp);
 
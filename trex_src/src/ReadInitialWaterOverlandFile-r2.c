@@ -11,7 +11,7 @@ C-  Outputs:    hov[][] (at time zero)
 C-
 C-  Controls:   imask[][]
 C-
-C-  Calls:      None
+C-  Calls:      BeginImageGrid, ImageScanFloat, EndImageGrid
 C-
 C-  Called by:  ReadDataGroupB
 C-
@@ -62,6 +62,9 @@ void ReadInitialWaterOverlandFile()
 		exit(EXIT_FAILURE);	//abort
 	}
 
+	//Start reading grid values through the model image (if any)
+	BeginImageGrid(wateroverlandfile);
+
 	//Write label for initial water depth overland file to file
 	fprintf(echofile_fp, "\n\n\n  Initial Water Depth Overland File: Grid Cell Water Depths  \n");
 	fprintf(echofile_fp,       "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
@@ -125,18 +128,29 @@ void ReadInitialWaterOverlandFile()
 		for(j=1; j<=gridcols; j++)
 		{
 			//Record 3
-			fscanf(wateroverlandfile_fp, "%f", &hov[i][j]);	//read initial water depth value
+			ImageScanFloat(wateroverlandfile_fp, &hov[i][j]);	//read initial water depth value
 
-			//Echo initial water depth in overland cell to file
-			fprintf(echofile_fp, "  %10.4f", hov[i][j]);
+			//if grid values are not read from the model image
+			if(imagegrid == 0)
+			{
+				//Echo initial water depth in overland cell to file
+				fprintf(echofile_fp, "  %10.4f", hov[i][j]);
+			}
 
 		}	//end loop over grid columns
 
-		//Start a new line for the next row of data in the echo file 
-		fprintf(echofile_fp, "\n");
+		//if grid values are not read from the model image
+		if(imagegrid == 0)
+		{
+			//Start a new line for the next row of data in the echo file 
+			fprintf(echofile_fp, "\n");
+		}
 
 	}	//end loop over grid rows
 
+	//Finish reading grid values through the model image
+	EndImageGrid();
+
 	//Close Initial Water Depth Overland File
 	fclose(wateroverlandfile_fp);
 
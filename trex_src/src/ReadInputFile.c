@@ -9,10 +9,11 @@ C-  Inputs:     None
 C-
 C-  Outputs:    None
 C-
-C-  Controls:   inputfile_fp, ksim
+C-  Controls:   inputfile_fp, ksim, imageopt
 C-
 C-  Calls:      ReadDataGroupA, ReadDataGroupB, ReadDataGroupC,
-C-              ReadDataGroupD, ReadDataGroupE, ReadDataGroupF
+C-              ReadDataGroupD, ReadDataGroupE, ReadDataGroupF,
+C-              OpenModelImage, MemoryCheckpoint
 C-
 C-  Called by:  trex
 C-
@@ -22,6 +23,20 @@ C-              Aditya Maroo
 C-
 C-  Date:       15-JUL-2003
 C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Open the model image (imageopt > 0) after Data
+C-              Group A is read.
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Added memory checkpoints (MemoryCheckpoint) after
+C-              each data group.
+C-
 C-  Revised:
 C-
 C-  Date:
@@ -66,21 +81,44 @@ void ReadInputFile()
 	//Read Data Group A: General Controls
 	ReadDataGroupA();
 
+	//Charge the memory of Data Group A to the general subsystem
+	MemoryCheckpoint(MEMGENERAL);
+
+	//if a model image is used (compiled or loaded)
+	if(imageopt > 0)
+	{
+		//Open the model image (after Data Group A: ksim, nrows, ncols and echo file are known)
+		OpenModelImage();
+
+		//Charge the memory of the model image to the general subsystem
+		MemoryCheckpoint(MEMGENERAL);
+
+	}	//end if imageopt > 0
+
 	//Read Data Group B: Hydrologic Simulation Parameters
 	ReadDataGroupB();
 
+	//Charge the memory of Data Group B to the water subsystem
+	MemoryCheckpoint(MEMWATER);
+
 	//if simulation type is sediment (or chemical) transport...
 	if(ksim >= 2)
 	{
 		//Read Data Group C: Sediment Transport Simulation Parameters
 		ReadDataGroupC();
 
+		//Charge the memory of Data Group C to the solids subsystem
+		MemoryCheckpoint(MEMSOLIDS);
+
 		//if simulation type is chemical transport...
 		if(ksim >=3)
 		{
 			//Read Data Group D: Chemical Transport Parameters
 			ReadDataGroupD();
 
+			//Charge the memory of Data Group D to the chemical subsystem
+			MemoryCheckpoint(MEMCHEMICAL);
+
 		}	//endif ksim >= 3
 
 	}	//end if ksim >= 2
@@ -88,8 +126,14 @@ void ReadInputFile()
 	//Read Data Group E: Environmental Conditions
 	ReadDataGroupE();
 
+	//Charge the memory of Data Group E to the environment subsystem
+	MemoryCheckpoint(MEMENVIRONMENT);
+
 	//Read Data Group F: Output Specification Controls
 	ReadDataGroupF();
 
+	//Charge the memory of Data Group F to the general subsystem
+	MemoryCheckpoint(MEMGENERAL);
+
 //End of function: Return to trex.c
 }
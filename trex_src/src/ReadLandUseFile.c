@@ -13,7 +13,7 @@ C-  Outputs:    None
 C-
 C-  Controls:   None
 C-
-C-  Calls:      None
+C-  Calls:      BeginImageGrid, ImageScanInt, EndImageGrid
 C-
 C-  Called by:  ReadDataGroupB
 C-
@@ -83,6 +83,9 @@ void ReadLandUseFile()
 		exit(EXIT_FAILURE);	//abort
 	}
 
+	//Start reading grid values through the model image (if any)
+	BeginImageGrid(landusefile);
+
 	//Write label for land use file to file
 	fprintf(echofile_fp, "\n\n\n  Land Use File: Grid Cell Land Classification  \n");
 	fprintf(echofile_fp,       "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
@@ -146,18 +149,29 @@ void ReadLandUseFile()
 		for(j=1; j<=gridcols; j++)
 		{
 			//Record 3
-			fscanf(landusefile_fp, "%d", &landuse[i][j]);	//read land use value
+			ImageScanInt(landusefile_fp, &landuse[i][j]);	//read land use value
 
-			//Echo land use value to file
-			fprintf(echofile_fp, "  %5d", landuse[i][j]);
+			//if grid values are not read from the model image
+			if(imagegrid == 0)
+			{
+				//Echo land use value to file
+				fprintf(echofile_fp, "  %5d", landuse[i][j]);
+			}
 
 		}	//end loop over grid columns
 
-		//Start a new line for the next row of data in the echo file 
-		fprintf(echofile_fp, "\n");
+		//if grid values are not read from the model image
+		if(imagegrid == 0)
+		{
+			//Start a new line for the next row of data in the echo file 
+			fprintf(echofile_fp, "\n");
+		}
 
 	}	//end loop over grid rows
 
+	//Finish reading grid values through the model image
+	EndImageGrid();
+
 	//Close Land Use File
 	fclose(landusefile_fp);
 
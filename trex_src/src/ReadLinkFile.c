@@ -12,7 +12,7 @@ C-  Outputs:    None
 C-
 C-  Controls:   None
 C-
-C-  Calls:      None
+C-  Calls:      BeginImageGrid, ImageScanInt, EndImageGrid
 C-
 C-  Called by:  ReadDataGroupB
 C-
@@ -79,6 +79,9 @@ void ReadLinkFile()
 		exit(EXIT_FAILURE);	//abort
 	}
 
+	//Start reading grid values through the model image (if any)
+	BeginImageGrid(linkfile);
+
 	//Write label for link file to file
 	fprintf(echofile_fp, "\n\n\n  Link File: Delineation of Channel Links  \n");
 	fprintf(echofile_fp,       "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
@@ -158,21 +161,32 @@ void ReadLinkFile()
 		for(j=1; j<=gridcols; j++)
 		{
 			//Record 3
-			fscanf(linkfile_fp, "%d", &link[i][j]);	//read link
+			ImageScanInt(linkfile_fp, &link[i][j]);	//read link
 
-			//Echo link to file
-			fprintf(echofile_fp, "  %5d", link[i][j]);
+			//if grid values are not read from the model image
+			if(imagegrid == 0)
+			{
+				//Echo link to file
+				fprintf(echofile_fp, "  %5d", link[i][j]);
+			}
 
 			//Compute the total number of links in network (number of links is largest link number)
 			if(imask[i][j] != nodatavalue) nlinks = (int)Max(nlinks,link[i][j]);
 
 		}	//end loop over grid columns
 
-		//Start a new line for the next row of data in the echo file 
-		fprintf(echofile_fp, "\n");
+		//if grid values are not read from the model image
+		if(imagegrid == 0)
+		{
+			//Start a new line for the next row of data in the echo file 
+			fprintf(echofile_fp, "\n");
+		}
 
 	}	//end loop over grid rows
 
+	//Finish reading grid values through the model image
+	EndImageGrid();
+
 	//Close Link File
 	fclose(linkfile_fp);
 
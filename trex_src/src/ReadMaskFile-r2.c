@@ -11,7 +11,7 @@ C-  Outputs:    None
 C-
 C-  Controls:   None
 C-
-C-  Calls:      None
+C-  Calls:      BeginImageGrid, ImageScanInt, EndImageGrid
 C-
 C-  Called by:  ReadDataGroupB
 C-
@@ -96,6 +96,9 @@ extern void ReadMaskFile()
 		exit(EXIT_FAILURE);	//abort
 	}
 
+	//Start reading grid values through the model image (if any)
+	BeginImageGrid(maskfile);
+
 	//Write label for mask file to file
 	fprintf(echofile_fp, "\n\n\n  Mask File: Delineation of Spatial Domain  \n");
 	fprintf(echofile_fp,       "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
@@ -180,10 +183,14 @@ extern void ReadMaskFile()
 		for(j=1; j<=gridcols; j++)
 		{
 			//Record 3
-			fscanf(maskfile_fp, "%d", &imask[i][j]);	//read mask value
+			ImageScanInt(maskfile_fp, &imask[i][j]);	//read mask value
 
-			//Echo mask value to file
-			fprintf(echofile_fp, "  %5d", imask[i][j]);
+			//if grid values are not read from the model image
+			if(imagegrid == 0)
+			{
+				//Echo mask value to file
+				fprintf(echofile_fp, "  %5d", imask[i][j]);
+			}
 
 			//if the cell is in the active domain (imask != nodata)
 			if(imask[i][j] != nodatavalue)
@@ -199,8 +206,12 @@ extern void ReadMaskFile()
 
 		}	//end loop over grid columns
 
-		//Start a new line for the next row of data in the echo file 
-		fprintf(echofile_fp, "\n");
+		//if grid values are not read from the model image
+		if(imagegrid == 0)
+		{
+			//Start a new line for the next row of data in the echo file 
+			fprintf(echofile_fp, "\n");
+		}
 
 	}	//end loop over grid rows
 
@@ -230,6 +241,9 @@ extern void ReadMaskFile()
 	free(row);
 	free(col);
 
+	//Finish reading grid values through the model image
+	EndImageGrid();
+
 	//Close Mask File
 	fclose(maskfile_fp);
 
@@ -12,7 +12,7 @@ C-  Outputs:    None
 C-
 C-  Controls:   link[][]
 C-
-C-  Calls:      None
+C-  Calls:      BeginImageGrid, ImageScanInt, EndImageGrid
 C-
 C-  Called by:  ReadDataGroupB
 C-
@@ -79,6 +79,9 @@ void ReadNodeFile()
 		exit(EXIT_FAILURE);	//abort
 	}
 
+	//Start reading grid values through the model image (if any)
+	BeginImageGrid(nodefile);
+
 	//Write label for node file to file
 	fprintf(echofile_fp, "\n\n\n  Node File: Delineation of Channel Nodes  \n");
 	fprintf(echofile_fp,       "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
@@ -172,10 +175,14 @@ void ReadNodeFile()
 		for(j=1; j<=gridcols; j++)
 		{
 			//Record 3
-			fscanf(nodefile_fp, "%d", &node[i][j]);	//read node
+			ImageScanInt(nodefile_fp, &node[i][j]);	//read node
 
-			//Echo node to file
-			fprintf(echofile_fp, "  %5d", node[i][j]);
+			//if grid values are not read from the model image
+			if(imagegrid == 0)
+			{
+				//Echo node to file
+				fprintf(echofile_fp, "  %5d", node[i][j]);
+			}
 
 			//Compute the total number of nodes for each link in network
 			//(number of nodes is largest node number for that link)
@@ -190,11 +197,18 @@ void ReadNodeFile()
 
 		}	//end loop over grid columns
 
-		//Start a new line for the next row of data in the echo file
-		fprintf(echofile_fp, "\n");
+		//if grid values are not read from the model image
+		if(imagegrid == 0)
+		{
+			//Start a new line for the next row of data in the echo file
+			fprintf(echofile_fp, "\n");
+		}
 
 	}	//end loop over grid rows
 
+	//Finish reading grid values through the model image
+	EndImageGrid();
+
 	//Close Node File
 	fclose(nodefile_fp);
 
@@ -9,11 +9,11 @@ C-              type specified.
 C-
 C-  Inputs:     pidov[], ilayer
 C-
-C-  Outputs:    envov[][][][]
+C-  Outputs:    envovtfid[][][][]
 C-
 C-  Controls:   imask[][]
 C-
-C-  Calls:      None
+C-  Calls:      BeginImageGrid, ImageScanInt, EndImageGrid
 C-
 C-  Called by:  ReadDataGroupE
 C-
@@ -24,6 +24,13 @@ C-              Fort Collins, CO  80523
 C-				
 C-	Date:		07-SEP-2004
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	The time function pointer file (envtfpointerfile) is
+C-              read instead of the property file.
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -67,35 +74,38 @@ void ReadOverlandEnvironmentTFPointerFile(int pid, int ilayer)
 	printf(	   "*                                                         *\n");
 	printf(	   "***********************************************************\n\n\n");
 
-	//Set the environmental property file pointer to null
-	envpropfile_fp = NULL;
+	//Set the environmental time function pointer file pointer to null
+	envtfpointerfile_fp = NULL;
 
-	//Open the environmental property file for reading
-	envpropfile_fp=fopen(envpropfile,"r");
+	//Open the environmental time function pointer file for reading
+	envtfpointerfile_fp=fopen(envtfpointerfile,"r");
 
-	//if the environmental property file pointer is null, abort execution
-	if(envpropfile_fp==NULL)
+	//if the environmental time function pointer file pointer is null, abort execution
+	if(envtfpointerfile_fp==NULL)
 	{
 		//Write message to file
-		fprintf(echofile_fp, "Error! Can't open Environmental Property File : %s \n",envpropfile);
+		fprintf(echofile_fp, "Error! Can't open Environmental Time Function Pointer File : %s \n",envtfpointerfile);
 
 		//Write message to screen
-		printf("Error! Can't open Environmental Property File : %s \n",envpropfile);
+		printf("Error! Can't open Environmental Time Function Pointer File : %s \n",envtfpointerfile);
 		exit(EXIT_FAILURE);	//abort
 	}
 
+	//Start reading grid values through the model image (if any)
+	BeginImageGrid(envtfpointerfile);
+
 	//Write label for environmental property file to file
-	fprintf(echofile_fp, "\n\n\n  Environmental Property File: pid = %d  \n", pid);
-	fprintf(echofile_fp,       "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	fprintf(echofile_fp, "\n\n\n  Environmental Time Function Pointer File: pid = %d  \n", pid);
+	fprintf(echofile_fp,       "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
 
 	//Record 1
-	fgets(header, MAXHEADERSIZE, envpropfile_fp);	//read header
+	fgets(header, MAXHEADERSIZE, envtfpointerfile_fp);	//read header
 
 	//Echo header to file
 	fprintf(echofile_fp, "\n%s\n", header);
 
 	//Record 2
-	fscanf(envpropfile_fp, "%s %d %s %d %s %f %s %f %s %f %s %d",	//read
+	fscanf(envtfpointerfile_fp, "%s %d %s %d %s %f %s %f %s %f %s %d",	//read
 		varname,		//dummy
 		&gridcols,		//number of columns in grid
 		varname,		//dummy
@@ -141,10 +151,14 @@ void ReadOverlandEnvironmentTFPointerFile(int pid, int ilayer)
 		for(j=1; j<=gridcols; j++)
 		{
 			//Record 3
-			fscanf(envpropfile_fp, "%d", &tfid);	//read property value
+			ImageScanInt(envtfpointerfile_fp, &tfid);	//read property value
 
-			//Echo property value to file
-			fprintf(echofile_fp, "  %5d", tfid);
+			//if grid values are not read from the model image
+			if(imagegrid == 0)
+			{
+				//Echo property value to file
+				fprintf(echofile_fp, "  %5d", tfid);
+			}
 
 			//if the cell is in the domain
 			if(imask[i][j] > 0)
@@ -156,13 +170,20 @@ void ReadOverlandEnvironmentTFPointerFile(int pid, int ilayer)
 
 		}	//end loop over grid columns
 
-		//Start a new line for the next row of data in the echo file 
-		fprintf(echofile_fp, "\n");
+		//if grid values are not read from the model image
+		if(imagegrid == 0)
+		{
+			//Start a new line for the next row of data in the echo file 
+			fprintf(echofile_fp, "\n");
+		}
 
 	}	//end loop over grid rows
 
-	//Close Environmental Property File
-	fclose(envpropfile_fp);
+	//Finish reading grid values through the model image
+	EndImageGrid();
+
+	//Close Environmental Time Function Pointer File
+	fclose(envtfpointerfile_fp);
 
 //End of function: Return to ReadDataGroupE
 }
@@ -11,7 +11,7 @@ C-  Outputs:    fpocov[][][][]
 C-
 C-  Controls:   imask[][]
 C-
-C-  Calls:      None
+C-  Calls:      BeginImageGrid, ImageScanFloat, EndImageGrid
 C-
 C-  Called by:  ReadDataGroupE
 C-
@@ -93,6 +93,9 @@ void ReadOverlandFpocFile(int isolid, int ilayer, float scale)
 		exit(EXIT_FAILURE);	//abort
 	}
 
+	//Start reading grid values through the model image (if any)
+	BeginImageGrid(envpropfile);
+
 	//Write label for environmental property file to file
 	fprintf(echofile_fp, "\n\n\n  Particle Fpoc File: solid = %d  \n", isolid);
 	fprintf(echofile_fp,       "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
@@ -150,10 +153,14 @@ void ReadOverlandFpocFile(int isolid, int ilayer, float scale)
 		for(j=1; j<=gridcols; j++)
 		{
 			//Record 3
-			fscanf(envpropfile_fp, "%f", &fpocvalue);	//read property value
+			ImageScanFloat(envpropfile_fp, &fpocvalue);	//read property value
 
-			//Echo property value to file
-			fprintf(echofile_fp, "  %8.2f", fpocvalue);
+			//if grid values are not read from the model image
+			if(imagegrid == 0)
+			{
+				//Echo property value to file
+				fprintf(echofile_fp, "  %8.2f", fpocvalue);
+			}
 
 			//if the cell is in the domain
 			if(imask[i][j] > 0)
@@ -165,11 +172,18 @@ void ReadOverlandFpocFile(int isolid, int ilayer, float scale)
 
 		}	//end loop over grid columns
 
-		//Start a new line for the next row of data in the echo file 
-		fprintf(echofile_fp, "\n");
+		//if grid values are not read from the model image
+		if(imagegrid == 0)
+		{
+			//Start a new line for the next row of data in the echo file 
+			fprintf(echofile_fp, "\n");
+		}
 
 	}	//end loop over grid rows
 
+	//Finish reading grid values through the model image
+	EndImageGrid();
+
 	//Close Environmental Property File
 	fclose(envpropfile_fp);
 
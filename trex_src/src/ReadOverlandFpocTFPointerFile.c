@@ -12,7 +12,7 @@ C-  Outputs:    envov[][][][]
 C-
 C-  Controls:   imask[][]
 C-
-C-  Calls:      None
+C-  Calls:      BeginImageGrid, ImageScanInt, EndImageGrid
 C-
 C-  Called by:  ReadDataGroupE
 C-
@@ -83,6 +83,9 @@ void ReadOverlandFpocTFPointerFile(int isolid, int ilayer)
 		exit(EXIT_FAILURE);	//abort
 	}
 
+	//Start reading grid values through the model image (if any)
+	BeginImageGrid(envpropfile);
+
 	//Write label for fpoc file to file
 	fprintf(echofile_fp, "\n\n\n  Overland Fpoc Time Function ID File: solid = %d  \n", isolid);
 	fprintf(echofile_fp,       "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
@@ -140,10 +143,14 @@ void ReadOverlandFpocTFPointerFile(int isolid, int ilayer)
 		for(j=1; j<=gridcols; j++)
 		{
 			//Record 3
-			fscanf(envpropfile_fp, "%d", &tfid);	//read property value
+			ImageScanInt(envpropfile_fp, &tfid);	//read property value
 
-			//Echo property value to file
-			fprintf(echofile_fp, "  %5d", tfid);
+			//if grid values are not read from the model image
+			if(imagegrid == 0)
+			{
+				//Echo property value to file
+				fprintf(echofile_fp, "  %5d", tfid);
+			}
 
 			//if the cell is in the domain
 			if(imask[i][j] > 0)
@@ -155,11 +162,18 @@ void ReadOverlandFpocTFPointerFile(int isolid, int ilayer)
 
 		}	//end loop over grid columns
 
-		//Start a new line for the next row of data in the echo file 
-		fprintf(echofile_fp, "\n");
+		//if grid values are not read from the model image
+		if(imagegrid == 0)
+		{
+			//Start a new line for the next row of data in the echo file 
+			fprintf(echofile_fp, "\n");
+		}
 
 	}	//end loop over grid rows
 
+	//Finish reading grid values through the model image
+	EndImageGrid();
+
 	//Close Environmental Property File
 	fclose(envpropfile_fp);
 
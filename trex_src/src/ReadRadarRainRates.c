@@ -40,6 +40,12 @@ C-  Revisions:	Added code so that errors caused by bad file names
 C-              and paths are are reported to the simulation error
 C-              file in addition to the screen.
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Output files are opened by OpenOutputFile.
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -88,7 +94,7 @@ void ReadRadarRainRates(float convunits, float convtime, float scale)
   radarverifyfile_fp = NULL;
 
   //Open radar rain verification file and write header line
-  radarverifyfile_fp = fopen(radarverifyfile,"a");
+  radarverifyfile_fp = OpenOutputFile(radarverifyfile,"a");
 
   //if the radar rain verification file pointer is null, abort execution
   if(radarverifyfile_fp==NULL)
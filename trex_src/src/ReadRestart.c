@@ -20,7 +20,8 @@ C-              Read3DFloatGrid,
 C-              Read3DDoubleGrid,
 C-              ReadSedimentProperties,
 C-              ReadWaterProperties,
-C-              StripString
+C-              StripString, UpdateSoilParameters,
+C-              InvalidatePartitioning
 C-
 C-  Called by:  trex
 C-
@@ -42,6 +43,20 @@ C-  Revisions:	Added code so that errors caused by bad file names
 C-              and paths are are reported to the simulation error
 C-              file in addition to the screen.
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Surface soil parameters are set from the restart
+C-              soil types and stacks (UpdateSoilParameters).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	The partitioning cache is invalidated after the
+C-              restart state is read (ksim > 2).
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -552,6 +567,16 @@ void ReadRestart(int rstopt)
 
 	}	//end if rstopt = 2
 
+	//Set the surface soil parameters from the restart soil types and stacks
+	UpdateSoilParameters();
+
+	//if chemicals are simulated
+	if(ksim > 2)
+	{
+		//Mark the partitioning of all cells and nodes stale (stacks and solids are restarted)
+		InvalidatePartitioning();
+	}
+
 //End of function: Return to ReadInputFile
 }
 
@@ -10,11 +10,11 @@ C-
 C-  Outputs:    nswdovcells[isolid][iload],
 C-              sdwovrow[isolid][iloads][icell],
 C-              sdwovcol[isolid][iloads][icell],
-C-              swdovarea[isolid][iload][row][col]
+C-              swdovarea[isolid][iload][icell]
 C-
 C-  Controls:   imask[][]
 C-
-C-  Calls:      None
+C-  Calls:      BeginImageGrid, ImageScanFloat, EndImageGrid
 C-
 C-  Called by:  ReadDataGroupC
 C-
@@ -36,6 +36,14 @@ C-  Revisions:	Added code so that errors caused by bad file names
 C-              and paths are are reported to the simulation error
 C-              file in addition to the screen.
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Load areas are stored for the load cells only
+C-              (swdovarea[isolid][iload][icell]) instead of a full
+C-              grid for each load.
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -67,7 +75,8 @@ void ReadSWDovAreaFile(int isolid, int iload)
 	float
 		cellsize,	//length of grid cell (m) (this means dx must equal dy)
 		atemp,		//local variable to store area (m2)
-		sumarea;	//local variable to compute the overall sum of surface areas (m2)
+		sumarea,	//local variable to compute the overall sum of surface areas (m2)
+		*area;		//local array for the surface area of each load cell (m2)
 
 
 	//write message to screen
@@ -91,6 +100,9 @@ void ReadSWDovAreaFile(int isolid, int iload)
 		exit(EXIT_FAILURE);	//abort
 	}
 
+	//Start reading grid values through the model image (if any)
+	BeginImageGrid(swdovareafile);
+
 	//Write label for overland distributed solids load area file to file
 	fprintf(echofile_fp, "\n\n\n  Overland Distributed Solids Load Area File  \n");
 	fprintf(echofile_fp,       "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
@@ -146,18 +158,13 @@ void ReadSWDovAreaFile(int isolid, int iload)
 	fprintf(echofile_fp, "   Cell size = %10.2f (m)\n", cellsize);
 	fprintf(echofile_fp, "   No Data Value = %6d\n", nodatavalue);
 
-	//Note:  Memory for [isolid] and [iload] dimensions of the swdovarea
-	//       array was allocated in ReadDataGroupC.
-	//
-	//Allocate memory for distributed load surface areas
-	swdovarea[isolid][iload] = (float **)malloc((nrows+1) * sizeof(float **));		//allocate memory
-
 	//compute the maximum number of cells in the domain
 	maxcells = gridrows * gridcols;
 
 	//Allocate memory for local grid cell references
 	row = (int *)malloc((maxcells+1) * sizeof(int));		//allocate memory
 	col = (int *)malloc((maxcells+1) * sizeof(int));		//allocate memory
+	area = (float *)malloc((maxcells+1) * sizeof(float));	//allocate memory
 
 	//initialize number of overland distributed solids source cells to zero
 	nswdovcells[isolid][iload] = 0;
@@ -168,17 +175,18 @@ void ReadSWDovAreaFile(int isolid, int iload)
 	//Loop over number of rows
 	for(i=1; i<=gridrows; i++)
 	{
-		//Allocate memory for distributed load surface areas
-		swdovarea[isolid][iload][i] = (float *)malloc((ncols+1) * sizeof(float));	//allocate memory
-
 		//Loop over number of columns
 		for(j=1; j<=gridcols; j++)
 		{
 			//Record 3
-			fscanf(swdovareafile_fp, "%f", &atemp);	//read surface area for load (m2)
+			ImageScanFloat(swdovareafile_fp, &atemp);	//read surface area for load (m2)
 
-			//Echo surface area for load in overland cell to file
-			fprintf(echofile_fp, "  %10.4f", atemp);
+			//if grid values are not read from the model image
+			if(imagegrid == 0)
+			{
+				//Echo surface area for load in overland cell to file
+				fprintf(echofile_fp, "  %10.4f", atemp);
+			}
 
 			//if the cell is in the domain and the area is greater than zero
 			if(imask[i][j] > 0 && atemp > 0.0)
@@ -190,8 +198,8 @@ void ReadSWDovAreaFile(int isolid, int iload)
 				row[nswdovcells[isolid][iload]] = i;
 				col[nswdovcells[isolid][iload]] = j;
 
-				//assign area to global variable
-				swdovarea[isolid][iload][i][j] = atemp;
+				//store the surface area of this cell (local)
+				area[nswdovcells[isolid][iload]] = atemp;
 
 				//compute sum of surface area (m2)
 				sumarea = sumarea + atemp;
@@ -200,8 +208,12 @@ void ReadSWDovAreaFile(int isolid, int iload)
 
 		}	//end loop over grid columns
 
-		//Start a new line for the next row of data in the echo file
-		fprintf(echofile_fp, "\n");
+		//if grid values are not read from the model image
+		if(imagegrid == 0)
+		{
+			//Start a new line for the next row of data in the echo file
+			fprintf(echofile_fp, "\n");
+		}
 
 	}	//end loop over grid rows
 
@@ -223,6 +235,7 @@ void ReadSWDovAreaFile(int isolid, int iload)
 	//Allocate remaining memory for global distributed load cell references
 	swdovrow[isolid][iload] = (int *)malloc((nswdovcells[isolid][iload]+1) * sizeof(int));		//allocate memory
 	swdovcol[isolid][iload] = (int *)malloc((nswdovcells[isolid][iload]+1) * sizeof(int));		//allocate memory
+	swdovarea[isolid][iload] = (float *)malloc((nswdovcells[isolid][iload]+1) * sizeof(float));	//allocate memory
 
 	//Transfer data from local to global cell references arrays...
 	//
@@ -233,11 +246,18 @@ void ReadSWDovAreaFile(int isolid, int iload)
 		swdovrow[isolid][iload][icell] = row[icell];
 		swdovcol[isolid][iload][icell] = col[icell];
 
+		//store the surface area of the cell (m2)
+		swdovarea[isolid][iload][icell] = area[icell];
+
 	}	//end loop over active cells
 
 	//deallocate memory for local variables 
 	free(row);
 	free(col);
+	free(area);
+
+	//Finish reading grid values through the model image
+	EndImageGrid();
 
 	//Close overland distributed solids load area file
 	fclose(swdovareafile_fp);
@@ -12,7 +12,7 @@ C-  Outputs:    skyview[][]
 C-
 C-  Controls:   None
 C-
-C-  Calls:      None
+C-  Calls:      BeginImageGrid, ImageScanFloat, EndImageGrid
 C-
 C-  Called by:  ReadDataGroupB
 C-
@@ -82,6 +82,9 @@ void ReadSkyviewFile()
 		exit(EXIT_FAILURE);	//abort
 	}
 
+	//Start reading grid values through the model image (if any)
+	BeginImageGrid(skyviewfile);
+
 	//Write label for skyview file to file
 	fprintf(echofile_fp, "\n\n\n  DEM Grid Cell Skyview (in Degrees)  \n");
 	fprintf(echofile_fp,       "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
@@ -145,18 +148,29 @@ void ReadSkyviewFile()
 		for(j=1; j<=gridcols; j++)
 		{
 			//Record 3
-			fscanf(skyviewfile_fp, "%f", &skyview[i][j]);	//read skyview value
+			ImageScanFloat(skyviewfile_fp, &skyview[i][j]);	//read skyview value
 
-			//Echo skyview in overland cell to file
-			fprintf(echofile_fp, "  %10.4f", skyview[i][j]);
+			//if grid values are not read from the model image
+			if(imagegrid == 0)
+			{
+				//Echo skyview in overland cell to file
+				fprintf(echofile_fp, "  %10.4f", skyview[i][j]);
+			}
 
 		}	//end loop over grid columns
 
-		//Start a new line for the next row of data in the echo file 
-		fprintf(echofile_fp, "\n");
+		//if grid values are not read from the model image
+		if(imagegrid == 0)
+		{
+			//Start a new line for the next row of data in the echo file 
+			fprintf(echofile_fp, "\n");
+		}
 
 	}	//end loop over grid rows
 
+	//Finish reading grid values through the model image
+	EndImageGrid();
+
 	//Close the skyview file
 	fclose(skyviewfile_fp);
 
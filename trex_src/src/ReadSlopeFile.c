@@ -11,7 +11,7 @@ C-  Outputs:    slope[][]
 C-
 C-  Controls:   None
 C-
-C-  Calls:      None
+C-  Calls:      BeginImageGrid, ImageScanFloat, EndImageGrid
 C-
 C-  Called by:  ReadDataGroupB
 C-
@@ -81,6 +81,9 @@ void ReadSlopeFile()
 		exit(EXIT_FAILURE);	//abort
 	}
 
+	//Start reading grid values through the model image (if any)
+	BeginImageGrid(slopefile);
+
 	//Write label for slope file to file
 	fprintf(echofile_fp, "\n\n\n  DEM Grid Cell Slope (in Degrees)  \n");
 	fprintf(echofile_fp,       "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
@@ -144,18 +147,29 @@ void ReadSlopeFile()
 		for(j=1; j<=gridcols; j++)
 		{
 			//Record 3
-			fscanf(slopefile_fp, "%f", &slope[i][j]);	//read slope value
+			ImageScanFloat(slopefile_fp, &slope[i][j]);	//read slope value
 
-			//Echo slope in overland cell to file
-			fprintf(echofile_fp, "  %10.4f", slope[i][j]);
+			//if grid values are not read from the model image
+			if(imagegrid == 0)
+			{
+				//Echo slope in overland cell to file
+				fprintf(echofile_fp, "  %10.4f", slope[i][j]);
+			}
 
 		}	//end loop over grid columns
 
-		//Start a new line for the next row of data in the echo file 
-		fprintf(echofile_fp, "\n");
+		//if grid values are not read from the model image
+		if(imagegrid == 0)
+		{
+			//Start a new line for the next row of data in the echo file 
+			fprintf(echofile_fp, "\n");
+		}
 
 	}	//end loop over grid rows
 
+	//Finish reading grid values through the model image
+	EndImageGrid();
+
 	//Close the slope file
 	fclose(slopefile_fp);
 
@@ -13,7 +13,7 @@ C-  Outputs:    None
 C-
 C-  Controls:   None
 C-
-C-  Calls:      None
+C-  Calls:      BeginImageGrid, ImageScanFloat, EndImageGrid
 C-
 C-  Called by:  ReadDataGroupD
 C-
@@ -87,6 +87,9 @@ void ReadSoilLayerChemicalFile(int ilayer, int ichem)
 		exit(EXIT_FAILURE);	//abort
 	}
 
+	//Start reading grid values through the model image (if any)
+	BeginImageGrid(soilchemicfile);
+
 	//Write label for soil chemical file to file
 	fprintf(echofile_fp,
 		"\n\n\n  Soil Chemical Initial Condition File: Chemical Concentrations (mg/kg)  \n");
@@ -146,10 +149,14 @@ void ReadSoilLayerChemicalFile(int ilayer, int ichem)
 		for(j=1; j<=gridcols; j++)
 		{
 			//Record 3
-			fscanf(soilchemicfile_fp, "%f", &conc);	//read chemical concentration
+			ImageScanFloat(soilchemicfile_fp, &conc);	//read chemical concentration
 
-			//Echo concentrations to file
-			fprintf(echofile_fp, "  %10.4f", conc);
+			//if grid values are not read from the model image
+			if(imagegrid == 0)
+			{
+				//Echo concentrations to file
+				fprintf(echofile_fp, "  %10.4f", conc);
+			}
 
 			//if the cell is in the domain
 			if(imask[i][j] > 0)
@@ -166,11 +173,18 @@ void ReadSoilLayerChemicalFile(int ilayer, int ichem)
 
 		}	//end loop over grid columns
 
-		//Start a new line for the next row of data in the echo file 
-		fprintf(echofile_fp, "\n");
+		//if grid values are not read from the model image
+		if(imagegrid == 0)
+		{
+			//Start a new line for the next row of data in the echo file 
+			fprintf(echofile_fp, "\n");
+		}
 
 	}	//end loop over grid rows
 
+	//Finish reading grid values through the model image
+	EndImageGrid();
+
 	//Close Soil Cehmical File
 	fclose(soilchemicfile_fp);
 
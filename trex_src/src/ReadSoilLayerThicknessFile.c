@@ -11,7 +11,7 @@ C-  Outputs:    hlayerov0[][][] (at time zero)
 C-
 C-  Controls:   imask[][], nstackov0[][]
 C-
-C-  Calls:      None
+C-  Calls:      BeginImageGrid, ImageScanFloat, EndImageGrid
 C-
 C-  Called by:  ReadDataGroupC
 C-
@@ -83,6 +83,9 @@ void ReadSoilLayerThicknessFile(int ilayer)
 		exit(EXIT_FAILURE);	//abort
 	}
 
+	//Start reading grid values through the model image (if any)
+	BeginImageGrid(soillayerthicknessfile);
+
 	//Write label for soil layer thickness file  to file
 	fprintf(echofile_fp, "\n\n\n  Soil Layer Thickness File for Layer: %3d  \n",
 		ilayer);
@@ -142,10 +145,14 @@ void ReadSoilLayerThicknessFile(int ilayer)
 		for(j=1; j<=gridcols; j++)
 		{
 			//Record 3
-			fscanf(soillayerthicknessfile_fp, "%f", &htemp);	//read initial solids concentration value
+			ImageScanFloat(soillayerthicknessfile_fp, &htemp);	//read initial solids concentration value
 
-			//Echo initial solids in overland cell to file
-			fprintf(echofile_fp, "  %10.4f", htemp);
+			//if grid values are not read from the model image
+			if(imagegrid == 0)
+			{
+				//Echo initial solids in overland cell to file
+				fprintf(echofile_fp, "  %10.4f", htemp);
+			}
 
 			//if the cell is in the domain and the layer is occupied
 			if(imask[i][j] > 0 && ilayer <= nstackov0[i][j])
@@ -157,11 +164,18 @@ void ReadSoilLayerThicknessFile(int ilayer)
 
 		}	//end loop over grid columns
 
-		//Start a new line for the next row of data in the echo file 
-		fprintf(echofile_fp, "\n");
+		//if grid values are not read from the model image
+		if(imagegrid == 0)
+		{
+			//Start a new line for the next row of data in the echo file 
+			fprintf(echofile_fp, "\n");
+		}
 
 	}	//end loop over grid rows
 
+	//Finish reading grid values through the model image
+	EndImageGrid();
+
 	//Close soil layer thickness file
 	fclose(soillayerthicknessfile_fp);
 
@@ -13,7 +13,7 @@ C-  Outputs:    None
 C-
 C-  Controls:   None
 C-
-C-  Calls:      None
+C-  Calls:      BeginImageGrid, ImageScanInt, EndImageGrid
 C-
 C-  Called by:  ReadDataGroupC
 C-
@@ -84,6 +84,9 @@ void ReadSoilStackFile()
 		exit(EXIT_FAILURE);	//abort
 	}
 
+	//Start reading grid values through the model image (if any)
+	BeginImageGrid(soilstackfile);
+
 	//Write label for soil stack file to file
 	fprintf(echofile_fp, "\n\n\n  Soil Stack File: Number of Vertical Elements  \n");
 	fprintf(echofile_fp,       "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
@@ -153,7 +156,7 @@ void ReadSoilStackFile()
 //      In general, nodatavalue is -9999 but for imask it is zero...
 
 			//Record 3
-			fscanf(soilstackfile_fp, "%d", &vstack);	//read number of vertical elements
+			ImageScanInt(soilstackfile_fp, &vstack);	//read number of vertical elements
 
 			//if the cell is not null
 			if(imask[i][j] > 0)
@@ -196,16 +199,27 @@ void ReadSoilStackFile()
 
 			}	//end if imask > 0
 
-			//Echo initial number of soil stack elements overland to file
-			fprintf(echofile_fp, "  %5d", vstack);
+			//if grid values are not read from the model image
+			if(imagegrid == 0)
+			{
+				//Echo initial number of soil stack elements overland to file
+				fprintf(echofile_fp, "  %5d", vstack);
+			}
 
 		}	//end loop over grid columns
 
-		//Start a new line for the next row of data in the echo file
-		fprintf(echofile_fp, "\n");
+		//if grid values are not read from the model image
+		if(imagegrid == 0)
+		{
+			//Start a new line for the next row of data in the echo file
+			fprintf(echofile_fp, "\n");
+		}
 
 	}	//end loop over grid rows
 
+	//Finish reading grid values through the model image
+	EndImageGrid();
+
 	//Close Soil Stack File
 	fclose(soilstackfile_fp);
 
@@ -12,7 +12,7 @@ C-  Outputs:    None
 C-
 C-  Controls:   None
 C-
-C-  Calls:      imask
+C-  Calls:      BeginImageGrid, ImageScanInt, EndImageGrid
 C-
 C-  Called by:  ReadDataGroupB
 C-
@@ -67,6 +67,9 @@ void ReadSoilTypeFile(int ilayer)
 		exit(EXIT_FAILURE);	//abort
 	}
 
+	//Start reading grid values through the model image (if any)
+	BeginImageGrid(soiltypefile);
+
 	//Write label for soil file to file
 	fprintf(echofile_fp, "\n\n\n  Soil File: Grid Cell Soil Classification  \n");
 	fprintf(echofile_fp,       "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
@@ -124,18 +127,29 @@ void ReadSoilTypeFile(int ilayer)
 		for(j=1; j<=gridcols; j++)
 		{
 			//Record 3
-			fscanf(soiltypefile_fp, "%d", &soiltype[i][j][ilayer]);	//read soil type
+			ImageScanInt(soiltypefile_fp, &soiltype[i][j][ilayer]);	//read soil type
 
-			//Echo soil type to file
-			fprintf(echofile_fp, "  %5d", soiltype[i][j][ilayer]);
+			//if grid values are not read from the model image
+			if(imagegrid == 0)
+			{
+				//Echo soil type to file
+				fprintf(echofile_fp, "  %5d", soiltype[i][j][ilayer]);
+			}
 
 		}	//end loop over grid columns
 
-		//Start a new line for the next row of data in the echo file 
-		fprintf(echofile_fp, "\n");
+		//if grid values are not read from the model image
+		if(imagegrid == 0)
+		{
+			//Start a new line for the next row of data in the echo file 
+			fprintf(echofile_fp, "\n");
+		}
 
 	}	//end loop over grid rows
 
+	//Finish reading grid values through the model image
+	EndImageGrid();
+
 	//Close Soil File
 	fclose(soiltypefile_fp);
 
@@ -13,7 +13,7 @@ C-  Outputs:    None
 C-
 C-  Controls:   None
 C-
-C-  Calls:      None
+C-  Calls:      BeginImageGrid, ImageScanFloat, EndImageGrid
 C-
 C-  Called by:  ReadDataGroupB
 C-
@@ -80,6 +80,9 @@ void ReadStorageDepthFile()
 		exit(EXIT_FAILURE);	//abort
 	}
 
+	//Start reading grid values through the model image (if any)
+	BeginImageGrid(storagedepthfile);
+
 	//Write label for storage depth file to file
 	fprintf(echofile_fp, "\n\n\n  Storage Depth File: Grid Cell Depression Storage Depths  \n");
 	fprintf(echofile_fp,       "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
@@ -143,18 +146,29 @@ void ReadStorageDepthFile()
 		for(j=1; j<=gridcols; j++)
 		{
 			//Record 3
-			fscanf(storagedepthfile_fp, "%f", &storagedepth[i][j]);	//read storage depth value
+			ImageScanFloat(storagedepthfile_fp, &storagedepth[i][j]);	//read storage depth value
 
-			//Echo storage depth to file (use native units)
-			fprintf(echofile_fp, "  %8.2f", storagedepth[i][j]);
+			//if grid values are not read from the model image
+			if(imagegrid == 0)
+			{
+				//Echo storage depth to file (use native units)
+				fprintf(echofile_fp, "  %8.2f", storagedepth[i][j]);
+			}
 
 		}	//end loop over grid columns
 
-		//Start a new line for the next row of data in the echo file 
-		fprintf(echofile_fp, "\n");
+		//if grid values are not read from the model image
+		if(imagegrid == 0)
+		{
+			//Start a new line for the next row of data in the echo file 
+			fprintf(echofile_fp, "\n");
+		}
 
 	}	//end loop over grid rows
 
+	//Finish reading grid values through the model image
+	EndImageGrid();
+
 	//Close Storage Depth File
 	fclose(storagedepthfile_fp);
 
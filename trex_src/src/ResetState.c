@@ -0,0 +1,1267 @@
+/*----------------------------------------------------------------------
+C-  File:       ResetState.c
+C-
+C-  Purpose/    Concatenated group of functions for the state saved
+C-  Methods:    after initialization (reset state).
+C-
+C-              TrexLoad saves the state of the simulation after the
+C-              inputs are read and initialized (SaveResetState), just
+C-              before the first pass of the numerical integration loop.
+C-              TrexReset restores it (RestoreResetState), so a host
+C-              program (calibration driver) can run the simulation
+C-              again without reading the input files.
+C-
+C-              Only the values changed by a simulation are saved:
+C-              the time step series, the parameters set by
+C-              TrexSetParameter, water depths and snowpack, the
+C-              cumulative volumes, mass budgets, outlet totals and
+C-              peaks, running minima and maxima, the soil and
+C-              sediment stacks, concentrations, shear stress
+C-              histories, and meteorology.  The bed fluxes and new
+C-              concentrations by layer are saved because the values
+C-              of layers below the surface are kept when a stack is
+C-              pushed or popped, and the pairing of the current and
+C-              new arrays swapped after each time step is restored.
+C-              Values recomputed at each time step or by
+C-              TrexBeginPass (water column fluxes, time function
+C-              indexes, initial volumes by cell) are not saved.
+C-              Values are saved to one buffer as bytes, so they are
+C-              restored exactly.
+C-
+C-              The output files appended during a simulation (echo,
+C-              summary, mass balance, dump, time step buffer, and
+C-              export files) are truncated to their sizes after
+C-              initialization (their headers are kept).  Derived
+C-              values that depend on restored parameters (surface
+C-              soil parameters, partitioning, zoned environmental
+C-              properties, mass balance monitor) are recomputed or
+C-              cleared.
+C-
+C-  Function
+C-   Listing:   SaveResetState, RestoreResetState, FreeResetState,
+C-              WalkResetState, ResetFile (and value/array walkers)
+C-
+C-  Inputs:     ksim, dtopt, ndt, chnopt, snowopt, meltopt, infopt,
+C-              ctlopt, ersovopt, erschopt, trackdspovmass,
+C-              trackdspchmass, output file names
+C-
+C-  Outputs:    (restored state), output files truncated
+C-
+C-  Controls:   resetmode
+C-
+C-  Calls:      UpdateSoilParameters, InvalidatePartitioning,
+C-              InvalidateEnvironmentZones, ClearMassBalanceMonitor,
+C-              TruncateOutputFile
+C-
+C-  Called by:  TrexLoad, TrexReset, TrexSetDryRun, TrexSetGridSparse,
+C-              TrexSetGridWindows, TrexReplayKernel, FreeMemory
+C-
+C-  Created:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revised:
+C-
+C-  Date:
+C-
+C-  Revisions:
+C-
+C----------------------------------------------------------------------*/
+
+//trex general variable declarations
+#include "trex_general_declarations.h"
+
+//trex global variable declarations for water transport
+#include "trex_water_declarations.h"
+
+//trex global variable declarations for sediment transport
+#include "trex_solids_declarations.h"
+
+//trex global variable declarations for chemical transport
+#include "trex_chemical_declarations.h"
+
+//trex global variable declarations for environmental conditions
+#include "trex_environmental_declarations.h"
+
+static char
+	*resetstate = NULL;	//saved state after initialization (bytes of all walked variables)
+
+static size_t
+	resetsize,			//number of bytes in the saved state
+	resetcursor;		//index of the next byte in the saved state
+
+static int
+	resetmode;			//walk mode (0 = count bytes, 1 = save values, 2 = restore values)
+
+//C
+//C
+			/*******************************************/
+			/*         FUNCTION: ResetValue            */
+			/*******************************************/
+
+/* Counts, saves, or restores size bytes (according to the walk mode) */
+
+static void ResetValue(void *value, size_t size)
+{
+	//if values are saved
+	if(resetmode == 1)
+	{
+		//save the bytes
+		memcpy(resetstate + resetcursor, value, size);
+	}
+	else if(resetmode == 2)	//else if values are restored
+	{
+		//restore the bytes
+		memcpy(value, resetstate + resetcursor, size);
+
+	}	//end if resetmode == 1
+
+	//advance to the next value
+	resetcursor = resetcursor + size;
+}
+
+//C
+//C
+			/*******************************************/
+			/*   FUNCTIONS: ResetVectorFloat,          */
+			/*              ResetVectorDouble,         */
+			/*              ResetVectorInt             */
+			/*******************************************/
+
+/* Walks elements first to last of a vector */
+
+static void ResetVectorFloat(float *vector, int first, int last)
+{
+	//walk the elements
+	ResetValue(&vector[first], (last - first + 1) * sizeof(float));
+}
+
+static void ResetVectorDouble(double *vector, int first, int last)
+{
+	//walk the elements
+	ResetValue(&vector[first], (last - first + 1) * sizeof(double));
+}
+
+static void ResetVectorInt(int *vector, int first, int last)
+{
+	//walk the elements
+	ResetValue(&vector[first], (last - first + 1) * sizeof(int));
+}
+
+//C
+//C
+			/*******************************************/
+			/*   FUNCTIONS: ResetGridFloat,            */
+			/*              ResetGridInt               */
+			/*******************************************/
+
+/* Walks all cells of an overland grid [row][col] */
+
+static void ResetGridFloat(float **grid)
+{
+	int row;	//row index
+
+	//loop over rows
+	for(row=1; row<=nrows; row++)
+	{
+		//walk the cells of the row
+		ResetVectorFloat(grid[row], 1, ncols);
+	}
+}
+
+static void ResetGridInt(int **grid)
+{
+	int row;	//row index
+
+	//loop over rows
+	for(row=1; row<=nrows; row++)
+	{
+		//walk the cells of the row
+		ResetVectorInt(grid[row], 1, ncols);
+	}
+}
+
+//C
+//C
+			/*******************************************/
+			/*   FUNCTIONS: ResetCellsFloat,           */
+			/*              ResetCellsDouble,          */
+			/*              ResetCellsInt              */
+			/*******************************************/
+
+/* Walks the first n values of each cell of an overland array */
+/* [row][col][n] (domain cells only)                          */
+
+static void ResetCellsFloat(float ***array, int n)
+{
+	int row, col;	//row and column indices
+
+	//loop over rows
+	for(row=1; row<=nrows; row++)
+	{
+		//loop over columns
+		for(col=1; col<=ncols; col++)
+		{
+			//if the cell is in the domain
+			if(imask[row][col] != nodatavalue)
+			{
+				//walk the values of the cell
+				ResetVectorFloat(array[row][col], 0, n-1);
+
+			}	//end if imask[][] != nodatavalue
+
+		}	//end loop over columns
+
+	}	//end loop over rows
+}
+
+static void ResetCellsDouble(double ***array, int n)
+{
+	int row, col;	//row and column indices
+
+	//loop over rows
+	for(row=1; row<=nrows; row++)
+	{
+		//loop over columns
+		for(col=1; col<=ncols; col++)
+		{
+			//if the cell is in the domain
+			if(imask[row][col] != nodatavalue)
+			{
+				//walk the values of the cell
+				ResetVectorDouble(array[row][col], 0, n-1);
+
+			}	//end if imask[][] != nodatavalue
+
+		}	//end loop over columns
+
+	}	//end loop over rows
+}
+
+static void ResetCellsInt(int ***array, int n)
+{
+	int row, col;	//row and column indices
+
+	//loop over rows
+	for(row=1; row<=nrows; row++)
+	{
+		//loop over columns
+		for(col=1; col<=ncols; col++)
+		{
+			//if the cell is in the domain
+			if(imask[row][col] != nodatavalue)
+			{
+				//walk the values of the cell
+				ResetVectorInt(array[row][col], 0, n-1);
+
+			}	//end if imask[][] != nodatavalue
+
+		}	//end loop over columns
+
+	}	//end loop over rows
+}
+
+//C
+//C
+			/*******************************************/
+			/*   FUNCTIONS: ResetNodesFloat,           */
+			/*              ResetNodesInt,             */
+			/*              ResetNodeValuesFloat,      */
+			/*              ResetNodeValuesDouble      */
+			/*******************************************/
+
+/* Walks a channel array [link][node] or the first n values of each */
+/* node of a channel array [link][node][n]                          */
+
+static void ResetNodesFloat(float **array)
+{
+	int link;	//link index
+
+	//loop over links
+	for(link=1; link<=nlinks; link++)
+	{
+		//walk the nodes of the link
+		ResetVectorFloat(array[link], 1, nnodes[link]);
+	}
+}
+
+static void ResetNodesInt(int **array)
+{
+	int link;	//link index
+
+	//loop over links
+	for(link=1; link<=nlinks; link++)
+	{
+		//walk the nodes of the link
+		ResetVectorInt(array[link], 1, nnodes[link]);
+	}
+}
+
+static void ResetNodeValuesFloat(float ***array, int n)
+{
+	int link, node;	//link and node indices
+
+	//loop over links
+	for(link=1; link<=nlinks; link++)
+	{
+		//loop over nodes
+		for(node=1; node<=nnodes[link]; node++)
+		{
+			//walk the values of the node
+			ResetVectorFloat(array[link][node], 0, n-1);
+		}
+	}
+}
+
+static void ResetNodeValuesDouble(double ***array, int n)
+{
+	int link, node;	//link and node indices
+
+	//loop over links
+	for(link=1; link<=nlinks; link++)
+	{
+		//loop over nodes
+		for(node=1; node<=nnodes[link]; node++)
+		{
+			//walk the values of the node
+			ResetVectorDouble(array[link][node], 0, n-1);
+		}
+	}
+}
+
+//C
+//C
+			/*******************************************/
+			/*          FUNCTION: ResetFile            */
+			/*******************************************/
+
+/* Walks the size of an output file: the size is saved, and the file  */
+/* is truncated to it (or removed if it did not exist) when restored */
+
+static void ResetFile(char *name)
+{
+	//local variable declarations
+	long
+		filesize;	//size of the file (bytes) (-1 = no file)
+
+	FILE
+		*file_fp;	//file pointer
+
+	//if values are saved
+	if(resetmode == 1)
+	{
+		//open the file to get its size
+		file_fp = fopen(name, "rb");
+
+		//if the file exists
+		if(file_fp != NULL)
+		{
+			//the size is the position of the end of the file
+			fseek(file_fp, 0L, SEEK_END);
+			filesize = ftell(file_fp);
+
+			//close the file
+			fclose(file_fp);
+		}
+		else	//else the file does not exist
+		{
+			//no file
+			filesize = -1;
+
+		}	//end if file_fp != NULL
+
+	}	//end if resetmode == 1
+
+	//walk the size of the file
+	ResetValue(&filesize, sizeof(long));
+
+	//if values are restored
+	if(resetmode == 2)
+	{
+		//if the file did not exist after initialization
+		if(filesize < 0)
+		{
+			//remove the file
+			remove(name);
+		}
+		else	//else truncate the file to its size after initialization
+		{
+			//set the size of the file
+			TruncateOutputFile(name, filesize);
+
+		}	//end if filesize < 0
+
+	}	//end if resetmode == 2
+}
+
+//C
+//C
+			/*******************************************/
+			/*        FUNCTION: WalkResetState         */
+			/*******************************************/
+
+/* Walks every value changed by a simulation after initialization */
+
+static void WalkResetState()
+{
+	//local variable declarations
+	int
+		ndtvalues,	//number of time step values walked
+		igroup,		//loop index for reporting groups
+		isolid,		//loop index for solids type
+		ichem,		//loop index for chemical type
+		nbedov,		//number of overland layers walked for bed mass budgets
+		nbedch;		//number of channel layers walked for bed mass budgets
+
+	//start at the first value
+	resetcursor = 0;
+
+	/*****************************/
+	/*   Simulation control      */
+	/*****************************/
+
+	//simulation type, time step option, and time step counts (changed by a relaunch)
+	ResetValue(&ksim, sizeof(ksim));
+	ResetValue(&dtopt, sizeof(dtopt));
+	ResetValue(&ndt, sizeof(ndt));
+	ResetValue(&bdt, sizeof(bdt));
+
+	//if automated time-stepping is selected (dtopt = 1 or dtopt = 2)
+	if(dtopt == 1 || dtopt == 2)
+	{
+		//the time steps are buffered
+		ndtvalues = MAXBUFFERSIZE + 1;
+	}
+	else	//else the time steps are specified (dtopt = 0 or dtopt = 3)
+	{
+		//all time steps are in memory
+		ndtvalues = ndt + 1;
+
+	}	//end if dtopt = 1 or 2
+
+	//if values are restored
+	if(resetmode == 2)
+	{
+		//Note:  At the end of a pass with automated time steps,
+		//       WriteDTFile replaces the buffers by arrays of all
+		//       time steps of the pass.
+		//
+		//Reallocate memory for the time steps of the saved state
+		dt = (float *)realloc(dt, ndtvalues * sizeof(float));
+		dttime = (float *)realloc(dttime, ndtvalues * sizeof(float));
+
+	}	//end if resetmode == 2
+
+	//time step series (s, hours)
+	ResetVectorFloat(dt, 0, ndtvalues-1);
+	ResetVectorFloat(dttime, 0, ndtvalues-1);
+
+	//rejection counts, courant numbers, and the overland routing sweep
+	ResetValue(&totalrejects, sizeof(totalrejects));
+	ResetValue(&nrejects, sizeof(nrejects));
+	ResetValue(&maxcourantov, sizeof(maxcourantov));
+	ResetValue(&maxcourantch, sizeof(maxcourantch));
+	ResetValue(&iteration, sizeof(iteration));
+
+	/*****************************/
+	/*   Parameters              */
+	/*****************************/
+
+	//Manning n of land uses (see TrexSetParameter)
+	ResetVectorFloat(nmanningov, 1, nlands);
+
+	//if infiltration is simulated
+	if(infopt > 0)
+	{
+		//soil parameters of soil types
+		ResetVectorFloat(khsoil, 1, nsoils);
+		ResetVectorFloat(capshsoil, 1, nsoils);
+		ResetVectorFloat(soilmd, 1, nsoils);
+
+	}	//end if infopt > 0
+
+	//if channels are simulated
+	if(chnopt > 0)
+	{
+		//Manning n of channel nodes
+		ResetNodesFloat(nmanningch);
+
+	}	//end if chnopt > 0
+
+	/*****************************/
+	/*   Water (all simulations) */
+	/*****************************/
+
+	//overland depth grids (hov and hovnew are swapped after each time
+	//step, so the pairing after initialization is restored first)
+	ResetValue(&hov, sizeof(hov));
+	ResetValue(&hovnew, sizeof(hovnew));
+
+	//overland water depth (m)
+	ResetGridFloat(hov);
+
+	//if snowfall or snowmelt is simulated
+	if(snowopt > 0 || meltopt > 0)
+	{
+		//snowpack depth (m) (as swe)
+		ResetGridFloat(sweov);
+
+	}	//end if snowopt > 0 or meltopt > 0
+
+	//rainfall, interception, and overland flow volumes (m3), depths (m), and rates (m/s)
+	ResetGridFloat(grossrainrate);
+	ResetGridFloat(grossraindepth);
+	ResetGridFloat(grossrainvol);
+	ResetGridFloat(interceptiondepth);
+	ResetGridFloat(interceptionvol);
+	ResetGridFloat(netrainvol);
+	ResetGridFloat(qwovvol);
+	ResetCellsFloat(dqovinvol, NOVSLOTS);
+	ResetCellsFloat(dqovoutvol, NOVSLOTS);
+
+	//if snowfall is simulated
+	if(snowopt > 0)
+	{
+		//snowfall rates (m/s), depths (m), and volumes (m3) (as swe)
+		ResetGridFloat(grossswerate);
+		ResetGridFloat(grossswedepth);
+		ResetGridFloat(grossswevol);
+		ResetGridFloat(netswevol);
+
+	}	//end if snowopt > 0
+
+	//if snowmelt is simulated
+	if(meltopt > 0)
+	{
+		//snowmelt depths (m) and volumes (m3) (as swe)
+		ResetGridFloat(swemeltdepth);
+		ResetGridFloat(swemeltvol);
+
+	}	//end if meltopt > 0
+
+	//if infiltration is simulated
+	if(infopt > 0)
+	{
+		//infiltration depths (m) and volumes (m3)
+		ResetGridFloat(infiltrationdepth);
+		ResetGridFloat(infiltrationvol);
+
+	}	//end if infopt > 0
+
+	//overland outlet volumes (m3) and peak flows (m3/s) and times (hours)
+	ResetVectorFloat(qoutovvol, 1, noutlets);
+	ResetVectorFloat(qpeakov, 1, noutlets);
+	ResetVectorFloat(tpeakov, 1, noutlets);
+
+	//if channels are simulated
+	if(chnopt > 0)
+	{
+		//channel depth arrays (hch and hchnew are swapped after each time step)
+		ResetValue(&hch, sizeof(hch));
+		ResetValue(&hchnew, sizeof(hchnew));
+
+		//channel water depth (m)
+		ResetNodesFloat(hch);
+
+		//channel flow volumes (m3)
+		ResetNodesFloat(qwchvol);
+		ResetNodeValuesFloat(dqchinvol, 11);
+		ResetNodeValuesFloat(dqchoutvol, 11);
+		ResetVectorFloat(qinchvol, 1, nlinks);
+		ResetVectorFloat(qoutchvol, 1, nlinks);
+
+		//channel outlet peak flows (m3/s) and times (hours)
+		ResetVectorFloat(qpeakch, 1, noutlets);
+		ResetVectorFloat(tpeakch, 1, noutlets);
+
+		//if channel transmission loss is simulated
+		if(ctlopt > 0)
+		{
+			//transmission loss depths (m) and volumes (m3)
+			ResetNodesFloat(translossdepth);
+			ResetNodesFloat(translossvol);
+
+		}	//end if ctlopt > 0
+
+	}	//end if chnopt > 0
+
+	//running minima and maxima of depths (m) and intensities (m/s)
+	ResetValue(&minhovdepth, sizeof(minhovdepth));
+	ResetValue(&maxhovdepth, sizeof(maxhovdepth));
+	ResetValue(&minsweovdepth, sizeof(minsweovdepth));
+	ResetValue(&maxsweovdepth, sizeof(maxsweovdepth));
+	ResetValue(&minhchdepth, sizeof(minhchdepth));
+	ResetValue(&maxhchdepth, sizeof(maxhchdepth));
+	ResetValue(&minswemeltdepth, sizeof(minswemeltdepth));
+	ResetValue(&maxswemeltdepth, sizeof(maxswemeltdepth));
+	ResetValue(&mininfiltdepth, sizeof(mininfiltdepth));
+	ResetValue(&maxinfiltdepth, sizeof(maxinfiltdepth));
+	ResetValue(&mintranslossdepth, sizeof(mintranslossdepth));
+	ResetValue(&maxtranslossdepth, sizeof(maxtranslossdepth));
+	ResetValue(&minrainintensity, sizeof(minrainintensity));
+	ResetValue(&maxrainintensity, sizeof(maxrainintensity));
+	ResetValue(&minsweintensity, sizeof(minsweintensity));
+	ResetValue(&maxsweintensity, sizeof(maxsweintensity));
+
+	//rainfall and snowfall grid read times and counts (grids are read again)
+	ResetValue(&timeraingrid, sizeof(timeraingrid));
+	ResetValue(&raingridcount, sizeof(raingridcount));
+	ResetValue(&timesnowgrid, sizeof(timesnowgrid));
+	ResetValue(&snowgridcount, sizeof(snowgridcount));
+
+	//initial and final domain volumes (m3) (accumulated by ComputeInitialState)
+	ResetValue(&initialwaterovvol, sizeof(initialwaterovvol));
+	ResetValue(&initialwaterchvol, sizeof(initialwaterchvol));
+	ResetValue(&initialsweovvol, sizeof(initialsweovvol));
+	ResetValue(&finalwaterovvol, sizeof(finalwaterovvol));
+	ResetValue(&finalwaterchvol, sizeof(finalwaterchvol));
+	ResetValue(&finalsweovvol, sizeof(finalsweovvol));
+
+	//cumulative domain volumes (m3)
+	ResetValue(&totalgrossrainvol, sizeof(totalgrossrainvol));
+	ResetValue(&totalnetrainvol, sizeof(totalnetrainvol));
+	ResetValue(&totalgrossswevol, sizeof(totalgrossswevol));
+	ResetValue(&totalnetswevol, sizeof(totalnetswevol));
+	ResetValue(&totalswemeltvol, sizeof(totalswemeltvol));
+	ResetValue(&totalinterceptvol, sizeof(totalinterceptvol));
+	ResetValue(&totalinfiltvol, sizeof(totalinfiltvol));
+	ResetValue(&totaltranslossvol, sizeof(totaltranslossvol));
+	ResetValue(&totalqoutov, sizeof(totalqoutov));
+	ResetValue(&totalqinch, sizeof(totalqinch));
+	ResetValue(&totalqoutch, sizeof(totalqoutch));
+	ResetValue(&totalqwov, sizeof(totalqwov));
+	ResetValue(&totalqwch, sizeof(totalqwch));
+
+	/*****************************/
+	/*   Environment             */
+	/*****************************/
+
+	//meteorology update time (hours)
+	ResetValue(&timemeteorology, sizeof(timemeteorology));
+
+	//if snowmelt is simulated
+	if(meltopt > 0)
+	{
+		//solar radiation (W/m2) and the sun position of the last update
+		ResetGridFloat(solarrad);
+		ResetVectorFloat(solarcosi, 1, nsolarcells);
+		ResetValue(&suncosz, sizeof(suncosz));
+		ResetValue(&sunx, sizeof(sunx));
+		ResetValue(&suny, sizeof(suny));
+		ResetValue(&sundirect, sizeof(sundirect));
+		ResetValue(&sundiffuse, sizeof(sundiffuse));
+
+	}	//end if meltopt > 0
+
+	//if sediment transport is simulated
+	if(ksim > 1)
+	{
+		/*****************************/
+		/*   Solids                  */
+		/*****************************/
+
+		//set the number of bed layers walked (layer 0 is the water column)
+		nbedov = maxstackov + 1;
+		nbedch = maxstackch + 1;
+
+		//loop over number of solids (solids type 0 holds the sums over
+		//all solids accumulated by ComputeFinalStateSolids)
+		for(isolid=0; isolid<=nsolids; isolid++)
+		{
+			//overland solids concentrations (g/m3)
+			ResetCellsFloat(csedov[isolid], nbedov);
+
+			//overland advection mass budgets (kg)
+			ResetCellsDouble(advsedovinmass[isolid], NOVSLOTS);
+			ResetCellsDouble(advsedovoutmass[isolid], NOVSLOTS);
+
+			//if overland dispersion budgets are tracked
+			if(trackdspovmass > 0)
+			{
+				//overland dispersion mass budgets (kg)
+				ResetCellsDouble(dspsedovinmass[isolid], NOVSLOTS);
+				ResetCellsDouble(dspsedovoutmass[isolid], NOVSLOTS);
+
+			}	//end if trackdspovmass > 0
+
+			//overland deposition, erosion, and burial mass budgets (kg)
+			ResetCellsDouble(depsedovinmass[isolid], nbedov);
+			ResetCellsDouble(depsedovoutmass[isolid], nbedov);
+			ResetCellsDouble(erssedovinmass[isolid], nbedov);
+			ResetCellsDouble(erssedovoutmass[isolid], nbedov);
+			ResetCellsDouble(bursedovinmass[isolid], nbedov);
+			ResetCellsDouble(bursedovoutmass[isolid], nbedov);
+
+			//overland new concentrations (g/m3) and bed fluxes (g/s) by layer
+			//(the values of layers below the surface are kept when the
+			//stack is pushed or popped)
+			ResetCellsFloat(csedovnew[isolid], nbedov);
+			ResetCellsFloat(depsedovinflux[isolid], nbedov);
+			ResetCellsFloat(depsedovoutflux[isolid], nbedov);
+			ResetCellsFloat(erssedovinflux[isolid], nbedov);
+			ResetCellsFloat(erssedovoutflux[isolid], nbedov);
+
+			//overland outlet mass budgets (kg) and peak discharges (kg/s) and times (hours)
+			ResetVectorDouble(totaladvsedinov[isolid], 0, noutlets);
+			ResetVectorDouble(totaladvsedoutov[isolid], 0, noutlets);
+			ResetVectorDouble(totaldspsedinov[isolid], 0, noutlets);
+			ResetVectorDouble(totaldspsedoutov[isolid], 0, noutlets);
+			ResetVectorFloat(sedflowpeakov[isolid], 0, noutlets);
+			ResetVectorFloat(sedtimepeakov[isolid], 0, noutlets);
+
+			//overland initial and final masses by layer (kg)
+			ResetVectorDouble(initialsolidsmassov[isolid], 0, maxstackov);
+			ResetVectorDouble(finalsolidsmassov[isolid], 0, maxstackov);
+
+			//overland final masses by cell and layer (kg) (the sums of
+			//solids type 0 are accumulated by ComputeFinalStateSolids)
+			ResetCellsDouble(finalsolidsov[isolid], nbedov);
+
+			//if channels are simulated
+			if(chnopt > 0)
+			{
+				//channel solids concentrations (g/m3)
+				ResetNodeValuesFloat(csedch[isolid], nbedch);
+
+				//channel advection mass budgets (kg)
+				ResetNodeValuesDouble(advsedchinmass[isolid], 11);
+				ResetNodeValuesDouble(advsedchoutmass[isolid], 11);
+
+				//if channel dispersion budgets are tracked
+				if(trackdspchmass > 0)
+				{
+					//channel dispersion mass budgets (kg)
+					ResetNodeValuesDouble(dspsedchinmass[isolid], 11);
+					ResetNodeValuesDouble(dspsedchoutmass[isolid], 11);
+
+				}	//end if trackdspchmass > 0
+
+				//channel deposition, erosion, and burial mass budgets (kg)
+				ResetNodeValuesDouble(depsedchinmass[isolid], nbedch);
+				ResetNodeValuesDouble(depsedchoutmass[isolid], nbedch);
+				ResetNodeValuesDouble(erssedchinmass[isolid], nbedch);
+				ResetNodeValuesDouble(erssedchoutmass[isolid], nbedch);
+				ResetNodeValuesDouble(bursedchinmass[isolid], nbedch);
+				ResetNodeValuesDouble(bursedchoutmass[isolid], nbedch);
+
+				//channel new concentrations (g/m3) and bed fluxes (g/s) by layer
+				ResetNodeValuesFloat(csedchnew[isolid], nbedch);
+				ResetNodeValuesFloat(depsedchinflux[isolid], nbedch);
+				ResetNodeValuesFloat(depsedchoutflux[isolid], nbedch);
+				ResetNodeValuesFloat(erssedchinflux[isolid], nbedch);
+				ResetNodeValuesFloat(erssedchoutflux[isolid], nbedch);
+
+				//channel outlet mass budgets (kg) and peak discharges (kg/s) and times (hours)
+				ResetVectorDouble(totaladvsedinch[isolid], 0, noutlets);
+				ResetVectorDouble(totaladvsedoutch[isolid], 0, noutlets);
+				ResetVectorDouble(totaldspsedinch[isolid], 0, noutlets);
+				ResetVectorDouble(totaldspsedoutch[isolid], 0, noutlets);
+				ResetVectorFloat(sedflowpeakch[isolid], 0, noutlets);
+				ResetVectorFloat(sedtimepeakch[isolid], 0, noutlets);
+
+				//channel initial and final masses by layer (kg)
+				ResetVectorDouble(initialsolidsmassch[isolid], 0, maxstackch);
+				ResetVectorDouble(finalsolidsmassch[isolid], 0, maxstackch);
+
+				//channel final masses by node and layer (kg)
+				ResetNodeValuesDouble(finalsolidsch[isolid], nbedch);
+
+			}	//end if chnopt > 0
+
+		}	//end loop over solids
+
+		//overland solids totals (kg), external loads (kg), and concentration ranges (g/m3)
+		ResetVectorDouble(totalerssedinov, 0, nsolids);
+		ResetVectorDouble(totaldepsedoutov, 0, nsolids);
+		ResetVectorDouble(totalswov, 0, nsolids);
+		ResetVectorDouble(pendingswov, 0, nsolids);
+		ResetVectorDouble(carryswov, 0, nsolids);
+		ResetVectorDouble(maxcsedov0, 0, nsolids);
+		ResetVectorDouble(mincsedov0, 0, nsolids);
+		ResetVectorDouble(maxcsedov1, 0, nsolids);
+		ResetVectorDouble(mincsedov1, 0, nsolids);
+
+		//overland soil stack: layer counts, elevations (m), and layer geometry and types
+		ResetGridInt(nstackov);
+		ResetGridFloat(elevationov);
+		ResetCellsFloat(hlayerov, nbedov);
+		ResetCellsFloat(minvlayerov, nbedov);
+		ResetCellsFloat(maxvlayerov, nbedov);
+		ResetCellsFloat(elevlayerov, nbedov);
+		ResetCellsDouble(vlayerov, nbedov);
+		ResetCellsDouble(vlayerovnew, nbedov);
+		ResetCellsInt(soiltype, nbedov);
+
+		//if channels are simulated
+		if(chnopt > 0)
+		{
+			//channel solids totals (kg), external loads (kg), and concentration ranges (g/m3)
+			ResetVectorDouble(totalerssedinch, 0, nsolids);
+			ResetVectorDouble(totaldepsedoutch, 0, nsolids);
+			ResetVectorDouble(totalswch, 0, nsolids);
+			ResetVectorDouble(pendingswch, 0, nsolids);
+			ResetVectorDouble(carryswch, 0, nsolids);
+			ResetVectorDouble(maxcsedch0, 0, nsolids);
+			ResetVectorDouble(mincsedch0, 0, nsolids);
+			ResetVectorDouble(maxcsedch1, 0, nsolids);
+			ResetVectorDouble(mincsedch1, 0, nsolids);
+
+			//channel sediment stack: layer counts, elevations (m), and layer geometry
+			ResetNodesInt(nstackch);
+			ResetNodesFloat(elevationch);
+			ResetNodeValuesFloat(hlayerch, nbedch);
+			ResetNodeValuesFloat(bwlayerch, nbedch);
+			ResetNodeValuesFloat(achbed, nbedch);
+			ResetNodeValuesFloat(elevlayerch, nbedch);
+			ResetNodeValuesFloat(minvlayerch, nbedch);
+			ResetNodeValuesFloat(maxvlayerch, nbedch);
+			ResetNodeValuesFloat(porositych, nbedch);
+			ResetNodeValuesDouble(vlayerch, nbedch);
+			ResetNodeValuesDouble(vlayerchnew, nbedch);
+
+			//channel geometry changed by the stacks (m)
+			ResetNodesFloat(bwidth);
+			ResetNodesFloat(hbank);
+			ResetNodesFloat(sideslope);
+
+		}	//end if chnopt > 0
+
+		//soil and sediment stack list and event counts
+		ResetValue(&npopov, sizeof(npopov));
+		ResetValue(&npushov, sizeof(npushov));
+		ResetValue(&npopch, sizeof(npopch));
+		ResetValue(&npushch, sizeof(npushch));
+		ResetValue(&nstackevents, sizeof(nstackevents));
+
+		//if the overland erosion option > 2
+		if(ersovopt > 2)
+		{
+			//overland shear stress histories (N/m2, hours)
+			ResetGridFloat(taumaxov);
+			ResetGridFloat(taumaxtimeov);
+
+		}	//end if ersovopt > 2
+
+		//if channels are simulated and the channel erosion option > 2
+		if(chnopt > 0 && erschopt > 2)
+		{
+			//channel shear stress histories (N/m2, hours)
+			ResetNodesFloat(taumaxch);
+			ResetNodesFloat(taumaxtimech);
+
+		}	//end if chnopt > 0 and erschopt > 2
+
+		//if chemical transport is simulated
+		if(ksim > 2)
+		{
+			/*****************************/
+			/*   Chemicals               */
+			/*****************************/
+
+			//overland concentration arrays (swapped after each time step)
+			ResetValue(&cchemov, sizeof(cchemov));
+			ResetValue(&cchemovnew, sizeof(cchemovnew));
+
+			//if channels are simulated
+			if(chnopt > 0)
+			{
+				//channel concentration arrays (swapped after each time step)
+				ResetValue(&cchemch, sizeof(cchemch));
+				ResetValue(&cchemchnew, sizeof(cchemchnew));
+
+			}	//end if chnopt > 0
+
+			//loop over number of chemicals
+			for(ichem=1; ichem<=nchems; ichem++)
+			{
+				//overland chemical concentrations (g/m3)
+				ResetCellsFloat(cchemov[ichem], nbedov);
+
+				//overland new chemical concentrations (g/m3) (unoccupied
+				//layers are carried by the swap in NewStateChemical)
+				ResetCellsFloat(cchemovnew[ichem], nbedov);
+
+				//overland partition fractions (computed at the end of each time step)
+				ResetCellsFloat(fdissolvedov[ichem], nbedov);
+				ResetCellsFloat(fboundov[ichem], nbedov);
+
+				//loop over number of solids
+				for(isolid=1; isolid<=nsolids; isolid++)
+				{
+					//overland particulate fractions
+					ResetCellsFloat(fparticulateov[ichem][isolid], nbedov);
+
+				}	//end loop over solids
+
+				//overland advection mass budgets (kg)
+				ResetCellsDouble(advchemovinmass[ichem], NOVSLOTS);
+				ResetCellsDouble(advchemovoutmass[ichem], NOVSLOTS);
+
+				//if overland dispersion budgets are tracked
+				if(trackdspovmass > 0)
+				{
+					//overland dispersion mass budgets (kg)
+					ResetCellsDouble(dspchemovinmass[ichem], NOVSLOTS);
+					ResetCellsDouble(dspchemovoutmass[ichem], NOVSLOTS);
+
+				}	//end if trackdspovmass > 0
+
+				//overland bed exchange and transformation mass budgets (kg)
+				ResetCellsDouble(depchemovinmass[ichem], nbedov);
+				ResetCellsDouble(depchemovoutmass[ichem], nbedov);
+				ResetCellsDouble(erschemovinmass[ichem], nbedov);
+				ResetCellsDouble(erschemovoutmass[ichem], nbedov);
+				ResetCellsDouble(pwrchemovinmass[ichem], nbedov);
+				ResetCellsDouble(pwrchemovoutmass[ichem], nbedov);
+				ResetCellsDouble(burchemovinmass[ichem], nbedov);
+				ResetCellsDouble(burchemovoutmass[ichem], nbedov);
+				ResetCellsDouble(infchemovinmass[ichem], nbedov);
+				ResetCellsDouble(infchemovoutmass[ichem], nbedov);
+				ResetCellsDouble(biochemovinmass[ichem], nbedov);
+				ResetCellsDouble(biochemovoutmass[ichem], nbedov);
+				ResetCellsDouble(hydchemovinmass[ichem], nbedov);
+				ResetCellsDouble(hydchemovoutmass[ichem], nbedov);
+				ResetCellsDouble(oxichemovinmass[ichem], nbedov);
+				ResetCellsDouble(oxichemovoutmass[ichem], nbedov);
+				ResetCellsDouble(phtchemovinmass[ichem], nbedov);
+				ResetCellsDouble(phtchemovoutmass[ichem], nbedov);
+				ResetCellsDouble(radchemovinmass[ichem], nbedov);
+				ResetCellsDouble(radchemovoutmass[ichem], nbedov);
+				ResetCellsDouble(vltchemovinmass[ichem], nbedov);
+				ResetCellsDouble(vltchemovoutmass[ichem], nbedov);
+				ResetCellsDouble(udrchemovinmass[ichem], nbedov);
+				ResetCellsDouble(udrchemovoutmass[ichem], nbedov);
+
+				//overland bed exchange and transformation fluxes by layer (g/s)
+				ResetCellsFloat(depchemovinflux[ichem], nbedov);
+				ResetCellsFloat(depchemovoutflux[ichem], nbedov);
+				ResetCellsFloat(erschemovinflux[ichem], nbedov);
+				ResetCellsFloat(erschemovoutflux[ichem], nbedov);
+				ResetCellsFloat(pwrchemovinflux[ichem], nbedov);
+				ResetCellsFloat(pwrchemovoutflux[ichem], nbedov);
+				ResetCellsFloat(infchemovinflux[ichem], nbedov);
+				ResetCellsFloat(infchemovoutflux[ichem], nbedov);
+				ResetCellsFloat(biochemovinflux[ichem], nbedov);
+				ResetCellsFloat(biochemovoutflux[ichem], nbedov);
+				ResetCellsFloat(hydchemovinflux[ichem], nbedov);
+				ResetCellsFloat(hydchemovoutflux[ichem], nbedov);
+				ResetCellsFloat(oxichemovinflux[ichem], nbedov);
+				ResetCellsFloat(oxichemovoutflux[ichem], nbedov);
+				ResetCellsFloat(phtchemovinflux[ichem], nbedov);
+				ResetCellsFloat(phtchemovoutflux[ichem], nbedov);
+				ResetCellsFloat(radchemovinflux[ichem], nbedov);
+				ResetCellsFloat(radchemovoutflux[ichem], nbedov);
+				ResetCellsFloat(vltchemovinflux[ichem], nbedov);
+				ResetCellsFloat(vltchemovoutflux[ichem], nbedov);
+				ResetCellsFloat(udrchemovinflux[ichem], nbedov);
+				ResetCellsFloat(udrchemovoutflux[ichem], nbedov);
+
+				//overland outlet mass budgets (kg) and peak discharges (kg/s) and times (hours)
+				ResetVectorDouble(totaladvcheminov[ichem], 0, noutlets);
+				ResetVectorDouble(totaladvchemoutov[ichem], 0, noutlets);
+				ResetVectorDouble(totaldspcheminov[ichem], 0, noutlets);
+				ResetVectorDouble(totaldspchemoutov[ichem], 0, noutlets);
+				ResetVectorFloat(chemflowpeakov[ichem], 0, noutlets);
+				ResetVectorFloat(chemtimepeakov[ichem], 0, noutlets);
+
+				//overland infiltration totals (kg) and initial and final masses by layer (kg)
+				ResetVectorDouble(totalinfchemoutov[ichem], 0, 1);
+				ResetVectorDouble(initialchemmassov[ichem], 0, maxstackov);
+				ResetVectorDouble(finalchemmassov[ichem], 0, maxstackov);
+
+				//if channels are simulated
+				if(chnopt > 0)
+				{
+					//channel chemical concentrations (g/m3)
+					ResetNodeValuesFloat(cchemch[ichem], nbedch);
+
+					//channel new chemical concentrations (g/m3)
+					ResetNodeValuesFloat(cchemchnew[ichem], nbedch);
+
+					//channel partition fractions
+					ResetNodeValuesFloat(fdissolvedch[ichem], nbedch);
+					ResetNodeValuesFloat(fboundch[ichem], nbedch);
+
+					//loop over number of solids
+					for(isolid=1; isolid<=nsolids; isolid++)
+					{
+						//channel particulate fractions
+						ResetNodeValuesFloat(fparticulatech[ichem][isolid], nbedch);
+
+					}	//end loop over solids
+
+					//channel advection mass budgets (kg)
+					ResetNodeValuesDouble(advchemchinmass[ichem], 11);
+					ResetNodeValuesDouble(advchemchoutmass[ichem], 11);
+
+					//if channel dispersion budgets are tracked
+					if(trackdspchmass > 0)
+					{
+						//channel dispersion mass budgets (kg)
+						ResetNodeValuesDouble(dspchemchinmass[ichem], 11);
+						ResetNodeValuesDouble(dspchemchoutmass[ichem], 11);
+
+					}	//end if trackdspchmass > 0
+
+					//channel bed exchange and transformation mass budgets (kg)
+					ResetNodeValuesDouble(depchemchinmass[ichem], nbedch);
+					ResetNodeValuesDouble(depchemchoutmass[ichem], nbedch);
+					ResetNodeValuesDouble(erschemchinmass[ichem], nbedch);
+					ResetNodeValuesDouble(erschemchoutmass[ichem], nbedch);
+					ResetNodeValuesDouble(pwrchemchinmass[ichem], nbedch);
+					ResetNodeValuesDouble(pwrchemchoutmass[ichem], nbedch);
+					ResetNodeValuesDouble(burchemchinmass[ichem], nbedch);
+					ResetNodeValuesDouble(burchemchoutmass[ichem], nbedch);
+					ResetNodeValuesDouble(infchemchinmass[ichem], nbedch);
+					ResetNodeValuesDouble(infchemchoutmass[ichem], nbedch);
+					ResetNodeValuesDouble(biochemchinmass[ichem], nbedch);
+					ResetNodeValuesDouble(biochemchoutmass[ichem], nbedch);
+					ResetNodeValuesDouble(hydchemchinmass[ichem], nbedch);
+					ResetNodeValuesDouble(hydchemchoutmass[ichem], nbedch);
+					ResetNodeValuesDouble(oxichemchinmass[ichem], nbedch);
+					ResetNodeValuesDouble(oxichemchoutmass[ichem], nbedch);
+					ResetNodeValuesDouble(phtchemchinmass[ichem], nbedch);
+					ResetNodeValuesDouble(phtchemchoutmass[ichem], nbedch);
+					ResetNodeValuesDouble(radchemchinmass[ichem], nbedch);
+					ResetNodeValuesDouble(radchemchoutmass[ichem], nbedch);
+					ResetNodeValuesDouble(vltchemchinmass[ichem], nbedch);
+					ResetNodeValuesDouble(vltchemchoutmass[ichem], nbedch);
+					ResetNodeValuesDouble(udrchemchinmass[ichem], nbedch);
+					ResetNodeValuesDouble(udrchemchoutmass[ichem], nbedch);
+
+					//channel bed exchange and transformation fluxes by layer (g/s)
+					ResetNodeValuesFloat(depchemchinflux[ichem], nbedch);
+					ResetNodeValuesFloat(depchemchoutflux[ichem], nbedch);
+					ResetNodeValuesFloat(erschemchinflux[ichem], nbedch);
+					ResetNodeValuesFloat(erschemchoutflux[ichem], nbedch);
+					ResetNodeValuesFloat(pwrchemchinflux[ichem], nbedch);
+					ResetNodeValuesFloat(pwrchemchoutflux[ichem], nbedch);
+					ResetNodeValuesFloat(infchemchinflux[ichem], nbedch);
+					ResetNodeValuesFloat(infchemchoutflux[ichem], nbedch);
+					ResetNodeValuesFloat(biochemchinflux[ichem], nbedch);
+					ResetNodeValuesFloat(biochemchoutflux[ichem], nbedch);
+					ResetNodeValuesFloat(hydchemchinflux[ichem], nbedch);
+					ResetNodeValuesFloat(hydchemchoutflux[ichem], nbedch);
+					ResetNodeValuesFloat(oxichemchinflux[ichem], nbedch);
+					ResetNodeValuesFloat(oxichemchoutflux[ichem], nbedch);
+					ResetNodeValuesFloat(phtchemchinflux[ichem], nbedch);
+					ResetNodeValuesFloat(phtchemchoutflux[ichem], nbedch);
+					ResetNodeValuesFloat(radchemchinflux[ichem], nbedch);
+					ResetNodeValuesFloat(radchemchoutflux[ichem], nbedch);
+					ResetNodeValuesFloat(vltchemchinflux[ichem], nbedch);
+					ResetNodeValuesFloat(vltchemchoutflux[ichem], nbedch);
+					ResetNodeValuesFloat(udrchemchinflux[ichem], nbedch);
+					ResetNodeValuesFloat(udrchemchoutflux[ichem], nbedch);
+
+					//channel outlet mass budgets (kg) and peak discharges (kg/s) and times (hours)
+					ResetVectorDouble(totaladvcheminch[ichem], 0, noutlets);
+					ResetVectorDouble(totaladvchemoutch[ichem], 0, noutlets);
+					ResetVectorDouble(totaldspcheminch[ichem], 0, noutlets);
+					ResetVectorDouble(totaldspchemoutch[ichem], 0, noutlets);
+					ResetVectorFloat(chemflowpeakch[ichem], 0, noutlets);
+					ResetVectorFloat(chemtimepeakch[ichem], 0, noutlets);
+
+					//channel infiltration totals (kg) and initial and final masses by layer (kg)
+					ResetVectorDouble(totalinfchemoutch[ichem], 0, 1);
+					ResetVectorDouble(initialchemmassch[ichem], 0, maxstackch);
+					ResetVectorDouble(finalchemmassch[ichem], 0, maxstackch);
+
+				}	//end if chnopt > 0
+
+			}	//end loop over chemicals
+
+			//overland chemical totals (kg), external loads (kg), and concentration ranges (g/m3)
+			ResetVectorDouble(totalerscheminov, 1, nchems);
+			ResetVectorDouble(totalpwrcheminov, 1, nchems);
+			ResetVectorDouble(totaltnscheminov, 1, nchems);
+			ResetVectorDouble(totaldepchemoutov, 1, nchems);
+			ResetVectorDouble(totaltnschemoutov, 1, nchems);
+			ResetVectorDouble(totalcwov, 1, nchems);
+			ResetVectorDouble(pendingcwov, 1, nchems);
+			ResetVectorDouble(carrycwov, 1, nchems);
+			ResetVectorDouble(maxcchemov0, 1, nchems);
+			ResetVectorDouble(mincchemov0, 1, nchems);
+			ResetVectorDouble(maxcchemov1, 1, nchems);
+			ResetVectorDouble(mincchemov1, 1, nchems);
+
+			//if channels are simulated
+			if(chnopt > 0)
+			{
+				//channel chemical totals (kg), external loads (kg), and concentration ranges (g/m3)
+				ResetVectorDouble(totalerscheminch, 1, nchems);
+				ResetVectorDouble(totalpwrcheminch, 1, nchems);
+				ResetVectorDouble(totaltnscheminch, 1, nchems);
+				ResetVectorDouble(totaldepchemoutch, 1, nchems);
+				ResetVectorDouble(totaltnschemoutch, 1, nchems);
+				ResetVectorDouble(totalcwch, 1, nchems);
+				ResetVectorDouble(pendingcwch, 1, nchems);
+				ResetVectorDouble(carrycwch, 1, nchems);
+				ResetVectorDouble(maxcchemch0, 1, nchems);
+				ResetVectorDouble(mincchemch0, 1, nchems);
+				ResetVectorDouble(maxcchemch1, 1, nchems);
+				ResetVectorDouble(mincchemch1, 1, nchems);
+
+			}	//end if chnopt > 0
+
+		}	//end if ksim > 2
+
+	}	//end if ksim > 1
+
+	/*****************************/
+	/*   Output files            */
+	/*****************************/
+
+	//echo and summary statistics files
+	ResetFile(echofile);
+	ResetFile(statsfile);
+
+	//if the mass balance file name is not blank
+	if(*msbfile != '\0')
+	{
+		//mass balance file
+		ResetFile(msbfile);
+
+	}	//end if msbfile is not blank
+
+	//if the dump file name is not blank
+	if(*dmpfile != '\0')
+	{
+		//dump file
+		ResetFile(dmpfile);
+
+	}	//end if dmpfile is not blank
+
+	//if automated time-stepping is selected (dtopt = 1 or dtopt = 2)
+	if(dtopt == 1 || dtopt == 2)
+	{
+		//time step buffer file
+		ResetFile(dtbufferfile);
+
+	}	//end if dtopt = 1 or 2
+
+	//if there are water reporting stations
+	if(nqreports > 0)
+	{
+		//water export file
+		ResetFile(waterexpfile);
+
+	}	//end if nqreports > 0
+
+	//if sediment transport is simulated and there are solids reporting stations
+	if(ksim > 1 && nsedreports > 0)
+	{
+		//loop over reporting groups (zero is the sum of solids)
+		for(igroup=0; igroup<=nsgroups; igroup++)
+		{
+			//solids export file of the group
+			ResetFile(sedexpfile[igroup]);
+		}
+
+	}	//end if ksim > 1 and nsedreports > 0
+
+	//if chemical transport is simulated and there are chemical reporting stations
+	if(ksim > 2 && nchemreports > 0)
+	{
+		//loop over chemicals
+		for(ichem=1; ichem<=nchems; ichem++)
+		{
+			//chemical export file
+			ResetFile(chemexpfile[ichem]);
+		}
+
+	}	//end if ksim > 2 and nchemreports > 0
+
+//End of function: Return to SaveResetState or RestoreResetState
+}
+
+//C
+//C
+			/*******************************************/
+			/*        FUNCTION: SaveResetState         */
+			/*******************************************/
+
+/* Saves the state after initialization (see TrexLoad) */
+
+void SaveResetState()
+{
+	//free any state saved by a prior initialization
+	FreeResetState();
+
+	//count the bytes of the saved state
+	resetmode = 0;
+	WalkResetState();
+	resetsize = resetcursor;
+
+	//Allocate memory for the saved state (at least one byte)
+	resetstate = (char *)malloc(resetsize + 1);
+
+	//save the state
+	resetmode = 1;
+	WalkResetState();
+
+//End of function: Return to TrexLoad
+}
+
+//C
+//C
+			/*******************************************/
+			/*       FUNCTION: RestoreResetState       */
+			/*******************************************/
+
+/* Restores the state after initialization (returns 1 if the state */
+/* was restored or 0 if no state is saved)                         */
+
+int RestoreResetState()
+{
+	//if no state is saved
+	if(resetstate == NULL)
+	{
+		//the state cannot be restored
+		return 0;
+	}
+
+	//restore the state
+	resetmode = 2;
+	WalkResetState();
+
+	//Set the surface soil parameters of all cells (restored soil parameters and stacks)
+	UpdateSoilParameters();
+
+	//if chemical transport is simulated
+	if(ksim > 2)
+	{
+		//Partition all cells and nodes again (restored concentrations and stacks)
+		InvalidatePartitioning();
+
+	}	//end if ksim > 2
+
+	//Reassign the cell values of zoned environmental properties
+	InvalidateEnvironmentZones();
+
+	//Clear the step values and running totals of the mass balance monitor
+	ClearMassBalanceMonitor();
+
+	//the state is restored
+	return 1;
+
+//End of function: Return to TrexReset
+}
+
+//C
+//C
+			/*******************************************/
+			/*        FUNCTION: FreeResetState         */
+			/*******************************************/
+
+/* Frees memory for the state saved after initialization */
+
+void FreeResetState()
+{
+	//Free memory for the saved state
+	free(resetstate);
+
+	//the saved state is not allocated
+	resetstate = NULL;
+
+//End of function: Return to calling module
+}
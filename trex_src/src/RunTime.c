@@ -39,6 +39,12 @@ C-  Date:       13-JUN-2005
 C-
 C-  Revisions:  Documentation, streamlining, revised function call.
 C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Output files are opened by OpenOutputFile.
+C-
 C-  Date:
 C-
 C-  Revisions:
@@ -75,7 +81,7 @@ void RunTime(time_t clockstart, time_t clockstop)
 	echofile_fp = NULL;
 
 	//open the echo file (in append mode)
-	echofile_fp = fopen(echofile, "a");
+	echofile_fp = OpenOutputFile(echofile, "a");
 
 	//if echo file pointer is still null, then abort
 	if(echofile_fp == NULL)
@@ -89,7 +95,7 @@ void RunTime(time_t clockstart, time_t clockstop)
 	statsfile_fp = NULL;
 
 	//open the summary statistics file (in append mode)
-	statsfile_fp = fopen(statsfile, "a");
+	statsfile_fp = OpenOutputFile(statsfile, "a");
 
 	//if file pointer is still null, then abort
 	if(statsfile_fp == NULL)
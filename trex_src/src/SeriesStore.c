@@ -0,0 +1,568 @@
+/*----------------------------------------------------------------------
+C-  File:       SeriesStore.c
+C-
+C-  Purpose/    Concatenated group of functions to write the time
+C-  Methods:    series of the reporting stations (export files) to
+C-              columnar series stores.
+C-
+C-              By default, WriteTimeSeriesWater, WriteTimeSeriesSolids
+C-              and WriteTimeSeriesChemical open each export file at
+C-              each print time and append one comma-delimited text
+C-              row.  When series stores are selected (tsstoreopt = 1,
+C-              see TrexSetSeriesStore and the -tsstore option of
+C-              trex), the values of a row are buffered in memory
+C-              instead (BeginSeriesRow, ExportValue, EndSeriesRow).
+C-              Each export file has its own store, named by the
+C-              export file name followed by .tss.  The text export
+C-              file keeps its header line only.
+C-
+C-              The buffer of a store holds a block of rows column
+C-              by column.  When the block is full (about
+C-              SERIESBLOCKBYTES bytes), it is appended to the store
+C-              file.  At the end of the run (CloseSeriesStore), the
+C-              last block and a time index are appended.  A store
+C-              file has:
+C-
+C-                header   SERIESID, four integers (version, number
+C-                         of columns, length of the header text,
+C-                         length of a format), the header line of
+C-                         the export file, and the printf format of
+C-                         each column;
+C-
+C-                blocks   SERIESBLOCKID, the number of rows and
+C-                         columns, the first and last time, the
+C-                         times (double), then the values (float) of
+C-                         each column;
+C-
+C-                index    SERIESINDEXID, the number of blocks, and
+C-                         for each block its offset, number of rows,
+C-                         and first and last time, followed by the
+C-                         offset of the index and SERIESID.
+C-
+C-              Values are written in native byte order.  A store
+C-              without an index (a run that stopped) is read by
+C-              walking its blocks.  The trexseries program lists the
+C-              columns of a store and exports selected columns and
+C-              times to comma-delimited text.  The exported rows are
+C-              identical to the rows of the text export file.
+C-
+C-  Function
+C-   Listing:   BeginSeriesRow, ExportValue, EndSeriesRow,
+C-              CloseSeriesStore, FindSeriesStore, ReadSeriesHeader,
+C-              WriteSeriesBlock
+C-
+C-  Inputs:     export file names and header lines, simtime, values
+C-              of the export rows
+C-
+C-  Outputs:    series store files
+C-
+C-  Controls:   tsstoreopt
+C-
+C-  Calls:      OpenOutputFile
+C-
+C-  Called by:  WriteTimeSeriesWater, WriteTimeSeriesSolids,
+C-              WriteTimeSeriesChemical, TrexFinalize, FreeMemory
+C-
+C-  Created:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revised:
+C-
+C-  Date:
+C-
+C-  Revisions:
+C-
+C----------------------------------------------------------------------*/
+
+//trex general variable declarations
+#include "trex_general_declarations.h"
+
+#define SERIESID "TREXSERS"			//identifier at the start and end of a store file
+#define SERIESBLOCKID "SERBLOCK"	//identifier at the start of a block
+#define SERIESINDEXID "SERINDEX"	//identifier at the start of the time index
+#define SERIESVERSION 1				//store file format version
+#define SERIESFORMATSIZE 8			//length of a column format (with terminating nulls)
+#define SERIESBLOCKBYTES 1048576	//target size of a block (bytes)
+
+//time index entry of a block (as written to the store file)
+typedef struct
+{
+	long long offset;	//offset of the block in the store file (bytes)
+	int nrows;			//number of rows of the block
+	int ncolumns;		//number of value columns of the block
+	double tfirst;		//time of the first row (hours)
+	double tlast;		//time of the last row (hours)
+} seriesblock;
+
+//series store of one export file
+typedef struct
+{
+	char name[MAXNAMESIZE];	//export file name
+	char *header;			//header line of the export file
+	int ncolumns;			//number of value columns (0 until the first row ends)
+	char *formats;			//printf format of each column [ncolumns][SERIESFORMATSIZE]
+	int blockrows;			//number of rows of a block
+	int nrows;				//number of buffered rows
+	double *times;			//times of the buffered rows [blockrows]
+	float *values;			//buffered values, column by column [ncolumns][blockrows]
+	long long size;			//size of the store file (bytes)
+	seriesblock *blocks;	//time index of the written blocks
+	int nblocks;			//number of written blocks
+} seriesstore;
+
+static seriesstore *seriesstores = NULL;	//series stores (one per export file)
+static int nseriesstores = 0;				//number of series stores
+static seriesstore *seriesrow = NULL;		//store of the row being written (NULL = text row)
+static float *rowvalues = NULL;				//values of the row being written
+static char *rowformats = NULL;				//formats of the row being written (first row of a store)
+static int rowcolumns = 0;					//number of values of the row being written
+static int rowsize = 0;						//allocated number of row values
+
+//C
+//C
+			/*****************************************/
+			/*       FUNCTION: ReadSeriesHeader      */
+			/*****************************************/
+
+/* Returns the header line of an export file (allocated, "" if the file
+   cannot be read) */
+
+static char *ReadSeriesHeader(char *name)
+{
+	//local variable declarations
+	FILE *header_fp;	//export file pointer
+
+	char *header;		//header line
+
+	int c,				//character read from the file
+		length,			//length of the header line
+		size;			//allocated size of the header line
+
+	//allocate the header line
+	size = 256;
+	header = (char *)malloc(size * sizeof(char));
+	length = 0;
+
+	//open the export file
+	header_fp = fopen(name, "r");
+
+	//if the export file was opened
+	if(header_fp != NULL)
+	{
+		//read the first line (with its end of line)
+		while((c = getc(header_fp)) != EOF)
+		{
+			//if the line is full
+			if(length + 2 > size)
+			{
+				//grow the line
+				size = 2 * size;
+				header = (char *)realloc(header, size * sizeof(char));
+			}
+
+			//store the character
+			header[length++] = (char)c;
+
+			//if the end of the line was read
+			if(c == '\n')
+			{
+				//the header line is complete
+				break;
+			}
+
+		}	//end while characters are read
+
+		//close the export file
+		fclose(header_fp);
+
+	}	//end if header_fp != NULL
+
+	//terminate the header line
+	header[length] = '\0';
+
+	//return the header line
+	return header;
+
+//end of function ReadSeriesHeader
+}
+
+//C
+//C
+			/*****************************************/
+			/*       FUNCTION: FindSeriesStore       */
+			/*****************************************/
+
+/* Returns the series store of an export file (a new store the first
+   time the file is written) */
+
+static seriesstore *FindSeriesStore(char *name)
+{
+	//local variable declarations
+	int n;					//store index
+
+	seriesstore *store;		//series store
+
+	//loop over series stores
+	for(n=0; n<nseriesstores; n++)
+	{
+		//if the store belongs to the export file
+		if(strcmp(seriesstores[n].name, name) == 0)
+		{
+			//return the store
+			return &seriesstores[n];
+		}
+
+	}	//end loop over series stores
+
+	//add a store
+	seriesstores = (seriesstore *)realloc(seriesstores,
+		(nseriesstores+1) * sizeof(seriesstore));
+	store = &seriesstores[nseriesstores++];
+
+	//set the store of the export file (columns are set when its first row ends)
+	memset(store, 0, sizeof(seriesstore));
+	strncpy(store->name, name, MAXNAMESIZE-1);
+	store->header = ReadSeriesHeader(name);
+
+	//return the new store
+	return store;
+
+//end of function FindSeriesStore
+}
+
+//C
+//C
+			/*****************************************/
+			/*       FUNCTION: WriteSeriesBlock      */
+			/*****************************************/
+
+/* Appends the buffered rows of a store to its file as one block (the
+   file and its header are written with the first block) */
+
+static void WriteSeriesBlock(seriesstore *store)
+{
+	//local variable declarations
+	FILE *store_fp;		//store file pointer
+
+	char storefile[MAXNAMESIZE+8];	//store file name
+
+	int fields[4],		//integer header fields
+		column;			//column index
+
+	seriesblock block;	//time index entry of the block
+
+	//if no rows are buffered
+	if(store->nrows == 0)
+	{
+		//nothing to write
+		return;
+	}
+
+	//set the store file name
+	sprintf(storefile, "%s.tss", store->name);
+
+	//create the file with the first block, append later blocks
+	store_fp = OpenOutputFile(storefile, (store->nblocks == 0) ? "wb" : "ab");
+
+	//if the store file pointer is null, abort execution
+	if(store_fp == NULL)
+	{
+		//Write message to file
+		fprintf(echofile_fp, "Error! Can't open Series Store File:  %s\n", storefile);
+
+		//Write message to screen
+		printf("Error! Can't open Series Store File:  %s\n", storefile);
+		exit(EXIT_FAILURE);	//abort
+	}
+
+	//if this is the first block
+	if(store->nblocks == 0)
+	{
+		//set the integer header fields
+		fields[0] = SERIESVERSION;
+		fields[1] = store->ncolumns;
+		fields[2] = (int)strlen(store->header);
+		fields[3] = SERIESFORMATSIZE;
+
+		//write the header
+		fwrite(SERIESID, sizeof(char), strlen(SERIESID), store_fp);
+		fwrite(fields, sizeof(int), 4, store_fp);
+		fwrite(store->header, sizeof(char), fields[2], store_fp);
+		fwrite(store->formats, sizeof(char), store->ncolumns * SERIESFORMATSIZE, store_fp);
+
+		//set the file size
+		store->size = strlen(SERIESID) + 4 * sizeof(int) + fields[2]
+			+ store->ncolumns * SERIESFORMATSIZE;
+
+	}	//end if nblocks == 0
+
+	//set the time index entry of the block
+	block.offset = store->size;
+	block.nrows = store->nrows;
+	block.ncolumns = store->ncolumns;
+	block.tfirst = store->times[0];
+	block.tlast = store->times[store->nrows-1];
+
+	//write the block header (identifier, rows, columns, and times) and the times
+	fwrite(SERIESBLOCKID, sizeof(char), strlen(SERIESBLOCKID), store_fp);
+	fwrite(&block.nrows, sizeof(int), 1, store_fp);
+	fwrite(&block.ncolumns, sizeof(int), 1, store_fp);
+	fwrite(&block.tfirst, sizeof(double), 1, store_fp);
+	fwrite(&block.tlast, sizeof(double), 1, store_fp);
+	fwrite(store->times, sizeof(double), store->nrows, store_fp);
+
+	//loop over columns
+	for(column=0; column<store->ncolumns; column++)
+	{
+		//write the values of the column
+		fwrite(&store->values[(size_t)column*store->blockrows], sizeof(float),
+			store->nrows, store_fp);
+
+	}	//end loop over columns
+
+	//Close store file
+	fclose(store_fp);
+
+	//add the block to the time index
+	store->blocks = (seriesblock *)realloc(store->blocks,
+		(store->nblocks+1) * sizeof(seriesblock));
+	store->blocks[store->nblocks++] = block;
+
+	//add the block to the file size
+	store->size = store->size + strlen(SERIESBLOCKID) + 2 * sizeof(int)
+		+ (2 + (long long)store->nrows) * sizeof(double)
+		+ (long long)store->ncolumns * store->nrows * sizeof(float);
+
+	//the buffer is empty
+	store->nrows = 0;
+
+//end of function WriteSeriesBlock
+}
+
+//C
+//C
+			/*****************************************/
+			/*        FUNCTION: BeginSeriesRow       */
+			/*****************************************/
+
+/* Starts a row of the series store of an export file at the current
+   time (ExportValue then buffers the values of the row) */
+
+void BeginSeriesRow(char *name)
+{
+	//set the store of the row
+	seriesrow = FindSeriesStore(name);
+
+	//the row has no values yet
+	rowcolumns = 0;
+
+//end of function BeginSeriesRow
+}
+
+//C
+//C
+			/*****************************************/
+			/*         FUNCTION: ExportValue         */
+			/*****************************************/
+
+/* Writes a value of an export row: to the text file (format is the
+   printf format, e.g. ",%f") or, when a series row was started, to the
+   row buffer */
+
+void ExportValue(FILE *fp, char *format, float value)
+{
+	//if the row is a text row
+	if(seriesrow == NULL)
+	{
+		//print the value to the export file
+		fprintf(fp, format, value);
+
+		//the value is written
+		return;
+	}
+
+	//if the row buffer is full
+	if(rowcolumns == rowsize)
+	{
+		//grow the row buffer
+		rowsize = (rowsize == 0) ? 64 : 2 * rowsize;
+		rowvalues = (float *)realloc(rowvalues, rowsize * sizeof(float));
+		rowformats = (char *)realloc(rowformats, (size_t)rowsize * SERIESFORMATSIZE * sizeof(char));
+	}
+
+	//if this is the first row of the store
+	if(seriesrow->ncolumns == 0)
+	{
+		//store the format of the column
+		memset(&rowformats[(size_t)rowcolumns*SERIESFORMATSIZE], 0, SERIESFORMATSIZE);
+		strncpy(&rowformats[(size_t)rowcolumns*SERIESFORMATSIZE], format, SERIESFORMATSIZE-1);
+	}
+
+	//store the value
+	rowvalues[rowcolumns++] = value;
+
+//end of function ExportValue
+}
+
+//C
+//C
+			/*****************************************/
+			/*         FUNCTION: EndSeriesRow        */
+			/*****************************************/
+
+/* Ends the row of a series store: the values of the row are added to
+   the block buffer (a full block is written to the store file) */
+
+void EndSeriesRow()
+{
+	//local variable declarations
+	int column;				//column index
+
+	seriesstore *store;		//store of the row
+
+	//set the store of the row
+	store = seriesrow;
+
+	//the next row is a text row unless a series row is started
+	seriesrow = NULL;
+
+	//if this is the first row of the store
+	if(store->ncolumns == 0)
+	{
+		//the first row sets the columns of the store
+		store->ncolumns = rowcolumns;
+		store->formats = (char *)malloc((size_t)(rowcolumns+1) * SERIESFORMATSIZE * sizeof(char));
+		memcpy(store->formats, rowformats, (size_t)rowcolumns * SERIESFORMATSIZE);
+
+		//set the rows of a block (about SERIESBLOCKBYTES bytes)
+		store->blockrows = SERIESBLOCKBYTES
+			/ (int)(sizeof(double) + rowcolumns * sizeof(float));
+
+		//a block has at least one row
+		if(store->blockrows < 1)
+		{
+			store->blockrows = 1;
+		}
+
+		//allocate the block buffer
+		store->times = (double *)malloc(store->blockrows * sizeof(double));
+		store->values = (float *)malloc((size_t)(rowcolumns+1) * store->blockrows * sizeof(float));
+	}
+	else if(rowcolumns != store->ncolumns)	//else the row does not match the columns of the store
+	{
+		//Write message to file
+		fprintf(echofile_fp, "Error! Row of %d values for the %d columns of Series Store:  %s.tss\n",
+			rowcolumns, store->ncolumns, store->name);
+
+		//Write message to screen
+		printf("Error! Row of %d values for the %d columns of Series Store:  %s.tss\n",
+			rowcolumns, store->ncolumns, store->name);
+		exit(EXIT_FAILURE);	//abort
+
+	}	//end if ncolumns == 0
+
+	//store the time of the row
+	store->times[store->nrows] = simtime;
+
+	//loop over columns
+	for(column=0; column<store->ncolumns; column++)
+	{
+		//store the value in its column
+		store->values[(size_t)column*store->blockrows + store->nrows] = rowvalues[column];
+
+	}	//end loop over columns
+
+	//one more row is buffered
+	store->nrows = store->nrows + 1;
+
+	//if the block is full
+	if(store->nrows == store->blockrows)
+	{
+		//write the block to the store file
+		WriteSeriesBlock(store);
+	}
+
+//end of function EndSeriesRow
+}
+
+//C
+//C
+			/*****************************************/
+			/*       FUNCTION: CloseSeriesStore      */
+			/*****************************************/
+
+/* Writes the buffered rows and the time index of each series store and
+   frees the stores (called at the end of the run and by FreeMemory) */
+
+void CloseSeriesStore()
+{
+	//local variable declarations
+	FILE *store_fp;		//store file pointer
+
+	char storefile[MAXNAMESIZE+8];	//store file name
+
+	int n;				//store index
+
+	seriesstore *store;	//series store
+
+	//loop over series stores
+	for(n=0; n<nseriesstores; n++)
+	{
+		//set the store
+		store = &seriesstores[n];
+
+		//write the buffered rows
+		WriteSeriesBlock(store);
+
+		//if blocks were written
+		if(store->nblocks > 0)
+		{
+			//set the store file name
+			sprintf(storefile, "%s.tss", store->name);
+
+			//open the store file for appending
+			store_fp = OpenOutputFile(storefile, "ab");
+
+			//if the store file was opened
+			if(store_fp != NULL)
+			{
+				//write the time index and its offset
+				fwrite(SERIESINDEXID, sizeof(char), strlen(SERIESINDEXID), store_fp);
+				fwrite(&store->nblocks, sizeof(int), 1, store_fp);
+				fwrite(store->blocks, sizeof(seriesblock), store->nblocks, store_fp);
+				fwrite(&store->size, sizeof(long long), 1, store_fp);
+				fwrite(SERIESID, sizeof(char), strlen(SERIESID), store_fp);
+
+				//Close store file
+				fclose(store_fp);
+
+			}	//end if store_fp != NULL
+
+		}	//end if nblocks > 0
+
+		//free the store
+		free(store->header);
+		free(store->formats);
+		free(store->times);
+		free(store->values);
+		free(store->blocks);
+
+	}	//end loop over series stores
+
+	//free the stores and the row buffer
+	free(seriesstores);
+	free(rowvalues);
+	free(rowformats);
+
+	//there are no stores
+	seriesstores = NULL;
+	nseriesstores = 0;
+	seriesrow = NULL;
+	rowvalues = NULL;
+	rowformats = NULL;
+	rowcolumns = 0;
+	rowsize = 0;
+
+//end of function CloseSeriesStore
+}
@@ -0,0 +1,299 @@
+/*----------------------------------------------------------------------
+C-  File:       SoilParameters.c
+C-
+C-  Purpose/    Concatenated group of functions for the materialized
+C-  Methods:    (per cell) parameters of the surface soil layer.
+C-
+C-              The overland kernels only use the parameters of the
+C-              surface layer of the soil stack.  Instead of looking
+C-              up soiltype[row][col][nstackov[row][col]] and then the
+C-              soil parameter tables for every cell at every time
+C-              step, the parameters of the surface layer are copied
+C-              into grids (one contiguous row per grid row):
+C-
+C-                khsoilov, capmdsoilov, soilmdov   (infopt > 0)
+C-                  used by Infiltration (Green-Ampt) and
+C-                  OverlandChemicalPartitioning
+C-                vcsoilov, kuslesoilov   (ksim > 1, ersovopt <= 2)
+C-                  used by OverlandSolidsTransportCapacity
+C-                porositysoilov   (ksim > 1)
+C-                  used by OverlandChemicalPartitioning
+C-
+C-              capmdsoilov holds the Green-Ampt product capshsoil *
+C-              soilmd (rounded to float as the kernel computed it).
+C-
+C-              The grids are set for all cells at initialization and
+C-              whenever the soil types or soil parameters change
+C-              (restart files, TrexSetParameter, kernel snapshots),
+C-              and for one cell whenever its surface layer changes
+C-              (PushSoilStack, PopSoilStack).
+C-
+C-  Function
+C-   Listing:   InitializeSoilParameters, UpdateSoilParameters,
+C-              UpdateSoilCell, FreeSoilParameters (and grid
+C-              allocation helpers)
+C-
+C-  Inputs:     soiltype[][][], nstackov[][], khsoil[], capshsoil[],
+C-              soilmd[], vcov[], kusle[], porosityov[]
+C-
+C-  Outputs:    khsoilov[][], capmdsoilov[][], soilmdov[][],
+C-              vcsoilov[][], kuslesoilov[][], porositysoilov[][]
+C-
+C-  Controls:   ksim, infopt, ersovopt
+C-
+C-  Calls:      None
+C-
+C-  Called by:  Initialize, ReadRestart, PushSoilStack, PopSoilStack,
+C-              TrexSetParameter, LoadKernelSnapshot,
+C-              RestoreResetState, FreeMemory
+C-
+C-  Created:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revised:
+C-
+C-  Date:
+C-
+C-  Revisions:
+C-
+C----------------------------------------------------------------------*/
+
+//trex general variable declarations
+#include "trex_general_declarations.h"
+
+//trex global variable declarations for water transport
+#include "trex_water_declarations.h"
+
+//trex global variable declarations for sediment transport
+#include "trex_solids_declarations.h"
+
+//C
+//C
+			/*******************************************/
+			/*     FUNCTION: AllocateSoilGrid          */
+			/*******************************************/
+
+/* Allocates a zeroed soil parameter grid [row][col] */
+
+static float **AllocateSoilGrid(void)
+{
+	//local variable declarations
+	int
+		row;		//row index
+
+	float
+		**grid;		//soil parameter grid
+
+	//Allocate memory for the row pointers
+	grid = (float **)malloc((nrows+1) * sizeof(float *));
+
+	//loop over rows
+	for(row=1; row<=nrows; row++)
+	{
+		//Allocate memory for the row (columns 1 to ncols are contiguous)
+		grid[row] = (float *)calloc((ncols+1), sizeof(float));
+
+	}	//end loop over rows
+
+	//return the grid
+	return grid;
+
+//end of function AllocateSoilGrid
+}
+
+//C
+//C
+			/*******************************************/
+			/*     FUNCTION: FreeSoilGrid              */
+			/*******************************************/
+
+/* Frees a soil parameter grid [row][col] */
+
+static void FreeSoilGrid(float **grid)
+{
+	//local variable declarations
+	int
+		row;		//row index
+
+	//loop over rows
+	for(row=1; row<=nrows; row++)
+	{
+		//Free memory for the row
+		free(grid[row]);
+
+	}	//end loop over rows
+
+	//Free memory for the row pointers
+	free(grid);
+
+//end of function FreeSoilGrid
+}
+
+//C
+//C
+			/*******************************************/
+			/*   FUNCTION: InitializeSoilParameters    */
+			/*******************************************/
+
+/* Allocates and sets the surface soil parameters of all cells */
+
+void InitializeSoilParameters()
+{
+	//if infiltration is simulated
+	if(infopt > 0)
+	{
+		//Allocate memory for the infiltration parameters
+		khsoilov = AllocateSoilGrid();		//hydraulic conductivity (m/s)
+		capmdsoilov = AllocateSoilGrid();	//capillary suction head * moisture deficit (m)
+		soilmdov = AllocateSoilGrid();		//moisture deficit (dimensionless)
+
+	}	//end if infopt > 0
+
+	//if solids are simulated
+	if(ksim > 1)
+	{
+		//if the overland erosion option <= 2 (transport capacity)
+		if(ersovopt <= 2)
+		{
+			//Allocate memory for the transport capacity parameters
+			vcsoilov = AllocateSoilGrid();		//critical velocity for erosion (m/s)
+			kuslesoilov = AllocateSoilGrid();	//USLE K factor
+
+		}	//end if ersovopt <= 2
+
+		//Allocate memory for the soil porosity (dimensionless)
+		porositysoilov = AllocateSoilGrid();
+
+	}	//end if ksim > 1
+
+	//Set the parameters of all cells
+	UpdateSoilParameters();
+
+//End of function: Return to Initialize
+}
+
+//C
+//C
+			/*******************************************/
+			/*     FUNCTION: UpdateSoilParameters      */
+			/*******************************************/
+
+/* Sets the surface soil parameters of all cells */
+
+void UpdateSoilParameters()
+{
+	//local variable declarations
+	int
+		row,		//row index
+		col;		//column index
+
+	//loop over rows
+	for(row=1; row<=nrows; row++)
+	{
+		//loop over columns
+		for(col=1; col<=ncols; col++)
+		{
+			//if the cell is in the domain (is not null)
+			if(imask[row][col] != nodatavalue)
+			{
+				//Set the parameters of the cell
+				UpdateSoilCell(row, col);
+
+			}	//end if imask[][] != nodatavalue
+
+		}	//end loop over columns
+
+	}	//end loop over rows
+
+//End of function: Return to calling module
+}
+
+//C
+//C
+			/*******************************************/
+			/*        FUNCTION: UpdateSoilCell         */
+			/*******************************************/
+
+/* Sets the surface soil parameters of one cell */
+
+void UpdateSoilCell(int row, int col)
+{
+	//local variable declarations
+	int
+		isoil;		//soil type of the surface layer
+
+	//Note:  nstackov[][] always = 1 when ksim = 1...
+	//
+	//set the soil type of the surface layer
+	isoil = soiltype[row][col][nstackov[row][col]];
+
+	//if infiltration is simulated
+	if(infopt > 0)
+	{
+		//Green-Ampt parameters
+		khsoilov[row][col] = khsoil[isoil];
+		capmdsoilov[row][col] = capshsoil[isoil] * soilmd[isoil];
+		soilmdov[row][col] = soilmd[isoil];
+
+	}	//end if infopt > 0
+
+	//if solids are simulated
+	if(ksim > 1)
+	{
+		//if the overland erosion option <= 2 (transport capacity)
+		if(ersovopt <= 2)
+		{
+			//critical velocity for erosion and USLE K factor
+			vcsoilov[row][col] = vcov[isoil];
+			kuslesoilov[row][col] = kusle[isoil];
+
+		}	//end if ersovopt <= 2
+
+		//soil porosity
+		porositysoilov[row][col] = porosityov[isoil];
+
+	}	//end if ksim > 1
+
+//End of function: Return to calling module
+}
+
+//C
+//C
+			/*******************************************/
+			/*      FUNCTION: FreeSoilParameters       */
+			/*******************************************/
+
+/* Frees memory for the surface soil parameters */
+
+void FreeSoilParameters()
+{
+	//if infiltration is simulated
+	if(infopt > 0)
+	{
+		//Free memory for the infiltration parameters
+		FreeSoilGrid(khsoilov);
+		FreeSoilGrid(capmdsoilov);
+		FreeSoilGrid(soilmdov);
+
+	}	//end if infopt > 0
+
+	//if solids are simulated
+	if(ksim > 1)
+	{
+		//if the overland erosion option <= 2 (transport capacity)
+		if(ersovopt <= 2)
+		{
+			//Free memory for the transport capacity parameters
+			FreeSoilGrid(vcsoilov);
+			FreeSoilGrid(kuslesoilov);
+
+		}	//end if ersovopt <= 2
+
+		//Free memory for the soil porosity
+		FreeSoilGrid(porositysoilov);
+
+	}	//end if ksim > 1
+
+//End of function: Return to FreeMemory
+}
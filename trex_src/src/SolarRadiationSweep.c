@@ -0,0 +1,107 @@
+/*----------------------------------------------------------------------
+C-  Function:   SolarRadiationSweep.c
+C-
+C-  Purpose/    Computes the solar radiation reaching the land surface
+C-  Methods:    for a range of cells (first to last) of the compact
+C-              list of domain cells (solarcellrow, solarcellcol).
+C-
+C-              The terrain terms of each cell (slopecos, slopesinx,
+C-              slopesiny, solarview) are computed once by
+C-              InitializeEnvironment.  The sun terms (suncosz, sunx,
+C-              suny, sundirect, sundiffuse) are computed for each
+C-              update by ComputeSolarRadiation.  The cosine of the
+C-              incidence angle of a cell is a linear combination of
+C-              the terrain terms and the sun terms over contiguous
+C-              arrays (no library calls), so the first loop can be
+C-              vectorized by the compiler.
+C-
+C-              A sweep only reads the terrain terms, the sun terms,
+C-              and cloud cover, and only writes the incidence angle
+C-              and solar radiation of its own cells, so ranges of
+C-              cells can be computed as separate tasks and alongside
+C-              other work that does not read solarrad.
+C-
+C-  Inputs:     first, last (range of cells), slopecos[], slopesinx[],
+C-              slopesiny[], solarview[], cloudcover[][]
+C-
+C-  Outputs:    solarcosi[], solarrad[][]
+C-
+C-  Controls:   None
+C-
+C-  Calls:      None
+C-
+C-  Called by:  ComputeSolarRadiation
+C-
+C-  Created:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revised:
+C-
+C-  Date:
+C-
+C-  Revisions:
+C-
+C----------------------------------------------------------------------*/
+
+//trex global variable declarations
+#include "trex_general_declarations.h"
+
+//trex global variable declarations for water transport
+#include "trex_water_declarations.h"
+
+//trex global variable declarations for environmental conditions
+#include "trex_environmental_declarations.h"
+
+void SolarRadiationSweep(int first, int last)
+{
+	//local variable declarations/definitions
+	int
+		cell,		//index of a solar radiation cell
+		row,		//row of the cell
+		col;		//column of the cell
+
+	float
+		cosi,		//cosine of solar radiation incidence angle
+		cover;		//cloud cover of the cell (fraction)
+
+	//Compute the angle between the normal to the slope and the angle
+	//  at which direct solar radiation impinges on sloping terrain...
+	//
+	//Note:  The correction is zero if the sun is below the local
+	//       horizon (the slope is in the shade, cosi < 0) or below
+	//       the global horizon (the sun terms are then zero).
+	//
+	//Loop over cells
+	for(cell=first; cell<=last; cell++)
+	{
+		//compute the cosine of the incidence angle
+		cosi = slopecos[cell] * suncosz
+			+ slopesinx[cell] * sunx + slopesiny[cell] * suny;
+
+		//if the sun is below the local horizon of the surface, reset to zero
+		solarcosi[cell] = (cosi > 0.0f) ? cosi : 0.0f;
+
+	}	//end loop over cells
+
+	//Compute solar radiation transmitted through the atmosphere and
+	//  adjust for slope and terrain slope, aspect, and solar angle...
+	//
+	//Loop over cells
+	for(cell=first; cell<=last; cell++)
+	{
+		//set the row and column of the cell
+		row = solarcellrow[cell];
+		col = solarcellcol[cell];
+
+		//set the cloud cover of the cell
+		cover = cloudcover[row][col];
+
+		//Combine direct and diffuse solar radiation and adjust for sky view (W/m2)
+		solarrad[row][col] = solarview[cell]
+			* (solarcosi[cell] * sundirect * (1.0f - cover) + sundiffuse * cover);
+
+	}	//end loop over cells
+
+//End of function: Return to ComputeSolarRadiation
+}
@@ -29,6 +29,13 @@ C-              Denver, CO 80225
 C-
 C-	Date:		17-JUL-2003
 C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Kernel snapshot hooks (CaptureKernel) around the
+C-              solids concentration modules.
+C-
 C-  Revised:  
 C-
 C----------------------------------------------------------------------*/
@@ -44,17 +51,43 @@ C----------------------------------------------------------------------*/
 
 void SolidsBalance()
 {
+	//if the kernel is captured to a snapshot file (see KernelSnapshot)
+	if(snapshotkernel == KERNELOVSOLIDS)
+	{
+		//write the kernel state before the kernel
+		CaptureKernel(0);
+	}
+
 	//Compute solids concentrations in overland plane and underlying
 	//soil layer for all cells in the domain (imask != nodatavalue).
 	OverlandSolidsConcentration();
 
+	//if the kernel is captured, write the kernel outputs after the kernel
+	if(snapshotkernel == KERNELOVSOLIDS)
+	{
+		CaptureKernel(1);
+	}
+
 	//if channels are simulated
 	if(chnopt > 0)
 	{
+		//if the kernel is captured to a snapshot file (see KernelSnapshot)
+		if(snapshotkernel == KERNELCHSOLIDS)
+		{
+			//write the kernel state before the kernel
+			CaptureKernel(0);
+		}
+
 		//Compute solids concentrations in channels and underlying
 		//surface sediment bed for all links/nodes in the domain.
 		ChannelSolidsConcentration();
 
+		//if the kernel is captured, write the kernel outputs after the kernel
+		if(snapshotkernel == KERNELCHSOLIDS)
+		{
+			CaptureKernel(1);
+		}
+
 	}	//end if chnopt > 0
 
 //End of function: Return to trex
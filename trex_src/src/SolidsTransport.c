@@ -14,7 +14,7 @@ C-
 C-  Controls:   depovopt, advovopt, dspovopt, ersovopt
 C-              depchopt, advchopt, dspchopt, erschopt
 C-
-C-  Calls:      OverlandSolidsDeposition,
+C-  Calls:      RunSpeciesTasks, OverlandSolidsDeposition,
 C-              OverlandSolidsAdvection,
 C-              OverlandSolidsDispersion,
 C-              OverlandSolidsTransportCapacity,
@@ -41,6 +41,20 @@ C-              Denver, CO 80225
 C-
 C-	Date:		10-MAR-2004
 C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Kernel snapshot hooks (CaptureKernel) around
+C-              OverlandSolidsTransportCapacity.
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Overland and channel deposition run as one task per
+C-              solids type (RunSpeciesTasks).
+C-
 C-  Revised:
 C-
 C-  Date:
@@ -70,7 +84,15 @@ void SolidsTransport()
 	if(depovopt > 0)
 	{
         //Compute effective deposition for overland plane
-		OverlandSolidsDeposition();
+		//
+		//Note:  Deposition of each solids type only writes the fluxes
+		//       of that type, so it runs as one task per solids type (on
+		//       ntaskthreads threads, see SpeciesTasks).  Advection,
+		//       dispersion, and erosion stay serial: they store the cell
+		//       flows (advinflowov, dspflowov) and the maximum shear stress
+		//       (taumaxov) shared by all solids types.
+		//
+		RunSpeciesTasks(OverlandSolidsDeposition, nsolids);
 
 	}	//end if depovopt > 0
 
@@ -101,9 +123,22 @@ void SolidsTransport()
 		//if the capacity limited erosion option is selected (K-R or generalized)
 		if(ersovopt <= 2)
 		{
+			//if the kernel is captured to a snapshot file (see KernelSnapshot)
+			if(snapshotkernel == KERNELOVTRANSCAP)
+			{
+				//write the kernel state before the kernel
+				CaptureKernel(0);
+			}
+
 			//Compute transport capacity for overland plane
 			OverlandSolidsTransportCapacity();
 
+			//if the kernel is captured, write the kernel outputs after the kernel
+			if(snapshotkernel == KERNELOVTRANSCAP)
+			{
+				CaptureKernel(1);
+			}
+
 		}	//end if ersovopt <= 2
 
 		//Compute erosion for overland plane
@@ -125,8 +160,8 @@ void SolidsTransport()
 		//if channel deposition is similated (depchopt > 0)
 		if(depchopt > 0)
 		{
-			//Compute deposition for channels
-			ChannelSolidsDeposition();
+			//Compute deposition for channels (one task per solids type)
+			RunSpeciesTasks(ChannelSolidsDeposition, nsolids);
 
 		}	//end if depchopt > 0
 
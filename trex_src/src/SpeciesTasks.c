@@ -0,0 +1,74 @@
+/*----------------------------------------------------------------------
+C-  Function:   SpeciesTasks.c
+C-
+C-  Purpose/    Runs a solids or chemical transport task for all solids
+C-  Methods:    or chemical types.  A task computes the transport of a
+C-              range of types (first to last).  The transport kernels
+C-              of one type only write the fluxes of that type, so the
+C-              types can be computed in any order and on any thread.
+C-
+C-              When ntaskthreads > 1 (and the model is built with
+C-              OpenMP), each type is one task and the tasks are shared
+C-              by ntaskthreads threads (dynamic schedule).  The OpenMP
+C-              runtime keeps its threads between calls.  The kernels
+C-              only use local (stack) variables and the loop indices
+C-              (i, j, k), which are private to each thread.  The
+C-              results are the same as a serial run.
+C-
+C-              Otherwise the task is called once for all types.
+C-
+C-  Inputs:     task, nspecies (number of solids or chemical types)
+C-
+C-  Outputs:    None
+C-
+C-  Controls:   ntaskthreads
+C-
+C-  Calls:      task
+C-
+C-  Called by:  SolidsTransport, ChemicalTransport
+C-
+C-  Created:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revised:
+C-
+C-  Date:
+C-
+C-  Revisions:
+C-
+C----------------------------------------------------------------------*/
+
+//trex general variable declarations
+#include "trex_general_declarations.h"
+
+void RunSpeciesTasks(void (*task)(int, int), int nspecies)
+{
+#ifdef _OPENMP
+	//local variable declarations
+	int
+		ispecies;	//solids or chemical type of a task
+
+	//if the tasks run on more than one thread
+	if(ntaskthreads > 1 && nspecies > 1)
+	{
+		//loop over solids or chemical types (one task per type)
+		#pragma omp parallel for schedule(dynamic, 1) num_threads(ntaskthreads)
+		for(ispecies=1; ispecies<=nspecies; ispecies++)
+		{
+			//run the task for this type
+			task(ispecies, ispecies);
+
+		}	//end loop over solids or chemical types
+
+		//the tasks are done
+		return;
+
+	}	//end if ntaskthreads > 1
+#endif
+
+	//run the task for all types
+	task(1, nspecies);
+
+//End of function: Return to calling module
+}
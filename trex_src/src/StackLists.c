@@ -0,0 +1,248 @@
+/*----------------------------------------------------------------------
+C-  File:       StackLists.c
+C-
+C-  Purpose/    Concatenated group of functions for the soil and
+C-  Methods:    sediment stack work lists and stack event log.
+C-
+C-              The concentration modules (OverlandSolidsConcentration,
+C-              ChannelSolidsConcentration) append each cell or node
+C-              whose surface layer volume crosses a stack limit to a
+C-              push (burial) or pop (unburial) list.  The stack
+C-              modules (PushSoilStack, PopSoilStack, PushSedimentStack,
+C-              PopSedimentStack) only process the listed locations.
+C-              A location is listed at most once per list in a time
+C-              step, so each list holds at most one entry for each
+C-              domain cell (or channel node).
+C-
+C-              Stack events (layer collapses) are logged by the stack
+C-              modules as they occur and written once per time step
+C-              by WriteStackEvents (one line per event appended to
+C-              the echo file and one summary line to the screen).
+C-
+C-  Function
+C-   Listing:   AllocateStackLists, LogStackEvent, WriteStackEvents,
+C-              FreeStackLists
+C-
+C-  Inputs:     imask, nnodes
+C-
+C-  Outputs:    npopov, npushov, npopch, npushch, nstackevents
+C-
+C-  Controls:   chnopt
+C-
+C-  Calls:      None
+C-
+C-  Called by:  InitializeSolids, PushSoilStack, PushSedimentStack,
+C-              NewStateStack, FreeMemorySolids
+C-
+C-  Created:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Output files are opened by OpenOutputFile.
+C-
+C-  Revised:
+C-
+C-  Date:
+C-
+C-  Revisions:
+C-
+C----------------------------------------------------------------------*/
+
+//trex general variable declarations
+#include "trex_general_declarations.h"
+
+//trex global variable declarations for water transport
+#include "trex_water_declarations.h"
+
+//trex global variable declarations for sediment transport
+#include "trex_solids_declarations.h"
+
+//C
+//C
+			/*******************************************/
+			/*      FUNCTION: AllocateStackLists       */
+			/*******************************************/
+
+/* Allocates the stack work lists and event log (sized for every location) */
+
+void AllocateStackLists()
+{
+	//local variable declarations
+	int
+		ncells,		//number of cells in the overland domain
+		nchnodes,	//number of nodes in the channel network
+		row,		//row index
+		col,		//column index
+		link;		//link index
+
+	//count the cells in the overland domain
+	ncells = 0;
+
+	//loop over rows
+	for(row=1; row<=nrows; row++)
+	{
+		//loop over columns
+		for(col=1; col<=ncols; col++)
+		{
+			//if the cell is in the domain
+			if(imask[row][col] != nodatavalue)
+			{
+				//count the cell
+				ncells = ncells + 1;
+
+			}	//end if imask[][] != nodatavalue
+
+		}	//end loop over columns
+
+	}	//end loop over rows
+
+	//Allocate memory for the overland soil stack lists (entries start at 1)
+	popovrow = (int *)malloc((ncells+1) * sizeof(int));
+	popovcol = (int *)malloc((ncells+1) * sizeof(int));
+	pushovrow = (int *)malloc((ncells+1) * sizeof(int));
+	pushovcol = (int *)malloc((ncells+1) * sizeof(int));
+
+	//count the nodes in the channel network
+	nchnodes = 0;
+
+	//if channels are simulated
+	if(chnopt > 0)
+	{
+		//loop over links
+		for(link=1; link<=nlinks; link++)
+		{
+			//count the nodes of the link
+			nchnodes = nchnodes + nnodes[link];
+
+		}	//end loop over links
+
+		//Allocate memory for the channel sediment stack lists (entries start at 1)
+		popchlink = (int *)malloc((nchnodes+1) * sizeof(int));
+		popchnode = (int *)malloc((nchnodes+1) * sizeof(int));
+		pushchlink = (int *)malloc((nchnodes+1) * sizeof(int));
+		pushchnode = (int *)malloc((nchnodes+1) * sizeof(int));
+
+	}	//end if chnopt > 0
+
+	//Allocate memory for the stack event log (at most one collapse per listed location)
+	stackeventtype = (int *)malloc((ncells+nchnodes+1) * sizeof(int));
+	stackeventa = (int *)malloc((ncells+nchnodes+1) * sizeof(int));
+	stackeventb = (int *)malloc((ncells+nchnodes+1) * sizeof(int));
+
+	//the lists and event log start empty
+	npopov = 0;
+	npushov = 0;
+	npopch = 0;
+	npushch = 0;
+	nstackevents = 0;
+
+//End of function: Return to InitializeSolids
+}
+
+//C
+//C
+			/*******************************************/
+			/*        FUNCTION: LogStackEvent          */
+			/*******************************************/
+
+/* Adds a stack event (type, row/link, column/node) to the event log */
+
+void LogStackEvent(int type, int a, int b)
+{
+	//add the event to the log
+	nstackevents = nstackevents + 1;
+	stackeventtype[nstackevents] = type;
+	stackeventa[nstackevents] = a;
+	stackeventb[nstackevents] = b;
+
+//End of function: Return to calling module
+}
+
+//C
+//C
+			/*******************************************/
+			/*       FUNCTION: WriteStackEvents        */
+			/*******************************************/
+
+/* Writes and clears the stack events logged during the time step */
+
+void WriteStackEvents()
+{
+	//local variable declarations
+	int
+		ievent;		//loop index for logged events
+
+	//open the echo file in append mode (closed during the simulation)
+	echofile_fp = OpenOutputFile(echofile, "a");
+
+	//loop over logged events
+	for(ievent=1; ievent<=nstackevents; ievent++)
+	{
+		//if the event is a soil stack collapse
+		if(stackeventtype[ievent] == 1)
+		{
+			//write the event to file
+			fprintf(echofile_fp, "Soil Stack Collapse:      row = %5d  col = %5d  time = %9.4f\n",
+				stackeventa[ievent], stackeventb[ievent], simtime);
+		}
+		else	//else the event is a sediment stack collapse
+		{
+			//write the event to file
+			fprintf(echofile_fp, "Sediment Stack Collapse:  link = %5d  node = %5d  time = %9.4f\n",
+				stackeventa[ievent], stackeventb[ievent], simtime);
+
+		}	//end if stackeventtype[] == 1
+
+	}	//end loop over logged events
+
+	//close the echo file
+	fclose(echofile_fp);
+
+	//write summary to screen
+	printf("\n  Stack collapse events = %d  time = %9.4f (see echo file)\n",
+		nstackevents, simtime);
+
+	//clear the event log
+	nstackevents = 0;
+
+//End of function: Return to NewStateStack
+}
+
+//C
+//C
+			/*******************************************/
+			/*        FUNCTION: FreeStackLists         */
+			/*******************************************/
+
+/* Frees memory for the stack work lists and event log */
+
+void FreeStackLists()
+{
+	//Free memory for the overland soil stack lists
+	free(popovrow);
+	free(popovcol);
+	free(pushovrow);
+	free(pushovcol);
+
+	//if channels are simulated
+	if(chnopt > 0)
+	{
+		//Free memory for the channel sediment stack lists
+		free(popchlink);
+		free(popchnode);
+		free(pushchlink);
+		free(pushchnode);
+
+	}	//end if chnopt > 0
+
+	//Free memory for the stack event log
+	free(stackeventtype);
+	free(stackeventa);
+	free(stackeventb);
+
+//End of function: Return to FreeMemorySolids
+}
@@ -0,0 +1,984 @@
+/*----------------------------------------------------------------------
+C-  File:       StepRecovery.c
+C-
+C-  Purpose/    Concatenated group of functions for time step rejection
+C-  Methods:    and recovery (step recovery).
+C-
+C-              When step recovery is enabled (maxrejects > 0), a
+C-              negative water depth, swe depth, solids concentration,
+C-              or chemical concentration (simulation errors 1-7) does
+C-              not abort the simulation.  The depth and concentration
+C-              modules call RejectStep instead, the remaining balance
+C-              modules of the time step are skipped, and RetryStep
+C-              restores the state saved by BeginStepRecovery and
+C-              repeats the time step with dt reduced by recoveryfactor.
+C-              After maxrejects successive rejections of the same time
+C-              step, the error is reported and handled as before (the
+C-              simulation is aborted for simulation errors 1-3).
+C-
+C-              The new state (hovnew, csedovnew, etc.) is recomputed
+C-              from the current state at each attempt, so only the
+C-              cumulative values changed during a time step are saved:
+C-              water volumes and depths, outlet flows and peaks, mass
+C-              budgets that are tracked (see InitializeMassAccounting),
+C-              pending external loads, stack list counts, shear
+C-              stress histories of cohesive solids, running minima
+C-              and maxima, and rainfall/snowfall grid counters.
+C-              Values are saved to one buffer (as double, so float and
+C-              integer values are restored exactly).
+C-
+C-              After a rejection, the reduced dt is a ceiling for the
+C-              following time steps.  The ceiling grows by
+C-              recoverygrowth after each accepted time step until it
+C-              reaches the nominal (input or maximum) time step.
+C-
+C-              For automated time steps (dtopt = 1-2), accepted time
+C-              steps are recorded by RecordTimeStep (moved here from
+C-              WaterTransport so rejected attempts are not recorded)
+C-              and the reduced time steps are written to the time step
+C-              file by WriteDTBuffer and WriteDTFile.  For time steps
+C-              read from input (dtopt = 0, 3), rejections are written
+C-              to the echo file.
+C-
+C-  Function
+C-   Listing:   BeginStepRecovery, RejectStep, RetryStep,
+C-              RecordTimeStep, EndStepRecovery, FreeStepRecovery,
+C-              WalkStepState (and value/array walkers)
+C-
+C-  Inputs:     maxrejects, recoveryfactor, recoverygrowth, dtopt,
+C-              dtmax
+C-
+C-  Outputs:    nrejects, totalrejects, rejecterrorno, rejectrow,
+C-              rejectcol, rejecttype, dtrecovery, dt[], dttime[],
+C-              ndt, bdt, idt
+C-
+C-  Controls:   ksim, chnopt, snowopt, meltopt, infopt, ctlopt,
+C-              ersovopt, erschopt, trackdspovmass, trackdspchmass
+C-
+C-  Calls:      SimulationError, TruncateDT, WriteDTBuffer
+C-
+C-  Called by:  TrexStep, OverlandWaterDepth, ChannelWaterDepth,
+C-              OverlandSolidsConcentration, ChannelSolidsConcentration,
+C-              OverlandChemicalConcentration,
+C-              ChannelChemicalConcentration, FreeMemory
+C-
+C-  Created:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Output files are opened by OpenOutputFile.
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Save and restore the shear stress histories of
+C-              cohesive solids (ersovopt, erschopt > 2) on a
+C-              rejected time step.
+C-
+C-  Revised:
+C-
+C-  Date:
+C-
+C-  Revisions:
+C-
+C----------------------------------------------------------------------*/
+
+//trex general variable declarations
+#include "trex_general_declarations.h"
+
+//trex global variable declarations for water transport
+#include "trex_water_declarations.h"
+
+//trex global variable declarations for sediment transport
+#include "trex_solids_declarations.h"
+
+//trex global variable declarations for chemical transport
+#include "trex_chemical_declarations.h"
+
+static double
+	*stepstate = NULL;	//saved state of the time step (values of all walked variables)
+
+static long
+	stepsize,			//number of values in the saved state
+	stepcursor;			//index of the next value in the saved state
+
+static int
+	stepmode,			//walk mode (0 = count values, 1 = save values, 2 = restore values)
+	stepksim;			//simulation type used to size the saved state
+
+static float
+	dtnominal;			//nominal time step of the current time step before the recovery ceiling (s)
+
+//C
+//C
+			/*******************************************/
+			/*    FUNCTIONS: StepFloat, StepDouble,    */
+			/*               StepInt                   */
+			/*******************************************/
+
+/* Counts, saves, or restores one value (according to the walk mode) */
+
+static void StepFloat(float *value)
+{
+	//if values are saved
+	if(stepmode == 1)
+	{
+		//save the value
+		stepstate[stepcursor] = *value;
+	}
+	else if(stepmode == 2)	//else if values are restored
+	{
+		//restore the value
+		*value = (float)(stepstate[stepcursor]);
+
+	}	//end if stepmode == 1
+
+	//advance to the next value
+	stepcursor = stepcursor + 1;
+}
+
+static void StepDouble(double *value)
+{
+	//if values are saved
+	if(stepmode == 1)
+	{
+		//save the value
+		stepstate[stepcursor] = *value;
+	}
+	else if(stepmode == 2)	//else if values are restored
+	{
+		//restore the value
+		*value = stepstate[stepcursor];
+
+	}	//end if stepmode == 1
+
+	//advance to the next value
+	stepcursor = stepcursor + 1;
+}
+
+static void StepInt(int *value)
+{
+	//if values are saved
+	if(stepmode == 1)
+	{
+		//save the value
+		stepstate[stepcursor] = *value;
+	}
+	else if(stepmode == 2)	//else if values are restored
+	{
+		//restore the value
+		*value = (int)(stepstate[stepcursor]);
+
+	}	//end if stepmode == 1
+
+	//advance to the next value
+	stepcursor = stepcursor + 1;
+}
+
+//C
+//C
+			/*******************************************/
+			/*   FUNCTIONS: StepVectorFloat,           */
+			/*              StepVectorDouble           */
+			/*******************************************/
+
+/* Walks elements first to last of a vector */
+
+static void StepVectorFloat(float *vector, int first, int last)
+{
+	int n;		//element index
+
+	//loop over elements
+	for(n=first; n<=last; n++)
+	{
+		//walk the element
+		StepFloat(&vector[n]);
+	}
+}
+
+static void StepVectorDouble(double *vector, int first, int last)
+{
+	int n;		//element index
+
+	//loop over elements
+	for(n=first; n<=last; n++)
+	{
+		//walk the element
+		StepDouble(&vector[n]);
+	}
+}
+
+//C
+//C
+			/*******************************************/
+			/*   FUNCTIONS: StepGridFloat,             */
+			/*              StepCellsFloat,            */
+			/*              StepCellsDouble            */
+			/*******************************************/
+
+/* Walks an overland grid [row][col] or the first n values of each */
+/* cell of an overland array [row][col][n] (domain cells only)      */
+
+static void StepGridFloat(float **grid)
+{
+	int row, col;	//row and column indices
+
+	//loop over rows
+	for(row=1; row<=nrows; row++)
+	{
+		//loop over columns
+		for(col=1; col<=ncols; col++)
+		{
+			//if the cell is in the domain
+			if(imask[row][col] != nodatavalue)
+			{
+				//walk the cell value
+				StepFloat(&grid[row][col]);
+
+			}	//end if imask[][] != nodatavalue
+
+		}	//end loop over columns
+
+	}	//end loop over rows
+}
+
+static void StepCellsFloat(float ***array, int n)
+{
+	int row, col;	//row and column indices
+
+	//loop over rows
+	for(row=1; row<=nrows; row++)
+	{
+		//loop over columns
+		for(col=1; col<=ncols; col++)
+		{
+			//if the cell is in the domain
+			if(imask[row][col] != nodatavalue)
+			{
+				//walk the values of the cell
+				StepVectorFloat(array[row][col], 0, n-1);
+
+			}	//end if imask[][] != nodatavalue
+
+		}	//end loop over columns
+
+	}	//end loop over rows
+}
+
+static void StepCellsDouble(double ***array, int n)
+{
+	int row, col;	//row and column indices
+
+	//loop over rows
+	for(row=1; row<=nrows; row++)
+	{
+		//loop over columns
+		for(col=1; col<=ncols; col++)
+		{
+			//if the cell is in the domain
+			if(imask[row][col] != nodatavalue)
+			{
+				//walk the values of the cell
+				StepVectorDouble(array[row][col], 0, n-1);
+
+			}	//end if imask[][] != nodatavalue
+
+		}	//end loop over columns
+
+	}	//end loop over rows
+}
+
+//C
+//C
+			/*******************************************/
+			/*   FUNCTIONS: StepNodesFloat,            */
+			/*              StepNodeValuesFloat,       */
+			/*              StepNodeValuesDouble       */
+			/*******************************************/
+
+/* Walks a channel array [link][node] or the first n values of each */
+/* node of a channel array [link][node][n]                          */
+
+static void StepNodesFloat(float **array)
+{
+	int link;	//link index
+
+	//loop over links
+	for(link=1; link<=nlinks; link++)
+	{
+		//walk the nodes of the link
+		StepVectorFloat(array[link], 1, nnodes[link]);
+	}
+}
+
+static void StepNodeValuesFloat(float ***array, int n)
+{
+	int link, node;	//link and node indices
+
+	//loop over links
+	for(link=1; link<=nlinks; link++)
+	{
+		//loop over nodes
+		for(node=1; node<=nnodes[link]; node++)
+		{
+			//walk the values of the node
+			StepVectorFloat(array[link][node], 0, n-1);
+		}
+	}
+}
+
+static void StepNodeValuesDouble(double ***array, int n)
+{
+	int link, node;	//link and node indices
+
+	//loop over links
+	for(link=1; link<=nlinks; link++)
+	{
+		//loop over nodes
+		for(node=1; node<=nnodes[link]; node++)
+		{
+			//walk the values of the node
+			StepVectorDouble(array[link][node], 0, n-1);
+		}
+	}
+}
+
+//C
+//C
+			/*******************************************/
+			/*        FUNCTION: WalkStepState          */
+			/*******************************************/
+
+/* Walks every value changed by the transport and balance modules */
+/* during a time step (other than the new state)                  */
+
+static void WalkStepState()
+{
+	//local variable declarations
+	int
+		isolid,		//loop index for solids type
+		ichem,		//loop index for chemical type
+		nbedov,		//number of overland layers walked for bed mass budgets
+		nbedch;		//number of channel layers walked for bed mass budgets
+
+	//start at the first value
+	stepcursor = 0;
+
+	/*****************************/
+	/*   Water (all simulations) */
+	/*****************************/
+
+	//rainfall, interception, and overland flow volumes (m3) and depths (m)
+	StepGridFloat(grossraindepth);
+	StepGridFloat(grossrainvol);
+	StepGridFloat(interceptiondepth);
+	StepGridFloat(interceptionvol);
+	StepGridFloat(netrainvol);
+	StepGridFloat(qwovvol);
+	StepCellsFloat(dqovinvol, NOVSLOTS);
+	StepCellsFloat(dqovoutvol, NOVSLOTS);
+
+	//if snowfall is simulated
+	if(snowopt > 0)
+	{
+		//snowfall depths (m) and volumes (m3) (as swe)
+		StepGridFloat(grossswedepth);
+		StepGridFloat(grossswevol);
+		StepGridFloat(netswevol);
+
+	}	//end if snowopt > 0
+
+	//if snowmelt is simulated
+	if(meltopt > 0)
+	{
+		//snowmelt depths (m) and volumes (m3) (as swe)
+		StepGridFloat(swemeltdepth);
+		StepGridFloat(swemeltvol);
+
+	}	//end if meltopt > 0
+
+	//if infiltration is simulated
+	if(infopt > 0)
+	{
+		//infiltration depths (m) and volumes (m3)
+		StepGridFloat(infiltrationdepth);
+		StepGridFloat(infiltrationvol);
+
+	}	//end if infopt > 0
+
+	//overland outlet volumes (m3) and peak flows (m3/s) and times (hours)
+	StepVectorFloat(qoutovvol, 1, noutlets);
+	StepVectorFloat(qpeakov, 1, noutlets);
+	StepVectorFloat(tpeakov, 1, noutlets);
+
+	//if channels are simulated
+	if(chnopt > 0)
+	{
+		//channel flow volumes (m3)
+		StepNodesFloat(qwchvol);
+		StepNodeValuesFloat(dqchinvol, 11);
+		StepNodeValuesFloat(dqchoutvol, 11);
+		StepVectorFloat(qinchvol, 1, nlinks);
+		StepVectorFloat(qoutchvol, 1, nlinks);
+
+		//channel outlet peak flows (m3/s) and times (hours)
+		StepVectorFloat(qpeakch, 1, noutlets);
+		StepVectorFloat(tpeakch, 1, noutlets);
+
+		//if channel transmission loss is simulated
+		if(ctlopt > 0)
+		{
+			//transmission loss depths (m) and volumes (m3)
+			StepNodesFloat(translossdepth);
+			StepNodesFloat(translossvol);
+
+		}	//end if ctlopt > 0
+
+	}	//end if chnopt > 0
+
+	//running minima and maxima of depths (m) and rainfall intensities (m/s)
+	StepDouble(&minhovdepth);
+	StepDouble(&maxhovdepth);
+	StepDouble(&minsweovdepth);
+	StepDouble(&maxsweovdepth);
+	StepDouble(&minhchdepth);
+	StepDouble(&maxhchdepth);
+	StepDouble(&minswemeltdepth);
+	StepDouble(&maxswemeltdepth);
+	StepDouble(&mininfiltdepth);
+	StepDouble(&maxinfiltdepth);
+	StepDouble(&mintranslossdepth);
+	StepDouble(&maxtranslossdepth);
+	StepDouble(&minrainintensity);
+	StepDouble(&maxrainintensity);
+
+	//rainfall and snowfall grid read times and counts (grids are read again)
+	StepFloat(&timeraingrid);
+	StepInt(&raingridcount);
+	StepFloat(&timesnowgrid);
+	StepInt(&snowgridcount);
+
+	//if sediment transport is simulated
+	if(ksim > 1)
+	{
+		/*****************************/
+		/*   Solids                  */
+		/*****************************/
+
+		//set the number of bed layers walked (layer 0 is the water column)
+		nbedov = maxstackov + 1;
+		nbedch = maxstackch + 1;
+
+		//loop over number of solids
+		for(isolid=1; isolid<=nsolids; isolid++)
+		{
+			//overland advection mass budgets (kg)
+			StepCellsDouble(advsedovinmass[isolid], NOVSLOTS);
+			StepCellsDouble(advsedovoutmass[isolid], NOVSLOTS);
+
+			//if overland dispersion budgets are tracked
+			if(trackdspovmass > 0)
+			{
+				//overland dispersion mass budgets (kg)
+				StepCellsDouble(dspsedovinmass[isolid], NOVSLOTS);
+				StepCellsDouble(dspsedovoutmass[isolid], NOVSLOTS);
+
+			}	//end if trackdspovmass > 0
+
+			//overland deposition and erosion mass budgets (kg)
+			StepCellsDouble(depsedovinmass[isolid], nbedov);
+			StepCellsDouble(depsedovoutmass[isolid], nbedov);
+			StepCellsDouble(erssedovinmass[isolid], nbedov);
+			StepCellsDouble(erssedovoutmass[isolid], nbedov);
+
+			//overland outlet mass budgets (kg)
+			StepVectorDouble(totaladvsedinov[isolid], 0, noutlets);
+			StepVectorDouble(totaladvsedoutov[isolid], 0, noutlets);
+			StepVectorDouble(totaldspsedinov[isolid], 0, noutlets);
+			StepVectorDouble(totaldspsedoutov[isolid], 0, noutlets);
+
+			//if channels are simulated
+			if(chnopt > 0)
+			{
+				//channel advection mass budgets (kg)
+				StepNodeValuesDouble(advsedchinmass[isolid], 11);
+				StepNodeValuesDouble(advsedchoutmass[isolid], 11);
+
+				//if channel dispersion budgets are tracked
+				if(trackdspchmass > 0)
+				{
+					//channel dispersion mass budgets (kg)
+					StepNodeValuesDouble(dspsedchinmass[isolid], 11);
+					StepNodeValuesDouble(dspsedchoutmass[isolid], 11);
+
+				}	//end if trackdspchmass > 0
+
+				//channel deposition and erosion mass budgets (kg)
+				StepNodeValuesDouble(depsedchinmass[isolid], nbedch);
+				StepNodeValuesDouble(depsedchoutmass[isolid], nbedch);
+				StepNodeValuesDouble(erssedchinmass[isolid], nbedch);
+				StepNodeValuesDouble(erssedchoutmass[isolid], nbedch);
+
+				//channel outlet mass budgets (kg)
+				StepVectorDouble(totaladvsedinch[isolid], 0, noutlets);
+				StepVectorDouble(totaladvsedoutch[isolid], 0, noutlets);
+				StepVectorDouble(totaldspsedinch[isolid], 0, noutlets);
+				StepVectorDouble(totaldspsedoutch[isolid], 0, noutlets);
+
+			}	//end if chnopt > 0
+
+		}	//end loop over solids
+
+		//pending (per-step) external solids loads (kg)
+		StepVectorDouble(pendingswov, 1, nsolids);
+
+		//if channels are simulated
+		if(chnopt > 0)
+		{
+			//pending (per-step) external channel solids loads (kg)
+			StepVectorDouble(pendingswch, 1, nsolids);
+
+		}	//end if chnopt > 0
+
+		//soil and sediment stack list counts
+		StepInt(&npopov);
+		StepInt(&npushov);
+		StepInt(&npopch);
+		StepInt(&npushch);
+
+		//Note:  Erosion is computed before the concentrations
+		//       that can reject the time step, so the shear
+		//       stress histories of cohesive solids must be
+		//       restored with the rest of the state.
+		//
+		//if the overland erosion option > 2
+		if(ersovopt > 2)
+		{
+			//overland shear stress histories (N/m2, hours)
+			StepGridFloat(taumaxov);
+			StepGridFloat(taumaxtimeov);
+
+		}	//end if ersovopt > 2
+
+		//if channels are simulated and the channel erosion option > 2
+		if(chnopt > 0 && erschopt > 2)
+		{
+			//channel shear stress histories (N/m2, hours)
+			StepNodesFloat(taumaxch);
+			StepNodesFloat(taumaxtimech);
+
+		}	//end if chnopt > 0 and erschopt > 2
+
+		//if chemical transport is simulated
+		if(ksim > 2)
+		{
+			/*****************************/
+			/*   Chemicals               */
+			/*****************************/
+
+			//loop over number of chemicals
+			for(ichem=1; ichem<=nchems; ichem++)
+			{
+				//overland advection mass budgets (kg)
+				StepCellsDouble(advchemovinmass[ichem], NOVSLOTS);
+				StepCellsDouble(advchemovoutmass[ichem], NOVSLOTS);
+
+				//if overland dispersion budgets are tracked
+				if(trackdspovmass > 0)
+				{
+					//overland dispersion mass budgets (kg)
+					StepCellsDouble(dspchemovinmass[ichem], NOVSLOTS);
+					StepCellsDouble(dspchemovoutmass[ichem], NOVSLOTS);
+
+				}	//end if trackdspovmass > 0
+
+				//overland bed exchange and transformation mass budgets (kg)
+				StepCellsDouble(depchemovinmass[ichem], nbedov);
+				StepCellsDouble(depchemovoutmass[ichem], nbedov);
+				StepCellsDouble(erschemovinmass[ichem], nbedov);
+				StepCellsDouble(erschemovoutmass[ichem], nbedov);
+				StepCellsDouble(pwrchemovinmass[ichem], nbedov);
+				StepCellsDouble(pwrchemovoutmass[ichem], nbedov);
+				StepCellsDouble(infchemovinmass[ichem], nbedov);
+				StepCellsDouble(biochemovinmass[ichem], nbedov);
+				StepCellsDouble(biochemovoutmass[ichem], nbedov);
+				StepCellsDouble(hydchemovinmass[ichem], nbedov);
+				StepCellsDouble(hydchemovoutmass[ichem], nbedov);
+				StepCellsDouble(oxichemovinmass[ichem], nbedov);
+				StepCellsDouble(oxichemovoutmass[ichem], nbedov);
+				StepCellsDouble(phtchemovinmass[ichem], nbedov);
+				StepCellsDouble(phtchemovoutmass[ichem], nbedov);
+				StepCellsDouble(radchemovinmass[ichem], nbedov);
+				StepCellsDouble(radchemovoutmass[ichem], nbedov);
+				StepCellsDouble(vltchemovinmass[ichem], nbedov);
+				StepCellsDouble(vltchemovoutmass[ichem], nbedov);
+				StepCellsDouble(udrchemovinmass[ichem], nbedov);
+				StepCellsDouble(udrchemovoutmass[ichem], nbedov);
+
+				//overland infiltration out of the surface layer is always tracked (kg)
+				StepCellsDouble(infchemovoutmass[ichem], maxstackov+1);
+
+				//overland outlet mass budgets (kg)
+				StepVectorDouble(totaladvcheminov[ichem], 0, noutlets);
+				StepVectorDouble(totaladvchemoutov[ichem], 0, noutlets);
+				StepVectorDouble(totaldspcheminov[ichem], 0, noutlets);
+				StepVectorDouble(totaldspchemoutov[ichem], 0, noutlets);
+
+				//if channels are simulated
+				if(chnopt > 0)
+				{
+					//channel advection mass budgets (kg)
+					StepNodeValuesDouble(advchemchinmass[ichem], 11);
+					StepNodeValuesDouble(advchemchoutmass[ichem], 11);
+
+					//if channel dispersion budgets are tracked
+					if(trackdspchmass > 0)
+					{
+						//channel dispersion mass budgets (kg)
+						StepNodeValuesDouble(dspchemchinmass[ichem], 11);
+						StepNodeValuesDouble(dspchemchoutmass[ichem], 11);
+
+					}	//end if trackdspchmass > 0
+
+					//channel bed exchange and transformation mass budgets (kg)
+					StepNodeValuesDouble(depchemchinmass[ichem], nbedch);
+					StepNodeValuesDouble(depchemchoutmass[ichem], nbedch);
+					StepNodeValuesDouble(erschemchinmass[ichem], nbedch);
+					StepNodeValuesDouble(erschemchoutmass[ichem], nbedch);
+					StepNodeValuesDouble(pwrchemchinmass[ichem], nbedch);
+					StepNodeValuesDouble(pwrchemchoutmass[ichem], nbedch);
+					StepNodeValuesDouble(infchemchinmass[ichem], nbedch);
+					StepNodeValuesDouble(biochemchinmass[ichem], nbedch);
+					StepNodeValuesDouble(biochemchoutmass[ichem], nbedch);
+					StepNodeValuesDouble(hydchemchinmass[ichem], nbedch);
+					StepNodeValuesDouble(hydchemchoutmass[ichem], nbedch);
+					StepNodeValuesDouble(oxichemchinmass[ichem], nbedch);
+					StepNodeValuesDouble(oxichemchoutmass[ichem], nbedch);
+					StepNodeValuesDouble(phtchemchinmass[ichem], nbedch);
+					StepNodeValuesDouble(phtchemchoutmass[ichem], nbedch);
+					StepNodeValuesDouble(radchemchinmass[ichem], nbedch);
+					StepNodeValuesDouble(radchemchoutmass[ichem], nbedch);
+					StepNodeValuesDouble(vltchemchinmass[ichem], nbedch);
+					StepNodeValuesDouble(vltchemchoutmass[ichem], nbedch);
+					StepNodeValuesDouble(udrchemchinmass[ichem], nbedch);
+					StepNodeValuesDouble(udrchemchoutmass[ichem], nbedch);
+
+					//channel infiltration out of the surface layer is always tracked (kg)
+					StepNodeValuesDouble(infchemchoutmass[ichem], maxstackch+1);
+
+					//channel outlet mass budgets (kg)
+					StepVectorDouble(totaladvcheminch[ichem], 0, noutlets);
+					StepVectorDouble(totaladvchemoutch[ichem], 0, noutlets);
+					StepVectorDouble(totaldspcheminch[ichem], 0, noutlets);
+					StepVectorDouble(totaldspchemoutch[ichem], 0, noutlets);
+
+				}	//end if chnopt > 0
+
+			}	//end loop over chemicals
+
+			//pending (per-step) external chemical loads (kg)
+			StepVectorDouble(pendingcwov, 1, nchems);
+
+			//running minima and maxima of water column concentrations (g/m3)
+			StepVectorDouble(mincchemov0, 1, nchems);
+			StepVectorDouble(maxcchemov0, 1, nchems);
+
+			//if channels are simulated
+			if(chnopt > 0)
+			{
+				//pending (per-step) external channel chemical loads (kg)
+				StepVectorDouble(pendingcwch, 1, nchems);
+
+				//running minima and maxima of channel water column concentrations (g/m3)
+				StepVectorDouble(mincchemch0, 1, nchems);
+				StepVectorDouble(maxcchemch0, 1, nchems);
+
+			}	//end if chnopt > 0
+
+		}	//end if ksim > 2
+
+	}	//end if ksim > 1
+
+//End of function: Return to BeginStepRecovery or RetryStep
+}
+
+//C
+//C
+			/*******************************************/
+			/*      FUNCTION: BeginStepRecovery        */
+			/*******************************************/
+
+/* Saves the state changed by a time step and applies the time step ceiling */
+
+void BeginStepRecovery()
+{
+	//if the saved state is not allocated or the simulation type changed (relaunch)
+	if(stepstate == NULL || stepksim != ksim)
+	{
+		//free any saved state sized for another simulation type
+		free(stepstate);
+
+		//count the values of the saved state
+		stepmode = 0;
+		WalkStepState();
+		stepsize = stepcursor;
+
+		//Allocate memory for the saved state (at least one value)
+		stepstate = (double *)malloc((stepsize + 1) * sizeof(double));
+
+		//store the simulation type used to size the saved state
+		stepksim = ksim;
+
+	}	//end if stepstate == NULL
+
+	//the time step has not been rejected
+	nrejects = 0;
+	rejecterrorno = 0;
+
+	//store the nominal time step (s)
+	dtnominal = dt[idt];
+
+	//if a time step ceiling is set and the nominal time step exceeds it
+	if(dtrecovery > 0.0 && dt[idt] > dtrecovery)
+	{
+		//set the time step to the ceiling (s)
+		dt[idt] = dtrecovery;
+
+		//if automated time-stepping is selected (dtopt = 1 or dtopt = 2)
+		if(dtopt == 1 || dtopt == 2)
+		{
+			//truncate the time step as other automated time steps
+			TruncateDT();
+
+		}	//end if dtopt = 1 or 2
+
+	}	//end if dtrecovery > 0.0
+
+	//save the state changed by the time step
+	stepmode = 1;
+	WalkStepState();
+
+//End of function: Return to TrexStep
+}
+
+//C
+//C
+			/*******************************************/
+			/*          FUNCTION: RejectStep           */
+			/*******************************************/
+
+/* Rejects the time step for a negative depth or concentration   */
+/* (returns 1 if the step is rejected or 0 if it cannot be, then */
+/* the caller reports the error as before)                       */
+
+int RejectStep(int simerrorno, int ierr, int jerr, int itype)
+{
+	//if step recovery is off or the time step cannot be reduced again
+	if(maxrejects == 0 || nrejects >= maxrejects)
+	{
+		//the time step cannot be rejected
+		return 0;
+	}
+
+	//if this is the first violation of the attempt
+	if(rejecterrorno == 0)
+	{
+		//store the violation (reported when the step is repeated)
+		rejecterrorno = simerrorno;
+		rejectrow = ierr;
+		rejectcol = jerr;
+		rejecttype = itype;
+
+	}	//end if rejecterrorno == 0
+
+	//the time step is rejected
+	return 1;
+
+//End of function: Return to calling module
+}
+
+//C
+//C
+			/*******************************************/
+			/*           FUNCTION: RetryStep           */
+			/*******************************************/
+
+/* Restores the saved state and reduces the time step of a rejected step */
+
+void RetryStep()
+{
+	//local variable declarations
+	float
+		dtrejected;		//time step of the rejected attempt (s)
+
+	//restore the state changed by the rejected attempt
+	stepmode = 2;
+	WalkStepState();
+
+	//store the rejected time step (s)
+	dtrejected = dt[idt];
+
+	//reduce the time step (s)
+	dt[idt] = (float)(dt[idt] * recoveryfactor);
+
+	//if automated time-stepping is selected (dtopt = 1 or dtopt = 2)
+	if(dtopt == 1 || dtopt == 2)
+	{
+		//truncate the time step as other automated time steps
+		TruncateDT();
+
+	}	//end if dtopt = 1 or 2
+
+	//the reduced time step is the ceiling for following time steps (s)
+	dtrecovery = dt[idt];
+
+	//count the rejection
+	nrejects = nrejects + 1;
+	totalrejects = totalrejects + 1;
+
+	//open the echo file in append mode (closed during the simulation)
+	echofile_fp = OpenOutputFile(echofile, "a");
+
+	//write the rejection to file
+	fprintf(echofile_fp, "Time Step Rejected:  error = %2d  row/link = %5d  col/node = %5d  type = %3d  time = %9.4f  dt = %g -> %g\n",
+		rejecterrorno, rejectrow, rejectcol, rejecttype, simtime, dtrejected, dt[idt]);
+
+	//close the echo file
+	fclose(echofile_fp);
+
+	//write the rejection to screen
+	printf("\n  Time step rejected (error %d)  time = %9.4f  dt = %g -> %g (see echo file)\n",
+		rejecterrorno, simtime, dtrejected, dt[idt]);
+
+	//the repeated attempt has no violation yet
+	rejecterrorno = 0;
+
+//End of function: Return to TrexStep
+}
+
+//C
+//C
+			/*******************************************/
+			/*        FUNCTION: RecordTimeStep         */
+			/*******************************************/
+
+/* Records an accepted automated time step in the time step series */
+
+void RecordTimeStep()
+{
+	//if present time step value differs from prior value
+	if(dt[idt] != dt[idt-1])
+	{
+		//Set time for saved time step...
+		//
+		//Developer's Note:  Further development may be needed to address loss
+		//                   of precision because dttime is float and simtime
+		//                   is double.
+		//
+		//Note:  Values for dttime value are stored in the [idt-1]
+		//       element of the array because they indicate the end
+		//       time for use of the prior dt value in the series.
+		//
+		//set time for successful time step (hrs)
+		dttime[idt-1] = (float)(simtime);
+
+		//increment total number of time steps in series
+		ndt = ndt + 1;
+
+		//increment timestep buffer index
+		bdt = bdt + 1;
+
+		//Note:  MAXBUFFER controls the size of the array used to
+		//       store dt[] and dttime[] value pairs.  When all
+		//       array elements are full, the buffer is written
+		//       to file and cleared to store any further values.
+		//
+		//if buffer for stored time step values is full
+		if(bdt == MAXBUFFERSIZE)
+		{
+			//write time step series (dt, dttime pairs) to buffer file
+			WriteDTBuffer();
+
+			//reset buffer counter (bdt) to zero (flush the buffer)
+			bdt = 0;
+
+			//move dt to the start of the array...
+			//
+			//Note:  The time step is used to advance the simulation
+			//       time.  Because idt will equal zero, the value of
+			//       dt stored in the MAXBUFFER array element must be
+			//       moved to the zeroeth array element.
+			//
+			//store dt to the head of the array, dt[1]
+			dt[0] = dt[idt];
+
+			//reset the count of timesteps
+			idt = 0;
+
+		}	//end if bdt = maxbuffersize
+
+	}	//end if dt[idt] not equal to dt[idt-1]
+
+//End of function: Return to TrexStep
+}
+
+//C
+//C
+			/*******************************************/
+			/*        FUNCTION: EndStepRecovery        */
+			/*******************************************/
+
+/* Grows the time step ceiling after an accepted time step */
+
+void EndStepRecovery()
+{
+	//if a time step ceiling is set
+	if(dtrecovery > 0.0)
+	{
+		//grow the ceiling (s)
+		dtrecovery = (float)(dtrecovery * recoverygrowth);
+
+		//if the ceiling reached the nominal time step
+		if(dtrecovery >= dtnominal)
+		{
+			//remove the ceiling
+			dtrecovery = 0.0;
+
+		}	//end if dtrecovery >= dtnominal
+
+	}	//end if dtrecovery > 0.0
+
+	//if time steps are specified (dtopt = 0 or dtopt = 3)
+	if(dtopt == 0 || dtopt == 3)
+	{
+		//restore the input time step for following time steps (s)
+		dt[idt] = dtnominal;
+
+	}	//end if dtopt = 0 or 3
+
+//End of function: Return to TrexStep
+}
+
+//C
+//C
+			/*******************************************/
+			/*       FUNCTION: FreeStepRecovery        */
+			/*******************************************/
+
+/* Frees memory for the saved time step state */
+
+void FreeStepRecovery()
+{
+	//Free memory for the saved state
+	free(stepstate);
+
+	//the saved state is not allocated
+	stepstate = NULL;
+
+//End of function: Return to FreeMemory
+}
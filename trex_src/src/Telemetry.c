@@ -0,0 +1,398 @@
+/*----------------------------------------------------------------------
+C-  File:       Telemetry.c
+C-
+C-  Purpose/    Concatenated group of functions for live run
+C-  Methods:    telemetry.
+C-
+C-              When telemetry is selected (telemetryopt = 1, see
+C-              TrexSetTelemetry and the -telemetry option of trex),
+C-              the run status is published in a POSIX shared memory
+C-              segment named /trex.<pid> (TREXTELEMETRYPREFIX and
+C-              the process id, see TrexTelemetry in trex_library.h).
+C-              Another process (trexstat) attaches to the segment
+C-              to print or stream the status of a running simulation
+C-              without reading the output files.
+C-
+C-              UpdateTelemetry is called after each time step.  It
+C-              copies the simulation time, time step, courant
+C-              numbers, step counts, phase times, and the water mass
+C-              balance error of the last report (ReportMassBalance)
+C-              into the segment.  The rate (time steps per second)
+C-              and the memory use are sampled at most once per wall
+C-              clock second.  An update only writes scalars into
+C-              memory (no system call except the clock), so the cost
+C-              per time step is negligible.
+C-
+C-              The writer increments the sequence count before and
+C-              after each update.  A reader copies the segment and
+C-              uses the copy when the count was even and did not
+C-              change over the copy.
+C-
+C-              A segment that cannot be created is reported to the
+C-              screen and the simulation continues without telemetry.
+C-              Telemetry is not available on Windows (the functions
+C-              do nothing).
+C-
+C-  Function
+C-   Listing:   StartTelemetry, UpdateTelemetry, StopTelemetry,
+C-              TelemetryWallClock, TelemetryMemory
+C-
+C-  Inputs:     simtime, tstart, tend, dt[idt], totalrejects,
+C-              mbreporterror, mbreporttime, run state and courant
+C-              numbers (arguments)
+C-
+C-  Outputs:    telemetry segment (TrexTelemetry)
+C-
+C-  Controls:   telemetryopt, ksim
+C-
+C-  Calls:      TrexGetPhaseTimes
+C-
+C-  Called by:  TrexLibrary (TrexLoad, TrexStep, TrexFinalize)
+C-
+C-  Created:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revised:
+C-
+C-  Date:
+C-
+C-  Revisions:
+C-
+C----------------------------------------------------------------------*/
+
+//trex general variable declarations
+//
+//Note:  The water declarations are not included (the channel link
+//       array link conflicts with link() of unistd.h).  The courant
+//       numbers are passed by TrexStep.
+#include "trex_general_declarations.h"
+
+//trex library interface (TrexTelemetry, TrexGetPhaseTimes)
+#include "trex_library.h"
+
+#ifndef WINDOWS
+#include <sys/mman.h>		//POSIX shared memory
+#include <sys/stat.h>		//POSIX file modes
+#include <sys/resource.h>	//POSIX resource usage (peak memory)
+#include <fcntl.h>			//POSIX file control
+#include <unistd.h>			//POSIX process id and file close
+#endif
+
+static TrexTelemetry *telemetry = NULL;	//telemetry segment of this run (NULL = not published)
+static char telemetryname[64];			//name of the telemetry segment
+static double sampletime;				//wall clock time of the last rate and memory sample (seconds)
+static long samplesteps;				//accepted time steps at the last rate and memory sample
+
+//C
+//C
+			/*******************************************/
+			/*      FUNCTION: TelemetryWallClock       */
+			/*******************************************/
+
+/* Returns the wall clock time (seconds since epoch) */
+
+static double TelemetryWallClock()
+{
+	//local variable declarations
+	struct timespec now;	//current calendar time (seconds and nanoseconds)
+
+	//get the current time (C11)
+	timespec_get(&now, TIME_UTC);
+
+	//return the time in seconds
+	return (double)now.tv_sec + 1.0e-9 * (double)now.tv_nsec;
+
+//End of function: Return to caller
+}
+
+//C
+//C
+			/*******************************************/
+			/*        FUNCTION: TelemetryMemory        */
+			/*******************************************/
+
+/* Samples the current and peak resident memory of the process (kB) */
+
+static void TelemetryMemory()
+{
+#ifndef WINDOWS
+	//local variable declarations
+	FILE *statm_fp;			//process memory status file (Linux)
+	long pages,				//total program size (pages)
+		residentpages;		//resident set size (pages)
+	struct rusage usage;	//resource usage of the process
+
+	//if the resource usage is available
+	if(getrusage(RUSAGE_SELF, &usage) == 0)
+	{
+#ifdef MACOSX
+		//peak resident memory (ru_maxrss in bytes)
+		telemetry->peakmemorykb = (double)usage.ru_maxrss / 1024.0;
+#else
+		//peak resident memory (ru_maxrss in kB)
+		telemetry->peakmemorykb = (double)usage.ru_maxrss;
+#endif
+	}	//end if getrusage
+
+	//without a current value, report the peak value
+	telemetry->memorykb = telemetry->peakmemorykb;
+
+	//open the memory status of the process (Linux)
+	statm_fp = fopen("/proc/self/statm", "r");
+
+	//if the memory status is available
+	if(statm_fp != NULL)
+	{
+		//read the program size and the resident set size
+		if(fscanf(statm_fp, "%ld %ld", &pages, &residentpages) == 2)
+		{
+			//current resident memory (kB)
+			telemetry->memorykb = (double)residentpages * (double)sysconf(_SC_PAGESIZE) / 1024.0;
+		}
+
+		//close the memory status
+		fclose(statm_fp);
+
+	}	//end if statm_fp != NULL
+#endif
+
+//End of function: Return to UpdateTelemetry
+}
+
+//C
+//C
+			/*******************************************/
+			/*        FUNCTION: StartTelemetry         */
+			/*******************************************/
+
+/* Creates the telemetry segment of this run and publishes the start */
+/* of a simulation (the segment is kept over TrexReset)               */
+
+void StartTelemetry(char *inputname)
+{
+#ifndef WINDOWS
+	//local variable declarations
+	int fd;		//file descriptor of the shared memory segment
+	void *base;	//start of the mapped segment
+
+	//if telemetry is not selected
+	if(telemetryopt == 0)
+	{
+		//no telemetry
+		return;
+	}
+
+	//if the segment does not exist yet (first simulation of this process)
+	if(telemetry == NULL)
+	{
+		//build the segment name (prefix and process id)
+		sprintf(telemetryname, "%s%ld", TREXTELEMETRYPREFIX, (long)getpid());
+
+		//create the shared memory segment (readable by other users)
+		fd = shm_open(telemetryname, O_CREAT | O_RDWR, 0644);
+
+		//if the segment was created, size and map it
+		if(fd >= 0 && ftruncate(fd, sizeof(TrexTelemetry)) == 0)
+		{
+			//map the segment
+			base = mmap(NULL, sizeof(TrexTelemetry), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+			//if the segment was mapped
+			if(base != MAP_FAILED)
+			{
+				//set the telemetry pointer
+				telemetry = (TrexTelemetry *)base;
+			}
+
+		}	//end if fd >= 0
+
+		//close the descriptor (the mapping remains)
+		if(fd >= 0)
+		{
+			close(fd);
+		}
+
+		//if the segment could not be created
+		if(telemetry == NULL)
+		{
+			//write a warning to the screen (the simulation continues)
+			printf("\n  Warning: can't create telemetry segment %s (no telemetry)\n", telemetryname);
+
+			//remove a partially created segment
+			shm_unlink(telemetryname);
+
+			//no telemetry
+			return;
+
+		}	//end if telemetry == NULL
+
+		//the segment is new (all values are zero)
+		memset(telemetry, 0, sizeof(TrexTelemetry));
+
+	}	//end if telemetry == NULL
+
+	//begin the update (sequence becomes odd)
+	telemetry->sequence++;
+	__sync_synchronize();
+
+	//describe the run
+	telemetry->version = TREXTELEMETRYVERSION;
+	telemetry->pid = (int)getpid();
+	telemetry->state = TREXTELEMETRYSTARTING;
+	telemetry->ksim = ksim;
+
+	//copy the input file name (truncated to the field size)
+	strncpy(telemetry->inputfile, inputname, sizeof(telemetry->inputfile) - 1);
+	telemetry->inputfile[sizeof(telemetry->inputfile) - 1] = '\0';
+
+	//clear the status of a previous simulation (TrexReset)
+	telemetry->steps = 0;
+	telemetry->rejects = 0;
+	telemetry->stepspersecond = 0.0;
+	telemetry->mberror = 0.0;
+	telemetry->mbtime = 0.0;
+
+	//start of the simulation
+	telemetry->started = TelemetryWallClock();
+	telemetry->updated = telemetry->started;
+
+	//start the rate and memory samples
+	sampletime = telemetry->started;
+	samplesteps = 0;
+
+	//sample the memory use
+	TelemetryMemory();
+
+	//end the update (sequence becomes even)
+	__sync_synchronize();
+	telemetry->sequence++;
+#endif
+
+//End of function: Return to TrexLoad
+}
+
+//C
+//C
+			/*******************************************/
+			/*        FUNCTION: UpdateTelemetry        */
+			/*******************************************/
+
+/* Publishes the run status after a time step (step = 1) or at a */
+/* change of the run state (step = 0): running (1 = running, 0 = */
+/* no time steps remain) and the courant numbers of the last step */
+
+void UpdateTelemetry(int step, int running, float courantov, float courantch)
+{
+#ifndef WINDOWS
+	//local variable declarations
+	double now;		//wall clock time of the update (seconds since epoch)
+
+	//if no segment is published
+	if(telemetry == NULL)
+	{
+		//no telemetry
+		return;
+	}
+
+	//get the wall clock time
+	now = TelemetryWallClock();
+
+	//begin the update (sequence becomes odd)
+	telemetry->sequence++;
+	__sync_synchronize();
+
+	//if a time step was accepted
+	if(step > 0)
+	{
+		//count the time step
+		telemetry->steps++;
+	}
+
+	//the simulation is running, or finished when no time steps remain
+	telemetry->state = (running == 1) ? TREXTELEMETRYRUNNING : TREXTELEMETRYFINISHED;
+
+	//simulation time, time step, and courant numbers
+	telemetry->simtime = simtime;
+	telemetry->tstart = tstart;
+	telemetry->tend = tend;
+	telemetry->dt = dt[idt];
+	telemetry->maxcourantov = courantov;
+	telemetry->maxcourantch = courantch;
+	telemetry->rejects = totalrejects;
+
+	//wall clock time of each time step phase
+	TrexGetPhaseTimes(telemetry->phaseseconds);
+
+	//water mass balance error of the last report
+	telemetry->mberror = mbreporterror;
+	telemetry->mbtime = mbreporttime;
+
+	//if a second has passed since the last sample (or the state changed)
+	if(now - sampletime >= 1.0 || step == 0)
+	{
+		//if time has passed since the last sample
+		if(now > sampletime)
+		{
+			//time steps per second since the last sample
+			telemetry->stepspersecond = (double)(telemetry->steps - samplesteps) / (now - sampletime);
+		}
+
+		//start the next sample
+		sampletime = now;
+		samplesteps = telemetry->steps;
+
+		//sample the memory use
+		TelemetryMemory();
+
+	}	//end if now - sampletime >= 1
+
+	//time of the update
+	telemetry->updated = now;
+
+	//end the update (sequence becomes even)
+	__sync_synchronize();
+	telemetry->sequence++;
+#endif
+
+//End of function: Return to TrexStep
+}
+
+//C
+//C
+			/*******************************************/
+			/*         FUNCTION: StopTelemetry         */
+			/*******************************************/
+
+/* Publishes the end of the run and removes the telemetry segment */
+
+void StopTelemetry()
+{
+#ifndef WINDOWS
+	//if no segment is published
+	if(telemetry == NULL)
+	{
+		//no telemetry
+		return;
+	}
+
+	//end of run results were written
+	telemetry->sequence++;
+	__sync_synchronize();
+	telemetry->state = TREXTELEMETRYDONE;
+	telemetry->updated = TelemetryWallClock();
+	__sync_synchronize();
+	telemetry->sequence++;
+
+	//remove the segment name (attached readers keep their mapping)
+	shm_unlink(telemetryname);
+
+	//unmap the segment
+	munmap(telemetry, sizeof(TrexTelemetry));
+
+	//no segment is published
+	telemetry = NULL;
+#endif
+
+//End of function: Return to TrexFinalize
+}
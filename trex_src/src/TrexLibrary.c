@@ -0,0 +1,1794 @@
+/*----------------------------------------------------------------------
+C-  File:       TrexLibrary.c
+C-
+C-  Purpose/    Concatenated group of functions that form the public
+C-  Methods:    interface of the trex library (see trex_library.h).
+C-              The numerical integration loop formerly in trex.c is
+C-              split into calls a host program can make one at a
+C-              time: initialize, take a time step, run to a time,
+C-              read state grids, set calibration parameters, reset
+C-              to initial conditions, and write end of run results.
+C-              The sequence of modules called for each time step is
+C-              unchanged from trex.c.
+C-
+C-              This file also holds the definitions of all global
+C-              variables (trex_*_definitions.h) so that the library
+C-              is complete without the main module.
+C-
+C-  Function
+C-   Listing:   TrexInit, TrexStep, TrexRunUntil, TrexGetTime,
+C-              TrexGetDimensions, TrexGetField, TrexSetParameter,
+C-              TrexSetRecovery, TrexSetPowMode,
+C-              TrexSetPartitionTolerance, TrexSetThreads,
+C-              TrexSetMassBalanceTolerance,
+C-              TrexSetTelemetry, TrexSetDryRun, TrexGetMemory,
+C-              TrexSetGridSparse, TrexSetGridWindows,
+C-              TrexSetSeriesStore, TrexSetGridPack,
+C-              TrexUnpackGridFrame, TrexReset,
+C-              TrexGetPhaseTimes, TrexSetSnapshot,
+C-              TrexReplayKernel, TrexKernelName,
+C-              TrexFinalize, TrexLoad, TrexStartClock, TrexStartRun,
+C-              TrexBeginPass, TrexEndPass, TrexAdvance, TrexClock
+C-
+C-  Inputs:     inputfile, imagefile, restart and image options
+C-
+C-  Outputs:    None
+C-
+C-  Controls:   ksim, rstopt, relaunch, simtime, tend, dtopt,
+C-              timeprintout, timeprintgrid, imageopt
+C-
+C-  Calls:      ReadInputFile, Initialize, ReadRestart,
+C-              TimeFunctionInit, ComputeInitialState,
+C-              UpdateTimeFunction, UpdateEnvironment,
+C-              WaterTransport, SolidsTransport,
+C-              ChemicalTransport, WaterBalance,
+C-              SolidsBalance, ChemicalBalance,
+C-              WriteTimeSeries, WriteDumpFile,
+C-              WriteGrids, NewState, Reinitialize,
+C-              WriteDTBuffer, WriteDTFile,
+C-              WriteEndGrids, ComputeFinalState,
+C-              WriteMassBalance, WriteSummary,
+C-              FreeMemory, RunTime, WriteRestart,
+C-              CloseModelImage, AccumulateLoadTotals,
+C-              BeginStepRecovery,
+C-              RetryStep, RecordTimeStep, EndStepRecovery,
+C-              KernelSnapshotId, KernelSnapshotName,
+C-              SetKernelSnapshot, LoadKernelSnapshot,
+C-              RestoreKernelSnapshot, RunKernel,
+C-              CompareKernelSnapshot, KernelCells, PowModeId,
+C-              UpdateSoilParameters, InvalidatePartitioning,
+C-              StartMassBalanceMonitor,
+C-              StreamMassBalance, ReportMassBalance,
+C-              SetGridWindows, CloseSeriesStore, CloseGridPack,
+C-              UnpackGridFrame, SaveResetState, RestoreResetState,
+C-              FreeResetState
+C-
+C-  Called by:  trex (or any host program)
+C-
+C-  Created:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  TrexStep adds the per-step external load totals
+C-              to the cumulative (compensated) totals.
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Added TrexSetRecovery and TrexAdvance; TrexStep
+C-              rejects and repeats time steps (step recovery).
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Added TrexGetPhaseTimes and TrexClock; TrexStep and
+C-              TrexAdvance accumulate the wall clock time of each
+C-              time step phase.
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Added TrexSetSnapshot, TrexReplayKernel, and
+C-              TrexKernelName (kernel snapshots); TrexFinalize
+C-              reports a snapshot that was not captured.
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Added TrexSetPowMode.
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  TrexSetParameter sets the surface soil parameters
+C-              after a soil parameter changes.
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Added TrexSetPartitionTolerance.  Changes to soilmd
+C-              invalidate the partitioning cache.
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Added TrexSetThreads.
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Added the mass balance monitor calls
+C-              (StartMassBalanceMonitor, StreamMassBalance,
+C-              ReportMassBalance) and TrexSetMassBalanceTolerance.
+C-              The simulation stops when the water mass balance
+C-              error exceeds the tolerance.
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Added TrexSetTelemetry; TrexLoad, TrexStep, and
+C-              TrexFinalize publish the run status (StartTelemetry,
+C-              UpdateTelemetry, StopTelemetry).
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Added TrexSetDryRun and TrexGetMemory; TrexLoad
+C-              accounts the heap by subsystem and stops after the
+C-              inputs of a dry run.
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Added sparse grid output frames (-gridsparse,
+C-              -gridwindows)
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Time series rows can be written to columnar series
+C-              stores (-tsstore, see SeriesStore)
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Added packed grid output containers (-gridpack, see
+C-              GridPack)
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  TrexLoad saves the state after initialization
+C-              (SaveResetState) and TrexReset restores it
+C-              (RestoreResetState) instead of reading the inputs
+C-              again.  The inputs are read again after a dry run,
+C-              a model image compilation, a kernel replay, or a
+C-              change of the dry run, sparse grid, or grid windows
+C-              settings.
+C-              Added TrexStartClock and TrexStartRun.
+C-
+C-  Revised:
+C-
+C-  Date:
+C-
+C-  Revisions:
+C-
+C----------------------------------------------------------------------*/
+
+//trex global general variable declarations/definitions
+#include "trex_general_declarations.h"
+#include "trex_general_definitions.h"
+
+//trex global variable declarations/definitions for water transport
+#include "trex_water_declarations.h"
+#include "trex_water_definitions.h"
+
+//trex global variable declarations/definitions for sediment transport
+#include "trex_solids_declarations.h"
+#include "trex_solids_definitions.h"
+
+//trex global variable declarations/definitions for chemical transport
+#include "trex_chemical_declarations.h"
+#include "trex_chemical_definitions.h"
+
+//trex global variable declarations/definitions for environmental conditions
+#include "trex_environmental_declarations.h"
+#include "trex_environmental_definitions.h"
+
+//trex library interface
+#include "trex_library.h"
+
+static double
+	timeprintout,		//tabular output print time
+	timeprintgrid;		//grid output print time
+
+static int
+	rstopt = -1,		//restart option (-1 = none, 0 = restart0, 1 = restart1, 2 = restart2)
+	ksiminput = 0,		//simulation type as read from the input file (before dtopt changes ksim)
+	libstate = 0;		//library state (0 = not initialized, 1 = running, 2 = finished, 3 = finalized)
+
+static time_t clockstart;	//CPU clock time (in seconds since epoch) at start of simulation
+
+static double phasetime[TREXNPHASES];	//accumulated wall clock time of each time step phase (seconds)
+
+//C
+//C
+			/*****************************************/
+			/*           FUNCTION: TrexClock         */
+			/*****************************************/
+
+/* Returns the wall clock time (seconds) used to time the time step phases */
+
+static double TrexClock(void)
+{
+	//local variable declarations/definitions
+	struct timespec now;	//current calendar time (seconds and nanoseconds)
+
+	//get the current time (C11, resolution of the system clock)
+	timespec_get(&now, TIME_UTC);
+
+	//return the time in seconds
+	return (double)now.tv_sec + 1.0e-9 * (double)now.tv_nsec;
+
+//end of function TrexClock
+}
+
+//C
+//C
+			/*****************************************/
+			/*        FUNCTION: TrexBeginPass        */
+			/*****************************************/
+
+/* Starts a pass of the numerical integration loop */
+
+static void TrexBeginPass(void)
+{
+	//Set simulation start time: tstart specified in Data Group A
+	simtime = tstart;	//simulation time (hours)
+
+	//Set simulation end time: end time = time of last break in dt time series
+	tend = dttime[ndt];		//simulation end time (hours)
+
+	//Determine starting index of all time functions for any simulation start time
+	TimeFunctionInit();
+
+	//set time series and grid print output start times to simulation start time
+	timeprintout = simtime;
+	timeprintgrid = simtime;
+
+	//Compute initial volumes and masses for overland plane and channels
+	ComputeInitialState();
+
+	//Set the streamed water storage to the initial volumes (see MassBalanceMonitor)
+	StartMassBalanceMonitor();
+
+	//no time step ceiling is set by step recovery
+	dtrecovery = 0.0;
+
+	//write simulation start message to screen
+	printf("\n\n*********************************\n");
+	printf(	   "*                               *\n");
+	printf(	   "*   Beginning TREX Simulation   *\n");
+	printf(	   "*                               *\n");
+	printf(	   "*********************************\n\n\n");
+
+//end of function TrexBeginPass
+}
+
+//C
+//C
+			/*****************************************/
+			/*         FUNCTION: TrexEndPass         */
+			/*****************************************/
+
+/* Ends a pass of the numerical integration loop and relaunches the */
+/* simulation when required (dtopt = 2 and ksim0 > 1)               */
+
+static void TrexEndPass(void)
+{
+	//if automated time-stepping is selected (dtopt = 1 or dtopt = 2)
+	if(dtopt == 1 || dtopt == 2)
+	{
+		//store simulation time for last time step time (dttime)
+		dttime[idt-1] = (float)(tend);
+
+		//increment total number of time steps in series
+		ndt = ndt + 1;
+
+		//increment timestep buffer index
+		bdt = bdt + 1;
+
+		//Note:  If ndt <= MAXBUFFERSIZE at the end of a simulation,
+		//       no dt and dttime pairs were written to file and all
+		//       are in memory.  Otherwise, if ndt > MAXBUFFERSIZE at
+		//       the simulation end, the buffer must be flushed.
+		//
+		//       For simplicity, all dt and dttime values are always
+		//       written to the buffer file to simply how values are
+		//       retrieved and used to repopulate the dt and dttime
+		//       arrays for final storage to external output file.
+		//
+		//Flush the buffer to write any remaing timestep pairs to
+		//file...
+		//
+		//write time step series (dt, dttime pairs) to buffer file
+		WriteDTBuffer();
+
+		//write time step series (dt, dttime pairs) to external output file
+		WriteDTFile();
+
+	}	//end if dtopt = 1 or 2
+
+	//Check for simulation relaunch conditions...
+	//
+	//Note:  Simulation relaunch occurs if dtopt = 2 and the initial
+	//       ksim value is greater than 1 (ksim0 > 1).
+	//
+	//if dtopt = 2 and ksim0 > 1 (if automated time-stepping with relaunch is selected)
+	if(dtopt == 2 && ksim0 > 1)
+	{
+		//reset the timestep option to read timesteps from file
+		dtopt = 3;
+
+		//Reinitialize simulation for relaunch...
+		//
+		//Note:  Mass balance and other variables must be are reset
+		//       to initial values for simulation relaunch...
+		//
+		//Reinitialize
+		Reinitialize();
+
+		//Start the relaunched pass
+		TrexBeginPass();
+	}
+	else	//else dtopt is not 2
+	{
+		//the simulation is finished
+		libstate = 2;
+
+	}	//end if dtopt = 2
+
+//end of function TrexEndPass
+}
+
+//C
+//C
+			/*****************************************/
+			/*          FUNCTION: TrexAdvance        */
+			/*****************************************/
+
+/* Computes transport and mass balances for one time step (returns */
+/* the simulation error number if the time step is rejected or 0)  */
+
+static int TrexAdvance(void)
+{
+	//local variable declarations/definitions
+	double clock0;	//wall clock time at start of the current phase (seconds)
+
+	//start timing the water phase
+	clock0 = TrexClock();
+
+	//Compute water transport/forcing functions (rainfall, infiltration, flows)
+	WaterTransport();
+
+	//Compute water mass balance (obtain flow depths and floodplain transfers)
+	WaterBalance();
+
+	//add the water phase time
+	phasetime[TREXPHASEWATER] += TrexClock() - clock0;
+
+	//if sediment transport is simulated and the time step is not rejected
+	if(ksim > 1 && rejecterrorno == 0)
+	{
+		//start timing the solids phase
+		clock0 = TrexClock();
+
+		//Compute sediment transport/forcing functions (transport, erosion, deposition, loads)
+		SolidsTransport();
+
+		//Compute solids mass balance (obtain particle concentrations)
+		SolidsBalance();
+
+		//add the solids phase time
+		phasetime[TREXPHASESOLIDS] += TrexClock() - clock0;
+
+		//if chemical transport is simulated and the time step is not rejected
+		if(ksim > 2 && rejecterrorno == 0)
+		{
+			//start timing the chemical phase
+			clock0 = TrexClock();
+
+			//Compute chemical transport/forcing functions (mass transfer and transformations etc.)
+			ChemicalTransport();
+
+			//Compute chemical mass balance (obtain chemical concentrations)
+			ChemicalBalance();
+
+			//add the chemical phase time
+			phasetime[TREXPHASECHEMICAL] += TrexClock() - clock0;
+
+		}	//end if ksim > 2
+
+	}	//end if ksim > 1
+
+	//return the rejection status (0 = accepted)
+	return rejecterrorno;
+
+//end of function TrexAdvance
+}
+
+//C
+//C
+			/*****************************************/
+			/*        FUNCTION: TrexStartClock       */
+			/*****************************************/
+
+/* Starts the clock and the phase times of a simulation */
+
+static void TrexStartClock(void)
+{
+	//local variable declarations/definitions
+	int iphase;		//loop index for time step phases
+
+	//CPU clock time (in seconds since epoch) at start of simulation
+	time(&clockstart);
+
+	//loop over time step phases
+	for(iphase=0; iphase<TREXNPHASES; iphase++)
+	{
+		//no time has been spent in the phase
+		phasetime[iphase] = 0.0;
+	}
+
+	//Publish the start of the simulation (telemetry segment, when selected)
+	StartTelemetry(inputfile);
+
+//end of function TrexStartClock
+}
+
+//C
+//C
+			/*****************************************/
+			/*        FUNCTION: TrexStartRun         */
+			/*****************************************/
+
+/* Starts the first pass from the state after initialization */
+
+static int TrexStartRun(void)
+{
+	//initialize sequential count of grid print events
+	gridcount = 0;
+
+	//the simulation is running
+	libstate = 1;
+
+	//Start the first pass of the numerical integration loop
+	TrexBeginPass();
+
+	//while the current pass has no time steps (simulation time > end time)
+	while(libstate == 1 && simtime > tend)
+	{
+		//End the pass (relaunch or finish)
+		TrexEndPass();
+	}
+
+	//Publish the run status (telemetry segment, when selected)
+	UpdateTelemetry(0, libstate, maxcourantov, maxcourantch);
+
+	//return run status
+	return (libstate == 1) ? TREXCONTINUE : TREXFINISHED;
+
+//end of function TrexStartRun
+}
+
+//C
+//C
+			/*****************************************/
+			/*           FUNCTION: TrexLoad          */
+			/*****************************************/
+
+/* Reads and initializes all data and starts the first pass */
+
+static int TrexLoad(void)
+{
+	//Start the clock and the phase times of the simulation
+	TrexStartClock();
+
+	//if memory use is estimated (dry run)
+	if(dryrunopt > 0)
+	{
+		//a dry run reads no grid values (no model image is used)
+		imageopt = 0;
+	}
+
+	//Start the heap accounting of the subsystems (see MemoryFootprint)
+	StartMemoryAccount();
+
+	//Read input file
+	ReadInputFile();
+
+	//store the simulation type read from the input file
+	ksiminput = ksim;
+
+	//if memory use is estimated (dry run)
+	if(dryrunopt > 0)
+	{
+		//Estimate the memory of the simulation from the dry run inputs
+		EstimateMemory();
+
+		//Write the estimate to the screen and to the echo file
+		WriteMemoryReport(stdout);
+		echofile_fp = OpenOutputFile(echofile, "a");
+		WriteMemoryReport(echofile_fp);
+		fclose(echofile_fp);
+
+		//no simulation is started (dry run only)
+		libstate = 0;
+
+		//Remove the telemetry segment (when selected)
+		StopTelemetry();
+
+		//return dry run status
+		return TREXDRYRUN;
+
+	}	//end if dryrunopt > 0
+
+	//Initialize Variables
+	Initialize();
+
+	//if a model image is used (compiled or loaded)
+	if(imageopt > 0)
+	{
+		//Complete (compile) or release (load) the model image
+		CloseModelImage();
+
+		//if the model image was compiled
+		if(imageopt == 1)
+		{
+			//no simulation is started (compilation only)
+			libstate = 0;
+
+			//Remove the telemetry segment (when selected)
+			StopTelemetry();
+
+			//return compilation status
+			return TREXCOMPILED;
+
+		}	//end if imageopt == 1
+
+	}	//end if imageopt > 0
+
+	//if the rstopt > 0 (if restart info and initializations are read)
+	if(rstopt > 0)
+	{
+		//Read initial condition (restart) files for storms in sequence according to restart option
+		ReadRestart(rstopt);
+
+	}	//end if rstopt > 0
+
+	//Charge the remaining memory of the start of the simulation to the general subsystem
+	MemoryCheckpoint(MEMGENERAL);
+
+	//Write the memory footprint of the subsystems to the echo file
+	echofile_fp = OpenOutputFile(echofile, "a");
+	WriteMemoryReport(echofile_fp);
+	fclose(echofile_fp);
+
+	//Save the state after initialization (restored by TrexReset)
+	SaveResetState();
+
+	//Start the simulation
+	return TrexStartRun();
+
+//end of function TrexLoad
+}
+
+//C
+//C
+			/*****************************************/
+			/*           FUNCTION: TrexInit          */
+			/*****************************************/
+
+/* Initializes a simulation from an input file (and model image) */
+
+int TrexInit(char *inputname, int restartoption, int imageoption, char *imagename)
+{
+	//Allocate memory for input file name
+	inputfile = (char *)malloc(MAXNAMESIZE * sizeof(char));	//allocate memory
+
+	//Assign inputfile name
+	strncpy(inputfile, inputname, MAXNAMESIZE-1);
+	inputfile[MAXNAMESIZE-1] = '\0';
+
+	//set the restart option
+	rstopt = restartoption;
+
+	//set the model image option (1 = compile image, 2 = run from image)
+	imageopt = imageoption;
+
+	//if a model image is used
+	if(imageopt > 0)
+	{
+		//Allocate memory for model image file name
+		imagefile = (char *)malloc(MAXNAMESIZE * sizeof(char));	//allocate memory
+
+		//Assign model image file name
+		strncpy(imagefile, imagename, MAXNAMESIZE-1);
+		imagefile[MAXNAMESIZE-1] = '\0';
+
+	}	//end if imageopt > 0
+
+	//Read and initialize data and start the simulation
+	return TrexLoad();
+
+//end of function TrexInit
+}
+
+//C
+//C
+			/*****************************************/
+			/*           FUNCTION: TrexStep          */
+			/*****************************************/
+
+/* Advances the simulation by one time step */
+
+int TrexStep(void)
+{
+	//local variable declarations/definitions
+	double clock0;	//wall clock time at start of the current phase (seconds)
+
+	//if the simulation is not running
+	if(libstate != 1)
+	{
+		//no time steps remain
+		return TREXFINISHED;
+	}
+
+	//if time steps are specified (dtopt = 0 or dtopt = 3)
+	if(dtopt == 0 || dtopt == 3)
+	{
+		//if it is time to use a new dt, increment the time step index (idt)
+		if((simtime > dttime[idt]) && (idt < ndt))
+		{
+			//increment time step index
+			idt = idt + 1;	//increment time step index
+		}
+	}
+	else if(dtopt == 1 || dtopt == 2)	//else if automated time stepping is selected
+	{
+		//Note:  A new time step is added to the series of dt, dttime
+		//       values whenever the number of stored time step values
+		//       is equal to the number of values in the series.  This
+		//       occurs when idt = bdt.
+		//
+		//if a new time step value is needed (if idt = bdt)
+		if(idt == bdt)
+		{
+			//increment time step index
+			idt = idt + 1;
+
+		}	//end if dt[idt] not equal to dtmax
+
+		//set time step for this time level to the maximum value (seconds)
+		dt[idt] = dtmax;
+
+	}	//end if dtopt = 1 or 2
+
+	//start timing the forcing phase
+	clock0 = TrexClock();
+
+	//Update time functions
+	UpdateTimeFunction();
+
+	//Update environmental conditions
+	UpdateEnvironment();
+
+	//add the forcing phase time
+	phasetime[TREXPHASEFORCING] += TrexClock() - clock0;
+
+	//if step recovery is enabled
+	if(maxrejects > 0)
+	{
+		//Save the state changed by the time step (apply any time step ceiling)
+		BeginStepRecovery();
+
+	}	//end if maxrejects > 0
+
+	//while the time step is rejected (negative depth or concentration)
+	while(TrexAdvance() != 0)
+	{
+		//Restore the saved state and repeat the time step with a smaller dt
+		RetryStep();
+	}
+
+	//Add the water volumes of the accepted time step to the streamed mass balance
+	StreamMassBalance();
+
+	//if sediment transport is simulated
+	if(ksim > 1)
+	{
+		//Add the per-step external load totals to the cumulative totals
+		AccumulateLoadTotals();
+
+	}	//end if ksim > 1
+
+	//if automated time-stepping is selected (dtopt = 1 or dtopt = 2)
+	if(dtopt == 1 || dtopt == 2)
+	{
+		//Record the accepted time step in the time step series
+		RecordTimeStep();
+
+	}	//end if dtopt = 1 or 2
+
+	//start timing the output phase
+	clock0 = TrexClock();
+
+	//if simulation time >= time to report time series output
+	if(simtime >= timeprintout)
+	{
+		//Write simtime and time series printout status to screen
+		//jfe need to use stderr here as in K&R p. 163 to insure msg goes to screen....
+		fprintf(stderr, "  Time Series printout time = %9.6f\tSimulation Time (hours) = %9.6f \n"
+					, timeprintout,simtime);
+
+		//Write times series output to text files
+		WriteTimeSeries();
+
+		//Write the running water mass balance to the echo file
+		//
+		//if the mass balance error exceeds the tolerance (mbtolerance)
+		if(ReportMassBalance() != 0)
+		{
+			//stop the simulation early (end of run results are still written)
+			libstate = 2;
+
+		}	//end if ReportMassBalance() != 0
+
+		//if the dump file name is not blank
+		if(*dmpfile != '\0')
+		{
+			//Write detailed model results to dump file (*.dmp)
+			WriteDumpFile();
+
+		}	//end if dmpfile is not blank
+
+		//if it is time to use a new output print interval
+		if((timeprintout >= printouttime[pdt]) && (pdt < nprintout))
+		{
+			//increment the printout index (pdt)
+			pdt = pdt + 1;
+		}
+
+		//Set the new output print time
+		timeprintout = timeprintout + printout[pdt];
+
+	}	//end if simtime >= timeprintout
+
+	//if simulation time >= time to report grid output
+	if(simtime >= timeprintgrid)
+	{
+		//Write output grids to files
+		WriteGrids(gridcount);
+
+		//increment sequential count of grids print events for file extension
+		gridcount = gridcount + 1;
+
+		//if it is time to use a new grid print interval
+		if((timeprintgrid >= printgridtime[gdt]) && (gdt < nprintgrid))
+		{
+			//increment the printgrid index (gdt)
+			gdt = gdt + 1;
+		}
+
+		//Set the new grid print time
+		timeprintgrid = timeprintgrid + printgrid[pdt];
+
+	}	//end if simtime >= timeprintgrid
+
+	//add the output phase time and start timing the new state phase
+	phasetime[TREXPHASEOUTPUT] += TrexClock() - clock0;
+	clock0 = TrexClock();
+
+	//Assign new state (flow depths, concentrations) for next time step
+	NewState();
+
+	//add the new state phase time
+	phasetime[TREXPHASENEWSTATE] += TrexClock() - clock0;
+
+	//Increment simulation time (t = t + dt) (for upcoming iteration)
+	simtime = simtime + dt[idt] / 3600.0; //simtime (hours), dt (seconds)
+
+	//if step recovery is enabled
+	if(maxrejects > 0)
+	{
+		//Grow the time step ceiling (restore the nominal time step)
+		EndStepRecovery();
+
+	}	//end if maxrejects > 0
+
+	//while the current pass is complete (simulation time > end time)
+	while(libstate == 1 && simtime > tend)
+	{
+		//End the pass (relaunch or finish)
+		TrexEndPass();
+	}
+
+	//Publish the run status after the time step (telemetry segment, when selected)
+	UpdateTelemetry(1, libstate, maxcourantov, maxcourantch);
+
+	//return run status
+	return (libstate == 1) ? TREXCONTINUE : TREXFINISHED;
+
+//end of function TrexStep
+}
+
+//C
+//C
+			/*****************************************/
+			/*         FUNCTION: TrexRunUntil        */
+			/*****************************************/
+
+/* Advances the simulation while simulation time <= endtime (hours) */
+
+int TrexRunUntil(double endtime)
+{
+	//while the simulation is running and has not reached the requested time
+	while(libstate == 1 && simtime <= endtime)
+	{
+		//Advance one time step
+		TrexStep();
+	}
+
+	//return run status
+	return (libstate == 1) ? TREXCONTINUE : TREXFINISHED;
+
+//end of function TrexRunUntil
+}
+
+//C
+//C
+			/*****************************************/
+			/*         FUNCTION: TrexGetTime         */
+			/*****************************************/
+
+/* Returns the current simulation time (hours) */
+
+double TrexGetTime(void)
+{
+	return simtime;
+
+//end of function TrexGetTime
+}
+
+//C
+//C
+			/*****************************************/
+			/*      FUNCTION: TrexGetDimensions      */
+			/*****************************************/
+
+/* Returns the number of grid rows and columns */
+
+void TrexGetDimensions(int *rows, int *cols)
+{
+	*rows = nrows;
+	*cols = ncols;
+
+//end of function TrexGetDimensions
+}
+
+//C
+//C
+			/*****************************************/
+			/*         FUNCTION: TrexGetField        */
+			/*****************************************/
+
+/* Copies an overland state grid into values[] (row major order) */
+
+int TrexGetField(char *name, int index, float *values)
+{
+	//local variable declarations/definitions
+	int
+		ii,			//local row index
+		jj,			//local column index
+		ilink,		//loop index for links
+		inode;		//loop index for nodes
+
+	float
+		**grid;		//selected grid (row, column) (NULL for layered and channel fields)
+
+	//if the simulation has not been initialized
+	if(libstate == 0)
+	{
+		//no field is available
+		return -1;
+	}
+
+	//Select the field...
+	//
+	//set the grid to null
+	grid = NULL;
+
+	//if the field is the overland water depth
+	if(strcmp(name, "hov") == 0)
+	{
+		grid = hov;
+	}
+	else if(strcmp(name, "elevationov") == 0)	//else if the field is the ground elevation
+	{
+		grid = elevationov;
+	}
+	else if(strcmp(name, "grossrainrate") == 0)	//else if the field is the gross rainfall rate
+	{
+		grid = grossrainrate;
+	}
+	else if(strcmp(name, "sweov") == 0 && (snowopt > 0 || meltopt > 0))	//else if snow (swe) depth and snow is simulated
+	{
+		grid = sweov;
+	}
+	else if(strcmp(name, "infiltrationdepth") == 0 && infopt > 0)	//else if infiltration depth and infiltration is simulated
+	{
+		grid = infiltrationdepth;
+	}
+	else if(strcmp(name, "hch") == 0 && chnopt > 0)	//else if channel depth and channels are simulated
+	{
+		//channel values are mapped to the grid below
+	}
+	else if(strcmp(name, "csedov") == 0 && ksim > 1 && index >= 0 && index <= nsolids)	//else if solids and solids are simulated
+	{
+		//solids values are copied from the water column (layer 0) below
+	}
+	else if(strcmp(name, "cchemov") == 0 && ksim > 2 && index >= 1 && index <= nchems)	//else if chemical and chemicals are simulated
+	{
+		//chemical values are copied from the water column (layer 0) below
+	}
+	else	//else the field is not available
+	{
+		//unknown field (or not simulated)
+		return -1;
+
+	}	//end if name = ...
+
+	//Loop over number of rows
+	for(ii=1; ii<=nrows; ii++)
+	{
+		//Loop over number of columns
+		for(jj=1; jj<=ncols; jj++)
+		{
+			//if the cell is in the domain
+			if(imask[ii][jj] != nodatavalue)
+			{
+				//if the field is a (row, column) grid
+				if(grid != NULL)
+				{
+					//copy the grid value
+					values[(ii-1)*ncols+(jj-1)] = grid[ii][jj];
+				}
+				else if(strcmp(name, "csedov") == 0)	//else if the field is solids
+				{
+					//copy the water column solids concentration (g/m3)
+					values[(ii-1)*ncols+(jj-1)] = csedov[index][ii][jj][0];
+				}
+				else if(strcmp(name, "cchemov") == 0)	//else if the field is chemical
+				{
+					//copy the water column chemical concentration (g/m3)
+					values[(ii-1)*ncols+(jj-1)] = cchemov[index][ii][jj][0];
+				}
+				else	//else the field is a channel field
+				{
+					//overland cells have no channel value
+					values[(ii-1)*ncols+(jj-1)] = (float)(nodatavalue);
+
+				}	//end if grid != NULL
+			}
+			else	//else the cell is outside the domain
+			{
+				//set the null value
+				values[(ii-1)*ncols+(jj-1)] = (float)(nodatavalue);
+
+			}	//end if imask[ii][jj] != nodatavalue
+
+		}	//end loop over columns
+
+	}	//end loop over rows
+
+	//if the field is the channel depth
+	if(strcmp(name, "hch") == 0)
+	{
+		//Loop over number of links
+		for(ilink=1; ilink<=nlinks; ilink++)
+		{
+			//Loop over number of nodes for current link
+			for(inode=1; inode<=nnodes[ilink]; inode++)
+			{
+				//copy the channel water depth to the node's grid cell
+				values[(ichnrow[ilink][inode]-1)*ncols+(ichncol[ilink][inode]-1)] = hch[ilink][inode];
+
+			}	//end loop over nodes
+
+		}	//end loop over links
+
+	}	//end if name = hch
+
+	//return the number of values
+	return nrows * ncols;
+
+//end of function TrexGetField
+}
+
+//C
+//C
+			/*****************************************/
+			/*       FUNCTION: TrexSetParameter      */
+			/*****************************************/
+
+/* Sets a calibration parameter for a land use class, soil type, or link */
+
+int TrexSetParameter(char *name, int index, double value)
+{
+	//local variable declarations/definitions
+	int
+		inode;		//loop index for nodes
+
+	//if the simulation has not been initialized
+	if(libstate == 0)
+	{
+		//no parameter is available
+		return -1;
+	}
+
+	//if the parameter is the overland Manning n of a land use class
+	if(strcmp(name, "nmanningov") == 0 && index >= 1 && index <= nlands)
+	{
+		nmanningov[index] = (float)(value);
+	}
+	else if(strcmp(name, "khsoil") == 0 && infopt > 0 && index >= 1 && index <= nsoils)	//else if soil hydraulic conductivity (m/s)
+	{
+		khsoil[index] = (float)(value);
+
+		//Set the surface soil parameters of all cells
+		UpdateSoilParameters();
+	}
+	else if(strcmp(name, "capshsoil") == 0 && infopt > 0 && index >= 1 && index <= nsoils)	//else if soil capillary suction head (m)
+	{
+		capshsoil[index] = (float)(value);
+
+		//Set the surface soil parameters of all cells
+		UpdateSoilParameters();
+	}
+	else if(strcmp(name, "soilmd") == 0 && infopt > 0 && index >= 1 && index <= nsoils)	//else if soil moisture deficit
+	{
+		soilmd[index] = (float)(value);
+
+		//Set the surface soil parameters of all cells
+		UpdateSoilParameters();
+
+		//if chemicals are simulated, the soil partitioning depends on the moisture deficit
+		if(ksim > 2)
+		{
+			//Mark the partitioning of all cells and nodes stale
+			InvalidatePartitioning();
+		}
+	}
+	else if(strcmp(name, "nmanningch") == 0 && chnopt > 0 && index >= 1 && index <= nlinks)	//else if channel Manning n of a link
+	{
+		//Loop over number of nodes for the link
+		for(inode=1; inode<=nnodes[index]; inode++)
+		{
+			nmanningch[index][inode] = (float)(value);
+
+		}	//end loop over nodes
+	}
+	else	//else the parameter is not available
+	{
+		//unknown parameter or index
+		return -1;
+
+	}	//end if name = ...
+
+	//return success
+	return 0;
+
+//end of function TrexSetParameter
+}
+
+//C
+//C
+			/*****************************************/
+			/*       FUNCTION: TrexSetPowMode        */
+			/*****************************************/
+
+/* Sets the power law evaluation mode of the transport kernels (see BatchMath) */
+
+int TrexSetPowMode(char *mode)
+{
+	//local variable declarations
+	int
+		powid;	//power law evaluation mode number
+
+	//get the mode number of the name
+	powid = (mode != NULL) ? PowModeId(mode) : -1;
+
+	//if the mode is not valid
+	if(powid < 0)
+	{
+		//the mode is not valid
+		return -1;
+	}
+
+	//set the requested mode (selected by InitializeBatchMath)
+	powmode = powid;
+
+	//if a simulation is initialized (running or finished)
+	if(libstate == 1 || libstate == 2)
+	{
+		//select the mode now
+		InitializeBatchMath();
+	}
+
+	//return success
+	return 0;
+
+//end of function TrexSetPowMode
+}
+
+//C
+//C
+			/*****************************************/
+			/*  FUNCTION: TrexSetPartitionTolerance  */
+			/*****************************************/
+
+/* Sets the relative tolerance of incremental chemical partitioning (see PartitionCache) */
+
+int TrexSetPartitionTolerance(double tolerance)
+{
+	//if the tolerance is not valid
+	if(tolerance < 0.0)
+	{
+		//the tolerance is not valid
+		return -1;
+	}
+
+	//set the relative tolerance (0 = recompute on any change)
+	parttol = (float)(tolerance);
+
+	//return success
+	return 0;
+
+//end of function TrexSetPartitionTolerance
+}
+
+//C
+//C
+			/*****************************************/
+			/*       FUNCTION: TrexSetThreads        */
+			/*****************************************/
+
+/* Sets the number of threads of the solids and chemical transport tasks (see SpeciesTasks) */
+
+int TrexSetThreads(int nthreads)
+{
+	//if the number of threads is not valid
+	if(nthreads < 1)
+	{
+		//the number of threads is not valid
+		return -1;
+	}
+
+#ifndef _OPENMP
+	//if more than one thread is requested without OpenMP
+	if(nthreads > 1)
+	{
+		//the tasks can only run serially
+		return -1;
+	}
+#endif
+
+	//set the number of threads (1 = serial)
+	ntaskthreads = nthreads;
+
+	//return success
+	return 0;
+
+//end of function TrexSetThreads
+}
+
+//C
+//C
+			/*****************************************/
+			/* FUNCTION: TrexSetMassBalanceTolerance */
+			/*****************************************/
+
+/* Sets the water mass balance error (%) that stops the simulation (see MassBalanceMonitor) */
+
+int TrexSetMassBalanceTolerance(double percent)
+{
+	//if the tolerance is not valid
+	if(percent < 0.0)
+	{
+		//the tolerance is not valid
+		return -1;
+	}
+
+	//set the tolerance (0 = never stop)
+	mbtolerance = (float)(percent);
+
+	//return success
+	return 0;
+
+//end of function TrexSetMassBalanceTolerance
+}
+
+//C
+//C
+			/*****************************************/
+			/*       FUNCTION: TrexSetTelemetry      */
+			/*****************************************/
+
+/* Selects the publication of the run status in a telemetry segment (see Telemetry) */
+
+int TrexSetTelemetry(int enable)
+{
+	//if the setting is not valid
+	if(enable < 0 || enable > 1)
+	{
+		//the setting is not valid
+		return -1;
+	}
+
+#ifdef WINDOWS
+	//if telemetry is selected
+	if(enable == 1)
+	{
+		//telemetry is not available (no POSIX shared memory)
+		return -1;
+	}
+#endif
+
+	//set the telemetry option (0 = off, 1 = publish the run status)
+	telemetryopt = enable;
+
+	//return success
+	return 0;
+
+//end of function TrexSetTelemetry
+}
+
+//C
+//C
+			/*****************************************/
+			/*        FUNCTION: TrexSetDryRun        */
+			/*****************************************/
+
+/* Selects a dry run (memory estimate without a simulation, see MemoryFootprint) */
+
+int TrexSetDryRun(int enable)
+{
+	//if the setting is not valid
+	if(enable < 0 || enable > 1)
+	{
+		//the setting is not valid
+		return -1;
+	}
+
+	//if the setting changed
+	if(enable != dryrunopt)
+	{
+		//TrexReset reads the inputs again (no saved state)
+		FreeResetState();
+	}
+
+	//set the dry run option (0 = simulation, 1 = memory estimate only)
+	dryrunopt = enable;
+
+	//return success
+	return 0;
+
+//end of function TrexSetDryRun
+}
+
+//C
+//C
+			/*****************************************/
+			/*      FUNCTION: TrexSetGridSparse      */
+			/*****************************************/
+
+/* Selects sparse grid output frames (see GridOutput) */
+
+int TrexSetGridSparse(int mode)
+{
+	//if the setting is not valid
+	if(mode < 0 || mode > 2)
+	{
+		//the setting is not valid
+		return -1;
+	}
+
+	//if the setting changed
+	if(mode != gridsparseopt)
+	{
+		//TrexReset reads the inputs again (the output selection is built by Initialize)
+		FreeResetState();
+	}
+
+	//set the sparse grid option (0 = full rasters, 1 = non-zero cells, 2 = all selected cells)
+	gridsparseopt = mode;
+
+	//return success
+	return 0;
+
+//end of function TrexSetGridSparse
+}
+
+//C
+//C
+			/*****************************************/
+			/*      FUNCTION: TrexSetGridWindows     */
+			/*****************************************/
+
+/* Restricts sparse grid output to the windows of a grid windows file (see GridOutput) */
+
+int TrexSetGridWindows(char *file)
+{
+	//set the grid windows file (NULL or "" = whole domain)
+	SetGridWindows(file);
+
+	//TrexReset reads the inputs again (the output selection is built by Initialize)
+	FreeResetState();
+
+	//if windows are given and grid output is written as full rasters
+	if(file != NULL && *file != '\0' && gridsparseopt == 0)
+	{
+		//write all cells of the windows as sparse frames
+		gridsparseopt = 2;
+	}
+
+	//return success
+	return 0;
+
+//end of function TrexSetGridWindows
+}
+
+//C
+//C
+			/*****************************************/
+			/*      FUNCTION: TrexSetSeriesStore     */
+			/*****************************************/
+
+/* Selects columnar series stores for the time series output (see SeriesStore) */
+
+int TrexSetSeriesStore(int enable)
+{
+	//if the setting is not valid
+	if(enable < 0 || enable > 1)
+	{
+		//the setting is not valid
+		return -1;
+	}
+
+	//set the series store option (0 = text export files, 1 = series stores)
+	tsstoreopt = enable;
+
+	//return success
+	return 0;
+
+//end of function TrexSetSeriesStore
+}
+
+//C
+//C
+			/*****************************************/
+			/*       FUNCTION: TrexSetGridPack       */
+			/*****************************************/
+
+/* Selects compressed grid frames in one container per grid (see GridPack) */
+
+int TrexSetGridPack(int enable)
+{
+	//if the setting is not valid
+	if(enable < 0 || enable > 1)
+	{
+		//the setting is not valid
+		return -1;
+	}
+
+	//set the packed grid option (0 = rasters, 1 = containers)
+	gridpackopt = enable;
+
+	//return success
+	return 0;
+
+//end of function TrexSetGridPack
+}
+
+//C
+//C
+			/*****************************************/
+			/*     FUNCTION: TrexUnpackGridFrame     */
+			/*****************************************/
+
+/* Decodes the value bits of a frame of a packed grid container (see GridPack) */
+
+int TrexUnpackGridFrame(unsigned char *body, int size, int ncells, int keyframe, unsigned int *bits)
+{
+	//decode the frame
+	return UnpackGridFrame(body, size, ncells, keyframe, bits);
+
+//end of function TrexUnpackGridFrame
+}
+
+//C
+//C
+			/*****************************************/
+			/*        FUNCTION: TrexGetMemory        */
+			/*****************************************/
+
+/* Copies the memory footprint (bytes) of each subsystem (estimated or measured) */
+
+int TrexGetMemory(double *bytes)
+{
+	//local variable declarations/definitions
+	int isub,	//loop index for subsystems
+		ifam;	//loop index for array families
+
+	//loop over subsystems
+	for(isub=0; isub<TREXNMEMORY; isub++)
+	{
+		//if a dry run estimated the memory
+		if(dryrunopt > 0)
+		{
+			//sum the estimate of the array families
+			bytes[isub] = 0.0;
+
+			for(ifam=0; ifam<NMEMFAMILIES; ifam++)
+			{
+				bytes[isub] += memestimate[isub][ifam];
+			}
+		}
+		else	//else the memory was measured
+		{
+			//copy the measured bytes
+			bytes[isub] = memmeasured[isub];
+
+		}	//end if dryrunopt > 0
+
+	}	//end loop over subsystems
+
+	//return the number of subsystems
+	return TREXNMEMORY;
+
+//end of function TrexGetMemory
+}
+
+//C
+//C
+			/*****************************************/
+			/*       FUNCTION: TrexSetRecovery       */
+			/*****************************************/
+
+/* Sets the step recovery controls (rejections, dt reduction and growth) */
+
+int TrexSetRecovery(int rejects, double reduction, double growth)
+{
+	//if the controls are not valid
+	if(rejects < 0 || reduction <= 0.0 || reduction >= 1.0 || growth <= 1.0)
+	{
+		//the controls are not valid
+		return -1;
+	}
+
+	//set the maximum number of successive rejections (0 = step recovery off)
+	maxrejects = rejects;
+
+	//set the time step reduction and growth factors
+	recoveryfactor = (float)(reduction);
+	recoverygrowth = (float)(growth);
+
+	//return success
+	return 0;
+
+//end of function TrexSetRecovery
+}
+
+//C
+//C
+			/*****************************************/
+			/*      FUNCTION: TrexGetPhaseTimes      */
+			/*****************************************/
+
+/* Copies the wall clock time spent in each time step phase (seconds) */
+
+int TrexGetPhaseTimes(double *seconds)
+{
+	//local variable declarations/definitions
+	int iphase;		//loop index for time step phases
+
+	//loop over time step phases
+	for(iphase=0; iphase<TREXNPHASES; iphase++)
+	{
+		//copy the accumulated phase time
+		seconds[iphase] = phasetime[iphase];
+	}
+
+	//return the number of phases
+	return TREXNPHASES;
+
+//end of function TrexGetPhaseTimes
+}
+
+//C
+//C
+			/*****************************************/
+			/*       FUNCTION: TrexSetSnapshot       */
+			/*****************************************/
+
+/* Selects a kernel to capture to a snapshot file at a simulation time */
+
+int TrexSetSnapshot(char *kernel, double time, char *filename)
+{
+	//local variable declarations/definitions
+	int ikernel;	//kernel number
+
+	//get the kernel number of the kernel name
+	ikernel = KernelSnapshotId(kernel);
+
+	//if the kernel, time, or file name is not valid
+	if(ikernel == 0 || time < 0.0 || filename == NULL || *filename == '\0')
+	{
+		//the snapshot is not valid
+		return -1;
+	}
+
+	//select the kernel, capture time, and snapshot file
+	SetKernelSnapshot(ikernel, time, filename);
+
+	//return success
+	return 0;
+
+//end of function TrexSetSnapshot
+}
+
+//C
+//C
+			/*****************************************/
+			/*       FUNCTION: TrexReplayKernel      */
+			/*****************************************/
+
+/* Replays the kernel of a snapshot file and compares its outputs */
+
+int TrexReplayKernel(char *filename, int repeats, double *time,
+	double *seconds, long *cells, long *mismatches)
+{
+	//local variable declarations/definitions
+	int
+		kernel,		//kernel number of the snapshot
+		irepeat;	//loop index for repetitions
+
+	double
+		clock0;		//wall clock time at the start of a repetition (seconds)
+
+	//if the simulation is not initialized or the number of repetitions is not valid
+	if(libstate != 1 || repeats < 1)
+	{
+		//the kernel cannot be replayed
+		return -1;
+	}
+
+	//read the kernel state of the snapshot file into the model state
+	kernel = LoadKernelSnapshot(filename, time);
+
+	//TrexReset reads the inputs again (the kernel state may include inputs)
+	FreeResetState();
+
+	//start the kernel time
+	*seconds = 0.0;
+
+	//loop over repetitions
+	for(irepeat=1; irepeat<=repeats; irepeat++)
+	{
+		//restore the kernel state before the kernel (not timed)
+		RestoreKernelSnapshot();
+
+		//call the kernel and accumulate its wall clock time
+		clock0 = TrexClock();
+		RunKernel(kernel);
+		*seconds = *seconds + (TrexClock() - clock0);
+
+	}	//end loop over repetitions
+
+	//compare the outputs of the last repetition with the snapshot file
+	*mismatches = CompareKernelSnapshot();
+
+	//number of cells or nodes the kernel loops over
+	*cells = KernelCells(kernel);
+
+	//return the kernel number
+	return kernel;
+
+//end of function TrexReplayKernel
+}
+
+//C
+//C
+			/*****************************************/
+			/*        FUNCTION: TrexKernelName       */
+			/*****************************************/
+
+/* Returns the name of a kernel number */
+
+char *TrexKernelName(int kernel)
+{
+	//return the kernel name (empty if not a kernel)
+	return KernelSnapshotName(kernel);
+
+//end of function TrexKernelName
+}
+
+//C
+//C
+			/*****************************************/
+			/*          FUNCTION: TrexReset          */
+			/*****************************************/
+
+/* Returns the simulation to its initial state */
+
+int TrexReset(void)
+{
+	//if inputs have been read (memory is allocated)
+	if(ksiminput > 0)
+	{
+		//Write the buffered rows and time indexes of the series stores
+		//(the next run starts new stores)
+		CloseSeriesStore();
+
+		//Write the time indexes of the packed grid containers (the next
+		//run starts new containers)
+		CloseGridPack();
+
+		//Restore the state after initialization (no input file is read)
+		if(RestoreResetState() > 0)
+		{
+			//Start the clock and the phase times of the simulation
+			TrexStartClock();
+
+			//Start the simulation
+			return TrexStartRun();
+
+		}	//end if RestoreResetState() > 0
+
+		//Note:  No state is saved after a dry run, a model image
+		//       compilation, or a kernel replay (or when the dry run,
+		//       sparse grid, or grid windows settings changed), so the
+		//       inputs are read again.
+		//
+		//restore the simulation type so all allocated memory is freed
+		ksim = ksiminput;
+
+		//Deallocate memory
+		FreeMemory();
+
+	}	//end if ksiminput > 0
+
+	//if a model image was compiled, the inputs are read from it
+	if(imageopt == 1)
+	{
+		//run from the model image
+		imageopt = 2;
+	}
+
+	//Read and initialize data and start the simulation
+	return TrexLoad();
+
+//end of function TrexReset
+}
+
+//C
+//C
+			/*****************************************/
+			/*        FUNCTION: TrexFinalize         */
+			/*****************************************/
+
+/* Computes final volumes and writes end of run results */
+
+void TrexFinalize(void)
+{
+	//local variable declarations/definitions
+	time_t clockstop;	//CPU clock time (in seconds since epoch) at end of simulation
+
+	//if the simulation has not been initialized or results were written
+	if(libstate == 0 || libstate == 3)
+	{
+		//nothing to write
+		return;
+	}
+
+	/*******************************************/
+	/* Compute final volumes & write results   */
+	/*******************************************/
+
+	//Write times series output to text files (ensure output of final iteration)
+	WriteTimeSeries();
+
+	//Write the buffered rows and time indexes of the series stores
+	CloseSeriesStore();
+
+	//if the dump file name is not blank
+	if(*dmpfile != '\0')
+	{
+		//Write detailed model results to dump file (*.dmp) (ensure output of final iteration)
+		WriteDumpFile();
+
+	}	//end if dmpfile is not blank
+
+	//Write output grids to files (ensure output of final iteration)
+	WriteGrids(gridcount);
+
+	//Write end of run (single) grids to files (net elevation change, gross erosion, etc.)
+	WriteEndGrids(gridcount);
+
+	//Write the time indexes of the packed grid containers
+	CloseGridPack();
+
+	//Compute final volumes and masses for the overland and channels
+	ComputeFinalState();
+
+	//if the mass balance file name is not null
+	if(*msbfile != '\0')
+	{
+		//Write summary mass balance file
+		WriteMassBalance();
+
+	}	//end if msbfile is not blank
+
+	//Write summary file
+	WriteSummary();
+
+	//if a kernel snapshot was selected but not captured
+	if(snapshotkernel > 0)
+	{
+		//Write message to screen
+		printf("\n  Kernel snapshot: %s was not called at or after the snapshot time\n",
+			KernelSnapshotName(snapshotkernel));
+
+	}	//end if snapshotkernel > 0
+
+	//CPU clock time (in seconds since epoch) at end of simulation
+	time(&clockstop);
+
+	//Compute trex elapsed running time for this simulation
+	RunTime(clockstart, clockstop);
+
+	//if the restart option is >= 0 (if final conditions for a restart are written)
+	if(rstopt >= 0)
+	{
+		//Write initial condition (restart) files for storms in sequence accoprding to restart option
+		WriteRestart();
+
+	}	//end if rstopt >= 0
+
+	//Publish the end of the run and remove the telemetry segment (when selected)
+	UpdateTelemetry(0, 0, maxcourantov, maxcourantch);
+	StopTelemetry();
+
+	//results are written
+	libstate = 3;
+
+//end of function TrexFinalize
+}
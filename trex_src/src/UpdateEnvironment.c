@@ -33,7 +33,9 @@ C-              nenvgtf, nenvovtf, nenvchtf, nfpocovtf, nfpocchtf,
 C-              nenvgtfpairs, nenvovtfpairs, nenvchtfpairs,
 C-              nfpocovpairs, nfpocchpairs
 C-
-C-	Calls:		ComputeSolarRadiation
+C-	Calls:		ComputeSolarRadiation, UpdateGeneralZones,
+C-              UpdateOverlandZones, EnvGeneralValue, EnvGeneralTFId,
+C-              EnvOverlandValue
 C-
 C-	Called by:	trex
 C-
@@ -62,6 +64,26 @@ C-	Date:		20-JAN-2009
 C-
 C-	Revisions:	Added update for air temperature lapse with elevation
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	The partitioning of a cell or node is marked stale
+C-              when its doc concentration or fraction changes (ksim
+C-              > 2).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	General and overland properties are stored as zone
+C-              tables when they are uniform or zoned
+C-              (EnvironmentZones).  Zone values are updated once
+C-              per zone and cell values are only reassigned when a
+C-              zone value changed.  The air temperature lapse uses
+C-              the station elevation of the time function of the
+C-              cell.  Channel properties loop over npropch.
+C-
 C-	Revised:
 C-
 C-	Date:	
@@ -95,7 +117,8 @@ void UpdateEnvironment()
 
 	int
 		pid,		//index for property identification
-		tfid;		//index for time function identification
+		tfid,		//index for time function identification
+		nlayers;	//number of overland layers updated for a property
 
 	double
 		endtime,	//end time of a time function (last time break in series)
@@ -103,7 +126,10 @@ void UpdateEnvironment()
 
 	float
 		nt,			//next (upper) interval time for a time function
-		pt;			//prior (lower) interval time for a time function
+		pt,			//prior (lower) interval time for a time function
+		docvalue,	//doc concentration or fraction before the update (cdoc, fdoc)
+		**envgrid,	//cell values updated by a general property [row][col]
+		***envstack;	//cell values updated by an overland property [row][col][layer]
 
 //mlv  This module should be split into parts for overland and channel properties.
 //mlv  UpdateEnvironment should be a shell to control entry to UpdateEnvironmentOverland
@@ -137,6 +163,11 @@ void UpdateEnvironment()
 
 	//Update general environmental conditions...
 	//
+	//Note:  Zoned properties update their zone values once per zone
+	//       (UpdateGeneralZones) and only reassign cell values when a
+	//       zone value changed.  Solar radiation is also computed for
+	//       snowmelt, so it is always reassigned when meltopt > 0.
+	//
 	//loop over number of general functions
 	for(iprop=1; iprop<=npropg; iprop++)
 	{
@@ -146,176 +177,32 @@ void UpdateEnvironment()
 		//if the property is wind speed (pid == 1)
 		if(pid == 1)
 		{
-			//Loop over rows
-			for(i=1; i<=nrows; i++)
-			{
-				//Loop over columns
-				for(j=1; j<=ncols; j++)
-				{
-					//if the cell is in the domain (is not null)
-					if(imask[i][j] != nodatavalue)
-					{
-						//set the time function id for this cell
-						tfid = envgtfid[iprop][i][j];
-
-						//if a time function exists for this cell (tfid > 0)
-						if(tfid > 0)
-						{
-							//set the wind speed value (m/s) f(x,y,t)
-							windspeed[i][j] = envg[iprop][i][j] * envgtfinterp[iprop][tfid];
-						}
-						else	//else, no time function exists
-						{
-							//set the wind speed value (m/s) f(x,y)
-							windspeed[i][j] = envg[iprop][i][j];
-
-						}	//end if envgtfid > 0
-
-					}	//end if imask[][] != nodatavalue
-
-				}	//end loop over columns
-
-			}	//end loop over rows
+			//set the wind speed (m/s) f(x,y,t)
+			envgrid = windspeed;
 		}
 		//if the property is air temperature (pid == 2)
 		else if(pid == 2)
 		{
-			//Loop over rows
-			for(i=1; i<=nrows; i++)
-			{
-				//Loop over columns
-				for(j=1; j<=ncols; j++)
-				{
-					//if the cell is in the domain (is not null)
-					if(imask[i][j] != nodatavalue)
-					{
-						//set the time function id for this cell
-						tfid = envgtfid[iprop][i][j];
-
-						//if a time function exists for this cell (tfid > 0)
-						if(tfid > 0)
-						{
-							//set the air temperature value (C) f(x,y,t)
-							airtemp[i][j] = envg[iprop][i][j] * envgtfinterp[iprop][tfid];
-						}
-						else	//else, no time function exists
-						{
-							//set the air temperature value (C) f(x,y)
-							airtemp[i][j] = envg[iprop][i][j];
-
-						}	//end if envgtfid > 0
-
-						//copmute air temperature lapse adjustments for elevations
-						airtemp[i][j] = airtemp[i][j]
-							- atlapse[tfid] * (elevationov[i][j] - stnelevenvg[2][1]);
-
-					}	//end if imask[][] != nodatavalue
-
-				}	//end loop over columns
-
-			}	//end loop over rows
+			//set the air temperature (C) f(x,y,t)
+			envgrid = airtemp;
 		}
 		//if the property is solar radiation (pid == 3)
 		else if(pid == 3)
 		{
-			//Loop over rows
-			for(i=1; i<=nrows; i++)
-			{
-				//Loop over columns
-				for(j=1; j<=ncols; j++)
-				{
-					//if the cell is in the domain (is not null)
-					if(imask[i][j] != nodatavalue)
-					{
-						//set the time function id for this cell
-						tfid = envgtfid[iprop][i][j];
-
-						//if a time function exists for this cell (tfid > 0)
-						if(tfid > 0)
-						{
-							//set the solar radiation value (W/m2) f(x,y,t)
-							solarrad[i][j] = envg[iprop][i][j] * envgtfinterp[iprop][tfid];
-						}
-						else	//else, no time function exists
-						{
-							//set the solar radiation value (W/m2) f(x,y)
-							solarrad[i][j] = envg[iprop][i][j];
-
-						}	//end if envgtfid > 0
-
-					}	//end if imask[][] != nodatavalue
-
-				}	//end loop over columns
-
-			}	//end loop over rows
+			//set the solar radiation (W/m2) f(x,y,t)
+			envgrid = solarrad;
 		}
 		//if the property is cloud cover (pid == 4)
 		else if(pid == 4)
 		{
-			//Loop over rows
-			for(i=1; i<=nrows; i++)
-			{
-				//Loop over columns
-				for(j=1; j<=ncols; j++)
-				{
-					//if the cell is in the domain (is not null)
-					if(imask[i][j] != nodatavalue)
-					{
-						//set the time function id for this cell
-						tfid = envgtfid[iprop][i][j];
-
-						//if a time function exists for this cell (tfid > 0)
-						if(tfid > 0)
-						{
-							//set the cloud cover value (fraction, 0-1) f(x,y,t)
-							cloudcover[i][j] = envg[iprop][i][j] * envgtfinterp[iprop][tfid];
-						}
-						else	//else, no time function exists
-						{
-							//set the cloud cover value (fraction, 0-1) f(x,y)
-							cloudcover[i][j] = envg[iprop][i][j];
-
-						}	//end if envgtfid > 0
-
-					}	//end if imask[][] != nodatavalue
-
-				}	//end loop over columns
-
-			}	//end loop over rows
+			//set the cloud cover (fraction, 0-1) f(x,y,t)
+			envgrid = cloudcover;
 		}
 		//if the property is albedo (pid == 5)
 		else if(pid == 5)
 		{
-			//Loop over rows
-			for(i=1; i<=nrows; i++)
-			{
-				//Loop over columns
-				for(j=1; j<=ncols; j++)
-				{
-					//if the cell is in the domain (is not null)
-					if(imask[i][j] != nodatavalue)
-					{
-						//set the time function id for this cell
-						tfid = envgtfid[iprop][i][j];
-
-						//if a time function exists for this cell (tfid > 0)
-						if(tfid > 0)
-						{
-							//set the albedo value (fraction, 0-1) f(x,y,t)
-							albedo[i][j] = envg[iprop][i][j] * envgtfinterp[iprop][tfid];
-						}
-						else	//else, no time function exists
-						{
-							//set the albedo value (fraction, 0-1) f(x,y)
-							albedo[i][j] = envg[iprop][i][j];
-
-						}	//end if envgtfid > 0
-
-					}	//end if imask[][] != nodatavalue
-
-				}	//end loop over columns
-
-			}	//end loop over rows
+			//set the albedo (fraction, 0-1) f(x,y,t)
+			envgrid = albedo;
 		}
 		//else, the property is undefined
 		else
@@ -336,18 +223,8 @@ void UpdateEnvironment()
 
 		}	//end if pid == 1 etc...
 
-	}	//end loop over number of general properties
-
-	//Update overland environmental functions...
-	//
-	//loop over number of overland functions
-	for(iprop=1; iprop<=npropov; iprop++)
-	{
-		//set property identification
-		pid = pidov[iprop];
-
-		//if the property is doc concentration (cdoc) (pid == 1)
-		if(pid == 1)
+		//if a zone value changed (or the property is distributed or recomputed for snowmelt)
+		if(UpdateGeneralZones(iprop) > 0 || (pid == 3 && meltopt > 0))
 		{
 			//Loop over rows
 			for(i=1; i<=nrows; i++)
@@ -358,306 +235,125 @@ void UpdateEnvironment()
 					//if the cell is in the domain (is not null)
 					if(imask[i][j] != nodatavalue)
 					{
-						//loop over layers (include zero for water column)
-						for(k=0; k<=maxstackov; k++)
+						//set the property value f(x,y,t)
+						envgrid[i][j] = EnvGeneralValue(iprop, i, j);
+
+						//if the property is air temperature (pid == 2)
+						if(pid == 2)
 						{
 							//set the time function id for this cell
-							tfid = envovtfid[iprop][i][j][k];
+							tfid = EnvGeneralTFId(iprop, i, j);
 
-							//if a time function exists for this cell (tfid > 0)
+							//if a time function (station) exists for this cell (tfid > 0)
 							if(tfid > 0)
 							{
-								//set the doc concentration value (g/m3) f(x,y,z,t)
-								cdocov[i][j][k] = envov[iprop][i][j][k] * envovtfinterp[iprop][tfid];
-							}
-							else	//else, no time function exists
-							{
-								//set the doc concentration value (g/m3) f(x,y,z)
-								cdocov[i][j][k] = envov[iprop][i][j][k];
+								//copmute air temperature lapse adjustments for elevations
+								airtemp[i][j] = airtemp[i][j]
+									- atlapse[tfid] * (elevationov[i][j] - stnelevenvg[iprop][tfid]);
 
-							}	//end if envovtfid > 0
+							}	//end if tfid > 0
 
-						}	//end loop over layers
+						}	//end if pid == 2
 
 					}	//end if imask[][] != nodatavalue
 
 				}	//end loop over columns
 
 			}	//end loop over rows
-		}
-		//if the property is effection fraction of doc (fdoc) (pid == 2)
-		else if(pid == 2)
-		{
-			//Loop over rows
-			for(i=1; i<=nrows; i++)
-			{
-				//Loop over columns
-				for(j=1; j<=ncols; j++)
-				{
-					//if the cell is in the domain (is not null)
-					if(imask[i][j] != nodatavalue)
-					{
-						//loop over layers (include zero for water column)
-						for(k=0; k<=maxstackov; k++)
-						{
-							//set the time function id for this cell
-							tfid = envovtfid[iprop][i][j][k];
-
-							//if a time function exists for this cell (tfid > 0)
-							if(tfid > 0)
-							{
-								//set the fdoc value (dimensionless) f(x,y,z,t)
-								fdocov[i][j][k] = envov[iprop][i][j][k] * envovtfinterp[iprop][tfid];
-							}
-							else	//else, no time function exists
-							{
-								//set the fdoc value (dimensionless) f(x,y,z)
-								fdocov[i][j][k] = envov[iprop][i][j][k];
 
-							}	//end if envovtfid > 0
+		}	//end if UpdateGeneralZones() > 0
 
-						}	//end loop over layers
-
-					}	//end if imask[][] != nodatavalue
+	}	//end loop over number of general properties
 
-				}	//end loop over columns
+	//Update overland environmental functions...
+	//
+	//loop over number of overland functions
+	for(iprop=1; iprop<=npropov; iprop++)
+	{
+		//set property identification
+		pid = pidov[iprop];
+
+		//set the number of layers updated (include zero for water column)
+		nlayers = maxstackov;
 
-			}	//end loop over rows
+		//if the property is doc concentration (cdoc) (pid == 1)
+		if(pid == 1)
+		{
+			//set the doc concentration (g/m3) f(x,y,z,t)
+			envstack = cdocov;
+		}
+		//if the property is effection fraction of doc (fdoc) (pid == 2)
+		else if(pid == 2)
+		{
+			//set the fdoc (dimensionless) f(x,y,z,t)
+			envstack = fdocov;
 		}
 		//if the property is hardness (pid == 3)
 		else if(pid == 3)
 		{
-			//Loop over rows
-			for(i=1; i<=nrows; i++)
-			{
-				//Loop over columns
-				for(j=1; j<=ncols; j++)
-				{
-					//if the cell is in the domain (is not null)
-					if(imask[i][j] != nodatavalue)
-					{
-						//loop over layers (include zero for water column)
-						for(k=0; k<=maxstackov; k++)
-						{
-							//set the time function id for this cell
-							tfid = envovtfid[iprop][i][j][k];
-
-							//if a time function exists for this cell (tfid > 0)
-							if(tfid > 0)
-							{
-								//set the hardness value (g/m3) f(x,y,z,t)
-								hardnessov[i][j][k] = envov[iprop][i][j][k] * envovtfinterp[iprop][tfid];
-							}
-							else	//else, no time function exists
-							{
-								//set the hardness value (g/m3) f(x,y,z)
-								hardnessov[i][j][k] = envov[iprop][i][j][k];
-
-							}	//end if envovtfid > 0
-
-						}	//end loop over layers
-
-					}	//end if imask[][] != nodatavalue
-
-				}	//end loop over columns
-
-			}	//end loop over rows
+			//set the hardness (g/m3) f(x,y,z,t)
+			envstack = hardnessov;
 		}
 		//if the property is pH (pid == 4)
 		else if(pid == 4)
 		{
-			//Loop over rows
-			for(i=1; i<=nrows; i++)
-			{
-				//Loop over columns
-				for(j=1; j<=ncols; j++)
-				{
-					//if the cell is in the domain (is not null)
-					if(imask[i][j] != nodatavalue)
-					{
-						//loop over layers (include zero for water column)
-						for(k=0; k<=maxstackov; k++)
-						{
-							//set the time function id for this cell
-							tfid = envovtfid[iprop][i][j][k];
-
-							//if a time function exists for this cell (tfid > 0)
-							if(tfid > 0)
-							{
-								//set the pH value (s.u.) f(x,y,z,t)
-								phov[i][j][k] = envov[iprop][i][j][k] * envovtfinterp[iprop][tfid];
-							}
-							else	//else, no time function exists
-							{
-								//set the pH value (s.u.) f(x,y,z)
-								phov[i][j][k] = envov[iprop][i][j][k];
-
-							}	//end if envovtfid > 0
-
-						}	//end loop over layers
-
-					}	//end if imask[][] != nodatavalue
-
-				}	//end loop over columns
-
-			}	//end loop over rows
+			//set the pH (s.u.) f(x,y,z,t)
+			envstack = phov;
 		}
 		//if the property is water/soil temperature (pid == 5)
 		else if(pid == 5)
 		{
-			//Loop over rows
-			for(i=1; i<=nrows; i++)
-			{
-				//Loop over columns
-				for(j=1; j<=ncols; j++)
-				{
-					//if the cell is in the domain (is not null)
-					if(imask[i][j] != nodatavalue)
-					{
-						//loop over layers (include zero for water column)
-						for(k=0; k<=maxstackov; k++)
-						{
-							//set the time function id for this cell
-							tfid = envovtfid[iprop][i][j][k];
-
-							//if a time function exists for this cell (tfid > 0)
-							if(tfid > 0)
-							{
-								//set the water/soil temperature value (C) f(x,y,z,t)
-								temperatureov[i][j][k] = envov[iprop][i][j][k] * envovtfinterp[iprop][tfid];
-							}
-							else	//else, no time function exists
-							{
-								//set the water/soil temperature value (C) f(x,y,z)
-								temperatureov[i][j][k] = envov[iprop][i][j][k];
-
-							}	//end if envovtfid > 0
-
-						}	//end loop over layers
-
-					}	//end if imask[][] != nodatavalue
-
-				}	//end loop over columns
-
-			}	//end loop over rows
+			//set the water/soil temperature (C) f(x,y,z,t)
+			envstack = temperatureov;
 		}
 		//if the property is oxidant/radical concentration (pid == 6)
 		else if(pid == 6)
 		{
-			//Loop over rows
-			for(i=1; i<=nrows; i++)
-			{
-				//Loop over columns
-				for(j=1; j<=ncols; j++)
-				{
-					//if the cell is in the domain (is not null)
-					if(imask[i][j] != nodatavalue)
-					{
-						//loop over layers (include zero for water column)
-						for(k=0; k<=maxstackov; k++)
-						{
-							//set the time function id for this cell
-							tfid = envovtfid[iprop][i][j][k];
-
-							//if a time function exists for this cell (tfid > 0)
-							if(tfid > 0)
-							{
-								//set the oxidant/radical concentration value (g/m3) f(x,y,z,t)
-								oxradov[i][j][k] = envov[iprop][i][j][k] * envovtfinterp[iprop][tfid];
-							}
-							else	//else, no time function exists
-							{
-								//set the oxidant/radical concentration value (g/m3) f(x,y,z)
-								oxradov[i][j][k] = envov[iprop][i][j][k];
-
-							}	//end if envovtfid > 0
-
-						}	//end loop over layers
-
-					}	//end if imask[][] != nodatavalue
-
-				}	//end loop over columns
-
-			}	//end loop over rows
+			//set the oxidant/radical concentration (g/m3) f(x,y,z,t)
+			envstack = oxradov;
 		}
 		//if the property is bacterial concentration (pid == 7)
 		else if(pid == 7)
 		{
-			//Loop over rows
-			for(i=1; i<=nrows; i++)
-			{
-				//Loop over columns
-				for(j=1; j<=ncols; j++)
-				{
-					//if the cell is in the domain (is not null)
-					if(imask[i][j] != nodatavalue)
-					{
-						//loop over layers (include zero for water column)
-						for(k=0; k<=maxstackov; k++)
-						{
-							//set the time function id for this cell
-							tfid = envovtfid[iprop][i][j][k];
-
-							//if a time function exists for this cell (tfid > 0)
-							if(tfid > 0)
-							{
-								//set the bacteria concentration value (cells/100 mL) f(x,y,z,t)
-								bacteriaov[i][j][k] = envov[iprop][i][j][k] * envovtfinterp[iprop][tfid];
-							}
-							else	//else, no time function exists
-							{
-								//set the bacteria concentration value (cells/100 mL) f(x,y,z)
-								bacteriaov[i][j][k] = envov[iprop][i][j][k];
-
-							}	//end if envovtfid > 0
-
-						}	//end loop over layers
-
-					}	//end if imask[][] != nodatavalue
-
-				}	//end loop over columns
-
-			}	//end loop over rows
+			//set the bacteria concentration (cells/100 mL) f(x,y,z,t)
+			envstack = bacteriaov;
 		}
 		//if the property is light extinction coefficient (pid == 8)
 		else if(pid == 8)
 		{
-			//Loop over rows
-			for(i=1; i<=nrows; i++)
-			{
-				//Loop over columns
-				for(j=1; j<=ncols; j++)
-				{
-					//if the cell is in the domain (is not null)
-					if(imask[i][j] != nodatavalue)
-					{
-						//set layer to water column
-						k=0;
+			//set the light extinction coefficient (1/m) f(x,y,t)
+			envstack = extinctionov;
 
-						//set the time function id for this cell
-						tfid = envovtfid[iprop][i][j][k];
-
-						//if a time function exists for this cell (tfid > 0)
-						if(tfid > 0)
-						{
-							//set the light extinction coefficient value (1/m) f(x,y,t)
-							extinctionov[i][j][k] = envov[iprop][i][j][k] * envovtfinterp[iprop][tfid];
-						}
-						else	//else, no time function exists
-						{
-							//set the light extinction coefficient value (1/m) f(x,y)
-							extinctionov[i][j][k] = envov[iprop][i][j][k];
+			//only the water column is updated
+			nlayers = 0;
+		}
+		//if the property is user-defined reaction property (pid == 9)
+		else if(pid == 9)
+		{
+			//set the user-defined reaction value f(x,y,z,t)
+			envstack = udrpropov;
+		}
+		//else, the property is undefined
+		else
+		{
+			//Write error message to file
+			fprintf(echofile_fp, "\n\n\nEnvironmental Property Error:\n");
+			fprintf(echofile_fp,       "  Undefined environmental property\n");
+			fprintf(echofile_fp,       "  Overland Property ID = %d\n", pid);
+			fprintf(echofile_fp,       "  No property for this identifier");
 
-						}	//end if envovtfid > 0
+			//Write error message to screen
+			printf(              "\n\n\nEnvironmental Property Error:\n");
+			printf(                    "  Undefined environmental property\n");
+			printf(                    "  Overland Property ID = %d\n", pid);
+			printf(                    "  No property for this identifier");
 
-					}	//end if imask[][] != nodatavalue
+			exit(EXIT_FAILURE);					//abort
 
-				}	//end loop over columns
+		}	//end if pid == 1 etc...
 
-			}	//end loop over rows
-		}
-		//if the property is user-defined reaction property (pid == 9)
-		else if(pid == 9)
+		//if a zone value changed (or the property is distributed)
+		if(UpdateOverlandZones(iprop) > 0)
 		{
 			//Loop over rows
 			for(i=1; i<=nrows; i++)
@@ -669,23 +365,16 @@ void UpdateEnvironment()
 					if(imask[i][j] != nodatavalue)
 					{
 						//loop over layers (include zero for water column)
-						for(k=0; k<=maxstackov; k++)
+						for(k=0; k<=nlayers; k++)
 						{
-							//set the time function id for this cell
-							tfid = envovtfid[iprop][i][j][k];
+							//save the value before the update
+							docvalue = envstack[i][j][k];
 
-							//if a time function exists for this cell (tfid > 0)
-							if(tfid > 0)
-							{
-								//set the user-defined reaction value f(x,y,z,t)
-								udrpropov[i][j][k] = envov[iprop][i][j][k] * envovtfinterp[iprop][tfid];
-							}
-							else	//else, no time function exists
-							{
-								//set the user-defined reaction value f(x,y,z)
-								udrpropov[i][j][k] = envov[iprop][i][j][k];
+							//set the property value f(x,y,z,t)
+							envstack[i][j][k] = EnvOverlandValue(iprop, i, j, k);
 
-							}	//end if envovtfid > 0
+							//if chemicals are simulated and a doc value changed, the partitioning of the cell is stale
+							if(ksim > 2 && pid <= 2 && envstack[i][j][k] != docvalue) partstaleov[i][j] = 1;
 
 						}	//end loop over layers
 
@@ -694,25 +383,8 @@ void UpdateEnvironment()
 				}	//end loop over columns
 
 			}	//end loop over rows
-		}
-		//else, the property is undefined
-		else
-		{
-			//Write error message to file
-			fprintf(echofile_fp, "\n\n\nEnvironmental Property Error:\n");
-			fprintf(echofile_fp,       "  Undefined environmental property\n");
-			fprintf(echofile_fp,       "  Overland Property ID = %d\n", pid);
-			fprintf(echofile_fp,       "  No property for this identifier");
 
-			//Write error message to screen
-			printf(              "\n\n\nEnvironmental Property Error:\n");
-			printf(                    "  Undefined environmental property\n");
-			printf(                    "  Overland Property ID = %d\n", pid);
-			printf(                    "  No property for this identifier");
-
-			exit(EXIT_FAILURE);					//abort
-
-		}	//end if pid == 1 etc...
+		}	//end if UpdateOverlandZones() > 0
 
 	}	//end loop over number of overland properties
 
@@ -722,7 +394,7 @@ void UpdateEnvironment()
 		//Update channel environmental functions...
 		//
 		//loop over number of channel functions
-		for(iprop=1; iprop<=npropov; iprop++)
+		for(iprop=1; iprop<=npropch; iprop++)
 		{
 			//set property identification
 			pid = pidch[iprop];
@@ -742,6 +414,9 @@ void UpdateEnvironment()
 							//set the time function id for this cell
 							tfid = envchtfid[iprop][i][j][k];
 
+							//save the value before the update
+							docvalue = cdocch[i][j][k];
+
 							//if a time function exists for this cell (tfid > 0)
 							if(tfid > 0)
 							{
@@ -755,6 +430,9 @@ void UpdateEnvironment()
 
 							}	//end if envchtfid > 0
 
+							//if chemicals are simulated and the value changed, the partitioning of the node is stale
+							if(ksim > 2 && cdocch[i][j][k] != docvalue) partstalech[i][j] = 1;
+
 						}	//end loop over layers
 
 					}	//end loop over nodes
@@ -776,6 +454,9 @@ void UpdateEnvironment()
 							//set the time function id for this cell
 							tfid = envchtfid[iprop][i][j][k];
 
+							//save the value before the update
+							docvalue = fdocch[i][j][k];
+
 							//if a time function exists for this cell (tfid > 0)
 							if(tfid > 0)
 							{
@@ -789,6 +470,9 @@ void UpdateEnvironment()
 
 							}	//end if envchtfid > 0
 
+							//if chemicals are simulated and the value changed, the partitioning of the node is stale
+							if(ksim > 2 && fdocch[i][j][k] != docvalue) partstalech[i][j] = 1;
+
 						}	//end loop over layers
 
 					}	//end loop over nodes
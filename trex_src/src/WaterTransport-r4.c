@@ -62,6 +62,21 @@ C-
 C-  Revisions:	Added logic to calculate iteration success for
 C-              time step option (dtopt) implementation
 C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Accepted time steps are recorded by RecordTimeStep
+C-              (after the mass balances) instead of here.
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Kernel snapshot hooks (CaptureKernel) around
+C-              Infiltration, OverlandWaterRoute, and
+C-              ChannelWaterRoute.
+C-
 C-  Revised:
 C-
 C-  Date:
@@ -139,13 +154,39 @@ void WaterTransport()
 		//if infiltration is simulated
 		if(infopt > 0)
 		{
+			//if the kernel is captured to a snapshot file (see KernelSnapshot)
+			if(snapshotkernel == KERNELINFILTRATION)
+			{
+				//write the kernel state before the kernel
+				CaptureKernel(0);
+			}
+
 			//compute infiltration rate (average over integration time step)
 			Infiltration();
+
+			//if the kernel is captured, write the kernel outputs after the kernel
+			if(snapshotkernel == KERNELINFILTRATION)
+			{
+				CaptureKernel(1);
+			}
 		}
 		
+		//if the kernel is captured to a snapshot file (see KernelSnapshot)
+		if(snapshotkernel == KERNELOVWATER)
+		{
+			//write the kernel state before the kernel
+			CaptureKernel(0);
+		}
+
 		//compute overland flows and routing
 		OverlandWaterRoute();
 
+		//if the kernel is captured, write the kernel outputs after the kernel
+		if(snapshotkernel == KERNELOVWATER)
+		{
+			CaptureKernel(1);
+		}
+
 		//if channels are simulated
 		if(chnopt > 0)
 		{
@@ -157,9 +198,22 @@ void WaterTransport()
 
 			}	//end if ctlopt > 0
 
+			//if the kernel is captured to a snapshot file (see KernelSnapshot)
+			if(snapshotkernel == KERNELCHWATER)
+			{
+				//write the kernel state before the kernel
+				CaptureKernel(0);
+			}
+
 			//compute channel flows and routing
 			ChannelWaterRoute();
 
+			//if the kernel is captured, write the kernel outputs after the kernel
+			if(snapshotkernel == KERNELCHWATER)
+			{
+				CaptureKernel(1);
+			}
+
 			//compute water transfers between overland plane and channels
 			FloodplainWaterTransfer();
 		}
@@ -205,62 +259,10 @@ void WaterTransport()
 				//set the success flag to indicate success
 				successflag = 0;
 
-				//if present time step value differs from prior value
-				//  and simulation time is greater than start time
-//				if(dt[idt] != dt[idt-1] && simtime > tstart)
-				if(dt[idt] != dt[idt-1])
-				{
-					//Set time for saved time step...
-					//
-					//Developer's Note:  Further development may be needed to address loss
-					//                   of precision because dttime is float and simtime
-					//                   is double.
-					//
-					//Note:  Values for dttime value are stored in the [idt-1]
-					//       element of the array because they indicate the end
-					//       time for use of the prior dt value in the series.
-					//
-					//set time for successful time step (hrs)
-					dttime[idt-1] = (float)(simtime);
-
-					//increment total number of time steps in series
-					ndt = ndt + 1;
-
-					//increment timestep buffer index
-					bdt = bdt + 1;
-
-					//Note:  MAXBUFFER controls the size of the array used to
-					//       store dt[] and dttime[] value pairs.  When all
-					//       array elements are full, the buffer is written
-					//       to file and cleared to store any further values.
-					//
-					//if buffer for stored time step values is full
-					if(bdt == MAXBUFFERSIZE)
-					{
-						//write time step series (dt, dttime pairs) to buffer file
-						WriteDTBuffer();
-
-						//reset buffer counter (bdt) to zero (flush the buffer)
-						bdt = 0;
-
-						//move dt to the start of the array...
-						//
-						//Note:  Mass balance calculations depend on dt[idt].
-						//       We need to flush the buffer and set idt to
-						//       zero.  Because idt will equal zero, the value
-						//       of dt stored in the MAXBUFFER array element
-						//       must be moved to the zeroeth array element
-						//       before mass balance calculations occur.
-						//
-						//store dt to the head of the array, dt[1]
-						dt[0] = dt[idt];
-
-						//reset the count of timesteps
-						idt = 0;
-
-					}	//end if bdt = maxbuffersize
-
-				}	//end if dt[idt] not equal to dt[idt-1]
+				//Note:  The time step is recorded in the time step series
+				//       (dt, dttime) by RecordTimeStep once the time step
+				//       is accepted (after the mass balances) so that time
+				//       steps rejected by step recovery are not recorded.
 
 			}	//end if courant > maxcourant etc...
 		}
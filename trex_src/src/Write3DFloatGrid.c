@@ -35,6 +35,12 @@ C-  Revisions:	Added code so that errors caused by bad file names
 C-              and paths are are reported to the simulation error
 C-              file in addition to the screen.
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Output files are opened by OpenOutputFile.
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -77,7 +83,7 @@ void Write3DFloatGrid(char name[], float ***gridvalue, int ilayer)
 	gridfile_fp = NULL;
 
 	//open the grid file for writing
-	gridfile_fp = fopen(gridfile, "w");
+	gridfile_fp = OpenOutputFile(gridfile, "w");
 
 	//if the local grid file pointer is null, abort execution
 	if(gridfile_fp == NULL)
@@ -24,6 +24,12 @@ C-              Mahwah, NJ  07430
 C-				
 C-	Date:		29-JUL-2010
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Output files are opened by OpenOutputFile.
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -48,7 +54,7 @@ void WriteDTBuffer()
 	dtbufferfile_fp = NULL;
 
 	//Open the time step buffer file for writing (append mode)
-	dtbufferfile_fp=fopen(dtbufferfile,"a");
+	dtbufferfile_fp=OpenOutputFile(dtbufferfile,"a");
 
 	//if the time step buffer file pointer is null, abort execution
 	if(dtbufferfile_fp==NULL)
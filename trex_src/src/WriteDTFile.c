@@ -23,6 +23,12 @@ C-              Mahwah, NJ  07430
 C-				
 C-	Date:		29-JUL-2010
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Output files are opened by OpenOutputFile.
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -47,7 +53,7 @@ void WriteDTFile()
 	dtoutputfile_fp = NULL;
 
 	//Open the time step output file for writing
-	dtoutputfile_fp=fopen(dtoutputfile,"w");
+	dtoutputfile_fp=OpenOutputFile(dtoutputfile,"w");
 
 	//if the time step output file pointer is null, abort execution
 	if(dtoutputfile_fp==NULL)
@@ -26,6 +26,12 @@ C-				Fort Collins, CO 80523
 C-
 C-	Date:		09-FEB-2004
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Output files are opened by OpenOutputFile.
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -74,7 +80,7 @@ void WriteDumpFile()
 	dmpfile_fp = NULL;
 
 	//open the dump file (in append mode)
-	dmpfile_fp = fopen(dmpfile, "a");
+	dmpfile_fp = OpenOutputFile(dmpfile, "a");
 
 	//if file pointer is still null, then abort
 	if(dmpfile_fp == NULL)
@@ -34,6 +34,20 @@ C-  Revisions:	Added code so that errors caused by bad file names
 C-              and paths are are reported to the simulation error
 C-              file in addition to the screen.
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Overland slots are addressed through OVSLOT; sources
+C-              without an overland slot are written as zero so the
+C-              file layout is unchanged.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Output files are opened by OpenOutputFile.
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -83,7 +97,7 @@ void WriteMassBalanceChemical()
 	msbfile_fp = NULL;
 
 	//open the mass balance file (in append mode)
-	msbfile_fp = fopen(msbfile, "a");
+	msbfile_fp = OpenOutputFile(msbfile, "a");
 
 	//if file pointer is still null, then abort
 	if(msbfile_fp == NULL)
@@ -252,7 +266,7 @@ void WriteMassBalanceChemical()
 					for(k=0; k<=10; k++)
 					{
 						//write summary for the current cell (Part 2a: advection inflows)
-						fprintf(msbfile_fp,"\t%f", advchemovinmass[ichem][i][j][k]);
+						fprintf(msbfile_fp,"\t%f", OVSOURCE(k) ? advchemovinmass[ichem][i][j][OVSLOT(k)] : 0.0);
 
 					}	//end loop over advective flow sources
 
@@ -260,7 +274,7 @@ void WriteMassBalanceChemical()
 					for(k=1; k<=10; k++)
 					{
 						//write summary for the current cell (Part 2b: dispersion inflows)
-						fprintf(msbfile_fp,"\t%f", dspchemovinmass[ichem][i][j][k]);
+						fprintf(msbfile_fp,"\t%f", OVSOURCE(k) ? dspchemovinmass[ichem][i][j][OVSLOT(k)] : 0.0);
 
 					}	//end loop over dispersive flow sources
 
@@ -298,7 +312,7 @@ void WriteMassBalanceChemical()
 					for(k=0; k<=10; k++)
 					{
 						//write summary for the current cell (Part 3a: advection outflows)
-						fprintf(msbfile_fp,"\t%f", advchemovoutmass[ichem][i][j][k]);
+						fprintf(msbfile_fp,"\t%f", OVSOURCE(k) ? advchemovoutmass[ichem][i][j][OVSLOT(k)] : 0.0);
 
 					}	//end loop over advective flow sources
 
@@ -306,7 +320,7 @@ void WriteMassBalanceChemical()
 					for(k=1; k<=10; k++)
 					{
 						//write summary for the current cell (Part 3b: dispersion outflows)
-						fprintf(msbfile_fp,"\t%f", dspchemovoutmass[ichem][i][j][k]);
+						fprintf(msbfile_fp,"\t%f", OVSOURCE(k) ? dspchemovoutmass[ichem][i][j][OVSLOT(k)] : 0.0);
 
 					}	//end loop over dispersive flow sources
 
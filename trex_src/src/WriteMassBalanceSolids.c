@@ -34,6 +34,20 @@ C-  Revisions:	Added code so that errors caused by bad file names
 C-              and paths are are reported to the simulation error
 C-              file in addition to the screen.
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Overland slots are addressed through OVSLOT; sources
+C-              without an overland slot are written as zero so the
+C-              file layout is unchanged.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Output files are opened by OpenOutputFile.
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -80,7 +94,7 @@ void WriteMassBalanceSolids()
 	msbfile_fp = NULL;
 
 	//open the mass balance file (in append mode)
-	msbfile_fp = fopen(msbfile, "a");
+	msbfile_fp = OpenOutputFile(msbfile, "a");
 
 	//if file pointer is still null, then abort
 	if(msbfile_fp == NULL)
@@ -214,7 +228,7 @@ void WriteMassBalanceSolids()
 					for(k=0; k<=10; k++)
 					{
 						//write summary for the current cell (Part 2a: advection inflows)
-						fprintf(msbfile_fp,"\t%f", advsedovinmass[isolid][i][j][k]);
+						fprintf(msbfile_fp,"\t%f", OVSOURCE(k) ? advsedovinmass[isolid][i][j][OVSLOT(k)] : 0.0);
 
 					}	//end loop over advective flow sources
 
@@ -222,7 +236,7 @@ void WriteMassBalanceSolids()
 					for(k=1; k<=10; k++)
 					{
 						//write summary for the current cell (Part 2b: dispersion inflows)
-						fprintf(msbfile_fp,"\t%f", dspsedovinmass[isolid][i][j][k]);
+						fprintf(msbfile_fp,"\t%f", OVSOURCE(k) ? dspsedovinmass[isolid][i][j][OVSLOT(k)] : 0.0);
 
 					}	//end loop over dispersive flow sources
 
@@ -236,7 +250,7 @@ void WriteMassBalanceSolids()
 					for(k=0; k<=10; k++)
 					{
 						//write summary for the current cell (Part 3a: advection outflows)
-						fprintf(msbfile_fp,"\t%f", advsedovoutmass[isolid][i][j][k]);
+						fprintf(msbfile_fp,"\t%f", OVSOURCE(k) ? advsedovoutmass[isolid][i][j][OVSLOT(k)] : 0.0);
 
 					}	//end loop over advective flow sources
 
@@ -244,7 +258,7 @@ void WriteMassBalanceSolids()
 					for(k=1; k<=10; k++)
 					{
 						//write summary for the current cell (Part 3b: dispersion outflows)
-						fprintf(msbfile_fp,"\t%f", dspsedovoutmass[isolid][i][j][k]);
+						fprintf(msbfile_fp,"\t%f", OVSOURCE(k) ? dspsedovoutmass[isolid][i][j][OVSLOT(k)] : 0.0);
 
 					}	//end loop over dispersive flow sources
 
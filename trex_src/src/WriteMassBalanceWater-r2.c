@@ -34,6 +34,20 @@ C-  Revisions:	Added code so that errors caused by bad file names
 C-              and paths are are reported to the simulation error
 C-              file in addition to the screen.
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Overland slots are addressed through OVSLOT; sources
+C-              without an overland slot are written as zero so the
+C-              file layout is unchanged.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Output files are opened by OpenOutputFile.
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -74,7 +88,7 @@ void WriteMassBalanceWater()
 	msbfile_fp = NULL;
 
 	//open the mass balance file (in append mode)
-	msbfile_fp = fopen(msbfile, "a");
+	msbfile_fp = OpenOutputFile(msbfile, "a");
 
 	//if file pointer is still null, then abort
 	if(msbfile_fp == NULL)
@@ -242,7 +256,7 @@ void WriteMassBalanceWater()
 				for(k=0; k<=10; k++)
 				{
 					//write summary for the current cell (Part 2: inflows)
-					fprintf(msbfile_fp,"\t%f", dqovinvol[i][j][k]);
+					fprintf(msbfile_fp,"\t%f", OVSOURCE(k) ? dqovinvol[i][j][OVSLOT(k)] : 0.0);
 
 				}	//end loop over flow sources
 
@@ -250,7 +264,7 @@ void WriteMassBalanceWater()
 				for(k=0; k<=10; k++)
 				{
 					//write summary for the current cell (Part 3: outflows)
-					fprintf(msbfile_fp,"\t%f", dqovoutvol[i][j][k]);
+					fprintf(msbfile_fp,"\t%f", OVSOURCE(k) ? dqovoutvol[i][j][OVSLOT(k)] : 0.0);
 
 				}	//end loop over flow sources
 
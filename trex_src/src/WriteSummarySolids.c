@@ -47,6 +47,12 @@ C-  Revisions:	Added code so that errors caused by bad file names
 C-              and paths are are reported to the simulation error
 C-              file in addition to the screen.
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Output files are opened by OpenOutputFile.
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -83,7 +89,7 @@ void WriteSummarySolids()
 	statsfile_fp = NULL;
 
 	//open the summary statistics file (in append mode)
-	statsfile_fp = fopen(statsfile, "a");
+	statsfile_fp = OpenOutputFile(statsfile, "a");
 
 	//if file pointer is still null, then abort
 	if(statsfile_fp == NULL)
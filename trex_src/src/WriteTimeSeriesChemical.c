@@ -9,9 +9,10 @@ C-	Inputs:		chemreport
 C-
 C-	Outputs:	
 C-
-C-	Controls:   nchemreports, chemconvert
+C-	Controls:   nchemreports, chemconvert, tsstoreopt
 C-
-C-	Calls:		None
+C-	Calls:		OpenOutputFile, BeginSeriesRow, ExportValue,
+C-              EndSeriesRow
 C-
 C-	Called by:	WriteTimeSeries
 C-
@@ -39,6 +40,26 @@ C-  Revisions:	Added code so that errors caused by bad file names
 C-              and paths are are reported to the simulation error
 C-              file in addition to the screen.
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Overland source/direction slots are addressed
+C-              through OVSLOT (compact overland slot storage).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Output files are opened by OpenOutputFile.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Time series rows can be written to columnar series
+C-              stores (-tsstore, see SeriesStore)
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -190,22 +211,32 @@ void WriteTimeSeriesChemical()
 			//Set the chemical export file pointer to null
 			chemexpfile_fp = NULL;
 
-			//open the chemical export file for writing in append mode
-			chemexpfile_fp = fopen(chemexpfile[igroup], "a");
-
-			//if the chemical export file pointer is null, abort execution
-			if(chemexpfile_fp == NULL)
+			//if time series are written to series stores
+			if(tsstoreopt > 0)
 			{
-				//Write message to file
-				fprintf(echofile_fp, "Error! Can't open Chemical Export File:  %s\n", chemexpfile[igroup]);
-
-				//Write message to screen
-				printf("Error! Can't open Chemical Export File:  %s\n", chemexpfile[igroup]);
-				exit(EXIT_FAILURE);	//abort
+				//start a row of the chemical export store (the store keeps the time)
+				BeginSeriesRow(chemexpfile[igroup]);
 			}
+			else	//else time series are written to text export files
+			{
+				//open the chemical export file for writing in append mode
+				chemexpfile_fp = OpenOutputFile(chemexpfile[igroup], "a");
+
+				//if the chemical export file pointer is null, abort execution
+				if(chemexpfile_fp == NULL)
+				{
+					//Write message to file
+					fprintf(echofile_fp, "Error! Can't open Chemical Export File:  %s\n", chemexpfile[igroup]);
+
+					//Write message to screen
+					printf("Error! Can't open Chemical Export File:  %s\n", chemexpfile[igroup]);
+					exit(EXIT_FAILURE);	//abort
+				}
 
-			//Write current simulation time (hours)
-			fprintf(chemexpfile_fp,"%f",simtime);
+				//Write current simulation time (hours)
+				fprintf(chemexpfile_fp,"%f",simtime);
+
+			}	//end if tsstoreopt > 0
 
 			//Loop over number of chemical reporting stations
 			for(j=1; j<=nchemreports; j++)
@@ -251,16 +282,16 @@ void WriteTimeSeriesChemical()
 					//initialize sum of outflows to zero
 					dqsum = 0.0;
 
-					//loop over directions (1-8)
-					for(k=1; k<=8; k++)
+					//loop over directions (flow is only routed in cardinal directions)
+					for(k=1; k<=7; k=k+2)
 					{
 						//compute sum of outflows (m3/s)
-						dqsum = dqsum + dqovout[sedreprow[j]][sedrepcol[j]][k];
+						dqsum = dqsum + dqovout[sedreprow[j]][sedrepcol[j]][OVSLOT(k)];
 
 					}	//end loop over outflows
 
 					//add flow out domain boundary (k=10)
-					dqsum = dqsum + dqovout[sedreprow[j]][sedrepcol[j]][10];
+					dqsum = dqsum + dqovout[sedreprow[j]][sedrepcol[j]][OVSLOT(10)];
 
 					//overland discharge is product of overland outflow and scale factor
 					dischargeov = dqsum * advovscale;
@@ -274,11 +305,11 @@ void WriteTimeSeriesChemical()
 					//       station is at an outlet and the reporting unit is kg/day
 					//
 					//total chemical overland
-					fprintf(chemexpfile_fp,",%e",
+					ExportValue(chemexpfile_fp, ",%e",
 						totcgroupsumov[igroup][j] * dischargeov * chemconvert[j]);
 
 					//total chemical channels
-					fprintf(chemexpfile_fp,",%e",
+					ExportValue(chemexpfile_fp, ",%e",
 						totchemreportch[igroup][j] * dischargech * chemconvert[j]);
 
 					//sum overland and channel discharges
@@ -286,15 +317,15 @@ void WriteTimeSeriesChemical()
 						+ totcgroupsumch[igroup][j] * dischargech);
 
 					//total chemical overland and channel sum
-					fprintf(chemexpfile_fp,",%e",
+					ExportValue(chemexpfile_fp, ",%e",
 						totcgroupsumtot * chemconvert[j]);
 
 					//dissolved chemical overland
-					fprintf(chemexpfile_fp,",%e",
+					ExportValue(chemexpfile_fp, ",%e",
 						discgroupsumov[igroup][j] * dischargeov * chemconvert[j]);
 
 					//dissolved chemical channels
-					fprintf(chemexpfile_fp,",%e",
+					ExportValue(chemexpfile_fp, ",%e",
 						discgroupsumch[igroup][j] * dischargech * chemconvert[j]);
 
 					//sum overland and channel discharges
@@ -302,15 +333,15 @@ void WriteTimeSeriesChemical()
 						+ discgroupsumch[igroup][j] * dischargech);
 
 					//dissolved chemical overland and channel sum
-					fprintf(chemexpfile_fp,",%e",
+					ExportValue(chemexpfile_fp, ",%e",
 						discgroupsumtot * chemconvert[j]);
 
 					//bound chemical overland
-					fprintf(chemexpfile_fp,",%e",
+					ExportValue(chemexpfile_fp, ",%e",
 						bndcgroupsumov[igroup][j] * dischargeov * chemconvert[j]);
 
 					//bound chemical channels
-					fprintf(chemexpfile_fp,",%e",
+					ExportValue(chemexpfile_fp, ",%e",
 						bndcgroupsumch[igroup][j] * dischargech * chemconvert[j]);
 
 					//sum overland and channel discharges
@@ -318,15 +349,15 @@ void WriteTimeSeriesChemical()
 						+ bndcgroupsumch[igroup][j] * dischargech);
 
 					//bound chemical overland and channel sum
-					fprintf(chemexpfile_fp,",%e",
+					ExportValue(chemexpfile_fp, ",%e",
 						bndcgroupsumtot * chemconvert[j]);
 
 					//particulate chemical overland
-					fprintf(chemexpfile_fp,",%e",
+					ExportValue(chemexpfile_fp, ",%e",
 						prtcgroupsumov[igroup][j] * dischargeov * chemconvert[j]);
 
 					//particulate chemical channels
-					fprintf(chemexpfile_fp,",%e",
+					ExportValue(chemexpfile_fp, ",%e",
 						prtcgroupsumch[igroup][j] * dischargech * chemconvert[j]);
 
 					//sum overland and channel discharges
@@ -334,7 +365,7 @@ void WriteTimeSeriesChemical()
 						+ prtcgroupsumch[igroup][j] * dischargech);
 
 					//particulate chemical overland and channel sum
-					fprintf(chemexpfile_fp,",%e",
+					ExportValue(chemexpfile_fp, ",%e",
 						prtcgroupsumtot * chemconvert[j]);
 				}
 				else	//chemical units reporting option != 2 (=1)
@@ -342,46 +373,56 @@ void WriteTimeSeriesChemical()
 					//Report output in g/m3 (mg/L)
 					//
 					//total chemical overland
-					fprintf(chemexpfile_fp,",%e",
+					ExportValue(chemexpfile_fp, ",%e",
 						totcgroupsumov[igroup][j] * chemconvert[j]);
 
 					//total chemical channels
-					fprintf(chemexpfile_fp,",%e",
+					ExportValue(chemexpfile_fp, ",%e",
 						totcgroupsumch[igroup][j] * chemconvert[j]);
 
 					//dissolved chemical overland
-					fprintf(chemexpfile_fp,",%e",
+					ExportValue(chemexpfile_fp, ",%e",
 						discgroupsumov[igroup][j] * chemconvert[j]);
 
 					//dissolved chemical channels
-					fprintf(chemexpfile_fp,",%e",
+					ExportValue(chemexpfile_fp, ",%e",
 						discgroupsumch[igroup][j] * chemconvert[j]);
 
 					//bound chemical overland
-					fprintf(chemexpfile_fp,",%e",
+					ExportValue(chemexpfile_fp, ",%e",
 						bndcgroupsumov[igroup][j] * chemconvert[j]);
 
 					//bound chemical channels
-					fprintf(chemexpfile_fp,",%e",
+					ExportValue(chemexpfile_fp, ",%e",
 						bndcgroupsumch[igroup][j] * chemconvert[j]);
 
 					//particulate chemical overland
-					fprintf(chemexpfile_fp,",%e",
+					ExportValue(chemexpfile_fp, ",%e",
 						prtcgroupsumov[igroup][j] * chemconvert[j]);
 
 					//particulate chemical channels
-					fprintf(chemexpfile_fp,",%e",
+					ExportValue(chemexpfile_fp, ",%e",
 						prtcgroupsumch[igroup][j] * chemconvert[j]);
 
 				}	//end if chemunitsopt[] == 2
 
 			}	//end loop over	number of chemical reporting stations
 
-			//print a carriage return after each complete line
-			fprintf(chemexpfile_fp,"\n");
+			//if time series are written to series stores
+			if(tsstoreopt > 0)
+			{
+				//end the row of the chemical export store
+				EndSeriesRow();
+			}
+			else	//else time series are written to text export files
+			{
+				//print a carriage return after each complete line
+				fprintf(chemexpfile_fp,"\n");
+
+				//Close chemical export file
+				fclose(chemexpfile_fp);
 
-			//Close chemical export file
-			fclose(chemexpfile_fp);
+			}	//end if tsstoreopt > 0
 
 		}	//end loop over number of chemicals reporting groups
 
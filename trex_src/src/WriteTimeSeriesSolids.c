@@ -9,9 +9,10 @@ C-	Inputs:		sedreportov[][], sedreportch[][], sedconvert[]
 C-
 C-	Outputs:	
 C-
-C-	Controls:   nsedreports, sedunitsopt[]
+C-	Controls:   nsedreports, sedunitsopt[], tsstoreopt
 C-
-C-	Calls:		None
+C-	Calls:		OpenOutputFile, BeginSeriesRow, ExportValue,
+C-              EndSeriesRow
 C-
 C-	Called by:	WriteTimeSeries
 C-
@@ -48,6 +49,26 @@ C-  Revisions:	Added code so that errors caused by bad file names
 C-              and paths are are reported to the simulation error
 C-              file in addition to the screen.
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Overland source/direction slots are addressed
+C-              through OVSLOT (compact overland slot storage).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Output files are opened by OpenOutputFile.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Time series rows can be written to columnar series
+C-              stores (-tsstore, see SeriesStore)
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -149,22 +170,32 @@ void WriteTimeSeriesSolids()
 			//Set the sediment export file pointer to null
 			sedexpfile_fp = NULL;
 
-			//open the sediment export file for writing in append mode
-			sedexpfile_fp = fopen(sedexpfile[igroup], "a");
-
-			//if the sediment export file pointer is null, abort execution
-			if(sedexpfile_fp == NULL)
+			//if time series are written to series stores
+			if(tsstoreopt > 0)
 			{
-				//Write message to file
-				fprintf(echofile_fp, "Error! Can't open Sediment Export File:  %s\n", sedexpfile[igroup]);
-
-				//Write message to screen
-				printf("Error! Can't open Sediment Export File:  %s\n", sedexpfile[igroup]);
-				exit(EXIT_FAILURE);	//abort
+				//start a row of the sediment export store (the store keeps the time)
+				BeginSeriesRow(sedexpfile[igroup]);
 			}
+			else	//else time series are written to text export files
+			{
+				//open the sediment export file for writing in append mode
+				sedexpfile_fp = OpenOutputFile(sedexpfile[igroup], "a");
+
+				//if the sediment export file pointer is null, abort execution
+				if(sedexpfile_fp == NULL)
+				{
+					//Write message to file
+					fprintf(echofile_fp, "Error! Can't open Sediment Export File:  %s\n", sedexpfile[igroup]);
+
+					//Write message to screen
+					printf("Error! Can't open Sediment Export File:  %s\n", sedexpfile[igroup]);
+					exit(EXIT_FAILURE);	//abort
+				}
 
-			//Write current simulation time (hours)
-			fprintf(sedexpfile_fp,"%f",simtime);
+				//Write current simulation time (hours)
+				fprintf(sedexpfile_fp,"%f",simtime);
+
+			}	//end if tsstoreopt > 0
 
 			//Loop over number of sediment reporting stations
 			for(j=1; j<=nsedreports; j++)
@@ -210,16 +241,16 @@ void WriteTimeSeriesSolids()
 					//initialize sum of outflows to zero
 					dqsum = 0.0;
 
-					//loop over directions (1-8)
-					for(k=1; k<=8; k++)
+					//loop over directions (flow is only routed in cardinal directions)
+					for(k=1; k<=7; k=k+2)
 					{
 						//compute sum of outflows (m3/s)
-						dqsum = dqsum + dqovout[sedreprow[j]][sedrepcol[j]][k];
+						dqsum = dqsum + dqovout[sedreprow[j]][sedrepcol[j]][OVSLOT(k)];
 
 					}	//end loop over outflows
 
 					//add flow out domain boundary (k=10)
-					dqsum = dqsum + dqovout[sedreprow[j]][sedrepcol[j]][10];
+					dqsum = dqsum + dqovout[sedreprow[j]][sedrepcol[j]][OVSLOT(10)];
 
 					//overland discharge is product of overland outflow and scale factor
 					dischargeov = dqsum * advovscale;
@@ -228,12 +259,12 @@ void WriteTimeSeriesSolids()
 					//
 					//multiply output export by conversion factor
 					//and discharge and print to file
-					fprintf(sedexpfile_fp,",%e",
+					ExportValue(sedexpfile_fp, ",%e",
 						sgroupsumov[igroup][j] * dischargeov * sedconvert[j]);
 
 					//multiply output export by conversion factor
 					//and discharge and print to file
-					fprintf(sedexpfile_fp,",%e",
+					ExportValue(sedexpfile_fp, ",%e",
 						sgroupsumch[igroup][j] * dischargech * sedconvert[j]);
 
 					//Note:  The discharge sum only makes sense when the reporting
@@ -244,7 +275,7 @@ void WriteTimeSeriesSolids()
                         + sgroupsumch[igroup][j] * dischargech) * sedconvert[j]; 
 
 					//print sum of export to file
-					fprintf(sedexpfile_fp,",%e", sgroupsumtot);
+					ExportValue(sedexpfile_fp, ",%e", sgroupsumtot);
 				}
 				else	//sediment units reporting option != 2 (=1)
 				{
@@ -252,23 +283,33 @@ void WriteTimeSeriesSolids()
 					//
 					//multiply output export by conversion factor
 					//and print to file
-					fprintf(sedexpfile_fp,",%e",
+					ExportValue(sedexpfile_fp, ",%e",
 						sgroupsumov[igroup][j] * sedconvert[j]);
 
 					//multiply output export by conversion factor
 					//and discharge and print to file
-					fprintf(sedexpfile_fp,",%e",
+					ExportValue(sedexpfile_fp, ",%e",
 						sgroupsumch[igroup][j] * sedconvert[j]);
 
 				}	//end if sedunitsopt[] == 2
 
 			}	//end loop over	number of sediment reporting stations
 
-			//print a carriage return after each complete line
-			fprintf(sedexpfile_fp,"\n");
+			//if time series are written to series stores
+			if(tsstoreopt > 0)
+			{
+				//end the row of the sediment export store
+				EndSeriesRow();
+			}
+			else	//else time series are written to text export files
+			{
+				//print a carriage return after each complete line
+				fprintf(sedexpfile_fp,"\n");
+
+				//Close sediment export file
+				fclose(sedexpfile_fp);
 
-			//Close sediment export file
-			fclose(sedexpfile_fp);
+			}	//end if tsstoreopt > 0
 
 		}	//end loop over number of solids reporting groups
 
@@ -9,9 +9,10 @@ C-	Inputs:		qreport
 C-
 C-	Outputs:	
 C-
-C-	Controls:   ksim, nqreports, qconvert
+C-	Controls:   ksim, nqreports, qconvert, tsstoreopt
 C-
-C-	Calls:		None
+C-	Calls:		OpenOutputFile, BeginSeriesRow, ExportValue,
+C-              EndSeriesRow
 C-
 C-	Called by:	WriteTimeSeries
 C-
@@ -48,6 +49,19 @@ C-  Revisions:	Added code so that errors caused by bad file names
 C-              and paths are are reported to the simulation error
 C-              file in addition to the screen.
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Output files are opened by OpenOutputFile.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Time series rows can be written to columnar series
+C-              stores (-tsstore, see SeriesStore)
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -70,36 +84,46 @@ void WriteTimeSeriesWater()
 		//Set the water export file pointer to null
 		waterexpfile_fp = NULL;
 
-		//open the water export file for writing in append mode
-		waterexpfile_fp = fopen(waterexpfile, "a");
-
-		//if the water export file pointer is null, abort execution
-		if(waterexpfile_fp == NULL)
+		//if time series are written to series stores
+		if(tsstoreopt > 0)
 		{
-			//Write message to file
-			fprintf(echofile_fp, "Error! Can't open Water Export File:  %s\n", waterexpfile);
-
-			//Write message to screen
-			printf("Error! Can't open Water Export File:  %s\n", waterexpfile);
-			exit(EXIT_FAILURE);	//abort
+			//start a row of the water export store (the store keeps the time)
+			BeginSeriesRow(waterexpfile);
 		}
+		else	//else time series are written to text export files
+		{
+			//open the water export file for writing in append mode
+			waterexpfile_fp = OpenOutputFile(waterexpfile, "a");
+
+			//if the water export file pointer is null, abort execution
+			if(waterexpfile_fp == NULL)
+			{
+				//Write message to file
+				fprintf(echofile_fp, "Error! Can't open Water Export File:  %s\n", waterexpfile);
+
+				//Write message to screen
+				printf("Error! Can't open Water Export File:  %s\n", waterexpfile);
+				exit(EXIT_FAILURE);	//abort
+			}
+
+			//Write discharges at selected locations
+			//and print out in comma-delimited format
+			//
+			//Write current simulation time (hours)
+			fprintf(waterexpfile_fp,"%f",simtime);
 
-		//Write discharges at selected locations
-		//and print out in comma-delimited format
-		//
-		//Write current simulation time (hours)
-		fprintf(waterexpfile_fp,"%f",simtime);
+		}	//end if tsstoreopt > 0
 
 		//Loop over number of discharge reporting stations
 		for(i=1; i<=nqreports; i++)
 		{
 			//multiply output overland discharge by conversion factor
 			//and print to file
-			fprintf(waterexpfile_fp,",%f", qreportov[i]*qconvert[i]);
+			ExportValue(waterexpfile_fp, ",%f", qreportov[i]*qconvert[i]);
 
 			//multiply output channel discharge by conversion factor
 			//and print to file
-			fprintf(waterexpfile_fp,",%f", qreportch[i]*qconvert[i]);
+			ExportValue(waterexpfile_fp, ",%f", qreportch[i]*qconvert[i]);
 
 //mlv: delete the qreportsum or modify this code because the sum only
 //     makes sense when the reporting station is at an outlet...
@@ -109,15 +133,25 @@ void WriteTimeSeriesWater()
 
 			//multiply output sum of discharge by conversion factor
 			//and print to file
-			fprintf(waterexpfile_fp,",%f", qreportsum[i]*qconvert[i]);
+			ExportValue(waterexpfile_fp, ",%f", qreportsum[i]*qconvert[i]);
 
 		}	//end loop over	number of reporting	stations
 
-		//print a carriage return after each complete line
-		fprintf(waterexpfile_fp,"\n");
+		//if time series are written to series stores
+		if(tsstoreopt > 0)
+		{
+			//end the row of the water export store
+			EndSeriesRow();
+		}
+		else	//else time series are written to text export files
+		{
+			//print a carriage return after each complete line
+			fprintf(waterexpfile_fp,"\n");
+
+			//Close water export file
+			fclose(waterexpfile_fp);
 
-		//Close water export file
-		fclose(waterexpfile_fp);
+		}	//end if tsstoreopt > 0
 
 	}	//end if nqreports > 0
 
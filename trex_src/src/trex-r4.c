@@ -2,13 +2,14 @@
 C-  Function:   trex.c (main module)
 C-
 C-  Purpose/    trex is the main module of the program.  It
-C-  Methods:    obtains the input file name from the initial
-C-              argument (argv), calls ReadInputFile to read
-C-              all program inputs, calls Initialize to set
-C-              initial values for variables.  Euler's method
-C-              is used to generate solutions over space and
-C-              time.  During integration, derivative terms
-C-              are computed for transport processes for the
+C-  Methods:    obtains the input file name and run options from
+C-              the initial arguments (argv) and runs the simulation
+C-              through the trex library (libtrex): TrexInit reads
+C-              all program inputs and sets initial values for
+C-              variables, TrexStep advances the solution by one
+C-              time step (Euler's method), and TrexFinalize writes
+C-              end of run results.  During integration, derivative
+C-              terms are computed for transport processes for the
 C-              current time step, output written, and mass
 C-              balances computed to get water depths and the
 C-              concentrations of solids and chemicals for
@@ -18,20 +19,9 @@ C-  Inputs:     argv
 C-
 C-  Outputs:    argc
 C-
-C-  Controls:   ksim, rstopt, relaunch, simtime, tend, dtopt,
-C-              timeprintout, timeprintgrid
-C-
-C-  Calls:      ReadInputFile, Initialize, ReadRestart,
-C-              TimeFunctionInit, ComputeInitialState,
-C-              UpdateTimeFunction, UpdateEnvironment,
-C-              WaterTransport, SolidsTransport,
-C-              ChemicalTransport, WaterBalance,
-C-              SolidsBalance, ChemicalBalance,
-C-              WriteTimeSeries, WriteDumpFile,
-C-              WriteGrids, NewState, Reinitialize,
-C-              WriteEndGrids, ComputeFinalState,
-C-              WriteMassBalance, WriteSummary,
-C-              FreeMemory, RunTime, WriteRestart
+C-  Controls:   rstopt, imgopt, status
+C-
+C-  Calls:      TrexInit, TrexStep, TrexFinalize
 C-
 C-  Called by:  None
 C-
@@ -68,6 +58,94 @@ C-
 C-  Revisions:  Added controls for time step option (dtopt)
 C-              and simulation relaunch.
 C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Added model image options (-compile, -image) to
+C-              compile a binary image of gridded inputs and to
+C-              start simulations from it.
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Moved the numerical integration loop and all global
+C-              variable definitions to the trex library (libtrex,
+C-              TrexLibrary.c).  The main module now parses the
+C-              initial arguments and drives the library calls.
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Added the -recover option (step recovery).
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Added the -snapshot option (kernel snapshots).
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Added the -powmode option (power law evaluation).
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Added the -parttol option (partitioning tolerance).
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Added the -threads option (solids and chemical
+C-              transport tasks).
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Added the -mbtol option (mass balance monitor).
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Added the -telemetry option (run telemetry, see
+C-              trexstat).
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Added the -dryrun option.
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Added sparse grid output frames (-gridsparse,
+C-              -gridwindows)
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Time series rows can be written to columnar series
+C-              stores (-tsstore, see SeriesStore)
+C-
+C-  Revised:    TREX Development Team
+C-
+C-  Date:       18-OCT-2026
+C-
+C-  Revisions:  Added packed grid output containers (-gridpack, see
+C-              GridPack)
+C-
 C-  Revised:
 C-
 C-  Date:
@@ -75,67 +153,33 @@ C-
 C-  Revisions:
 C-
 C---------------------------------------------------------------------*/
-//trex global general variable declarations/definitions
-#include "trex_general_declarations.h"
-#include "trex_general_definitions.h"
-
-//trex global variable declarations/definitions for water transport
-#include "trex_water_declarations.h"
-#include "trex_water_definitions.h"
+//trex library interface
+#include "trex_library.h"
 
-//trex global variable declarations/definitions for sediment transport
-#include "trex_solids_declarations.h"
-#include "trex_solids_definitions.h"
-
-//trex global variable declarations/definitions for chemical transport
-#include "trex_chemical_declarations.h"
-#include "trex_chemical_definitions.h"
-
-//trex global variable declarations/definitions for environmental conditions
-#include "trex_environmental_declarations.h"
-#include "trex_environmental_definitions.h"
+#include <stdio.h>		//C library for standard input/output
+#include <stdlib.h>		//C library for general utilities
+#include <string.h>		//C library for string functions
 
 int main(int argc, char *argv[])
 {
 	//Local variable declarations/definitions
 	char
-		*prog;				//name of program (defined from argv[0])
-
-	double
-		timeprintout,		//tabular output print time
-		timeprintgrid;		//grid output print time
+		*imgname;			//model image file name (defined from argv)
 
 	int
+		iarg,				//loop index for initial arguments (argv)
 		rstopt,				//restart option for surface water initializations (1 = do not read, 2 = read) 
-		relaunch;			//simulation relaunch control (0 = do not relaunch, 1 = relaunch)
-
-	time_t clockstart;
-	time_t clockstop;
-
-	//CPU clock time (in seconds since epoch) at start of simulation
-	time(&clockstart);
-
-	//Assign program name to define stderr file for error reporting
-	prog = argv[0];
-
-	//Assign program name to define stderr file for error reporting
-	strcpy(prog, argv[0]);
-
-	//Allocate memory for input file name
-	inputfile = (char *)malloc(MAXNAMESIZE * sizeof(char));	//allocate memory
-
-	//Assign inputfile name from argv initial argument
-	strcpy(inputfile,argv[1]);
-
-	/*********************************************/
-	/*         Read and initialize data          */
-	/*********************************************/
+		imgopt,				//model image option (0 = no image, 1 = compile image, 2 = run from image)
+		status;				//simulation status (TREXCONTINUE, TREXFINISHED, TREXCOMPILED, TREXDRYRUN)
 
-	//Read input file
-	ReadInputFile();
+	//if no input file name was given
+	if(argc < 2)
+	{
+		//Write usage message to screen
+		printf("Usage: %s inputfile [restart0|restart1|restart2] [-compile imagefile|-image imagefile] [-recover rejects] [-snapshot kernel hours snapshotfile] [-powmode batch|libm|scalar|avx2|avx512] [-parttol tolerance] [-threads n] [-mbtol percent] [-telemetry 0|1] [-dryrun] [-gridsparse 0|1|2] [-gridwindows windowsfile] [-tsstore 0|1] [-gridpack 0|1]\n", argv[0]);
+		exit(EXIT_FAILURE);	//abort
 
-	//Initialize Variables
-	Initialize();
+	}	//end if argc < 2
 
 	//Note:  Three restart options are available: (1) restart0; (2) restart1; and
 	//       (3) restart2.  For restart0, no initializations are read at the start
@@ -153,350 +197,286 @@ int main(int argc, char *argv[])
 	//       final conditions at the end of the simulation.
 	//
 	//       If the count of initial arguments (argc) > 2, the user has specified a
-	//       a restart option.  If the specified restart option is 1 or 2, then
-	//       restart information is read...
+	//       a restart option and/or a model image option.  If the specified restart
+	//       option is 1 or 2, then restart information is read...
+	//
+	//       Two model image options are available: (1) -compile imagefile; and (2)
+	//       -image imagefile.  For -compile, the input file and all grid files are
+	//       read, their values are stored in the binary model image file, and the
+	//       program stops after initialization.  For -image, the grid values are
+	//       read from the model image instead of the grid files (the grid files
+	//       must still be present: they are checksummed to validate the image).
+	//
+	//       The -recover rejects option enables step recovery: a time step with
+	//       a negative water depth or concentration is rejected and repeated with
+	//       half the time step, up to the given number of successive rejections
+	//       (the time step then grows back by 25% per accepted time step).  The
+	//       default (0) aborts (negative depths) or warns (negative concentrations)
+	//       as before.
+	//
+	//       The -snapshot kernel hours snapshotfile option writes the inputs and
+	//       outputs of a kernel (OverlandWaterRoute, ChannelWaterRoute, ...) at
+	//       its first call at or after the given simulation time to a snapshot
+	//       file.  The snapshot is replayed and timed by trexkernel.
+	//
+	//       The -powmode mode option selects the evaluation of the power laws
+	//       of the transport kernels: batch (SIMD batch math, the default),
+	//       avx512, avx2, scalar, or libm (reproduces the scalar kernels bit
+	//       for bit, for validation).
+	//
+	//       The -parttol tolerance option sets the relative tolerance of
+	//       incremental chemical partitioning: the water column and surface
+	//       layer are repartitioned when their porosity or solids moved by
+	//       more than the tolerance.  The default (0) repartitions on any
+	//       change (same results as a full computation).
+	//
+	//       The -threads n option runs the transport kernels of the solids
+	//       and chemical types as tasks on n threads (requires OpenMP).  The
+	//       results do not depend on the number of threads.
 	//
-	//if the count of initial arguments > 2 (if a restart option is specified
-	if(argc > 2)
+	//initialize restart option to -1 (no restart option specified)
+	rstopt = -1;
+
+	//initialize model image option to 0 (no model image)
+	imgopt = 0;
+	imgname = NULL;
+
+	//loop over initial arguments that follow the input file name
+	for(iarg=2; iarg<argc; iarg++)
 	{
 		//if the restart argument = restart2 (strcmp returns zero when the strings are identical)
-		if(strcmp(argv[2],"restart2") == 0)
+		if(strcmp(argv[iarg],"restart2") == 0)
 		{
 			//set the restart option to 2 (read restart info with surface water initializations)
 			rstopt = 2;
 		}
 		//if the restart argument = restart1 (strcmp returns zero when the strings are identical)
-		else if(strcmp(argv[2],"restart1") == 0)
+		else if(strcmp(argv[iarg],"restart1") == 0)
 		{
 			//set the restart option to 1 (read restart info without surface water initializations)
 			rstopt = 1;
 		}
 		//if the restart option is restart0 (strcmp returns zero when the strings are identical)
-		else if(strcmp(argv[2],"restart0") == 0)
+		else if(strcmp(argv[iarg],"restart0") == 0)
 		{
 			//set the restart option to 0 (do not read restart info)
 			rstopt = 0;
 		}
-		else	//else the argument is not defined
-		{
-			//set the restart option to -1 (restart option not defined, do not read or write restart info)
-			rstopt = -1;
-
-		}	//end if the restart argument = restart2, restart1, restart0...
-	}
-	else	//else, no restart option specified by user
-	{
-		//set the restart option to -1 (no restart option specified)
-		rstopt = -1;
-
-	}	//end if argc > 2
-
-	//if the rstopt > 0 (if restart info and initializations are read)
-	if(rstopt > 0)
-	{
-		//Read initial condition (restart) files for storms in sequence according to restart option
-		ReadRestart(rstopt);
-
-	}	//end if rstopt > 0
-
-	/*******************************************/
-	/*        Simulation Relaunch Loop         */
-	/*******************************************/
-
-	//set simulation relauch condition to on (relaunch = 1)
-	relaunch = 1;
-
-	//while the simulation is set to relaunch itself
-	while(relaunch == 1)
-	{
-		//Set simulation start time: tstart specified in Data Group A
-		simtime = tstart;	//simulation time (hours)
-
-		//Set simulation end time: end time = time of last break in dt time series
-		tend = dttime[ndt];		//simulation end time (hours)
-
-		//Determine starting index of all time functions for any simulation start time
-		TimeFunctionInit();
-
-		//set time series and grid print output start times to simulation start time
-		timeprintout = simtime;
-		timeprintgrid = simtime;
-
-		//Compute initial volumes and masses for overland plane and channels
-		ComputeInitialState();
-
-		/*********************************************/
-		/*        Numerical Integration Loop         */
-		/*********************************************/
-
-		//write simulation start message to screen
-		printf("\n\n*********************************\n");
-		printf(	   "*                               *\n");
-		printf(	   "*   Beginning TREX Simulation   *\n");
-		printf(	   "*                               *\n");
-		printf(	   "*********************************\n\n\n");
-
-		//Main loop over time...
-		//
-		//while the current simulation time <= the simulation end time
-		while(simtime <= tend)
+		//if the argument is a model image option followed by an image file name
+		else if((strcmp(argv[iarg],"-compile") == 0 || strcmp(argv[iarg],"-image") == 0)
+			&& iarg+1 < argc)
 		{
-			//if time steps are specified (dtopt = 0 or dtopt = 3)
-			if(dtopt == 0 || dtopt == 3)
+			//set the model image option (1 = compile image, 2 = run from image)
+			if(strcmp(argv[iarg],"-compile") == 0)
 			{
-				//if it is time to use a new dt, increment the time step index (idt)
-				if((simtime > dttime[idt]) && (idt < ndt))
-				{
-					//increment time step index
-					idt = idt + 1;	//increment time step index
-				}
+				imgopt = 1;
 			}
-			else if(dtopt == 1 || dtopt == 2)	//else if automated time stepping is selected
+			else
 			{
-				//Note:  A new time step is added to the series of dt, dttime
-				//       values whenever the number of stored time step values
-				//       is equal to the number of values in the series.  This
-				//       occurs when idt = bdt.
-				//
-				//if a new time step value is needed (if idt = bdt)
-				if(idt == bdt)
-				{
-					//increment time step index
-					idt = idt + 1;
-
-				}	//end if dt[idt] not equal to dtmax
-
-				//set time step for this time level to the maximum value (seconds)
-				dt[idt] = dtmax;
-
-			}	//end if dtopt = 1 or 2
-
-			//Update time functions
-			UpdateTimeFunction();
-
-			//Update environmental conditions
-			UpdateEnvironment();
-
-			//Compute water transport/forcing functions (rainfall, infiltration, flows)
-			WaterTransport();
+				imgopt = 2;
+			}
 
-			//Compute water mass balance (obtain flow depths and floodplain transfers)
-			WaterBalance();
+			//Assign model image file name from the next argument
+			imgname = argv[iarg+1];
 
-			//if sediment transport is simulated
-			if(ksim > 1)
+			//skip the image file name argument
+			iarg = iarg + 1;
+		}
+		//if the argument is the step recovery option followed by a number of rejections
+		else if(strcmp(argv[iarg],"-recover") == 0 && iarg+1 < argc)
+		{
+			//set the maximum number of successive rejections of a time step (default factors)
+			if(TrexSetRecovery(atoi(argv[iarg+1]), 0.5, 1.25) != 0)
 			{
-				//Compute sediment transport/forcing functions (transport, erosion, deposition, loads)
-				SolidsTransport();
-
-				//Compute solids mass balance (obtain particle concentrations)
-				SolidsBalance();
-
-				//if chemical transport is simulated
-				if(ksim > 2)
-				{
-					//Compute chemical transport/forcing functions (mass transfer and transformations etc.)
-					ChemicalTransport();
-
-					//Compute chemical mass balance (obtain chemical concentrations)
-					ChemicalBalance();
-
-				}	//end if ksim > 2
-
-			}	//end if ksim > 1
+				//Write error message to screen
+				printf("Error! Invalid -recover rejections: %s\n", argv[iarg+1]);
+				exit(EXIT_FAILURE);	//abort
+			}
 
-			//if simulation time >= time to report time series output
-			if(simtime >= timeprintout)
+			//skip the number of rejections argument
+			iarg = iarg + 1;
+		}
+		//if the argument is the kernel snapshot option followed by a kernel, a time, and a file name
+		else if(strcmp(argv[iarg],"-snapshot") == 0 && iarg+3 < argc)
+		{
+			//set the kernel snapshot (kernel name, simulation time (hours), snapshot file name)
+			if(TrexSetSnapshot(argv[iarg+1], atof(argv[iarg+2]), argv[iarg+3]) != 0)
 			{
-				//Write simtime and time series printout status to screen
-
-				//jfe need to use stderr here as in K&R p. 163 to insure msg goes to screen....
-				//jfe????? or should we allow user to redirect all to file??????? if so, which one???
-
-				fprintf(stderr, "  Time Series printout time = %9.6f\tSimulation Time (hours) = %9.6f \n"
-							, timeprintout,simtime);
-//jfe				fprintf("  Time Series printout time = %f\tSimulation Time (hours) = %f \n"
-//jfe							,timeprintout,simtime);
-
-				//Write times series output to text files
-				WriteTimeSeries();
-
-				//if the dump file name is not blank
-				if(*dmpfile != '\0')
-				{
-					//Write detailed model results to dump file (*.dmp)
-					WriteDumpFile();
-
-				}	//end if dmpfile is not blank
-
-				//if it is time to use a new output print interval
-				if((timeprintout >= printouttime[pdt]) && (pdt < nprintout))
-				{
-					//increment the printout index (pdt)
-					pdt = pdt + 1;
-				}
-
-				//Set the new output print time
-				timeprintout = timeprintout + printout[pdt];
-
-			}	//end if simtime >= timeprintout
+				//Write error message to screen
+				printf("Error! Invalid -snapshot kernel or time: %s %s\n", argv[iarg+1], argv[iarg+2]);
+				exit(EXIT_FAILURE);	//abort
+			}
 
-			//if simulation time >= time to report grid output
-			if(simtime >= timeprintgrid)
+			//skip the kernel, time, and file name arguments
+			iarg = iarg + 3;
+		}
+		//if the argument is the power law evaluation option followed by a mode name
+		else if(strcmp(argv[iarg],"-powmode") == 0 && iarg+1 < argc)
+		{
+			//set the power law evaluation mode
+			if(TrexSetPowMode(argv[iarg+1]) != 0)
 			{
-				//Write simtime and grid printout status to screen via stderr
-
-//mlv				fprintf(stderr, "  Grid printout time = %9.6f\tSimulation Time (hours) = %9.6f \n"
-//mlv							,prog, timeprintgrid,simtime);
-//jfe				printf(stderr, "  Grid printout time = %f\tSimulation Time (hours) = %f \n"
-//jfe							,timeprintgrid,simtime);
-
-				//Write output grids to files
-				WriteGrids(gridcount);
-
-				//increment sequential count of grids print events for file extension
-				gridcount = gridcount + 1;
-
-				//if it is time to use a new grid print interval
-				if((timeprintgrid >= printgridtime[gdt]) && (gdt < nprintgrid))
-				{
-					//increment the printgrid index (gdt)
-					gdt = gdt + 1;
-				}
+				//Write error message to screen
+				printf("Error! Invalid -powmode mode: %s\n", argv[iarg+1]);
+				exit(EXIT_FAILURE);	//abort
+			}
 
-				//Set the new grid print time
-				timeprintgrid = timeprintgrid + printgrid[pdt];
+			//skip the mode argument
+			iarg = iarg + 1;
+		}
+		//if the argument is the partitioning tolerance option followed by a tolerance
+		else if(strcmp(argv[iarg],"-parttol") == 0 && iarg+1 < argc)
+		{
+			//set the relative tolerance of incremental partitioning
+			if(TrexSetPartitionTolerance(atof(argv[iarg+1])) != 0)
+			{
+				//Write error message to screen
+				printf("Error! Invalid -parttol tolerance: %s\n", argv[iarg+1]);
+				exit(EXIT_FAILURE);	//abort
+			}
 
-			}	//end if simtime >= timeprintgrid
+			//skip the tolerance argument
+			iarg = iarg + 1;
+		}
+		//if the argument is the transport task option followed by a number of threads
+		else if(strcmp(argv[iarg],"-threads") == 0 && iarg+1 < argc)
+		{
+			//set the number of threads of the solids and chemical transport tasks
+			if(TrexSetThreads(atoi(argv[iarg+1])) != 0)
+			{
+				//Write error message to screen
+				printf("Error! Invalid -threads number (or built without OpenMP): %s\n", argv[iarg+1]);
+				exit(EXIT_FAILURE);	//abort
+			}
 
-			//Assign new state (flow depths, concentrations) for next time step
-			NewState();
+			//skip the number of threads argument
+			iarg = iarg + 1;
+		}
+		//if the argument is the mass balance tolerance option followed by an error (percent)
+		else if(strcmp(argv[iarg],"-mbtol") == 0 && iarg+1 < argc)
+		{
+			//set the water mass balance error that stops the simulation (percent)
+			if(TrexSetMassBalanceTolerance(atof(argv[iarg+1])) != 0)
+			{
+				//Write error message to screen
+				printf("Error! Invalid -mbtol tolerance: %s\n", argv[iarg+1]);
+				exit(EXIT_FAILURE);	//abort
+			}
 
-			//Increment simulation time (t = t + dt) (for upcoming iteration)
-			simtime = simtime + dt[idt] / 3600.0; //simtime (hours), dt (seconds)
+			//skip the tolerance argument
+			iarg = iarg + 1;
+		}
+		//if the argument is the telemetry option followed by a setting (0 = off, 1 = on)
+		else if(strcmp(argv[iarg],"-telemetry") == 0 && iarg+1 < argc)
+		{
+			//select the publication of the run status (telemetry segment, see trexstat)
+			if(TrexSetTelemetry(atoi(argv[iarg+1])) != 0)
+			{
+				//Write error message to screen
+				printf("Error! Invalid -telemetry setting: %s\n", argv[iarg+1]);
+				exit(EXIT_FAILURE);	//abort
+			}
 
-		}	// End Numerical Integration Loop
+			//skip the setting argument
+			iarg = iarg + 1;
 
-		//if automated time-stepping is selected (dtopt = 1 or dtopt = 2)
-		if(dtopt == 1 || dtopt == 2)
-		{
-			//store simulation time for last time step time (dttime)
-			dttime[idt-1] = (float)(tend);
-
-			//increment total number of time steps in series
-			ndt = ndt + 1;
-
-			//increment timestep buffer index
-			bdt = bdt + 1;
-
-			//Note:  If ndt <= MAXBUFFERSIZE at the end of a simulation,
-			//       no dt and dttime pairs were written to file and all
-			//       are in memory.  Otherwise, if ndt > MAXBUFFERSIZE at
-			//       the simulation end, the buffer must be flushed.
-			//
-			//       For simplicity, all dt and dttime values are always
-			//       written to the buffer file to simply how values are
-			//       retrieved and used to repopulate the dt and dttime
-			//       arrays for final storage to external output file.
-			//
-			//Flush the buffer to write any remaing timestep pairs to
-			//file...
-			//
-			//write time step series (dt, dttime pairs) to buffer file
-			WriteDTBuffer();
-
-			//write time step series (dt, dttime pairs) to external output file
-			WriteDTFile();
-
-		}	//end if dtopt = 1 or 2
-
-		//Check for simulation relaunch conditions...
-		//
-		//Note:  Simulation relaunch occurs if dtopt = 2 and the initial
-		//       ksim value is greater than 1 (ksim0 > 1).
-		//
-		//if dtopt = 2 and ksim0 > 1 (if automated time-stepping with relaunch is selected)
-		if(dtopt == 2 && ksim0 > 1)
+		}
+		//if the argument is the dry run option
+		else if(strcmp(argv[iarg],"-dryrun") == 0)
 		{
-			//reset the timestep option to read timesteps from file
-			dtopt = 3;
-
-			//Reinitialize simulation for relaunch...
-			//
-			//Note:  Mass balance and other variables must be are reset
-			//       to initial values for simulation relaunch...
-			//
-			//Reinitialize
-			Reinitialize();
+			//estimate the memory use without running the simulation
+			TrexSetDryRun(1);
 		}
-		else	//else dtopt is not 2
+		//if the argument is the sparse grid option followed by a mode (0 = full rasters, 1 = non-zero cells, 2 = all cells)
+		else if(strcmp(argv[iarg],"-gridsparse") == 0 && iarg+1 < argc)
 		{
-			//set simulation relauch condition to off (relaunch = 0)
-			relaunch = 0;
-
-		}	//end if dtopt = 2
+			//select sparse grid output frames (see trexgrid)
+			if(TrexSetGridSparse(atoi(argv[iarg+1])) != 0)
+			{
+				//Write error message to screen
+				printf("Error! Invalid -gridsparse mode: %s\n", argv[iarg+1]);
+				exit(EXIT_FAILURE);	//abort
+			}
 
-	}	//end loop while relaunch = 1
+			//skip the mode argument
+			iarg = iarg + 1;
+		}
+		//if the argument is the grid windows option followed by a file name
+		else if(strcmp(argv[iarg],"-gridwindows") == 0 && iarg+1 < argc)
+		{
+			//restrict grid output to the windows and mask zones of the file
+			TrexSetGridWindows(argv[iarg+1]);
 
-	/*******************************************/
-	/* Compute final volumes & write results   */
-	/*******************************************/
+			//skip the file argument
+			iarg = iarg + 1;
+		}
+		//if the argument is the series store option followed by a setting (0 = text export files, 1 = series stores)
+		else if(strcmp(argv[iarg],"-tsstore") == 0 && iarg+1 < argc)
+		{
+			//select series stores for the time series output (see trexseries)
+			if(TrexSetSeriesStore(atoi(argv[iarg+1])) != 0)
+			{
+				//Write error message to screen
+				printf("Error! Invalid -tsstore setting: %s\n", argv[iarg+1]);
+				exit(EXIT_FAILURE);	//abort
+			}
 
-	//Write times series output to text files (ensure output of final iteration)
-	WriteTimeSeries();
+			//skip the setting argument
+			iarg = iarg + 1;
+		}
+		//if the argument is the packed grid option followed by a setting (0 = rasters, 1 = containers)
+		else if(strcmp(argv[iarg],"-gridpack") == 0 && iarg+1 < argc)
+		{
+			//select compressed grid containers (see trexunpack)
+			if(TrexSetGridPack(atoi(argv[iarg+1])) != 0)
+			{
+				//Write error message to screen
+				printf("Error! Invalid -gridpack setting: %s\n", argv[iarg+1]);
+				exit(EXIT_FAILURE);	//abort
+			}
 
-	//if the dump file name is not blank
-	if(*dmpfile != '\0')
-	{
-		//Write detailed model results to dump file (*.dmp) (ensure output of final iteration)
-		WriteDumpFile();
+			//skip the setting argument
+			iarg = iarg + 1;
 
-	}	//end if dmpfile is not blank
+		}	//end if the argument = restart2, restart1, restart0, -compile, -image, -recover, -snapshot, -powmode, -parttol, -threads, -mbtol, -telemetry, -dryrun, -gridsparse, -gridwindows, -tsstore, -gridpack...
 
-	//Write output grids to files (ensure output of final iteration)
-	WriteGrids(gridcount);
+	}	//end loop over initial arguments
 
-	//Write end of run (single) grids to files (net elevation change, gross erosion, etc.)
-	WriteEndGrids(gridcount);
+	/*********************************************/
+	/*         Read and initialize data          */
+	/*********************************************/
 
-	//Compute final volumes and masses for the overland and channels
-	ComputeFinalState();
+	//Read input file and initialize variables (inputfile name from argv initial argument)
+	status = TrexInit(argv[1], rstopt, imgopt, imgname);
 
-	//if the mass balance file name is not null
-	if(*msbfile != '\0')
+	//if the model image was compiled or the memory use was estimated (dry run)
+	if(status == TREXCOMPILED || status == TREXDRYRUN)
 	{
-		//Write summary mass balance file
-		WriteMassBalance();
+		//End of Main Program (compilation or dry run only, no simulation)
+		return 0;
 
-	}	//end if msbfile is not blank
+	}	//end if status == TREXCOMPILED or TREXDRYRUN
 
-	//Write summary file
-	WriteSummary();
+	/*********************************************/
+	/*        Numerical Integration Loop         */
+	/*********************************************/
 
-	//Developer's Note:  The memory deallocation routined are "stale"
-	//                   and cause segmentation faults when executed.
-	//                   For now, the call to FreeMemory is commented
-	//                   out.  However, the set of FreeMemory modules
-	//                   are still part of the active set of modules
-	//                   for the TREX code and are subject to further
-	//                   development.  We'll fix this at some point...
+	//Main loop over time (includes simulation relaunch)...
 	//
-	//Deallocate memory
-//mlv	FreeMemory();
-
-	//CPU clock time (in seconds since epoch) at end of simulation
-	time(&clockstop);
+	//while the simulation has time steps remaining
+	while(status == TREXCONTINUE)
+	{
+		//Advance the simulation one time step
+		status = TrexStep();
 
-	//Compute trex elapsed running time for this simulation
-	RunTime(clockstart, clockstop);
+	}	//end loop while status == TREXCONTINUE
 
-	//if the restart option is >= 0 (if final conditions for a restart are written)
-	if(rstopt >= 0)
-	{
-		//Write initial condition (restart) files for storms in sequence accoprding to restart option
-		WriteRestart();
+	/*******************************************/
+	/* Compute final volumes & write results   */
+	/*******************************************/
 
-	}	//end if rstopt >= 0
+	//Write final results, run time, and restart files
+	TrexFinalize();
 
 	//End of Main Program
 	return 0;
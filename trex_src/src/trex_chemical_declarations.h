@@ -17,6 +17,41 @@ C-              Denver, CO  80225
 C-
 C-	Date:		16-MAR-2004
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added pending load totals and compensation terms.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added partitioning cache variables (see
+C-              PartitionCache).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Kernel prototypes take a range of chemical types.
+C-              Added the transport task prototypes.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Load areas are stored for the load cells only
+C-              (cwdovarea[ichem][iload][icell]) instead of a full
+C-              grid for each load.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added the streamed chemical mass balance terms
+C-              (mbchemstep, mbchemtotal).
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -68,19 +103,21 @@ extern void TimeFunctionInitChemical(void);				//Initializes piecewise linear ti
 extern void UpdateTimeFunctionChemical(void);			//Updates piecewise linear time functions for chemicals (Loads, BCs)
 
 extern void ChemicalTransport(void);					//Computes derivative terms for chemical transport processes
-extern void OverlandChemicalAdvection(void);			//Computes advective flux of chemicals in overland plane
-extern void OverlandChemicalDispersion(void);			//Computes dispersive flux of chemicals in overland plane
-extern void OverlandChemicalErosion(void);				//Computes erosion flux of chemicals in overland plane
-extern void OverlandChemicalDeposition(void);			//Computes deposition flux of chemicals in overland plane
-extern void OverlandChemicalInfiltration(void);			//Compute overland chemical infiltration (to soils)
+extern void OverlandChemicalTransportTask(int, int);	//Computes overland transport of a range of chemical types (one species task)
+extern void ChannelChemicalTransportTask(int, int);		//Computes channel transport of a range of chemical types (one species task)
+extern void OverlandChemicalAdvection(int, int);		//Computes advective flux of chemicals in overland plane
+extern void OverlandChemicalDispersion(int, int);		//Computes dispersive flux of chemicals in overland plane
+extern void OverlandChemicalErosion(int, int);			//Computes erosion flux of chemicals in overland plane
+extern void OverlandChemicalDeposition(int, int);		//Computes deposition flux of chemicals in overland plane
+extern void OverlandChemicalInfiltration(int, int);		//Compute overland chemical infiltration (to soils)
 extern void OverlandChemicalKinetics(void);				//Computes kinetic reaction flux of chemicals in overland plane
-extern void ChannelChemicalAdvection(void);				//Computes advective flux of chemicals in channels
-extern void ChannelChemicalDispersion(void);			//Computes dispersive flux of chemicals in channels
-extern void ChannelChemicalErosion(void);				//Computes erosion flux of chemicals in channels
-extern void ChannelChemicalDeposition(void);			//Computes deposition flux of chemicals in channels
-extern void ChannelChemicalTransmissionLoss(void);		//Computes channel chemical transmission loss (to sediments)
+extern void ChannelChemicalAdvection(int, int);			//Computes advective flux of chemicals in channels
+extern void ChannelChemicalDispersion(int, int);		//Computes dispersive flux of chemicals in channels
+extern void ChannelChemicalErosion(int, int);			//Computes erosion flux of chemicals in channels
+extern void ChannelChemicalDeposition(int, int);		//Computes deposition flux of chemicals in channels
+extern void ChannelChemicalTransmissionLoss(int, int);	//Computes channel chemical transmission loss (to sediments)
 extern void ChannelChemicalKinetics(void);				//Computes kinetic reaction flux of chemicals in channels
-extern void FloodplainChemicalTransfer(void);			//Transfers chemicals between overland plane and channels
+extern void FloodplainChemicalTransfer(int, int);		//Transfers chemicals between overland plane and channels
 
 extern void OverlandChemicalPartitioning(void);			//Compute overland chemical partitioning
 extern void OverlandChemicalBiodegradation(void);		//Compute overland chemical biodegradation
@@ -104,6 +141,12 @@ extern void ChannelChemicalUDReaction(void);		//Compute channel chemical user-de
 extern void ChannelChemicalYield(void);				//Compute channel chemical yield (transformation between chemical types)
 extern void ChannelChemicalDissolution(void);		//Computes dissolution flux of solids in channels
 
+//Partitioning Cache Modules
+extern void InitializePartitionCache(void);		//Allocates the partitioning cache and marks all partitioning stale
+extern void InvalidatePartitioning(void);		//Marks the partitioning of all cells and nodes stale
+extern int PartitionInputMoved(float, float);	//Tests if a partitioning input moved beyond the relative tolerance (parttol)
+extern void FreePartitionCache(void);			//Frees memory for the partitioning cache
+
 extern void ChemicalBalance(void);						//Computes mass balance for chemicals
 extern void OverlandChemicalConcentration(void);		//Computes mass balance for chemical concentration in overland plane
 extern void ChannelChemicalConcentration(void);			//Computes mass balance for chemical concentration in channels
@@ -296,7 +339,7 @@ extern float
 	***cwpov,			//Value of an overland point source chemical load (kg/day) [ichem][iload][ipair]
 	***cwpovtime,		//Time break for an overland point source chemical load (hours) [ichem][iload][ipair]
 
-	****cwdovarea,		//Value for an overland distributed chemical load area [ichem][iload][row][col] (m2)
+	***cwdovarea,		//Value for an overland distributed chemical load area [ichem][iload][icwdovcells[][]] (m2)
 	***cwdov,			//Value of an overland distributed chemical load (g/m2/mm) [ichem][iload][ipair]
 	***cwdovtime,		//Time break for an overland distributed chemical load (hours) [ichem][iload][ipair]
 
@@ -585,7 +628,15 @@ extern double
 	*totaltnschemoutch,		//cumulative sum of chemical mass exiting water column by channel chemical kinetics (kg)
 
 	*totalcwov,				//cumulative sum of external chemical loads entering overland plane (m3)
-	*totalcwch;				//cumulative sum of external chemical loads entering channel network (m3)
+	*totalcwch,				//cumulative sum of external chemical loads entering channel network (m3)
+
+	*pendingcwov,			//external chemical loads entering overland plane in the current time step (kg) [chem]
+	*pendingcwch,			//external chemical loads entering channel network in the current time step (kg) [chem]
+	*carrycwov,				//compensation term of the compensated sum totalcwov (kg) [chem]
+	*carrycwch,				//compensation term of the compensated sum totalcwch (kg) [chem]
+
+	**mbchemstep,		//chemical mass balance terms of the current time step (kg) [chem][term] (see MS* terms)
+	**mbchemtotal;		//running totals of the chemical mass balance terms (storage terms are current masses) (kg) [chem][term]
 
 extern float
 	****fdissolvedov,		//fraction of total chemical in dissolved phase overland
@@ -596,6 +647,22 @@ extern float
 	****fboundch,			//fraction of total chemical bound to doc in channels
 	*****fparticulatech;	//fraction of total chemical sorbed to particulate phase in channels
 
+	/**********************/
+	//  partitioning cache (see PartitionCache)
+	/**********************/
+extern float
+	parttol;		//relative tolerance of the water column and surface layer partitioning inputs (0 = recompute on any change)
+
+extern int
+	**partstaleov,	//partitioning of all layers of the overland cell is stale (1) or current (0) [r][c]
+	**partstalech;	//partitioning of all layers of the channel node is stale (1) or current (0) [link][node]
+
+extern float
+	**partwfeov,	//wetting front elevation at the last overland partitioning (m) [r][c]
+	***partrefov,	//reference porosities and solids of the last overland partitioning [r][c][2*(nsolids+1)]
+	**partwfech,	//wetting front elevation at the last channel partitioning (m) [link][node]
+	***partrefch;	//reference porosities and solids of the last channel partitioning [link][node][2*(nsolids+1)]
+
 extern double
 	*maxcchemov0,	//maximum chemical concentration in water column of overland plane
 	*mincchemov0,	//minimum chemical concentration in water column of overland plane
@@ -17,6 +17,34 @@ C-              Denver, CO  80225
 C-
 C-	Date:		16-MAR-2004
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added pending load totals and compensation terms.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added partitioning cache variables (see
+C-              PartitionCache).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Load areas are stored for the load cells only
+C-              (cwdovarea[ichem][iload][icell]) instead of a full
+C-              grid for each load.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added the streamed chemical mass balance terms
+C-              (mbchemstep, mbchemtotal).
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -226,7 +254,7 @@ float
 	***cwpov,			//Value of an overland point source chemical load (kg/day) [ichem][iload][ipair]
 	***cwpovtime,		//Time break for an overland point source chemical load (hours) [ichem][iload][ipair]
 
-	****cwdovarea,		//Value for an overland distributed chemical load area [ichem][iload][row][col] (m2)
+	***cwdovarea,		//Value for an overland distributed chemical load area [ichem][iload][icwdovcells[][]] (m2)
 	***cwdov,			//Value of an overland distributed chemical load (g/m2/mm) [ichem][iload][ipair]
 	***cwdovtime,		//Time break for an overland distributed chemical load (hours) [ichem][iload][ipair]
 
@@ -515,7 +543,15 @@ double
 	*totaltnschemoutch,		//cumulative sum of chemical mass exiting water column by channel chemical kinetics (kg)
 
 	*totalcwov,				//cumulative sum of external chemical loads entering overland plane (m3)
-	*totalcwch;				//cumulative sum of external chemical loads entering channel network (m3)
+	*totalcwch,				//cumulative sum of external chemical loads entering channel network (m3)
+
+	*pendingcwov,			//external chemical loads entering overland plane in the current time step (kg) [chem]
+	*pendingcwch,			//external chemical loads entering channel network in the current time step (kg) [chem]
+	*carrycwov,				//compensation term of the compensated sum totalcwov (kg) [chem]
+	*carrycwch,				//compensation term of the compensated sum totalcwch (kg) [chem]
+
+	**mbchemstep,		//chemical mass balance terms of the current time step (kg) [chem][term] (see MS* terms)
+	**mbchemtotal;		//running totals of the chemical mass balance terms (storage terms are current masses) (kg) [chem][term]
 
 float
 	****fdissolvedov,		//fraction of total chemical in dissolved phase overland
@@ -526,6 +562,22 @@ float
 	****fboundch,			//fraction of total chemical bound to doc in channels
 	*****fparticulatech;	//fraction of total chemical sorbed to particulate phase in channels
 
+	/**********************/
+	//  partitioning cache (see PartitionCache)
+	/**********************/
+float
+	parttol;		//relative tolerance of the water column and surface layer partitioning inputs (0 = recompute on any change)
+
+int
+	**partstaleov,	//partitioning of all layers of the overland cell is stale (1) or current (0) [r][c]
+	**partstalech;	//partitioning of all layers of the channel node is stale (1) or current (0) [link][node]
+
+float
+	**partwfeov,	//wetting front elevation at the last overland partitioning (m) [r][c]
+	***partrefov,	//reference porosities and solids of the last overland partitioning [r][c][2*(nsolids+1)]
+	**partwfech,	//wetting front elevation at the last channel partitioning (m) [link][node]
+	***partrefch;	//reference porosities and solids of the last channel partitioning [link][node][2*(nsolids+1)]
+
 double
 	*maxcchemov0,	//maximum chemical concentration in water column of overland plane
 	*mincchemov0,	//minimum chemical concentration in water column of overland plane
@@ -17,6 +17,13 @@ C-              Denver, CO  80225
 C-
 C-	Date:		16-MAR-2004
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Precomputed terrain terms of solar radiation for
+C-              snowmelt (compact list of domain cells).
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -33,6 +40,12 @@ C---------------------------------------------------------------------*/
 //	5. variable declarations by state variables, general controls, then ksim
 //		(1=water, 2=solids, 3=chemicals)
 
+/************************************/
+/*   GLOBAL CONSTANT DEFINITIONS    */
+/************************************/
+
+#define MAXENVZONES 255		//Maximum number of zones of a zoned environmental property (zone ids are stored as unsigned char)
+
 /*************************/
 /*   FILE DECLARATIONS   */
 /*************************/
@@ -61,6 +74,17 @@ extern void UpdateTimeFunctionEnvironment(void);	//Updates piecewise linear time
 
 extern void UpdateEnvironment(void);				//Updates cell values for environmental conditions
 extern void ComputeSolarRadiation(void);			//Compute incident solar radiation
+extern void SolarRadiationSweep(int, int);			//Computes solar radiation for a range of cells from the precomputed terrain terms
+
+extern void ZoneGeneralProperty(int);				//Converts a general property grid to zoned storage
+extern void ZoneOverlandProperty(int);				//Converts an overland property grid to zoned storage
+extern int UpdateGeneralZones(int);					//Updates the zone values of a general property
+extern int UpdateOverlandZones(int);				//Updates the zone values of an overland property
+extern float EnvGeneralValue(int, int, int);		//Returns the current value of a general property for a cell
+extern int EnvGeneralTFId(int, int, int);			//Returns the time function id of a general property for a cell
+extern float EnvOverlandValue(int, int, int, int);	//Returns the current value of an overland property for a cell and layer
+extern void InvalidateEnvironmentZones(void);		//Marks all zoned properties stale (cell values are reassigned)
+extern void FreeEnvironmentZones(void);				//Frees memory for zoned environmental properties
 
 extern void FreeMemoryEnvironment(void);			//Frees allocated memory for environmental variables at end of simulation
 
@@ -202,3 +226,41 @@ extern float
 
 extern double
 	timemeteorology;	//update time for meteorological conditions (hours)
+
+//precomputed terrain terms of solar radiation (compact list of domain cells, see InitializeEnvironment)
+extern int
+	nsolarcells,		//number of domain cells of the solar radiation sweep
+	*solarcellrow,		//row of a solar radiation cell [cell]
+	*solarcellcol;		//column of a solar radiation cell [cell]
+
+extern float
+	*slopecos,			//cosine of the terrain slope [cell]
+	*slopesinx,			//sine of the terrain slope times cosine of the slope azimuth (south = 0) [cell]
+	*slopesiny,			//sine of the terrain slope times sine of the slope azimuth (south = 0) [cell]
+	*solarview,			//sky view and land cover factor of solar radiation [cell]
+	*solarcosi,			//cosine of the solar incidence angle of the current update [cell]
+	suncosz,			//cosine of the solar zenith angle of the current update
+	sunx,				//sine of the solar zenith angle times cosine of the solar azimuth
+	suny,				//sine of the solar zenith angle times sine of the solar azimuth
+	sundirect,			//direct radiation per unit incidence and clear sky (W/m2)
+	sundiffuse;			//diffuse radiation per unit cloud cover (W/m2)
+
+//zoned storage of general and overland environmental properties
+//(uniform and zoned grids are kept as zone value tables, see EnvironmentZones)
+extern int
+	*nenvgzones,		//number of zones of a general property [iprop]
+	**envgzonetfid,		//time function id of a general property zone [iprop][izone]
+	*envgzonestale,		//flag: cell values of a zoned general property must be reassigned [iprop]
+	**nenvovzones,		//number of zones of an overland property layer [iprop][layer]
+	***envovzonetfid,	//time function id of an overland property zone [iprop][layer][izone]
+	*envovzonestale;	//flag: cell values of a zoned overland property must be reassigned [iprop]
+
+extern float
+	**envgzonevalue,		//general property zone value [iprop][izone]
+	**envgzonecurrent,		//current (time interpolated) general property zone value [iprop][izone]
+	***envovzonevalue,		//overland property zone value [iprop][layer][izone]
+	***envovzonecurrent;	//current (time interpolated) overland property zone value [iprop][layer][izone]
+
+extern unsigned char
+	***envgzone,		//zone id of a general property cell (NULL when uniform) [iprop][row][col]
+	****envovzone;		//zone id of an overland property cell (NULL when uniform) [iprop][layer][row][col]
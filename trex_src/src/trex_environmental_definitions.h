@@ -17,6 +17,13 @@ C-              Denver, CO  80225
 C-
 C-	Date:		16-MAR-2004
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Precomputed terrain terms of solar radiation for
+C-              snowmelt (compact list of domain cells).
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -168,3 +175,41 @@ float
 
 double
 	timemeteorology;	//update time for meteorological conditions (hours)
+
+//precomputed terrain terms of solar radiation (compact list of domain cells, see InitializeEnvironment)
+int
+	nsolarcells,		//number of domain cells of the solar radiation sweep
+	*solarcellrow,		//row of a solar radiation cell [cell]
+	*solarcellcol;		//column of a solar radiation cell [cell]
+
+float
+	*slopecos,			//cosine of the terrain slope [cell]
+	*slopesinx,			//sine of the terrain slope times cosine of the slope azimuth (south = 0) [cell]
+	*slopesiny,			//sine of the terrain slope times sine of the slope azimuth (south = 0) [cell]
+	*solarview,			//sky view and land cover factor of solar radiation [cell]
+	*solarcosi,			//cosine of the solar incidence angle of the current update [cell]
+	suncosz,			//cosine of the solar zenith angle of the current update
+	sunx,				//sine of the solar zenith angle times cosine of the solar azimuth
+	suny,				//sine of the solar zenith angle times sine of the solar azimuth
+	sundirect,			//direct radiation per unit incidence and clear sky (W/m2)
+	sundiffuse;			//diffuse radiation per unit cloud cover (W/m2)
+
+//zoned storage of general and overland environmental properties
+//(uniform and zoned grids are kept as zone value tables, see EnvironmentZones)
+int
+	*nenvgzones,		//number of zones of a general property [iprop]
+	**envgzonetfid,		//time function id of a general property zone [iprop][izone]
+	*envgzonestale,		//flag: cell values of a zoned general property must be reassigned [iprop]
+	**nenvovzones,		//number of zones of an overland property layer [iprop][layer]
+	***envovzonetfid,	//time function id of an overland property zone [iprop][layer][izone]
+	*envovzonestale;	//flag: cell values of a zoned overland property must be reassigned [iprop]
+
+float
+	**envgzonevalue,		//general property zone value [iprop][izone]
+	**envgzonecurrent,		//current (time interpolated) general property zone value [iprop][izone]
+	***envovzonevalue,		//overland property zone value [iprop][layer][izone]
+	***envovzonecurrent;	//current (time interpolated) overland property zone value [iprop][layer][izone]
+
+unsigned char
+	***envgzone,		//zone id of a general property cell (NULL when uniform) [iprop][row][col]
+	****envovzone;		//zone id of an overland property cell (NULL when uniform) [iprop][layer][row][col]
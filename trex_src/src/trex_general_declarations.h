@@ -28,6 +28,120 @@ C-
 C-	Revisions:	Added declarations for time step option (dtopt)
 C-              implementation
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added compact overland source/direction slots
+C-              (NOVSLOTS, OVSLOT, OVSOURCE) and slot allocation
+C-              prototypes
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added mass accounting flags and the Mass Accounting
+C-              Modules prototypes.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added declarations for step recovery.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added kernel snapshot numbers (KERNEL*), the Kernel
+C-              Snapshot Modules prototypes, and snapshotkernel.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added the power law evaluation modes (POW*), the
+C-              Batch Math Modules prototypes, powmode, powisa, and
+C-              the power plans.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added BatchSqrt.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added the Species Task Modules prototype,
+C-              ntaskthreads, and thread private loop indices (i, j,
+C-              k).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added the Mass Balance Monitor Modules prototypes,
+C-              the MB* water mass balance terms, mbtolerance,
+C-              mbstep, and mbtotal.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added the Telemetry Modules prototypes,
+C-              telemetryopt, mbreporterror, and mbreporttime.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added the memory footprint declarations (MEM*
+C-              subsystems and array families, dryrunopt,
+C-              memmeasured, memestimate).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added grid ingestion modules (GridIngest).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added sparse grid output frames (-gridsparse,
+C-              -gridwindows)
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Time series rows can be written to columnar series
+C-              stores (-tsstore, see SeriesStore)
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added packed grid output containers (-gridpack, see
+C-              GridPack)
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added the MS* terms of the streamed solids and
+C-              chemical mass balances.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added the Reset State Modules prototypes and
+C-              ClearMassBalanceMonitor.
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -64,6 +178,99 @@ C---------------------------------------------------------------------*/
 #define MAXBUFFERSIZE 1000	//Maximum size for allocating mamory for buffered arrays
 #define TOLERANCE 1.0e-7	//Error tolerance for single precision math
 
+//Overland source/direction slots: overland transport only uses Sources 0
+//(point sources), 1, 3, 5, 7 (N, E, S, W), 9 (floodplain) and 10 (outlet)
+//so overland flux arrays store NOVSLOTS compact slots per cell.  Channel
+//flux arrays keep Sources 0-10.
+#define NOVSLOTS 7		//Number of compact source/direction slots per overland cell
+#define OVSLOT(k) ((k) < 9 ? ((k)+1)/2 : (k)-4)		//Compact slot of overland source k (0,1,3,5,7,9,10 -> 0-6)
+#define OVSOURCE(k) ((k) == 0 || (k) == 10 || (k)%2 == 1)	//True if source k has an overland slot
+
+//Kernel snapshots: numbers of the kernels whose state can be captured to a
+//snapshot file and replayed in isolation (see KernelSnapshot)
+#define KERNELOVWATER 1			//OverlandWaterRoute
+#define KERNELCHWATER 2			//ChannelWaterRoute
+#define KERNELINFILTRATION 3	//Infiltration
+#define KERNELOVTRANSCAP 4		//OverlandSolidsTransportCapacity
+#define KERNELOVPARTITION 5		//OverlandChemicalPartitioning
+#define KERNELOVSOLIDS 6		//OverlandSolidsConcentration
+#define KERNELCHSOLIDS 7		//ChannelSolidsConcentration
+#define KERNELOVCHEMICAL 8		//OverlandChemicalConcentration
+#define KERNELCHCHEMICAL 9		//ChannelChemicalConcentration
+#define NKERNELS 9				//Number of kernels that can be captured
+
+//Power law evaluation modes (powmode) and batch size of the kernels (see BatchMath)
+#define POWBATCH 0			//batch math with the widest instruction set of the processor (default)
+#define POWLIBM 1			//libm pow (reproduces the scalar kernels bit for bit, validation)
+#define POWSCALAR 2			//batch math with scalar instructions
+#define POWAVX2 3			//batch math with AVX2 instructions
+#define POWAVX512 4			//batch math with AVX-512 instructions
+#define POWBATCHSIZE 256	//maximum number of powers a kernel gathers for one batch call
+
+//Water mass balance terms streamed by the water depth modules (see MassBalanceMonitor).
+#define MBGROSSRAIN 1	//gross rainfall volume (m3)
+#define MBNETRAIN 2		//net rainfall volume onto the overland plane (m3)
+#define MBGROSSSWE 3	//gross snowfall volume (as swe) (m3)
+#define MBNETSWE 4		//net snowfall volume (as swe) onto the overland plane (m3)
+#define MBINTERCEPT 5	//interception volume (m3)
+#define MBSWEMELT 6		//snowmelt volume (as swe) (m3)
+#define MBINFILT 7		//infiltration volume (m3)
+#define MBQWOV 8		//external flow volume entering the overland plane (m3)
+#define MBWATEROV 9		//water volume stored in the overland plane (m3)
+#define MBSWEOV 10		//snowpack volume (as swe) stored in the overland plane (m3)
+#define MBQOUTOV 11		//flow volume exiting the overland plane at outlets (m3)
+#define MBNETRAINCH 12	//rainfall volume onto channels (m3)
+#define MBNETSWECH 13	//snowfall volume (as swe) onto channels (m3)
+#define MBQWCH 14		//external flow volume entering the channel network (m3)
+#define MBQINCH 15		//flow volume entering the channel network at boundaries (m3)
+#define MBQOUTCH 16		//flow volume exiting the channel network at outlets (m3)
+#define MBTRANSLOSS 17	//transmission loss volume (m3)
+#define MBWATERCH 18	//water volume stored in the channel network (m3)
+#define NMBTERMS 18		//number of water mass balance terms
+
+//Solids and chemical mass balance terms streamed by the concentration modules
+//(see MassBalanceMonitor) [species][term].  Terms marked (chemicals) are zero for solids.
+#define MSWATEROV 1		//mass stored in the overland water column (kg)
+#define MSBEDOV 2		//mass stored in the soil stack (kg)
+#define MSERSOV 3		//mass entering the overland water column by erosion (kg)
+#define MSDEPOV 4		//mass exiting the overland water column by deposition (kg)
+#define MSPWROV 5		//mass entering the overland water column by porewater release (kg) (chemicals)
+#define MSINFOV 6		//mass exiting the overland water column by infiltration (kg) (chemicals)
+#define MSINFSURFOV 7	//mass exiting the surface soil layer by infiltration (kg) (chemicals)
+#define MSINFSTACKOV 8	//mass exiting the bottom of the soil stack by infiltration (kg) (chemicals)
+#define MSTNSINOV 9		//mass gained in the overland water column by transformations (kg) (chemicals)
+#define MSKININOV 10	//mass gained in the overland water column and soil stack by transformations (kg) (chemicals)
+#define MSKINOUTOV 11	//mass lost in the overland water column and soil stack by transformations (kg) (chemicals)
+#define NMSOVTERMS 11	//number of overland terms
+#define MSWATERCH 12	//mass stored in the channel water column (kg)
+#define MSBEDCH 13		//mass stored in the sediment stack (kg)
+#define MSERSCH 14		//mass entering the channel water column by erosion (kg)
+#define MSDEPCH 15		//mass exiting the channel water column by deposition (kg)
+#define MSPWRCH 16		//mass entering the channel water column by porewater release (kg) (chemicals)
+#define MSINFCH 17		//mass exiting the channel water column by transmission loss (kg) (chemicals)
+#define MSINFSURFCH 18	//mass exiting the surface sediment layer by transmission loss (kg) (chemicals)
+#define MSINFSTACKCH 19	//mass exiting the bottom of the sediment stack by transmission loss (kg) (chemicals)
+#define MSTNSINCH 20	//mass gained in the channel water column by transformations (kg) (chemicals)
+#define MSKININCH 21	//mass gained in the channel water column and sediment stack by transformations (kg) (chemicals)
+#define MSKINOUTCH 22	//mass lost in the channel water column and sediment stack by transformations (kg) (chemicals)
+#define NMSTERMS 22		//number of solids and chemical mass balance terms
+
+//Memory footprint subsystems (see MemoryFootprint, same order as TREXMEM* of trex_library.h)
+#define MEMGENERAL 0		//general controls, output specification, and model image
+#define MEMWATER 1			//hydrology: overland plane and channel network (Data Group B)
+#define MEMSOLIDS 2			//sediment transport and soil/sediment stacks (Data Group C)
+#define MEMCHEMICAL 3		//chemical transport (Data Group D)
+#define MEMENVIRONMENT 4	//environmental conditions (Data Group E)
+#define NMEMSUBSYSTEMS 5	//number of memory footprint subsystems
+
+//Memory footprint array families (estimate of a dry run, see EstimateMemory)
+#define MEMFAMGRID 0		//overland grids [row][col]
+#define MEMFAMSTACKOV 1		//overland cell and soil stack arrays [row][col][layer]
+#define MEMFAMNODE 2		//channel node arrays [link][node]
+#define MEMFAMSTACKCH 3		//channel node and sediment stack arrays [link][node][layer]
+#define MEMFAMINPUT 4		//tables, mask, and channel network read by the dry run (measured)
+#define NMEMFAMILIES 5		//number of memory footprint array families
+
 /*************************/
 /*   FILE DECLARATIONS   */
 /*************************/
@@ -156,6 +363,113 @@ extern void TruncateDT(void);				//Truncate time step values to a fixed number o
 extern void WriteDTBuffer(void);			//Write sequence of numerical integration time steps to temporary buffer file
 extern void WriteDTFile(void);				//Write sequence of numerical integration time steps to file
 
+//Model Image Modules
+extern void OpenModelImage(void);			//Open model image for compilation or loading
+extern void CloseModelImage(void);			//Complete (compile) or release (load) model image
+extern int BeginImageGrid(char *);			//Start reading a grid file through the model image
+extern void EndImageGrid(void);				//Finish reading a grid file through the model image
+extern void ImageScanInt(FILE *, int *);	//Read next integer grid value (image or grid file)
+extern void ImageScanFloat(FILE *, float *);	//Read next float grid value (image or grid file)
+extern FILE *OpenOutputFile(char *, char *);	//Open an output file (a model image compilation writes to the null device)
+extern void TruncateOutputFile(char *, long);	//Set the size of an output file (bytes)
+
+//Grid Ingestion Modules
+extern void BeginIngestGrid(void);			//Start the ingestion of grid file values (values are parsed at the first scan)
+extern void EndIngestGrid(void);			//Release the ingested values of the grid file just read
+extern void IngestScanInt(FILE *, int *);	//Read next integer grid value (parsed buffer or fscanf)
+extern void IngestScanFloat(FILE *, float *);	//Read next float grid value (parsed buffer or fscanf)
+
+//Sparse Grid Output Modules
+extern void SetGridWindows(char *);			//Set the grid windows file of the output selection (NULL = whole domain)
+extern void InitializeGridOutput(void);		//Build the output selection of sparse grid frames
+extern void WriteSparseGrid(char *, float **, float, int);	//Write the selected cells of a grid as a sparse frame
+extern void FreeGridOutput(void);			//Free the output selection of sparse grid frames
+
+//Series Store Modules
+extern void BeginSeriesRow(char *);			//Start a row of the series store of an export file
+extern void ExportValue(FILE *, char *, float);	//Write a value of an export row (text file or series store row)
+extern void EndSeriesRow(void);				//End a row of a series store (full blocks are written)
+extern void CloseSeriesStore(void);			//Write the last blocks and time indexes and free the series stores
+
+//Packed Grid Output Modules
+extern void WritePackedGrid(char *, float **, float, int);	//Append a grid as a compressed frame to its container
+extern int UnpackGridFrame(unsigned char *, int, int, int, unsigned int *);	//Decode the value bits of a compressed frame
+extern void CloseGridPack(void);			//Write the time indexes and free the packed grid containers
+
+//Overland Slot Storage Modules
+extern void AllocateOverlandSlots(float **, int);		//Allocate compact source/direction slots (float) for one row of an overland array
+extern void AllocateOverlandSlotsDouble(double **, int);	//Allocate compact source/direction slots (double) for one row of an overland array
+
+//Mass Accounting Modules
+extern void InitializeMassAccounting(void);			//Select tracked mass budgets and allocate the pending (per-step) totals
+extern void CompensatedSum(double *, double *, double);	//Add a value to a compensated (Kahan) sum
+extern void AccumulateLoadTotals(void);			//Add the per-step (pending) totals to the cumulative totals
+extern void FreeMassAccounting(void);				//Free memory for pending totals
+
+//Mass Balance Monitor Modules
+extern void InitializeMassBalanceMonitor(void);	//Clear the step values and running totals of the water mass balance
+extern void StartMassBalanceMonitor(void);		//Set the storage terms to the initial volumes (start of a pass)
+extern void ClearMassBalanceMonitor(void);		//Clear the step values and running totals of all mass balances (TrexReset)
+extern void ClearMassBalanceStep(int, int);		//Clear the step values of mass balance terms first to last
+extern float ChannelWaterVolume(int, int, float);	//Return the water volume of a channel node at a flow depth
+extern void StreamMassBalance(void);			//Add the step values of an accepted time step to the running totals
+extern int ReportMassBalance(void);				//Write the running water mass balance (returns 1 if the error exceeds the tolerance)
+extern void MassBalanceTotals(void);			//Set the domain totals of end of run results from the running totals
+extern void ClearSolidsMassBalanceStep(int, int);	//Clear the step values of solids mass balance terms first to last
+extern void ClearChemicalMassBalanceStep(int, int);	//Clear the step values of chemical mass balance terms first to last
+extern void StreamStackMass(int, int *, int *, int, double);	//Add the stack masses of listed cells or nodes (times a sign) to the running bed storage
+extern void SolidsMassBalanceTotals(void);		//Set the solids domain totals of end of run results from the running totals
+extern void ChemicalMassBalanceTotals(void);	//Set the chemical domain totals of end of run results from the running totals
+extern void FreeMassBalanceMonitor(void);		//Free memory for the solids and chemical mass balance terms
+
+//Telemetry Modules
+extern void StartTelemetry(char *);		//Create the telemetry segment of this run and publish the start of a simulation
+extern void UpdateTelemetry(int, int, float, float);	//Publish the run status after a time step (or at a change of run state)
+extern void StopTelemetry(void);		//Publish the end of the run and remove the telemetry segment
+
+//Memory Footprint Modules
+extern void StartMemoryAccount(void);		//Start the heap accounting of a simulation (clear the subsystem totals)
+extern void MemoryCheckpoint(int);			//Charge the heap growth since the last checkpoint to a subsystem
+extern void EstimateMemory(void);			//Estimate the memory of a simulation from the inputs read by a dry run
+extern void WriteMemoryReport(FILE *);		//Write the memory footprint by subsystem (and array family for a dry run)
+
+//Step Recovery Modules
+extern void BeginStepRecovery(void);		//Save the state changed by a time step and apply the recovery time step ceiling
+extern int RejectStep(int, int, int, int);	//Reject the time step for a negative depth or concentration (0 = cannot be rejected)
+extern void RetryStep(void);				//Restore the saved state and reduce the time step of a rejected time step
+extern void RecordTimeStep(void);			//Record an accepted automated time step in the time step series
+extern void EndStepRecovery(void);			//Grow the recovery time step ceiling after an accepted time step
+extern void FreeStepRecovery(void);			//Free memory for the saved time step state
+
+//Reset State Modules
+extern void SaveResetState(void);			//Save the state after initialization
+extern int RestoreResetState(void);			//Restore the state after initialization (0 = no state is saved)
+extern void FreeResetState(void);			//Free memory for the state saved after initialization
+
+//Kernel Snapshot Modules
+extern int KernelSnapshotId(char *);			//Return the number of a kernel name (0 = not a kernel that can be captured)
+extern char *KernelSnapshotName(int);			//Return the name of a kernel number
+extern void SetKernelSnapshot(int, double, char *);	//Select the kernel, simulation time, and file of a capture
+extern void CaptureKernel(int);					//Write kernel state before (0) or after (1) the kernel to the snapshot file
+extern int LoadKernelSnapshot(char *, double *);	//Read and save the kernel state of a snapshot file (returns the kernel)
+extern void RestoreKernelSnapshot(void);		//Restore the saved kernel state before a replay
+extern void RunKernel(int);						//Call the kernel of a kernel number
+extern long CompareKernelSnapshot(void);		//Compare kernel outputs with the snapshot file (number of values that differ)
+extern long KernelCells(int);					//Return the number of cells or nodes a kernel loops over
+extern void FreeKernelSnapshot(void);			//Close the snapshot file and free the saved kernel state
+
+//Batch Math Modules
+extern void InitializeBatchMath(void);			//Select the instruction set and specialize constant exponents (power plans)
+extern int PowModeId(char *);					//Return the power law evaluation mode of a name (-1 = not a mode)
+extern char *PowModeName(int);					//Return the name of a power law evaluation mode
+extern void BatchPow(double *, int, int);		//Compute x[i]^exponent of a power plan for n values (in place)
+extern void BatchPowArray(double *, double *, int);	//Compute x[i]^e[i] for n values (in place)
+extern double PowValue(double, int);			//Return x^exponent of a power plan for one value
+extern void BatchSqrt(double *, int);			//Compute sqrt(x[i]) for n values (in place)
+
+//Species Task Modules
+extern void RunSpeciesTasks(void (*)(int, int), int);	//Run a transport task for all solids or chemical types (one type per task on ntaskthreads threads)
+
 
 
 /************************************/
@@ -180,7 +494,8 @@ extern char
 	*dmpfile,			//dump (detailed results) file
 	*msbfile,			//mass balance file
 	*statsfile,			//statistics file
-	*errorfile;			//simulation error file
+	*errorfile,			//simulation error file
+	*imagefile;			//model image file name (specified by the -compile or -image argument)
 
 extern int
 	i,		//loop index
@@ -205,7 +520,39 @@ extern int
 	ndt,	//Number of Time Steps
 	nprintout,		//Number of print intervals for tabular output
 	nprintgrid,		//Number of print intervals for grid output
-	gridcount;		//running count of the number of time grids are printed (grid sequence number)
+	gridcount,		//running count of the number of time grids are printed (grid sequence number)
+	imageopt,		//model image option (0 = no image, 1 = compile image, 2 = run from image)
+	imagegrid,		//grid values of the grid file being read come from the model image (0 = no, 1 = yes)
+	trackdspovmass,	//overland dispersion mass budgets are accumulated (0 = no, 1 = yes)
+	trackdspchmass,	//channel dispersion mass budgets are accumulated (0 = no, 1 = yes)
+	maxrejects,		//maximum number of successive rejections of a time step (0 = step recovery off)
+	nrejects,		//number of rejections of the current time step
+	totalrejects,	//total number of rejected time steps
+	rejecterrorno,	//simulation error number of the violation that rejects the current time step (0 = none)
+	rejectrow,		//row (or link) of the violation that rejects the current time step
+	rejectcol,		//column (or node) of the violation that rejects the current time step
+	rejecttype,		//solids or chemical type of the violation that rejects the current time step (0 = water)
+	snapshotkernel,	//kernel captured to the snapshot file at the snapshot time (0 = none, see KERNEL* numbers)
+	powmode,		//requested power law evaluation mode (POWBATCH, POWLIBM, POWSCALAR, POWAVX2, POWAVX512)
+	powisa,			//selected power law evaluation mode (POWLIBM, POWSCALAR, POWAVX2, POWAVX512)
+	powplanovdepth,	//power plan of the overland Manning depth exponent (1.667)
+	powplanovslope,	//power plan of the overland Manning slope exponent (0.5)
+	powplanchradius,	//power plan of the channel Manning hydraulic radius exponent (0.6667)
+	powplanbetaov,	//power plan of the overland transport capacity unit flow exponent (-1 = varies by land use)
+	powplangammaov,	//power plan of the overland transport capacity slope exponent (-1 = varies by land use)
+	ntaskthreads,	//number of threads of the solids and chemical transport tasks (0 or 1 = serial)
+	telemetryopt,	//run status is published to the telemetry segment each time step (0 = off)
+	dryrunopt,		//memory use is estimated without reading the value grids (dry run) (0 = off)
+	gridsparseopt,	//grid output is written as sparse frames (0 = full rasters, 1 = non-zero cells, 2 = all selected cells)
+	tsstoreopt,		//time series output is written to columnar series stores (0 = text export files, 1 = series stores)
+	gridpackopt;	//grid output is written as compressed frames of one container per grid (0 = rasters, 1 = containers)
+
+//Note:  The loop indices are private to each thread so that the transport
+//       kernels of different solids and chemical types can run as tasks on
+//       several threads (see SpeciesTasks).
+#ifdef _OPENMP
+#pragma omp threadprivate(i, j, k)
+#endif
 
 extern float
 	w,			//width of square cell in overland plane (grid cell size) (m) (to be eventually replaced by dx, dy)
@@ -214,6 +561,10 @@ extern float
 	dtmax,		//maximum time step (dt) value (used for dtopt = 1-2)
 	maxcourant,	//maximum courant number for numerical stability (used for dtopt = 1-2)
 	relaxation,	//relaxation factor for time step calculations (used for dtopt = 1-2)
+	recoveryfactor,	//time step reduction factor for a rejected time step (0 < factor < 1)
+	recoverygrowth,	//growth factor of the time step ceiling after an accepted time step (> 1)
+	dtrecovery,		//time step ceiling after a rejected time step (s) (0 = no ceiling)
+	mbtolerance,	//water mass balance error (%) that stops the simulation (0 = never stop)
 	*dt,				//numerical integration time step
 	*dttime,			//Time up to which the time step is used
 	*printout,			//Print interval for tabular output
@@ -226,3 +577,11 @@ extern double
 	tzero,			//simulation time at time zero (decimal julian day/time) (day of year)
 	tstart,			//simulation start time (elapsed time past time zero) (hours)
 	tend;			//simulation end time
+
+extern double
+	mbstep[NMBTERMS+1],		//water mass balance terms of the current time step (see MB* terms)
+	mbtotal[NMBTERMS+1],	//running totals of the water mass balance terms (storage terms are current volumes)
+	mbreporterror,		//water mass balance error (%) of the last report (ReportMassBalance)
+	mbreporttime,		//simulation time (hours) of the last water mass balance report
+	memmeasured[NMEMSUBSYSTEMS],	//heap bytes allocated by each subsystem (measured, see MemoryFootprint)
+	memestimate[NMEMSUBSYSTEMS][NMEMFAMILIES];	//heap bytes estimated by a dry run [subsystem][array family]
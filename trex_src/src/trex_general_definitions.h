@@ -28,6 +28,82 @@ C-
 C-	Revisions:	Added declarations for time step option (dtopt)
 C-              implementation
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added mass accounting flags.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added declarations for step recovery.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added kernel snapshot numbers (KERNEL*), the Kernel
+C-              Snapshot Modules prototypes, and snapshotkernel.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added the power law evaluation modes (POW*), the
+C-              Batch Math Modules prototypes, powmode, powisa, and
+C-              the power plans.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added the Species Task Modules prototype,
+C-              ntaskthreads, and thread private loop indices (i, j,
+C-              k).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added mbtolerance, mbstep, and mbtotal (mass balance
+C-              monitor).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added telemetryopt, mbreporterror, and mbreporttime
+C-              (telemetry).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added dryrunopt, memmeasured, and memestimate.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added sparse grid output frames (-gridsparse,
+C-              -gridwindows)
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Time series rows can be written to columnar series
+C-              stores (-tsstore, see SeriesStore)
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added packed grid output containers (-gridpack, see
+C-              GridPack)
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -81,7 +157,8 @@ char
 	*dmpfile,			//dump (detailed results) file
 	*msbfile,			//mass balance file
 	*statsfile,			//statistics file
-	*errorfile;			//simulation error file
+	*errorfile,			//simulation error file
+	*imagefile;			//model image file name (specified by the -compile or -image argument)
 
 int 
 	i,		//loop index
@@ -106,7 +183,37 @@ int
 	ndt,	//Number of Time Steps
 	nprintout,		//Number of print intervals for tabular output
 	nprintgrid,		//Number of print intervals for grid output
-	gridcount;		//running count of the number of time grids are printed (grid sequence number)
+	gridcount,		//running count of the number of time grids are printed (grid sequence number)
+	imageopt,		//model image option (0 = no image, 1 = compile image, 2 = run from image)
+	imagegrid,		//grid values of the grid file being read come from the model image (0 = no, 1 = yes)
+	trackdspovmass,	//overland dispersion mass budgets are accumulated (0 = no, 1 = yes)
+	trackdspchmass,	//channel dispersion mass budgets are accumulated (0 = no, 1 = yes)
+	maxrejects,		//maximum number of successive rejections of a time step (0 = step recovery off)
+	nrejects,		//number of rejections of the current time step
+	totalrejects,	//total number of rejected time steps
+	rejecterrorno,	//simulation error number of the violation that rejects the current time step (0 = none)
+	rejectrow,		//row (or link) of the violation that rejects the current time step
+	rejectcol,		//column (or node) of the violation that rejects the current time step
+	rejecttype,		//solids or chemical type of the violation that rejects the current time step (0 = water)
+	snapshotkernel,	//kernel captured to the snapshot file at the snapshot time (0 = none, see KERNEL* numbers)
+	powmode,		//requested power law evaluation mode (POWBATCH, POWLIBM, POWSCALAR, POWAVX2, POWAVX512)
+	powisa,			//selected power law evaluation mode (POWLIBM, POWSCALAR, POWAVX2, POWAVX512)
+	powplanovdepth,	//power plan of the overland Manning depth exponent (1.667)
+	powplanovslope,	//power plan of the overland Manning slope exponent (0.5)
+	powplanchradius,	//power plan of the channel Manning hydraulic radius exponent (0.6667)
+	powplanbetaov,	//power plan of the overland transport capacity unit flow exponent (-1 = varies by land use)
+	powplangammaov,	//power plan of the overland transport capacity slope exponent (-1 = varies by land use)
+	ntaskthreads,	//number of threads of the solids and chemical transport tasks (0 or 1 = serial)
+	telemetryopt,	//run status is published to the telemetry segment each time step (0 = off)
+	dryrunopt,		//memory use is estimated without reading the value grids (dry run) (0 = off)
+	gridsparseopt,	//grid output is written as sparse frames (0 = full rasters, 1 = non-zero cells, 2 = all selected cells)
+	tsstoreopt,		//time series output is written to columnar series stores (0 = text export files, 1 = series stores)
+	gridpackopt;	//grid output is written as compressed frames of one container per grid (0 = rasters, 1 = containers)
+
+//loop indices are private to each thread (see SpeciesTasks)
+#ifdef _OPENMP
+#pragma omp threadprivate(i, j, k)
+#endif
 	
 float
 	w,			//width of square cell in overland plane (grid cell size) (m) (to be eventually replaced by dx, dy)
@@ -115,6 +222,10 @@ float
 	dtmax,		//maximum time step (dt) value (used for dtopt = 1-2)
 	maxcourant,	//maximum courant number for numerical stability (used for dtopt = 1-2)
 	relaxation,	//relaxation factor for time step calculations (used for dtopt = 1-2)
+	recoveryfactor = 0.5,	//time step reduction factor for a rejected time step (0 < factor < 1)
+	recoverygrowth = 1.25,	//growth factor of the time step ceiling after an accepted time step (> 1)
+	dtrecovery,		//time step ceiling after a rejected time step (s) (0 = no ceiling)
+	mbtolerance,	//water mass balance error (%) that stops the simulation (0 = never stop)
 	*dt,				//numerical integration time step
 	*dttime,			//Time up to which the time step is used
 	*printout,			//Print interval for tabular output
@@ -127,3 +238,11 @@ double
 	tzero,			//simulation time at time zero (decimal julian day/time) (day of year)
 	tstart,			//simulation start time (elapsed time past time zero) (hours)
 	tend;			//simulation end time
+
+double
+	mbstep[NMBTERMS+1],		//water mass balance terms of the current time step (see MB* terms)
+	mbtotal[NMBTERMS+1],	//running totals of the water mass balance terms (storage terms are current volumes)
+	mbreporterror,		//water mass balance error (%) of the last report (ReportMassBalance)
+	mbreporttime,		//simulation time (hours) of the last water mass balance report
+	memmeasured[NMEMSUBSYSTEMS],	//heap bytes allocated by each subsystem (measured, see MemoryFootprint)
+	memestimate[NMEMSUBSYSTEMS][NMEMFAMILIES];	//heap bytes estimated by a dry run [subsystem][array family]
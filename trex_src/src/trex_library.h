@@ -0,0 +1,413 @@
+/*----------------------------------------------------------------------
+C-  Header:     trex_library.h
+C-
+C-	Purpose/	Public interface of the trex library (libtrex).  The
+C-	Methods:	library holds all trex modules and global variables.
+C-              A host program (the trex executable, a calibration
+C-              driver, a coupled model) runs a simulation through
+C-              the calls below instead of the main loop in trex.c:
+C-
+C-                TrexInit          read inputs and initialize
+C-                TrexStep          advance one time step
+C-                TrexRunUntil      advance to a simulation time
+C-                TrexGetField      copy an overland state grid
+C-                TrexSetParameter  change a calibration parameter
+C-                TrexSetRecovery   set time step rejection and recovery
+C-                TrexSetPowMode    set the power law evaluation mode
+C-                TrexSetPartitionTolerance  set the partitioning tolerance
+C-                TrexSetThreads    set the threads of the transport tasks
+C-                TrexSetMassBalanceTolerance  set the mass balance stop tolerance
+C-                TrexSetTelemetry  publish the run status (telemetry segment)
+C-                TrexSetDryRun     estimate memory use without running
+C-                TrexGetMemory     memory footprint of each subsystem
+C-                TrexSetGridSparse write grid output as sparse frames
+C-                TrexSetGridWindows  restrict grid output to windows
+C-                TrexSetSeriesStore  write time series to series stores
+C-                TrexSetGridPack   write grid output to compressed containers
+C-                TrexUnpackGridFrame  decode a frame of a grid container
+C-                TrexGetPhaseTimes time spent in each time step phase
+C-                TrexSetSnapshot   capture a kernel to a snapshot file
+C-                TrexReplayKernel  time a kernel replayed from a snapshot
+C-                TrexReset         return to the initial state
+C-                TrexFinalize      write end of run results
+C-
+C-              Only one simulation can be active in a process (the
+C-              model state is global).  Input errors still abort the
+C-              process as they do for the executable.
+C-
+C-	Created:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added TrexSetRecovery.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added TrexGetPhaseTimes.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added TrexSetSnapshot, TrexReplayKernel, and
+C-              TrexKernelName.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added TrexSetPowMode.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added TrexSetPartitionTolerance.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added TrexSetThreads.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added TrexSetMassBalanceTolerance.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added TrexSetTelemetry and TrexTelemetry.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added TrexSetDryRun, TrexGetMemory, TREXDRYRUN, and
+C-              the TREXMEM* subsystems.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added sparse grid output frames (-gridsparse,
+C-              -gridwindows)
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Time series rows can be written to columnar series
+C-              stores (-tsstore, see SeriesStore)
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added packed grid output containers (-gridpack, see
+C-              GridPack)
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	TrexReset restores the state saved after
+C-              initialization instead of reading the inputs again
+C-              (see ResetState)
+C-
+C-	Revised:
+C-
+C-	Date:
+C-
+C-	Revisions:
+C-
+C---------------------------------------------------------------------*/
+
+#ifndef TREX_LIBRARY_H
+#define TREX_LIBRARY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//status values returned by TrexInit, TrexStep, TrexRunUntil, and TrexReset
+#define TREXFINISHED 0	//simulation reached its end time (no time steps remain)
+#define TREXCONTINUE 1	//simulation has time steps remaining
+#define TREXCOMPILED 2	//model image compiled (no simulation was started)
+#define TREXDRYRUN 3	//memory use estimated by a dry run (no simulation was started)
+
+//time step phases timed by the library (index of values from TrexGetPhaseTimes)
+#define TREXPHASEFORCING 0		//time functions and environmental conditions
+#define TREXPHASEWATER 1		//water transport and mass balance
+#define TREXPHASESOLIDS 2		//solids transport and mass balance
+#define TREXPHASECHEMICAL 3		//chemical transport and mass balance
+#define TREXPHASEOUTPUT 4		//time series, dump file, and grid output
+#define TREXPHASENEWSTATE 5		//new state for the next time step
+#define TREXNPHASES 6			//number of timed phases
+
+//memory footprint subsystems (index of values from TrexGetMemory)
+#define TREXMEMGENERAL 0		//general controls, output specification, and model image
+#define TREXMEMWATER 1			//hydrology: overland plane and channel network
+#define TREXMEMSOLIDS 2			//sediment transport and soil/sediment stacks
+#define TREXMEMCHEMICAL 3		//chemical transport
+#define TREXMEMENVIRONMENT 4	//environmental conditions
+#define TREXNMEMORY 5			//number of memory footprint subsystems
+
+//run telemetry (see TrexSetTelemetry): a running simulation publishes its
+//status in a POSIX shared memory segment named TREXTELEMETRYPREFIX followed
+//by the process id (e.g. /trex.12345).  The writer increments sequence
+//before and after each update (the values are consistent when sequence is
+//even and unchanged over a copy of the segment).
+#define TREXTELEMETRYPREFIX "/trex."	//prefix of the telemetry segment name
+#define TREXTELEMETRYVERSION 1			//layout version of TrexTelemetry
+#define TREXTELEMETRYSTARTING 0		//inputs are being read
+#define TREXTELEMETRYRUNNING 1		//simulation is running
+#define TREXTELEMETRYFINISHED 2		//simulation reached its end time (or was stopped)
+#define TREXTELEMETRYDONE 3			//end of run results were written
+
+typedef struct
+{
+	int version;		//layout version (TREXTELEMETRYVERSION)
+	int pid;			//process id of the simulation
+	volatile unsigned int sequence;	//update count (odd while the values are written)
+	int state;			//run state (TREXTELEMETRYSTARTING, ..., TREXTELEMETRYDONE)
+	int ksim;			//simulation type (1 = hydrology, 2 = sediment, 3 = chemical)
+	long steps;			//accepted time steps
+	long rejects;		//rejected time steps (step recovery)
+	double updated;		//wall clock time of the last update (seconds since epoch)
+	double started;		//wall clock time at start of the simulation (seconds since epoch)
+	double simtime;		//simulation time (hours)
+	double tstart;		//simulation start time (hours)
+	double tend;		//simulation end time (hours)
+	double dt;			//current time step (seconds)
+	double maxcourantov;	//maximum overland courant number of the last time step
+	double maxcourantch;	//maximum channel courant number of the last time step
+	double stepspersecond;	//accepted time steps per wall clock second (last sample, >= 1 s)
+	double phaseseconds[TREXNPHASES];	//wall clock time of each time step phase (seconds)
+	double memorykb;	//resident memory of the process (kB)
+	double peakmemorykb;	//peak resident memory of the process (kB)
+	double mberror;		//water mass balance error of the last report (%)
+	double mbtime;		//simulation time of the last mass balance report (hours)
+	char inputfile[256];	//name of the input file
+} TrexTelemetry;
+
+//packed grid containers (see TrexSetGridPack): a container (name.gpk) starts
+//with TREXGRIDPACKID, eight integers (TREXGRIDPACKVERSION, ncols, nrows,
+//nodata value, number of domain cells, cells of a chunk, frames from one key
+//frame to the next, 0), three doubles (xllcorner, yllcorner, cellsize), and
+//the domain mask (one bit per cell in row major order, low bit first).  Each
+//frame is TREXGRIDPACKFRAMEID, four integers (grid count, key frame flag,
+//body size, 0), and the body (see TrexUnpackGridFrame).  At the end of the
+//run, TREXGRIDPACKINDEXID, the number of frames, a TrexGridPackFrame entry
+//per frame, the offset of the index (long long), and TREXGRIDPACKID are
+//appended.  Values are written in native byte order.
+#define TREXGRIDPACKID "TREXGPAK"			//identifier at the start and end of a container
+#define TREXGRIDPACKFRAMEID "GRIDFRAM"		//identifier at the start of a frame
+#define TREXGRIDPACKINDEXID "GRIDINDX"		//identifier at the start of the time index
+#define TREXGRIDPACKVERSION 1				//layout version of a container
+
+typedef struct
+{
+	long long offset;	//offset of the frame in the container (bytes)
+	int gridcount;		//grid count of the frame (extension of the raster file name)
+	int keyframe;		//the frame is a key frame (values are not deltas to the previous frame)
+	int size;			//size of the frame body (bytes)
+	int reserved;		//zero
+} TrexGridPackFrame;
+
+//Initialize a simulation: input file name, restart option (-1 = none,
+//0 = restart0, 1 = restart1, 2 = restart2), model image option (0 = none,
+//1 = compile, 2 = run from image), and model image file name (or NULL)
+extern int TrexInit(char *inputname, int restartoption, int imageoption, char *imagename);
+
+//Advance the simulation by one time step (returns TREXCONTINUE or TREXFINISHED)
+extern int TrexStep(void);
+
+//Advance the simulation while simulation time (hours) <= endtime
+extern int TrexRunUntil(double endtime);
+
+//Return the current simulation time (hours)
+extern double TrexGetTime(void);
+
+//Return the number of grid rows and columns
+extern void TrexGetDimensions(int *rows, int *cols);
+
+//Copy a state grid into values[rows*cols] (row major, first row = top of
+//the grid, cells outside the domain = nodata value).  Fields: hov, sweov,
+//infiltrationdepth, grossrainrate, elevationov, hch (channel cells only),
+//csedov (index = solids type), cchemov (index = chemical type).  Returns
+//the number of values copied or -1 if the field is not available.
+extern int TrexGetField(char *name, int index, float *values);
+
+//Set a calibration parameter by name and class index: nmanningov (land use),
+//khsoil, capshsoil, soilmd (soil type), nmanningch (all nodes of a link).
+//Returns 0 on success or -1 if the parameter or index is not valid.
+extern int TrexSetParameter(char *name, int index, double value);
+
+//Set step recovery: a time step with a negative water depth or concentration
+//is rejected and repeated with dt multiplied by reduction (0 < reduction < 1),
+//up to rejects successive times (0 = off, the default); the reduced dt then
+//grows by growth (> 1) per accepted time step back to the nominal dt.  The
+//controls are kept across TrexReset.  Returns 0 on success or -1 if not valid.
+extern int TrexSetRecovery(int rejects, double reduction, double growth);
+
+//Set the evaluation of the power laws of the transport kernels (Manning
+//flow, transport capacity): "batch" (SIMD batch math with the widest
+//instruction set of the processor, the default), "avx512", "avx2",
+//"scalar" (batch math with the given instruction set), or "libm" (libm
+//pow, reproduces the results of the scalar kernels bit for bit).  Batch
+//math results are within 1 float ulp of libm.  The mode is kept across
+//TrexReset.  Returns 0 on success or -1 if the mode name is not valid.
+extern int TrexSetPowMode(char *mode);
+
+//Set the relative tolerance of incremental chemical partitioning.  Buried
+//soil and sediment layers are only repartitioned when their stack, doc, or
+//wetting front changes.  The water column and surface layer are
+//repartitioned when their porosity or a solids concentration moved by more
+//than tolerance (relative to the values of their last partitioning).  The
+//default (0) repartitions on any change and gives the results of a full
+//computation.  The tolerance is kept across TrexReset.  Returns 0 on success
+//or -1 if tolerance < 0.
+extern int TrexSetPartitionTolerance(double tolerance);
+
+//Set the number of threads of the solids and chemical transport tasks.  The
+//transport kernels of each solids type (deposition) and chemical type
+//(infiltration, deposition, advection, dispersion, erosion, floodplain
+//transfer) run as separate tasks on nthreads threads.  Results do not
+//depend on the number of threads.  The default (1) runs the kernels
+//serially.  The setting is kept across TrexReset.  Returns 0 on success or
+//-1 if nthreads < 1 or if nthreads > 1 and libtrex was built without OpenMP.
+extern int TrexSetThreads(int nthreads);
+
+//Set the water mass balance error (percent) that stops the simulation.  The
+//water mass balance is streamed by the water depth modules and its running
+//error is written to the echo file at each print interval.  When the
+//magnitude of the error exceeds a tolerance > 0, TrexStep returns
+//TREXFINISHED and TrexFinalize writes end of run results for the time
+//reached.  The default (0) never stops the simulation.  The tolerance is kept
+//across TrexReset.  Returns 0 on success or -1 if percent < 0.
+extern int TrexSetMassBalanceTolerance(double percent);
+
+//Publish the run status in a telemetry segment (see TrexTelemetry) when
+//enable is 1: simulation time, time step, courant numbers, time steps per
+//second, phase times, memory use, and water mass balance error, updated
+//after each time step.  The segment is created by TrexInit and removed by
+//TrexFinalize.  The trexstat program attaches to the segment of a running
+//simulation.  The default (0) creates no segment.  The setting is kept across
+//TrexReset.  Returns 0 on success or -1 if enable is not 0 or 1 or if enable
+//is 1 and telemetry is not available (Windows).
+extern int TrexSetTelemetry(int enable);
+
+//Select a dry run when enable is 1: TrexInit reads the input file without
+//the value grids (only the mask, link, and node grids and the tables are
+//read), writes the estimated memory footprint by subsystem and array family
+//to the screen and the echo file, and returns TREXDRYRUN without starting a
+//simulation (see TrexGetMemory).  The default (0) runs the simulation.  The
+//setting is kept across TrexReset.  Returns 0 on success or -1 if enable is
+//not 0 or 1.
+extern int TrexSetDryRun(int enable);
+
+//Select sparse grid output: Data Group F grid outputs are written as sparse
+//frames (see GridOutput) that list, with their row and column, the cells of
+//the output selection with a value that is not zero (mode 1) or all cells of
+//the output selection (mode 2).  The trexgrid program reconstructs the full
+//raster of a frame.  The default (0) writes full rasters.  The setting is
+//kept across TrexReset.  Returns 0 on success or -1 if mode is not 0, 1, or 2.
+extern int TrexSetGridSparse(int mode);
+
+//Restrict sparse grid output to the windows and mask zones of a grid windows
+//file (lines "domain [step]", "window row1 col1 row2 col2 [step]", and "mask
+//gridfile value [step]", where step decimates the rows and columns).  The file
+//is read by TrexInit.  When grid output is written as full rasters, mode 2 of
+//TrexSetGridSparse is selected.  A NULL or empty file selects the whole domain.
+//The setting is kept across TrexReset.  Returns 0.
+extern int TrexSetGridWindows(char *file);
+
+//Select series stores for the time series output: the rows of each export
+//file (water, solids, and chemical reporting stations) are buffered in memory
+//and appended in blocks, column by column, to a binary store file named by the
+//export file followed by .tss (see SeriesStore).  The text export files keep
+//their header lines.  The trexseries program lists a store and exports its
+//columns to comma-delimited text.  The default (0) writes text rows.  The
+//setting is kept across TrexReset.  Returns 0 on success or -1 if enable is
+//not 0 or 1.
+extern int TrexSetSeriesStore(int enable);
+
+//Select packed grid output: each Data Group F grid output (and end of run
+//grid) is appended as a compressed frame to one container per grid, named
+//by the grid output followed by .gpk (see GridPack and TREXGRIDPACKID).
+//Packed output takes precedence over sparse grid output.  The trexunpack
+//program lists the frames of a container and writes the raster of a frame.
+//The default (0) writes rasters.  The setting is kept across TrexReset.
+//Returns 0 on success or -1 if enable is not 0 or 1.
+extern int TrexSetGridPack(int enable);
+
+//Decode the body of a frame of a packed grid container: size is the body
+//size of the frame, ncells the number of domain cells of the container, and
+//keyframe the key frame flag of the frame.  bits holds the value bits (float)
+//of the previous frame of the container (not used for key frames) and
+//receives the value bits of the frame.  Returns 0 on success or -1 if the
+//frame is not valid.
+extern int TrexUnpackGridFrame(unsigned char *body, int size, int ncells, int keyframe, unsigned int *bits);
+
+//Copy the memory footprint (bytes) of each subsystem into bytes[TREXNMEMORY]:
+//after a dry run, the estimated footprint; otherwise the heap allocated by
+//the inputs and initialization of the simulation (measured, 0 where the
+//allocator does not report its heap).  Returns the number of subsystems.
+extern int TrexGetMemory(double *bytes);
+
+//Copy the wall clock time (seconds) spent in each time step phase since the
+//simulation was initialized (or reset) into seconds[TREXNPHASES].  Repeated
+//(rejected) time steps are included.  Returns the number of phases.
+extern int TrexGetPhaseTimes(double *seconds);
+
+//Capture the state of a kernel to a snapshot file at the first call of the
+//kernel at or after a simulation time (hours): the kernel inputs and outputs
+//before the call and the outputs after it.  Kernels: OverlandWaterRoute,
+//ChannelWaterRoute, Infiltration, OverlandSolidsTransportCapacity,
+//OverlandChemicalPartitioning, OverlandSolidsConcentration,
+//ChannelSolidsConcentration, OverlandChemicalConcentration,
+//ChannelChemicalConcentration.  Call before or after TrexInit (one capture
+//per call).  Returns 0 on success or -1 if the kernel name is not valid.
+extern int TrexSetSnapshot(char *kernel, double time, char *filename);
+
+//Replay the kernel of a snapshot file repeats times (the input deck of the
+//snapshot must be initialized by TrexInit).  Before each repetition the
+//kernel state is restored from the snapshot; only the kernel call is timed.
+//Returns the kernel number (see TrexKernelName) or -1 if not valid, with the
+//snapshot time (hours), the total kernel time (seconds), the number of cells
+//or channel nodes the kernel loops over, and the number of output values
+//that differ (bit for bit) from the captured outputs.  The model state is
+//left at the replayed state (use TrexReset before continuing a simulation).
+extern int TrexReplayKernel(char *filename, int repeats, double *time,
+	double *seconds, long *cells, long *mismatches);
+
+//Return the name of a kernel number (empty string if not a kernel)
+extern char *TrexKernelName(int kernel);
+
+//Return to the initial state.  The state saved in memory after
+//initialization is restored (no input file is read), so parameters set by
+//TrexSetParameter are replaced by their input values, and the output files
+//are truncated to their sizes after initialization.  The inputs are read
+//again (from the model image when one is used) after a dry run, a model
+//image compilation, or a kernel replay, or when the dry run, sparse grid,
+//or grid windows settings changed.
+extern int TrexReset(void);
+
+//Write end of run results (time series, grids, mass balance, summary, restart)
+extern void TrexFinalize(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	//TREX_LIBRARY_H
@@ -17,6 +17,48 @@ C-              Denver, CO  80225
 C-
 C-	Date:		16-MAR-2004
 C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added pending load totals and compensation terms.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Replaced stack pop/push flags with work lists of
+C-              flagged cells and nodes.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added dstarpowov (transport capacity grain size
+C-              weights).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added surface soil parameter grids (vcsoilov,
+C-              kuslesoilov, porositysoilov).
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Load areas are stored for the load cells only
+C-              (swdovarea[isolid][iload][icell]) instead of a full
+C-              grid for each load.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added the streamed solids mass balance terms
+C-              (mbsolidsstep, mbsolidstotal).
+C-
 C-	Revised:
 C-
 C-	Date:
@@ -162,11 +204,24 @@ int
 	**nsbcpairs,		//Number of solids boundary condition pairs [ioutlet][isolid]
 	**sbcpoint,			//pointer to current position for a solids boundary condition function [ioutlet][isolid]
 
-	popovflag,			//flag to signal if any location in the overland soil stack needs upward re-indexing (unburial)
-	pushovflag,			//flag to signal if any location in the overland soil stack needs downward re-indexing (burial)
-
-	popchflag,			//flag to signal if any location in the channel sediment stack needs upward re-indexing (unburial)
-	pushchflag;			//flag to signal if any location in the channel sediment stack needs downward re-indexing (burial)
+	npopov,				//number of overland cells listed for upward re-indexing of the soil stack (unburial)
+	npushov,			//number of overland cells listed for downward re-indexing of the soil stack (burial)
+	*popovrow,			//row of each overland cell listed for unburial [ientry]
+	*popovcol,			//column of each overland cell listed for unburial [ientry]
+	*pushovrow,			//row of each overland cell listed for burial [ientry]
+	*pushovcol,			//column of each overland cell listed for burial [ientry]
+
+	npopch,				//number of channel nodes listed for upward re-indexing of the sediment stack (unburial)
+	npushch,			//number of channel nodes listed for downward re-indexing of the sediment stack (burial)
+	*popchlink,			//link of each channel node listed for unburial [ientry]
+	*popchnode,			//node of each channel node listed for unburial [ientry]
+	*pushchlink,		//link of each channel node listed for burial [ientry]
+	*pushchnode,		//node of each channel node listed for burial [ientry]
+
+	nstackevents,		//number of stack events logged during the current time step
+	*stackeventtype,	//type of each logged stack event (1 = soil stack collapse, 2 = sediment stack collapse) [ievent]
+	*stackeventa,		//row (soil) or link (sediment) of each logged stack event [ievent]
+	*stackeventb;		//column (soil) or node (sediment) of each logged stack event [ievent]
 
 int
 	*abropt,			//solids abrasion option
@@ -211,6 +266,10 @@ float
 
 	*porosityov,		//overland soil porosity (dimensionless) [isoil]
 
+	**vcsoilov,			//critical velocity for erosion of the surface soil layer (m/s) [row][col]
+	**kuslesoilov,		//USLE K factor of the surface soil layer [row][col]
+	**porositysoilov,	//porosity of the surface soil layer (dimensionless) [row][col]
+
 	*tcdov,				//critical shear stress for deposition overland (pdep) (N/m2) [isolid]
 	*vcch,				//critical velocity for erosion in channels (m/s) [isolid]
 	*tceov,				//critical shear stress for erosion overland (excess shear) (N/m2) [isolid]
@@ -243,7 +302,7 @@ float
 	***swpov,			//Value for an overland point source solids load [isolid][iload][ipair]
 	***swpovtime,		//Time break for an overland point source solids load [isolid][iload][ipair]
 
-	****swdovarea,		//Value for an overland distributed solids load area [isolid][iload][row][col] (m2)
+	***swdovarea,		//Value for an overland distributed solids load area [isolid][iload][iswdovcells[][]] (m2)
 	***swdov,			//Value for an overland distributed solids load (g/m2/mm) [isolid][iload][ipair]
 	***swdovtime,		//Time break for an overland distributed solids load [isolid][iload][ipair]
 
@@ -331,8 +390,8 @@ float
     ***transcapov,	//overland solids transport capacity [isolid][row][col]
     ***transcapch,		//channel solids transport capacity [isolid][link][node]
 
-	**taumaxov,			//maximum shear stress overland (shear stress memory, lasts for up to 30 days) (N/m2) [link][node]
-	**taumaxtimeov,		//time of maximum shear stress overland (hours) [link][node]
+	**taumaxov,			//maximum shear stress overland (shear stress memory, lasts for up to 30 days) (N/m2) [row][col]
+	**taumaxtimeov,		//time of maximum shear stress overland (hours) [row][col]
 
 	**taumaxch,			//maximum shear stress in channels (shear stress memory, lasts for up to 30 days) (N/m2) [link][node]
 	**taumaxtimech,		//time of maximum shear stress in channels (hours) [link][node]
@@ -451,7 +510,15 @@ double
 	*totaldepsedoutch,		//cumulative sum of solids mass exiting water column by channel deposition (kg)
 
 	*totalswov,				//cumulative sum of external solids loads entering overland plane (m3)
-	*totalswch;				//cumulative sum of external solids loads entering channel network (m3)
+	*totalswch,				//cumulative sum of external solids loads entering channel network (m3)
+
+	*pendingswov,			//external solids loads entering overland plane in the current time step (kg) [solid]
+	*pendingswch,			//external solids loads entering channel network in the current time step (kg) [solid]
+	*carryswov,				//compensation term of the compensated sum totalswov (kg) [solid]
+	*carryswch,				//compensation term of the compensated sum totalswch (kg) [solid]
+
+	**mbsolidsstep,		//solids mass balance terms of the current time step (kg) [solid][term] (see MS* terms)
+	**mbsolidstotal;		//running totals of the solids mass balance terms (storage terms are current masses) (kg) [solid][term]
 
 double
 	***vlayerov0,		//initial volume of an overland soil layer (m3) [row][col][layer]
@@ -462,6 +529,9 @@ double
 	***vlayerch,		//present volume of a channel sediment layer (m) [link][node][layer]
 	***vlayerchnew;		//volume of a channel sediment layer for next time t + dt (m) [link][node][layer]
 
+double
+	**dstarpowov;		//transport capacity grain size weight dstar^tcwexpov [iland][isolid]
+
 double
 	*maxcsedov0,	//maximum solids concentration in water column of overland plane
 	*mincsedov0,	//minimum solids concentration in water column of overland plane
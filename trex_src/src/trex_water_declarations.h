@@ -33,6 +33,13 @@ C-	Date:		29-Jul-2010
 C-
 C-	Revisions:	Added declarations for time step option (dtopt)
 C-              implementation and Courant number calculations.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added surface soil parameter prototypes and grids
+C-              (khsoilov, capmdsoilov, soilmdov).
 C-
 C-	Revised:
 C-
@@ -140,6 +147,12 @@ extern void ReadInitialSnowFile(void);
 extern void ComputeInitialStateWater(void);
 extern void InitializeWater(void);  //Initializes water transport variables (sets initial values)
 
+//Materialized (per cell) parameters of the surface soil layer
+extern void InitializeSoilParameters(void);  //Allocates and sets the surface soil parameters of all cells
+extern void UpdateSoilParameters(void);  //Sets the surface soil parameters of all cells (soil types or parameters changed)
+extern void UpdateSoilCell(int, int);  //Sets the surface soil parameters of one cell (surface layer changed)
+extern void FreeSoilParameters(void);  //Frees memory for the surface soil parameters
+
 //Initializes piecewise linear time functions for water (Loads, BCs)
 extern void TimeFunctionInitWater(void);
 
@@ -387,6 +400,10 @@ extern float
 	*capshsoil,			//Capillary Suction Head of soil
 	*soilmd,			//Soil Moisture Deficit
 
+	**khsoilov,			//Hydraulic Conductivity of the surface soil layer [row][col] (infopt > 0)
+	**capmdsoilov,		//Capillary Suction Head * Soil Moisture Deficit of the surface soil layer [row][col] (infopt > 0)
+	**soilmdov,			//Soil Moisture Deficit of the surface soil layer [row][col] (infopt > 0)
+
 	**khsed,			//Hydraulic Conductivity of sediment
 	**capshsed,			//Capillary Suction Head of sediment
 	**sedmd,			//Sediment Moisture Deficit
@@ -33,6 +33,13 @@ C-	Date:		29-Jul-2010
 C-
 C-	Revisions:	Added declarations for time step option (dtopt)
 C-              implementation and Courant number calculations.
+C-
+C-	Revised:	TREX Development Team
+C-
+C-	Date:		18-OCT-2026
+C-
+C-	Revisions:	Added surface soil parameter prototypes and grids
+C-              (khsoilov, capmdsoilov, soilmdov).
 C-
 C-	Revised:
 C-
@@ -285,6 +292,10 @@ float
 	*capshsoil,			//Capillary Suction Head of soil
 	*soilmd,			//Soil Moisture Deficit
 
+	**khsoilov,			//Hydraulic Conductivity of the surface soil layer [row][col] (infopt > 0)
+	**capmdsoilov,		//Capillary Suction Head * Soil Moisture Deficit of the surface soil layer [row][col] (infopt > 0)
+	**soilmdov,			//Soil Moisture Deficit of the surface soil layer [row][col] (infopt > 0)
+
 	**khsed,			//Hydraulic Conductivity of sediment
 	**capshsed,			//Capillary Suction Head of sediment
 	**sedmd,			//Sediment Moisture Deficit